@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <numeric>
@@ -28,6 +29,32 @@ namespace Cabana
 {
 namespace Benchmark
 {
+//---------------------------------------------------------------------------//
+// Warmup and repetition policy for a benchmark run loop. The first
+// num_warmup runs recorded by a timer built with a policy are discarded -
+// they absorb JIT, cache, and allocator warmup effects that would otherwise
+// skew the statistics. The counts can be overridden at run time with the
+// CABANA_BENCHMARK_WARMUP and CABANA_BENCHMARK_REPEAT environment variables
+// so the same binary can be swept without recompiling.
+struct RunPolicy
+{
+    int num_warmup;
+    int num_run;
+
+    RunPolicy( const int warmup, const int run )
+        : num_warmup( warmup )
+        , num_run( run )
+    {
+        if ( const char* env = std::getenv( "CABANA_BENCHMARK_WARMUP" ) )
+            num_warmup = std::atoi( env );
+        if ( const char* env = std::getenv( "CABANA_BENCHMARK_REPEAT" ) )
+            num_run = std::atoi( env );
+    }
+
+    // Total number of runs the benchmark loop should execute.
+    int numTotal() const { return num_warmup + num_run; }
+};
+
 //---------------------------------------------------------------------------//
 // Local timer. Carries multiple data points (the independent variable in
 // the parameter sweep) for each timer to allow for parametric sweeps. Each
@@ -43,6 +70,20 @@ class Timer
         , _starts( num_data )
         , _data( num_data )
         , _is_stopped( num_data, true )
+        , _num_warmup( 0 )
+    {
+    }
+
+    // Create the timer with a run policy. The first num_warmup recordings
+    // of each data point are treated as warmup and excluded from the
+    // reported samples.
+    Timer( const std::string& name, const int num_data,
+           const RunPolicy& policy )
+        : _name( name )
+        , _starts( num_data )
+        , _data( num_data )
+        , _is_stopped( num_data, true )
+        , _num_warmup( policy.num_warmup )
     {
     }
 
@@ -67,51 +108,168 @@ class Timer
         _is_stopped[data_point] = true;
     }
 
+    // Get the measured samples of a data point with warmup runs removed.
+    std::vector<double> samples( const int data_point ) const
+    {
+        if ( !_is_stopped[data_point] )
+            throw std::logic_error(
+                "attempted to output from a running timer" );
+        const auto& runs = _data[data_point];
+        std::size_t begin =
+            std::min( static_cast<std::size_t>( _num_warmup ), runs.size() );
+        // Keep at least one sample even if everything was labeled warmup.
+        if ( begin == runs.size() && !runs.empty() )
+            begin = runs.size() - 1;
+        return std::vector<double>( runs.begin() + begin, runs.end() );
+    }
+
   public:
     std::string _name;
     std::vector<std::chrono::high_resolution_clock::time_point> _starts;
     std::vector<std::vector<double>> _data;
     std::vector<bool> _is_stopped;
+    int _num_warmup;
+};
+
+//---------------------------------------------------------------------------//
+// Summary statistics of a set of timing samples. In addition to the
+// classical min/max/average the median and the median absolute deviation
+// (MAD) are reported - both are robust to the occasional outlier run
+// (interrupts, clock ramps, page faults) that would otherwise move the
+// aggregate, which matters when two machines or driver versions are
+// compared on single-digit percent differences.
+struct Statistics
+{
+    std::size_t num_sample;
+    double min;
+    double max;
+    double ave;
+    double median;
+    double mad;
+};
+
+// Compute the median of a sorted sample vector.
+inline double medianOfSorted( const std::vector<double>& sorted )
+{
+    std::size_t n = sorted.size();
+    if ( 0 == n % 2 )
+        return 0.5 * ( sorted[n / 2 - 1] + sorted[n / 2] );
+    return sorted[n / 2];
+}
+
+// Compute summary statistics of a set of timing samples.
+inline Statistics computeStatistics( std::vector<double> samples )
+{
+    if ( samples.empty() )
+        throw std::logic_error( "no samples to compute statistics from" );
+
+    Statistics stats;
+    stats.num_sample = samples.size();
+    std::sort( samples.begin(), samples.end() );
+    stats.min = samples.front();
+    stats.max = samples.back();
+    stats.ave = std::accumulate( samples.begin(), samples.end(), 0.0 ) /
+                samples.size();
+    stats.median = medianOfSorted( samples );
+    std::vector<double> deviations( samples.size() );
+    for ( std::size_t i = 0; i < samples.size(); ++i )
+        deviations[i] = std::fabs( samples[i] - stats.median );
+    std::sort( deviations.begin(), deviations.end() );
+    stats.mad = medianOfSorted( deviations );
+    return stats;
+}
+
+//---------------------------------------------------------------------------//
+// Output format of the benchmark results. The table format is the
+// human-readable layout, csv emits one header and one row per data point,
+// and json emits one JSON object per data point on its own line (JSON
+// Lines) so results from many runs can be concatenated and parsed.
+enum class OutputFormat
+{
+    table,
+    csv,
+    json
 };
 
+// Parse an output format name (e.g. from a command line argument).
+inline OutputFormat parseOutputFormat( const std::string& name )
+{
+    if ( "table" == name )
+        return OutputFormat::table;
+    if ( "csv" == name )
+        return OutputFormat::csv;
+    if ( "json" == name )
+        return OutputFormat::json;
+    throw std::runtime_error( "unknown benchmark output format: " + name );
+}
+
+//---------------------------------------------------------------------------//
+// Structured output of one statistics record keyed by backend and data
+// point value so results from different machines, backends, and problem
+// sizes can be joined on the key columns.
+template <class Scalar>
+void outputRecord( std::ostream& stream, const OutputFormat format,
+                   const std::string& name, const std::string& backend,
+                   const std::string& data_point_name,
+                   const Scalar data_point_val, const int num_rank,
+                   const Statistics& stats, const bool write_header )
+{
+    if ( OutputFormat::csv == format )
+    {
+        if ( write_header )
+            stream << "name,backend,num_rank," << data_point_name
+                   << ",num_sample,min,max,ave,median,mad\n";
+        stream << name << "," << backend << "," << num_rank << ","
+               << data_point_val << "," << stats.num_sample << "," << stats.min
+               << "," << stats.max << "," << stats.ave << "," << stats.median
+               << "," << stats.mad << "\n";
+    }
+    else if ( OutputFormat::json == format )
+    {
+        stream << "{\"name\":\"" << name << "\",\"backend\":\"" << backend
+               << "\",\"num_rank\":" << num_rank << ",\"" << data_point_name
+               << "\":" << data_point_val
+               << ",\"num_sample\":" << stats.num_sample
+               << ",\"min\":" << stats.min << ",\"max\":" << stats.max
+               << ",\"ave\":" << stats.ave << ",\"median\":" << stats.median
+               << ",\"mad\":" << stats.mad << "}\n";
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Local output.
 // Write timer results. Provide the values of the data points so
-// they can be injected into the table.
+// they can be injected into the table. The backend key is only used by the
+// structured csv and json formats.
 template <class Scalar>
 void outputResults( std::ostream& stream, const std::string& data_point_name,
                     const std::vector<Scalar>& data_point_vals,
-                    const Timer& timer )
+                    const Timer& timer,
+                    const OutputFormat format = OutputFormat::table,
+                    const std::string& backend = "" )
 {
     // Write the data header.
-    stream << "\n";
-    stream << timer._name << "\n";
-    stream << data_point_name << " min max ave"
-           << "\n";
+    if ( OutputFormat::table == format )
+    {
+        stream << "\n";
+        stream << timer._name << "\n";
+        stream << data_point_name << " min max ave median mad"
+               << "\n";
+    }
 
     // Write out each data point
     for ( std::size_t n = 0; n < timer._data.size(); ++n )
     {
-        if ( !timer._is_stopped[n] )
-            throw std::logic_error(
-                "attempted to output from a running timer" );
-
-        // Compute the minimum.
-        double local_min =
-            *std::min_element( timer._data[n].begin(), timer._data[n].end() );
-
-        // Compute the maximum.
-        double local_max =
-            *std::max_element( timer._data[n].begin(), timer._data[n].end() );
-
-        // Compute the average.
-        double local_sum = std::accumulate( timer._data[n].begin(),
-                                            timer._data[n].end(), 0.0 );
-        double average = local_sum / timer._data[n].size();
-
-        // Output.
-        stream << data_point_vals[n] << " " << local_min << " " << local_max
-               << " " << average << "\n";
+        auto stats = computeStatistics( timer.samples( n ) );
+
+        if ( OutputFormat::table == format )
+            stream << data_point_vals[n] << " " << stats.min << " "
+                   << stats.max << " " << stats.ave << " " << stats.median
+                   << " " << stats.mad << "\n";
+        else
+            outputRecord( stream, format, timer._name, backend,
+                          data_point_name, data_point_vals[n], 1, stats,
+                          0 == n );
     }
 }
 
@@ -124,7 +282,9 @@ void outputResults( std::ostream& stream, const std::string& data_point_name,
 template <class Scalar>
 void outputResults( std::ostream& stream, const std::string& data_point_name,
                     const std::vector<Scalar>& data_point_vals,
-                    const Timer& timer, MPI_Comm comm )
+                    const Timer& timer, MPI_Comm comm,
+                    const OutputFormat format = OutputFormat::table,
+                    const std::string& backend = "" )
 {
     // Get comm rank;
     int comm_rank;
@@ -135,45 +295,41 @@ void outputResults( std::ostream& stream, const std::string& data_point_name,
     MPI_Comm_size( comm, &comm_size );
 
     // Write the data header.
-    if ( 0 == comm_rank )
+    if ( 0 == comm_rank && OutputFormat::table == format )
     {
         stream << "\n";
         stream << timer._name << "\n";
-        stream << "num_rank " << data_point_name << " min max ave"
+        stream << "num_rank " << data_point_name << " min max ave median mad"
                << "\n";
     }
 
     // Write out each data point
     for ( std::size_t n = 0; n < timer._data.size(); ++n )
     {
-        if ( !timer._is_stopped[n] )
-            throw std::logic_error(
-                "attempted to output from a running timer" );
-
-        // Compute the minimum.
-        double local_min =
-            *std::min_element( timer._data[n].begin(), timer._data[n].end() );
-        double global_min = 0.0;
-        MPI_Reduce( &local_min, &global_min, 1, MPI_DOUBLE, MPI_MIN, 0, comm );
-
-        // Compute the maximum.
-        double local_max =
-            *std::max_element( timer._data[n].begin(), timer._data[n].end() );
-        double global_max = 0.0;
-        MPI_Reduce( &local_max, &global_max, 1, MPI_DOUBLE, MPI_MAX, 0, comm );
-
-        // Compute the average.
-        double local_sum = std::accumulate( timer._data[n].begin(),
-                                            timer._data[n].end(), 0.0 );
-        double average = 0.0;
-        MPI_Reduce( &local_sum, &average, 1, MPI_DOUBLE, MPI_SUM, 0, comm );
-        average /= timer._data[n].size() * comm_size;
+        // Gather the samples of every rank - the run loops are symmetric so
+        // every rank has the same count - and compute the statistics over
+        // the whole ensemble on rank 0. Robust statistics (median/MAD) need
+        // the full sample set, not per-rank reductions.
+        auto local_samples = timer.samples( n );
+        int num_local = local_samples.size();
+        std::vector<double> global_samples;
+        if ( 0 == comm_rank )
+            global_samples.resize( num_local * comm_size );
+        MPI_Gather( local_samples.data(), num_local, MPI_DOUBLE,
+                    global_samples.data(), num_local, MPI_DOUBLE, 0, comm );
 
         // Output on rank 0.
         if ( 0 == comm_rank )
         {
-            stream << comm_size << " " << data_point_vals[n] << " "
-                   << global_min << " " << global_max << " " << average << "\n";
+            auto stats = computeStatistics( global_samples );
+            if ( OutputFormat::table == format )
+                stream << comm_size << " " << data_point_vals[n] << " "
+                       << stats.min << " " << stats.max << " " << stats.ave
+                       << " " << stats.median << " " << stats.mad << "\n";
+            else
+                outputRecord( stream, format, timer._name, backend,
+                              data_point_name, data_point_vals[n], comm_size,
+                              stats, 0 == n );
         }
     }
 }
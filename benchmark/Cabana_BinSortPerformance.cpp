@@ -27,7 +27,8 @@
 //---------------------------------------------------------------------------//
 // Performance test.
 template <class Device>
-void performanceTest( std::ostream& stream, const std::string& test_prefix )
+void performanceTest( std::ostream& stream, const std::string& test_prefix,
+                      const Cabana::Benchmark::OutputFormat format )
 {
     // Declare problem sizes.
     std::vector<int> problem_sizes = { 1000, 10000, 100000, 1000000, 10000000 };
@@ -50,8 +51,8 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
                                   100000, 1000000, 10000000 };
     int num_bin_size = num_bins.size();
 
-    // Number of runs in the test loops.
-    int num_run = 10;
+    // Warmup and repetition policy for the test loops.
+    Cabana::Benchmark::RunPolicy policy( 2, 10 );
 
     // Define the aosoa.
     using member_types = Cabana::MemberTypes<double[3], double[3], double, int>;
@@ -78,17 +79,17 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
         std::stringstream create_time_name;
         create_time_name << test_prefix << "bin_create_" << num_bins[b];
         Cabana::Benchmark::Timer create_timer( create_time_name.str(),
-                                               bin_num_problem );
+                                               bin_num_problem, policy );
         std::stringstream aosoa_permute_time_name;
         aosoa_permute_time_name << test_prefix << "bin_aosoa_permute_"
                                 << num_bins[b];
         Cabana::Benchmark::Timer aosoa_permute_timer(
-            aosoa_permute_time_name.str(), bin_num_problem );
+            aosoa_permute_time_name.str(), bin_num_problem, policy );
         std::stringstream slice_permute_time_name;
         slice_permute_time_name << test_prefix << "bin_slice_permute_"
                                 << num_bins[b];
         Cabana::Benchmark::Timer slice_permute_timer(
-            slice_permute_time_name.str(), bin_num_problem );
+            slice_permute_time_name.str(), bin_num_problem, policy );
 
         // Loop over the problem sizes.
         int pid = 0;
@@ -103,7 +104,7 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
                 psizes.push_back( problem_sizes[p] );
 
                 // Run tests and time the ensemble
-                for ( int t = 0; t < num_run; ++t )
+                for ( int t = 0; t < policy.numTotal(); ++t )
                 {
                     // Create the binning.
                     auto key_sv = Kokkos::subview(
@@ -130,9 +131,12 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
         }
 
         // Output results.
-        outputResults( stream, "problem_size", psizes, create_timer );
-        outputResults( stream, "problem_size", psizes, aosoa_permute_timer );
-        outputResults( stream, "problem_size", psizes, slice_permute_timer );
+        outputResults( stream, "problem_size", psizes, create_timer, format,
+                       test_prefix );
+        outputResults( stream, "problem_size", psizes, aosoa_permute_timer,
+                       format, test_prefix );
+        outputResults( stream, "problem_size", psizes, slice_permute_timer,
+                       format, test_prefix );
     }
 
     // SORTING
@@ -140,17 +144,17 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
 
     // Create sorting timers.
     Cabana::Benchmark::Timer create_timer( test_prefix + "sort_create",
-                                           num_problem_size );
+                                           num_problem_size, policy );
     Cabana::Benchmark::Timer aosoa_permute_timer(
-        test_prefix + "sort_aosoa_permute", num_problem_size );
+        test_prefix + "sort_aosoa_permute", num_problem_size, policy );
     Cabana::Benchmark::Timer slice_permute_timer(
-        test_prefix + "sort_slice_permute", num_problem_size );
+        test_prefix + "sort_slice_permute", num_problem_size, policy );
 
     // Loop over the problem sizes.
     for ( int p = 0; p < num_problem_size; ++p )
     {
         // Run tests and time the ensemble
-        for ( int t = 0; t < num_run; ++t )
+        for ( int t = 0; t < policy.numTotal(); ++t )
         {
             // Create the binning.
             auto key_sv = Kokkos::subview(
@@ -173,9 +177,12 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
     }
 
     // Output results.
-    outputResults( stream, "problem_size", problem_sizes, create_timer );
-    outputResults( stream, "problem_size", problem_sizes, aosoa_permute_timer );
-    outputResults( stream, "problem_size", problem_sizes, slice_permute_timer );
+    outputResults( stream, "problem_size", problem_sizes, create_timer,
+                   format, test_prefix );
+    outputResults( stream, "problem_size", problem_sizes,
+                   aosoa_permute_timer, format, test_prefix );
+    outputResults( stream, "problem_size", problem_sizes,
+                   slice_permute_timer, format, test_prefix );
 }
 
 //---------------------------------------------------------------------------//
@@ -189,6 +196,7 @@ int main( int argc, char* argv[] )
     if ( argc < 2 )
         throw std::runtime_error( "Incorrect number of arguments. \n \
              First argument -  file name for output \n \
+             Second argument (optional) - output format (table, csv, json) \n \
              \n \
              Example: \n \
              $/: ./BinSortPerformance test_results.txt\n" );
@@ -196,6 +204,11 @@ int main( int argc, char* argv[] )
     // Get the name of the output file.
     std::string filename = argv[1];
 
+    // Get the output format.
+    auto format = ( argc > 2 )
+                      ? Cabana::Benchmark::parseOutputFormat( argv[2] )
+                      : Cabana::Benchmark::OutputFormat::table;
+
     // Open the output file on rank 0.
     std::fstream file;
     file.open( filename, std::fstream::out );
@@ -203,17 +216,17 @@ int main( int argc, char* argv[] )
     // Run the tests.
 #ifdef KOKKOS_ENABLE_SERIAL
     using SerialDevice = Kokkos::Device<Kokkos::Serial, Kokkos::HostSpace>;
-    performanceTest<SerialDevice>( file, "serial_" );
+    performanceTest<SerialDevice>( file, "serial_", format );
 #endif
 
 #ifdef KOKKOS_ENABLE_OPENMP
     using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
-    performanceTest<OpenMPDevice>( file, "openmp_" );
+    performanceTest<OpenMPDevice>( file, "openmp_", format );
 #endif
 
 #ifdef KOKKOS_ENABLE_CUDA
     using CudaDevice = Kokkos::Device<Kokkos::Cuda, Kokkos::CudaSpace>;
-    performanceTest<CudaDevice>( file, "cuda_" );
+    performanceTest<CudaDevice>( file, "cuda_", format );
 #endif
 
     // Close the output file on rank 0.
@@ -0,0 +1,273 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "Cabana_BenchmarkUtils.hpp"
+
+#include <Cajita_Array.hpp>
+#include <Cajita_FastFourierTransform.hpp>
+#include <Cajita_GlobalGrid.hpp>
+#include <Cajita_GlobalMesh.hpp>
+#include <Cajita_LocalGrid.hpp>
+#include <Cajita_ManualPartitioner.hpp>
+#include <Cajita_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+using namespace Cajita;
+
+//---------------------------------------------------------------------------//
+// Measure forward and reverse transform time over a sweep of grid sizes for
+// one rank decomposition and one set of heFFTe parameters.
+template <class Device>
+void fftSweep( std::ostream& stream, const std::vector<int>& grid_sizes,
+               const ManualPartitioner& partitioner,
+               const Experimental::FastFourierTransformParams& params,
+               const std::string& test_prefix,
+               const Cabana::Benchmark::OutputFormat format )
+{
+    int num_size = grid_sizes.size();
+
+    // Warmup and repetition policy for the test loops.
+    Cabana::Benchmark::RunPolicy policy( 2, 10 );
+
+    // Create the timers.
+    Cabana::Benchmark::Timer create_timer( test_prefix + "fft_create",
+                                           num_size, policy );
+    Cabana::Benchmark::Timer forward_timer( test_prefix + "forward", num_size,
+                                            policy );
+    Cabana::Benchmark::Timer reverse_timer( test_prefix + "reverse", num_size,
+                                            policy );
+
+    // Sweep the grid sizes.
+    for ( int s = 0; s < num_size; ++s )
+    {
+        // Create the global mesh.
+        double cell_size = 1.0 / grid_sizes[s];
+        std::array<double, 3> low_corner = { 0.0, 0.0, 0.0 };
+        std::array<double, 3> high_corner = { 1.0, 1.0, 1.0 };
+        auto global_mesh =
+            createUniformGlobalMesh( low_corner, high_corner, cell_size );
+
+        // Create the global grid with the requested decomposition.
+        std::array<bool, 3> is_dim_periodic = { true, true, true };
+        auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                             is_dim_periodic, partitioner );
+
+        // Create a local grid and a complex-valued cell field.
+        auto local_grid = createLocalGrid( global_grid, 0 );
+        auto vector_layout = createArrayLayout( local_grid, 2, Cell() );
+        auto lhs = createArray<double, Device>( "fft_data", vector_layout );
+        ArrayOp::assign( *lhs, 1.0, Own() );
+
+        // Create the transform.
+        create_timer.start( s );
+        auto fft = Experimental::createHeffteFastFourierTransform<
+            double, Device>( *vector_layout, params );
+        create_timer.stop( s );
+
+        // Run tests and time the ensemble.
+        for ( int t = 0; t < policy.numTotal(); ++t )
+        {
+            forward_timer.start( s );
+            fft->forward( *lhs, Experimental::FFTScaleFull() );
+            forward_timer.stop( s );
+
+            reverse_timer.start( s );
+            fft->reverse( *lhs, Experimental::FFTScaleNone() );
+            reverse_timer.stop( s );
+        }
+    }
+
+    // Output results.
+    outputResults( stream, "grid_size_per_dim", grid_sizes, create_timer,
+                   MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "grid_size_per_dim", grid_sizes, forward_timer,
+                   MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "grid_size_per_dim", grid_sizes, reverse_timer,
+                   MPI_COMM_WORLD, format, test_prefix );
+}
+
+//---------------------------------------------------------------------------//
+// Sweep the heFFTe parameter space for one rank decomposition: point-to-point
+// vs. all-to-all reshapes, pencil vs. slab internal exchange, and strided vs.
+// reordered (contiguous) intermediate data. Comparing the all-to-all and
+// exchange variants against each other at a fixed grid size exposes the
+// communication-bound fraction of the transform - heFFTe does not report its
+// internal communication time separately.
+template <class Device>
+void parameterSweep( std::ostream& stream, const std::vector<int>& grid_sizes,
+                     const ManualPartitioner& partitioner,
+                     const std::string& test_prefix,
+                     const Cabana::Benchmark::OutputFormat format )
+{
+    for ( int alltoall = 0; alltoall < 2; ++alltoall )
+        for ( int pencils = 0; pencils < 2; ++pencils )
+            for ( int reorder = 0; reorder < 2; ++reorder )
+            {
+                Experimental::FastFourierTransformParams params;
+                params.setAllToAll( alltoall );
+                params.setPencils( pencils );
+                params.setReorder( reorder );
+
+                std::stringstream prefix;
+                prefix << test_prefix << "a2a" << alltoall << "_pencil"
+                       << pencils << "_reorder" << reorder << "_";
+                fftSweep<Device>( stream, grid_sizes, partitioner, params,
+                                  prefix.str(), format );
+            }
+}
+
+//---------------------------------------------------------------------------//
+// Run the parameter sweep over the rank decomposition shapes realizable with
+// the communicator size: a block decomposition, a pencil decomposition, and
+// a slab decomposition.
+template <class Device>
+void performanceTest( std::ostream& stream, const std::vector<int>& grid_sizes,
+                      const std::string& device_prefix,
+                      const Cabana::Benchmark::OutputFormat format )
+{
+    int comm_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+
+    // Build the candidate decompositions. Shapes that coincide for this
+    // communicator size (e.g. on a single rank) are only run once.
+    std::vector<std::pair<std::string, std::array<int, 3>>> decompositions;
+
+    int block_dims[3] = { 0, 0, 0 };
+    MPI_Dims_create( comm_size, 3, block_dims );
+    decompositions.emplace_back(
+        "block_",
+        std::array<int, 3>{ block_dims[0], block_dims[1], block_dims[2] } );
+
+    int pencil_dims[2] = { 0, 0 };
+    MPI_Dims_create( comm_size, 2, pencil_dims );
+    decompositions.emplace_back(
+        "pencil_", std::array<int, 3>{ 1, pencil_dims[0], pencil_dims[1] } );
+
+    decompositions.emplace_back( "slab_",
+                                 std::array<int, 3>{ 1, 1, comm_size } );
+
+    for ( std::size_t d = 0; d < decompositions.size(); ++d )
+    {
+        // Skip shapes already covered by an earlier candidate.
+        bool duplicate = false;
+        for ( std::size_t e = 0; e < d; ++e )
+            if ( decompositions[e].second == decompositions[d].second )
+                duplicate = true;
+        if ( duplicate )
+            continue;
+
+        ManualPartitioner partitioner( decompositions[d].second );
+        parameterSweep<Device>( stream, grid_sizes, partitioner,
+                                device_prefix + decompositions[d].first,
+                                format );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// main
+int main( int argc, char* argv[] )
+{
+    // Initialize environment
+    MPI_Init( &argc, &argv );
+    Kokkos::initialize( argc, argv );
+
+    // Check arguments.
+    if ( argc < 3 )
+        throw std::runtime_error( "Incorrect number of arguments. \n \
+             First argument - largest number of cells per dimension \n \
+             Second argument - file name for output \n \
+             Third argument (optional) - output format (table, csv, json) \n \
+             \n \
+             Example: \n \
+             $/: ./CajitaFFTPerformance 64 test_results.txt\n" );
+
+    // Largest number of cells per dimension across all ranks. The sweep runs
+    // this size and the two power-of-two sizes below it.
+    int max_cells_per_dim = std::atoi( argv[1] );
+    std::vector<int> grid_sizes = { max_cells_per_dim / 4,
+                                    max_cells_per_dim / 2, max_cells_per_dim };
+
+    // Get the name of the output file.
+    std::string filename = argv[2];
+
+    // Get the output format.
+    auto format = ( argc > 3 )
+                      ? Cabana::Benchmark::parseOutputFormat( argv[3] )
+                      : Cabana::Benchmark::OutputFormat::table;
+
+    // Barier before continuing.
+    MPI_Barrier( MPI_COMM_WORLD );
+
+    // Get comm rank;
+    int comm_rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &comm_rank );
+
+    // Get comm size;
+    int comm_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+
+    // Open the output file on rank 0.
+    std::fstream file;
+    if ( 0 == comm_rank )
+        file.open( filename, std::fstream::out );
+
+    // Output problem details. The banner is only part of the table format -
+    // the structured formats must stay machine-parseable.
+    if ( 0 == comm_rank && Cabana::Benchmark::OutputFormat::table == format )
+    {
+        file << "\n";
+        file << "Cajita FFT Performance Benchmark"
+             << "\n";
+        file << "----------------------------------------------"
+             << "\n";
+        file << "MPI Ranks: " << comm_size << "\n";
+        file << "Max cells per dimension: " << max_cells_per_dim << "\n";
+        file << "----------------------------------------------"
+             << "\n";
+        file << "\n";
+    }
+
+    // Run the benchmark on the available backends.
+#ifdef KOKKOS_ENABLE_SERIAL
+    using SerialDevice = Kokkos::Device<Kokkos::Serial, Kokkos::HostSpace>;
+    performanceTest<SerialDevice>( file, grid_sizes, "serial_", format );
+#endif
+#ifdef KOKKOS_ENABLE_OPENMP
+    using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
+    performanceTest<OpenMPDevice>( file, grid_sizes, "openmp_", format );
+#endif
+#ifdef KOKKOS_ENABLE_CUDA
+    using CudaDevice = Kokkos::Device<Kokkos::Cuda, Kokkos::CudaSpace>;
+    performanceTest<CudaDevice>( file, grid_sizes, "cuda_", format );
+#endif
+
+    // Close the output file on rank 0.
+    if ( 0 == comm_rank )
+        file.close();
+
+    // Finalize
+    Kokkos::finalize();
+    MPI_Finalize();
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
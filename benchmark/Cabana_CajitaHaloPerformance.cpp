@@ -0,0 +1,210 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "Cabana_BenchmarkUtils.hpp"
+
+#include <Cajita_Array.hpp>
+#include <Cajita_GlobalGrid.hpp>
+#include <Cajita_GlobalMesh.hpp>
+#include <Cajita_Halo.hpp>
+#include <Cajita_LocalGrid.hpp>
+#include <Cajita_Partitioner.hpp>
+#include <Cajita_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+using namespace Cajita;
+
+//---------------------------------------------------------------------------//
+// Measure gather and scatter time for one entity type and neighbor pattern
+// as a function of halo width.
+template <class Device, class EntityType, class Pattern>
+void haloSweep( std::ostream& stream, const int cells_per_dim,
+                const std::string& test_prefix,
+                const Cabana::Benchmark::OutputFormat format )
+{
+    using exec_space = typename Device::execution_space;
+
+    // Create the global mesh.
+    double cell_size = 1.0 / cells_per_dim;
+    std::array<double, 3> low_corner = { 0.0, 0.0, 0.0 };
+    std::array<double, 3> high_corner = { 1.0, 1.0, 1.0 };
+    auto global_mesh =
+        createUniformGlobalMesh( low_corner, high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Halo width sweep. The local grid carries the widest halo so one array
+    // serves every width.
+    std::vector<int> halo_widths = { 1, 2, 3 };
+    int num_width = halo_widths.size();
+    auto local_grid = createLocalGrid( global_grid, halo_widths.back() );
+
+    // Create the array.
+    auto layout = createArrayLayout( local_grid, 3, EntityType() );
+    auto array = createArray<double, Device>( "array", layout );
+    ArrayOp::assign( *array, 1.0, Ghost() );
+
+    // Warmup and repetition policy for the test loops.
+    Cabana::Benchmark::RunPolicy policy( 2, 10 );
+
+    // Create the timers.
+    Cabana::Benchmark::Timer halo_create( test_prefix + "halo_create",
+                                          num_width, policy );
+    Cabana::Benchmark::Timer halo_gather( test_prefix + "gather", num_width,
+                                          policy );
+    Cabana::Benchmark::Timer halo_scatter( test_prefix + "scatter",
+                                           num_width, policy );
+
+    // Sweep the halo width.
+    for ( int w = 0; w < num_width; ++w )
+    {
+        // Create a halo of this width.
+        halo_create.start( w );
+        auto halo = createHalo( *array, Pattern(), halo_widths[w] );
+        halo_create.stop( w );
+
+        // Run tests and time the ensemble.
+        for ( int t = 0; t < policy.numTotal(); ++t )
+        {
+            halo_gather.start( w );
+            halo->gather( exec_space(), *array );
+            halo_gather.stop( w );
+
+            halo_scatter.start( w );
+            halo->scatter( exec_space(), ScatterReduce::Sum(), *array );
+            halo_scatter.stop( w );
+        }
+    }
+
+    // Output results.
+    outputResults( stream, "halo_width", halo_widths, halo_create,
+                   MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "halo_width", halo_widths, halo_gather,
+                   MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "halo_width", halo_widths, halo_scatter,
+                   MPI_COMM_WORLD, format, test_prefix );
+}
+
+//---------------------------------------------------------------------------//
+// Run the sweep over entity types and neighbor patterns on a device.
+template <class Device>
+void performanceTest( std::ostream& stream, const int cells_per_dim,
+                      const std::string& device_prefix,
+                      const Cabana::Benchmark::OutputFormat format )
+{
+    haloSweep<Device, Cell, NodeHaloPattern<3>>(
+        stream, cells_per_dim, device_prefix + "cell_full_", format );
+    haloSweep<Device, Cell, FaceHaloPattern<3>>(
+        stream, cells_per_dim, device_prefix + "cell_face_", format );
+    haloSweep<Device, Node, NodeHaloPattern<3>>(
+        stream, cells_per_dim, device_prefix + "node_full_", format );
+    haloSweep<Device, Node, FaceHaloPattern<3>>(
+        stream, cells_per_dim, device_prefix + "node_face_", format );
+}
+
+//---------------------------------------------------------------------------//
+// main
+int main( int argc, char* argv[] )
+{
+    // Initialize environment
+    MPI_Init( &argc, &argv );
+    Kokkos::initialize( argc, argv );
+
+    // Check arguments.
+    if ( argc < 3 )
+        throw std::runtime_error( "Incorrect number of arguments. \n \
+             First argument - integer number of cells per dimension \n \
+             Second argument - file name for output \n \
+             Third argument (optional) - output format (table, csv, json) \n \
+             \n \
+             Example: \n \
+             $/: ./CajitaHaloPerformance 64 test_results.txt\n" );
+
+    // Number of cells per dimension across all ranks.
+    int cells_per_dim = std::atoi( argv[1] );
+
+    // Get the name of the output file.
+    std::string filename = argv[2];
+
+    // Get the output format.
+    auto format = ( argc > 3 )
+                      ? Cabana::Benchmark::parseOutputFormat( argv[3] )
+                      : Cabana::Benchmark::OutputFormat::table;
+
+    // Barier before continuing.
+    MPI_Barrier( MPI_COMM_WORLD );
+
+    // Get comm rank;
+    int comm_rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &comm_rank );
+
+    // Get comm size;
+    int comm_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+
+    // Open the output file on rank 0.
+    std::fstream file;
+    if ( 0 == comm_rank )
+        file.open( filename, std::fstream::out );
+
+    // Output problem details. The banner is only part of the table format -
+    // the structured formats must stay machine-parseable.
+    if ( 0 == comm_rank && Cabana::Benchmark::OutputFormat::table == format )
+    {
+        file << "\n";
+        file << "Cajita Halo Performance Benchmark"
+             << "\n";
+        file << "----------------------------------------------"
+             << "\n";
+        file << "MPI Ranks: " << comm_size << "\n";
+        file << "Cells per dimension: " << cells_per_dim << "\n";
+        file << "----------------------------------------------"
+             << "\n";
+        file << "\n";
+    }
+
+    // Run the benchmark on the available backends.
+#ifdef KOKKOS_ENABLE_SERIAL
+    using SerialDevice = Kokkos::Device<Kokkos::Serial, Kokkos::HostSpace>;
+    performanceTest<SerialDevice>( file, cells_per_dim, "serial_", format );
+#endif
+#ifdef KOKKOS_ENABLE_OPENMP
+    using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
+    performanceTest<OpenMPDevice>( file, cells_per_dim, "openmp_", format );
+#endif
+#ifdef KOKKOS_ENABLE_CUDA
+    using CudaDevice = Kokkos::Device<Kokkos::Cuda, Kokkos::CudaSpace>;
+    performanceTest<CudaDevice>( file, cells_per_dim, "cuda_", format );
+#endif
+
+    // Close the output file on rank 0.
+    if ( 0 == comm_rank )
+        file.close();
+
+    // Finalize
+    Kokkos::finalize();
+    MPI_Finalize();
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
@@ -25,13 +25,68 @@
 
 #include <mpi.h>
 
+//---------------------------------------------------------------------------//
+// Synthetic force kernel used to measure communication/compute overlap. The
+// work parameter scales the arithmetic intensity so the kernel can be sized
+// against the message time on a given machine.
+template <class AoSoA_t>
+void syntheticForceKernel( AoSoA_t& particles, const std::size_t num_particle,
+                           const int work )
+{
+    auto positions = Cabana::slice<0>( particles );
+    auto forces = Cabana::slice<1>( particles );
+    const int n = num_particle;
+    Kokkos::RangePolicy<typename AoSoA_t::execution_space> policy(
+        0, num_particle );
+    Kokkos::parallel_for(
+        "synthetic_force", policy, KOKKOS_LAMBDA( const int i ) {
+            double fx = 0.0;
+            double fy = 0.0;
+            double fz = 0.0;
+            for ( int w = 0; w < work; ++w )
+            {
+                int j = ( i + w + 1 ) % n;
+                double dx = positions( j, 0 ) - positions( i, 0 ) + 1.0;
+                double dy = positions( j, 1 ) - positions( i, 1 ) + 1.0;
+                double dz = positions( j, 2 ) - positions( i, 2 ) + 1.0;
+                double r2inv = 1.0 / ( dx * dx + dy * dy + dz * dz );
+                double r6inv = r2inv * r2inv * r2inv;
+                double f = r6inv * ( r6inv - 0.5 ) * r2inv;
+                fx += f * dx;
+                fy += f * dy;
+                fz += f * dz;
+            }
+            forces( i, 0 ) = fx;
+            forces( i, 1 ) = fy;
+            forces( i, 2 ) = fz;
+        } );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+// Average a timer data point over all runs and ranks. This function does
+// collective communication.
+double globalAverage( const Cabana::Benchmark::Timer& timer,
+                      const int data_point, MPI_Comm comm )
+{
+    auto samples = timer.samples( data_point );
+    double local_sum = std::accumulate( samples.begin(), samples.end(), 0.0 );
+    double local_avg = local_sum / samples.size();
+    double global_avg = 0.0;
+    MPI_Allreduce( &local_avg, &global_avg, 1, MPI_DOUBLE, MPI_SUM, comm );
+    int comm_size;
+    MPI_Comm_size( comm, &comm_size );
+    return global_avg / comm_size;
+}
+
 //---------------------------------------------------------------------------//
 // Performance test.
 // Data device type is where the data to be communicated lives.
 // Comm device type is the device we want to use for communication.
 template <class DataDevice, class CommDevice>
 void performanceTest( std::ostream& stream, const std::size_t num_particle,
-                      const std::string& test_prefix )
+                      const std::string& test_prefix,
+                      const Cabana::Benchmark::OutputFormat format )
 {
     // PROBLEM SETUP
     // -------------
@@ -97,8 +152,8 @@ void performanceTest( std::ostream& stream, const std::size_t num_particle,
     using tuple_type = Cabana::Tuple<member_types>;
     int bytes_per_particle = sizeof( tuple_type );
 
-    // Number of runs in the test loops.
-    int num_run = 10;
+    // Warmup and repetition policy for the test loops.
+    Cabana::Benchmark::RunPolicy policy( 2, 10 );
 
     // Fraction of particles on each rank that will be communicated to the
     // neighbors. We will sweep through these fractions to get an indicator of
@@ -115,13 +170,13 @@ void performanceTest( std::ostream& stream, const std::size_t num_particle,
 
     // Create distributor timers.
     Cabana::Benchmark::Timer distributor_fast_create(
-        test_prefix + "distributor_fast_create", num_fraction );
+        test_prefix + "distributor_fast_create", num_fraction, policy );
     Cabana::Benchmark::Timer distributor_general_create(
-        test_prefix + "distributor_general_create", num_fraction );
+        test_prefix + "distributor_general_create", num_fraction, policy );
     Cabana::Benchmark::Timer distributor_aosoa_migrate(
-        test_prefix + "distributor_aosoa_migrate", num_fraction );
+        test_prefix + "distributor_aosoa_migrate", num_fraction, policy );
     Cabana::Benchmark::Timer distributor_slice_migrate(
-        test_prefix + "distributor_slice_migrate", num_fraction );
+        test_prefix + "distributor_slice_migrate", num_fraction, policy );
 
     // Loop over comm fractions.
     for ( int fraction = 0; fraction < num_fraction; ++fraction )
@@ -155,7 +210,7 @@ void performanceTest( std::ostream& stream, const std::size_t num_particle,
             data_memory_space(), export_ranks_host );
 
         // Run tests and time the ensemble.
-        for ( int t = 0; t < num_run; ++t )
+        for ( int t = 0; t < policy.numTotal(); ++t )
         {
             // Create source particles.
             aosoa_type src_particles( "src_particles", num_particle );
@@ -227,28 +282,28 @@ void performanceTest( std::ostream& stream, const std::size_t num_particle,
 
     // Output results.
     outputResults( stream, "send_bytes", comm_bytes, distributor_fast_create,
-                   comm );
-    outputResults( stream, "send_bytes", comm_bytes, distributor_general_create,
-                   comm );
+                   comm, format, test_prefix );
+    outputResults( stream, "send_bytes", comm_bytes,
+                   distributor_general_create, comm, format, test_prefix );
     outputResults( stream, "send_bytes", comm_bytes, distributor_aosoa_migrate,
-                   comm );
+                   comm, format, test_prefix );
     outputResults( stream, "send_bytes", comm_bytes, distributor_slice_migrate,
-                   comm );
+                   comm, format, test_prefix );
 
     // HALO
     // ----
 
     // Create halo timers.
     Cabana::Benchmark::Timer halo_fast_create( test_prefix + "halo_fast_create",
-                                               num_fraction );
+                                               num_fraction, policy );
     Cabana::Benchmark::Timer halo_general_create(
-        test_prefix + "halo_general_create", num_fraction );
+        test_prefix + "halo_general_create", num_fraction, policy );
     Cabana::Benchmark::Timer halo_aosoa_gather(
-        test_prefix + "halo_aosoa_gather", num_fraction );
+        test_prefix + "halo_aosoa_gather", num_fraction, policy );
     Cabana::Benchmark::Timer halo_slice_gather(
-        test_prefix + "halo_slice_gather", num_fraction );
+        test_prefix + "halo_slice_gather", num_fraction, policy );
     Cabana::Benchmark::Timer halo_slice_scatter(
-        test_prefix + "halo_slice_scatter", num_fraction );
+        test_prefix + "halo_slice_scatter", num_fraction, policy );
 
     // Loop over comm fractions.
     for ( int fraction = 0; fraction < num_fraction; ++fraction )
@@ -283,7 +338,7 @@ void performanceTest( std::ostream& stream, const std::size_t num_particle,
             data_memory_space(), export_ids_host );
 
         // Run tests and time the ensemble.
-        for ( int t = 0; t < num_run; ++t )
+        for ( int t = 0; t < policy.numTotal(); ++t )
         {
             // Create the particles.
             aosoa_type particles( "particles", num_particle );
@@ -366,12 +421,226 @@ void performanceTest( std::ostream& stream, const std::size_t num_particle,
     }
 
     // Output results.
-    outputResults( stream, "send_bytes", comm_bytes, halo_fast_create, comm );
-    outputResults( stream, "send_bytes", comm_bytes, halo_general_create,
-                   comm );
-    outputResults( stream, "send_bytes", comm_bytes, halo_aosoa_gather, comm );
-    outputResults( stream, "send_bytes", comm_bytes, halo_slice_gather, comm );
-    outputResults( stream, "send_bytes", comm_bytes, halo_slice_scatter, comm );
+    outputResults( stream, "send_bytes", comm_bytes, halo_fast_create, comm,
+                   format, test_prefix );
+    outputResults( stream, "send_bytes", comm_bytes, halo_general_create, comm,
+                   format, test_prefix );
+    outputResults( stream, "send_bytes", comm_bytes, halo_aosoa_gather, comm,
+                   format, test_prefix );
+    outputResults( stream, "send_bytes", comm_bytes, halo_slice_gather, comm,
+                   format, test_prefix );
+    outputResults( stream, "send_bytes", comm_bytes, halo_slice_scatter, comm,
+                   format, test_prefix );
+
+    // MESSAGE AGGREGATION
+    // -------------------
+
+    // Gather the same four members at different aggregation levels: one
+    // message round per slice (measured above as halo_slice_gather), two
+    // rounds of two fused slices, and a single round with all four slices
+    // fused into one buffer.
+    Cabana::Benchmark::Timer halo_fused_pair_gather(
+        test_prefix + "halo_fused_pair_gather", num_fraction, policy );
+    Cabana::Benchmark::Timer halo_fused_all_gather(
+        test_prefix + "halo_fused_all_gather", num_fraction, policy );
+
+    // Loop over comm fractions.
+    for ( int fraction = 0; fraction < num_fraction; ++fraction )
+    {
+        // Create the halo distribution as above.
+        int num_send = num_particle * comm_fraction[fraction];
+        int send_per_neighbor = num_send / 26;
+        num_send = send_per_neighbor * 26;
+        comm_bytes[fraction] = send_per_neighbor * bytes_per_particle;
+        Kokkos::View<int*, Kokkos::HostSpace> export_ranks_host( "export_ranks",
+                                                                 num_send );
+        Kokkos::View<int*, Kokkos::HostSpace> export_ids_host( "export_ids",
+                                                               num_send );
+        for ( int n = 0; n < 26; ++n )
+        {
+            for ( int p = 0; p < send_per_neighbor; ++p )
+            {
+                export_ids_host( n * send_per_neighbor + p ) =
+                    n * send_per_neighbor + p;
+                export_ranks_host( n * send_per_neighbor + p ) =
+                    neighbor_ranks[n + 1];
+            }
+        }
+        auto export_ranks = Kokkos::create_mirror_view_and_copy(
+            comm_memory_space(), export_ranks_host );
+        auto export_ids = Kokkos::create_mirror_view_and_copy(
+            comm_memory_space(), export_ids_host );
+        Cabana::Halo<comm_memory_space> halo( comm, num_particle, export_ids,
+                                              export_ranks,
+                                              unique_neighbors );
+
+        // Run tests and time the ensemble.
+        for ( int t = 0; t < policy.numTotal(); ++t )
+        {
+            // Create the particles.
+            aosoa_type particles( "particles",
+                                  halo.numLocal() + halo.numGhost() );
+
+            // Gather with two fused slices per message round.
+            halo_fused_pair_gather.start( fraction );
+            auto comm_particles = Cabana::create_mirror_view_and_copy(
+                comm_memory_space(), particles );
+            auto s0 = Cabana::slice<0>( comm_particles );
+            auto s1 = Cabana::slice<1>( comm_particles );
+            auto s2 = Cabana::slice<2>( comm_particles );
+            auto s3 = Cabana::slice<3>( comm_particles );
+            Cabana::gather( halo, s0, s1 );
+            Cabana::gather( halo, s2, s3 );
+            Cabana::deep_copy( particles, comm_particles );
+            halo_fused_pair_gather.stop( fraction );
+
+            // Gather with all four slices fused into one message round.
+            halo_fused_all_gather.start( fraction );
+            comm_particles = Cabana::create_mirror_view_and_copy(
+                comm_memory_space(), particles );
+            s0 = Cabana::slice<0>( comm_particles );
+            s1 = Cabana::slice<1>( comm_particles );
+            s2 = Cabana::slice<2>( comm_particles );
+            s3 = Cabana::slice<3>( comm_particles );
+            Cabana::gather( halo, s0, s1, s2, s3 );
+            Cabana::deep_copy( particles, comm_particles );
+            halo_fused_all_gather.stop( fraction );
+        }
+    }
+
+    // Output results.
+    outputResults( stream, "send_bytes", comm_bytes, halo_fused_pair_gather,
+                   comm, format, test_prefix );
+    outputResults( stream, "send_bytes", comm_bytes, halo_fused_all_gather,
+                   comm, format, test_prefix );
+
+    // COMPUTE OVERLAP
+    // ---------------
+
+    // Overlap an asynchronous gather with the synthetic force kernel while
+    // sweeping the number of neighbors the same export volume is split
+    // over. The compute-only and gather-only times bound the achievable
+    // overlap and the combined time measures what is realized.
+    std::vector<int> neighbor_counts = { 6, 18, 26 };
+    int num_neighbor_count = neighbor_counts.size();
+    double overlap_fraction = 0.10;
+    int synthetic_work = 64;
+
+    Cabana::Benchmark::Timer overlap_compute_only(
+        test_prefix + "overlap_compute_only", num_neighbor_count, policy );
+    Cabana::Benchmark::Timer overlap_gather_only(
+        test_prefix + "overlap_gather_only", num_neighbor_count, policy );
+    Cabana::Benchmark::Timer overlap_combined(
+        test_prefix + "overlap_combined", num_neighbor_count, policy );
+    std::vector<std::size_t> overlap_bytes( num_neighbor_count );
+
+    for ( int nc = 0; nc < num_neighbor_count; ++nc )
+    {
+        // Split the same export volume over the first nn neighbors.
+        int nn = neighbor_counts[nc];
+        int num_send = num_particle * overlap_fraction;
+        int send_per_neighbor = num_send / nn;
+        num_send = send_per_neighbor * nn;
+        overlap_bytes[nc] = num_send * bytes_per_particle;
+        Kokkos::View<int*, Kokkos::HostSpace> export_ranks_host( "export_ranks",
+                                                                 num_send );
+        Kokkos::View<int*, Kokkos::HostSpace> export_ids_host( "export_ids",
+                                                               num_send );
+        for ( int n = 0; n < nn; ++n )
+        {
+            for ( int p = 0; p < send_per_neighbor; ++p )
+            {
+                export_ids_host( n * send_per_neighbor + p ) =
+                    n * send_per_neighbor + p;
+                export_ranks_host( n * send_per_neighbor + p ) =
+                    neighbor_ranks[n + 1];
+            }
+        }
+        auto export_ranks = Kokkos::create_mirror_view_and_copy(
+            comm_memory_space(), export_ranks_host );
+        auto export_ids = Kokkos::create_mirror_view_and_copy(
+            comm_memory_space(), export_ids_host );
+        Cabana::Halo<comm_memory_space> halo( comm, num_particle, export_ids,
+                                              export_ranks,
+                                              unique_neighbors );
+
+        // The force kernel runs on the data device while the gather runs on
+        // the communication device, as it would in a production time step.
+        aosoa_type compute_particles( "compute_particles", num_particle );
+
+        for ( int t = 0; t < policy.numTotal(); ++t )
+        {
+            aosoa_type particles( "particles",
+                                  halo.numLocal() + halo.numGhost() );
+            auto comm_particles = Cabana::create_mirror_view_and_copy(
+                comm_memory_space(), particles );
+
+            // Compute only.
+            overlap_compute_only.start( nc );
+            syntheticForceKernel( compute_particles, num_particle,
+                                  synthetic_work );
+            overlap_compute_only.stop( nc );
+
+            // Gather only.
+            overlap_gather_only.start( nc );
+            auto gather_request = Cabana::gather_async( halo, comm_particles );
+            gather_request.wait();
+            overlap_gather_only.stop( nc );
+
+            // Gather overlapped with the force kernel.
+            overlap_combined.start( nc );
+            auto overlap_request = Cabana::gather_async( halo, comm_particles );
+            syntheticForceKernel( compute_particles, num_particle,
+                                  synthetic_work );
+            overlap_request.wait();
+            overlap_combined.stop( nc );
+        }
+    }
+
+    // Output results.
+    outputResults( stream, "num_neighbor", neighbor_counts,
+                   overlap_compute_only, comm, format, test_prefix );
+    outputResults( stream, "num_neighbor", neighbor_counts,
+                   overlap_gather_only, comm, format, test_prefix );
+    outputResults( stream, "num_neighbor", neighbor_counts, overlap_combined,
+                   comm, format, test_prefix );
+
+    // Report the derived metrics: effective gather bandwidth and the
+    // fraction of the shorter phase hidden behind the longer one. An
+    // efficiency of one means the gather (or the kernel, whichever is
+    // shorter) was completely hidden; zero means the phases serialized.
+    int comm_rank;
+    MPI_Comm_rank( comm, &comm_rank );
+    std::vector<double> efficiency( num_neighbor_count );
+    std::vector<double> bandwidth( num_neighbor_count );
+    for ( int nc = 0; nc < num_neighbor_count; ++nc )
+    {
+        double t_compute = globalAverage( overlap_compute_only, nc, comm );
+        double t_gather = globalAverage( overlap_gather_only, nc, comm );
+        double t_combined = globalAverage( overlap_combined, nc, comm );
+        double hideable = ( t_compute < t_gather ) ? t_compute : t_gather;
+        efficiency[nc] =
+            ( hideable > 0.0 )
+                ? ( t_compute + t_gather - t_combined ) / hideable
+                : 0.0;
+        bandwidth[nc] = ( t_gather > 0.0 )
+                            ? overlap_bytes[nc] / t_gather
+                            : 0.0;
+    }
+    // The derived summary is only part of the human-readable table output -
+    // the structured formats stay machine-parseable and the metrics can be
+    // recomputed from the emitted records.
+    if ( 0 == comm_rank && Cabana::Benchmark::OutputFormat::table == format )
+    {
+        stream << "\n";
+        stream << test_prefix << "overlap_summary"
+               << "\n";
+        stream << "num_neighbor send_bytes bandwidth_MB_s overlap_efficiency"
+               << "\n";
+        for ( int nc = 0; nc < num_neighbor_count; ++nc )
+            stream << neighbor_counts[nc] << " " << overlap_bytes[nc] << " "
+                   << bandwidth[nc] << " " << efficiency[nc] << "\n";
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -387,6 +656,7 @@ int main( int argc, char* argv[] )
         throw std::runtime_error( "Incorrect number of arguments. \n \
              First argument - integer number of particles per MPI rank \n \
              Second argument - file name for output \n \
+             Third argument (optional) - output format (table, csv, json) \n \
              \n \
              Example: \n \
              $/: ./CommPerformance 100000 test_results.txt\n" );
@@ -397,6 +667,11 @@ int main( int argc, char* argv[] )
     // Get the name of the output file.
     std::string filename = argv[2];
 
+    // Get the output format.
+    auto format = ( argc > 3 )
+                      ? Cabana::Benchmark::parseOutputFormat( argv[3] )
+                      : Cabana::Benchmark::OutputFormat::table;
+
     // Barier before continuing.
     MPI_Barrier( MPI_COMM_WORLD );
 
@@ -413,8 +688,9 @@ int main( int argc, char* argv[] )
     if ( 0 == comm_rank )
         file.open( filename, std::fstream::out );
 
-    // Output problem details.
-    if ( 0 == comm_rank )
+    // Output problem details. The banner is only part of the table format -
+    // the structured formats must stay machine-parseable.
+    if ( 0 == comm_rank && Cabana::Benchmark::OutputFormat::table == format )
     {
         std::size_t total_num_p = num_particle * comm_size;
         file << "\n";
@@ -434,12 +710,12 @@ int main( int argc, char* argv[] )
 #ifdef KOKKOS_ENABLE_SERIAL
     using SerialDevice = Kokkos::Device<Kokkos::Serial, Kokkos::HostSpace>;
     performanceTest<SerialDevice, SerialDevice>( file, num_particle,
-                                                 "host_host_" );
+                                                 "host_host_", format );
 #endif
 #ifdef KOKKOS_ENABLE_OPENMP
     using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
     performanceTest<OpenMPDevice, OpenMPDevice>( file, num_particle,
-                                                 "host_host_" );
+                                                 "host_host_", format );
 #endif
 
 #ifdef KOKKOS_ENABLE_CUDA
@@ -451,15 +727,17 @@ int main( int argc, char* argv[] )
 #ifdef KOKKOS_ENABLE_OPENMP
     using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
     performanceTest<CudaDevice, OpenMPDevice>( file, num_particle,
-                                               "cuda_host_" );
+                                               "cuda_host_", format );
 #endif
 
     // Do everything on the GPU with regular GPU memory.
-    performanceTest<CudaDevice, CudaDevice>( file, num_particle, "cuda_cuda_" );
+    performanceTest<CudaDevice, CudaDevice>( file, num_particle, "cuda_cuda_",
+                                             format );
 
     // Do everything on the GPU with UVM GPU memory.
     performanceTest<CudaUVMDevice, CudaUVMDevice>( file, num_particle,
-                                                   "cudauvm_cudauvm_" );
+                                                   "cudauvm_cudauvm_",
+                                                   format );
 #endif
 
     // Close the output file on rank 0.
@@ -0,0 +1,221 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "Cabana_BenchmarkUtils.hpp"
+
+#include <Cabana_Core.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// Benchmark the fundamental AoSoA access patterns for one member layout and
+// vector length: contiguous slice streaming, strided multidimensional
+// member access, AoSoA-to-AoSoA deep copy, and whole-tuple assignment.
+// Layout-affecting changes (e.g. SoA padding) move these numbers directly.
+template <class Device, int VectorLength, class MemberTypes>
+void layoutSweep( std::ostream& stream, const std::string& test_prefix,
+                  const Cabana::Benchmark::OutputFormat format )
+{
+    using exec_space = typename Device::execution_space;
+    using aosoa_type = Cabana::AoSoA<MemberTypes, Device, VectorLength>;
+
+    // Declare problem sizes.
+    std::vector<int> problem_sizes = { 1000, 10000, 100000, 1000000 };
+    int num_problem_size = problem_sizes.size();
+
+    // Warmup and repetition policy for the test loops.
+    Cabana::Benchmark::RunPolicy policy( 2, 10 );
+
+    // Create the timers.
+    Cabana::Benchmark::Timer stream_timer( test_prefix + "slice_stream",
+                                           num_problem_size, policy );
+    Cabana::Benchmark::Timer strided_timer( test_prefix + "strided_access",
+                                            num_problem_size, policy );
+    Cabana::Benchmark::Timer deep_copy_timer( test_prefix + "deep_copy",
+                                              num_problem_size, policy );
+    Cabana::Benchmark::Timer tuple_timer( test_prefix + "tuple_assign",
+                                          num_problem_size, policy );
+
+    // Loop over the problem sizes.
+    for ( int p = 0; p < num_problem_size; ++p )
+    {
+        int num_p = problem_sizes[p];
+        aosoa_type src( "src", num_p );
+        aosoa_type dst( "dst", num_p );
+
+        // Initialize the source.
+        auto src_scalar = Cabana::slice<0>( src );
+        auto src_vector = Cabana::slice<1>( src );
+        Kokkos::parallel_for(
+            "initialize", Kokkos::RangePolicy<exec_space>( 0, num_p ),
+            KOKKOS_LAMBDA( const int i ) {
+                src_scalar( i ) = i;
+                for ( int d = 0; d < 3; ++d )
+                    src_vector( i, d ) = i + d;
+            } );
+        Kokkos::fence();
+
+        // Run tests and time the ensemble.
+        for ( int t = 0; t < policy.numTotal(); ++t )
+        {
+            // Stream the contiguous scalar member.
+            auto dst_scalar = Cabana::slice<0>( dst );
+            stream_timer.start( p );
+            Kokkos::parallel_for(
+                "slice_stream", Kokkos::RangePolicy<exec_space>( 0, num_p ),
+                KOKKOS_LAMBDA( const int i ) {
+                    dst_scalar( i ) = 2.0 * src_scalar( i );
+                } );
+            Kokkos::fence();
+            stream_timer.stop( p );
+
+            // Access the multidimensional member component-wise. The
+            // components of one particle are strided by the vector length.
+            auto dst_vector = Cabana::slice<1>( dst );
+            strided_timer.start( p );
+            Kokkos::parallel_for(
+                "strided_access", Kokkos::RangePolicy<exec_space>( 0, num_p ),
+                KOKKOS_LAMBDA( const int i ) {
+                    double sum = 0.0;
+                    for ( int d = 0; d < 3; ++d )
+                        sum += src_vector( i, d );
+                    for ( int d = 0; d < 3; ++d )
+                        dst_vector( i, d ) = sum + src_vector( i, d );
+                } );
+            Kokkos::fence();
+            strided_timer.stop( p );
+
+            // Deep copy the whole AoSoA.
+            deep_copy_timer.start( p );
+            Cabana::deep_copy( dst, src );
+            deep_copy_timer.stop( p );
+
+            // Assign whole tuples.
+            auto src_aosoa = src;
+            auto dst_aosoa = dst;
+            tuple_timer.start( p );
+            Kokkos::parallel_for(
+                "tuple_assign", Kokkos::RangePolicy<exec_space>( 0, num_p ),
+                KOKKOS_LAMBDA( const int i ) {
+                    dst_aosoa.setTuple( i, src_aosoa.getTuple( i ) );
+                } );
+            Kokkos::fence();
+            tuple_timer.stop( p );
+        }
+    }
+
+    // Output results.
+    outputResults( stream, "problem_size", problem_sizes, stream_timer, format,
+                   test_prefix );
+    outputResults( stream, "problem_size", problem_sizes, strided_timer,
+                   format, test_prefix );
+    outputResults( stream, "problem_size", problem_sizes, deep_copy_timer,
+                   format, test_prefix );
+    outputResults( stream, "problem_size", problem_sizes, tuple_timer, format,
+                   test_prefix );
+}
+
+//---------------------------------------------------------------------------//
+// Sweep the member layouts for one vector length: a thin layout with few
+// narrow members, a vector-heavy layout, and a wide layout with many
+// members.
+template <class Device, int VectorLength>
+void memberSweep( std::ostream& stream, const std::string& test_prefix,
+                  const Cabana::Benchmark::OutputFormat format )
+{
+    std::stringstream prefix;
+    prefix << test_prefix << "vl_" << VectorLength << "_";
+
+    using thin_types = Cabana::MemberTypes<double, double[3]>;
+    layoutSweep<Device, VectorLength, thin_types>(
+        stream, prefix.str() + "thin_", format );
+
+    using vector_types = Cabana::MemberTypes<double, double[3], double[3][3]>;
+    layoutSweep<Device, VectorLength, vector_types>(
+        stream, prefix.str() + "tensor_", format );
+
+    using wide_types = Cabana::MemberTypes<double, double[3], double[3],
+                                           double, float, int, int>;
+    layoutSweep<Device, VectorLength, wide_types>(
+        stream, prefix.str() + "wide_", format );
+}
+
+//---------------------------------------------------------------------------//
+// Performance test.
+template <class Device>
+void performanceTest( std::ostream& stream, const std::string& test_prefix,
+                      const Cabana::Benchmark::OutputFormat format )
+{
+    memberSweep<Device, 8>( stream, test_prefix, format );
+    memberSweep<Device, 16>( stream, test_prefix, format );
+    memberSweep<Device, 32>( stream, test_prefix, format );
+    memberSweep<Device, 64>( stream, test_prefix, format );
+}
+
+//---------------------------------------------------------------------------//
+// main
+int main( int argc, char* argv[] )
+{
+    // Initialize environment
+    Kokkos::initialize( argc, argv );
+
+    // Check arguments.
+    if ( argc < 2 )
+        throw std::runtime_error( "Incorrect number of arguments. \n \
+             First argument -  file name for output \n \
+             Second argument (optional) - output format (table, csv, json) \n \
+             \n \
+             Example: \n \
+             $/: ./CoreKernelsPerformance test_results.txt\n" );
+
+    // Get the name of the output file.
+    std::string filename = argv[1];
+
+    // Get the output format.
+    auto format = ( argc > 2 )
+                      ? Cabana::Benchmark::parseOutputFormat( argv[2] )
+                      : Cabana::Benchmark::OutputFormat::table;
+
+    // Open the output file on rank 0.
+    std::fstream file;
+    file.open( filename, std::fstream::out );
+
+    // Run the tests.
+#ifdef KOKKOS_ENABLE_SERIAL
+    using SerialDevice = Kokkos::Device<Kokkos::Serial, Kokkos::HostSpace>;
+    performanceTest<SerialDevice>( file, "serial_", format );
+#endif
+
+#ifdef KOKKOS_ENABLE_OPENMP
+    using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
+    performanceTest<OpenMPDevice>( file, "openmp_", format );
+#endif
+
+#ifdef KOKKOS_ENABLE_CUDA
+    using CudaDevice = Kokkos::Device<Kokkos::Cuda, Kokkos::CudaSpace>;
+    performanceTest<CudaDevice>( file, "cuda_", format );
+#endif
+
+    // Close the output file on rank 0.
+    file.close();
+
+    // Finalize
+    Kokkos::finalize();
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
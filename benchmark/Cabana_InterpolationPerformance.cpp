@@ -0,0 +1,329 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "Cabana_BenchmarkUtils.hpp"
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_LinkedCellList.hpp>
+
+#include <Cajita_Array.hpp>
+#include <Cajita_GlobalGrid.hpp>
+#include <Cajita_GlobalMesh.hpp>
+#include <Cajita_Interpolation.hpp>
+#include <Cajita_LocalGrid.hpp>
+#include <Cajita_LocalMesh.hpp>
+#include <Cajita_Partitioner.hpp>
+#include <Cajita_Splines.hpp>
+#include <Cajita_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+using namespace Cajita;
+
+//---------------------------------------------------------------------------//
+// Performance test for one spline order.
+// Sweeps particles-per-cell and times p2g with the atomic and the colored
+// (linked-cell binned) scatter strategies along with g2p.
+template <class Device, int SplineOrder>
+void performanceTest( std::ostream& stream, const int cells_per_dim,
+                      const std::string& test_prefix,
+                      const Cabana::Benchmark::OutputFormat format )
+{
+    using exec_space = typename Device::execution_space;
+
+    // Create the global mesh.
+    double cell_size = 1.0 / cells_per_dim;
+    std::array<double, 3> low_corner = { 0.0, 0.0, 0.0 };
+    std::array<double, 3> high_corner = { 1.0, 1.0, 1.0 };
+    auto global_mesh =
+        createUniformGlobalMesh( low_corner, high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a local grid. A halo of two cells covers the stencil of every
+    // swept spline order.
+    int halo_width = 2;
+    auto local_grid = createLocalGrid( global_grid, halo_width );
+    auto local_mesh = createLocalMesh<Device>( *local_grid );
+
+    // Grid fields and halos are shared by the whole sweep.
+    auto scalar_layout = createArrayLayout( local_grid, 1, Node() );
+    auto scalar_grid_field =
+        createArray<double, Device>( "scalar_grid_field", scalar_layout );
+    auto scalar_halo = createHalo( *scalar_grid_field, FullHaloPattern() );
+    auto vector_layout = createArrayLayout( local_grid, 3, Node() );
+    auto vector_grid_field =
+        createArray<double, Device>( "vector_grid_field", vector_layout );
+    auto vector_halo = createHalo( *vector_grid_field, FullHaloPattern() );
+
+    // Get the owned cell geometry for binning the points.
+    auto host_mesh = createLocalMesh<Kokkos::HostSpace>( *local_grid );
+    double grid_delta[3] = { cell_size, cell_size, cell_size };
+    double grid_min[3];
+    double grid_max[3];
+    for ( int d = 0; d < 3; ++d )
+    {
+        grid_min[d] = host_mesh.lowCorner( Own(), d );
+        grid_max[d] = host_mesh.highCorner( Own(), d );
+    }
+
+    // Warmup and repetition policy for the test loops.
+    Cabana::Benchmark::RunPolicy policy( 2, 10 );
+
+    // Particles-per-cell sweep.
+    std::vector<int> particles_per_cell = { 1, 2, 4, 8, 16 };
+    int num_ppc = particles_per_cell.size();
+
+    // Create the timers.
+    Cabana::Benchmark::Timer p2g_scalar_atomic(
+        test_prefix + "p2g_scalar_atomic", num_ppc, policy );
+    Cabana::Benchmark::Timer p2g_vector_atomic(
+        test_prefix + "p2g_vector_atomic", num_ppc, policy );
+    Cabana::Benchmark::Timer p2g_cell_list_build(
+        test_prefix + "p2g_cell_list_build", num_ppc, policy );
+    Cabana::Benchmark::Timer p2g_scalar_colored(
+        test_prefix + "p2g_scalar_colored", num_ppc, policy );
+    Cabana::Benchmark::Timer g2p_scalar( test_prefix + "g2p_scalar", num_ppc,
+                                         policy );
+    Cabana::Benchmark::Timer g2p_vector( test_prefix + "g2p_vector", num_ppc,
+                                         policy );
+
+    // Sweep the particle density.
+    for ( int ppc = 0; ppc < num_ppc; ++ppc )
+    {
+        int points_per_cell = particles_per_cell[ppc];
+
+        // Create points spread through each owned cell.
+        auto cell_space = local_grid->indexSpace( Own(), Cell(), Local() );
+        int num_point = cell_space.size() * points_per_cell;
+        Kokkos::View<double* [3], Device> points(
+            Kokkos::ViewAllocateWithoutInitializing( "points" ), num_point );
+        Kokkos::parallel_for(
+            "fill_points",
+            createExecutionPolicy( cell_space, exec_space() ),
+            KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                int pi = i - halo_width;
+                int pj = j - halo_width;
+                int pk = k - halo_width;
+                int cid = pi + cell_space.extent( Dim::I ) *
+                                   ( pj + cell_space.extent( Dim::J ) * pk );
+                int idx[3] = { i, j, k };
+                double x[3];
+                local_mesh.coordinates( Cell(), idx, x );
+                for ( int p = 0; p < points_per_cell; ++p )
+                {
+                    double frac =
+                        0.8 * ( ( p + 0.5 ) / points_per_cell - 0.5 );
+                    int pid = cid * points_per_cell + p;
+                    points( pid, Dim::I ) = x[Dim::I] + frac * cell_size;
+                    points( pid, Dim::J ) = x[Dim::J] - frac * cell_size;
+                    points( pid, Dim::K ) =
+                        x[Dim::K] + 0.5 * frac * cell_size;
+                }
+            } );
+
+        // Create the point fields.
+        Kokkos::View<double*, Device> scalar_point_field(
+            Kokkos::ViewAllocateWithoutInitializing( "scalar_point_field" ),
+            num_point );
+        Kokkos::View<double* [3], Device> vector_point_field(
+            Kokkos::ViewAllocateWithoutInitializing( "vector_point_field" ),
+            num_point );
+        Kokkos::deep_copy( scalar_point_field, 3.5 );
+        Kokkos::deep_copy( vector_point_field, 3.5 );
+
+        // Positions in an AoSoA for the linked cell binning.
+        Cabana::AoSoA<Cabana::MemberTypes<double[3]>, Device> point_aosoa(
+            "point_aosoa", num_point );
+        auto position = Cabana::slice<0>( point_aosoa );
+        Kokkos::parallel_for(
+            "fill_positions", Kokkos::RangePolicy<exec_space>( 0, num_point ),
+            KOKKOS_LAMBDA( const int p ) {
+                for ( int d = 0; d < 3; ++d )
+                    position( p, d ) = points( p, d );
+            } );
+        Kokkos::fence();
+
+        // Run tests and time the ensemble.
+        for ( int t = 0; t < policy.numTotal(); ++t )
+        {
+            // Scalar p2g with the atomic scatter.
+            ArrayOp::assign( *scalar_grid_field, 0.0, Ghost() );
+            auto scalar_p2g = createScalarValueP2G( scalar_point_field, 0.5 );
+            p2g_scalar_atomic.start( ppc );
+            p2g( scalar_p2g, points, num_point, Spline<SplineOrder>(),
+                 *scalar_halo, *scalar_grid_field );
+            p2g_scalar_atomic.stop( ppc );
+
+            // Vector p2g with the atomic scatter.
+            ArrayOp::assign( *vector_grid_field, 0.0, Ghost() );
+            auto vector_p2g = createVectorValueP2G( vector_point_field, 0.5 );
+            p2g_vector_atomic.start( ppc );
+            p2g( vector_p2g, points, num_point, Spline<SplineOrder>(),
+                 *vector_halo, *vector_grid_field );
+            p2g_vector_atomic.stop( ppc );
+
+            // Bin the points over the owned cells for the colored scatter.
+            p2g_cell_list_build.start( ppc );
+            Cabana::LinkedCellList<Device> cell_list( position, grid_delta,
+                                                      grid_min, grid_max );
+            p2g_cell_list_build.stop( ppc );
+
+            // Scalar p2g with the colored scatter.
+            ArrayOp::assign( *scalar_grid_field, 0.0, Ghost() );
+            p2g_scalar_colored.start( ppc );
+            p2g( scalar_p2g, points, cell_list, Spline<SplineOrder>(),
+                 *scalar_halo, *scalar_grid_field );
+            p2g_scalar_colored.stop( ppc );
+
+            // Scalar g2p.
+            auto scalar_g2p = createScalarValueG2P( scalar_point_field, 0.5 );
+            g2p_scalar.start( ppc );
+            g2p( *scalar_grid_field, *scalar_halo, points, num_point,
+                 Spline<SplineOrder>(), scalar_g2p );
+            g2p_scalar.stop( ppc );
+
+            // Vector g2p.
+            auto vector_g2p = createVectorValueG2P( vector_point_field, 0.5 );
+            g2p_vector.start( ppc );
+            g2p( *vector_grid_field, *vector_halo, points, num_point,
+                 Spline<SplineOrder>(), vector_g2p );
+            g2p_vector.stop( ppc );
+        }
+    }
+
+    // Output results.
+    outputResults( stream, "particles_per_cell", particles_per_cell,
+                   p2g_scalar_atomic, MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "particles_per_cell", particles_per_cell,
+                   p2g_vector_atomic, MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "particles_per_cell", particles_per_cell,
+                   p2g_cell_list_build, MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "particles_per_cell", particles_per_cell,
+                   p2g_scalar_colored, MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "particles_per_cell", particles_per_cell,
+                   g2p_scalar, MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "particles_per_cell", particles_per_cell,
+                   g2p_vector, MPI_COMM_WORLD, format, test_prefix );
+}
+
+//---------------------------------------------------------------------------//
+// Run the spline order sweep on a device.
+template <class Device>
+void splineOrderSweep( std::ostream& stream, const int cells_per_dim,
+                       const std::string& device_prefix,
+                       const Cabana::Benchmark::OutputFormat format )
+{
+    performanceTest<Device, 1>( stream, cells_per_dim,
+                                device_prefix + "spline_1_", format );
+    performanceTest<Device, 2>( stream, cells_per_dim,
+                                device_prefix + "spline_2_", format );
+    performanceTest<Device, 3>( stream, cells_per_dim,
+                                device_prefix + "spline_3_", format );
+}
+
+//---------------------------------------------------------------------------//
+// main
+int main( int argc, char* argv[] )
+{
+    // Initialize environment
+    MPI_Init( &argc, &argv );
+    Kokkos::initialize( argc, argv );
+
+    // Check arguments.
+    if ( argc < 3 )
+        throw std::runtime_error( "Incorrect number of arguments. \n \
+             First argument - integer number of cells per dimension \n \
+             Second argument - file name for output \n \
+             Third argument (optional) - output format (table, csv, json) \n \
+             \n \
+             Example: \n \
+             $/: ./InterpolationPerformance 64 test_results.txt\n" );
+
+    // Number of cells per dimension across all ranks.
+    int cells_per_dim = std::atoi( argv[1] );
+
+    // Get the name of the output file.
+    std::string filename = argv[2];
+
+    // Get the output format.
+    auto format = ( argc > 3 )
+                      ? Cabana::Benchmark::parseOutputFormat( argv[3] )
+                      : Cabana::Benchmark::OutputFormat::table;
+
+    // Barier before continuing.
+    MPI_Barrier( MPI_COMM_WORLD );
+
+    // Get comm rank;
+    int comm_rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &comm_rank );
+
+    // Get comm size;
+    int comm_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+
+    // Open the output file on rank 0.
+    std::fstream file;
+    if ( 0 == comm_rank )
+        file.open( filename, std::fstream::out );
+
+    // Output problem details. The banner is only part of the table format -
+    // the structured formats must stay machine-parseable.
+    if ( 0 == comm_rank && Cabana::Benchmark::OutputFormat::table == format )
+    {
+        file << "\n";
+        file << "Cajita Interpolation Performance Benchmark"
+             << "\n";
+        file << "----------------------------------------------"
+             << "\n";
+        file << "MPI Ranks: " << comm_size << "\n";
+        file << "Cells per dimension: " << cells_per_dim << "\n";
+        file << "----------------------------------------------"
+             << "\n";
+        file << "\n";
+    }
+
+    // Run the benchmark on the available backends.
+#ifdef KOKKOS_ENABLE_SERIAL
+    using SerialDevice = Kokkos::Device<Kokkos::Serial, Kokkos::HostSpace>;
+    splineOrderSweep<SerialDevice>( file, cells_per_dim, "serial_", format );
+#endif
+#ifdef KOKKOS_ENABLE_OPENMP
+    using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
+    splineOrderSweep<OpenMPDevice>( file, cells_per_dim, "openmp_", format );
+#endif
+#ifdef KOKKOS_ENABLE_CUDA
+    using CudaDevice = Kokkos::Device<Kokkos::Cuda, Kokkos::CudaSpace>;
+    splineOrderSweep<CudaDevice>( file, cells_per_dim, "cuda_", format );
+#endif
+
+    // Close the output file on rank 0.
+    if ( 0 == comm_rank )
+        file.close();
+
+    // Finalize
+    Kokkos::finalize();
+    MPI_Finalize();
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
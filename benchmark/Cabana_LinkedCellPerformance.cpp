@@ -26,7 +26,8 @@
 //---------------------------------------------------------------------------//
 // Performance test.
 template <class Device>
-void performanceTest( std::ostream& stream, const std::string& test_prefix )
+void performanceTest( std::ostream& stream, const std::string& test_prefix,
+                      const Cabana::Benchmark::OutputFormat format )
 {
     // Declare problem sizes.
     double min_dist = 1.0;
@@ -40,8 +41,8 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
     std::vector<double> cutoff_ratios = { 3.0, 4.0 };
     int cutoff_ratios_size = cutoff_ratios.size();
 
-    // Number of runs in the test loops.
-    int num_run = 10;
+    // Warmup and repetition policy for the test loops.
+    Cabana::Benchmark::RunPolicy policy( 2, 10 );
 
     // Define the aosoa.
     using member_types = Cabana::MemberTypes<double[3]>;
@@ -74,11 +75,11 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
         create_time_name << test_prefix << "linkedcell_create_"
                          << cutoff_ratios[c];
         Cabana::Benchmark::Timer create_timer( create_time_name.str(),
-                                               num_problem_size );
+                                               num_problem_size, policy );
         std::stringstream sort_time_name;
         sort_time_name << test_prefix << "linkedcell_sort_" << cutoff_ratios[c];
         Cabana::Benchmark::Timer sort_timer( sort_time_name.str(),
-                                             num_problem_size );
+                                             num_problem_size, policy );
 
         // Loop over the problem sizes.
         std::vector<int> psizes;
@@ -101,7 +102,7 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
                 x, sort_delta, grid_min, grid_max );
 
             // Run tests and time the ensemble
-            for ( int t = 0; t < num_run; ++t )
+            for ( int t = 0; t < policy.numTotal(); ++t )
             {
                 // Build the linked cell list.
                 create_timer.start( p );
@@ -116,8 +117,10 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix )
         }
 
         // Output results.
-        outputResults( stream, "problem_size", psizes, create_timer );
-        outputResults( stream, "problem_size", psizes, sort_timer );
+        outputResults( stream, "problem_size", psizes, create_timer, format,
+                       test_prefix );
+        outputResults( stream, "problem_size", psizes, sort_timer, format,
+                       test_prefix );
     }
 }
 
@@ -132,6 +135,7 @@ int main( int argc, char* argv[] )
     if ( argc < 2 )
         throw std::runtime_error( "Incorrect number of arguments. \n \
              First argument -  file name for output \n \
+             Second argument (optional) - output format (table, csv, json) \n \
              \n \
              Example: \n \
              $/: ./LinkedCellPerformance test_results.txt\n" );
@@ -139,6 +143,11 @@ int main( int argc, char* argv[] )
     // Get the name of the output file.
     std::string filename = argv[1];
 
+    // Get the output format.
+    auto format = ( argc > 2 )
+                      ? Cabana::Benchmark::parseOutputFormat( argv[2] )
+                      : Cabana::Benchmark::OutputFormat::table;
+
     // Open the output file on rank 0.
     std::fstream file;
     file.open( filename, std::fstream::out );
@@ -146,17 +155,17 @@ int main( int argc, char* argv[] )
     // Run the tests.
 #ifdef KOKKOS_ENABLE_SERIAL
     using SerialDevice = Kokkos::Device<Kokkos::Serial, Kokkos::HostSpace>;
-    performanceTest<SerialDevice>( file, "serial_" );
+    performanceTest<SerialDevice>( file, "serial_", format );
 #endif
 
 #ifdef KOKKOS_ENABLE_OPENMP
     using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
-    performanceTest<OpenMPDevice>( file, "openmp_" );
+    performanceTest<OpenMPDevice>( file, "openmp_", format );
 #endif
 
 #ifdef KOKKOS_ENABLE_CUDA
     using CudaDevice = Kokkos::Device<Kokkos::Cuda, Kokkos::CudaSpace>;
-    performanceTest<CudaDevice>( file, "cuda_" );
+    performanceTest<CudaDevice>( file, "cuda_", format );
 #endif
 
     // Close the output file on rank 0.
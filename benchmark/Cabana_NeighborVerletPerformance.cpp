@@ -27,7 +27,7 @@
 // Performance test.
 template <class Device>
 void performanceTest( std::ostream& stream, const std::string& test_prefix,
-                      bool sort )
+                      bool sort, const Cabana::Benchmark::OutputFormat format )
 {
     using exec_space = typename Device::execution_space;
     using memory_space = typename Device::memory_space;
@@ -54,8 +54,8 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix,
     std::vector<double> cell_ratios = { 1.0, 1.5 };
     int cell_ratios_size = cell_ratios.size();
 
-    // Number of runs in the test loops.
-    int num_run = 10;
+    // Warmup and repetition policy for the test loops.
+    Cabana::Benchmark::RunPolicy policy( 2, 10 );
 
     // Define the aosoa.
     using member_types = Cabana::MemberTypes<double[3]>;
@@ -107,12 +107,12 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix,
             create_time_name << test_prefix << "neigh_create_"
                              << cutoff_ratios[c0] << "_" << cell_ratios[c1];
             Cabana::Benchmark::Timer create_timer( create_time_name.str(),
-                                                   num_problem_size );
+                                                   num_problem_size, policy );
             std::stringstream iteration_time_name;
             iteration_time_name << test_prefix << "neigh_iteration_"
                                 << cutoff_ratios[c0] << "_" << cell_ratios[c1];
-            Cabana::Benchmark::Timer iteration_timer( iteration_time_name.str(),
-                                                      num_problem_size );
+            Cabana::Benchmark::Timer iteration_timer(
+                iteration_time_name.str(), num_problem_size, policy );
 
             // Loop over the problem sizes.
             int pid = 0;
@@ -141,7 +141,7 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix,
                 Kokkos::RangePolicy<exec_space> policy( 0, num_p );
 
                 // Run tests and time the ensemble
-                for ( int t = 0; t < num_run; ++t )
+                for ( int t = 0; t < policy.numTotal(); ++t )
                 {
                     // Create the neighbor list.
                     double cutoff = cutoff_ratios[c0] * min_dist;
@@ -197,8 +197,10 @@ void performanceTest( std::ostream& stream, const std::string& test_prefix,
             }
 
             // Output results.
-            outputResults( stream, "problem_size", psizes, create_timer );
-            outputResults( stream, "problem_size", psizes, iteration_timer );
+            outputResults( stream, "problem_size", psizes, create_timer,
+                           format, test_prefix );
+            outputResults( stream, "problem_size", psizes, iteration_timer,
+                           format, test_prefix );
         }
     }
 }
@@ -214,6 +216,7 @@ int main( int argc, char* argv[] )
     if ( argc < 2 )
         throw std::runtime_error( "Incorrect number of arguments. \n \
              First argument -  file name for output \n \
+             Second argument (optional) - output format (table, csv, json) \n \
              \n \
              Example: \n \
              $/: ./NeighborVerletPerformance test_results.txt\n" );
@@ -221,6 +224,11 @@ int main( int argc, char* argv[] )
     // Get the name of the output file.
     std::string filename = argv[1];
 
+    // Get the output format.
+    auto format = ( argc > 2 )
+                      ? Cabana::Benchmark::parseOutputFormat( argv[2] )
+                      : Cabana::Benchmark::OutputFormat::table;
+
     // Open the output file on rank 0.
     std::fstream file;
     file.open( filename, std::fstream::out );
@@ -228,17 +236,17 @@ int main( int argc, char* argv[] )
     // Run the tests.
 #ifdef KOKKOS_ENABLE_SERIAL
     using SerialDevice = Kokkos::Device<Kokkos::Serial, Kokkos::HostSpace>;
-    performanceTest<SerialDevice>( file, "serial_", true );
+    performanceTest<SerialDevice>( file, "serial_", true, format );
 #endif
 
 #ifdef KOKKOS_ENABLE_OPENMP
     using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
-    performanceTest<OpenMPDevice>( file, "openmp_", true );
+    performanceTest<OpenMPDevice>( file, "openmp_", true, format );
 #endif
 
 #ifdef KOKKOS_ENABLE_CUDA
     using CudaDevice = Kokkos::Device<Kokkos::Cuda, Kokkos::CudaSpace>;
-    performanceTest<CudaDevice>( file, "cuda_", true );
+    performanceTest<CudaDevice>( file, "cuda_", true, format );
 #endif
 
     // Close the output file on rank 0.
@@ -0,0 +1,458 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "Cabana_BenchmarkUtils.hpp"
+
+#include <Cajita_Array.hpp>
+#include <Cajita_GlobalGrid.hpp>
+#include <Cajita_GlobalMesh.hpp>
+#include <Cajita_Halo.hpp>
+#include <Cajita_LocalGrid.hpp>
+#include <Cajita_Partitioner.hpp>
+#include <Cajita_ReferenceStructuredSolver.hpp>
+#include <Cajita_Types.hpp>
+
+#ifdef Cabana_ENABLE_HYPRE
+#include <Cajita_HypreStructuredSolver.hpp>
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+using namespace Cajita;
+
+//---------------------------------------------------------------------------//
+// Create the local grid for one benchmark grid size. The grid is periodic so
+// the matrix-free constant-coefficient operator is exact everywhere.
+auto createBenchmarkGrid( const int cells_per_dim )
+{
+    double cell_size = 1.0 / cells_per_dim;
+    std::array<double, 3> low_corner = { 0.0, 0.0, 0.0 };
+    std::array<double, 3> high_corner = { 1.0, 1.0, 1.0 };
+    auto global_mesh =
+        createUniformGlobalMesh( low_corner, high_corner, cell_size );
+    DimBlockPartitioner<3> partitioner;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+    return createLocalGrid( global_grid, 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Time the phases of one preconditioned CG iteration in isolation: the
+// stencil matrix-vector product, the global dot product, the halo gather,
+// and the point-Jacobi preconditioner apply. The phase kernels match the
+// ones the reference solver fuses into its iteration so their relative cost
+// attributes where a solve spends its time.
+template <class Device>
+void phaseSweep( std::ostream& stream, const std::vector<int>& grid_sizes,
+                 const double peak_bandwidth, const std::string& test_prefix,
+                 const Cabana::Benchmark::OutputFormat format )
+{
+    using exec_space = typename Device::execution_space;
+
+    int num_size = grid_sizes.size();
+
+    int comm_rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &comm_rank );
+
+    // Warmup and repetition policy for the test loops.
+    Cabana::Benchmark::RunPolicy policy( 2, 10 );
+
+    // Create the timers.
+    Cabana::Benchmark::Timer matvec_timer( test_prefix + "matvec", num_size,
+                                           policy );
+    Cabana::Benchmark::Timer dot_timer( test_prefix + "dot", num_size,
+                                        policy );
+    Cabana::Benchmark::Timer halo_timer( test_prefix + "halo", num_size,
+                                         policy );
+    Cabana::Benchmark::Timer precond_timer( test_prefix + "precond", num_size,
+                                            policy );
+
+    // The shifted 7-point Laplacian the solve sweep uses.
+    std::array<std::array<int, 3>, 7> op_stencil = {
+        { { 0, 0, 0 },
+          { -1, 0, 0 },
+          { 1, 0, 0 },
+          { 0, -1, 0 },
+          { 0, 1, 0 },
+          { 0, 0, -1 },
+          { 0, 0, 1 } } };
+    std::array<double, 7> op_coefficients = { 7.0,  -1.0, -1.0, -1.0,
+                                              -1.0, -1.0, -1.0 };
+    auto A_op = createConstantStencilOperator( op_stencil, op_coefficients );
+
+    // Sweep the grid sizes.
+    for ( int s = 0; s < num_size; ++s )
+    {
+        auto local_grid = createBenchmarkGrid( grid_sizes[s] );
+        auto owned_space = local_grid->indexSpace( Own(), Cell(), Local() );
+
+        // Create the work vectors and the halo the solver would build for
+        // this stencil.
+        auto vector_layout = createArrayLayout( local_grid, 1, Cell() );
+        auto x = createArray<double, Device>( "x", vector_layout );
+        auto y = createArray<double, Device>( "y", vector_layout );
+        ArrayOp::assign( *x, 1.0, Ghost() );
+        ArrayOp::assign( *y, 0.5, Ghost() );
+        auto halo = createHalo( *x, FaceHaloPattern<3>(), 1 );
+
+        auto x_view = x->view();
+        auto y_view = y->view();
+
+        // Run tests and time the ensemble.
+        for ( int t = 0; t < policy.numTotal(); ++t )
+        {
+            // Stencil matrix-vector product.
+            matvec_timer.start( s );
+            Kokkos::parallel_for(
+                "benchmark_matvec",
+                createExecutionPolicy( owned_space, exec_space() ),
+                KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                    y_view( i, j, k, 0 ) = A_op.apply(
+                        i, j, k, [&]( const int ii, const int jj,
+                                      const int kk ) {
+                            return x_view( ii, jj, kk, 0 );
+                        } );
+                } );
+            Kokkos::fence();
+            matvec_timer.stop( s );
+
+            // Global dot product.
+            double dot = 0.0;
+            dot_timer.start( s );
+            Kokkos::parallel_reduce(
+                "benchmark_dot",
+                createExecutionPolicy( owned_space, exec_space() ),
+                KOKKOS_LAMBDA( const int i, const int j, const int k,
+                               double& sum ) {
+                    sum += x_view( i, j, k, 0 ) * y_view( i, j, k, 0 );
+                },
+                dot );
+            Kokkos::fence();
+            MPI_Allreduce( MPI_IN_PLACE, &dot, 1, MPI_DOUBLE, MPI_SUM,
+                           MPI_COMM_WORLD );
+            dot_timer.stop( s );
+
+            // Halo gather.
+            halo_timer.start( s );
+            halo->gather( exec_space(), *x );
+            halo_timer.stop( s );
+
+            // Point-Jacobi preconditioner apply.
+            precond_timer.start( s );
+            Kokkos::parallel_for(
+                "benchmark_precond",
+                createExecutionPolicy( owned_space, exec_space() ),
+                KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                    y_view( i, j, k, 0 ) = x_view( i, j, k, 0 ) / 7.0;
+                } );
+            Kokkos::fence();
+            precond_timer.stop( s );
+        }
+
+        // Report rank 0 achieved bandwidth against the machine peak for the
+        // memory-bound phases. The streaming model charges each point one
+        // read and one write for the matvec and preconditioner (the stencil
+        // neighbors hit in cache) and two reads for the dot product.
+        if ( 0 == comm_rank &&
+             Cabana::Benchmark::OutputFormat::table == format )
+        {
+            double num_point = owned_space.size();
+            double phase_bytes[3] = { 16.0 * num_point, 16.0 * num_point,
+                                      16.0 * num_point };
+            const Cabana::Benchmark::Timer* phase_timers[3] = {
+                &matvec_timer, &dot_timer, &precond_timer };
+            const char* phase_names[3] = { "matvec", "dot", "precond" };
+            stream << test_prefix << "bandwidth, grid size " << grid_sizes[s]
+                   << "^3:\n";
+            for ( int f = 0; f < 3; ++f )
+            {
+                auto stats = Cabana::Benchmark::computeStatistics(
+                    phase_timers[f]->samples( s ) );
+                double gbs = phase_bytes[f] / stats.median / 1.0e9;
+                stream << "  " << phase_names[f] << ": " << gbs << " GB/s";
+                if ( peak_bandwidth > 0.0 )
+                    stream << " (" << 100.0 * gbs / peak_bandwidth
+                           << "% of peak)";
+                stream << "\n";
+            }
+            stream << "\n";
+        }
+    }
+
+    // Output results.
+    outputResults( stream, "grid_size_per_dim", grid_sizes, matvec_timer,
+                   MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "grid_size_per_dim", grid_sizes, dot_timer,
+                   MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "grid_size_per_dim", grid_sizes, halo_timer,
+                   MPI_COMM_WORLD, format, test_prefix );
+    outputResults( stream, "grid_size_per_dim", grid_sizes, precond_timer,
+                   MPI_COMM_WORLD, format, test_prefix );
+}
+
+//---------------------------------------------------------------------------//
+// Time full solves to tolerance and report the iteration counts for the
+// reference conjugate gradient and, when available, the Hypre structured
+// solvers on the same shifted Laplacian problem.
+template <class Device>
+void solveSweep( std::ostream& stream, const std::vector<int>& grid_sizes,
+                 const std::string& test_prefix,
+                 const Cabana::Benchmark::OutputFormat format )
+{
+    int num_size = grid_sizes.size();
+
+    int comm_rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &comm_rank );
+
+    // Solves are expensive - run fewer repetitions than the kernel phases.
+    Cabana::Benchmark::RunPolicy policy( 1, 3 );
+
+    // Create the timers.
+    Cabana::Benchmark::Timer cg_timer( test_prefix + "reference_cg_solve",
+                                       num_size, policy );
+#ifdef Cabana_ENABLE_HYPRE
+    Cabana::Benchmark::Timer hypre_timer( test_prefix + "hypre_pcg_solve",
+                                          num_size, policy );
+#endif
+
+    // The shifted 7-point Laplacian stencil. The diagonal shift keeps the
+    // periodic operator nonsingular.
+    std::vector<std::array<int, 3>> stencil = {
+        { 0, 0, 0 }, { -1, 0, 0 }, { 1, 0, 0 }, { 0, -1, 0 },
+        { 0, 1, 0 }, { 0, 0, -1 }, { 0, 0, 1 } };
+    std::array<std::array<int, 3>, 7> op_stencil = {
+        { { 0, 0, 0 },
+          { -1, 0, 0 },
+          { 1, 0, 0 },
+          { 0, -1, 0 },
+          { 0, 1, 0 },
+          { 0, 0, -1 },
+          { 0, 0, 1 } } };
+    std::array<double, 7> op_coefficients = { 7.0,  -1.0, -1.0, -1.0,
+                                              -1.0, -1.0, -1.0 };
+    auto A_op = createConstantStencilOperator( op_stencil, op_coefficients );
+    std::array<std::array<int, 3>, 1> diag_op_stencil = { { { 0, 0, 0 } } };
+    std::array<double, 1> diag_op_coefficients = { 1.0 / 7.0 };
+    auto M_op =
+        createConstantStencilOperator( diag_op_stencil, diag_op_coefficients );
+
+    // Sweep the grid sizes.
+    for ( int s = 0; s < num_size; ++s )
+    {
+        auto local_grid = createBenchmarkGrid( grid_sizes[s] );
+        auto owned_space = local_grid->indexSpace( Own(), Cell(), Local() );
+
+        auto vector_layout = createArrayLayout( local_grid, 1, Cell() );
+        auto rhs = createArray<double, Device>( "rhs", vector_layout );
+        ArrayOp::assign( *rhs, 1.0, Own() );
+        auto lhs = createArray<double, Device>( "lhs", vector_layout );
+
+        // Reference conjugate gradient with the matrix-free operator and a
+        // point-Jacobi preconditioner.
+        auto cg_solver = createReferenceConjugateGradient<double, Device>(
+            *vector_layout );
+        cg_solver->setMatrixOperator( A_op );
+        cg_solver->setPreconditionerOperator( M_op );
+        cg_solver->setTolerance( 1.0e-8 );
+        cg_solver->setMaxIter( 2000 );
+        cg_solver->setPrintLevel( 0 );
+        cg_solver->setup();
+
+        int cg_iters = 0;
+        for ( int t = 0; t < policy.numTotal(); ++t )
+        {
+            ArrayOp::assign( *lhs, 0.0, Own() );
+            cg_timer.start( s );
+            cg_solver->solve( *rhs, *lhs, A_op, M_op );
+            cg_timer.stop( s );
+            cg_iters = cg_solver->getNumIter();
+        }
+
+#ifdef Cabana_ENABLE_HYPRE
+        // Hypre PCG with a diagonal preconditioner on the same problem.
+        auto hypre_solver = createHypreStructuredSolver<double, Device>(
+            "PCG", *vector_layout );
+        hypre_solver->setMatrixStencil( stencil );
+        auto matrix_entry_layout = createArrayLayout( local_grid, 7, Cell() );
+        auto matrix_entries = createArray<double, Device>(
+            "matrix_entries", matrix_entry_layout );
+        auto entry_view = matrix_entries->view();
+        Kokkos::parallel_for(
+            "fill_matrix_entries",
+            createExecutionPolicy( owned_space,
+                                   typename Device::execution_space() ),
+            KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+                entry_view( i, j, k, 0 ) = 7.0;
+                for ( int c = 1; c < 7; ++c )
+                    entry_view( i, j, k, c ) = -1.0;
+            } );
+        hypre_solver->setMatrixValues( *matrix_entries );
+        hypre_solver->setTolerance( 1.0e-8 );
+        hypre_solver->setMaxIter( 2000 );
+        hypre_solver->setPrintLevel( 0 );
+        auto preconditioner = createHypreStructuredSolver<double, Device>(
+            "Diagonal", *vector_layout, true );
+        hypre_solver->setPreconditioner( preconditioner );
+        hypre_solver->setup();
+
+        int hypre_iters = 0;
+        for ( int t = 0; t < policy.numTotal(); ++t )
+        {
+            ArrayOp::assign( *lhs, 0.0, Own() );
+            hypre_timer.start( s );
+            hypre_solver->solve( *rhs, *lhs );
+            hypre_timer.stop( s );
+            hypre_iters = hypre_solver->getNumIter();
+        }
+#endif
+
+        // Report iterations-to-tolerance.
+        if ( 0 == comm_rank &&
+             Cabana::Benchmark::OutputFormat::table == format )
+        {
+            stream << test_prefix << "iterations, grid size " << grid_sizes[s]
+                   << "^3:\n";
+            stream << "  reference_cg: " << cg_iters << "\n";
+#ifdef Cabana_ENABLE_HYPRE
+            stream << "  hypre_pcg: " << hypre_iters << "\n";
+#endif
+            stream << "\n";
+        }
+    }
+
+    // Output results.
+    outputResults( stream, "grid_size_per_dim", grid_sizes, cg_timer,
+                   MPI_COMM_WORLD, format, test_prefix );
+#ifdef Cabana_ENABLE_HYPRE
+    outputResults( stream, "grid_size_per_dim", grid_sizes, hypre_timer,
+                   MPI_COMM_WORLD, format, test_prefix );
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// Run the phase and solve sweeps on a device.
+template <class Device>
+void performanceTest( std::ostream& stream, const std::vector<int>& grid_sizes,
+                      const double peak_bandwidth,
+                      const std::string& device_prefix,
+                      const Cabana::Benchmark::OutputFormat format )
+{
+    phaseSweep<Device>( stream, grid_sizes, peak_bandwidth, device_prefix,
+                        format );
+    solveSweep<Device>( stream, grid_sizes, device_prefix, format );
+}
+
+//---------------------------------------------------------------------------//
+// main
+int main( int argc, char* argv[] )
+{
+    // Initialize environment
+    MPI_Init( &argc, &argv );
+    Kokkos::initialize( argc, argv );
+
+    // Check arguments.
+    if ( argc < 3 )
+        throw std::runtime_error( "Incorrect number of arguments. \n \
+             First argument - largest number of cells per dimension \n \
+             Second argument - file name for output \n \
+             Third argument (optional) - machine peak bandwidth in GB/s \n \
+             Fourth argument (optional) - output format (table, csv, json) \n \
+             \n \
+             Example: \n \
+             $/: ./StructuredSolverPerformance 128 test_results.txt 900\n" );
+
+    // Largest number of cells per dimension across all ranks. The sweep runs
+    // this size and the two power-of-two sizes below it.
+    int max_cells_per_dim = std::atoi( argv[1] );
+    std::vector<int> grid_sizes = { max_cells_per_dim / 4,
+                                    max_cells_per_dim / 2, max_cells_per_dim };
+
+    // Get the name of the output file.
+    std::string filename = argv[2];
+
+    // Machine peak bandwidth in GB/s for the roofline comparison. Zero or
+    // absent reports achieved bandwidth only.
+    double peak_bandwidth = ( argc > 3 ) ? std::atof( argv[3] ) : 0.0;
+
+    // Get the output format.
+    auto format = ( argc > 4 )
+                      ? Cabana::Benchmark::parseOutputFormat( argv[4] )
+                      : Cabana::Benchmark::OutputFormat::table;
+
+    // Barier before continuing.
+    MPI_Barrier( MPI_COMM_WORLD );
+
+    // Get comm rank;
+    int comm_rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &comm_rank );
+
+    // Get comm size;
+    int comm_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+
+    // Open the output file on rank 0.
+    std::fstream file;
+    if ( 0 == comm_rank )
+        file.open( filename, std::fstream::out );
+
+    // Output problem details. The banner is only part of the table format -
+    // the structured formats must stay machine-parseable.
+    if ( 0 == comm_rank && Cabana::Benchmark::OutputFormat::table == format )
+    {
+        file << "\n";
+        file << "Cajita Structured Solver Performance Benchmark"
+             << "\n";
+        file << "----------------------------------------------"
+             << "\n";
+        file << "MPI Ranks: " << comm_size << "\n";
+        file << "Max cells per dimension: " << max_cells_per_dim << "\n";
+        file << "----------------------------------------------"
+             << "\n";
+        file << "\n";
+    }
+
+    // Run the benchmark on the available backends.
+#ifdef KOKKOS_ENABLE_SERIAL
+    using SerialDevice = Kokkos::Device<Kokkos::Serial, Kokkos::HostSpace>;
+    performanceTest<SerialDevice>( file, grid_sizes, peak_bandwidth,
+                                   "serial_", format );
+#endif
+#ifdef KOKKOS_ENABLE_OPENMP
+    using OpenMPDevice = Kokkos::Device<Kokkos::OpenMP, Kokkos::HostSpace>;
+    performanceTest<OpenMPDevice>( file, grid_sizes, peak_bandwidth,
+                                   "openmp_", format );
+#endif
+#ifdef KOKKOS_ENABLE_CUDA
+    using CudaDevice = Kokkos::Device<Kokkos::Cuda, Kokkos::CudaSpace>;
+    performanceTest<CudaDevice>( file, grid_sizes, peak_bandwidth, "cuda_",
+                                 format );
+#endif
+
+    // Close the output file on rank 0.
+    if ( 0 == comm_rank )
+        file.close();
+
+    // Finalize
+    Kokkos::finalize();
+    MPI_Finalize();
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
@@ -26,6 +26,7 @@
 #include <Cajita_IndexConversion.hpp>
 #include <Cajita_IndexSpace.hpp>
 #include <Cajita_Interpolation.hpp>
+#include <Cajita_LoadBalancer.hpp>
 #include <Cajita_LocalGrid.hpp>
 #include <Cajita_LocalMesh.hpp>
 #include <Cajita_ManualPartitioner.hpp>
@@ -34,8 +35,11 @@
 #include <Cajita_ParticleGridDistributor.hpp>
 #include <Cajita_Partitioner.hpp>
 #include <Cajita_ReferenceStructuredSolver.hpp>
+#include <Cajita_ScratchArena.hpp>
 #include <Cajita_SparseDimPartitioner.hpp>
+#include <Cajita_SparseHalo.hpp>
 #include <Cajita_SparseIndexSpace.hpp>
+#include <Cajita_SparseInterpolation.hpp>
 #include <Cajita_Splines.hpp>
 #include <Cajita_Types.hpp>
 #include <Cajita_UniformDimPartitioner.hpp>
@@ -86,6 +86,26 @@ class ArrayLayout
                                 _dofs_per_entity );
     }
 
+    /*!
+      Get the local index space of the owned array elements plus the given
+      number of halo cells of ghosted elements. This is the update range of
+      wide-halo schemes that refresh deep ghosts locally between exchanges.
+
+      \param decomposition_tag Decomposition type: Ghost
+      \param index_type Index type: Local
+      \param halo_width Depth of ghosted entities to include. Must be less
+      than or equal to the halo width of the local grid.
+    */
+    IndexSpace<num_space_dim + 1> indexSpace( Ghost decomposition_tag,
+                                              Local index_type,
+                                              const int halo_width ) const
+    {
+        return appendDimension(
+            _local_grid->indexSpace( decomposition_tag, EntityType(),
+                                     index_type, halo_width ),
+            _dofs_per_entity );
+    }
+
     /*!
       Get the local index space of the array elements we shared with the
       given neighbor in the given decomposition.
@@ -786,6 +806,124 @@ void dot( const Array_t& a, const Array_t& b,
                    a.layout()->localGrid()->globalGrid().comm() );
 }
 
+//---------------------------------------------------------------------------//
+//! Fused update-dot functor. Computes a = alpha * a + beta * b and
+//! accumulates the dot product of the updated a with itself in the same
+//! array traversal.
+template <class ViewType, std::size_t NumSpaceDim>
+struct UpdateDotFunctor
+{
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = NumSpaceDim;
+    //! Value type.
+    typedef typename ViewType::value_type value_type[];
+    //! Scalar type.
+    using scalar_type = typename ViewType::value_type;
+    //! Size type.
+    typedef typename ViewType::size_type size_type;
+    //! Size of the array.
+    size_type value_count;
+    //! The array that is updated.
+    ViewType _a;
+    //! The array added to a.
+    ViewType _b;
+    //! Coefficient of a.
+    scalar_type _alpha;
+    //! Coefficient of b.
+    scalar_type _beta;
+
+    //! Constructor.
+    UpdateDotFunctor( const ViewType& a, const scalar_type alpha,
+                      const ViewType& b, const scalar_type beta )
+        : value_count( a.extent( NumSpaceDim ) )
+        , _a( a )
+        , _b( b )
+        , _alpha( alpha )
+        , _beta( beta )
+    {
+    }
+
+    //! 3d update-dot operation.
+    template <std::size_t NSD = num_space_dim>
+    KOKKOS_INLINE_FUNCTION std::enable_if_t<3 == NSD, void>
+    operator()( const size_type i, const size_type j, const size_type k,
+                const size_type l, value_type sum ) const
+    {
+        auto updated = _alpha * _a( i, j, k, l ) + _beta * _b( i, j, k, l );
+        _a( i, j, k, l ) = updated;
+        sum[l] += updated * updated;
+    }
+
+    //! 2d update-dot operation.
+    template <std::size_t NSD = num_space_dim>
+    KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == NSD, void>
+    operator()( const size_type i, const size_type j, const size_type l,
+                value_type sum ) const
+    {
+        auto updated = _alpha * _a( i, j, l ) + _beta * _b( i, j, l );
+        _a( i, j, l ) = updated;
+        sum[l] += updated * updated;
+    }
+
+    //! Join operation.
+    KOKKOS_INLINE_FUNCTION
+    void join( volatile value_type dst, const volatile value_type src ) const
+    {
+        for ( size_type j = 0; j < value_count; ++j )
+            dst[j] += src[j];
+    }
+
+    //! Zero initialization.
+    KOKKOS_INLINE_FUNCTION void init( value_type sum ) const
+    {
+        for ( size_type j = 0; j < value_count; ++j )
+            sum[j] = 0.0;
+    }
+};
+
+/*!
+  \brief Update two vectors such that a = alpha * a + beta * b and compute
+  the dot product of the updated a with itself in the same kernel pass.
+
+  Fusing the vector update with the subsequent reduction services both
+  algebraic steps with one array traversal, halving the memory traffic of
+  the common axpby-then-dot pattern of Krylov solvers. The update runs over
+  the owned decomposition so the dot product is globally consistent.
+
+  \param a The array that will be updated.
+  \param alpha The value to scale a by.
+  \param b The array to add to a.
+  \param beta The value to scale b by.
+  \param products The dot product of the updated a with itself for each
+  entity degree-of-freedom. This vector should be pre-sized to the number
+  of degrees-of-freedom per entity.
+*/
+template <class Array_t>
+void updateDot( Array_t& a, const typename Array_t::value_type alpha,
+                const Array_t& b, const typename Array_t::value_type beta,
+                std::vector<typename Array_t::value_type>& products )
+{
+    static_assert( is_array<Array_t>::value, "Cajita::Array required" );
+    if ( products.size() !=
+         static_cast<unsigned>( a.layout()->dofsPerEntity() ) )
+        throw std::runtime_error( "Incorrect vector size" );
+
+    for ( auto& p : products )
+        p = 0.0;
+
+    UpdateDotFunctor<typename Array_t::view_type, Array_t::num_space_dim>
+        functor( a.view(), alpha, b.view(), beta );
+    Kokkos::parallel_reduce(
+        "ArrayOp::updateDot",
+        createExecutionPolicy( a.layout()->indexSpace( Own(), Local() ),
+                               typename Array_t::execution_space() ),
+        functor, products.data() );
+
+    MPI_Allreduce( MPI_IN_PLACE, products.data(), products.size(),
+                   MpiTraits<typename Array_t::value_type>::type(), MPI_SUM,
+                   a.layout()->localGrid()->globalGrid().comm() );
+}
+
 //---------------------------------------------------------------------------//
 //! Infinity norm functor
 template <class ViewType, std::size_t NumSpaceDim>
@@ -24,7 +24,10 @@
 #include <heffte_fft3d.h>
 
 #include <array>
+#include <map>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <type_traits>
 
 namespace Cajita
@@ -168,8 +171,12 @@ class FastFourierTransform
     /*!
       \brief Constructor
       \param layout The array layout defining the vector space of the transform.
+      \param num_dof The degrees-of-freedom per entity the transform operates
+      on - 2 for complex data (the default) and 1 for real data.
     */
-    FastFourierTransform( const ArrayLayout<EntityType, MeshType>& layout )
+    FastFourierTransform( const ArrayLayout<EntityType, MeshType>& layout,
+                          const int num_dof = 2 )
+        : _num_dof( num_dof )
     {
         checkArrayDofs( layout.dofsPerEntity() );
 
@@ -198,9 +205,10 @@ class FastFourierTransform
     */
     inline void checkArrayDofs( const int dof )
     {
-        if ( 2 != dof )
+        if ( _num_dof != dof )
             throw std::logic_error(
-                "Only 1 complex value per entity allowed in FFT" );
+                "Only 1 value (real) or complex pair per entity allowed in "
+                "FFT" );
     }
 
     /*!
@@ -243,6 +251,36 @@ class FastFourierTransform
         static_cast<Derived*>( this )->reverseImpl( x, scaling );
     }
 
+    /*!
+      \brief Do a batched forward FFT on multiple arrays.
+      \param scaling Method of scaling data.
+      \param x The arrays on which to perform the forward transform.
+
+      The arrays are transformed back-to-back re-using this transform's plan
+      and work storage so the per-field plan setup and allocation are
+      amortized across the batch.
+    */
+    template <class ScaleType, class... ArrayTypes>
+    void forwardBatched( const ScaleType scaling, const ArrayTypes&... x )
+    {
+        std::initializer_list<int>{ ( forward( x, scaling ), 0 )... };
+    }
+
+    /*!
+      \brief Do a batched reverse FFT on multiple arrays.
+      \param scaling Method of scaling data.
+      \param x The arrays on which to perform the reverse transform.
+
+      The arrays are transformed back-to-back re-using this transform's plan
+      and work storage so the per-field plan setup and allocation are
+      amortized across the batch.
+    */
+    template <class ScaleType, class... ArrayTypes>
+    void reverseBatched( const ScaleType scaling, const ArrayTypes&... x )
+    {
+        std::initializer_list<int>{ ( reverse( x, scaling ), 0 )... };
+    }
+
     /*!
       \brief Copy owned data for FFT.
     */
@@ -259,8 +297,8 @@ class FastFourierTransform
                 auto iw = i - own_space.min( Dim::I );
                 auto jw = j - own_space.min( Dim::J );
                 auto kw = k - own_space.min( Dim::K );
-                l_view( iw, jw, kw, 0 ) = lg_view( i, j, k, 0 );
-                l_view( iw, jw, kw, 1 ) = lg_view( i, j, k, 1 );
+                for ( std::size_t l = 0; l < l_view.extent( 3 ); ++l )
+                    l_view( iw, jw, kw, l ) = lg_view( i, j, k, l );
             } );
     }
 
@@ -279,8 +317,8 @@ class FastFourierTransform
             KOKKOS_LAMBDA( const int i, const int j ) {
                 auto iw = i - own_space.min( Dim::I );
                 auto jw = j - own_space.min( Dim::J );
-                l_view( iw, jw, 0 ) = lg_view( i, j, 0 );
-                l_view( iw, jw, 1 ) = lg_view( i, j, 1 );
+                for ( std::size_t l = 0; l < l_view.extent( 2 ); ++l )
+                    l_view( iw, jw, l ) = lg_view( i, j, l );
             } );
     }
 
@@ -300,8 +338,8 @@ class FastFourierTransform
                 auto iw = i - own_space.min( Dim::I );
                 auto jw = j - own_space.min( Dim::J );
                 auto kw = k - own_space.min( Dim::K );
-                lg_view( i, j, k, 0 ) = l_view( iw, jw, kw, 0 );
-                lg_view( i, j, k, 1 ) = l_view( iw, jw, kw, 1 );
+                for ( std::size_t l = 0; l < l_view.extent( 3 ); ++l )
+                    lg_view( i, j, k, l ) = l_view( iw, jw, kw, l );
             } );
     }
 
@@ -320,10 +358,13 @@ class FastFourierTransform
             KOKKOS_LAMBDA( const int i, const int j ) {
                 auto iw = i - own_space.min( Dim::I );
                 auto jw = j - own_space.min( Dim::J );
-                lg_view( i, j, 0 ) = l_view( iw, jw, 0 );
-                lg_view( i, j, 1 ) = l_view( iw, jw, 1 );
+                for ( std::size_t l = 0; l < l_view.extent( 2 ); ++l )
+                    lg_view( i, j, l ) = l_view( iw, jw, l );
             } );
     }
+
+  private:
+    int _num_dof;
 };
 
 //---------------------------------------------------------------------------//
@@ -372,6 +413,66 @@ struct HeffteBackendTraits<Kokkos::Experimental::HIP, Impl::FFTBackendDefault>
 };
 #endif
 
+// Shared FFT scratch storage. Transforms with the same scalar type,
+// device, and workspace size share a single allocation - the workspace
+// only holds data within a single forward or reverse call so concurrent
+// transform objects over the same index space can reuse it. The storage is
+// held weakly and freed when the last transform using it is destroyed.
+template <class Scalar, class DeviceType>
+std::shared_ptr<Kokkos::View<Scalar*, DeviceType>>
+getFFTWorkspace( const std::size_t size )
+{
+    static std::map<std::size_t,
+                    std::weak_ptr<Kokkos::View<Scalar*, DeviceType>>>
+        registry;
+    auto& entry = registry[size];
+    auto work = entry.lock();
+    if ( !work )
+    {
+        work = std::make_shared<Kokkos::View<Scalar*, DeviceType>>(
+            Kokkos::ViewAllocateWithoutInitializing( "fft_work" ), size );
+        entry = work;
+    }
+    return work;
+}
+
+// Build a registry key identifying a transform plan: the local input and
+// output boxes, the plan options, the real-to-complex direction (-1 for
+// complex transforms), and the communicator.
+inline std::string makeFFTPlanKey( const heffte::box3d& inbox,
+                                   const heffte::box3d& outbox, MPI_Comm comm,
+                                   const heffte::plan_options& options,
+                                   const int r2c_direction = -1 )
+{
+    std::ostringstream key;
+    for ( int d = 0; d < 3; ++d )
+        key << inbox.low[d] << "," << inbox.high[d] << "," << outbox.low[d]
+            << "," << outbox.high[d] << ",";
+    key << options.use_alltoall << options.use_pencils << options.use_reorder
+        << "," << r2c_direction << ",";
+    key.write( reinterpret_cast<const char*>( &comm ), sizeof( MPI_Comm ) );
+    return key.str();
+}
+
+// Cache of transform plans. Transforms with identical boxes, options, and
+// communicator share a single heFFTe plan so the setup cost and the
+// internal communication buffers are paid once. Plans are held weakly and
+// freed when the last transform using them is destroyed.
+template <class FFTPlanType, class FactoryType>
+std::shared_ptr<FFTPlanType> getFFTPlan( const std::string& key,
+                                         const FactoryType& factory )
+{
+    static std::map<std::string, std::weak_ptr<FFTPlanType>> registry;
+    auto& entry = registry[key];
+    auto plan = entry.lock();
+    if ( !plan )
+    {
+        plan = factory();
+        entry = plan;
+    }
+    return plan;
+}
+
 template <class ScaleType>
 struct HeffteScalingTraits
 {
@@ -449,10 +550,14 @@ class HeffteFastFourierTransform
         heffte_params.use_reorder = params.getReorder();
 
         // Set FFT options from given parameters
-        // heFFTe correctly handles 2D or 3D FFTs within "fft3d"
-        _fft = std::make_shared<heffte::fft3d<heffte_backend_type>>(
-            inbox, outbox, layout.localGrid()->globalGrid().comm(),
-            heffte_params );
+        // heFFTe correctly handles 2D or 3D FFTs within "fft3d". Identical
+        // plans are shared between transform objects.
+        MPI_Comm comm = layout.localGrid()->globalGrid().comm();
+        _fft = Impl::getFFTPlan<heffte::fft3d<heffte_backend_type>>(
+            Impl::makeFFTPlanKey( inbox, outbox, comm, heffte_params ), [&]() {
+                return std::make_shared<heffte::fft3d<heffte_backend_type>>(
+                    inbox, outbox, comm, heffte_params );
+            } );
 
         int fftsize = std::max( _fft->size_outbox(), _fft->size_inbox() );
 
@@ -463,9 +568,8 @@ class HeffteFastFourierTransform
             throw std::logic_error( "Expected FFT allocation size smaller "
                                     "than local grid size" );
 
-        _fft_work = Kokkos::View<Scalar*, DeviceType>(
-            Kokkos::ViewAllocateWithoutInitializing( "fft_work" ),
-            2 * fftsize );
+        // The workspace is shared with other transforms of the same size.
+        _fft_work = Impl::getFFTWorkspace<Scalar, DeviceType>( 2 * fftsize );
     }
 
     /*!
@@ -504,7 +608,7 @@ class HeffteFastFourierTransform
             x.layout()->localGrid()->indexSpace( Own(), EntityType(), Local() );
         auto local_view_space = appendDimension( own_space, 2 );
         auto local_view = createView<Scalar, Kokkos::LayoutRight, DeviceType>(
-            local_view_space, _fft_work.data() );
+            local_view_space, _fft_work->data() );
 
         // TODO: pull this out to template function
         // Copy to the work array. The work array only contains owned data.
@@ -515,15 +619,15 @@ class HeffteFastFourierTransform
         if ( flag == 1 )
         {
             _fft->forward(
-                reinterpret_cast<std::complex<Scalar>*>( _fft_work.data() ),
-                reinterpret_cast<std::complex<Scalar>*>( _fft_work.data() ),
+                reinterpret_cast<std::complex<Scalar>*>( _fft_work->data() ),
+                reinterpret_cast<std::complex<Scalar>*>( _fft_work->data() ),
                 scale );
         }
         else if ( flag == -1 )
         {
             _fft->backward(
-                reinterpret_cast<std::complex<Scalar>*>( _fft_work.data() ),
-                reinterpret_cast<std::complex<Scalar>*>( _fft_work.data() ),
+                reinterpret_cast<std::complex<Scalar>*>( _fft_work->data() ),
+                reinterpret_cast<std::complex<Scalar>*>( _fft_work->data() ),
                 scale );
         }
         else
@@ -539,7 +643,207 @@ class HeffteFastFourierTransform
   private:
     // heFFTe correctly handles 2D or 3D FFTs within "fft3d"
     std::shared_ptr<heffte::fft3d<heffte_backend_type>> _fft;
-    Kokkos::View<Scalar*, DeviceType> _fft_work;
+    std::shared_ptr<Kokkos::View<Scalar*, DeviceType>> _fft_work;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Interface to the heFFTe real-to-complex fast Fourier transform.
+
+  Transforms real arrays (1 degree-of-freedom per entity) instead of complex
+  pairs. The conjugate symmetry of the spectrum of real data is exploited so
+  only the first n/2 + 1 coefficients in the contiguous dimension are
+  computed and communicated - roughly halving the memory traffic and
+  message volume of a complex transform of the same field.
+
+  A forward transform stores the complex coefficients in an internal
+  spectral buffer accessible with spectralView() and the reverse transform
+  reads them back. The global index bounds of the local coefficients are
+  given by spectralLow() and spectralHigh().
+*/
+template <class EntityType, class MeshType, class Scalar, class DeviceType,
+          class BackendType>
+class HeffteFastFourierTransformR2C
+    : public FastFourierTransform<
+          EntityType, MeshType, Scalar, DeviceType,
+          HeffteFastFourierTransformR2C<EntityType, MeshType, Scalar,
+                                        DeviceType, BackendType>>
+{
+  public:
+    //! Scalar value type.
+    using value_type = Scalar;
+    //! Kokkos device type.
+    using device_type = DeviceType;
+    //! FFT backend type.
+    using backend_type = BackendType;
+    //! Kokkos execution space.
+    using exec_space = typename device_type::execution_space;
+    //! Mesh type.
+    using mesh_type = MeshType;
+
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = mesh_type::num_space_dim;
+
+    //! heFFTe backend type.
+    using heffte_backend_type =
+        typename Impl::HeffteBackendTraits<exec_space,
+                                           backend_type>::backend_type;
+
+    /*!
+      \brief Constructor
+      \param layout The array layout defining the vector space of the
+      transform. Must have 1 degree-of-freedom per entity.
+      \param params Parameters for the FFT.
+    */
+    HeffteFastFourierTransformR2C(
+        const ArrayLayout<EntityType, MeshType>& layout,
+        const FastFourierTransformParams& params )
+        : FastFourierTransform<
+              EntityType, MeshType, Scalar, DeviceType,
+              HeffteFastFourierTransformR2C<EntityType, MeshType, Scalar,
+                                            DeviceType, BackendType>>( layout,
+                                                                       1 )
+    {
+        // heFFTe correctly handles 2D or 3D domains within "box3d"
+        heffte::box3d inbox = { this->global_low, this->global_high };
+
+        // The conjugate-symmetric half of the spectrum is dropped in the
+        // contiguous dimension (heFFTe dimension 0). Only the first
+        // n/2 + 1 coefficients are kept - clip the local box accordingly.
+        // Blocks that lie entirely in the redundant half own no
+        // coefficients.
+        int num_r2c = layout.localGrid()->globalGrid().globalNumEntity(
+                          EntityType(), num_space_dim - 1 ) /
+                          2 +
+                      1;
+        _complex_low = this->global_low;
+        _complex_high = this->global_high;
+        _complex_high[0] = std::min( _complex_high[0], num_r2c - 1 );
+        heffte::box3d outbox = { _complex_low, _complex_high };
+
+        heffte::plan_options heffte_params =
+            heffte::default_options<heffte_backend_type>();
+        heffte_params.use_alltoall = params.getAllToAll();
+        heffte_params.use_pencils = params.getPencils();
+        heffte_params.use_reorder = params.getReorder();
+
+        // Set FFT options from given parameters
+        // heFFTe correctly handles 2D or 3D FFTs within "fft3d_r2c".
+        // Identical plans are shared between transform objects.
+        MPI_Comm comm = layout.localGrid()->globalGrid().comm();
+        _fft = Impl::getFFTPlan<heffte::fft3d_r2c<heffte_backend_type>>(
+            Impl::makeFFTPlanKey( inbox, outbox, comm, heffte_params, 0 ),
+            [&]() {
+                return std::make_shared<
+                    heffte::fft3d_r2c<heffte_backend_type>>(
+                    inbox, outbox, 0, comm, heffte_params );
+            } );
+
+        // Check the size.
+        auto entity_space =
+            layout.localGrid()->indexSpace( Own(), EntityType(), Local() );
+        if ( _fft->size_inbox() < (int)entity_space.size() )
+            throw std::logic_error( "Expected FFT allocation size smaller "
+                                    "than local grid size" );
+
+        // The real workspace is shared with other transforms of the same
+        // size. The spectral coefficients persist between the forward and
+        // reverse transforms so they are owned by this object.
+        _fft_work =
+            Impl::getFFTWorkspace<Scalar, DeviceType>( _fft->size_inbox() );
+        _spectral_work = Kokkos::View<Scalar* [2], Kokkos::LayoutRight,
+                                      DeviceType>(
+            Kokkos::ViewAllocateWithoutInitializing( "fft_spectral_work" ),
+            _fft->size_outbox() );
+    }
+
+    /*!
+      \brief Get the local complex coefficients of the last forward
+      transform.
+      \return A view of the coefficients with the real and imaginary parts
+      in the second dimension. The coefficients may be modified in place
+      (e.g. to apply a spectral operator) before the reverse transform.
+    */
+    Kokkos::View<Scalar* [2], Kokkos::LayoutRight, DeviceType> spectralView()
+    {
+        return _spectral_work;
+    }
+
+    //! Get the global low index of the local complex coefficients.
+    std::array<int, num_space_dim> spectralLow() const
+    {
+        return reverseDims( _complex_low );
+    }
+
+    //! Get the global high index of the local complex coefficients.
+    std::array<int, num_space_dim> spectralHigh() const
+    {
+        return reverseDims( _complex_high );
+    }
+
+    /*!
+      \brief Do a forward FFT.
+      \param x The real array on which to perform the forward transform.
+      \param ScaleType Method of scaling data.
+    */
+    template <class Array_t, class ScaleType>
+    void forwardImpl( const Array_t& x, const ScaleType )
+    {
+        // Copy the owned real data into the work array.
+        auto own_space =
+            x.layout()->localGrid()->indexSpace( Own(), EntityType(), Local() );
+        auto local_view_space = appendDimension( own_space, 1 );
+        auto local_view = createView<Scalar, Kokkos::LayoutRight, DeviceType>(
+            local_view_space, _fft_work->data() );
+        auto localghost_view = x.view();
+        this->copyToLocal( own_space, local_view, localghost_view );
+
+        _fft->forward(
+            _fft_work->data(),
+            reinterpret_cast<std::complex<Scalar>*>( _spectral_work.data() ),
+            Impl::HeffteScalingTraits<ScaleType>().scaling_type );
+    }
+
+    /*!
+     \brief Do a reverse FFT.
+     \param x The real array in which to store the reverse transform.
+     \param ScaleType Method of scaling data.
+    */
+    template <class Array_t, class ScaleType>
+    void reverseImpl( const Array_t& x, const ScaleType )
+    {
+        _fft->backward(
+            reinterpret_cast<std::complex<Scalar>*>( _spectral_work.data() ),
+            _fft_work->data(),
+            Impl::HeffteScalingTraits<ScaleType>().scaling_type );
+
+        // Copy the owned real data back to the output array.
+        auto own_space =
+            x.layout()->localGrid()->indexSpace( Own(), EntityType(), Local() );
+        auto local_view_space = appendDimension( own_space, 1 );
+        auto local_view = createView<Scalar, Kokkos::LayoutRight, DeviceType>(
+            local_view_space, _fft_work->data() );
+        auto localghost_view = x.view();
+        this->copyFromLocal( own_space, local_view, localghost_view );
+    }
+
+  private:
+    // Reverse a heFFTe-ordered dimension array into Cajita ordering.
+    static std::array<int, num_space_dim>
+    reverseDims( const std::array<int, num_space_dim>& dims )
+    {
+        std::array<int, num_space_dim> reversed;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+            reversed[d] = dims[num_space_dim - d - 1];
+        return reversed;
+    }
+
+    std::array<int, num_space_dim> _complex_low;
+    std::array<int, num_space_dim> _complex_high;
+    // heFFTe correctly handles 2D or 3D FFTs within "fft3d_r2c"
+    std::shared_ptr<heffte::fft3d_r2c<heffte_backend_type>> _fft;
+    std::shared_ptr<Kokkos::View<Scalar*, DeviceType>> _fft_work;
+    Kokkos::View<Scalar* [2], Kokkos::LayoutRight, DeviceType> _spectral_work;
 };
 
 //---------------------------------------------------------------------------//
@@ -612,6 +916,75 @@ auto createHeffteFastFourierTransform(
         layout );
 }
 
+//! Creation function for heFFTe real-to-complex FFT with explict FFT
+//! backend.
+//! \param layout FFT entity array
+//! \param params FFT parameters
+template <class Scalar, class DeviceType, class BackendType, class EntityType,
+          class MeshType>
+auto createHeffteFastFourierTransformR2C(
+    const ArrayLayout<EntityType, MeshType>& layout,
+    const FastFourierTransformParams& params )
+{
+    return std::make_shared<HeffteFastFourierTransformR2C<
+        EntityType, MeshType, Scalar, DeviceType, BackendType>>( layout,
+                                                                 params );
+}
+
+//! Creation function for heFFTe real-to-complex FFT with default FFT
+//! backend.
+//! \param layout FFT entity array
+//! \param params FFT parameters
+template <class Scalar, class DeviceType, class EntityType, class MeshType>
+auto createHeffteFastFourierTransformR2C(
+    const ArrayLayout<EntityType, MeshType>& layout,
+    const FastFourierTransformParams& params )
+{
+    return createHeffteFastFourierTransformR2C<
+        Scalar, DeviceType, Impl::FFTBackendDefault, EntityType, MeshType>(
+        layout, params );
+}
+
+//! Creation function for heFFTe real-to-complex FFT with explict FFT
+//! backend and default parameters.
+//! \param layout FFT entity array
+template <class Scalar, class DeviceType, class BackendType, class EntityType,
+          class MeshType>
+auto createHeffteFastFourierTransformR2C(
+    const ArrayLayout<EntityType, MeshType>& layout )
+{
+    using device_type = DeviceType;
+    using backend_type = BackendType;
+    using exec_space = typename device_type::execution_space;
+    using heffte_backend_type =
+        typename Impl::HeffteBackendTraits<exec_space,
+                                           backend_type>::backend_type;
+
+    // use default heFFTe params for this backend
+    const heffte::plan_options heffte_params =
+        heffte::default_options<heffte_backend_type>();
+    FastFourierTransformParams params;
+    params.setAllToAll( heffte_params.use_alltoall );
+    params.setPencils( heffte_params.use_pencils );
+    params.setReorder( heffte_params.use_reorder );
+
+    return std::make_shared<HeffteFastFourierTransformR2C<
+        EntityType, MeshType, Scalar, DeviceType, BackendType>>( layout,
+                                                                 params );
+}
+
+//! Creation function for heFFTe real-to-complex FFT with default FFT
+//! backend and default parameters.
+//! \param layout FFT entity array
+template <class Scalar, class DeviceType, class EntityType, class MeshType>
+auto createHeffteFastFourierTransformR2C(
+    const ArrayLayout<EntityType, MeshType>& layout )
+{
+    return createHeffteFastFourierTransformR2C<
+        Scalar, DeviceType, Impl::FFTBackendDefault, EntityType, MeshType>(
+        layout );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Experimental
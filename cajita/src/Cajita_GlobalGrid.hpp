@@ -22,6 +22,7 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 
 #include <mpi.h>
 
@@ -48,11 +49,16 @@ class GlobalGrid
      \param global_mesh The global mesh data.
      \param periodic Whether each logical dimension is periodic.
      \param partitioner The grid partitioner.
+     \param node_aware_reorder Whether to place the ranks of each node in a
+     compact brick of blocks so face neighbors are on-node wherever possible.
+     When the node layout cannot tile the block decomposition the rank
+     placement falls back to the MPI library reordering.
     */
     GlobalGrid( MPI_Comm comm,
                 const std::shared_ptr<GlobalMesh<MeshType>>& global_mesh,
                 const std::array<bool, num_space_dim>& periodic,
-                const BlockPartitioner<num_space_dim>& partitioner );
+                const BlockPartitioner<num_space_dim>& partitioner,
+                const bool node_aware_reorder = false );
 
     // Destructor.
     ~GlobalGrid();
@@ -61,6 +67,95 @@ class GlobalGrid
     //! Cartesian topology.
     MPI_Comm comm() const;
 
+    /*!
+      \brief Get the communicator over this block's line in a given
+      dimension.
+
+      \param dim Spatial dimension the line runs along.
+
+      The line contains the blocks sharing this block's indices in every
+      dimension except the given one - a pencil of the block grid. The rank
+      of each block in the line communicator is its block id in the given
+      dimension. The communicator is created on first use and cached for
+      the lifetime of the grid.
+    */
+    MPI_Comm lineComm( const int dim ) const;
+
+    /*!
+      \brief Get the communicator over this block's plane orthogonal to a
+      given dimension.
+
+      \param dim Spatial dimension orthogonal to the plane.
+
+      The plane contains the blocks sharing this block's index in the given
+      dimension - a slab of the block grid. The blocks are ranked in
+      row-major order of their remaining dimension indices. The
+      communicator is created on first use and cached for the lifetime of
+      the grid.
+    */
+    MPI_Comm planeComm( const int dim ) const;
+
+    /*!
+      \brief Exchange equal-size blocks of bytes among the blocks of this
+      block's line in a given dimension.
+
+      \param dim Spatial dimension the line runs along.
+      \param send_data Send buffer holding one block of bytes per line
+      block, ordered by block id in the given dimension.
+      \param recv_data Receive buffer with the same layout.
+      \param block_bytes The number of bytes in each block.
+
+      This is the transpose step of pencil algorithms: each block scatters
+      one sub-block to every block of its line and gathers one from each.
+    */
+    void lineExchange( const int dim, const void* send_data, void* recv_data,
+                       const std::size_t block_bytes ) const;
+
+    /*!
+      \brief Exchange variable-size blocks of bytes among the blocks of this
+      block's line in a given dimension.
+
+      \param dim Spatial dimension the line runs along.
+      \param send_data Send buffer holding the blocks back-to-back, ordered
+      by block id in the given dimension.
+      \param send_bytes The number of bytes to send to each line block.
+      \param recv_data Receive buffer with the same layout.
+      \param recv_bytes The number of bytes to receive from each line block.
+    */
+    void lineExchange( const int dim, const void* send_data,
+                       const std::vector<int>& send_bytes, void* recv_data,
+                       const std::vector<int>& recv_bytes ) const;
+
+    /*!
+      \brief Exchange equal-size blocks of bytes among the blocks of this
+      block's plane orthogonal to a given dimension.
+
+      \param dim Spatial dimension orthogonal to the plane.
+      \param send_data Send buffer holding one block of bytes per plane
+      block in plane communicator rank order.
+      \param recv_data Receive buffer with the same layout.
+      \param block_bytes The number of bytes in each block.
+    */
+    void planeExchange( const int dim, const void* send_data,
+                        void* recv_data,
+                        const std::size_t block_bytes ) const;
+
+    /*!
+      \brief Exchange variable-size blocks of bytes among the blocks of this
+      block's plane orthogonal to a given dimension.
+
+      \param dim Spatial dimension orthogonal to the plane.
+      \param send_data Send buffer holding the blocks back-to-back in plane
+      communicator rank order.
+      \param send_bytes The number of bytes to send to each plane block.
+      \param recv_data Receive buffer with the same layout.
+      \param recv_bytes The number of bytes to receive from each plane
+      block.
+    */
+    void planeExchange( const int dim, const void* send_data,
+                        const std::vector<int>& send_bytes, void* recv_data,
+                        const std::vector<int>& recv_bytes ) const;
+
     //! \brief Get the global mesh data.
     const GlobalMesh<MeshType>& globalMesh() const;
 
@@ -162,8 +257,40 @@ class GlobalGrid
     //! \param dim Spatial dimension.
     int globalOffset( const int dim ) const;
 
+    /*!
+      \brief Reassign the cells owned by each block from rectilinear
+      partition boundaries.
+
+      \param cell_boundaries Per-dimension block boundary arrays in global
+      cell indices. Each array has one entry per block plus one and must
+      start at zero and end at the global number of cells in that
+      dimension, so block b in dimension d owns the cells
+      [cell_boundaries[d][b], cell_boundaries[d][b+1]).
+
+      The block grid topology and the Cartesian communicator are unchanged -
+      only the cell ownership moves between the existing blocks. Local
+      grids, local meshes and arrays created before the call still describe
+      the old decomposition and must be recreated.
+    */
+    void setOwnedCells(
+        const std::array<std::vector<int>, num_space_dim>& cell_boundaries );
+
   private:
+    // Create the Cartesian communicator with node-aware rank placement.
+    // Returns false if the node layout does not tile the block grid.
+    bool
+    nodeAwareCartComm( MPI_Comm comm,
+                       const std::array<int, num_space_dim>& periodic_dims );
+
+    // Exchange variable-size blocks of bytes over a cached sub-communicator.
+    void subCommExchange( MPI_Comm sub_comm, const void* send_data,
+                          const std::vector<int>& send_bytes, void* recv_data,
+                          const std::vector<int>& recv_bytes ) const;
+
     MPI_Comm _cart_comm;
+    // Cached per-dimension sub-communicators, created on first use.
+    mutable std::array<MPI_Comm, num_space_dim> _line_comm;
+    mutable std::array<MPI_Comm, num_space_dim> _plane_comm;
     std::shared_ptr<GlobalMesh<MeshType>> _global_mesh;
     std::array<bool, num_space_dim> _periodic;
     std::array<int, num_space_dim> _ranks_per_dim;
@@ -183,16 +310,19 @@ class GlobalGrid
   \param global_mesh The global mesh data.
   \param periodic Whether each logical dimension is periodic.
   \param partitioner The grid partitioner.
+  \param node_aware_reorder Whether to place the ranks of each node in a
+  compact brick of blocks so face neighbors are on-node wherever possible.
 */
 template <class MeshType>
 std::shared_ptr<GlobalGrid<MeshType>>
 createGlobalGrid( MPI_Comm comm,
                   const std::shared_ptr<GlobalMesh<MeshType>>& global_mesh,
                   const std::array<bool, MeshType::num_space_dim>& periodic,
-                  const BlockPartitioner<MeshType::num_space_dim>& partitioner )
+                  const BlockPartitioner<MeshType::num_space_dim>& partitioner,
+                  const bool node_aware_reorder = false )
 {
-    return std::make_shared<GlobalGrid<MeshType>>( comm, global_mesh, periodic,
-                                                   partitioner );
+    return std::make_shared<GlobalGrid<MeshType>>(
+        comm, global_mesh, periodic, partitioner, node_aware_reorder );
 }
 
 //---------------------------------------------------------------------------//
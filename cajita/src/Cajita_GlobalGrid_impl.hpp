@@ -15,6 +15,8 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <stdexcept>
+#include <vector>
 
 namespace Cajita
 {
@@ -24,7 +26,8 @@ template <class MeshType>
 GlobalGrid<MeshType>::GlobalGrid(
     MPI_Comm comm, const std::shared_ptr<GlobalMesh<MeshType>>& global_mesh,
     const std::array<bool, num_space_dim>& periodic,
-    const BlockPartitioner<num_space_dim>& partitioner )
+    const BlockPartitioner<num_space_dim>& partitioner,
+    const bool node_aware_reorder )
     : _global_mesh( global_mesh )
     , _periodic( periodic )
 {
@@ -39,10 +42,17 @@ GlobalGrid<MeshType>::GlobalGrid(
     for ( std::size_t d = 0; d < num_space_dim; ++d )
         periodic_dims[d] = _periodic[d];
 
-    // Generate a communicator with a Cartesian topology.
-    int reorder_cart_ranks = 1;
-    MPI_Cart_create( comm, num_space_dim, _ranks_per_dim.data(),
-                     periodic_dims.data(), reorder_cart_ranks, &_cart_comm );
+    // Generate a communicator with a Cartesian topology. If requested,
+    // place the ranks of each node in a compact brick of blocks so face
+    // neighbors are on-node wherever possible; otherwise let the MPI
+    // library reorder the ranks.
+    if ( !node_aware_reorder || !nodeAwareCartComm( comm, periodic_dims ) )
+    {
+        int reorder_cart_ranks = 1;
+        MPI_Cart_create( comm, num_space_dim, _ranks_per_dim.data(),
+                         periodic_dims.data(), reorder_cart_ranks,
+                         &_cart_comm );
+    }
 
     // Get the Cartesian topology index of this rank.
     int linear_rank;
@@ -86,6 +96,124 @@ GlobalGrid<MeshType>::GlobalGrid(
         _boundary_lo[d] = ( 0 == _cart_rank[d] );
         _boundary_hi[d] = ( _ranks_per_dim[d] - 1 == _cart_rank[d] );
     }
+
+    // Per-dimension sub-communicators are created on first use.
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+    {
+        _line_comm[d] = MPI_COMM_NULL;
+        _plane_comm[d] = MPI_COMM_NULL;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Create the Cartesian communicator with node-aware rank placement. The
+// ranks sharing a node are assigned a compact brick of blocks instead of a
+// row-major slab so most block faces are interior to a node and off-node
+// halo exchange only crosses the brick surface. Returns false when the
+// node layout does not tile the block decomposition, in which case the
+// caller falls back to the MPI library reordering.
+template <class MeshType>
+bool GlobalGrid<MeshType>::nodeAwareCartComm(
+    MPI_Comm comm, const std::array<int, num_space_dim>& periodic_dims )
+{
+    // Find the ranks sharing this node.
+    MPI_Comm node_comm;
+    MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                         &node_comm );
+    int node_size, node_rank;
+    MPI_Comm_size( node_comm, &node_size );
+    MPI_Comm_rank( node_comm, &node_rank );
+
+    // Node-aware blocking requires the same number of ranks on every node.
+    int min_size = node_size;
+    int max_size = node_size;
+    MPI_Allreduce( MPI_IN_PLACE, &min_size, 1, MPI_INT, MPI_MIN, comm );
+    MPI_Allreduce( MPI_IN_PLACE, &max_size, 1, MPI_INT, MPI_MAX, comm );
+    bool tiles = ( min_size == max_size );
+
+    // Factor the node size into a brick of blocks that tiles the block
+    // grid. Assigning the prime factors largest-first to the thinnest
+    // brick dimension that still divides its block count keeps the brick
+    // compact so its surface - the off-node traffic - is small.
+    std::array<int, num_space_dim> brick;
+    brick.fill( 1 );
+    if ( tiles )
+    {
+        std::vector<int> prime_factors;
+        int remainder = node_size;
+        int f = 2;
+        while ( remainder > 1 )
+        {
+            if ( 0 == remainder % f )
+            {
+                prime_factors.push_back( f );
+                remainder /= f;
+            }
+            else
+                ++f;
+        }
+        for ( auto pf = prime_factors.rbegin(); pf != prime_factors.rend();
+              ++pf )
+        {
+            int best = -1;
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+                if ( 0 == _ranks_per_dim[d] % ( brick[d] * ( *pf ) ) &&
+                     ( best < 0 || brick[d] < brick[best] ) )
+                    best = static_cast<int>( d );
+            if ( best < 0 )
+            {
+                tiles = false;
+                break;
+            }
+            brick[best] *= *pf;
+        }
+    }
+    if ( !tiles )
+    {
+        MPI_Comm_free( &node_comm );
+        return false;
+    }
+
+    // Number the nodes by the lowest global rank they contain.
+    MPI_Comm leader_comm;
+    MPI_Comm_split( comm, ( 0 == node_rank ) ? 0 : MPI_UNDEFINED, 0,
+                    &leader_comm );
+    int node_id = 0;
+    if ( 0 == node_rank )
+    {
+        MPI_Comm_rank( leader_comm, &node_id );
+        MPI_Comm_free( &leader_comm );
+    }
+    MPI_Bcast( &node_id, 1, MPI_INT, 0, node_comm );
+    MPI_Comm_free( &node_comm );
+
+    // Compute the Cartesian coordinates of this rank: the node picks the
+    // brick and the rank within the node picks the block within the brick,
+    // both in row-major order.
+    std::array<int, num_space_dim> cart_ijk;
+    int brick_id = node_id;
+    int local_id = node_rank;
+    for ( std::size_t d = num_space_dim; d > 0; --d )
+    {
+        int dim = d - 1;
+        int num_brick = _ranks_per_dim[dim] / brick[dim];
+        cart_ijk[dim] =
+            ( brick_id % num_brick ) * brick[dim] + local_id % brick[dim];
+        brick_id /= num_brick;
+        local_id /= brick[dim];
+    }
+
+    // Order the ranks by the row-major index of their coordinates so the
+    // non-reordering Cartesian create places each rank where we computed.
+    int key = 0;
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+        key = key * _ranks_per_dim[d] + cart_ijk[d];
+    MPI_Comm ordered_comm;
+    MPI_Comm_split( comm, 0, key, &ordered_comm );
+    MPI_Cart_create( ordered_comm, num_space_dim, _ranks_per_dim.data(),
+                     periodic_dims.data(), 0, &_cart_comm );
+    MPI_Comm_free( &ordered_comm );
+    return true;
 }
 
 //---------------------------------------------------------------------------//
@@ -93,6 +221,13 @@ GlobalGrid<MeshType>::GlobalGrid(
 template <class MeshType>
 GlobalGrid<MeshType>::~GlobalGrid()
 {
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+    {
+        if ( MPI_COMM_NULL != _line_comm[d] )
+            MPI_Comm_free( &_line_comm[d] );
+        if ( MPI_COMM_NULL != _plane_comm[d] )
+            MPI_Comm_free( &_plane_comm[d] );
+    }
     MPI_Comm_free( &_cart_comm );
 }
 
@@ -104,6 +239,133 @@ MPI_Comm GlobalGrid<MeshType>::comm() const
     return _cart_comm;
 }
 
+//---------------------------------------------------------------------------//
+// Get the communicator over this block's line in a given dimension.
+template <class MeshType>
+MPI_Comm GlobalGrid<MeshType>::lineComm( const int dim ) const
+{
+    if ( MPI_COMM_NULL == _line_comm[dim] )
+    {
+        // Keep only the given dimension of the Cartesian topology. The
+        // sub-communicator preserves the Cartesian ordering so the rank of
+        // each block is its block id in the dimension.
+        std::array<int, num_space_dim> remain_dims;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+            remain_dims[d] = ( static_cast<int>( d ) == dim ) ? 1 : 0;
+        MPI_Cart_sub( _cart_comm, remain_dims.data(), &_line_comm[dim] );
+    }
+    return _line_comm[dim];
+}
+
+//---------------------------------------------------------------------------//
+// Get the communicator over this block's plane orthogonal to a given
+// dimension.
+template <class MeshType>
+MPI_Comm GlobalGrid<MeshType>::planeComm( const int dim ) const
+{
+    if ( MPI_COMM_NULL == _plane_comm[dim] )
+    {
+        // Drop only the given dimension of the Cartesian topology.
+        std::array<int, num_space_dim> remain_dims;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+            remain_dims[d] = ( static_cast<int>( d ) == dim ) ? 0 : 1;
+        MPI_Cart_sub( _cart_comm, remain_dims.data(), &_plane_comm[dim] );
+    }
+    return _plane_comm[dim];
+}
+
+//---------------------------------------------------------------------------//
+// Exchange variable-size blocks of bytes over a cached sub-communicator.
+template <class MeshType>
+void GlobalGrid<MeshType>::subCommExchange(
+    MPI_Comm sub_comm, const void* send_data,
+    const std::vector<int>& send_bytes, void* recv_data,
+    const std::vector<int>& recv_bytes ) const
+{
+    int sub_size;
+    MPI_Comm_size( sub_comm, &sub_size );
+    if ( send_bytes.size() != static_cast<std::size_t>( sub_size ) ||
+         recv_bytes.size() != static_cast<std::size_t>( sub_size ) )
+        throw std::runtime_error(
+            "Exchange counts do not match the sub-communicator size" );
+
+    // Compute the displacements as exclusive prefix sums of the counts.
+    std::vector<int> send_displs( sub_size );
+    std::vector<int> recv_displs( sub_size );
+    int send_offset = 0;
+    int recv_offset = 0;
+    for ( int r = 0; r < sub_size; ++r )
+    {
+        send_displs[r] = send_offset;
+        recv_displs[r] = recv_offset;
+        send_offset += send_bytes[r];
+        recv_offset += recv_bytes[r];
+    }
+
+    const int ec = MPI_Alltoallv( send_data, send_bytes.data(),
+                                  send_displs.data(), MPI_BYTE, recv_data,
+                                  recv_bytes.data(), recv_displs.data(),
+                                  MPI_BYTE, sub_comm );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+}
+
+//---------------------------------------------------------------------------//
+// Exchange equal-size blocks of bytes among the blocks of this block's line
+// in a given dimension.
+template <class MeshType>
+void GlobalGrid<MeshType>::lineExchange( const int dim, const void* send_data,
+                                         void* recv_data,
+                                         const std::size_t block_bytes ) const
+{
+    const int ec = MPI_Alltoall( send_data, static_cast<int>( block_bytes ),
+                                 MPI_BYTE, recv_data,
+                                 static_cast<int>( block_bytes ), MPI_BYTE,
+                                 lineComm( dim ) );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+}
+
+//---------------------------------------------------------------------------//
+// Exchange variable-size blocks of bytes among the blocks of this block's
+// line in a given dimension.
+template <class MeshType>
+void GlobalGrid<MeshType>::lineExchange(
+    const int dim, const void* send_data, const std::vector<int>& send_bytes,
+    void* recv_data, const std::vector<int>& recv_bytes ) const
+{
+    subCommExchange( lineComm( dim ), send_data, send_bytes, recv_data,
+                     recv_bytes );
+}
+
+//---------------------------------------------------------------------------//
+// Exchange equal-size blocks of bytes among the blocks of this block's
+// plane orthogonal to a given dimension.
+template <class MeshType>
+void GlobalGrid<MeshType>::planeExchange(
+    const int dim, const void* send_data, void* recv_data,
+    const std::size_t block_bytes ) const
+{
+    const int ec = MPI_Alltoall( send_data, static_cast<int>( block_bytes ),
+                                 MPI_BYTE, recv_data,
+                                 static_cast<int>( block_bytes ), MPI_BYTE,
+                                 planeComm( dim ) );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+}
+
+//---------------------------------------------------------------------------//
+// Exchange variable-size blocks of bytes among the blocks of this block's
+// plane orthogonal to a given dimension.
+template <class MeshType>
+void GlobalGrid<MeshType>::planeExchange(
+    const int dim, const void* send_data, const std::vector<int>& send_bytes,
+    void* recv_data, const std::vector<int>& recv_bytes ) const
+{
+    subCommExchange( planeComm( dim ), send_data, send_bytes, recv_data,
+                     recv_bytes );
+}
+
 //---------------------------------------------------------------------------//
 // Get the global mesh data.
 template <class MeshType>
@@ -319,6 +581,36 @@ int GlobalGrid<MeshType>::globalOffset( const int dim ) const
     return _global_cell_offset[dim];
 }
 
+//---------------------------------------------------------------------------//
+// Reassign the cells owned by each block from rectilinear partition
+// boundaries.
+template <class MeshType>
+void GlobalGrid<MeshType>::setOwnedCells(
+    const std::array<std::vector<int>, num_space_dim>& cell_boundaries )
+{
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+    {
+        if ( static_cast<int>( cell_boundaries[d].size() ) !=
+             _ranks_per_dim[d] + 1 )
+            throw std::runtime_error(
+                "Cell boundary count does not match the block grid" );
+        if ( 0 != cell_boundaries[d].front() ||
+             _global_mesh->globalNumCell( d ) != cell_boundaries[d].back() )
+            throw std::runtime_error(
+                "Cell boundaries must span the global cells" );
+        for ( int r = 0; r < _ranks_per_dim[d]; ++r )
+            if ( cell_boundaries[d][r + 1] <= cell_boundaries[d][r] )
+                throw std::runtime_error(
+                    "Cell boundaries must be increasing" );
+    }
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+    {
+        _global_cell_offset[d] = cell_boundaries[d][_cart_rank[d]];
+        _owned_num_cell[d] = cell_boundaries[d][_cart_rank[d] + 1] -
+                             cell_boundaries[d][_cart_rank[d]];
+    }
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cajita
@@ -20,6 +20,7 @@
 #include <Cajita_IndexSpace.hpp>
 
 #include <Cabana_ParameterPack.hpp>
+#include <Cabana_PinnedBufferPool.hpp>
 
 #include <Kokkos_Core.hpp>
 
@@ -28,6 +29,8 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <functional>
+#include <memory>
 #include <type_traits>
 #include <vector>
 
@@ -185,6 +188,171 @@ struct Replace
 
 } // end namespace ScatterReduce
 
+//---------------------------------------------------------------------------//
+// Wire precision.
+//---------------------------------------------------------------------------//
+/*!
+  View wrapper marking the wire type used when packing an array for
+  communication. Elements are converted to the wire type on the device when
+  packed and converted back when unpacked.
+*/
+template <class WireType, class ViewType>
+struct ReducedPrecisionView
+{
+    //! Array value type.
+    using value_type = typename ViewType::value_type;
+    //! Scalar type transmitted over the wire.
+    using wire_type = WireType;
+    //! View rank.
+    static constexpr std::size_t rank = ViewType::rank;
+    //! The underlying array view.
+    ViewType view;
+    //! Access an array element.
+    template <class... IndexTypes>
+    KOKKOS_FORCEINLINE_FUNCTION typename ViewType::reference_type
+    operator()( IndexTypes... indices ) const
+    {
+        return view( indices... );
+    }
+};
+
+//! \cond Impl
+// Scalar type an array view transmits over the wire. Views communicate
+// their value type unless they carry an explicit wire type.
+template <class ArrayView>
+struct HaloWireType
+{
+    using type = typename ArrayView::value_type;
+};
+
+template <class WireType, class ViewType>
+struct HaloWireType<ReducedPrecisionView<WireType, ViewType>>
+{
+    using type = WireType;
+};
+//! \endcond
+
+/*!
+  Array adapter that communicates halo data in a reduced-precision wire
+  type. The halo buffers are sized for the wire type and pack/unpack convert
+  on the device, so only the truncated representation crosses the wire
+  (e.g. a double field communicated as float moves half the bytes). The
+  conversion is lossy - use this only for fields where the discarded
+  precision is numerically irrelevant to the receiving side.
+*/
+template <class WireType, class Array_t>
+struct ReducedPrecisionArray
+{
+    //! Scalar type transmitted over the wire. Buffers are sized with this
+    //! type.
+    using value_type = WireType;
+    //! Kokkos memory space.
+    using memory_space = typename Array_t::memory_space;
+    //! The array being communicated.
+    const Array_t& array;
+    //! Get the array layout.
+    auto layout() const { return array.layout(); }
+    //! Get a wire-type-tagged view of the array data.
+    ReducedPrecisionView<WireType, typename Array_t::view_type> view() const
+    {
+        return { array.view() };
+    }
+};
+
+/*!
+  \brief Communicate an array with a reduced-precision wire type.
+
+  Wrap an array before giving it to createHalo and to gather/scatter to
+  transmit it in the given wire type. Each field wrapped independently gives
+  a per-field precision knob:
+
+  \code
+    auto halo = createHalo( pattern, width,
+                            createReducedPrecision<float>( *density ),
+                            *velocity );
+    halo->gather( exec_space, createReducedPrecision<float>( *density ),
+                  *velocity );
+  \endcode
+
+  \tparam WireType The scalar type to transmit. Array values are converted
+  to this type on pack and back to the array value type on unpack.
+  \param array The array to wrap.
+*/
+template <class WireType, class Array_t>
+ReducedPrecisionArray<WireType, Array_t>
+createReducedPrecision( const Array_t& array )
+{
+    return ReducedPrecisionArray<WireType, Array_t>{ array };
+}
+
+//---------------------------------------------------------------------------//
+// Halo request.
+//---------------------------------------------------------------------------//
+/*!
+  Waitable handle to an asynchronous halo gather or scatter.
+
+  The handle owns the MPI requests of the exchange and the work of unpacking
+  the receive buffers. Work that does not depend on the communicated data
+  (e.g. stencil updates on interior entities) may be performed between
+  starting the exchange and waiting on the handle to overlap communication
+  with computation. The handle must be waited on before the communicated
+  data is accessed or another exchange is started on the same halo.
+*/
+class HaloRequest
+{
+  public:
+    //! Default constructor. A default constructed request is complete.
+    HaloRequest() = default;
+
+    //! \cond Impl
+    HaloRequest( std::function<void()>&& complete_func )
+        : _complete_func( std::move( complete_func ) )
+    {
+    }
+    //! \endcond
+
+    //! Destructor. Completes the exchange if it has not been waited on.
+    ~HaloRequest() { wait(); }
+
+    //! Requests are move-only - a copy would complete the same exchange
+    //! twice.
+    HaloRequest( const HaloRequest& ) = delete;
+    //! Requests are move-only.
+    HaloRequest& operator=( const HaloRequest& ) = delete;
+    //! Move constructor.
+    HaloRequest( HaloRequest&& rhs )
+        : _complete_func( std::move( rhs._complete_func ) )
+    {
+        rhs._complete_func = nullptr;
+    }
+    //! Move assignment. Completes any exchange this handle already owns.
+    HaloRequest& operator=( HaloRequest&& rhs )
+    {
+        wait();
+        _complete_func = std::move( rhs._complete_func );
+        rhs._complete_func = nullptr;
+        return *this;
+    }
+
+    /*!
+      \brief Complete the exchange.
+
+      Waits on the communication and unpacks the receive buffers. Calling
+      wait on a completed request is a no-op.
+    */
+    void wait()
+    {
+        if ( _complete_func )
+        {
+            _complete_func();
+            _complete_func = nullptr;
+        }
+    }
+
+  private:
+    std::function<void()> _complete_func;
+};
+
 //---------------------------------------------------------------------------//
 // Halo
 // ---------------------------------------------------------------------------//
@@ -197,6 +365,19 @@ struct Replace
   be defined on the same local grid meaning they that share the same
   communicator and halo size. The arrays must also reside in the same memory
   space. These requirements are checked at construction.
+
+  All arrays given to the halo are aggregated into a single buffer per
+  neighbor so a gather or scatter sends exactly one message to each neighbor
+  regardless of the number of arrays. Exchanging several fields through one
+  halo is therefore preferable to creating a halo per field when message
+  latency dominates (e.g. many small fields at strong-scaling limits).
+
+  Within a rank the per-neighbor buffers are segments of a single pool and
+  each exchange packs and unpacks the segments of all neighbors with one
+  kernel launch per direction, so the kernel launch count per exchange is
+  independent of the number of neighbors. With node connectivity most
+  segments are tiny (edges and corners especially) and separate per-neighbor
+  kernels would be dominated by launch latency.
 */
 template <class MemorySpace>
 class Halo
@@ -244,6 +425,14 @@ class Halo
             return flip_ijk;
         };
 
+        // Per-neighbor buffer sizes and steering vectors. These are fused
+        // into a single buffer pool and steering vector per exchange
+        // direction once all neighbors are known.
+        std::vector<int> owned_buffer_bytes;
+        std::vector<int> ghosted_buffer_bytes;
+        std::vector<Kokkos::View<int**, memory_space>> owned_steering;
+        std::vector<Kokkos::View<int**, memory_space>> ghosted_steering;
+
         // Get the neighbor ranks we will exchange with in the halo and
         // allocate buffers. If any of the exchanges are self sends mark these
         // so we know which send buffers correspond to which receive buffers.
@@ -268,18 +457,64 @@ class Halo
                 _receive_tags.push_back( neighbor_id( flip_id( n ) ) );
 
                 // Create communication data for owned entities.
-                buildCommData( Own(), width, n, _owned_buffers, _owned_steering,
-                               arrays... );
+                buildCommData( Own(), width, n, owned_buffer_bytes,
+                               owned_steering, arrays... );
 
                 // Create communication data for ghosted entities.
-                buildCommData( Ghost(), width, n, _ghosted_buffers,
-                               _ghosted_steering, arrays... );
+                buildCommData( Ghost(), width, n, ghosted_buffer_bytes,
+                               ghosted_steering, arrays... );
             }
         }
+
+        // Allocate a buffer pool per exchange direction holding the
+        // segments of all neighbors and fuse the per-neighbor steering
+        // vectors over the pools so every exchange packs and unpacks with
+        // one kernel launch per direction.
+        fuseCommData( owned_buffer_bytes, owned_steering, _owned_buffer_pool,
+                      _owned_buffers, _owned_steering );
+        fuseCommData( ghosted_buffer_bytes, ghosted_steering,
+                      _ghosted_buffer_pool, _ghosted_buffers,
+                      _ghosted_steering );
+
+        // Pass the device buffers directly to MPI if they are host
+        // accessible or the MPI library is GPU-aware. Otherwise allocate
+        // pinned host staging copies of the buffer pools. The buffers are
+        // fixed for the life of the halo so the pages are pinned once here
+        // and reused by every exchange.
+        _device_direct =
+            Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                       memory_space>::accessible ||
+            Cabana::Impl::gpuAwareMpiSupported();
+        if ( !_device_direct )
+        {
+            _owned_stage = Kokkos::View<char*, Cabana::PinnedHostSpace>(
+                Kokkos::ViewAllocateWithoutInitializing( "halo_owned_stage" ),
+                _owned_buffer_pool.size() );
+            _ghosted_stage = Kokkos::View<char*, Cabana::PinnedHostSpace>(
+                Kokkos::ViewAllocateWithoutInitializing(
+                    "halo_ghosted_stage" ),
+                _ghosted_buffer_pool.size() );
+        }
+
+        // The pattern and buffers are fixed for the life of the halo so bind
+        // them to persistent communication requests created once here and
+        // started on each exchange.
+        initPersistentRequests();
     }
 
     // Destructor.
-    ~Halo() { MPI_Comm_free( &_comm ); }
+    ~Halo()
+    {
+        // Free the persistent requests before the communicator.
+        for ( auto& request : _gather_requests )
+            if ( MPI_REQUEST_NULL != request )
+                MPI_Request_free( &request );
+        for ( auto& request : _scatter_requests )
+            if ( MPI_REQUEST_NULL != request )
+                MPI_Request_free( &request );
+
+        MPI_Comm_free( &_comm );
+    }
 
     /*!
       \brief Gather data into our ghosts from their owners.
@@ -295,76 +530,86 @@ class Halo
     void gather( const ExecutionSpace& exec_space,
                  const ArrayTypes&... arrays ) const
     {
-        // Get the number of neighbors. Return if we have none.
-        int num_n = _neighbor_ranks.size();
-        if ( 0 == num_n )
-            return;
+        gatherAsync( exec_space, arrays... ).wait();
+    }
 
-        // Allocate requests.
-        std::vector<MPI_Request> requests( 2 * num_n, MPI_REQUEST_NULL );
+    /*!
+      \brief Asynchronously gather data into our ghosts from their owners.
 
-        // Pick a tag to use for communication. This object has its own
-        // communication space so any tag will do.
-        const int mpi_tag = 1234;
+      Packs the send buffers and posts all communication but defers waiting
+      on the receives and unpacking them to the returned request. Kernels
+      that do not read the ghosted data may be launched between this call
+      and waiting on the request to overlap the halo exchange with
+      computation.
+
+      \param exec_space The execution space to use for pack/unpack.
+
+      \param arrays The arrays to gather. NOTE: These arrays must be given in
+      the same order as in the constructor. These could technically be
+      different arrays, they just need to have the same layouts and data types
+      as the input arrays.
 
-        // Post receives.
+      \return A waitable request that completes the gather.
+    */
+    template <class ExecutionSpace, class... ArrayTypes>
+    HaloRequest gatherAsync( const ExecutionSpace& exec_space,
+                             const ArrayTypes&... arrays ) const
+    {
+        // Get the number of neighbors. Return a completed request if we have
+        // none.
+        int num_n = _neighbor_ranks.size();
+        if ( 0 == num_n )
+            return HaloRequest();
+
+        // Start the persistent receives.
         for ( int n = 0; n < num_n; ++n )
         {
             // Only process this neighbor if there is work to do.
-            if ( 0 < _ghosted_buffers[n].size() )
-            {
-                MPI_Irecv( _ghosted_buffers[n].data(),
-                           _ghosted_buffers[n].size(), MPI_BYTE,
-                           _neighbor_ranks[n], mpi_tag + _receive_tags[n],
-                           _comm, &requests[n] );
-            }
+            if ( MPI_REQUEST_NULL != _gather_requests[n] )
+                MPI_Start( &_gather_requests[n] );
         }
 
-        // Pack send buffers and post sends.
-        for ( int n = 0; n < num_n; ++n )
+        // Pack the segments of all neighbors with a single kernel launch
+        // and then start the persistent sends.
+        if ( 0 < _owned_steering.extent( 0 ) )
+            packBuffer( exec_space, _owned_buffer_pool, _owned_steering,
+                        arrays.view()... );
+
+        // Stage the packed segments into the pinned host copy when the MPI
+        // library cannot access device allocations. The persistent sends
+        // are bound to the staging copy.
+        if ( !_device_direct && 0 < _owned_buffer_pool.size() )
         {
-            // Only process this neighbor if there is work to do.
-            if ( 0 < _owned_buffers[n].size() )
-            {
-                // Pack the send buffer.
-                packBuffer( exec_space, _owned_buffers[n], _owned_steering[n],
-                            arrays.view()... );
-
-                // Post a send.
-                MPI_Isend( _owned_buffers[n].data(), _owned_buffers[n].size(),
-                           MPI_BYTE, _neighbor_ranks[n],
-                           mpi_tag + _send_tags[n], _comm,
-                           &requests[num_n + n] );
-            }
+            Kokkos::deep_copy( exec_space, _owned_stage, _owned_buffer_pool );
+            exec_space.fence();
         }
 
-        // Unpack receive buffers.
-        bool unpack_complete = false;
-        while ( !unpack_complete )
+        for ( int n = 0; n < num_n; ++n )
         {
-            // Get the next buffer to unpack.
-            int unpack_index = MPI_UNDEFINED;
-            MPI_Waitany( num_n, requests.data(), &unpack_index,
-                         MPI_STATUS_IGNORE );
-
-            // If there are no more buffers to unpack we are done.
-            if ( MPI_UNDEFINED == unpack_index )
-            {
-                unpack_complete = true;
-            }
+            // Only process this neighbor if there is work to do.
+            if ( MPI_REQUEST_NULL != _gather_requests[num_n + n] )
+                MPI_Start( &_gather_requests[num_n + n] );
+        }
 
-            // Otherwise unpack the next buffer.
-            else
-            {
+        // Defer waiting on the receives and unpacking them to the returned
+        // request. Completed persistent requests become inactive and may be
+        // started again on the next exchange.
+        return HaloRequest( [=]() {
+            // Wait for all messages to arrive and unpack the segments of
+            // all neighbors with a single kernel launch.
+            MPI_Waitall( num_n, _gather_requests.data(), MPI_STATUSES_IGNORE );
+            if ( !_device_direct && 0 < _ghosted_buffer_pool.size() )
+                Kokkos::deep_copy( exec_space, _ghosted_buffer_pool,
+                                   _ghosted_stage );
+            if ( 0 < _ghosted_steering.extent( 0 ) )
                 unpackBuffer( ScatterReduce::Replace(), exec_space,
-                              _ghosted_buffers[unpack_index],
-                              _ghosted_steering[unpack_index],
+                              _ghosted_buffer_pool, _ghosted_steering,
                               arrays.view()... );
-            }
-        }
 
-        // Wait on send requests.
-        MPI_Waitall( num_n, requests.data() + num_n, MPI_STATUSES_IGNORE );
+            // Wait on send requests.
+            MPI_Waitall( num_n, _gather_requests.data() + num_n,
+                         MPI_STATUSES_IGNORE );
+        } );
     }
 
     /*!
@@ -378,74 +623,85 @@ class Halo
     void scatter( const ExecutionSpace& exec_space, const ReduceOp& reduce_op,
                   const ArrayTypes&... arrays ) const
     {
-        // Get the number of neighbors. Return if we have none.
-        int num_n = _neighbor_ranks.size();
-        if ( 0 == num_n )
-            return;
+        scatterAsync( exec_space, reduce_op, arrays... ).wait();
+    }
 
-        // Requests.
-        std::vector<MPI_Request> requests( 2 * num_n, MPI_REQUEST_NULL );
+    /*!
+      \brief Asynchronously scatter data from our ghosts to their owners
+      using the given type of reduce operation.
+
+      Packs the send buffers and posts all communication but defers waiting
+      on the receives and reducing them to the returned request. Kernels
+      that do not touch the scattered data may be launched between this call
+      and waiting on the request to overlap the halo exchange with
+      computation.
 
-        // Pick a tag to use for communication. This object has its own
-        // communication space so any tag will do.
-        const int mpi_tag = 2345;
+      \param exec_space The execution space to use for pack/unpack.
+      \param reduce_op The functor used to reduce the results.
+      \param arrays The arrays to scatter.
+      \return A waitable request that completes the scatter.
+    */
+    template <class ExecutionSpace, class ReduceOp, class... ArrayTypes>
+    HaloRequest scatterAsync( const ExecutionSpace& exec_space,
+                              const ReduceOp& reduce_op,
+                              const ArrayTypes&... arrays ) const
+    {
+        // Get the number of neighbors. Return a completed request if we have
+        // none.
+        int num_n = _neighbor_ranks.size();
+        if ( 0 == num_n )
+            return HaloRequest();
 
-        // Post receives for all neighbors that are not self sends.
+        // Start the persistent receives.
         for ( int n = 0; n < num_n; ++n )
         {
             // Only process this neighbor if there is work to do.
-            if ( 0 < _owned_buffers[n].size() )
-            {
-                MPI_Irecv( _owned_buffers[n].data(), _owned_buffers[n].size(),
-                           MPI_BYTE, _neighbor_ranks[n],
-                           mpi_tag + _receive_tags[n], _comm, &requests[n] );
-            }
+            if ( MPI_REQUEST_NULL != _scatter_requests[n] )
+                MPI_Start( &_scatter_requests[n] );
         }
 
-        // Pack send buffers and post sends.
-        for ( int n = 0; n < num_n; ++n )
+        // Pack the segments of all neighbors with a single kernel launch
+        // and then start the persistent sends.
+        if ( 0 < _ghosted_steering.extent( 0 ) )
+            packBuffer( exec_space, _ghosted_buffer_pool, _ghosted_steering,
+                        arrays.view()... );
+
+        // Stage the packed segments into the pinned host copy when the MPI
+        // library cannot access device allocations. The persistent sends
+        // are bound to the staging copy.
+        if ( !_device_direct && 0 < _ghosted_buffer_pool.size() )
         {
-            // Only process this neighbor if there is work to do.
-            if ( 0 < _ghosted_buffers[n].size() )
-            {
-                // Pack the send buffer.
-                packBuffer( exec_space, _ghosted_buffers[n],
-                            _ghosted_steering[n], arrays.view()... );
-
-                // Post a send.
-                MPI_Isend( _ghosted_buffers[n].data(),
-                           _ghosted_buffers[n].size(), MPI_BYTE,
-                           _neighbor_ranks[n], mpi_tag + _send_tags[n], _comm,
-                           &requests[num_n + n] );
-            }
+            Kokkos::deep_copy( exec_space, _ghosted_stage,
+                               _ghosted_buffer_pool );
+            exec_space.fence();
         }
 
-        // Unpack receive buffers.
-        bool unpack_complete = false;
-        while ( !unpack_complete )
+        for ( int n = 0; n < num_n; ++n )
         {
-            // Get the next buffer to unpack.
-            int unpack_index = MPI_UNDEFINED;
-            MPI_Waitany( num_n, requests.data(), &unpack_index,
-                         MPI_STATUS_IGNORE );
-
-            // If there are no more buffers to unpack we are done.
-            if ( MPI_UNDEFINED == unpack_index )
-            {
-                unpack_complete = true;
-            }
+            // Only process this neighbor if there is work to do.
+            if ( MPI_REQUEST_NULL != _scatter_requests[num_n + n] )
+                MPI_Start( &_scatter_requests[num_n + n] );
+        }
 
-            // Otherwise unpack the next buffer and apply the reduce operation.
-            else
-            {
-                unpackBuffer( reduce_op, exec_space,
-                              _owned_buffers[unpack_index],
-                              _owned_steering[unpack_index], arrays.view()... );
-            }
+        // Defer waiting on the receives and reducing them to the returned
+        // request. Completed persistent requests become inactive and may be
+        // started again on the next exchange.
+        return HaloRequest( [=]() {
+            // Wait for all messages to arrive and reduce the segments of
+            // all neighbors with a single kernel launch.
+            MPI_Waitall( num_n, _scatter_requests.data(),
+                         MPI_STATUSES_IGNORE );
+            if ( !_device_direct && 0 < _owned_buffer_pool.size() )
+                Kokkos::deep_copy( exec_space, _owned_buffer_pool,
+                                   _owned_stage );
+            if ( 0 < _owned_steering.extent( 0 ) )
+                unpackBuffer( reduce_op, exec_space, _owned_buffer_pool,
+                              _owned_steering, arrays.view()... );
 
             // Wait on send requests.
-            MPI_Waitall( num_n, requests.data() + num_n, MPI_STATUSES_IGNORE );
-        }
+            MPI_Waitall( num_n, _scatter_requests.data() + num_n,
+                         MPI_STATUSES_IGNORE );
+        } );
     }
 
   public:
@@ -500,13 +756,85 @@ class Halo
         return local_grid;
     }
 
+    //! Create persistent communication requests bound to the halo buffers.
+    //! The buffers are allocated once at construction and reused for every
+    //! exchange so the message envelopes never change - binding them to
+    //! persistent requests moves the per-exchange request setup cost to
+    //! construction time.
+    void initPersistentRequests()
+    {
+        int num_n = _neighbor_ranks.size();
+        _gather_requests.assign( 2 * num_n, MPI_REQUEST_NULL );
+        _scatter_requests.assign( 2 * num_n, MPI_REQUEST_NULL );
+
+        // Pick tags to use for communication. This object has its own
+        // communication space so any tags will do as long as the two
+        // exchange directions do not collide.
+        const int gather_tag = 1234;
+        const int scatter_tag = 2345;
+
+        // In staging mode the messages are received into and sent from the
+        // pinned host copies of the buffer segments.
+        auto owned_data = [&]( const int n ) {
+            return _device_direct ? _owned_buffers[n].data()
+                                  : _owned_stage.data() +
+                                        ( _owned_buffers[n].data() -
+                                          _owned_buffer_pool.data() );
+        };
+        auto ghosted_data = [&]( const int n ) {
+            return _device_direct ? _ghosted_buffers[n].data()
+                                  : _ghosted_stage.data() +
+                                        ( _ghosted_buffers[n].data() -
+                                          _ghosted_buffer_pool.data() );
+        };
+
+        for ( int n = 0; n < num_n; ++n )
+        {
+            // Gathers receive into the ghosted buffers and send from the
+            // owned buffers. Only create requests where there is work to
+            // do.
+            if ( 0 < _ghosted_buffers[n].size() )
+            {
+                MPI_Recv_init( ghosted_data( n ),
+                               _ghosted_buffers[n].size(), MPI_BYTE,
+                               _neighbor_ranks[n],
+                               gather_tag + _receive_tags[n], _comm,
+                               &_gather_requests[n] );
+            }
+            if ( 0 < _owned_buffers[n].size() )
+            {
+                MPI_Send_init( owned_data( n ), _owned_buffers[n].size(),
+                               MPI_BYTE, _neighbor_ranks[n],
+                               gather_tag + _send_tags[n], _comm,
+                               &_gather_requests[num_n + n] );
+            }
+
+            // Scatters receive into the owned buffers and send from the
+            // ghosted buffers.
+            if ( 0 < _owned_buffers[n].size() )
+            {
+                MPI_Recv_init( owned_data( n ), _owned_buffers[n].size(),
+                               MPI_BYTE, _neighbor_ranks[n],
+                               scatter_tag + _receive_tags[n], _comm,
+                               &_scatter_requests[n] );
+            }
+            if ( 0 < _ghosted_buffers[n].size() )
+            {
+                MPI_Send_init( ghosted_data( n ),
+                               _ghosted_buffers[n].size(), MPI_BYTE,
+                               _neighbor_ranks[n], scatter_tag + _send_tags[n],
+                               _comm, &_scatter_requests[num_n + n] );
+            }
+        }
+    }
+
     //! Build communication data.
     template <class DecompositionTag, std::size_t NumSpaceDim,
               class... ArrayTypes>
     void
     buildCommData( DecompositionTag decomposition_tag, const int width,
                    const std::array<int, NumSpaceDim>& nid,
-                   std::vector<Kokkos::View<char*, memory_space>>& buffers,
+                   std::vector<int>& buffer_bytes_list,
                    std::vector<Kokkos::View<int**, memory_space>>& steering,
                    const ArrayTypes&... arrays )
     {
@@ -533,10 +861,10 @@ class Halo
             buffer_num_element += spaces[a].size();
         }
 
-        // Allocate the buffer of data that we share with this neighbor. All
-        // arrays will be packed into a single buffer.
-        buffers.push_back(
-            Kokkos::View<char*, memory_space>( "halo_buffer", buffer_bytes ) );
+        // Record the size of the data we share with this neighbor. All
+        // arrays will be packed into a single contiguous segment of the
+        // buffer pool allocated in fuseCommData.
+        buffer_bytes_list.push_back( buffer_bytes );
 
         // Allocate the steering vector for building the buffer.
         steering.push_back( Kokkos::View<int**, memory_space>(
@@ -666,37 +994,103 @@ class Halo
         Kokkos::deep_copy( steering.back(), host_steering );
     }
 
+    //! Fuse per-neighbor communication data. The buffer of each neighbor
+    //! becomes a contiguous segment of a single pool allocation and the
+    //! per-neighbor steering vectors are concatenated with their byte
+    //! locations shifted to pool offsets. Pack and unpack then traverse the
+    //! segments of all neighbors in one kernel launch while MPI still sends
+    //! and receives each neighbor's segment separately.
+    void fuseCommData(
+        const std::vector<int>& buffer_bytes_list,
+        const std::vector<Kokkos::View<int**, memory_space>>& steering,
+        Kokkos::View<char*, memory_space>& pool,
+        std::vector<Kokkos::View<char*, memory_space>>& buffers,
+        Kokkos::View<int**, memory_space>& fused_steering )
+    {
+        // Compute the pool size and the fused element count.
+        const int num_n = buffer_bytes_list.size();
+        int total_bytes = 0;
+        int total_elements = 0;
+        std::size_t num_column = 0;
+        for ( int n = 0; n < num_n; ++n )
+        {
+            total_bytes += buffer_bytes_list[n];
+            total_elements += steering[n].extent( 0 );
+            num_column = steering[n].extent( 1 );
+        }
+
+        // Allocate the pool and the fused steering vector.
+        pool = Kokkos::View<char*, memory_space>( "halo_buffer_pool",
+                                                  total_bytes );
+        fused_steering = Kokkos::View<int**, memory_space>(
+            "fused_steering", total_elements, num_column );
+
+        // Give each neighbor its segment of the pool and concatenate its
+        // steering vector with byte locations shifted into the pool.
+        auto host_steering =
+            Kokkos::create_mirror_view( Kokkos::HostSpace(), fused_steering );
+        int byte_offset = 0;
+        int elem_offset = 0;
+        for ( int n = 0; n < num_n; ++n )
+        {
+            buffers.push_back( Kokkos::subview(
+                pool, Kokkos::pair<int, int>(
+                          byte_offset, byte_offset + buffer_bytes_list[n] ) ) );
+
+            auto neighbor_steering = Kokkos::create_mirror_view_and_copy(
+                Kokkos::HostSpace(), steering[n] );
+            for ( std::size_t e = 0; e < neighbor_steering.extent( 0 ); ++e )
+            {
+                host_steering( elem_offset + e, 0 ) =
+                    byte_offset + neighbor_steering( e, 0 );
+                for ( std::size_t c = 1; c < num_column; ++c )
+                    host_steering( elem_offset + e, c ) =
+                        neighbor_steering( e, c );
+            }
+
+            byte_offset += buffer_bytes_list[n];
+            elem_offset += steering[n].extent( 0 );
+        }
+
+        // Copy the fused steering vector to device.
+        Kokkos::deep_copy( fused_steering, host_steering );
+    }
+
     //! Pack an element into the buffer. Pack by bytes to avoid casting across
-    //! alignment boundaries.
+    //! alignment boundaries. The element is converted to the wire type of
+    //! the view before its bytes are copied.
     template <class ArrayView>
     KOKKOS_INLINE_FUNCTION static std::enable_if_t<4 == ArrayView::rank, void>
     packElement( const Kokkos::View<char*, memory_space>& buffer,
                  const Kokkos::View<int**, memory_space>& steering,
                  const int element_idx, const ArrayView& array_view )
     {
-        const char* elem_ptr = reinterpret_cast<const char*>( &array_view(
+        using wire_type = typename HaloWireType<ArrayView>::type;
+        const wire_type elem = static_cast<wire_type>( array_view(
             steering( element_idx, 2 ), steering( element_idx, 3 ),
             steering( element_idx, 4 ), steering( element_idx, 5 ) ) );
-        for ( std::size_t b = 0; b < sizeof( typename ArrayView::value_type );
-              ++b )
+        const char* elem_ptr = reinterpret_cast<const char*>( &elem );
+        for ( std::size_t b = 0; b < sizeof( wire_type ); ++b )
         {
             buffer( steering( element_idx, 0 ) + b ) = *( elem_ptr + b );
         }
     }
 
     //! Pack an element into the buffer. Pack by bytes to avoid casting across
-    //! alignment boundaries.
+    //! alignment boundaries. The element is converted to the wire type of
+    //! the view before its bytes are copied.
     template <class ArrayView>
     KOKKOS_INLINE_FUNCTION static std::enable_if_t<3 == ArrayView::rank, void>
     packElement( const Kokkos::View<char*, memory_space>& buffer,
                  const Kokkos::View<int**, memory_space>& steering,
                  const int element_idx, const ArrayView& array_view )
     {
-        const char* elem_ptr = reinterpret_cast<const char*>(
-            &array_view( steering( element_idx, 2 ), steering( element_idx, 3 ),
-                         steering( element_idx, 4 ) ) );
-        for ( std::size_t b = 0; b < sizeof( typename ArrayView::value_type );
-              ++b )
+        using wire_type = typename HaloWireType<ArrayView>::type;
+        const wire_type elem = static_cast<wire_type>(
+            array_view( steering( element_idx, 2 ), steering( element_idx, 3 ),
+                        steering( element_idx, 4 ) ) );
+        const char* elem_ptr = reinterpret_cast<const char*>( &elem );
+        for ( std::size_t b = 0; b < sizeof( wire_type ); ++b )
         {
             buffer( steering( element_idx, 0 ) + b ) = *( elem_ptr + b );
         }
@@ -761,12 +1155,15 @@ class Halo
         exec_space.fence();
     }
 
-    //! Reduce an element into the buffer. Sum reduction.
+    //! Reduce an element into the buffer. Sum reduction. The fused unpack
+    //! combines the contributions of all neighbors in one kernel and
+    //! entities on block edges and corners are shared by several neighbors,
+    //! so combining reductions must be atomic.
     template <class T>
     KOKKOS_INLINE_FUNCTION static void
     unpackOp( ScatterReduce::Sum, const T& buffer_val, T& array_val )
     {
-        array_val += buffer_val;
+        Kokkos::atomic_add( &array_val, buffer_val );
     }
 
     //! Reduce an element into the buffer. Min reduction.
@@ -774,8 +1171,7 @@ class Halo
     KOKKOS_INLINE_FUNCTION static void
     unpackOp( ScatterReduce::Min, const T& buffer_val, T& array_val )
     {
-        if ( buffer_val < array_val )
-            array_val = buffer_val;
+        Kokkos::atomic_fetch_min( &array_val, buffer_val );
     }
 
     //! Reduce an element into the buffer. Max reduction.
@@ -783,11 +1179,12 @@ class Halo
     KOKKOS_INLINE_FUNCTION static void
     unpackOp( ScatterReduce::Max, const T& buffer_val, T& array_val )
     {
-        if ( buffer_val > array_val )
-            array_val = buffer_val;
+        Kokkos::atomic_fetch_max( &array_val, buffer_val );
     }
 
-    //! Reduce an element into the buffer. Replace reduction.
+    //! Reduce an element into the buffer. Replace reduction. A plain store
+    //! suffices - the value taken from overlapping contributions is
+    //! documented as undetermined.
     template <class T>
     KOKKOS_INLINE_FUNCTION static void
     unpackOp( ScatterReduce::Replace, const T& buffer_val, T& array_val )
@@ -796,7 +1193,8 @@ class Halo
     }
 
     //! Unpack an element from the buffer. Unpack by bytes to avoid casting
-    //! across alignment boundaries.
+    //! across alignment boundaries. The wire representation is converted
+    //! back to the array value type before the reduction is applied.
     template <class ReduceOp, class ArrayView>
     KOKKOS_INLINE_FUNCTION static std::enable_if_t<4 == ArrayView::rank, void>
     unpackElement( const ReduceOp& reduce_op,
@@ -804,14 +1202,15 @@ class Halo
                    const Kokkos::View<int**, memory_space>& steering,
                    const int element_idx, const ArrayView& array_view )
     {
-        typename ArrayView::value_type elem;
+        using wire_type = typename HaloWireType<ArrayView>::type;
+        wire_type elem;
         char* elem_ptr = reinterpret_cast<char*>( &elem );
-        for ( std::size_t b = 0; b < sizeof( typename ArrayView::value_type );
-              ++b )
+        for ( std::size_t b = 0; b < sizeof( wire_type ); ++b )
         {
             *( elem_ptr + b ) = buffer( steering( element_idx, 0 ) + b );
         }
-        unpackOp( reduce_op, elem,
+        unpackOp( reduce_op,
+                  static_cast<typename ArrayView::value_type>( elem ),
                   array_view( steering( element_idx, 2 ),
                               steering( element_idx, 3 ),
                               steering( element_idx, 4 ),
@@ -819,7 +1218,8 @@ class Halo
     }
 
     //! Unpack an element from the buffer. Unpack by bytes to avoid casting
-    //! across alignment boundaries.
+    //! across alignment boundaries. The wire representation is converted
+    //! back to the array value type before the reduction is applied.
     template <class ReduceOp, class ArrayView>
     KOKKOS_INLINE_FUNCTION static std::enable_if_t<3 == ArrayView::rank, void>
     unpackElement( const ReduceOp& reduce_op,
@@ -827,14 +1227,15 @@ class Halo
                    const Kokkos::View<int**, memory_space>& steering,
                    const int element_idx, const ArrayView& array_view )
     {
-        typename ArrayView::value_type elem;
+        using wire_type = typename HaloWireType<ArrayView>::type;
+        wire_type elem;
         char* elem_ptr = reinterpret_cast<char*>( &elem );
-        for ( std::size_t b = 0; b < sizeof( typename ArrayView::value_type );
-              ++b )
+        for ( std::size_t b = 0; b < sizeof( wire_type ); ++b )
         {
             *( elem_ptr + b ) = buffer( steering( element_idx, 0 ) + b );
         }
-        unpackOp( reduce_op, elem,
+        unpackOp( reduce_op,
+                  static_cast<typename ArrayView::value_type>( elem ),
                   array_view( steering( element_idx, 2 ),
                               steering( element_idx, 3 ),
                               steering( element_idx, 4 ) ) );
@@ -915,17 +1316,156 @@ class Halo
     // The tag we use for receiveing from each neighbor.
     std::vector<int> _receive_tags;
 
-    // For each neighbor, send/receive buffers for data we own.
+    // Buffer pool holding the owned data segments of all neighbors.
+    Kokkos::View<char*, memory_space> _owned_buffer_pool;
+
+    // Buffer pool holding the ghosted data segments of all neighbors.
+    Kokkos::View<char*, memory_space> _ghosted_buffer_pool;
+
+    // For each neighbor, send/receive buffers for data we own. Contiguous
+    // segments of the owned buffer pool.
     std::vector<Kokkos::View<char*, memory_space>> _owned_buffers;
 
-    // For each neighbor, send/receive buffers for data we ghost.
+    // For each neighbor, send/receive buffers for data we ghost. Contiguous
+    // segments of the ghosted buffer pool.
     std::vector<Kokkos::View<char*, memory_space>> _ghosted_buffers;
 
-    // For each neighbor, steering vector for the owned buffer.
-    std::vector<Kokkos::View<int**, memory_space>> _owned_steering;
+    // Pinned host staging copy of the owned buffer pool. Only allocated
+    // when the MPI library cannot access device allocations.
+    Kokkos::View<char*, Cabana::PinnedHostSpace> _owned_stage;
+
+    // Pinned host staging copy of the ghosted buffer pool.
+    Kokkos::View<char*, Cabana::PinnedHostSpace> _ghosted_stage;
+
+    // Whether device buffers are passed directly to MPI or staged through
+    // the pinned host copies.
+    bool _device_direct;
 
-    // For each neighbor, steering vector for the ghosted buffer.
-    std::vector<Kokkos::View<int**, memory_space>> _ghosted_steering;
+    // Fused steering vector over the owned buffer pool for all neighbors.
+    Kokkos::View<int**, memory_space> _owned_steering;
+
+    // Fused steering vector over the ghosted buffer pool for all neighbors.
+    Kokkos::View<int**, memory_space> _ghosted_steering;
+
+    // Persistent requests for gathers. The first half are receives into the
+    // ghosted buffers, the second half sends from the owned buffers. Mutable
+    // because starting and completing communication modifies the requests
+    // but not the halo.
+    mutable std::vector<MPI_Request> _gather_requests;
+
+    // Persistent requests for scatters. The first half are receives into the
+    // owned buffers, the second half sends from the ghosted buffers.
+    mutable std::vector<MPI_Request> _scatter_requests;
+};
+
+//---------------------------------------------------------------------------//
+// Deep halo.
+//---------------------------------------------------------------------------//
+/*!
+  Wide-halo exchange plan trading redundant computation for messages.
+
+  A deep halo gathers all width ghost cells at once and tracks how many of
+  them still hold valid data as stencil steps consume them. A stencil step
+  that also updates the innermost remaining ghost cells - the index space
+  given by indexSpace( Ghost(), Local(), validWidth() - stencil_width ) of
+  the array layout - keeps the deep ghosts correct without communication,
+  so a width-k halo exchanges once every k steps of a width-1 stencil. At
+  the strong-scaling limit where the exchange latency exceeds the cost of
+  recomputing a ghost-cell-wide band of updates this is a net win.
+
+  \code
+    auto halo = createDeepHalo( pattern, k, *field );
+    for ( int step = 0; step < num_step; ++step )
+    {
+        // Exchanges on the first step and every k-th step after it.
+        halo->gather( exec_space, *field );
+
+        // Update the owned cells and the still-needed ghost bands.
+        auto update_space = field->layout()->indexSpace(
+            Ghost(), Local(), halo->validWidth() - 1 );
+        // ... stencil update over update_space ...
+
+        halo->advance();
+    }
+  \endcode
+*/
+template <class MemorySpace>
+class DeepHalo
+{
+  public:
+    //! Memory space.
+    using memory_space = MemorySpace;
+
+    /*!
+      \brief Constructor.
+      \param pattern The halo pattern to use for halo communication.
+      \param width Halo cell width gathered by each exchange. Must be less
+      than or equal to the halo width of the block.
+      \param arrays The arrays to build the halo for.
+    */
+    template <class Pattern, class... ArrayTypes>
+    DeepHalo( const Pattern& pattern, const int width,
+              const ArrayTypes&... arrays )
+        : _halo( pattern, width, arrays... )
+        , _width( width )
+        , _valid_width( 0 )
+    {
+        if ( width < 1 )
+            throw std::logic_error( "Deep halo width must be positive" );
+    }
+
+    //! Get the halo cell width gathered by each exchange.
+    int width() const { return _width; }
+
+    //! Get the number of ghost cells currently holding valid data.
+    int validWidth() const { return _valid_width; }
+
+    //! Get the underlying halo.
+    const Halo<MemorySpace>& halo() const { return _halo; }
+
+    /*!
+      \brief Gather data into our ghosts if no valid ghost cells remain.
+
+      Exchanges the full halo width when the valid ghost cells are
+      exhausted and is a no-op otherwise - steps in between run entirely
+      on locally updated ghosts.
+
+      \param exec_space The execution space to use for pack/unpack.
+      \param arrays The arrays to gather in constructor order.
+      \return Whether an exchange was performed.
+    */
+    template <class ExecutionSpace, class... ArrayTypes>
+    bool gather( const ExecutionSpace& exec_space,
+                 const ArrayTypes&... arrays )
+    {
+        if ( 0 < _valid_width )
+            return false;
+        _halo.gather( exec_space, arrays... );
+        _valid_width = _width;
+        return true;
+    }
+
+    /*!
+      \brief Record a stencil step that consumed ghost cells.
+
+      \param stencil_width The number of ghost cells the step read.
+
+      The step must have updated the owned entities plus the innermost
+      validWidth() - stencil_width ghost cells so the remaining ghosts
+      stay correct.
+    */
+    void advance( const int stencil_width = 1 )
+    {
+        if ( stencil_width > _valid_width )
+            throw std::logic_error(
+                "Stencil consumed more ghost cells than are valid" );
+        _valid_width -= stencil_width;
+    }
+
+  private:
+    Halo<MemorySpace> _halo;
+    int _width;
+    int _valid_width;
 };
 
 //---------------------------------------------------------------------------//
@@ -954,6 +1494,23 @@ auto createHalo( const Pattern& pattern, const int width,
     return std::make_shared<Halo<memory_space>>( pattern, width, arrays... );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Deep halo creation function.
+  \param pattern The pattern to build the halo from.
+  \param width Halo cell width gathered by each exchange. Must be less than
+  or equal to the width of the array halo.
+  \param arrays The arrays over which to build the halo.
+*/
+template <class Pattern, class... ArrayTypes>
+auto createDeepHalo( const Pattern& pattern, const int width,
+                     const ArrayTypes&... arrays )
+{
+    using memory_space = typename ArrayPackMemorySpace<ArrayTypes...>::type;
+    return std::make_shared<DeepHalo<memory_space>>( pattern, width,
+                                                     arrays... );
+}
+
 //---------------------------------------------------------------------------//
 // Backwards-compatible single array creation functions.
 //---------------------------------------------------------------------------//
@@ -36,6 +36,26 @@
 
 namespace Cajita
 {
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Memory space in which box values are passed to HYPRE. When HYPRE is built
+// with GPU support it expects device pointers, so the matrix and vector
+// transfer buffers are staged in the solver device memory space and the
+// host round-trip is skipped. Host builds of HYPRE keep the host staging
+// path.
+#if defined( HYPRE_USING_GPU ) || defined( HYPRE_USING_CUDA ) ||              \
+    defined( HYPRE_USING_HIP )
+template <class DeviceType>
+using HypreMemorySpace = typename DeviceType::memory_space;
+#else
+template <class DeviceType>
+using HypreMemorySpace = Kokkos::HostSpace;
+#endif
+} // namespace Impl
+//! \endcond
+
 //---------------------------------------------------------------------------//
 //! Hypre structured solver interface for scalar fields.
 template <class Scalar, class EntityType, class DeviceType>
@@ -48,6 +68,8 @@ class HypreStructuredSolver
     using device_type = DeviceType;
     //! Scalar value type.
     using value_type = Scalar;
+    //! Memory space in which box values are passed to HYPRE.
+    using hypre_memory_space = Impl::HypreMemorySpace<DeviceType>;
 
     /*!
       \brief Constructor.
@@ -60,6 +82,7 @@ class HypreStructuredSolver
                            const bool is_preconditioner = false )
         : _comm( layout.localGrid()->globalGrid().comm() )
         , _is_preconditioner( is_preconditioner )
+        , _setup_done( false )
     {
         static_assert( is_array_layout<ArrayLayout_t>::value,
                        "Must use an array layout" );
@@ -126,7 +149,8 @@ class HypreStructuredSolver
             IndexSpace<num_space_dim> reorder_space( reorder_size );
             auto vector_values =
                 createView<HYPRE_Complex, Kokkos::LayoutRight,
-                           Kokkos::HostSpace>( "vector_values", reorder_space );
+                           hypre_memory_space>( "vector_values",
+                                                reorder_space );
             Kokkos::deep_copy( vector_values, 0.0 );
 
             error = HYPRE_StructVectorCreate( _comm, _grid, &_b );
@@ -205,6 +229,9 @@ class HypreStructuredSolver
         checkHypreError( error );
         error = HYPRE_StructMatrixSetSymmetric( _A, is_symmetric );
         checkHypreError( error );
+
+        // A new matrix requires a new setup.
+        _setup_done = false;
     }
 
     /*!
@@ -247,9 +274,9 @@ class HypreStructuredSolver
         auto error = HYPRE_StructMatrixInitialize( _A );
         checkHypreError( error );
 
-        // Get a view of the matrix values on the host.
+        // Get a view of the matrix values in the HYPRE memory space.
         auto values_mirror = Kokkos::create_mirror_view_and_copy(
-            Kokkos::HostSpace(), values.view() );
+            hypre_memory_space(), values.view() );
 
         // Copy the matrix entries into HYPRE. The HYPRE layout is fixed as
         // layout-right.
@@ -262,7 +289,7 @@ class HypreStructuredSolver
         reorder_size.back() = _stencil_size;
         IndexSpace<num_space_dim + 1> reorder_space( reorder_size );
         auto a_values =
-            createView<HYPRE_Complex, Kokkos::LayoutRight, Kokkos::HostSpace>(
+            createView<HYPRE_Complex, Kokkos::LayoutRight, hypre_memory_space>(
                 "a_values", reorder_space );
         auto values_mirror_subv = createSubview( values_mirror, owned_space );
         Kokkos::deep_copy( a_values, values_mirror_subv );
@@ -276,6 +303,9 @@ class HypreStructuredSolver
         checkHypreError( error );
         error = HYPRE_StructMatrixAssemble( _A );
         checkHypreError( error );
+
+        // New matrix values require a new setup.
+        _setup_done = false;
     }
 
     //! Set convergence tolerance implementation.
@@ -308,7 +338,8 @@ class HypreStructuredSolver
         this->setPreconditionerImpl( *_preconditioner );
     }
 
-    //! Setup the problem.
+    //! Setup the problem. Only needed again after the matrix changes -
+    //! solves with a new RHS but the same matrix reuse the last setup.
     void setup()
     {
         // This function is only valid for non-preconditioners.
@@ -316,12 +347,16 @@ class HypreStructuredSolver
             throw std::logic_error( "Cannot call setup() on preconditioners" );
 
         this->setupImpl( _A, _b, _x );
+        _setup_done = true;
     }
 
     /*!
       \brief Solve the problem Ax = b for x.
       \param b The forcing term.
       \param x The solution.
+
+      The solver setup is reused as long as the matrix is unchanged, so
+      RHS-only re-solves skip the matrix assembly and setup entirely.
     */
     template <class Array_t>
     void solve( const Array_t& b, Array_t& x )
@@ -350,13 +385,18 @@ class HypreStructuredSolver
         // Spatial dimension.
         const std::size_t num_space_dim = Array_t::num_space_dim;
 
+        // Setup the solver if the matrix changed since the last setup;
+        // RHS-only re-solves fall through without touching the matrix.
+        if ( !_setup_done )
+            setup();
+
         // Initialize the RHS.
         auto error = HYPRE_StructVectorInitialize( _b );
         checkHypreError( error );
 
-        // Get a local view of RHS on the host.
+        // Get a local view of RHS in the HYPRE memory space.
         auto b_mirror = Kokkos::create_mirror_view_and_copy(
-            Kokkos::HostSpace(), b.view() );
+            hypre_memory_space(), b.view() );
 
         // Copy the RHS into HYPRE. The HYPRE layout is fixed as layout-right.
         auto owned_space = b.layout()->indexSpace( Own(), Local() );
@@ -368,7 +408,7 @@ class HypreStructuredSolver
         reorder_size.back() = 1;
         IndexSpace<num_space_dim + 1> reorder_space( reorder_size );
         auto vector_values =
-            createView<HYPRE_Complex, Kokkos::LayoutRight, Kokkos::HostSpace>(
+            createView<HYPRE_Complex, Kokkos::LayoutRight, hypre_memory_space>(
                 "vector_values", reorder_space );
         auto b_mirror_subv = createSubview( b_mirror, owned_space );
         Kokkos::deep_copy( vector_values, b_mirror_subv );
@@ -388,9 +428,9 @@ class HypreStructuredSolver
             _x, _lower.data(), _upper.data(), vector_values.data() );
         checkHypreError( error );
 
-        // Get a local view of x on the host.
+        // Get a local view of x in the HYPRE memory space.
         auto x_mirror =
-            Kokkos::create_mirror_view( Kokkos::HostSpace(), x.view() );
+            Kokkos::create_mirror_view( hypre_memory_space(), x.view() );
 
         // Copy the HYPRE solution to the LHS.
         auto x_mirror_subv = createSubview( x_mirror, owned_space );
@@ -463,6 +503,9 @@ class HypreStructuredSolver
   private:
     MPI_Comm _comm;
     bool _is_preconditioner;
+    // True while the matrix is unchanged since the last setup; lets
+    // RHS-only re-solves reuse the setup.
+    bool _setup_done;
     HYPRE_StructGrid _grid;
     std::vector<HYPRE_Int> _lower;
     std::vector<HYPRE_Int> _upper;
@@ -169,6 +169,149 @@ L2G<MeshType, EntityType> createL2G( const LocalGrid<MeshType>& local_grid,
     return L2G<MeshType, EntityType>( local_grid );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Local-to-global indexer with cached per-dimension lookup tables.
+
+  The conversion is independent per dimension, so the global index of every
+  local index in the ghosted range is precomputed once into one small view
+  per dimension. Each conversion is then a single load per dimension
+  instead of the periodic wrap-around branch chain of L2G, which pays off
+  in kernels that convert many indices per entity, such as output and
+  boundary-condition kernels. The tables must be regenerated when the
+  local grid changes.
+*/
+template <class MemorySpace, class MeshType, class EntityType>
+struct L2GTable
+{
+    //! Memory space in which the lookup tables reside.
+    using memory_space = MemorySpace;
+
+    //! Mesh type.
+    using mesh_type = MeshType;
+
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = mesh_type::num_space_dim;
+
+    //! Entity type.
+    using entity_type = EntityType;
+
+    //! Per-dimension global index of each ghosted local index.
+    Kokkos::Array<Kokkos::View<int*, MemorySpace>, num_space_dim> global;
+
+    //! Ghosted local indices minimum.
+    Kokkos::Array<int, num_space_dim> local_ghost_min;
+
+    //! Constructor.
+    L2GTable( const LocalGrid<MeshType>& local_grid )
+    {
+        // Generate the tables from the arithmetic conversion over the
+        // ghosted local range.
+        L2G<MeshType, EntityType> l2g( local_grid );
+        auto local_ghost_space =
+            local_grid.indexSpace( Ghost(), EntityType(), Local() );
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+        {
+            local_ghost_min[d] = local_ghost_space.min( d );
+            global[d] = Kokkos::View<int*, MemorySpace>(
+                Kokkos::ViewAllocateWithoutInitializing( "l2g_table" ),
+                local_ghost_space.extent( d ) );
+            auto host_table = Kokkos::create_mirror_view( global[d] );
+            int lijk[num_space_dim];
+            int gijk[num_space_dim];
+            for ( std::size_t d2 = 0; d2 < num_space_dim; ++d2 )
+                lijk[d2] = local_ghost_space.min( d2 );
+            for ( int l = local_ghost_space.min( d );
+                  l < local_ghost_space.max( d ); ++l )
+            {
+                lijk[d] = l;
+                l2g( lijk, gijk );
+                host_table( l - local_ghost_min[d] ) = gijk[d];
+            }
+            Kokkos::deep_copy( global[d], host_table );
+        }
+    }
+
+    //! Convert local indices to global indices - general form.
+    KOKKOS_INLINE_FUNCTION
+    void operator()( const int lijk[num_space_dim],
+                     int gijk[num_space_dim] ) const
+    {
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+            gijk[d] = global[d]( lijk[d] - local_ghost_min[d] );
+    }
+
+    //! Convert local indices to global indices - 3D.
+    template <std::size_t NSD = num_space_dim>
+    KOKKOS_INLINE_FUNCTION std::enable_if_t<3 == NSD, void>
+    operator()( const int li, const int lj, const int lk, int& gi, int& gj,
+                int& gk ) const
+    {
+        gi = global[0]( li - local_ghost_min[0] );
+        gj = global[1]( lj - local_ghost_min[1] );
+        gk = global[2]( lk - local_ghost_min[2] );
+    }
+
+    //! Convert local indices to global indices - 2D.
+    template <std::size_t NSD = num_space_dim>
+    KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == NSD, void>
+    operator()( const int li, const int lj, int& gi, int& gj ) const
+    {
+        gi = global[0]( li - local_ghost_min[0] );
+        gj = global[1]( lj - local_ghost_min[1] );
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Creation function for a cached local-to-global indexer.
+template <class MemorySpace, class MeshType, class EntityType>
+L2GTable<MemorySpace, MeshType, EntityType>
+createL2GTable( const LocalGrid<MeshType>& local_grid, EntityType )
+{
+    return L2GTable<MemorySpace, MeshType, EntityType>( local_grid );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Convert a list of local index tuples to global indices in one
+  kernel.
+
+  \param exec_space The execution space to convert in.
+
+  \param l2g The local-to-global indexer - either the arithmetic L2G or a
+  cached L2GTable.
+
+  \param lijk Rank-2 view of local index tuples to convert, indexed as
+  lijk(n,d).
+
+  \param gijk Rank-2 view of the converted global index tuples with the
+  same shape as the input.
+*/
+template <class ExecutionSpace, class Indexer, class LocalIndexView,
+          class GlobalIndexView>
+void batchedL2G( ExecutionSpace exec_space, const Indexer& l2g,
+                 const LocalIndexView& lijk, const GlobalIndexView& gijk )
+{
+    static_assert( 2 == LocalIndexView::rank,
+                   "Local indices must be a rank-2 view" );
+    static_assert( 2 == GlobalIndexView::rank,
+                   "Global indices must be a rank-2 view" );
+    constexpr std::size_t nsd = Indexer::num_space_dim;
+    Kokkos::parallel_for(
+        "Cajita::IndexConversion::batchedL2G",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0,
+                                             lijk.extent( 0 ) ),
+        KOKKOS_LAMBDA( const int n ) {
+            int local[nsd];
+            int global[nsd];
+            for ( std::size_t d = 0; d < nsd; ++d )
+                local[d] = lijk( n, d );
+            l2g( local, global );
+            for ( std::size_t d = 0; d < nsd; ++d )
+                gijk( n, d ) = global[d];
+        } );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace IndexConversion
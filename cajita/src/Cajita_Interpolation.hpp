@@ -22,10 +22,15 @@
 #include <Cajita_Splines.hpp>
 #include <Cajita_Types.hpp>
 
+#include <Cabana_LinkedCellList.hpp>
+#include <Cabana_ParameterPack.hpp>
+
 #include <Kokkos_Core.hpp>
 #include <Kokkos_ScatterView.hpp>
 
 #include <memory>
+#include <stdexcept>
+#include <tuple>
 #include <type_traits>
 
 namespace Cajita
@@ -60,8 +65,11 @@ KOKKOS_INLINE_FUNCTION
 
     result = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
                 result += view( sd.s[Dim::I][i], sd.s[Dim::J][j],
                                 sd.s[Dim::K][k], 0 ) *
@@ -88,7 +96,9 @@ KOKKOS_INLINE_FUNCTION
 
     result = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
             result += view( sd.s[Dim::I][i], sd.s[Dim::J][j], 0 ) *
                       sd.w[Dim::I][i] * sd.w[Dim::J][j];
@@ -116,8 +126,11 @@ KOKKOS_INLINE_FUNCTION
     for ( int d = 0; d < 3; ++d )
         result[d] = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
                 for ( int d = 0; d < 3; ++d )
                     result[d] += view( sd.s[Dim::I][i], sd.s[Dim::J][j],
@@ -147,7 +160,9 @@ KOKKOS_INLINE_FUNCTION
     for ( int d = 0; d < 2; ++d )
         result[d] = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
             for ( int d = 0; d < 2; ++d )
                 result[d] += view( sd.s[Dim::I][i], sd.s[Dim::J][j], d ) *
@@ -178,8 +193,11 @@ KOKKOS_INLINE_FUNCTION
     for ( int d = 0; d < 3; ++d )
         result[d] = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
             {
                 result[Dim::I] += view( sd.s[Dim::I][i], sd.s[Dim::J][j],
@@ -222,7 +240,9 @@ KOKKOS_INLINE_FUNCTION
     for ( int d = 0; d < 2; ++d )
         result[d] = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
         {
             result[Dim::I] += view( sd.s[Dim::I][i], sd.s[Dim::J][j], 0 ) *
@@ -258,8 +278,11 @@ KOKKOS_INLINE_FUNCTION
         for ( int d1 = 0; d1 < 3; ++d1 )
             result[d0][d1] = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
             {
                 typename SplineDataType::scalar_type rg[3] = {
@@ -302,7 +325,9 @@ KOKKOS_INLINE_FUNCTION
         for ( int d1 = 0; d1 < 2; ++d1 )
             result[d0][d1] = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
         {
             typename SplineDataType::scalar_type rg[2] = {
@@ -343,8 +368,11 @@ KOKKOS_INLINE_FUNCTION
 
     result = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
                 result +=
                     view( sd.s[Dim::I][i], sd.s[Dim::J][j], sd.s[Dim::K][k],
@@ -383,7 +411,9 @@ KOKKOS_INLINE_FUNCTION
 
     result = 0.0;
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
             result += view( sd.s[Dim::I][i], sd.s[Dim::J][j], Dim::I ) *
                           sd.g[Dim::I][i] * sd.w[Dim::J][j] +
@@ -459,8 +489,11 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
                 view_access( sd.s[Dim::I][i], sd.s[Dim::J][j], sd.s[Dim::K][k],
                              0 ) += point_data * sd.w[Dim::I][i] *
@@ -488,7 +521,9 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
             view_access( sd.s[Dim::I][i], sd.s[Dim::J][j], 0 ) +=
                 point_data * sd.w[Dim::I][i] * sd.w[Dim::J][j];
@@ -517,8 +552,11 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
                 for ( int d = 0; d < 3; ++d )
                     view_access( sd.s[Dim::I][i], sd.s[Dim::J][j],
@@ -549,7 +587,9 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
             for ( int d = 0; d < 2; ++d )
                 view_access( sd.s[Dim::I][i], sd.s[Dim::J][j], d ) +=
@@ -579,8 +619,11 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
             {
                 view_access( sd.s[Dim::I][i], sd.s[Dim::J][j], sd.s[Dim::K][k],
@@ -619,7 +662,9 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
         {
             view_access( sd.s[Dim::I][i], sd.s[Dim::J][j], Dim::I ) +=
@@ -656,8 +701,11 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
             {
                 PointDataType result = point_data[Dim::I] * sd.g[Dim::I][i] *
@@ -699,7 +747,9 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
         {
             PointDataType result =
@@ -737,8 +787,11 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
+            CAJITA_SPLINE_UNROLL
             for ( int k = 0; k < SplineDataType::num_knot; ++k )
             {
                 typename SplineDataType::scalar_type rg[3] = {
@@ -781,7 +834,9 @@ KOKKOS_INLINE_FUNCTION
                    "P2G requires a Kokkos::ScatterView" );
     auto view_access = view.access();
 
+    CAJITA_SPLINE_UNROLL
     for ( int i = 0; i < SplineDataType::num_knot; ++i )
+        CAJITA_SPLINE_UNROLL
         for ( int j = 0; j < SplineDataType::num_knot; ++j )
         {
             typename SplineDataType::scalar_type rg[2] = {
@@ -900,6 +955,65 @@ void g2p(
         } );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ \brief Global Grid-to-Point interpolation with a runtime spline order.
+
+  Dispatches to the compile-time g2p instantiation for the given order so
+  each instantiation's inner loops stay fully specialized. Use this for
+  workloads mixing spline orders at runtime (e.g. high-order field
+  interpolation next to low-order diagnostics) instead of duplicating the
+  dispatch in application code.
+
+  \param array The grid array from which the point data will be
+  interpolated.
+
+  \param halo The halo associated with the grid array. This halo will be
+  used to gather the array data before interpolation.
+
+  \param points The points over which to perform the interpolation. Will be
+  indexed as (point,dim). The subset of indices in each point's interpolation
+  stencil must be contained within the local grid that will be used for the
+  interpolation
+
+  \param num_point The number of points. This is the size of the first
+  dimension of points.
+
+  \param spline_order The order of spline interpolation to use. Orders 0
+  through 3 are instantiated.
+
+  \param functor A functor that interpolates from a given entity to a given
+  point.
+*/
+template <class PointEvalFunctor, class PointCoordinates, class ArrayScalar,
+          class MeshScalar, class EntityType, std::size_t NumSpaceDim,
+          class DeviceType, class... ArrayParams>
+void g2p(
+    const Array<ArrayScalar, EntityType, UniformMesh<MeshScalar, NumSpaceDim>,
+                ArrayParams...>& array,
+    const Halo<DeviceType>& halo, const PointCoordinates& points,
+    const std::size_t num_point, const int spline_order,
+    const PointEvalFunctor& functor )
+{
+    switch ( spline_order )
+    {
+    case 0:
+        g2p( array, halo, points, num_point, Spline<0>(), functor );
+        break;
+    case 1:
+        g2p( array, halo, points, num_point, Spline<1>(), functor );
+        break;
+    case 2:
+        g2p( array, halo, points, num_point, Spline<2>(), functor );
+        break;
+    case 3:
+        g2p( array, halo, points, num_point, Spline<3>(), functor );
+        break;
+    default:
+        throw std::runtime_error( "Invalid spline order" );
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Grid-to-point scalar value functor.
@@ -1247,6 +1361,202 @@ void p2g( const PointEvalFunctor& functor, const PointCoordinates& points,
     halo.scatter( execution_space(), ScatterReduce::Sum(), array );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ \brief Global Point-to-Grid interpolation with a runtime spline order.
+
+  Dispatches to the compile-time p2g instantiation for the given order so
+  each instantiation's inner loops stay fully specialized. Use this for
+  workloads mixing spline orders at runtime (e.g. high-order charge
+  deposition next to low-order current diagnostics) instead of duplicating
+  the dispatch in application code.
+
+  \param functor A functor that interpolates from a given point to a given
+  entity.
+
+  \param points The points over which to perform the interpolation. Will be
+  indexed as (point,dim). The subset of indices in each point's interpolation
+  stencil must be contained within the local grid that will be used for the
+  interpolation
+
+  \param num_point The number of points. This is the size of the first
+  dimension of points.
+
+  \param spline_order The order of spline interpolation to use. Orders 0
+  through 3 are instantiated.
+
+  \param halo The halo associated with the grid array. This halo will be
+  used to scatter the interpolated data.
+
+  \param array The grid array to which the point data will be interpolated.
+*/
+template <class PointEvalFunctor, class PointCoordinates, class ArrayScalar,
+          class MeshScalar, std::size_t NumSpaceDim, class EntityType,
+          class DeviceType, class... ArrayParams>
+void p2g( const PointEvalFunctor& functor, const PointCoordinates& points,
+          const std::size_t num_point, const int spline_order,
+          const Halo<DeviceType>& halo,
+          Array<ArrayScalar, EntityType, UniformMesh<MeshScalar, NumSpaceDim>,
+                ArrayParams...>& array )
+{
+    switch ( spline_order )
+    {
+    case 0:
+        p2g( functor, points, num_point, Spline<0>(), halo, array );
+        break;
+    case 1:
+        p2g( functor, points, num_point, Spline<1>(), halo, array );
+        break;
+    case 2:
+        p2g( functor, points, num_point, Spline<2>(), halo, array );
+        break;
+    case 3:
+        p2g( functor, points, num_point, Spline<3>(), halo, array );
+        break;
+    default:
+        throw std::runtime_error( "Invalid spline order" );
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ \brief Deterministic cell-colored point-to-grid interpolation.
+
+  Scatters point data to the grid without atomics. The owned cells are
+  partitioned into colors such that the spline stencil footprints of points
+  in different cells of the same color never overlap, so all cells of a
+  color can accumulate in parallel with plain writes. The points within a
+  cell are accumulated serially in the order of the cell list permutation,
+  making the result bitwise reproducible for a given binning. For clustered
+  point distributions this avoids the atomic contention of the scatter view
+  in the unbinned p2g.
+
+  \param functor A functor that interpolates from a given point to a given
+  entity.
+
+  \param points The points over which to perform the interpolation. Will be
+  indexed as (point,dim). The points must be on their owning rank (e.g.
+  after migrating with particleGridMigrate).
+
+  \param cell_list The linked cell list binning the points. The list must
+  bin the points over the owned cells of the grid: one bin per cell, bin
+  sizes equal to the cell size, and the grid minimum at the owned low
+  corner.
+
+  \param halo The halo associated with the grid array. This halo will be
+  used to scatter the interpolated data.
+
+  \param array The grid array to which the point data will be interpolated.
+
+  \note Spline of SplineOrder passed for interpolation.
+*/
+template <class PointEvalFunctor, class PointCoordinates, class ArrayScalar,
+          class MeshScalar, class EntityType, int SplineOrder,
+          class DeviceType, class ListDeviceType, class... ArrayParams>
+void p2g( const PointEvalFunctor& functor, const PointCoordinates& points,
+          const Cabana::LinkedCellList<ListDeviceType>& cell_list,
+          Spline<SplineOrder>, const Halo<DeviceType>& halo,
+          Array<ArrayScalar, EntityType, UniformMesh<MeshScalar, 3>,
+                ArrayParams...>& array )
+{
+    using array_type =
+        Array<ArrayScalar, EntityType, UniformMesh<MeshScalar, 3>,
+              ArrayParams...>;
+    static_assert( std::is_same<typename Halo<DeviceType>::memory_space,
+                                typename array_type::memory_space>::value,
+                   "Mismatching points/array memory space." );
+    static_assert(
+        std::is_same<
+            typename Cabana::LinkedCellList<ListDeviceType>::memory_space,
+            typename array_type::memory_space>::value,
+        "Mismatching cell list/array memory space." );
+
+    using execution_space = typename DeviceType::execution_space;
+
+    // Create the local mesh.
+    auto local_mesh =
+        createLocalMesh<DeviceType>( *( array.layout()->localGrid() ) );
+
+    // Create a non-duplicated, non-atomic scatter view of the array. The
+    // cell coloring guarantees cells processed in parallel never write to
+    // overlapping stencil footprints so no contention resolution is needed.
+    auto array_view = array.view();
+    using view_type = decltype( array_view );
+    Kokkos::Experimental::ScatterView<
+        typename view_type::data_type, typename view_type::array_layout,
+        execution_space, Kokkos::Experimental::ScatterSum,
+        Kokkos::Experimental::ScatterNonDuplicated,
+        Kokkos::Experimental::ScatterNonAtomic>
+        array_sv( array_view );
+
+    // Cells of the same color are separated by the width of the spline
+    // stencil so their footprints cannot overlap. Even-order splines anchor
+    // on the nearest entity instead of the cell containing the point so
+    // their footprint over a cell spans one extra entity.
+    constexpr int stride =
+        ( 0 == SplineOrder % 2 ) ? SplineOrder + 2 : SplineOrder + 1;
+
+    // Loop over colors, processing the cells of each color in parallel and
+    // the points within each cell serially in binning order.
+    for ( int ci = 0; ci < stride; ++ci )
+        for ( int cj = 0; cj < stride; ++cj )
+            for ( int ck = 0; ck < stride; ++ck )
+            {
+                long num_color_bin[3];
+                int color_offset[3] = { ci, cj, ck };
+                for ( std::size_t d = 0; d < 3; ++d )
+                    num_color_bin[d] = ( cell_list.numBin( d ) -
+                                         color_offset[d] + stride - 1 ) /
+                                       stride;
+                Kokkos::parallel_for(
+                    "p2g_colored",
+                    Kokkos::MDRangePolicy<execution_space, Kokkos::Rank<3>>(
+                        { 0, 0, 0 },
+                        { num_color_bin[Dim::I], num_color_bin[Dim::J],
+                          num_color_bin[Dim::K] } ),
+                    KOKKOS_LAMBDA( const int bi, const int bj, const int bk ) {
+                        // Get the cell of this color.
+                        int i = ci + bi * stride;
+                        int j = cj + bj * stride;
+                        int k = ck + bk * stride;
+
+                        // Interpolate the points in the cell in binning
+                        // order.
+                        int bin_size = cell_list.binSize( i, j, k );
+                        std::size_t bin_offset =
+                            cell_list.binOffset( i, j, k );
+                        for ( int n = 0; n < bin_size; ++n )
+                        {
+                            int p = cell_list.permutation( n + bin_offset );
+
+                            // Get the point coordinates.
+                            MeshScalar px[3];
+                            for ( std::size_t d = 0; d < 3; ++d )
+                            {
+                                px[d] = points( p, d );
+                            }
+
+                            // Create the local spline data.
+                            using sd_type =
+                                SplineData<MeshScalar, SplineOrder, 3,
+                                           EntityType>;
+                            sd_type sd;
+                            evaluateSpline( local_mesh, px, sd );
+
+                            // Evaluate the functor.
+                            functor( sd, p, array_sv );
+                        }
+                    } );
+            }
+
+    // No contribute step is needed - the non-duplicated scatter view
+    // aliases the array memory.
+
+    // Scatter interpolation contributions in the halo back to their owning
+    // ranks.
+    halo.scatter( execution_space(), ScatterReduce::Sum(), array );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Point-to-grid scalar value functor.
@@ -1495,6 +1805,529 @@ createTensorDivergenceP2G( const ViewType& x,
     return TensorDivergenceP2G<ViewType>( x, multiplier );
 }
 
+//---------------------------------------------------------------------------//
+// Fused multi-field interpolation.
+//---------------------------------------------------------------------------//
+/*!
+  \brief A grid field paired with the point evaluation functor used to
+  interpolate it in a fused multi-field interpolation.
+
+  \tparam PointEvalFunctor Functor type used to evaluate the interpolated
+  data for a given point at a given entity.
+
+  \tparam Array_t The grid array type holding the field data.
+*/
+template <class PointEvalFunctor, class Array_t>
+struct InterpolationField
+{
+    //! Array type.
+    using array_type = Array_t;
+    //! Functor type.
+    using functor_type = PointEvalFunctor;
+
+    //! The functor evaluating the field at the points.
+    PointEvalFunctor functor;
+    //! The grid array holding the field data.
+    Array_t& array;
+};
+
+//! Creation function for a fused interpolation field.
+template <class PointEvalFunctor, class Array_t>
+InterpolationField<PointEvalFunctor, Array_t>
+createInterpolationField( const PointEvalFunctor& functor, Array_t& array )
+{
+    return InterpolationField<PointEvalFunctor, Array_t>{ functor, array };
+}
+
+//! \cond Impl
+// Compile-time conjunction used to check fused interpolation fields.
+template <bool... Values>
+struct InterpolationBoolPack;
+
+template <bool... Values>
+using interpolationAllTrue =
+    std::is_same<InterpolationBoolPack<true, Values...>,
+                 InterpolationBoolPack<Values..., true>>;
+
+// Apply each functor of a fused interpolation to its grid view with shared
+// spline data.
+template <class SplineDataType, class FunctorPack, class ViewPack,
+          std::size_t... Is>
+KOKKOS_INLINE_FUNCTION void
+applyInterpolationFields( const SplineDataType& sd, const int p,
+                          const FunctorPack& functors, const ViewPack& views,
+                          std::index_sequence<Is...> )
+{
+    int aggregate[] = {
+        ( Cabana::get<Is>( functors )( sd, p, Cabana::get<Is>( views ) ),
+          0 )... };
+    (void)aggregate;
+}
+
+// Contribute each scatter view of a fused point-to-grid interpolation into
+// its grid view.
+template <class ViewPack, class ScatterViewPack, std::size_t... Is>
+void contributeInterpolationFields( ViewPack& views,
+                                    ScatterViewPack& scatter_views,
+                                    std::index_sequence<Is...> )
+{
+    int aggregate[] = { ( Kokkos::Experimental::contribute(
+                              Cabana::get<Is>( views ),
+                              Cabana::get<Is>( scatter_views ) ),
+                          0 )... };
+    (void)aggregate;
+}
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Fused multi-field grid-to-point interpolation.
+
+  Interpolates multiple grid fields to the same set of points in a single
+  pass. The spline data is evaluated only once per point and shared by all
+  fields, amortizing the cost of the spline weight evaluation and stencil
+  index math over the fields. All fields must share the entity type and mesh
+  of the halo.
+
+  \param halo The halo associated with the grid arrays. This halo will be
+  used to gather the array data of all fields before interpolation and must
+  have been created with the field arrays in the order they are given here.
+
+  \param points The points over which to perform the interpolation. Will be
+  indexed as (point,dim). The subset of indices in each point's interpolation
+  stencil must be contained within the local grid that will be used for the
+  interpolation
+
+  \param num_point The number of points. This is the size of the first
+  dimension of points.
+
+  \param field The first field to interpolate. Create fields with
+  createInterpolationField by pairing a point evaluation functor with the
+  grid array it reads.
+
+  \param fields The remaining fields to interpolate.
+
+  \note Spline of SplineOrder passed for interpolation.
+*/
+template <class PointCoordinates, int SplineOrder, class DeviceType,
+          class FieldType, class... FieldTypes>
+void g2p( const Halo<DeviceType>& halo, const PointCoordinates& points,
+          const std::size_t num_point, Spline<SplineOrder>,
+          const FieldType& field, const FieldTypes&... fields )
+{
+    using array_type = typename FieldType::array_type;
+    using entity_type = typename array_type::entity_type;
+    using mesh_type = typename array_type::mesh_type;
+    static_assert( isUniformMesh<mesh_type>::value,
+                   "Fused interpolation requires a uniform mesh" );
+    using mesh_scalar = typename mesh_type::scalar_type;
+    constexpr std::size_t num_space_dim = mesh_type::num_space_dim;
+
+    static_assert(
+        interpolationAllTrue<std::is_same<
+            typename FieldTypes::array_type::entity_type,
+            entity_type>::value...>::value,
+        "Fused interpolation fields must share an entity type" );
+    static_assert(
+        interpolationAllTrue<
+            std::is_same<typename FieldTypes::array_type::mesh_type,
+                         mesh_type>::value...>::value,
+        "Fused interpolation fields must share a mesh type" );
+    static_assert( std::is_same<typename Halo<DeviceType>::memory_space,
+                                typename array_type::memory_space>::value,
+                   "Mismatching points/array memory space." );
+
+    using execution_space = typename DeviceType::execution_space;
+
+    // Create the local mesh.
+    auto local_mesh =
+        createLocalMesh<DeviceType>( *( field.array.layout()->localGrid() ) );
+
+    // Gather data of all fields into the halo in a single communication
+    // before interpolating.
+    halo.gather( execution_space(), field.array, fields.array... );
+
+    // Pack the functors and array views so one kernel can apply them all
+    // with shared spline data.
+    auto functor_pack =
+        Cabana::makeParameterPack( field.functor, fields.functor... );
+    auto view_pack =
+        Cabana::makeParameterPack( field.array.view(), fields.array.view()... );
+
+    // Loop over points and interpolate each field from the grid.
+    Kokkos::parallel_for(
+        "g2p_fused", Kokkos::RangePolicy<execution_space>( 0, num_point ),
+        KOKKOS_LAMBDA( const int p ) {
+            // Get the point coordinates.
+            mesh_scalar px[num_space_dim];
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+            {
+                px[d] = points( p, d );
+            }
+
+            // Create the local spline data shared by all fields.
+            using sd_type = SplineData<mesh_scalar, SplineOrder, num_space_dim,
+                                       entity_type>;
+            sd_type sd;
+            evaluateSpline( local_mesh, px, sd );
+
+            // Evaluate each field's functor.
+            applyInterpolationFields(
+                sd, p, functor_pack, view_pack,
+                std::make_index_sequence<1 + sizeof...( FieldTypes )>() );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Fused multi-field point-to-grid interpolation.
+
+  Interpolates the same set of points to multiple grid fields in a single
+  pass. The spline data is evaluated only once per point and shared by all
+  fields, amortizing the cost of the spline weight evaluation and stencil
+  index math over the fields. All fields must share the entity type and mesh
+  of the halo.
+
+  \param points The points over which to perform the interpolation. Will be
+  indexed as (point,dim). The subset of indices in each point's interpolation
+  stencil must be contained within the local grid that will be used for the
+  interpolation
+
+  \param num_point The number of points. This is the size of the first
+  dimension of points.
+
+  \param halo The halo associated with the grid arrays. This halo will be
+  used to scatter the interpolated data of all fields and must have been
+  created with the field arrays in the order they are given here.
+
+  \param field The first field to interpolate. Create fields with
+  createInterpolationField by pairing a point evaluation functor with the
+  grid array it writes.
+
+  \param fields The remaining fields to interpolate.
+
+  \note Spline of SplineOrder passed for interpolation.
+*/
+template <class PointCoordinates, int SplineOrder, class DeviceType,
+          class FieldType, class... FieldTypes>
+void p2g( const PointCoordinates& points, const std::size_t num_point,
+          Spline<SplineOrder>, const Halo<DeviceType>& halo,
+          const FieldType& field, const FieldTypes&... fields )
+{
+    using array_type = typename FieldType::array_type;
+    using entity_type = typename array_type::entity_type;
+    using mesh_type = typename array_type::mesh_type;
+    static_assert( isUniformMesh<mesh_type>::value,
+                   "Fused interpolation requires a uniform mesh" );
+    using mesh_scalar = typename mesh_type::scalar_type;
+    constexpr std::size_t num_space_dim = mesh_type::num_space_dim;
+
+    static_assert(
+        interpolationAllTrue<std::is_same<
+            typename FieldTypes::array_type::entity_type,
+            entity_type>::value...>::value,
+        "Fused interpolation fields must share an entity type" );
+    static_assert(
+        interpolationAllTrue<
+            std::is_same<typename FieldTypes::array_type::mesh_type,
+                         mesh_type>::value...>::value,
+        "Fused interpolation fields must share a mesh type" );
+    static_assert( std::is_same<typename Halo<DeviceType>::memory_space,
+                                typename array_type::memory_space>::value,
+                   "Mismatching points/array memory space." );
+
+    using execution_space = typename DeviceType::execution_space;
+
+    // Create the local mesh.
+    auto local_mesh =
+        createLocalMesh<DeviceType>( *( field.array.layout()->localGrid() ) );
+
+    // Pack the functors, array views, and a scatter view of each array so
+    // one kernel can apply them all with shared spline data.
+    auto functor_pack =
+        Cabana::makeParameterPack( field.functor, fields.functor... );
+    auto view_pack =
+        Cabana::makeParameterPack( field.array.view(), fields.array.view()... );
+    auto scatter_pack = Cabana::makeParameterPack(
+        Kokkos::Experimental::create_scatter_view( field.array.view() ),
+        Kokkos::Experimental::create_scatter_view( fields.array.view() )... );
+
+    // Loop over points and interpolate each field to the grid.
+    Kokkos::parallel_for(
+        "p2g_fused", Kokkos::RangePolicy<execution_space>( 0, num_point ),
+        KOKKOS_LAMBDA( const int p ) {
+            // Get the point coordinates.
+            mesh_scalar px[num_space_dim];
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+            {
+                px[d] = points( p, d );
+            }
+
+            // Create the local spline data shared by all fields.
+            using sd_type = SplineData<mesh_scalar, SplineOrder, num_space_dim,
+                                       entity_type>;
+            sd_type sd;
+            evaluateSpline( local_mesh, px, sd );
+
+            // Evaluate each field's functor.
+            applyInterpolationFields(
+                sd, p, functor_pack, scatter_pack,
+                std::make_index_sequence<1 + sizeof...( FieldTypes )>() );
+        } );
+    contributeInterpolationFields(
+        view_pack, scatter_pack,
+        std::make_index_sequence<1 + sizeof...( FieldTypes )>() );
+
+    // Scatter interpolation contributions of all fields in the halo back to
+    // their owning ranks in a single communication.
+    halo.scatter( execution_space(), ScatterReduce::Sum(), field.array,
+                  fields.array... );
+}
+
+//---------------------------------------------------------------------------//
+// Fused gather-push-scatter pipeline.
+//---------------------------------------------------------------------------//
+/*!
+  \brief A group of interpolation fields interpolated together in one phase
+  of a fused pipeline.
+
+  \tparam FieldTypes The interpolation field types of the group.
+*/
+template <class... FieldTypes>
+struct InterpolationFieldGroup
+{
+    //! The number of fields in the group.
+    static constexpr std::size_t num_field = sizeof...( FieldTypes );
+
+    //! The fields of the group.
+    std::tuple<FieldTypes...> fields;
+};
+
+//! Creation function for a group of interpolation fields.
+template <class... FieldTypes>
+InterpolationFieldGroup<FieldTypes...>
+createInterpolationFieldGroup( const FieldTypes&... fields )
+{
+    return InterpolationFieldGroup<FieldTypes...>{
+        std::tuple<FieldTypes...>( fields... ) };
+}
+
+//! \cond Impl
+// Pack the functors of a field group for use in a fused kernel.
+template <class GroupType, std::size_t... Is>
+auto interpolationFunctorPack( const GroupType& group,
+                               std::index_sequence<Is...> )
+{
+    return Cabana::makeParameterPack( std::get<Is>( group.fields ).functor... );
+}
+
+// Pack the array views of a field group for use in a fused kernel.
+template <class GroupType, std::size_t... Is>
+auto interpolationViewPack( const GroupType& group,
+                            std::index_sequence<Is...> )
+{
+    return Cabana::makeParameterPack(
+        std::get<Is>( group.fields ).array.view()... );
+}
+
+// Pack a scatter view of each array of a field group for use in a fused
+// kernel.
+template <class GroupType, std::size_t... Is>
+auto interpolationScatterPack( const GroupType& group,
+                               std::index_sequence<Is...> )
+{
+    return Cabana::makeParameterPack(
+        Kokkos::Experimental::create_scatter_view(
+            std::get<Is>( group.fields ).array.view() )... );
+}
+
+// Gather the arrays of a field group in a single communication.
+template <class ExecutionSpace, class DeviceType, class GroupType,
+          std::size_t... Is>
+void gatherInterpolationFields( const ExecutionSpace& exec_space,
+                                const Halo<DeviceType>& halo,
+                                const GroupType& group,
+                                std::index_sequence<Is...> )
+{
+    halo.gather( exec_space, std::get<Is>( group.fields ).array... );
+}
+
+// Scatter the arrays of a field group in a single communication.
+template <class ExecutionSpace, class DeviceType, class GroupType,
+          std::size_t... Is>
+void scatterInterpolationFields( const ExecutionSpace& exec_space,
+                                 const Halo<DeviceType>& halo,
+                                 const GroupType& group,
+                                 std::index_sequence<Is...> )
+{
+    halo.scatter( exec_space, ScatterReduce::Sum(),
+                  std::get<Is>( group.fields ).array... );
+}
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Fused grid-to-point, point kernel, and point-to-grid pipeline.
+
+  Executes one particle-in-cell substep - gather grid fields to the points,
+  advance the points, scatter point fields back to the grid - in a single
+  kernel launch per point. Run separately the three phases each stream the
+  full particle data through memory and each re-evaluate the per-point
+  spline; fused, the spline data is evaluated once per point and the
+  intermediate point fields written by the gather are still cache-resident
+  when the push and the scatter read them, eliminating two full
+  particle-array round trips per step.
+
+  The spline data is evaluated from the point coordinates at entry and is
+  shared by all three phases, so the scatter deposits through the same
+  stencil the gather read. A push that moves the points therefore must
+  deposit before the move takes effect on the grid - the standard PIC
+  ordering in which the coordinate update applies to the next step's
+  stencil.
+
+  \param gather_halo The halo associated with the gathered grid arrays. Must
+  have been created with the arrays of the gather group in their group
+  order.
+
+  \param scatter_halo The halo associated with the scattered grid arrays.
+  Must have been created with the arrays of the scatter group in their group
+  order.
+
+  \param points The points over which to perform the interpolation. Will be
+  indexed as (point,dim). The subset of indices in each point's interpolation
+  stencil must be contained within the local grid that will be used for the
+  interpolation
+
+  \param num_point The number of points. This is the size of the first
+  dimension of points.
+
+  \param gather_fields The group of fields interpolated from the grid to the
+  points before the push. Create the group with
+  createInterpolationFieldGroup from grid-to-point interpolation fields.
+
+  \param push_functor The point kernel executed between the gather and the
+  scatter. Called once per point with the shared spline data and the point
+  index:
+
+  \code
+  void operator() ( const SplineDataType& sd, const int p ) const ;
+  \endcode
+
+  It reads the point fields written by the gather functors and writes the
+  point fields read by the scatter functors.
+
+  \param scatter_fields The group of fields interpolated from the points to
+  the grid after the push. Create the group with
+  createInterpolationFieldGroup from point-to-grid interpolation fields.
+
+  \note Spline of SplineOrder passed for interpolation.
+*/
+template <class PointCoordinates, int SplineOrder, class DeviceType,
+          class PushFunctor, class... GatherFields, class... ScatterFields>
+void g2p_push_p2g(
+    const Halo<DeviceType>& gather_halo, const Halo<DeviceType>& scatter_halo,
+    const PointCoordinates& points, const std::size_t num_point,
+    Spline<SplineOrder>,
+    const InterpolationFieldGroup<GatherFields...>& gather_fields,
+    const PushFunctor& push_functor,
+    const InterpolationFieldGroup<ScatterFields...>& scatter_fields )
+{
+    static_assert( sizeof...( GatherFields ) > 0,
+                   "Fused pipeline requires at least one gathered field" );
+    static_assert( sizeof...( ScatterFields ) > 0,
+                   "Fused pipeline requires at least one scattered field" );
+
+    using gather_group = InterpolationFieldGroup<GatherFields...>;
+    using scatter_group = InterpolationFieldGroup<ScatterFields...>;
+    using array_type = typename std::tuple_element<
+        0, std::tuple<GatherFields...>>::type::array_type;
+    using entity_type = typename array_type::entity_type;
+    using mesh_type = typename array_type::mesh_type;
+    static_assert( isUniformMesh<mesh_type>::value,
+                   "Fused interpolation requires a uniform mesh" );
+    using mesh_scalar = typename mesh_type::scalar_type;
+    constexpr std::size_t num_space_dim = mesh_type::num_space_dim;
+
+    static_assert(
+        interpolationAllTrue<
+            std::is_same<typename GatherFields::array_type::entity_type,
+                         entity_type>::value...,
+            std::is_same<typename ScatterFields::array_type::entity_type,
+                         entity_type>::value...>::value,
+        "Fused interpolation fields must share an entity type" );
+    static_assert(
+        interpolationAllTrue<
+            std::is_same<typename GatherFields::array_type::mesh_type,
+                         mesh_type>::value...,
+            std::is_same<typename ScatterFields::array_type::mesh_type,
+                         mesh_type>::value...>::value,
+        "Fused interpolation fields must share a mesh type" );
+    static_assert( std::is_same<typename Halo<DeviceType>::memory_space,
+                                typename array_type::memory_space>::value,
+                   "Mismatching points/array memory space." );
+
+    using execution_space = typename DeviceType::execution_space;
+
+    auto gather_seq = std::make_index_sequence<gather_group::num_field>();
+    auto scatter_seq = std::make_index_sequence<scatter_group::num_field>();
+
+    // Create the local mesh.
+    auto local_mesh = createLocalMesh<DeviceType>(
+        *( std::get<0>( gather_fields.fields ).array.layout()->localGrid() ) );
+
+    // Gather all read fields into the halo in a single communication before
+    // the pipeline runs.
+    gatherInterpolationFields( execution_space(), gather_halo, gather_fields,
+                               gather_seq );
+
+    // Pack the functors, array views, and a scatter view of each written
+    // array so one kernel can run all three phases with shared spline data.
+    auto gather_functors = interpolationFunctorPack( gather_fields,
+                                                     gather_seq );
+    auto gather_views = interpolationViewPack( gather_fields, gather_seq );
+    auto scatter_functors = interpolationFunctorPack( scatter_fields,
+                                                      scatter_seq );
+    auto scatter_views = interpolationViewPack( scatter_fields, scatter_seq );
+    auto scatter_svs = interpolationScatterPack( scatter_fields, scatter_seq );
+
+    // Loop over points and run gather, push, and scatter back-to-back.
+    Kokkos::parallel_for(
+        "g2p_push_p2g", Kokkos::RangePolicy<execution_space>( 0, num_point ),
+        KOKKOS_LAMBDA( const int p ) {
+            // Get the point coordinates.
+            mesh_scalar px[num_space_dim];
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+            {
+                px[d] = points( p, d );
+            }
+
+            // Create the local spline data shared by all three phases.
+            using sd_type = SplineData<mesh_scalar, SplineOrder, num_space_dim,
+                                       entity_type>;
+            sd_type sd;
+            evaluateSpline( local_mesh, px, sd );
+
+            // Gather each read field from the grid to the point.
+            applyInterpolationFields(
+                sd, p, gather_functors, gather_views,
+                std::make_index_sequence<gather_group::num_field>() );
+
+            // Advance the point.
+            push_functor( sd, p );
+
+            // Scatter each written field from the point to the grid.
+            applyInterpolationFields(
+                sd, p, scatter_functors, scatter_svs,
+                std::make_index_sequence<scatter_group::num_field>() );
+        } );
+    contributeInterpolationFields( scatter_views, scatter_svs, scatter_seq );
+
+    // Scatter the deposited fields in the halo back to their owning ranks in
+    // a single communication.
+    scatterInterpolationFields( execution_space(), scatter_halo,
+                                scatter_fields, scatter_seq );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cajita
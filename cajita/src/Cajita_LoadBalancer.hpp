@@ -0,0 +1,499 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cajita_LoadBalancer.hpp
+  \brief Particle-driven dynamic load balancing of the grid decomposition
+*/
+#ifndef CAJITA_LOADBALANCER_HPP
+#define CAJITA_LOADBALANCER_HPP
+
+#include <Cajita_Array.hpp>
+#include <Cajita_GlobalGrid.hpp>
+#include <Cajita_IndexSpace.hpp>
+#include <Cajita_LocalGrid.hpp>
+#include <Cajita_ParticleGridDistributor.hpp>
+#include <Cajita_SparseDimPartitioner.hpp>
+#include <Cajita_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Cajita
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Particle-driven dynamic load balancer for a block-partitioned grid.
+
+  Closes the loop between workload measurement and the decomposition: each
+  rebalance bins the particles into tiles, optimizes the rectilinear
+  partition with the tile workloads, moves the cell ownership of the
+  existing block grid to the new boundaries, rebuilds the local grid, and
+  migrates the particles into the new decomposition. Grid arrays built on
+  the old decomposition can be carried over with redistribute().
+
+  The balancer owns the decomposition of its global grid from construction
+  on: the constructor replaces the initial near-uniform partition with a
+  tile-aligned one so the partitioner and the grid always agree. Partition
+  boundaries move by entire tiles and the block grid topology never
+  changes, so after each rebalance particles are expected to land in their
+  old block or one of its neighbors, which is what the particle migration
+  assumes.
+
+  \tparam Device Kokkos device type.
+  \tparam MeshType Mesh type - must be a 3D uniform mesh.
+  \tparam CellPerTileDim Cells per tile per dimension of the workload
+  binning. Larger tiles coarsen the boundary granularity and shrink the
+  workload views.
+*/
+template <class Device, class MeshType, unsigned long long CellPerTileDim = 4>
+class LoadBalancer
+{
+  public:
+    //! Kokkos device type.
+    using device_type = Device;
+    //! Kokkos memory space.
+    using memory_space = typename Device::memory_space;
+    //! Kokkos execution space.
+    using execution_space = typename Device::execution_space;
+    //! Mesh type.
+    using mesh_type = MeshType;
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = mesh_type::num_space_dim;
+    //! Partitioner type used for the workload optimization.
+    using partitioner_type = SparseDimPartitioner<Device, CellPerTileDim>;
+    //! Local grid type produced by a rebalance.
+    using local_grid_type = LocalGrid<MeshType>;
+
+    static_assert( 3 == num_space_dim,
+                   "Load balancing requires a 3D mesh" );
+
+    /*!
+      \brief Constructor.
+
+      \param global_grid The global grid to balance. The initial
+      decomposition is immediately replaced with a tile-aligned near-uniform
+      partition.
+
+      \param halo_width Halo width of the local grids built by the
+      balancer.
+
+      \param max_workload_coeff Threshold factor on the average workload
+      above which the partition optimization keeps iterating.
+
+      \param workload_num Total workload used to compute the optimization
+      threshold - typically the global particle number.
+
+      \param max_optimize_iteration Max iteration number of each partition
+      optimization.
+
+      The global number of cells must be divisible by the tile size in
+      every dimension so partition boundaries can be expressed in whole
+      tiles.
+    */
+    LoadBalancer( const std::shared_ptr<GlobalGrid<MeshType>>& global_grid,
+                  const int halo_width, const float max_workload_coeff,
+                  const int workload_num,
+                  const int max_optimize_iteration = 10 )
+        : _global_grid( global_grid )
+        , _halo_width( halo_width )
+    {
+        // The partitioner works in tiles - the global cells must tile
+        // evenly.
+        std::array<int, 3> global_num_cell;
+        std::array<int, 3> ranks_per_dim;
+        for ( int d = 0; d < 3; ++d )
+        {
+            global_num_cell[d] = _global_grid->globalNumEntity( Cell(), d );
+            ranks_per_dim[d] = _global_grid->dimNumBlock( d );
+            if ( global_num_cell[d] %
+                 partitioner_type::cell_num_per_tile_dim )
+                throw std::runtime_error(
+                    "Global cells must be divisible by the tile size" );
+        }
+
+        // The partitioner never rebalances on its own schedule here - the
+        // caller decides when to rebalance - so the step count is unused.
+        _partitioner = std::make_shared<partitioner_type>(
+            max_workload_coeff, workload_num, 1, ranks_per_dim,
+            global_num_cell, max_optimize_iteration );
+
+        // Seed a tile-aligned near-uniform partition and make it the grid
+        // decomposition so the partitioner and the grid agree.
+        std::array<std::vector<int>, 3> tile_partition;
+        for ( int d = 0; d < 3; ++d )
+        {
+            int num_tile = global_num_cell[d] /
+                           partitioner_type::cell_num_per_tile_dim;
+            for ( int r = 0; r < ranks_per_dim[d]; ++r )
+                tile_partition[d].push_back( r * num_tile /
+                                             ranks_per_dim[d] );
+            tile_partition[d].push_back( num_tile );
+        }
+        _partitioner->initializeRecPartition(
+            tile_partition[0], tile_partition[1], tile_partition[2] );
+        _cell_boundaries = cellBoundaries();
+        _global_grid->setOwnedCells( _cell_boundaries );
+        _local_grid = createLocalGrid( _global_grid, _halo_width );
+    }
+
+    //! Get the local grid of the current decomposition.
+    std::shared_ptr<local_grid_type> localGrid() const { return _local_grid; }
+
+    /*!
+      \brief Rebalance the decomposition from particle positions and
+      migrate the particles.
+
+      \param positions Particle positions - a slice or view accessed as
+      positions(p,d).
+
+      \param particles The particle AoSoA holding the positions.
+
+      \return The local grid of the new decomposition. Also returned by
+      localGrid() until the next rebalance.
+
+      Bins the particles into per-tile workloads, optimizes the partition,
+      moves the cell ownership of the block grid, rebuilds the local grid
+      and migrates all particles that left their block into the new owning
+      block. Grid arrays built before the call still hold the old
+      decomposition's data - carry each one over with redistribute() before
+      using it on the new local grid.
+    */
+    template <class PositionType, class ParticleContainer>
+    std::shared_ptr<local_grid_type> rebalance( PositionType positions,
+                                                ParticleContainer& particles )
+    {
+        // Measure the workload and optimize the partition.
+        const auto& global_mesh = _global_grid->globalMesh();
+        std::array<double, 3> low_corner;
+        for ( int d = 0; d < 3; ++d )
+            low_corner[d] = global_mesh.lowCorner( d );
+        _partitioner->optimizePartition(
+            positions, positions.size(), low_corner,
+            global_mesh.cellSize( 0 ), _global_grid->comm() );
+
+        // Move the cell ownership to the new boundaries and rebuild the
+        // local grid. Keep the old boundaries so arrays can still be
+        // redistributed from the old decomposition.
+        _prev_cell_boundaries = _cell_boundaries;
+        _cell_boundaries = cellBoundaries();
+        _global_grid->setOwnedCells( _cell_boundaries );
+        _local_grid = createLocalGrid( _global_grid, _halo_width );
+
+        // Migrate the particles into the new decomposition. Boundaries
+        // move by tiles between neighboring blocks, so the neighbor
+        // topology of the grid migration covers the moved particles.
+        particleGridMigrate( *_local_grid, positions, particles, _halo_width,
+                             true );
+
+        return _local_grid;
+    }
+
+    /*!
+      \brief Redistribute a grid array from the previous decomposition to
+      the current one.
+
+      \param old_array Array built on the decomposition that the last
+      rebalance() replaced.
+
+      \return A new array on the current decomposition holding the owned
+      data of the old one. Ghost values are not carried over - gather them
+      with a halo on the new decomposition.
+    */
+    template <class Array_t>
+    std::shared_ptr<Array<typename Array_t::value_type,
+                          typename Array_t::entity_type, mesh_type, Device>>
+    redistribute( const Array_t& old_array ) const
+    {
+        using entity_type = typename Array_t::entity_type;
+        using value_type = typename Array_t::value_type;
+
+        // Create the array on the current decomposition.
+        auto new_layout = createArrayLayout(
+            _local_grid, old_array.layout()->dofsPerEntity(), entity_type() );
+        auto new_array = createArray<value_type, Device>( old_array.label(),
+                                                          new_layout );
+        int dofs = old_array.layout()->dofsPerEntity();
+
+        // Owned global entity ranges of every block under the old and new
+        // boundaries. Both decompositions are known on every rank, so the
+        // block intersections are computed locally.
+        auto old_ranges = ownedEntityRanges<entity_type>(
+            _prev_cell_boundaries );
+        auto new_ranges = ownedEntityRanges<entity_type>( _cell_boundaries );
+
+        // Local index of the first owned entity. The low halo width does
+        // not depend on the decomposition, so the new local grid gives the
+        // same offsets the old one did.
+        auto own_local_space =
+            _local_grid->indexSpace( Own(), entity_type(), Local() );
+        std::array<int, 3> local_min;
+        for ( int d = 0; d < 3; ++d )
+            local_min[d] = own_local_space.min( d );
+
+        // Stage through the host: pack one buffer per receiving block from
+        // the old data, exchange, and unpack into the new array.
+        auto old_view_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), old_array.view() );
+        auto new_view_host =
+            Kokkos::create_mirror_view( new_array->view() );
+
+        std::array<int, 3> my_block;
+        for ( int d = 0; d < 3; ++d )
+            my_block[d] = _global_grid->dimBlockId( d );
+
+        // Post the receives for the intersections of my new range with
+        // every block's old range.
+        std::vector<std::vector<value_type>> recv_buffers;
+        std::vector<MPI_Request> recv_requests;
+        std::vector<std::array<std::array<int, 2>, 3>> recv_boxes;
+        forEachIntersection(
+            new_ranges, my_block, old_ranges,
+            [&]( const std::array<int, 3>& block,
+                 const std::array<std::array<int, 2>, 3>& box ) {
+                int rank = _global_grid->blockRank( block );
+                std::size_t num_value = boxSize( box ) * dofs;
+                if ( rank == _global_grid->blockRank( my_block ) )
+                    return;
+                recv_buffers.emplace_back( num_value );
+                recv_boxes.push_back( box );
+                recv_requests.push_back( MPI_REQUEST_NULL );
+                MPI_Irecv( recv_buffers.back().data(),
+                           num_value * sizeof( value_type ), MPI_BYTE, rank,
+                           mpi_tag, _global_grid->comm(),
+                           &recv_requests.back() );
+            } );
+
+        // Pack and send the intersections of my old range with every
+        // block's new range. The overlap with my own new range is copied
+        // directly.
+        std::vector<std::vector<value_type>> send_buffers;
+        std::vector<MPI_Request> send_requests;
+        forEachIntersection(
+            old_ranges, my_block, new_ranges,
+            [&]( const std::array<int, 3>& block,
+                 const std::array<std::array<int, 2>, 3>& box ) {
+                int rank = _global_grid->blockRank( block );
+                if ( rank == _global_grid->blockRank( my_block ) )
+                {
+                    // Self overlap - copy from the old view to the new.
+                    for ( int i = box[0][0]; i < box[0][1]; ++i )
+                        for ( int j = box[1][0]; j < box[1][1]; ++j )
+                            for ( int k = box[2][0]; k < box[2][1]; ++k )
+                                for ( int n = 0; n < dofs; ++n )
+                                    new_view_host(
+                                        i - new_ranges[0][my_block[0]][0] +
+                                            local_min[0],
+                                        j - new_ranges[1][my_block[1]][0] +
+                                            local_min[1],
+                                        k - new_ranges[2][my_block[2]][0] +
+                                            local_min[2],
+                                        n ) =
+                                        old_view_host(
+                                            i - old_ranges[0][my_block[0]]
+                                                    [0] +
+                                                local_min[0],
+                                            j - old_ranges[1][my_block[1]]
+                                                    [0] +
+                                                local_min[1],
+                                            k - old_ranges[2][my_block[2]]
+                                                    [0] +
+                                                local_min[2],
+                                            n );
+                    return;
+                }
+                send_buffers.emplace_back( boxSize( box ) * dofs );
+                auto& buffer = send_buffers.back();
+                std::size_t b = 0;
+                for ( int i = box[0][0]; i < box[0][1]; ++i )
+                    for ( int j = box[1][0]; j < box[1][1]; ++j )
+                        for ( int k = box[2][0]; k < box[2][1]; ++k )
+                            for ( int n = 0; n < dofs; ++n )
+                                buffer[b++] = old_view_host(
+                                    i - old_ranges[0][my_block[0]][0] +
+                                        local_min[0],
+                                    j - old_ranges[1][my_block[1]][0] +
+                                        local_min[1],
+                                    k - old_ranges[2][my_block[2]][0] +
+                                        local_min[2],
+                                    n );
+                send_requests.push_back( MPI_REQUEST_NULL );
+                MPI_Isend( buffer.data(),
+                           buffer.size() * sizeof( value_type ), MPI_BYTE,
+                           rank, mpi_tag, _global_grid->comm(),
+                           &send_requests.back() );
+            } );
+
+        // Unpack the received intersections. Sender and receiver walk each
+        // intersection box in the same global order.
+        for ( std::size_t r = 0; r < recv_requests.size(); ++r )
+        {
+            MPI_Wait( &recv_requests[r], MPI_STATUS_IGNORE );
+            const auto& box = recv_boxes[r];
+            const auto& buffer = recv_buffers[r];
+            std::size_t b = 0;
+            for ( int i = box[0][0]; i < box[0][1]; ++i )
+                for ( int j = box[1][0]; j < box[1][1]; ++j )
+                    for ( int k = box[2][0]; k < box[2][1]; ++k )
+                        for ( int n = 0; n < dofs; ++n )
+                            new_view_host(
+                                i - new_ranges[0][my_block[0]][0] +
+                                    local_min[0],
+                                j - new_ranges[1][my_block[1]][0] +
+                                    local_min[1],
+                                k - new_ranges[2][my_block[2]][0] +
+                                    local_min[2],
+                                n ) = buffer[b++];
+        }
+        MPI_Waitall( send_requests.size(), send_requests.data(),
+                     MPI_STATUSES_IGNORE );
+
+        Kokkos::deep_copy( new_array->view(), new_view_host );
+        return new_array;
+    }
+
+    //! \cond Impl
+    // Convert the partitioner's tile boundaries to cell boundaries.
+    std::array<std::vector<int>, 3> cellBoundaries() const
+    {
+        auto tile_partition = _partitioner->getCurrentPartition();
+        std::array<std::vector<int>, 3> boundaries;
+        for ( int d = 0; d < 3; ++d )
+        {
+            boundaries[d].resize( tile_partition[d].size() );
+            for ( std::size_t r = 0; r < tile_partition[d].size(); ++r )
+                boundaries[d][r] =
+                    tile_partition[d][r] *
+                    partitioner_type::cell_num_per_tile_dim;
+        }
+        return boundaries;
+    }
+
+    // Owned global entity index ranges [min,max) of every block in every
+    // dimension under the given cell boundaries. The last block of a
+    // dimension owns the final boundary entity when one exists (e.g. nodes
+    // in non-periodic dimensions).
+    template <class EntityType>
+    std::array<std::vector<std::array<int, 2>>, 3>
+    ownedEntityRanges(
+        const std::array<std::vector<int>, 3>& cell_boundaries ) const
+    {
+        std::array<std::vector<std::array<int, 2>>, 3> ranges;
+        for ( int d = 0; d < 3; ++d )
+        {
+            int num_block = _global_grid->dimNumBlock( d );
+            int num_extra =
+                _global_grid->globalNumEntity( EntityType(), d ) -
+                _global_grid->globalNumEntity( Cell(), d );
+            ranges[d].resize( num_block );
+            for ( int r = 0; r < num_block; ++r )
+            {
+                ranges[d][r][0] = cell_boundaries[d][r];
+                ranges[d][r][1] = cell_boundaries[d][r + 1];
+                if ( num_block - 1 == r )
+                    ranges[d][r][1] += num_extra;
+            }
+        }
+        return ranges;
+    }
+
+    // Apply a functor to the intersection of one block's range from the
+    // first decomposition with every block's range from the second.
+    template <class Functor>
+    void forEachIntersection(
+        const std::array<std::vector<std::array<int, 2>>, 3>& my_ranges,
+        const std::array<int, 3>& my_block,
+        const std::array<std::vector<std::array<int, 2>>, 3>& other_ranges,
+        Functor&& functor ) const
+    {
+        std::array<int, 3> block;
+        for ( block[0] = 0; block[0] < _global_grid->dimNumBlock( 0 );
+              ++block[0] )
+            for ( block[1] = 0; block[1] < _global_grid->dimNumBlock( 1 );
+                  ++block[1] )
+                for ( block[2] = 0;
+                      block[2] < _global_grid->dimNumBlock( 2 ); ++block[2] )
+                {
+                    std::array<std::array<int, 2>, 3> box;
+                    bool empty = false;
+                    for ( int d = 0; d < 3; ++d )
+                    {
+                        box[d][0] =
+                            std::max( my_ranges[d][my_block[d]][0],
+                                      other_ranges[d][block[d]][0] );
+                        box[d][1] =
+                            std::min( my_ranges[d][my_block[d]][1],
+                                      other_ranges[d][block[d]][1] );
+                        if ( box[d][0] >= box[d][1] )
+                            empty = true;
+                    }
+                    if ( !empty )
+                        functor( block, box );
+                }
+    }
+
+    // Number of entities in an intersection box.
+    static std::size_t
+    boxSize( const std::array<std::array<int, 2>, 3>& box )
+    {
+        std::size_t size = 1;
+        for ( int d = 0; d < 3; ++d )
+            size *= box[d][1] - box[d][0];
+        return size;
+    }
+
+    // Message tag of the array redistribution.
+    static constexpr int mpi_tag = 1401;
+    //! \endcond
+
+  private:
+    std::shared_ptr<GlobalGrid<MeshType>> _global_grid;
+    int _halo_width;
+    std::shared_ptr<partitioner_type> _partitioner;
+    std::shared_ptr<local_grid_type> _local_grid;
+    std::array<std::vector<int>, 3> _cell_boundaries;
+    std::array<std::vector<int>, 3> _prev_cell_boundaries;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a load balancer.
+  \param global_grid The global grid to balance.
+  \param halo_width Halo width of the local grids built by the balancer.
+  \param max_workload_coeff Threshold factor on the average workload above
+  which the partition optimization keeps iterating.
+  \param workload_num Total workload used to compute the optimization
+  threshold.
+  \param max_optimize_iteration Max iteration number of each partition
+  optimization.
+*/
+template <class Device, class MeshType>
+std::shared_ptr<LoadBalancer<Device, MeshType>>
+createLoadBalancer( const std::shared_ptr<GlobalGrid<MeshType>>& global_grid,
+                    const int halo_width, const float max_workload_coeff,
+                    const int workload_num,
+                    const int max_optimize_iteration = 10 )
+{
+    return std::make_shared<LoadBalancer<Device, MeshType>>(
+        global_grid, halo_width, max_workload_coeff, workload_num,
+        max_optimize_iteration );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cajita
+
+#endif // end CAJITA_LOADBALANCER_HPP
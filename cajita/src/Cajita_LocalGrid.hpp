@@ -23,6 +23,7 @@
 #include <array>
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace Cajita
@@ -110,11 +111,34 @@ class LocalGrid
       \param t1 Decomposition type: Own or Ghost
       \param t2 Entity type: Cell, Node, Edge, or Face
       \param t3 Index type: Local or Global
+
+      \note The computed index space is memoized at first use so repeated
+      queries are O(1) hash lookups.
     */
     template <class DecompositionTag, class EntityType, class IndexType>
     IndexSpace<num_space_dim> indexSpace( DecompositionTag t1, EntityType t2,
                                           IndexType t3 ) const;
 
+    /*!
+      \brief Get the contiguous set of local indices spanning the owned
+      entities plus the given number of halo cells of ghosted entities.
+
+      \param t1 Decomposition type: Ghost
+      \param t2 Entity type: Cell, Node, Edge, or Face
+      \param t3 Index type: Local
+      \param halo_width Depth of ghosted entities to include. Must be less
+      than or equal to the halo width of the local grid.
+
+      This is the update range of wide-halo (communication-avoiding)
+      schemes: after a halo exchange of width k, a stencil step that
+      updates the owned entities plus the innermost k-1 ghost cells leaves
+      valid ghosts for the next step to read, so the exchange is needed
+      only every k steps.
+    */
+    template <class EntityType>
+    IndexSpace<num_space_dim> indexSpace( Ghost t1, EntityType t2, Local t3,
+                                          const int halo_width ) const;
+
     /*!
       \brief Given the relative offsets of a neighbor rank relative to this
       local grid's indices get the set of local entity indices shared with that
@@ -452,9 +476,35 @@ class LocalGrid
     edgeSharedIndexSpace( Ghost, Edge<Dir>, const std::array<int, 3>& off_ijk,
                           const int halo_width ) const;
 
+    // Cache key codes for the decomposition, entity, and index type tags of
+    // memoized index space queries. The decomposition and index type codes
+    // occupy separate key fields so they may overlap.
+    static constexpr int cacheCode( Own ) { return 0; }
+    static constexpr int cacheCode( Ghost ) { return 1; }
+    static constexpr int cacheCode( Local ) { return 0; }
+    static constexpr int cacheCode( Global ) { return 1; }
+    static constexpr int cacheCode( Cell ) { return 0; }
+    static constexpr int cacheCode( Node ) { return 1; }
+    template <int Dir>
+    static constexpr int cacheCode( Face<Dir> )
+    {
+        return 2 + Dir;
+    }
+    template <int Dir>
+    static constexpr int cacheCode( Edge<Dir> )
+    {
+        return 5 + Dir;
+    }
+
   private:
     std::shared_ptr<GlobalGrid<MeshType>> _global_grid;
     int _halo_cell_width;
+
+    // Memoized index space queries. Keyed on the encoded query category,
+    // decomposition, entity, and index types plus the neighbor offsets and
+    // halo width for shared and boundary spaces.
+    mutable std::unordered_map<long, IndexSpace<num_space_dim>>
+        _index_space_cache;
 };
 
 //---------------------------------------------------------------------------//
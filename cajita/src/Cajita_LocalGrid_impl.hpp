@@ -91,7 +91,58 @@ auto LocalGrid<MeshType>::indexSpace( DecompositionTag t1, EntityType t2,
                                       IndexType t3 ) const
     -> IndexSpace<num_space_dim>
 {
-    return indexSpaceImpl( t1, t2, t3 );
+    // Check the cache for a memoized result.
+    long key = 0;
+    key = key * 8 + cacheCode( t2 );
+    key = key * 2 + cacheCode( t1 );
+    key = key * 2 + cacheCode( t3 );
+    auto cached = _index_space_cache.find( key );
+    if ( cached != _index_space_cache.end() )
+        return cached->second;
+
+    // Compute and memoize the index space.
+    auto space = indexSpaceImpl( t1, t2, t3 );
+    _index_space_cache.emplace( key, space );
+    return space;
+}
+
+//---------------------------------------------------------------------------//
+// Get the index space of the owned entities plus the given number of halo
+// cells of ghosted entities. This is the range a stencil step updates in
+// wide-halo schemes that refresh deep ghosts locally between exchanges.
+template <class MeshType>
+template <class EntityType>
+auto LocalGrid<MeshType>::indexSpace( Ghost, EntityType t2, Local,
+                                      const int halo_width ) const
+    -> IndexSpace<num_space_dim>
+{
+    // Check that the requested halo width is valid.
+    if ( halo_width < 0 || halo_width > _halo_cell_width )
+        throw std::logic_error(
+            "Requested halo width larger than local grid halo" );
+
+    // Check the cache for a memoized result.
+    long key = 3;
+    key = key * 8 + cacheCode( t2 );
+    key = key * 256 + halo_width;
+    auto cached = _index_space_cache.find( key );
+    if ( cached != _index_space_cache.end() )
+        return cached->second;
+
+    // Dilate the owned index space by the requested number of halo
+    // cells. The halo width check above guarantees the result is within
+    // the ghosted allocation for every entity type.
+    auto own_space = indexSpaceImpl( Own(), t2, Local() );
+    std::array<long, num_space_dim> min;
+    std::array<long, num_space_dim> max;
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+    {
+        min[d] = own_space.min( d ) - halo_width;
+        max[d] = own_space.max( d ) + halo_width;
+    }
+    IndexSpace<num_space_dim> space( min, max );
+    _index_space_cache.emplace( key, space );
+    return space;
 }
 
 //---------------------------------------------------------------------------//
@@ -132,8 +183,21 @@ auto LocalGrid<MeshType>::sharedIndexSpace(
         return IndexSpace<num_space_dim>( zero_size, zero_size );
     }
 
-    // Call the underlying implementation.
-    return sharedIndexSpaceImpl( t1, t2, off_ijk, hw );
+    // Check the cache for a memoized result.
+    long key = 1;
+    key = key * 8 + cacheCode( t2 );
+    key = key * 2 + cacheCode( t1 );
+    key = key * 256 + hw;
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+        key = key * 3 + ( off_ijk[d] + 1 );
+    auto cached = _index_space_cache.find( key );
+    if ( cached != _index_space_cache.end() )
+        return cached->second;
+
+    // Compute and memoize the shared index space.
+    auto space = sharedIndexSpaceImpl( t1, t2, off_ijk, hw );
+    _index_space_cache.emplace( key, space );
+    return space;
 }
 
 template <class MeshType>
@@ -197,9 +261,22 @@ auto LocalGrid<MeshType>::boundaryIndexSpace(
         return IndexSpace<num_space_dim>( zero_size, zero_size );
     }
 
+    // Check the cache for a memoized result.
+    long key = 2;
+    key = key * 8 + cacheCode( t2 );
+    key = key * 2 + cacheCode( t1 );
+    key = key * 256 + hw;
+    for ( std::size_t d = 0; d < num_space_dim; ++d )
+        key = key * 3 + ( off_ijk[d] + 1 );
+    auto cached = _index_space_cache.find( key );
+    if ( cached != _index_space_cache.end() )
+        return cached->second;
+
     // The boundary index space is just the shared index space for the
-    // given offsets and decomposition.
-    return sharedIndexSpaceImpl( t1, t2, off_ijk, hw );
+    // given offsets and decomposition. Compute and memoize it.
+    auto space = sharedIndexSpaceImpl( t1, t2, off_ijk, hw );
+    _index_space_cache.emplace( key, space );
+    return space;
 }
 
 template <class MeshType>
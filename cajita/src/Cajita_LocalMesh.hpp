@@ -494,6 +494,30 @@ class LocalMesh<Device, NonUniformMesh<Scalar, NumSpaceDim>>
 
             // Copy edges to the device.
             Kokkos::deep_copy( _local_edges[d], edge_mirror );
+
+            // Precompute cell center and width tables from the edges so hot
+            // kernels read a single dense value per dimension instead of
+            // recomputing from two edge loads on every access.
+            int ncell = nedge - 1;
+            _cell_centers[d] = Kokkos::View<Scalar*, Device>(
+                Kokkos::ViewAllocateWithoutInitializing( "cell_centers" ),
+                ncell );
+            _cell_widths[d] = Kokkos::View<Scalar*, Device>(
+                Kokkos::ViewAllocateWithoutInitializing( "cell_widths" ),
+                ncell );
+            auto center_mirror = Kokkos::create_mirror_view(
+                Kokkos::HostSpace(), _cell_centers[d] );
+            auto width_mirror = Kokkos::create_mirror_view(
+                Kokkos::HostSpace(), _cell_widths[d] );
+            for ( int n = 0; n < ncell; ++n )
+            {
+                center_mirror( n ) =
+                    ( edge_mirror( n + 1 ) + edge_mirror( n ) ) /
+                    Scalar( 2.0 );
+                width_mirror( n ) = edge_mirror( n + 1 ) - edge_mirror( n );
+            }
+            Kokkos::deep_copy( _cell_centers[d], center_mirror );
+            Kokkos::deep_copy( _cell_widths[d], width_mirror );
         }
 
         // Periodicity
@@ -578,9 +602,7 @@ class LocalMesh<Device, NonUniformMesh<Scalar, NumSpaceDim>>
                       Scalar x[num_space_dim] ) const
     {
         for ( std::size_t d = 0; d < num_space_dim; ++d )
-            x[d] = ( _local_edges[d]( index[d] + 1 ) +
-                     _local_edges[d]( index[d] ) ) /
-                   Scalar( 2.0 );
+            x[d] = _cell_centers[d]( index[d] );
     }
 
     /*!
@@ -614,9 +636,7 @@ class LocalMesh<Device, NonUniformMesh<Scalar, NumSpaceDim>>
             if ( Dir == d )
                 x[d] = _local_edges[d]( index[d] );
             else
-                x[d] = ( _local_edges[d]( index[d] + 1 ) +
-                         _local_edges[d]( index[d] ) ) /
-                       Scalar( 2.0 );
+                x[d] = _cell_centers[d]( index[d] );
     }
 
     /*!
@@ -631,9 +651,7 @@ class LocalMesh<Device, NonUniformMesh<Scalar, NumSpaceDim>>
     {
         for ( std::size_t d = 0; d < 3; ++d )
             if ( Dir == d )
-                x[d] = ( _local_edges[d]( index[d] + 1 ) +
-                         _local_edges[d]( index[d] ) ) /
-                       Scalar( 2.0 );
+                x[d] = _cell_centers[d]( index[d] );
             else
                 x[d] = _local_edges[d]( index[d] );
     }
@@ -653,8 +671,7 @@ class LocalMesh<Device, NonUniformMesh<Scalar, NumSpaceDim>>
     KOKKOS_INLINE_FUNCTION std::enable_if_t<3 == NSD, Scalar>
     measure( Edge<Dir>, const int index[3] ) const
     {
-        return _local_edges[Dir][index[Dir] + 1] -
-               _local_edges[Dir][index[Dir]];
+        return _cell_widths[Dir]( index[Dir] );
     }
 
     /*!
@@ -705,8 +722,7 @@ class LocalMesh<Device, NonUniformMesh<Scalar, NumSpaceDim>>
     KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == NSD, Scalar>
     measure( Face<Dim::I>, const int index[2] ) const
     {
-        return _local_edges[Dim::J][index[Dim::J] + 1] -
-               _local_edges[Dim::J][index[Dim::J]];
+        return _cell_widths[Dim::J]( index[Dim::J] );
     }
 
     /*!
@@ -718,8 +734,7 @@ class LocalMesh<Device, NonUniformMesh<Scalar, NumSpaceDim>>
     KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == NSD, Scalar>
     measure( Face<Dim::J>, const int index[2] ) const
     {
-        return _local_edges[Dim::I][index[Dim::I] + 1] -
-               _local_edges[Dim::I][index[Dim::I]];
+        return _cell_widths[Dim::I]( index[Dim::I] );
     }
 
     /*!
@@ -732,7 +747,7 @@ class LocalMesh<Device, NonUniformMesh<Scalar, NumSpaceDim>>
     {
         Scalar m = 1.0;
         for ( std::size_t d = 0; d < num_space_dim; ++d )
-            m *= _local_edges[d][index[d] + 1] - _local_edges[d][index[d]];
+            m *= _cell_widths[d]( index[d] );
         return m;
     }
 
@@ -742,6 +757,8 @@ class LocalMesh<Device, NonUniformMesh<Scalar, NumSpaceDim>>
     Kokkos::Array<Scalar, num_space_dim> _ghost_low_corner;
     Kokkos::Array<Scalar, num_space_dim> _ghost_high_corner;
     Kokkos::Array<Kokkos::View<Scalar*, Device>, num_space_dim> _local_edges;
+    Kokkos::Array<Kokkos::View<Scalar*, Device>, num_space_dim> _cell_centers;
+    Kokkos::Array<Kokkos::View<Scalar*, Device>, num_space_dim> _cell_widths;
     Kokkos::Array<bool, num_space_dim> _periodic;
     Kokkos::Array<bool, num_space_dim> _boundary_lo;
     Kokkos::Array<bool, num_space_dim> _boundary_hi;
@@ -19,7 +19,12 @@
 #include <Cajita_IndexSpace.hpp>
 #include <Cajita_LocalGrid.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Cajita
 {
@@ -395,6 +400,642 @@ grid_parallel_for( const std::string& label, const ExecutionSpace& exec_space,
         } );
 }
 
+//---------------------------------------------------------------------------//
+// Tiled Grid Parallel For
+//---------------------------------------------------------------------------//
+/*!
+  \brief Tile dimensions for tiled iteration over an index space.
+
+  \tparam N The rank of the index space to tile.
+*/
+template <std::size_t N>
+struct TileShape
+{
+    //! Tile extent in each dimension.
+    std::array<long, N> dims;
+};
+
+//! Creation function for a 3d tile shape.
+inline TileShape<3> createTileShape( const long i, const long j, const long k )
+{
+    return TileShape<3>{ { i, j, k } };
+}
+
+//! Creation function for a 2d tile shape.
+inline TileShape<2> createTileShape( const long i, const long j )
+{
+    return TileShape<2>{ { i, j } };
+}
+
+//! \cond Impl
+// Interleave the bits of a tile coordinate to get its Z-curve code.
+template <std::size_t N>
+uint64_t tileMortonCode( const long coords[N] )
+{
+    uint64_t code = 0;
+    for ( std::size_t b = 0; b < 64 / N; ++b )
+        for ( std::size_t d = 0; d < N; ++d )
+            code |= ( ( static_cast<uint64_t>( coords[d] ) >> b ) & 1 )
+                    << ( b * N + d );
+    return code;
+}
+
+// Compute the Z-curve ordering of the tiles of a tiled index space and
+// return it in a view accessible from the given execution space. The entry
+// at each position of the ordering is the cardinal tile index.
+template <class ExecutionSpace, std::size_t N>
+auto createTileOrder( const ExecutionSpace&, const long num_tile[N],
+                      const long total_tile )
+{
+    std::vector<std::pair<uint64_t, long>> codes;
+    codes.reserve( total_tile );
+    long coords[N];
+    for ( long t = 0; t < total_tile; ++t )
+    {
+        long remainder = t;
+        for ( std::size_t d = N; d > 0; --d )
+        {
+            coords[d - 1] = remainder % num_tile[d - 1];
+            remainder /= num_tile[d - 1];
+        }
+        codes.emplace_back( tileMortonCode<N>( coords ), t );
+    }
+    std::sort( codes.begin(), codes.end() );
+
+    Kokkos::View<long*, Kokkos::HostSpace> tile_order_host(
+        Kokkos::ViewAllocateWithoutInitializing( "tile_order" ), total_tile );
+    for ( long t = 0; t < total_tile; ++t )
+        tile_order_host( t ) = codes[t].second;
+    return Kokkos::create_mirror_view_and_copy(
+        typename ExecutionSpace::memory_space(), tile_order_host );
+}
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a functor in parallel over the tiles of the given index
+  space. 3D specialization.
+
+  The index space is partitioned into tiles of the given shape. Each tile is
+  assigned to one work item which iterates the tile interior serially, and
+  the tiles are scheduled along a Z-curve so consecutive tiles touch
+  adjacent data. For cache-size tile shapes this keeps the halo of a stencil
+  kernel resident between tiles on large grids where the default iteration
+  order of a flat multidimensional range streams through memory.
+
+  \tparam FunctorType The functor type to execute.
+
+  \tparam ExecutionSpace The execution space type.
+
+  \param label Parallel region label.
+
+  \param exec_space An execution space instance.
+
+  \param index_space The index space over which to loop.
+
+  \param tile_shape The tile dimensions. Tiles at the high boundary of the
+  index space are clipped to the index space bounds.
+
+  \param functor The functor to execute.
+ */
+template <class FunctorType, class ExecutionSpace>
+inline void grid_parallel_for( const std::string& label,
+                               const ExecutionSpace& exec_space,
+                               const IndexSpace<3>& index_space,
+                               const TileShape<3>& tile_shape,
+                               const FunctorType& functor )
+{
+    // Compute the tile decomposition.
+    long num_tile[3];
+    long total_tile = 1;
+    for ( std::size_t d = 0; d < 3; ++d )
+    {
+        num_tile[d] =
+            ( index_space.extent( d ) + tile_shape.dims[d] - 1 ) /
+            tile_shape.dims[d];
+        total_tile *= num_tile[d];
+    }
+
+    // Order the tiles along a Z-curve.
+    auto tile_order = createTileOrder<ExecutionSpace, 3>( exec_space, num_tile,
+                                                          total_tile );
+
+    // Loop over tiles, iterating each tile interior serially.
+    Kokkos::Array<long, 3> min = index_space.min();
+    Kokkos::Array<long, 3> max = index_space.max();
+    Kokkos::Array<long, 3> tile_num = { num_tile[0], num_tile[1],
+                                        num_tile[2] };
+    Kokkos::Array<long, 3> tile_dim = { tile_shape.dims[0],
+                                        tile_shape.dims[1],
+                                        tile_shape.dims[2] };
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, total_tile ),
+        KOKKOS_LAMBDA( const long t ) {
+            // Decompose the cardinal tile index.
+            long cardinal = tile_order( t );
+            long tk = cardinal % tile_num[Dim::K];
+            long tj = ( cardinal / tile_num[Dim::K] ) % tile_num[Dim::J];
+            long ti = cardinal / ( tile_num[Dim::K] * tile_num[Dim::J] );
+
+            // Get the tile bounds, clipped to the index space.
+            long i0 = min[Dim::I] + ti * tile_dim[Dim::I];
+            long j0 = min[Dim::J] + tj * tile_dim[Dim::J];
+            long k0 = min[Dim::K] + tk * tile_dim[Dim::K];
+            long i1 = ( i0 + tile_dim[Dim::I] < max[Dim::I] )
+                          ? i0 + tile_dim[Dim::I]
+                          : max[Dim::I];
+            long j1 = ( j0 + tile_dim[Dim::J] < max[Dim::J] )
+                          ? j0 + tile_dim[Dim::J]
+                          : max[Dim::J];
+            long k1 = ( k0 + tile_dim[Dim::K] < max[Dim::K] )
+                          ? k0 + tile_dim[Dim::K]
+                          : max[Dim::K];
+
+            // Iterate the tile interior.
+            for ( long i = i0; i < i1; ++i )
+                for ( long j = j0; j < j1; ++j )
+                    for ( long k = k0; k < k1; ++k )
+                        functor( i, j, k );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a functor in parallel over the tiles of the given index
+  space. 2D specialization.
+
+  \tparam FunctorType The functor type to execute.
+
+  \tparam ExecutionSpace The execution space type.
+
+  \param label Parallel region label.
+
+  \param exec_space An execution space instance.
+
+  \param index_space The index space over which to loop.
+
+  \param tile_shape The tile dimensions. Tiles at the high boundary of the
+  index space are clipped to the index space bounds.
+
+  \param functor The functor to execute.
+ */
+template <class FunctorType, class ExecutionSpace>
+inline void grid_parallel_for( const std::string& label,
+                               const ExecutionSpace& exec_space,
+                               const IndexSpace<2>& index_space,
+                               const TileShape<2>& tile_shape,
+                               const FunctorType& functor )
+{
+    // Compute the tile decomposition.
+    long num_tile[2];
+    long total_tile = 1;
+    for ( std::size_t d = 0; d < 2; ++d )
+    {
+        num_tile[d] =
+            ( index_space.extent( d ) + tile_shape.dims[d] - 1 ) /
+            tile_shape.dims[d];
+        total_tile *= num_tile[d];
+    }
+
+    // Order the tiles along a Z-curve.
+    auto tile_order = createTileOrder<ExecutionSpace, 2>( exec_space, num_tile,
+                                                          total_tile );
+
+    // Loop over tiles, iterating each tile interior serially.
+    Kokkos::Array<long, 2> min = index_space.min();
+    Kokkos::Array<long, 2> max = index_space.max();
+    Kokkos::Array<long, 2> tile_num = { num_tile[0], num_tile[1] };
+    Kokkos::Array<long, 2> tile_dim = { tile_shape.dims[0],
+                                        tile_shape.dims[1] };
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, total_tile ),
+        KOKKOS_LAMBDA( const long t ) {
+            // Decompose the cardinal tile index.
+            long cardinal = tile_order( t );
+            long tj = cardinal % tile_num[Dim::J];
+            long ti = cardinal / tile_num[Dim::J];
+
+            // Get the tile bounds, clipped to the index space.
+            long i0 = min[Dim::I] + ti * tile_dim[Dim::I];
+            long j0 = min[Dim::J] + tj * tile_dim[Dim::J];
+            long i1 = ( i0 + tile_dim[Dim::I] < max[Dim::I] )
+                          ? i0 + tile_dim[Dim::I]
+                          : max[Dim::I];
+            long j1 = ( j0 + tile_dim[Dim::J] < max[Dim::J] )
+                          ? j0 + tile_dim[Dim::J]
+                          : max[Dim::J];
+
+            // Iterate the tile interior.
+            for ( long i = i0; i < i1; ++i )
+                for ( long j = j0; j < j1; ++j )
+                    functor( i, j );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+// Cost-Weighted Grid Parallel For
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Sum the cost of one (i,j) row of a 3d index space. Rank-3 cost views hold
+// a per-cell cost; rank-2 cost views hold the row cost directly.
+template <class CostViewType>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<3 == CostViewType::rank, double>
+rowCost3d( const CostViewType& costs, const long i, const long j,
+           const long k0, const long k1 )
+{
+    double cost = 0.0;
+    for ( long k = k0; k < k1; ++k )
+        cost += costs( i, j, k );
+    return cost;
+}
+
+template <class CostViewType>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == CostViewType::rank, double>
+rowCost3d( const CostViewType& costs, const long i, const long j, const long,
+           const long )
+{
+    return costs( i, j );
+}
+
+// Sum the cost of one i row of a 2d index space.
+template <class CostViewType>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<2 == CostViewType::rank, double>
+rowCost2d( const CostViewType& costs, const long i, const long j0,
+           const long j1 )
+{
+    double cost = 0.0;
+    for ( long j = j0; j < j1; ++j )
+        cost += costs( i, j );
+    return cost;
+}
+
+template <class CostViewType>
+KOKKOS_INLINE_FUNCTION std::enable_if_t<1 == CostViewType::rank, double>
+rowCost2d( const CostViewType& costs, const long i, const long, const long )
+{
+    return costs( i );
+}
+
+// Find the first row whose inclusive cost sum exceeds the target. Chunk
+// boundaries computed this way are consistent between neighboring chunks -
+// every row lands in exactly one chunk.
+template <class ScanViewType>
+KOKKOS_INLINE_FUNCTION long costChunkBound( const ScanViewType& row_scan,
+                                            const long num_row,
+                                            const double target )
+{
+    long lo = 0;
+    long hi = num_row;
+    while ( lo < hi )
+    {
+        long mid = ( lo + hi ) / 2;
+        if ( row_scan( mid ) > target )
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a functor in parallel over the given index space with the
+  iteration space chunked by cost. 3D specialization.
+
+  The rows of the index space - the (i,j) lines iterated over k - are grouped
+  into contiguous chunks of approximately equal total cost using a prefix sum
+  of the given cost view, and each work item executes one chunk. Kernels
+  whose work per cell varies strongly across the grid (e.g. cut-cell stencils
+  clustered on one side of a block) would otherwise leave most threads idle
+  behind the few that own the expensive cells when the index space is divided
+  uniformly.
+
+  \tparam FunctorType The functor type to execute.
+
+  \tparam ExecutionSpace The execution space type.
+
+  \tparam CostViewType The cost view type.
+
+  \param label Parallel region label.
+
+  \param exec_space An execution space instance.
+
+  \param index_space The index space over which to loop.
+
+  \param costs A view of the relative cost of each cell (rank 3) or of each
+  (i,j) row (rank 2), indexed with the same indices the functor receives.
+  Costs must be non-negative. If the total cost is zero a uniform
+  decomposition is used.
+
+  \param functor The functor to execute.
+ */
+template <class FunctorType, class ExecutionSpace, class CostViewType>
+inline std::enable_if_t<Kokkos::is_view<CostViewType>::value>
+grid_parallel_for( const std::string& label, const ExecutionSpace& exec_space,
+                   const IndexSpace<3>& index_space, const CostViewType& costs,
+                   const FunctorType& functor )
+{
+    static_assert( 3 == CostViewType::rank || 2 == CostViewType::rank,
+                   "Cost view must be per-cell (rank 3) or per-row (rank 2)" );
+
+    // Decompose the index space into (i,j) rows.
+    Kokkos::Array<long, 3> min = index_space.min();
+    Kokkos::Array<long, 3> max = index_space.max();
+    const long nj = index_space.extent( Dim::J );
+    const long num_row =
+        index_space.extent( Dim::I ) * index_space.extent( Dim::J );
+    if ( 0 == num_row )
+        return;
+
+    // Take an inclusive prefix sum of the row costs.
+    Kokkos::View<double*, typename ExecutionSpace::memory_space> row_scan(
+        Kokkos::ViewAllocateWithoutInitializing( label + "_row_cost" ),
+        num_row );
+    Kokkos::parallel_for(
+        label + "_row_cost",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_row ),
+        KOKKOS_LAMBDA( const long r ) {
+            long i = min[Dim::I] + r / nj;
+            long j = min[Dim::J] + r % nj;
+            row_scan( r ) =
+                Impl::rowCost3d( costs, i, j, min[Dim::K], max[Dim::K] );
+        } );
+    double total_cost;
+    Kokkos::parallel_scan(
+        label + "_row_cost_scan",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_row ),
+        KOKKOS_LAMBDA( const long r, double& update, const bool final_pass ) {
+            update += row_scan( r );
+            if ( final_pass )
+                row_scan( r ) = update;
+        },
+        total_cost );
+
+    // With no cost signal fall back to a uniform decomposition.
+    if ( !( total_cost > 0.0 ) )
+    {
+        grid_parallel_for( label, exec_space, index_space, functor );
+        return;
+    }
+
+    // Assign each work item a contiguous span of rows holding an equal share
+    // of the total cost. Oversubscribe the available concurrency and
+    // schedule dynamically to absorb the error in the cost estimate.
+    const long num_chunk = std::min(
+        num_row, 4 * static_cast<long>( exec_space.concurrency() ) );
+    Kokkos::parallel_for(
+        label,
+        Kokkos::RangePolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>>(
+            exec_space, 0, num_chunk ),
+        KOKKOS_LAMBDA( const long c ) {
+            long row_begin =
+                ( 0 == c ) ? 0
+                           : Impl::costChunkBound( row_scan, num_row,
+                                                   total_cost * c / num_chunk );
+            long row_end = ( num_chunk - 1 == c )
+                               ? num_row
+                               : Impl::costChunkBound( row_scan, num_row,
+                                                       total_cost * ( c + 1 ) /
+                                                           num_chunk );
+            for ( long r = row_begin; r < row_end; ++r )
+            {
+                long i = min[Dim::I] + r / nj;
+                long j = min[Dim::J] + r % nj;
+                for ( long k = min[Dim::K]; k < max[Dim::K]; ++k )
+                    functor( i, j, k );
+            }
+        } );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a functor in parallel over the given index space with the
+  iteration space chunked by cost. 2D specialization.
+
+  \tparam FunctorType The functor type to execute.
+
+  \tparam ExecutionSpace The execution space type.
+
+  \tparam CostViewType The cost view type.
+
+  \param label Parallel region label.
+
+  \param exec_space An execution space instance.
+
+  \param index_space The index space over which to loop.
+
+  \param costs A view of the relative cost of each cell (rank 2) or of each
+  i row (rank 1), indexed with the same indices the functor receives. Costs
+  must be non-negative. If the total cost is zero a uniform decomposition is
+  used.
+
+  \param functor The functor to execute.
+ */
+template <class FunctorType, class ExecutionSpace, class CostViewType>
+inline std::enable_if_t<Kokkos::is_view<CostViewType>::value>
+grid_parallel_for( const std::string& label, const ExecutionSpace& exec_space,
+                   const IndexSpace<2>& index_space, const CostViewType& costs,
+                   const FunctorType& functor )
+{
+    static_assert( 2 == CostViewType::rank || 1 == CostViewType::rank,
+                   "Cost view must be per-cell (rank 2) or per-row (rank 1)" );
+
+    // Decompose the index space into i rows.
+    Kokkos::Array<long, 2> min = index_space.min();
+    Kokkos::Array<long, 2> max = index_space.max();
+    const long num_row = index_space.extent( Dim::I );
+    if ( 0 == num_row )
+        return;
+
+    // Take an inclusive prefix sum of the row costs.
+    Kokkos::View<double*, typename ExecutionSpace::memory_space> row_scan(
+        Kokkos::ViewAllocateWithoutInitializing( label + "_row_cost" ),
+        num_row );
+    Kokkos::parallel_for(
+        label + "_row_cost",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_row ),
+        KOKKOS_LAMBDA( const long r ) {
+            row_scan( r ) = Impl::rowCost2d( costs, min[Dim::I] + r,
+                                             min[Dim::J], max[Dim::J] );
+        } );
+    double total_cost;
+    Kokkos::parallel_scan(
+        label + "_row_cost_scan",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, num_row ),
+        KOKKOS_LAMBDA( const long r, double& update, const bool final_pass ) {
+            update += row_scan( r );
+            if ( final_pass )
+                row_scan( r ) = update;
+        },
+        total_cost );
+
+    // With no cost signal fall back to a uniform decomposition.
+    if ( !( total_cost > 0.0 ) )
+    {
+        grid_parallel_for( label, exec_space, index_space, functor );
+        return;
+    }
+
+    // Assign each work item a contiguous span of rows holding an equal share
+    // of the total cost. Oversubscribe the available concurrency and
+    // schedule dynamically to absorb the error in the cost estimate.
+    const long num_chunk = std::min(
+        num_row, 4 * static_cast<long>( exec_space.concurrency() ) );
+    Kokkos::parallel_for(
+        label,
+        Kokkos::RangePolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>>(
+            exec_space, 0, num_chunk ),
+        KOKKOS_LAMBDA( const long c ) {
+            long row_begin =
+                ( 0 == c ) ? 0
+                           : Impl::costChunkBound( row_scan, num_row,
+                                                   total_cost * c / num_chunk );
+            long row_end = ( num_chunk - 1 == c )
+                               ? num_row
+                               : Impl::costChunkBound( row_scan, num_row,
+                                                       total_cost * ( c + 1 ) /
+                                                           num_chunk );
+            for ( long r = row_begin; r < row_end; ++r )
+            {
+                long i = min[Dim::I] + r;
+                for ( long j = min[Dim::J]; j < max[Dim::J]; ++j )
+                    functor( i, j );
+            }
+        } );
+}
+
+//---------------------------------------------------------------------------//
+// Fused Grid Parallel For
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Cons-list composition of grid functors. Each entity index is forwarded to
+// every functor in order so one traversal evaluates all of them.
+template <class... FunctorTypes>
+struct FusedGridFunctor;
+
+template <class FunctorType>
+struct FusedGridFunctor<FunctorType>
+{
+    FunctorType f;
+
+    template <class... IndexTypes>
+    KOKKOS_INLINE_FUNCTION void operator()( const IndexTypes&... ijk ) const
+    {
+        f( ijk... );
+    }
+};
+
+template <class FunctorType, class... RestTypes>
+struct FusedGridFunctor<FunctorType, RestTypes...>
+{
+    FunctorType f;
+    FusedGridFunctor<RestTypes...> rest;
+
+    template <class... IndexTypes>
+    KOKKOS_INLINE_FUNCTION void operator()( const IndexTypes&... ijk ) const
+    {
+        f( ijk... );
+        rest( ijk... );
+    }
+};
+
+template <class FunctorType>
+FusedGridFunctor<FunctorType> fuseGridFunctors( const FunctorType& functor )
+{
+    return { functor };
+}
+
+template <class FunctorType, class... RestTypes>
+FusedGridFunctor<FunctorType, RestTypes...>
+fuseGridFunctors( const FunctorType& functor, const RestTypes&... rest )
+{
+    return { functor, fuseGridFunctors( rest... ) };
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute several functors over the same index space in one fused
+  parallel traversal.
+
+  Every functor is evaluated at each entity before moving to the next one,
+  so stencils reading the same field share its loads through cache and
+  registers instead of each sweep streaming the field from memory again.
+  Back-to-back bandwidth-bound stencils over one field (e.g. a gradient, a
+  divergence, and a filter) fuse into a single sweep this way. The functors
+  must be independent at each entity: no functor may read data another
+  functor in the fusion writes.
+
+  \tparam ExecutionSpace The execution space type.
+
+  \tparam N The dimension of the index space.
+
+  \tparam FunctorTypes The functor types to execute.
+
+  \param label Parallel region label.
+
+  \param exec_space An execution space instance.
+
+  \param index_space The index space over which to loop.
+
+  \param functors The functors to execute. All are called with the same
+  entity indices.
+ */
+template <class ExecutionSpace, long N, class... FunctorTypes>
+inline void grid_fused_parallel_for( const std::string& label,
+                                     const ExecutionSpace& exec_space,
+                                     const IndexSpace<N>& index_space,
+                                     const FunctorTypes&... functors )
+{
+    grid_parallel_for( label, exec_space, index_space,
+                       Impl::fuseGridFunctors( functors... ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute several functors over the same local grid entities in one
+  fused parallel traversal. The loop indices are local.
+
+  \tparam ExecutionSpace The execution space type.
+
+  \tparam MeshType The mesh type of the local grid.
+
+  \tparam FunctorTypes The functor types to execute.
+
+  \param label Parallel region label.
+
+  \param exec_space An execution space instance.
+
+  \param local_grid The local grid to iterate over.
+
+  \param decomposition The decomposition type of the entities (own,ghost).
+
+  \param entity_type The entity type over which to loop.
+
+  \param functors The functors to execute. All are called with the same
+  entity indices.
+ */
+template <class ExecutionSpace, class MeshType, class DecompositionType,
+          class EntityType, class... FunctorTypes>
+inline void grid_fused_parallel_for( const std::string& label,
+                                     const ExecutionSpace& exec_space,
+                                     const LocalGrid<MeshType>& local_grid,
+                                     const DecompositionType& decomposition,
+                                     const EntityType& entity_type,
+                                     const FunctorTypes&... functors )
+{
+    auto index_space =
+        local_grid.indexSpace( decomposition, entity_type, Local() );
+    grid_fused_parallel_for( label, exec_space, index_space, functors... );
+}
+
 //---------------------------------------------------------------------------//
 // Grid Parallel Reduce
 //---------------------------------------------------------------------------//
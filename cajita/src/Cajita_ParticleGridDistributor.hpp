@@ -309,6 +309,174 @@ void particleGridMigrate( const LocalGridType& local_grid,
     migrate( distributor, particles );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Migrate data from one uniquely-owned decomposition to another
+  uniquely-owned decomposition, communicating only the rank-crossing
+  particles and rebuilding the AoSoA in place.
+
+  Instead of migrating the full container through a Cabana::Distributor,
+  the (typically few) particles that left the local domain are packed into
+  a compact send buffer, only those are communicated, and the container is
+  rebuilt locally: holes left by departed particles are filled from the
+  tail and received particles are appended. Communication and buffer sizes
+  scale with the number of moved particles rather than the total particle
+  number. Reserve extra AoSoA capacity up front to keep the final resize
+  reallocation-free.
+
+  \tparam LocalGridType Cajita LocalGrid type.
+
+  \tparam ParticlePositions Particle position type.
+
+  \tparam ParticleContainer AoSoA type.
+
+  \param local_grid The local grid containing periodicity and system bounds.
+
+  \param positions Particle positions. Invalidated by the rebuild - re-slice
+  the container after this call.
+
+  \param particles The particle AoSoA.
+
+  \param min_halo_width Number of halo mesh widths to allow particles before
+  migrating.
+
+  \param force_migrate Migrate particles outside the local domain regardless
+  of ghosted halo.
+*/
+template <class LocalGridType, class ParticlePositions, class ParticleContainer>
+void particleGridFastMigrate( const LocalGridType& local_grid,
+                              ParticlePositions& positions,
+                              ParticleContainer& particles,
+                              const int min_halo_width,
+                              const bool force_migrate = false )
+{
+    using device_type = typename ParticleContainer::device_type;
+    using execution_space = typename device_type::execution_space;
+
+    // When false, this option checks that any particles are nearly outside
+    // the ghosted halo region (outside the min_halo_width) before initiating
+    // migration. Otherwise, anything outside the local domain is migrated
+    // regardless of position in the halo.
+    if ( !force_migrate )
+    {
+        // Check to see if we need to communicate.
+        auto comm_count = migrateCount( local_grid, positions, min_halo_width );
+
+        // If we have no particles near the ghosted boundary, then exit.
+        if ( 0 == comm_count )
+            return;
+    }
+
+    // Get all neighbor ranks.
+    auto topology = Impl::getTopology( local_grid );
+    Kokkos::View<int*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+        topology_host( topology.data(), topology.size() );
+    auto topology_mirror =
+        Kokkos::create_mirror_view_and_copy( device_type(), topology_host );
+
+    // Determine destination ranks for all particles and wrap positions
+    // across periodic boundaries.
+    Kokkos::View<int*, device_type> destinations(
+        Kokkos::ViewAllocateWithoutInitializing( "destinations" ),
+        positions.size() );
+    Impl::getMigrateDestinations( local_grid, topology_mirror, destinations,
+                                  positions );
+
+    int my_rank;
+    MPI_Comm_rank( local_grid.globalGrid().comm(), &my_rank );
+
+    // Collect the indices of the rank-crossing particles.
+    const int num_particle = particles.size();
+    Kokkos::View<int*, device_type> leave_indices(
+        Kokkos::ViewAllocateWithoutInitializing( "leave_indices" ),
+        num_particle );
+    int num_leave = 0;
+    Kokkos::parallel_scan(
+        "find_leaving_particles",
+        Kokkos::RangePolicy<execution_space>( 0, num_particle ),
+        KOKKOS_LAMBDA( const int p, int& update, const bool final ) {
+            if ( destinations( p ) != my_rank )
+            {
+                if ( final )
+                    leave_indices( update ) = p;
+                ++update;
+            }
+        },
+        num_leave );
+
+    // Pack the leaving particles and their destinations into compact send
+    // buffers.
+    ParticleContainer send_particles( "migrate_send", num_leave );
+    Kokkos::View<int*, device_type> export_ranks(
+        Kokkos::ViewAllocateWithoutInitializing( "export_ranks" ), num_leave );
+    Kokkos::parallel_for(
+        "pack_leaving_particles",
+        Kokkos::RangePolicy<execution_space>( 0, num_leave ),
+        KOKKOS_LAMBDA( const int i ) {
+            int p = leave_indices( i );
+            send_particles.setTuple( i, particles.getTuple( p ) );
+            export_ranks( i ) = destinations( p );
+        } );
+    Kokkos::fence();
+
+    // Communicate only the leaving particles.
+    Cabana::Distributor<device_type> distributor(
+        local_grid.globalGrid().comm(), export_ranks, topology );
+    ParticleContainer recv_particles( "migrate_recv",
+                                      distributor.totalNumImport() );
+    Cabana::migrate( distributor, send_particles, recv_particles );
+
+    // Fill the holes left by departed particles with staying particles from
+    // the tail so the kept particles are contiguous in [0,num_stay).
+    const int num_stay = num_particle - num_leave;
+    Kokkos::View<int*, device_type> holes(
+        Kokkos::ViewAllocateWithoutInitializing( "holes" ), num_leave );
+    int num_hole = 0;
+    Kokkos::parallel_scan(
+        "find_holes", Kokkos::RangePolicy<execution_space>( 0, num_leave ),
+        KOKKOS_LAMBDA( const int i, int& update, const bool final ) {
+            if ( leave_indices( i ) < num_stay )
+            {
+                if ( final )
+                    holes( update ) = leave_indices( i );
+                ++update;
+            }
+        },
+        num_hole );
+    Kokkos::View<int*, device_type> fillers(
+        Kokkos::ViewAllocateWithoutInitializing( "fillers" ), num_leave );
+    Kokkos::parallel_scan(
+        "find_fillers", Kokkos::RangePolicy<execution_space>( 0, num_leave ),
+        KOKKOS_LAMBDA( const int i, int& update, const bool final ) {
+            int p = num_stay + i;
+            if ( destinations( p ) == my_rank )
+            {
+                if ( final )
+                    fillers( update ) = p;
+                ++update;
+            }
+        } );
+    // Every hole below num_stay pairs with a staying particle at or above
+    // num_stay, so the hole and filler lists have equal length.
+    Kokkos::parallel_for(
+        "fill_holes", Kokkos::RangePolicy<execution_space>( 0, num_hole ),
+        KOKKOS_LAMBDA( const int i ) {
+            particles.setTuple( holes( i ), particles.getTuple( fillers( i ) ) );
+        } );
+    Kokkos::fence();
+
+    // Append the received particles to the compacted tail.
+    particles.resize( num_stay + distributor.totalNumImport() );
+    Kokkos::parallel_for(
+        "append_received_particles",
+        Kokkos::RangePolicy<execution_space>( 0,
+                                              distributor.totalNumImport() ),
+        KOKKOS_LAMBDA( const int i ) {
+            particles.setTuple( num_stay + i, recv_particles.getTuple( i ) );
+        } );
+    Kokkos::fence();
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Migrate data from one uniquely-owned decomposition to another
@@ -18,11 +18,14 @@
 
 #include <Cajita_Array.hpp>
 #include <Cajita_GlobalGrid.hpp>
+#include <Cajita_GlobalMesh.hpp>
 #include <Cajita_Halo.hpp>
 #include <Cajita_IndexSpace.hpp>
 #include <Cajita_LocalGrid.hpp>
 #include <Cajita_MpiTraits.hpp>
 #include <Cajita_Parallel.hpp>
+#include <Cajita_Partitioner.hpp>
+#include <Cajita_ScratchArena.hpp>
 #include <Cajita_Types.hpp>
 
 #include <Kokkos_Core.hpp>
@@ -134,6 +137,159 @@ class ReferenceStructuredSolver
     virtual double getFinalRelativeResidualNorm() = 0;
 };
 
+//---------------------------------------------------------------------------//
+// Structured matrix operators.
+//---------------------------------------------------------------------------//
+/*!
+  Structured matrix operator with per-entity coefficients stored in an
+  array. Applying the operator reads the coefficient of every stencil entry
+  at every grid point. Entries equal to zero (e.g. stencil arms reaching
+  outside of the domain) are skipped.
+*/
+template <class StencilView, class CoefficientView>
+struct StencilMatrixOperator
+{
+    //! Scalar value type.
+    using value_type = typename CoefficientView::value_type;
+
+    //! Device view of the stencil offsets.
+    StencilView stencil;
+
+    //! Per-entity stencil coefficients.
+    CoefficientView values;
+
+    //! Apply the operator to a vector at a 3d grid point. The vector is any
+    //! callable returning the vector value at an (i,j,k) index.
+    template <class VectorFunc>
+    KOKKOS_INLINE_FUNCTION value_type apply( const int i, const int j,
+                                             const int k,
+                                             const VectorFunc& vec ) const
+    {
+        value_type sum = 0.0;
+        for ( unsigned c = 0; c < stencil.extent( 0 ); ++c )
+            if ( fabs( values( i, j, k, c ) ) > 0.0 )
+                sum += values( i, j, k, c ) *
+                       vec( i + stencil( c, Dim::I ), j + stencil( c, Dim::J ),
+                            k + stencil( c, Dim::K ) );
+        return sum;
+    }
+
+    //! Apply the operator to a vector at a 2d grid point. The vector is any
+    //! callable returning the vector value at an (i,j) index.
+    template <class VectorFunc>
+    KOKKOS_INLINE_FUNCTION value_type apply( const int i, const int j,
+                                             const VectorFunc& vec ) const
+    {
+        value_type sum = 0.0;
+        for ( unsigned c = 0; c < stencil.extent( 0 ); ++c )
+            if ( fabs( values( i, j, c ) ) > 0.0 )
+                sum += values( i, j, c ) * vec( i + stencil( c, Dim::I ),
+                                                j + stencil( c, Dim::J ) );
+        return sum;
+    }
+};
+
+//! Create a structured matrix operator from stencil offsets and a
+//! coefficient array view.
+template <class StencilView, class CoefficientView>
+auto createStencilMatrixOperator( const StencilView& stencil,
+                                  const CoefficientView& values )
+{
+    return StencilMatrixOperator<StencilView, CoefficientView>{ stencil,
+                                                                values };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  Matrix-free structured operator with compile-time constant coefficients.
+
+  The stencil offsets and coefficients are held by value so applying the
+  operator performs no per-entity coefficient reads - the stencil loop has a
+  compile-time trip count and the coefficients live in registers. Use this
+  for operators where the same coefficients apply at every grid point (e.g.
+  a constant-coefficient Laplacian on a periodic domain). Operators with
+  per-point boundary modifications need the array-based
+  StencilMatrixOperator.
+*/
+template <class Scalar, std::size_t NumSpaceDim, std::size_t NumEntry>
+struct ConstantStencilOperator
+{
+    //! Scalar value type.
+    using value_type = Scalar;
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = NumSpaceDim;
+    //! Number of stencil entries.
+    static constexpr std::size_t num_entry = NumEntry;
+
+    //! Stencil offsets.
+    Kokkos::Array<Kokkos::Array<int, NumSpaceDim>, NumEntry> offsets;
+
+    //! Stencil coefficients.
+    Kokkos::Array<Scalar, NumEntry> coefficients;
+
+    //! Apply the operator to a vector at a 3d grid point. The vector is any
+    //! callable returning the vector value at an (i,j,k) index.
+    template <class VectorFunc>
+    KOKKOS_INLINE_FUNCTION value_type apply( const int i, const int j,
+                                             const int k,
+                                             const VectorFunc& vec ) const
+    {
+        value_type sum = 0.0;
+        for ( std::size_t c = 0; c < NumEntry; ++c )
+            sum += coefficients[c] *
+                   vec( i + offsets[c][Dim::I], j + offsets[c][Dim::J],
+                        k + offsets[c][Dim::K] );
+        return sum;
+    }
+
+    //! Apply the operator to a vector at a 2d grid point. The vector is any
+    //! callable returning the vector value at an (i,j) index.
+    template <class VectorFunc>
+    KOKKOS_INLINE_FUNCTION value_type apply( const int i, const int j,
+                                             const VectorFunc& vec ) const
+    {
+        value_type sum = 0.0;
+        for ( std::size_t c = 0; c < NumEntry; ++c )
+            sum += coefficients[c] *
+                   vec( i + offsets[c][Dim::I], j + offsets[c][Dim::J] );
+        return sum;
+    }
+
+    //! Get the stencil offsets as a host vector (e.g. for halo
+    //! construction).
+    std::vector<std::array<int, NumSpaceDim>> offsetVector() const
+    {
+        std::vector<std::array<int, NumSpaceDim>> offset_vec( NumEntry );
+        for ( std::size_t c = 0; c < NumEntry; ++c )
+            for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+                offset_vec[c][d] = offsets[c][d];
+        return offset_vec;
+    }
+};
+
+/*!
+  \brief Create a matrix-free constant-coefficient stencil operator.
+  \param stencil The (i,j,k) offsets describing the structured operator
+  entries at each grid point. Offsets are defined relative to an index.
+  \param coefficients The operator coefficient for each stencil entry. The
+  same coefficients are applied at every grid point.
+*/
+template <class Scalar, std::size_t NumSpaceDim, std::size_t NumEntry>
+ConstantStencilOperator<Scalar, NumSpaceDim, NumEntry>
+createConstantStencilOperator(
+    const std::array<std::array<int, NumSpaceDim>, NumEntry>& stencil,
+    const std::array<Scalar, NumEntry>& coefficients )
+{
+    ConstantStencilOperator<Scalar, NumSpaceDim, NumEntry> stencil_op;
+    for ( std::size_t c = 0; c < NumEntry; ++c )
+    {
+        for ( std::size_t d = 0; d < NumSpaceDim; ++d )
+            stencil_op.offsets[c][d] = stencil[c][d];
+        stencil_op.coefficients[c] = coefficients[c];
+    }
+    return stencil_op;
+}
+
 //---------------------------------------------------------------------------//
 //! Reference structured preconditioned block conjugate gradient implementation.
 template <class Scalar, class EntityType, class MeshType, class DeviceType>
@@ -178,14 +334,15 @@ class ReferenceConjugateGradient
         : _tol( 1.0e-6 )
         , _max_iter( 1000 )
         , _print_level( 0 )
+        , _pipelined( false )
         , _num_iter( 0 )
         , _residual_norm( 0.0 )
     {
         // Array layout for vectors (p_old,z,r_old,q,p_new,r_new).
-        auto vector_layout =
+        _vector_layout =
             createArrayLayout( layout.localGrid(), 6, EntityType() );
         _vectors =
-            createArray<Scalar, DeviceType>( "cg_vectors", vector_layout );
+            createArray<Scalar, DeviceType>( "cg_vectors", _vector_layout );
     }
 
     /*!
@@ -253,6 +410,37 @@ class ReferenceConjugateGradient
     //! Setup the problem.
     void setup() override {}
 
+    /*!
+      \brief Enable or disable the pipelined iteration.
+
+      When enabled the two global dot product reductions per iteration are
+      posted with MPI_Iallreduce and completed while the halo gather for the
+      next kernel is in flight, hiding the global synchronization latency
+      behind the neighbor exchange. The arithmetic of the iteration is
+      unchanged - only the communication schedule differs. The pipelined
+      iteration starts the gather of p and z before the convergence check,
+      so the final iteration performs one extra gather.
+    */
+    void setPipelined( const bool pipelined ) { _pipelined = pipelined; }
+
+    /*!
+      \brief Share a scratch arena with this solver.
+
+      When an arena is assigned the persistent work vectors are dropped and
+      are instead checked out of the arena for the duration of each solve()
+      and released after. Solvers sharing an arena therefore share one set
+      of work vectors instead of each holding its own, reducing the memory
+      high-water mark when several solvers with the same layout are alive
+      at once (e.g. in an operator-split scheme).
+
+      \param arena The arena from which to check out the work vectors.
+    */
+    void setScratchArena( const std::shared_ptr<ScratchArena>& arena )
+    {
+        _scratch_arena = arena;
+        _vectors.reset();
+    }
+
     /*!
       \brief Solve the problem Ax = b for x.
       \param b The forcing term.
@@ -260,6 +448,85 @@ class ReferenceConjugateGradient
     */
     void solve( const Array_t& b, Array_t& x ) override
     {
+        solveImpl( b, x, createStencilMatrixOperator( _A_stencil, _A->view() ),
+                   createStencilMatrixOperator( _M_stencil, _M->view() ) );
+    }
+
+    /*!
+      \brief Set the matrix to a matrix-free operator.
+      \param op The operator (e.g. a ConstantStencilOperator). Only the
+      operator stencil is used here - to build the gather halo. The operator
+      itself is given to the matrix-free solve overload. No per-entity
+      matrix array is allocated on this path.
+    */
+    template <class Operator>
+    void setMatrixOperator( const Operator& op )
+    {
+        buildHalo( op.offsetVector(), _A_halo );
+    }
+
+    /*!
+      \brief Set the preconditioner to a matrix-free operator.
+      \param op The operator (e.g. a ConstantStencilOperator). Only the
+      operator stencil is used here - to build the gather halo. The operator
+      itself is given to the matrix-free solve overload. No per-entity
+      preconditioner array is allocated on this path.
+    */
+    template <class Operator>
+    void setPreconditionerOperator( const Operator& op )
+    {
+        buildHalo( op.offsetVector(), _M_halo );
+    }
+
+    /*!
+      \brief Solve the problem Ax = b for x with matrix-free operators.
+      \param b The forcing term.
+      \param x The solution.
+      \param A_op The matrix operator. Must have the stencil given to
+      setMatrixOperator.
+      \param M_op The preconditioner operator. Must have the stencil given
+      to setPreconditionerOperator.
+    */
+    template <class OperatorA, class OperatorM>
+    void solve( const Array_t& b, Array_t& x, const OperatorA& A_op,
+                const OperatorM& M_op )
+    {
+        solveImpl( b, x, A_op, M_op );
+    }
+
+  private:
+    // Check the work vectors out of the scratch arena for the duration of
+    // a solve if an arena was assigned. Without an arena the persistent
+    // vectors from construction are used and this is a no-op.
+    struct VectorScope
+    {
+        ReferenceConjugateGradient& cg;
+        VectorScope( ReferenceConjugateGradient& solver )
+            : cg( solver )
+        {
+            if ( cg._scratch_arena && !cg._vectors )
+                cg._vectors = cg._scratch_arena->checkout<Scalar, DeviceType>(
+                    "cg_vectors", cg._vector_layout );
+        }
+        ~VectorScope()
+        {
+            if ( cg._scratch_arena && cg._vectors )
+            {
+                cg._scratch_arena->release( cg._vectors );
+                cg._vectors.reset();
+            }
+        }
+    };
+
+    // Preconditioned conjugate gradient iteration with the given matrix and
+    // preconditioner operators.
+    template <class OperatorA, class OperatorM>
+    void solveImpl( const Array_t& b, Array_t& x, const OperatorA& A_op,
+                    const OperatorM& M_op )
+    {
+        // Check out the work vectors if a scratch arena is in use.
+        VectorScope vector_scope( *this );
+
         // Get the local grid.
         auto local_grid = _vectors->layout()->localGrid();
 
@@ -285,8 +552,6 @@ class ReferenceConjugateGradient
         // Views.
         auto x_view = x.view();
         auto b_view = b.view();
-        auto M_view = _M->view();
-        auto A_view = _A->view();
         auto p_old_view = p_old->view();
         auto z_view = z->view();
         auto r_old_view = r_old->view();
@@ -309,8 +574,8 @@ class ReferenceConjugateGradient
 
         // Compute the initial residual and norm.
         _residual_norm = 0.0;
-        auto compute_r0 = createComputeR0( _A_stencil, A_view, p_old_view,
-                                           b_view, r_old_view );
+        auto compute_r0 =
+            createComputeR0( A_op, p_old_view, b_view, r_old_view );
         grid_parallel_reduce(
             "compute_r0", execution_space(), entity_space,
             std::integral_constant<std::size_t, num_space_dim>{}, compute_r0,
@@ -334,32 +599,53 @@ class ReferenceConjugateGradient
 
         // Compute the initial preconditioned residual.
         Scalar zTr_old = 0.0;
-        auto compute_z0 = createComputeZ0( _M_stencil, M_view, p_old_view,
-                                           p_new_view, r_old_view, z_view );
+        auto compute_z0 = createComputeZ0( M_op, p_old_view, p_new_view,
+                                           r_old_view, z_view );
         grid_parallel_reduce(
             "compute_z0", execution_space(), entity_space,
             std::integral_constant<std::size_t, num_space_dim>{}, compute_z0,
             zTr_old );
 
-        // Finish computation of zTr
-        MPI_Allreduce( MPI_IN_PLACE, &zTr_old, 1, MpiTraits<Scalar>::type(),
-                       MPI_SUM, local_grid->globalGrid().comm() );
+        // Finish computation of zTr. When pipelining, overlap the reduction
+        // with the gather of p and z that follows.
+        MPI_Request reduce_request = MPI_REQUEST_NULL;
+        if ( _pipelined )
+        {
+            MPI_Iallreduce( MPI_IN_PLACE, &zTr_old, 1,
+                            MpiTraits<Scalar>::type(), MPI_SUM,
+                            local_grid->globalGrid().comm(), &reduce_request );
+            auto gather_request =
+                _A_halo->gatherAsync( execution_space(), *A_halo_vectors );
+            MPI_Wait( &reduce_request, MPI_STATUS_IGNORE );
+            gather_request.wait();
+        }
+        else
+        {
+            MPI_Allreduce( MPI_IN_PLACE, &zTr_old, 1, MpiTraits<Scalar>::type(),
+                           MPI_SUM, local_grid->globalGrid().comm() );
 
-        // Gather the LHS through gatheing p and z.
-        _A_halo->gather( execution_space(), *A_halo_vectors );
+            // Gather the LHS through gatheing p and z.
+            _A_halo->gather( execution_space(), *A_halo_vectors );
+        }
 
         // Compute A*p and pT*A*p.
         Scalar pTAp = 0.0;
-        auto compute_q0 =
-            createComputeQ0( _A_stencil, A_view, p_old_view, q_view );
+        auto compute_q0 = createComputeQ0( A_op, p_old_view, q_view );
         grid_parallel_reduce(
             "compute_q0", execution_space(), entity_space,
             std::integral_constant<std::size_t, num_space_dim>{}, compute_q0,
             pTAp );
 
-        // Finish the global reduction on pTAp.
-        MPI_Allreduce( MPI_IN_PLACE, &pTAp, 1, MpiTraits<Scalar>::type(),
-                       MPI_SUM, local_grid->globalGrid().comm() );
+        // Finish the global reduction on pTAp. When pipelining the
+        // reduction is completed while the gather at the top of the
+        // iteration is in flight.
+        if ( _pipelined )
+            MPI_Iallreduce( MPI_IN_PLACE, &pTAp, 1, MpiTraits<Scalar>::type(),
+                            MPI_SUM, local_grid->globalGrid().comm(),
+                            &reduce_request );
+        else
+            MPI_Allreduce( MPI_IN_PLACE, &pTAp, 1, MpiTraits<Scalar>::type(),
+                           MPI_SUM, local_grid->globalGrid().comm() );
 
         // Iterate.
         bool converged = false;
@@ -368,23 +654,53 @@ class ReferenceConjugateGradient
         Scalar beta;
         while ( _residual_norm > _tol && _num_iter < _max_iter )
         {
-            // Gather r and q.
-            _M_halo->gather( execution_space(), *M_halo_vectors );
+            // Gather r and q. When pipelining this overlaps the pending
+            // reduction on pTAp.
+            if ( _pipelined )
+            {
+                auto gather_request =
+                    _M_halo->gatherAsync( execution_space(), *M_halo_vectors );
+                MPI_Wait( &reduce_request, MPI_STATUS_IGNORE );
+                gather_request.wait();
+            }
+            else
+            {
+                _M_halo->gather( execution_space(), *M_halo_vectors );
+            }
 
             // Kernel 1: Compute x, r, residual norm, and zTr
             alpha = zTr_old / pTAp;
             zTr_new = 0.0;
-            auto cg_kernel_1 = createKernel1(
-                _M_stencil, M_view, x_view, r_new_view, r_old_view, p_new_view,
-                p_old_view, z_view, q_view, alpha );
+            auto cg_kernel_1 =
+                createKernel1( M_op, x_view, r_new_view, r_old_view,
+                               p_new_view, p_old_view, z_view, q_view, alpha );
             grid_parallel_reduce(
                 "cg_kernel_1", execution_space(), entity_space,
                 std::integral_constant<std::size_t, num_space_dim>{},
                 cg_kernel_1, zTr_new );
 
-            // Finish the global reduction on zTr and r_norm.
-            MPI_Allreduce( MPI_IN_PLACE, &zTr_new, 1, MpiTraits<Scalar>::type(),
-                           MPI_SUM, local_grid->globalGrid().comm() );
+            // Finish the global reduction on zTr and r_norm. When
+            // pipelining, start the gather of p and z for the next kernel
+            // and complete the reduction while it is in flight. This trades
+            // one extra gather on the final iteration for overlap on every
+            // iteration.
+            HaloRequest gather_request;
+            if ( _pipelined )
+            {
+                MPI_Iallreduce( MPI_IN_PLACE, &zTr_new, 1,
+                                MpiTraits<Scalar>::type(), MPI_SUM,
+                                local_grid->globalGrid().comm(),
+                                &reduce_request );
+                gather_request =
+                    _A_halo->gatherAsync( execution_space(), *A_halo_vectors );
+                MPI_Wait( &reduce_request, MPI_STATUS_IGNORE );
+            }
+            else
+            {
+                MPI_Allreduce( MPI_IN_PLACE, &zTr_new, 1,
+                               MpiTraits<Scalar>::type(), MPI_SUM,
+                               local_grid->globalGrid().comm() );
+            }
 
             // Update residual norm
             _residual_norm = std::sqrt( fabs( zTr_new ) ) / b_norm[0];
@@ -398,7 +714,8 @@ class ReferenceConjugateGradient
                           << ": |r|_2 / |b|_2 = " << _residual_norm
                           << std::endl;
 
-            // Check for convergence.
+            // Check for convergence. Breaking completes the in-flight
+            // gather when the request goes out of scope.
             if ( _residual_norm <= _tol )
             {
                 converged = true;
@@ -406,27 +723,42 @@ class ReferenceConjugateGradient
             }
 
             // Gather p and z.
-            _A_halo->gather( execution_space(), *A_halo_vectors );
+            if ( _pipelined )
+                gather_request.wait();
+            else
+                _A_halo->gather( execution_space(), *A_halo_vectors );
 
             // Kernel 2: Compute p, A*p, and p^T*A*p
             beta = zTr_new / zTr_old;
             pTAp = 0.0;
-            auto cg_kernel_2 = createKernel2(
-                _A_stencil, A_view, x_view, r_new_view, r_old_view, p_new_view,
-                p_old_view, z_view, q_view, beta );
+            auto cg_kernel_2 =
+                createKernel2( A_op, x_view, r_new_view, r_old_view,
+                               p_new_view, p_old_view, z_view, q_view, beta );
             grid_parallel_reduce(
                 "cg_kernel_2", execution_space(), entity_space,
                 std::integral_constant<std::size_t, num_space_dim>{},
                 cg_kernel_2, pTAp );
 
-            // Finish the global reduction on pTAp.
-            MPI_Allreduce( MPI_IN_PLACE, &pTAp, 1, MpiTraits<Scalar>::type(),
-                           MPI_SUM, local_grid->globalGrid().comm() );
+            // Finish the global reduction on pTAp. When pipelining the
+            // reduction is completed while the gather at the top of the
+            // next iteration is in flight.
+            if ( _pipelined )
+                MPI_Iallreduce( MPI_IN_PLACE, &pTAp, 1,
+                                MpiTraits<Scalar>::type(), MPI_SUM,
+                                local_grid->globalGrid().comm(),
+                                &reduce_request );
+            else
+                MPI_Allreduce( MPI_IN_PLACE, &pTAp, 1, MpiTraits<Scalar>::type(),
+                               MPI_SUM, local_grid->globalGrid().comm() );
 
             // Update zTr
             zTr_old = zTr_new;
         }
 
+        // Complete any reduction still outstanding after the last
+        // iteration.
+        MPI_Wait( &reduce_request, MPI_STATUS_IGNORE );
+
         // Output end state.
         if ( 1 <= _print_level && 0 == local_grid->globalGrid().blockId() )
             std::cout << "Finished in " << _num_iter
@@ -439,6 +771,7 @@ class ReferenceConjugateGradient
             throw std::runtime_error( "CG solver did not converge" );
     }
 
+  public:
     //! Get the number of iterations taken on the last solve.
     int getNumIter() override { return _num_iter; }
 
@@ -447,12 +780,10 @@ class ReferenceConjugateGradient
 
   public:
     //! \cond Impl
-    template <class StencilA, class ViewA, class ViewOldP, class ViewB,
-              class ViewOldR>
+    template <class OperatorA, class ViewOldP, class ViewB, class ViewOldR>
     struct ComputeR0
     {
-        StencilA A_stencil;
-        ViewA A_view;
+        OperatorA A_op;
         ViewOldP p_old_view;
         ViewB b_view;
         ViewOldR r_old_view;
@@ -465,15 +796,11 @@ class ReferenceConjugateGradient
         {
             // Compute the local contribution from matrix-vector
             // multiplication. Note that we copied x into p for this
-            // operation to easily perform the gather. Only apply the
-            // stencil entry if it is greater than 0.
-            value_type Ax = 0.0;
-            for ( unsigned c = 0; c < A_stencil.extent( 0 ); ++c )
-                if ( fabs( A_view( i, j, k, c ) ) > 0.0 )
-                    Ax += A_view( i, j, k, c ) *
-                          p_old_view( i + A_stencil( c, Dim::I ),
-                                      j + A_stencil( c, Dim::J ),
-                                      k + A_stencil( c, Dim::K ), 0 );
+            // operation to easily perform the gather.
+            value_type Ax = A_op.apply(
+                i, j, k, [&]( const int ii, const int jj, const int kk ) {
+                    return p_old_view( ii, jj, kk, 0 );
+                } );
 
             // Compute the residual.
             auto r_new = b_view( i, j, k, 0 ) - Ax;
@@ -491,14 +818,11 @@ class ReferenceConjugateGradient
         {
             // Compute the local contribution from matrix-vector
             // multiplication. Note that we copied x into p for this
-            // operation to easily perform the gather. Only apply the
-            // stencil entry if it is greater than 0.
-            value_type Ax = 0.0;
-            for ( unsigned c = 0; c < A_stencil.extent( 0 ); ++c )
-                if ( fabs( A_view( i, j, c ) ) > 0.0 )
-                    Ax += A_view( i, j, c ) *
-                          p_old_view( i + A_stencil( c, Dim::I ),
-                                      j + A_stencil( c, Dim::J ), 0 );
+            // operation to easily perform the gather.
+            value_type Ax =
+                A_op.apply( i, j, [&]( const int ii, const int jj ) {
+                    return p_old_view( ii, jj, 0 );
+                } );
 
             // Compute the residual.
             auto r_new = b_view( i, j, 0 ) - Ax;
@@ -511,22 +835,19 @@ class ReferenceConjugateGradient
         }
     };
 
-    template <class StencilA, class ViewA, class ViewOldP, class ViewB,
-              class ViewOldR>
-    auto createComputeR0( const StencilA& A_stencil, const ViewA& A_view,
-                          const ViewOldP& p_old_view, const ViewB& b_view,
-                          const ViewOldR& r_old_view )
+    template <class OperatorA, class ViewOldP, class ViewB, class ViewOldR>
+    auto createComputeR0( const OperatorA& A_op, const ViewOldP& p_old_view,
+                          const ViewB& b_view, const ViewOldR& r_old_view )
     {
-        return ComputeR0<StencilA, ViewA, ViewOldP, ViewB, ViewOldR>{
-            A_stencil, A_view, p_old_view, b_view, r_old_view };
+        return ComputeR0<OperatorA, ViewOldP, ViewB, ViewOldR>{
+            A_op, p_old_view, b_view, r_old_view };
     }
 
-    template <class StencilM, class ViewM, class ViewOldP, class ViewNewP,
-              class ViewOldR, class ViewZ>
+    template <class OperatorM, class ViewOldP, class ViewNewP, class ViewOldR,
+              class ViewZ>
     struct ComputeZ0
     {
-        StencilM M_stencil;
-        ViewM M_view;
+        OperatorM M_op;
         ViewOldP p_old_view;
         ViewNewP p_new_view;
         ViewOldR r_old_view;
@@ -539,15 +860,12 @@ class ReferenceConjugateGradient
                     const int j, const int k, value_type& result ) const
         {
             // Compute the local contribution from matrix-vector
-            // multiplication. Only apply the stencil entry if it is
-            // greater than 0.
-            value_type Mr = 0.0;
-            for ( unsigned c = 0; c < M_stencil.extent( 0 ); ++c )
-                if ( fabs( M_view( i, j, k, c ) ) > 0.0 )
-                    Mr += M_view( i, j, k, c ) *
-                          r_old_view( i + M_stencil( c, Dim::I ),
-                                      j + M_stencil( c, Dim::J ),
-                                      k + M_stencil( c, Dim::K ), 0 );
+            // multiplication.
+            value_type Mr = M_op.apply(
+                i, j, k, [&]( const int ii, const int jj, const int kk ) {
+                    return r_old_view( ii, jj, kk, 0 );
+                } );
+
             // Write values.
             z_view( i, j, k, 0 ) = Mr;
             p_old_view( i, j, k, 0 ) = Mr;
@@ -562,14 +880,12 @@ class ReferenceConjugateGradient
                     const int j, value_type& result ) const
         {
             // Compute the local contribution from matrix-vector
-            // multiplication. Only apply the stencil entry if it is
-            // greater than 0.
-            value_type Mr = 0.0;
-            for ( unsigned c = 0; c < M_stencil.extent( 0 ); ++c )
-                if ( fabs( M_view( i, j, c ) ) > 0.0 )
-                    Mr += M_view( i, j, c ) *
-                          r_old_view( i + M_stencil( c, Dim::I ),
-                                      j + M_stencil( c, Dim::J ), 0 );
+            // multiplication.
+            value_type Mr =
+                M_op.apply( i, j, [&]( const int ii, const int jj ) {
+                    return r_old_view( ii, jj, 0 );
+                } );
+
             // Write values.
             z_view( i, j, 0 ) = Mr;
             p_old_view( i, j, 0 ) = Mr;
@@ -580,22 +896,20 @@ class ReferenceConjugateGradient
         }
     };
 
-    template <class StencilM, class ViewM, class ViewOldP, class ViewNewP,
-              class ViewOldR, class ViewZ>
-    auto createComputeZ0( const StencilM& M_stencil, const ViewM& M_view,
-                          const ViewOldP& p_old_view,
+    template <class OperatorM, class ViewOldP, class ViewNewP, class ViewOldR,
+              class ViewZ>
+    auto createComputeZ0( const OperatorM& M_op, const ViewOldP& p_old_view,
                           const ViewNewP& p_new_view,
                           const ViewOldR& r_old_view, const ViewZ& z_view )
     {
-        return ComputeZ0<StencilM, ViewM, ViewOldP, ViewNewP, ViewOldR, ViewZ>{
-            M_stencil, M_view, p_old_view, p_new_view, r_old_view, z_view };
+        return ComputeZ0<OperatorM, ViewOldP, ViewNewP, ViewOldR, ViewZ>{
+            M_op, p_old_view, p_new_view, r_old_view, z_view };
     }
 
-    template <class StencilA, class ViewA, class ViewOldP, class ViewQ>
+    template <class OperatorA, class ViewOldP, class ViewQ>
     struct ComputeQ0
     {
-        StencilA A_stencil;
-        ViewA A_view;
+        OperatorA A_op;
         ViewOldP p_old_view;
         ViewQ q_view;
 
@@ -607,15 +921,11 @@ class ReferenceConjugateGradient
         {
             // Compute the local contribution from matrix-vector
             // multiplication. This computes the updated p vector
-            // in-line to avoid another kernel launch. Only apply the
-            // stencil entry if it is greater than 0.
-            value_type Ap = 0.0;
-            for ( unsigned c = 0; c < A_stencil.extent( 0 ); ++c )
-                if ( fabs( A_view( i, j, k, c ) ) > 0.0 )
-                    Ap += A_view( i, j, k, c ) *
-                          ( p_old_view( i + A_stencil( c, Dim::I ),
-                                        j + A_stencil( c, Dim::J ),
-                                        k + A_stencil( c, Dim::K ), 0 ) );
+            // in-line to avoid another kernel launch.
+            value_type Ap = A_op.apply(
+                i, j, k, [&]( const int ii, const int jj, const int kk ) {
+                    return p_old_view( ii, jj, kk, 0 );
+                } );
 
             // Write values.
             q_view( i, j, k, 0 ) = Ap;
@@ -630,14 +940,11 @@ class ReferenceConjugateGradient
         {
             // Compute the local contribution from matrix-vector
             // multiplication. This computes the updated p vector
-            // in-line to avoid another kernel launch. Only apply the
-            // stencil entry if it is greater than 0.
-            value_type Ap = 0.0;
-            for ( unsigned c = 0; c < A_stencil.extent( 0 ); ++c )
-                if ( fabs( A_view( i, j, c ) ) > 0.0 )
-                    Ap += A_view( i, j, c ) *
-                          ( p_old_view( i + A_stencil( c, Dim::I ),
-                                        j + A_stencil( c, Dim::J ), 0 ) );
+            // in-line to avoid another kernel launch.
+            value_type Ap =
+                A_op.apply( i, j, [&]( const int ii, const int jj ) {
+                    return p_old_view( ii, jj, 0 );
+                } );
 
             // Write values.
             q_view( i, j, 0 ) = Ap;
@@ -647,21 +954,20 @@ class ReferenceConjugateGradient
         }
     };
 
-    template <class StencilA, class ViewA, class ViewOldP, class ViewQ>
-    auto createComputeQ0( const StencilA& A_stencil, const ViewA& A_view,
-                          const ViewOldP& p_old_view, const ViewQ& q_view )
+    template <class OperatorA, class ViewOldP, class ViewQ>
+    auto createComputeQ0( const OperatorA& A_op, const ViewOldP& p_old_view,
+                          const ViewQ& q_view )
     {
-        return ComputeQ0<StencilA, ViewA, ViewOldP, ViewQ>{
-            A_stencil, A_view, p_old_view, q_view };
+        return ComputeQ0<OperatorA, ViewOldP, ViewQ>{ A_op, p_old_view,
+                                                      q_view };
     }
 
-    template <class StencilM, class ViewM, class ViewX, class ViewNewR,
-              class ViewOldR, class ViewOldP, class ViewNewP, class ViewZ,
-              class ViewQ, class ValueType>
+    template <class OperatorM, class ViewX, class ViewNewR, class ViewOldR,
+              class ViewOldP, class ViewNewP, class ViewZ, class ViewQ,
+              class ValueType>
     struct Kernel1
     {
-        StencilM M_stencil;
-        ViewM M_view;
+        OperatorM M_op;
         ViewX x_view;
         ViewNewR r_new_view;
         ViewOldR r_old_view;
@@ -677,18 +983,12 @@ class ReferenceConjugateGradient
         {
             // Compute the local contribution from matrix-vector
             // multiplication. This computes the updated q vector
-            // in-line to avoid another kernel launch. Only apply the
-            // stencil entry if it is greater than 0.
-            ValueType Mr = 0.0;
-            for ( unsigned c = 0; c < M_stencil.extent( 0 ); ++c )
-                if ( fabs( M_view( i, j, k, c ) ) > 0.0 )
-                    Mr += M_view( i, j, k, c ) *
-                          ( r_old_view( i + M_stencil( c, Dim::I ),
-                                        j + M_stencil( c, Dim::J ),
-                                        k + M_stencil( c, Dim::K ), 0 ) -
-                            alpha * q_view( i + M_stencil( c, Dim::I ),
-                                            j + M_stencil( c, Dim::J ),
-                                            k + M_stencil( c, Dim::K ), 0 ) );
+            // in-line to avoid another kernel launch.
+            ValueType Mr = M_op.apply(
+                i, j, k, [&]( const int ii, const int jj, const int kk ) {
+                    return r_old_view( ii, jj, kk, 0 ) -
+                           alpha * q_view( ii, jj, kk, 0 );
+                } );
 
             // Compute the updated x.
             ValueType x_new =
@@ -716,16 +1016,11 @@ class ReferenceConjugateGradient
         {
             // Compute the local contribution from matrix-vector
             // multiplication. This computes the updated q vector
-            // in-line to avoid another kernel launch. Only apply the
-            // stencil entry if it is greater than 0.
-            ValueType Mr = 0.0;
-            for ( unsigned c = 0; c < M_stencil.extent( 0 ); ++c )
-                if ( fabs( M_view( i, j, c ) ) > 0.0 )
-                    Mr += M_view( i, j, c ) *
-                          ( r_old_view( i + M_stencil( c, Dim::I ),
-                                        j + M_stencil( c, Dim::J ), 0 ) -
-                            alpha * q_view( i + M_stencil( c, Dim::I ),
-                                            j + M_stencil( c, Dim::J ), 0 ) );
+            // in-line to avoid another kernel launch.
+            ValueType Mr = M_op.apply( i, j, [&]( const int ii,
+                                                  const int jj ) {
+                return r_old_view( ii, jj, 0 ) - alpha * q_view( ii, jj, 0 );
+            } );
 
             // Compute the updated x.
             ValueType x_new = x_view( i, j, 0 ) + alpha * p_new_view( i, j, 0 );
@@ -746,28 +1041,27 @@ class ReferenceConjugateGradient
         }
     };
 
-    template <class StencilM, class ViewM, class ViewX, class ViewNewR,
-              class ViewOldR, class ViewOldP, class ViewNewP, class ViewZ,
-              class ViewQ, class ValueType>
-    auto createKernel1( const StencilM& M_stencil, const ViewM& M_view,
-                        const ViewX& x_view, const ViewNewR& r_new_view,
-                        const ViewOldR& r_old_view, const ViewNewP& p_new_view,
-                        const ViewOldP& p_old_view, const ViewZ& z_view,
-                        const ViewQ& q_view, const ValueType& alpha )
+    template <class OperatorM, class ViewX, class ViewNewR, class ViewOldR,
+              class ViewOldP, class ViewNewP, class ViewZ, class ViewQ,
+              class ValueType>
+    auto createKernel1( const OperatorM& M_op, const ViewX& x_view,
+                        const ViewNewR& r_new_view, const ViewOldR& r_old_view,
+                        const ViewNewP& p_new_view, const ViewOldP& p_old_view,
+                        const ViewZ& z_view, const ViewQ& q_view,
+                        const ValueType& alpha )
     {
-        return Kernel1<StencilM, ViewM, ViewX, ViewNewR, ViewOldR, ViewOldP,
+        return Kernel1<OperatorM, ViewX, ViewNewR, ViewOldR, ViewOldP,
                        ViewNewP, ViewZ, ViewQ, ValueType>{
-            M_stencil,  M_view,     x_view, r_new_view, r_old_view,
-            p_new_view, p_old_view, z_view, q_view,     alpha };
+            M_op,       x_view,     r_new_view, r_old_view,
+            p_new_view, p_old_view, z_view,     q_view,     alpha };
     }
 
-    template <class StencilA, class ViewA, class ViewX, class ViewNewR,
-              class ViewOldR, class ViewOldP, class ViewNewP, class ViewZ,
-              class ViewQ, class ValueType>
+    template <class OperatorA, class ViewX, class ViewNewR, class ViewOldR,
+              class ViewOldP, class ViewNewP, class ViewZ, class ViewQ,
+              class ValueType>
     struct Kernel2
     {
-        StencilA A_stencil;
-        ViewA A_view;
+        OperatorA A_op;
         ViewX x_view;
         ViewNewR r_new_view;
         ViewOldR r_old_view;
@@ -783,19 +1077,12 @@ class ReferenceConjugateGradient
         {
             // Compute the local contribution from matrix-vector
             // multiplication. This computes the updated p vector
-            // in-line to avoid another kernel launch. Only apply the
-            // stencil entry if it is greater than 0.
-            ValueType Ap = 0.0;
-            for ( unsigned c = 0; c < A_stencil.extent( 0 ); ++c )
-                if ( fabs( A_view( i, j, k, c ) ) > 0.0 )
-                    Ap +=
-                        A_view( i, j, k, c ) *
-                        ( z_view( i + A_stencil( c, Dim::I ),
-                                  j + A_stencil( c, Dim::J ),
-                                  k + A_stencil( c, Dim::K ), 0 ) +
-                          beta * p_old_view( i + A_stencil( c, Dim::I ),
-                                             j + A_stencil( c, Dim::J ),
-                                             k + A_stencil( c, Dim::K ), 0 ) );
+            // in-line to avoid another kernel launch.
+            ValueType Ap = A_op.apply(
+                i, j, k, [&]( const int ii, const int jj, const int kk ) {
+                    return z_view( ii, jj, kk, 0 ) +
+                           beta * p_old_view( ii, jj, kk, 0 );
+                } );
 
             // Compute the updated p.
             ValueType p_new =
@@ -818,17 +1105,11 @@ class ReferenceConjugateGradient
         {
             // Compute the local contribution from matrix-vector
             // multiplication. This computes the updated p vector
-            // in-line to avoid another kernel launch. Only apply the
-            // stencil entry if it is greater than 0.
-            ValueType Ap = 0.0;
-            for ( unsigned c = 0; c < A_stencil.extent( 0 ); ++c )
-                if ( fabs( A_view( i, j, c ) ) > 0.0 )
-                    Ap +=
-                        A_view( i, j, c ) *
-                        ( z_view( i + A_stencil( c, Dim::I ),
-                                  j + A_stencil( c, Dim::J ), 0 ) +
-                          beta * p_old_view( i + A_stencil( c, Dim::I ),
-                                             j + A_stencil( c, Dim::J ), 0 ) );
+            // in-line to avoid another kernel launch.
+            ValueType Ap = A_op.apply( i, j, [&]( const int ii,
+                                                  const int jj ) {
+                return z_view( ii, jj, 0 ) + beta * p_old_view( ii, jj, 0 );
+            } );
 
             // Compute the updated p.
             ValueType p_new = z_view( i, j, 0 ) + beta * p_old_view( i, j, 0 );
@@ -845,19 +1126,19 @@ class ReferenceConjugateGradient
         }
     };
 
-    template <class StencilA, class ViewA, class ViewX, class ViewNewR,
-              class ViewOldR, class ViewOldP, class ViewNewP, class ViewZ,
-              class ViewQ, class ValueType>
-    auto createKernel2( const StencilA& A_stencil, const ViewA& A_view,
-                        const ViewX& x_view, const ViewNewR& r_new_view,
-                        const ViewOldR& r_old_view, const ViewNewP& p_new_view,
-                        const ViewOldP& p_old_view, const ViewZ& z_view,
-                        const ViewQ& q_view, const ValueType& beta )
+    template <class OperatorA, class ViewX, class ViewNewR, class ViewOldR,
+              class ViewOldP, class ViewNewP, class ViewZ, class ViewQ,
+              class ValueType>
+    auto createKernel2( const OperatorA& A_op, const ViewX& x_view,
+                        const ViewNewR& r_new_view, const ViewOldR& r_old_view,
+                        const ViewNewP& p_new_view, const ViewOldP& p_old_view,
+                        const ViewZ& z_view, const ViewQ& q_view,
+                        const ValueType& beta )
     {
-        return Kernel2<StencilA, ViewA, ViewX, ViewNewR, ViewOldR, ViewOldP,
+        return Kernel2<OperatorA, ViewX, ViewNewR, ViewOldR, ViewOldP,
                        ViewNewP, ViewZ, ViewQ, ValueType>{
-            A_stencil,  A_view,     x_view, r_new_view, r_old_view,
-            p_new_view, p_old_view, z_view, q_view,     beta };
+            A_op,       x_view,     r_new_view, r_old_view,
+            p_new_view, p_old_view, z_view,     q_view,     beta };
     }
     //! \endcond
 
@@ -889,6 +1170,25 @@ class ReferenceConjugateGradient
                 stencil_mirror( s, d ) = stencil[s][d];
         Kokkos::deep_copy( device_stencil, stencil_mirror );
 
+        // Build the halo for the stencil.
+        buildHalo( stencil, halo );
+
+        // Create a new layout.
+        auto matrix_layout =
+            createArrayLayout( local_grid, stencil.size(), EntityType() );
+
+        // Allocate the matrix.
+        matrix = createArray<Scalar, DeviceType>( "matrix", matrix_layout );
+    }
+
+    // Build the gather halo needed to apply a stencil.
+    void
+    buildHalo( const std::vector<std::array<int, num_space_dim>>& stencil,
+               std::shared_ptr<Halo<memory_space>>& halo )
+    {
+        // Get the local grid.
+        auto local_grid = _vectors->layout()->localGrid();
+
         // Compose the halo pattern and compute how wide the halo needs to be
         // to gather all elements accessed by the stencil.
         std::set<std::array<int, num_space_dim>> neighbor_set;
@@ -916,19 +1216,13 @@ class ReferenceConjugateGradient
         HaloPattern<num_space_dim> pattern;
         pattern.setNeighbors( halo_neighbors );
         halo = createHalo<Scalar, DeviceType>( *halo_layout, pattern, width );
-
-        // Create a new layout.
-        auto matrix_layout =
-            createArrayLayout( local_grid, stencil.size(), EntityType() );
-
-        // Allocate the matrix.
-        matrix = createArray<Scalar, DeviceType>( "matrix", matrix_layout );
     }
 
   private:
     Scalar _tol;
     int _max_iter;
     int _print_level;
+    bool _pipelined;
     int _num_iter;
     Scalar _residual_norm;
     int _diag_entry;
@@ -938,7 +1232,9 @@ class ReferenceConjugateGradient
     std::shared_ptr<Halo<memory_space>> _M_halo;
     std::shared_ptr<Array_t> _A;
     std::shared_ptr<Array_t> _M;
+    std::shared_ptr<ArrayLayout<EntityType, MeshType>> _vector_layout;
     std::shared_ptr<Array_t> _vectors;
+    std::shared_ptr<ScratchArena> _scratch_arena;
 };
 
 //---------------------------------------------------------------------------//
@@ -957,6 +1253,988 @@ createReferenceConjugateGradient(
         layout );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Reference geometric multigrid V-cycle preconditioner.
+
+  Builds a hierarchy of geometrically coarsened global grids - each level
+  halves the global cell count in every dimension while keeping the fine
+  block decomposition - and runs a V-cycle over the hierarchy with damped
+  Jacobi smoothing, cell-averaging restriction, and trilinear (bilinear in
+  2d) prolongation. Level data lives in Cajita arrays and ghost values are
+  exchanged with per-level halos so the cycle runs on the full distributed
+  problem. Unlike a single-level preconditioner the V-cycle contracts all
+  error frequencies, giving iteration counts that are independent of the
+  mesh resolution.
+
+  A constant-coefficient stencil operator (e.g. a ConstantStencilOperator)
+  must be provided for every level - the user rediscretizes their operator
+  on each coarsened mesh. The operator must contain a diagonal entry for
+  the Jacobi smoother. Each rank must own an even number of cells in every
+  dimension at every level so that parent and child cells are owned by the
+  same rank.
+
+  The V-cycle can be applied directly as a preconditioner with apply() or
+  iterated to a tolerance as a standalone solver with solve(). The
+  preconditioner application is symmetric when the number of pre- and
+  post-smoothing sweeps match.
+*/
+template <class Scalar, class EntityType, class MeshType, class DeviceType,
+          class Operator>
+class ReferenceGeometricMultigrid
+{
+  public:
+    //! Entity type.
+    using entity_type = EntityType;
+    //! Kokkos device type.
+    using device_type = DeviceType;
+    //! Scalar value type.
+    using value_type = Scalar;
+    //! Kokkos execution space.
+    using execution_space = typename device_type::execution_space;
+    //! Kokkos memory space.
+    using memory_space = typename device_type::memory_space;
+    //! Array type.
+    using Array_t = Array<Scalar, EntityType, MeshType, DeviceType>;
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = MeshType::num_space_dim;
+
+    // Coarsening is cell-centered on a uniform mesh.
+    static_assert( isCell<EntityType>::value,
+                   "Geometric multigrid requires cell entities" );
+    static_assert(
+        std::is_same<MeshType, UniformMesh<typename MeshType::scalar_type,
+                                           num_space_dim>>::value,
+        "Geometric multigrid requires a uniform mesh" );
+
+    /*!
+      \brief Constructor.
+      \param layout The layout of the vectors on the finest grid.
+      \param level_operators The stencil operator for each level ordered
+      from finest to coarsest. The number of operators sets the number of
+      levels.
+    */
+    ReferenceGeometricMultigrid( const ArrayLayout<EntityType, MeshType>& layout,
+                                 const std::vector<Operator>& level_operators )
+        : _tol( 1.0e-6 )
+        , _max_iter( 100 )
+        , _print_level( 0 )
+        , _num_pre_smooth( 2 )
+        , _num_post_smooth( 2 )
+        , _num_coarse_smooth( 20 )
+        , _damping( 2.0 / 3.0 )
+        , _num_iter( 0 )
+        , _residual_norm( 0.0 )
+        , _ops( level_operators )
+    {
+        if ( _ops.empty() )
+            throw std::logic_error( "No multigrid level operators given" );
+
+        // The finest level works on the grid of the given layout.
+        std::vector<std::shared_ptr<LocalGrid<MeshType>>> local_grids;
+        local_grids.push_back( layout.localGrid() );
+
+        // Coarsen the global grid by a factor of 2 in each dimension for
+        // the remaining levels, keeping the fine block decomposition.
+        for ( std::size_t l = 1; l < _ops.size(); ++l )
+        {
+            const auto& fine_grid = local_grids[l - 1]->globalGrid();
+            const auto& fine_mesh = fine_grid.globalMesh();
+
+            std::array<typename MeshType::scalar_type, num_space_dim>
+                low_corner;
+            std::array<typename MeshType::scalar_type, num_space_dim>
+                high_corner;
+            std::array<int, num_space_dim> coarse_num_cell;
+            std::array<bool, num_space_dim> periodic;
+            std::array<int, num_space_dim> ranks_per_dim;
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+            {
+                int fine_num_cell = fine_grid.globalNumEntity( Cell(), d );
+                int num_block = fine_grid.dimNumBlock( d );
+
+                // Each block must own an even number of cells so parent and
+                // child cells live on the same rank and the coarse
+                // partition aligns with the fine partition.
+                if ( fine_num_cell % ( 2 * num_block ) != 0 )
+                    throw std::logic_error(
+                        "Grid cannot be coarsened evenly for multigrid" );
+
+                low_corner[d] = fine_mesh.lowCorner( d );
+                high_corner[d] = fine_mesh.highCorner( d );
+                coarse_num_cell[d] = fine_num_cell / 2;
+                periodic[d] = fine_grid.isPeriodic( d );
+                ranks_per_dim[d] = num_block;
+            }
+
+            auto coarse_mesh = createUniformGlobalMesh( low_corner, high_corner,
+                                                        coarse_num_cell );
+            ManualBlockPartitioner<num_space_dim> partitioner( ranks_per_dim );
+            auto coarse_grid = createGlobalGrid( fine_grid.comm(), coarse_mesh,
+                                                 periodic, partitioner );
+            local_grids.push_back( createLocalGrid(
+                coarse_grid,
+                std::max( stencilWidth( _ops[l].offsetVector() ), 1 ) ) );
+        }
+
+        // Create the level vectors, halos, and smoother diagonals.
+        for ( std::size_t l = 0; l < _ops.size(); ++l )
+        {
+            auto level_layout =
+                createArrayLayout( local_grids[l], 1, EntityType() );
+            _u.push_back( createArray<Scalar, DeviceType>( "mg_u_" +
+                                                               std::to_string( l ),
+                                                           level_layout ) );
+            _f.push_back( createArray<Scalar, DeviceType>( "mg_f_" +
+                                                               std::to_string( l ),
+                                                           level_layout ) );
+            _r.push_back( createArray<Scalar, DeviceType>( "mg_r_" +
+                                                               std::to_string( l ),
+                                                           level_layout ) );
+
+            // The prolongation reads ghost values in all directions so use
+            // a full node pattern regardless of the operator stencil.
+            auto stencil = _ops[l].offsetVector();
+            NodeHaloPattern<num_space_dim> pattern;
+            _halos.push_back( createHalo<Scalar, DeviceType>(
+                *level_layout, pattern,
+                std::max( stencilWidth( stencil ), 1 ) ) );
+
+            // Locate the diagonal entry for the Jacobi smoother.
+            int diag_entry = -1;
+            for ( unsigned c = 0; c < stencil.size(); ++c )
+            {
+                bool is_diag = true;
+                for ( std::size_t d = 0; d < num_space_dim; ++d )
+                    if ( 0 != stencil[c][d] )
+                        is_diag = false;
+                if ( is_diag )
+                    diag_entry = c;
+            }
+            if ( diag_entry < 0 )
+                throw std::logic_error(
+                    "Multigrid level operator has no diagonal entry" );
+            _diag.push_back( _ops[l].coefficients[diag_entry] );
+        }
+    }
+
+    //! Set the convergence tolerance of the standalone solve.
+    void setTolerance( const double tol ) { _tol = tol; }
+
+    //! Set the maximum number of V-cycles of the standalone solve.
+    void setMaxIter( const int max_iter ) { _max_iter = max_iter; }
+
+    //! Set the output level.
+    void setPrintLevel( const int print_level )
+    {
+        _print_level = print_level;
+    }
+
+    /*!
+      \brief Set the number of smoothing sweeps.
+      \param num_pre_smooth Sweeps before restriction on each level.
+      \param num_post_smooth Sweeps after prolongation on each level.
+      \param num_coarse_smooth Sweeps on the coarsest level.
+    */
+    void setNumSmooth( const int num_pre_smooth, const int num_post_smooth,
+                       const int num_coarse_smooth )
+    {
+        _num_pre_smooth = num_pre_smooth;
+        _num_post_smooth = num_post_smooth;
+        _num_coarse_smooth = num_coarse_smooth;
+    }
+
+    //! Set the damping factor of the Jacobi smoother.
+    void setDamping( const Scalar damping ) { _damping = damping; }
+
+    /*!
+      \brief Apply a single V-cycle as a preconditioner: x = V(b).
+      \param b The forcing term.
+      \param x The result. Overwritten with the V-cycle result from a zero
+      initial guess.
+    */
+    void apply( const Array_t& b, Array_t& x )
+    {
+        ArrayOp::copy( *_f[0], b, Own() );
+        applyVCycle( 0 );
+        ArrayOp::copy( x, *_u[0], Own() );
+    }
+
+    /*!
+      \brief Solve the problem Ax = b for x by iterating V-cycles.
+      \param b The forcing term.
+      \param x The solution. The initial contents are used as the initial
+      guess.
+    */
+    void solve( const Array_t& b, Array_t& x )
+    {
+        // Get the local grid.
+        auto local_grid = _u[0]->layout()->localGrid();
+
+        // Print banner
+        if ( 1 <= _print_level && 0 == local_grid->globalGrid().blockId() )
+            std::cout << std::endl << "Geometric multigrid" << std::endl;
+
+        // Reset iteration count.
+        _num_iter = 0;
+
+        // Compute the norm of the RHS.
+        std::vector<Scalar> b_norm( 1 );
+        ArrayOp::norm2( b, b_norm );
+
+        std::vector<Scalar> r_norm( 1 );
+        while ( true )
+        {
+            // Compute the current residual and norm.
+            Kokkos::deep_copy( _u[0]->view(), x.view() );
+            computeResidual( 0, b.view() );
+            ArrayOp::norm2( *_r[0], r_norm );
+            _residual_norm = r_norm[0] / b_norm[0];
+            if ( 2 == _print_level &&
+                 0 == local_grid->globalGrid().blockId() )
+                std::cout << "Iteration " << _num_iter
+                          << ": |r|_2 / |b|_2 = " << _residual_norm
+                          << std::endl;
+            if ( _residual_norm <= _tol || _num_iter >= _max_iter )
+                break;
+
+            // Apply a V-cycle to the residual and correct the solution.
+            ArrayOp::copy( *_f[0], *_r[0], Own() );
+            applyVCycle( 0 );
+            ArrayOp::update( x, 1.0, *_u[0], 1.0, Own() );
+            ++_num_iter;
+        }
+    }
+
+    //! Get the number of V-cycles performed on the last solve.
+    int getNumIter() { return _num_iter; }
+
+    //! Get the relative residual norm achieved on the last solve.
+    double getFinalRelativeResidualNorm() { return _residual_norm; }
+
+  public:
+    //! \cond Impl
+    template <class Operator_t, class ViewU, class ViewF, class ViewR>
+    struct LevelResidual
+    {
+        Operator_t op;
+        ViewU u_view;
+        ViewF f_view;
+        ViewR r_view;
+
+        KOKKOS_INLINE_FUNCTION void
+        operator()( const std::integral_constant<std::size_t, 3>&, const int i,
+                    const int j, const int k ) const
+        {
+            auto Au = op.apply(
+                i, j, k, [&]( const int ii, const int jj, const int kk ) {
+                    return u_view( ii, jj, kk, 0 );
+                } );
+            r_view( i, j, k, 0 ) = f_view( i, j, k, 0 ) - Au;
+        }
+
+        KOKKOS_INLINE_FUNCTION void
+        operator()( const std::integral_constant<std::size_t, 2>&, const int i,
+                    const int j ) const
+        {
+            auto Au = op.apply( i, j, [&]( const int ii, const int jj ) {
+                return u_view( ii, jj, 0 );
+            } );
+            r_view( i, j, 0 ) = f_view( i, j, 0 ) - Au;
+        }
+    };
+
+    template <class Operator_t, class ViewU, class ViewF, class ViewR>
+    auto createLevelResidual( const Operator_t& op, const ViewU& u_view,
+                              const ViewF& f_view, const ViewR& r_view )
+    {
+        return LevelResidual<Operator_t, ViewU, ViewF, ViewR>{ op, u_view,
+                                                               f_view, r_view };
+    }
+
+    template <class ViewFine, class ViewCoarse>
+    struct Restriction
+    {
+        ViewFine fine_view;
+        ViewCoarse coarse_view;
+        Kokkos::Array<int, num_space_dim> fine_min;
+        Kokkos::Array<int, num_space_dim> coarse_min;
+
+        using value_type = typename ViewCoarse::value_type;
+
+        KOKKOS_INLINE_FUNCTION void
+        operator()( const std::integral_constant<std::size_t, 3>&, const int i,
+                    const int j, const int k ) const
+        {
+            // Average the children of the coarse cell.
+            const int fi = fine_min[Dim::I] + 2 * ( i - coarse_min[Dim::I] );
+            const int fj = fine_min[Dim::J] + 2 * ( j - coarse_min[Dim::J] );
+            const int fk = fine_min[Dim::K] + 2 * ( k - coarse_min[Dim::K] );
+            value_type sum = 0.0;
+            for ( int di = 0; di < 2; ++di )
+                for ( int dj = 0; dj < 2; ++dj )
+                    for ( int dk = 0; dk < 2; ++dk )
+                        sum += fine_view( fi + di, fj + dj, fk + dk, 0 );
+            coarse_view( i, j, k, 0 ) = 0.125 * sum;
+        }
+
+        KOKKOS_INLINE_FUNCTION void
+        operator()( const std::integral_constant<std::size_t, 2>&, const int i,
+                    const int j ) const
+        {
+            // Average the children of the coarse cell.
+            const int fi = fine_min[Dim::I] + 2 * ( i - coarse_min[Dim::I] );
+            const int fj = fine_min[Dim::J] + 2 * ( j - coarse_min[Dim::J] );
+            value_type sum = 0.0;
+            for ( int di = 0; di < 2; ++di )
+                for ( int dj = 0; dj < 2; ++dj )
+                    sum += fine_view( fi + di, fj + dj, 0 );
+            coarse_view( i, j, 0 ) = 0.25 * sum;
+        }
+    };
+
+    template <class ViewFine, class ViewCoarse>
+    auto createRestriction( const ViewFine& fine_view,
+                            const ViewCoarse& coarse_view,
+                            const Kokkos::Array<int, num_space_dim>& fine_min,
+                            const Kokkos::Array<int, num_space_dim>& coarse_min )
+    {
+        return Restriction<ViewFine, ViewCoarse>{ fine_view, coarse_view,
+                                                  fine_min, coarse_min };
+    }
+
+    template <class ViewFine, class ViewCoarse>
+    struct Prolongation
+    {
+        ViewFine fine_view;
+        ViewCoarse coarse_view;
+        Kokkos::Array<int, num_space_dim> fine_min;
+        Kokkos::Array<int, num_space_dim> coarse_min;
+
+        using value_type = typename ViewFine::value_type;
+
+        KOKKOS_INLINE_FUNCTION void
+        operator()( const std::integral_constant<std::size_t, 3>&, const int i,
+                    const int j, const int k ) const
+        {
+            // Trilinear cell-centered interpolation: weight 3/4 to the
+            // parent cell and 1/4 to the neighbor on the child's side in
+            // each dimension.
+            const int li = i - fine_min[Dim::I];
+            const int lj = j - fine_min[Dim::J];
+            const int lk = k - fine_min[Dim::K];
+            const int ci = coarse_min[Dim::I] + li / 2;
+            const int cj = coarse_min[Dim::J] + lj / 2;
+            const int ck = coarse_min[Dim::K] + lk / 2;
+            const int si = ( li % 2 ) ? 1 : -1;
+            const int sj = ( lj % 2 ) ? 1 : -1;
+            const int sk = ( lk % 2 ) ? 1 : -1;
+            value_type result = 0.0;
+            for ( int di = 0; di < 2; ++di )
+            {
+                const value_type wi = di ? 0.25 : 0.75;
+                const int ii = di ? ci + si : ci;
+                for ( int dj = 0; dj < 2; ++dj )
+                {
+                    const value_type wj = dj ? 0.25 : 0.75;
+                    const int jj = dj ? cj + sj : cj;
+                    for ( int dk = 0; dk < 2; ++dk )
+                    {
+                        const value_type wk = dk ? 0.25 : 0.75;
+                        const int kk = dk ? ck + sk : ck;
+                        result +=
+                            wi * wj * wk * coarse_view( ii, jj, kk, 0 );
+                    }
+                }
+            }
+            fine_view( i, j, k, 0 ) += result;
+        }
+
+        KOKKOS_INLINE_FUNCTION void
+        operator()( const std::integral_constant<std::size_t, 2>&, const int i,
+                    const int j ) const
+        {
+            // Bilinear cell-centered interpolation: weight 3/4 to the
+            // parent cell and 1/4 to the neighbor on the child's side in
+            // each dimension.
+            const int li = i - fine_min[Dim::I];
+            const int lj = j - fine_min[Dim::J];
+            const int ci = coarse_min[Dim::I] + li / 2;
+            const int cj = coarse_min[Dim::J] + lj / 2;
+            const int si = ( li % 2 ) ? 1 : -1;
+            const int sj = ( lj % 2 ) ? 1 : -1;
+            value_type result = 0.0;
+            for ( int di = 0; di < 2; ++di )
+            {
+                const value_type wi = di ? 0.25 : 0.75;
+                const int ii = di ? ci + si : ci;
+                for ( int dj = 0; dj < 2; ++dj )
+                {
+                    const value_type wj = dj ? 0.25 : 0.75;
+                    const int jj = dj ? cj + sj : cj;
+                    result += wi * wj * coarse_view( ii, jj, 0 );
+                }
+            }
+            fine_view( i, j, 0 ) += result;
+        }
+    };
+
+    template <class ViewFine, class ViewCoarse>
+    auto createProlongation( const ViewFine& fine_view,
+                             const ViewCoarse& coarse_view,
+                             const Kokkos::Array<int, num_space_dim>& fine_min,
+                             const Kokkos::Array<int, num_space_dim>& coarse_min )
+    {
+        return Prolongation<ViewFine, ViewCoarse>{ fine_view, coarse_view,
+                                                   fine_min, coarse_min };
+    }
+    //! \endcond
+
+  private:
+    // Compute the width of a stencil.
+    static int
+    stencilWidth( const std::vector<std::array<int, num_space_dim>>& stencil )
+    {
+        int width = 0;
+        for ( auto s : stencil )
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+                width = std::max( width, std::abs( s[d] ) );
+        return width;
+    }
+
+    // Compute the level residual r = f - A u with the given forcing view.
+    template <class ViewF>
+    void computeResidual( const int level, const ViewF& f_view )
+    {
+        _halos[level]->gather( execution_space(), *_u[level] );
+        auto residual = createLevelResidual( _ops[level], _u[level]->view(),
+                                             f_view, _r[level]->view() );
+        grid_parallel_for(
+            "mg_residual", execution_space(),
+            *_u[level]->layout()->localGrid(), Own(), EntityType(),
+            std::integral_constant<std::size_t, num_space_dim>{}, residual );
+    }
+
+    // Damped Jacobi smoothing sweeps on a level.
+    void smooth( const int level, const int num_sweep )
+    {
+        for ( int s = 0; s < num_sweep; ++s )
+        {
+            computeResidual( level, _f[level]->view() );
+            ArrayOp::update( *_u[level], 1.0, *_r[level],
+                             _damping / _diag[level], Own() );
+        }
+    }
+
+    // Restrict the level residual to the forcing term of the next-coarsest
+    // level.
+    void restrictResidual( const int level )
+    {
+        auto fine_space =
+            _u[level]->layout()->localGrid()->indexSpace( Own(), EntityType(),
+                                                          Local() );
+        auto coarse_space = _u[level + 1]->layout()->localGrid()->indexSpace(
+            Own(), EntityType(), Local() );
+        Kokkos::Array<int, num_space_dim> fine_min;
+        Kokkos::Array<int, num_space_dim> coarse_min;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+        {
+            fine_min[d] = fine_space.min( d );
+            coarse_min[d] = coarse_space.min( d );
+        }
+        auto restriction =
+            createRestriction( _r[level]->view(), _f[level + 1]->view(),
+                               fine_min, coarse_min );
+        grid_parallel_for(
+            "mg_restrict", execution_space(), coarse_space,
+            std::integral_constant<std::size_t, num_space_dim>{},
+            restriction );
+    }
+
+    // Prolongate the correction of the next-coarsest level and add it to
+    // the level solution.
+    void prolongAndCorrect( const int level )
+    {
+        _halos[level + 1]->gather( execution_space(), *_u[level + 1] );
+        auto fine_space =
+            _u[level]->layout()->localGrid()->indexSpace( Own(), EntityType(),
+                                                          Local() );
+        auto coarse_space = _u[level + 1]->layout()->localGrid()->indexSpace(
+            Own(), EntityType(), Local() );
+        Kokkos::Array<int, num_space_dim> fine_min;
+        Kokkos::Array<int, num_space_dim> coarse_min;
+        for ( std::size_t d = 0; d < num_space_dim; ++d )
+        {
+            fine_min[d] = fine_space.min( d );
+            coarse_min[d] = coarse_space.min( d );
+        }
+        auto prolongation =
+            createProlongation( _u[level]->view(), _u[level + 1]->view(),
+                                fine_min, coarse_min );
+        grid_parallel_for(
+            "mg_prolong", execution_space(), fine_space,
+            std::integral_constant<std::size_t, num_space_dim>{},
+            prolongation );
+    }
+
+    // Recursive V-cycle on the level forcing term with a zero initial
+    // guess.
+    void applyVCycle( const int level )
+    {
+        // Zero the level solution including the ghosts so values outside a
+        // non-periodic boundary contribute nothing.
+        ArrayOp::assign( *_u[level], 0.0, Ghost() );
+
+        // Solve the coarsest level by smoothing only.
+        if ( level == static_cast<int>( _ops.size() ) - 1 )
+        {
+            smooth( level, _num_coarse_smooth );
+            return;
+        }
+
+        // Pre-smooth and compute the smoothed residual.
+        smooth( level, _num_pre_smooth );
+        computeResidual( level, _f[level]->view() );
+
+        // Coarse-grid correction.
+        restrictResidual( level );
+        applyVCycle( level + 1 );
+        prolongAndCorrect( level );
+
+        // Post-smooth.
+        smooth( level, _num_post_smooth );
+    }
+
+  private:
+    Scalar _tol;
+    int _max_iter;
+    int _print_level;
+    int _num_pre_smooth;
+    int _num_post_smooth;
+    int _num_coarse_smooth;
+    Scalar _damping;
+    int _num_iter;
+    Scalar _residual_norm;
+    std::vector<Operator> _ops;
+    std::vector<Scalar> _diag;
+    std::vector<std::shared_ptr<Array_t>> _u;
+    std::vector<std::shared_ptr<Array_t>> _f;
+    std::vector<std::shared_ptr<Array_t>> _r;
+    std::vector<std::shared_ptr<Halo<memory_space>>> _halos;
+};
+
+//---------------------------------------------------------------------------//
+//! Creation function for reference geometric multigrid.
+template <class Scalar, class DeviceType, class EntityType, class MeshType,
+          class Operator>
+std::shared_ptr<ReferenceGeometricMultigrid<Scalar, EntityType, MeshType,
+                                            DeviceType, Operator>>
+createReferenceGeometricMultigrid(
+    const ArrayLayout<EntityType, MeshType>& layout,
+    const std::vector<Operator>& level_operators )
+{
+    return std::make_shared<ReferenceGeometricMultigrid<
+        Scalar, EntityType, MeshType, DeviceType, Operator>>(
+        layout, level_operators );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Mixed-precision iterative refinement wrapper around the reference
+  conjugate gradient solver.
+
+  The inner conjugate gradient iteration - the bandwidth-bound part of the
+  solve - runs entirely in a reduced precision (float by default), halving
+  the operand width of every matrix, preconditioner, and vector access. The
+  outer loop computes the true residual r = b - Ax in the full Scalar
+  precision, solves the correction equation Ad = r with the inner solver to
+  a loose inner tolerance, and accumulates x = x + d in full precision.
+  Each refinement cycle recovers the digits the inner precision cannot
+  represent, so the solve converges to full-precision accuracy as long as
+  the inner precision is sufficient to resolve the conditioning of the
+  operator.
+
+  The matrix and preconditioner values are filled in the full Scalar
+  precision through the standard interface and demoted to the inner
+  precision in setup().
+*/
+template <class Scalar, class EntityType, class MeshType, class DeviceType,
+          class InnerScalar = float>
+class ReferenceIterativeRefinement
+    : public ReferenceStructuredSolver<Scalar, EntityType, MeshType, DeviceType>
+{
+  public:
+    //! Entity type.
+    using entity_type = EntityType;
+    //! Kokkos device type.
+    using device_type = DeviceType;
+    //! Scalar value type of the outer refinement loop.
+    using value_type = Scalar;
+    //! Scalar value type of the inner iteration.
+    using inner_value_type = InnerScalar;
+    //! Kokkos execution space.
+    using execution_space = typename device_type::execution_space;
+    //! Kokkos memory space.
+    using memory_space = typename device_type::memory_space;
+    //! Array type.
+    using Array_t = Array<Scalar, EntityType, MeshType, DeviceType>;
+    //! Inner-precision array type.
+    using InnerArray_t = Array<InnerScalar, EntityType, MeshType, DeviceType>;
+    //! Inner solver type.
+    using InnerSolver_t =
+        ReferenceConjugateGradient<InnerScalar, EntityType, MeshType,
+                                   DeviceType>;
+    //! Spatial dimension.
+    static constexpr std::size_t num_space_dim = MeshType::num_space_dim;
+
+    /*!
+      \brief Constructor.
+      \param layout The layout of the vectors.
+    */
+    ReferenceIterativeRefinement(
+        const ArrayLayout<EntityType, MeshType>& layout )
+        : _tol( 1.0e-6 )
+        , _max_iter( 50 )
+        , _print_level( 0 )
+        , _num_iter( 0 )
+        , _residual_norm( 0.0 )
+    {
+        auto scalar_layout =
+            createArrayLayout( layout.localGrid(), 1, EntityType() );
+        _residual =
+            createArray<Scalar, DeviceType>( "ir_residual", scalar_layout );
+        _correction =
+            createArray<Scalar, DeviceType>( "ir_correction", scalar_layout );
+        _work = createArray<Scalar, DeviceType>( "ir_work", scalar_layout );
+        _inner_b =
+            createArray<InnerScalar, DeviceType>( "ir_inner_b", scalar_layout );
+        _inner_x =
+            createArray<InnerScalar, DeviceType>( "ir_inner_x", scalar_layout );
+
+        // The inner solve only needs to produce a correction accurate to
+        // roughly the inner precision - the outer loop recovers the rest.
+        _inner = createReferenceConjugateGradient<InnerScalar, DeviceType>(
+            layout );
+        _inner->setTolerance( 1.0e-4 );
+        _inner->setMaxIter( 1000 );
+    }
+
+    /*!
+      \brief Set the matrix stencil.
+      \param stencil The (i,j,k) offsets describing the structured matrix
+      entries at each grid point. Offsets are defined relative to an index.
+      \param is_symmetric If true the matrix is designated as symmetric. The
+      stencil entries should only contain one entry from each symmetric
+      component if this is true.
+    */
+    void setMatrixStencil(
+        const std::vector<std::array<int, num_space_dim>>& stencil,
+        const bool is_symmetric = false ) override
+    {
+        setStencil( stencil, is_symmetric, _A_stencil, _A );
+        buildHalo( stencil, _x_halo );
+        _inner->setMatrixStencil( stencil, is_symmetric );
+    }
+
+    /*!
+      \brief Get the matrix values.
+      \return The matrix entry values in the full Scalar precision. For each
+      entity over which the vector space is defined an entry for each
+      stencil element is required. The order of the stencil elements is that
+      same as that in the stencil definition. Note that values corresponding
+      to stencil entries outside of the domain should be set to zero.
+    */
+    const Array_t& getMatrixValues() override { return *_A; }
+
+    /*!
+      \brief Set the preconditioner stencil.
+      \param stencil The (i,j,k) offsets describing the structured
+      preconditioner entries at each grid point. Offsets are defined relative
+      to an index. \param is_symmetric If true the preconditioner is
+      designated as symmetric. The stencil entries should only contain one
+      entry from each symmetric component if this is true.
+    */
+    void setPreconditionerStencil(
+        const std::vector<std::array<int, num_space_dim>>& stencil,
+        const bool is_symmetric = false ) override
+    {
+        setStencil( stencil, is_symmetric, _M_stencil, _M );
+        _inner->setPreconditionerStencil( stencil, is_symmetric );
+    }
+
+    /*!
+      \brief Get the preconditioner values.
+      \return The preconditioner entry values in the full Scalar precision.
+      For each entity over which the vector space is defined an entry for
+      each stencil element is required. The order of the stencil elements is
+      that same as that in the stencil definition. Note that values
+      corresponding to stencil entries outside of the domain should be set
+      to zero.
+    */
+    const Array_t& getPreconditionerValues() override { return *_M; }
+
+    //! Set the convergence tolerance of the outer residual.
+    void setTolerance( const double tol ) override { _tol = tol; }
+
+    //! Set the maximum number of refinement cycles.
+    void setMaxIter( const int max_iter ) override { _max_iter = max_iter; }
+
+    //! Set the output level.
+    void setPrintLevel( const int print_level ) override
+    {
+        _print_level = print_level;
+    }
+
+    //! Set the convergence tolerance of the inner solve.
+    void setInnerTolerance( const double tol ) { _inner->setTolerance( tol ); }
+
+    //! Set the maximum iterations of the inner solve.
+    void setInnerMaxIter( const int max_iter )
+    {
+        _inner->setMaxIter( max_iter );
+    }
+
+    //! Setup the problem. Demotes the matrix and preconditioner values to
+    //! the inner precision.
+    void setup() override
+    {
+        Kokkos::deep_copy( _inner->getMatrixValues().view(), _A->view() );
+        Kokkos::deep_copy( _inner->getPreconditionerValues().view(),
+                           _M->view() );
+        _inner->setup();
+    }
+
+    /*!
+      \brief Solve the problem Ax = b for x.
+      \param b The forcing term.
+      \param x The solution.
+    */
+    void solve( const Array_t& b, Array_t& x ) override
+    {
+        // Get the local grid.
+        auto local_grid = _residual->layout()->localGrid();
+
+        // Print banner
+        if ( 1 <= _print_level && 0 == local_grid->globalGrid().blockId() )
+            std::cout << std::endl
+                      << "Mixed-precision iterative refinement" << std::endl;
+
+        // Reset iteration count.
+        _num_iter = 0;
+
+        // Compute the norm of the RHS.
+        std::vector<Scalar> b_norm( 1 );
+        ArrayOp::norm2( b, b_norm );
+
+        // Full-precision matrix operator for the outer residual.
+        auto A_op = createStencilMatrixOperator( _A_stencil, _A->view() );
+
+        std::vector<Scalar> r_norm( 1 );
+        bool converged = false;
+        while ( true )
+        {
+            // Compute the true residual r = b - Ax in full precision.
+            Kokkos::deep_copy( _work->view(), x.view() );
+            _x_halo->gather( execution_space(), *_work );
+            auto residual = createRefineResidual( A_op, _work->view(),
+                                                  b.view(), _residual->view() );
+            grid_parallel_for(
+                "ir_residual", execution_space(), *local_grid, Own(),
+                EntityType(),
+                std::integral_constant<std::size_t, num_space_dim>{},
+                residual );
+            ArrayOp::norm2( *_residual, r_norm );
+            _residual_norm = r_norm[0] / b_norm[0];
+
+            // Output result
+            if ( 2 == _print_level && 0 == local_grid->globalGrid().blockId() )
+                std::cout << "Refinement " << _num_iter
+                          << ": |r|_2 / |b|_2 = " << _residual_norm
+                          << std::endl;
+
+            // Check for convergence.
+            if ( _residual_norm <= _tol )
+            {
+                converged = true;
+                break;
+            }
+            if ( _num_iter >= _max_iter )
+                break;
+
+            // Solve the correction equation Ad = r in the inner precision
+            // from a zero initial guess.
+            Kokkos::deep_copy( _inner_b->view(), _residual->view() );
+            ArrayOp::assign( *_inner_x, 0.0, Ghost() );
+            _inner->solve( *_inner_b, *_inner_x );
+
+            // Accumulate the correction in full precision.
+            Kokkos::deep_copy( _correction->view(), _inner_x->view() );
+            ArrayOp::update( x, 1.0, *_correction, 1.0, Own() );
+            ++_num_iter;
+        }
+
+        // Output end state.
+        if ( 1 <= _print_level && 0 == local_grid->globalGrid().blockId() )
+            std::cout << "Finished in " << _num_iter
+                      << " refinements, converged to " << _residual_norm
+                      << std::endl
+                      << std::endl;
+
+        // If we didn't converge throw.
+        if ( !converged )
+            throw std::runtime_error(
+                "Iterative refinement did not converge" );
+    }
+
+    //! Get the number of refinement cycles taken on the last solve.
+    int getNumIter() override { return _num_iter; }
+
+    //! Get the relative residual norm achieved on the last solve.
+    double getFinalRelativeResidualNorm() override { return _residual_norm; }
+
+  public:
+    //! \cond Impl
+    template <class OperatorA, class ViewX, class ViewB, class ViewR>
+    struct RefineResidual
+    {
+        OperatorA A_op;
+        ViewX x_view;
+        ViewB b_view;
+        ViewR r_view;
+
+        KOKKOS_INLINE_FUNCTION void
+        operator()( const std::integral_constant<std::size_t, 3>&, const int i,
+                    const int j, const int k ) const
+        {
+            auto Ax = A_op.apply(
+                i, j, k, [&]( const int ii, const int jj, const int kk ) {
+                    return x_view( ii, jj, kk, 0 );
+                } );
+            r_view( i, j, k, 0 ) = b_view( i, j, k, 0 ) - Ax;
+        }
+
+        KOKKOS_INLINE_FUNCTION void
+        operator()( const std::integral_constant<std::size_t, 2>&, const int i,
+                    const int j ) const
+        {
+            auto Ax = A_op.apply( i, j, [&]( const int ii, const int jj ) {
+                return x_view( ii, jj, 0 );
+            } );
+            r_view( i, j, 0 ) = b_view( i, j, 0 ) - Ax;
+        }
+    };
+
+    template <class OperatorA, class ViewX, class ViewB, class ViewR>
+    auto createRefineResidual( const OperatorA& A_op, const ViewX& x_view,
+                               const ViewB& b_view, const ViewR& r_view )
+    {
+        return RefineResidual<OperatorA, ViewX, ViewB, ViewR>{ A_op, x_view,
+                                                               b_view, r_view };
+    }
+    //! \endcond
+
+  private:
+    // Set the stencil of a matrix.
+    void
+    setStencil( const std::vector<std::array<int, num_space_dim>>& stencil,
+                const bool is_symmetric,
+                Kokkos::View<int* [num_space_dim], DeviceType>& device_stencil,
+                std::shared_ptr<Array_t>& matrix )
+    {
+        // For now we don't support symmetry.
+        if ( is_symmetric )
+            throw std::logic_error(
+                "Iterative refinement currently does not support symmetry" );
+
+        // Get the local grid.
+        auto local_grid = _residual->layout()->localGrid();
+
+        // Copy stencil to the device.
+        device_stencil = Kokkos::View<int* [num_space_dim], DeviceType>(
+            Kokkos::ViewAllocateWithoutInitializing( "stencil" ),
+            stencil.size() );
+        auto stencil_mirror =
+            Kokkos::create_mirror_view( Kokkos::HostSpace(), device_stencil );
+        for ( unsigned s = 0; s < stencil.size(); ++s )
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+                stencil_mirror( s, d ) = stencil[s][d];
+        Kokkos::deep_copy( device_stencil, stencil_mirror );
+
+        // Create a new layout.
+        auto matrix_layout =
+            createArrayLayout( local_grid, stencil.size(), EntityType() );
+
+        // Allocate the matrix.
+        matrix = createArray<Scalar, DeviceType>( "matrix", matrix_layout );
+    }
+
+    // Build the gather halo needed to compute the outer residual.
+    void
+    buildHalo( const std::vector<std::array<int, num_space_dim>>& stencil,
+               std::shared_ptr<Halo<memory_space>>& halo )
+    {
+        // Get the local grid.
+        auto local_grid = _residual->layout()->localGrid();
+
+        // Compose the halo pattern and compute how wide the halo needs to be
+        // to gather all elements accessed by the stencil.
+        std::set<std::array<int, num_space_dim>> neighbor_set;
+        std::array<int, num_space_dim> neighbor;
+        int width = 0;
+        for ( auto s : stencil )
+        {
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+                neighbor[d] = ( s[d] == 0 ) ? 0 : s[d] / std::abs( s[d] );
+            neighbor_set.emplace( neighbor );
+
+            for ( std::size_t d = 0; d < num_space_dim; ++d )
+                width = std::max( width, std::abs( s[d] ) );
+        }
+        std::vector<std::array<int, num_space_dim>> halo_neighbors(
+            neighbor_set.size() );
+        std::copy( neighbor_set.begin(), neighbor_set.end(),
+                   halo_neighbors.begin() );
+
+        // Build the halo. The outer residual gathers the single solution
+        // vector.
+        auto halo_layout = createArrayLayout( local_grid, 1, EntityType() );
+        HaloPattern<num_space_dim> pattern;
+        pattern.setNeighbors( halo_neighbors );
+        halo = createHalo<Scalar, DeviceType>( *halo_layout, pattern, width );
+    }
+
+  private:
+    Scalar _tol;
+    int _max_iter;
+    int _print_level;
+    int _num_iter;
+    Scalar _residual_norm;
+    Kokkos::View<int* [num_space_dim], DeviceType> _A_stencil;
+    Kokkos::View<int* [num_space_dim], DeviceType> _M_stencil;
+    std::shared_ptr<Halo<memory_space>> _x_halo;
+    std::shared_ptr<Array_t> _A;
+    std::shared_ptr<Array_t> _M;
+    std::shared_ptr<Array_t> _residual;
+    std::shared_ptr<Array_t> _correction;
+    std::shared_ptr<Array_t> _work;
+    std::shared_ptr<InnerArray_t> _inner_b;
+    std::shared_ptr<InnerArray_t> _inner_x;
+    std::shared_ptr<InnerSolver_t> _inner;
+};
+
+//---------------------------------------------------------------------------//
+//! Creation function for mixed-precision iterative refinement.
+template <class Scalar, class DeviceType, class InnerScalar = float,
+          class EntityType, class MeshType>
+std::shared_ptr<ReferenceIterativeRefinement<Scalar, EntityType, MeshType,
+                                             DeviceType, InnerScalar>>
+createReferenceIterativeRefinement(
+    const ArrayLayout<EntityType, MeshType>& layout )
+{
+    return std::make_shared<ReferenceIterativeRefinement<
+        Scalar, EntityType, MeshType, DeviceType, InnerScalar>>( layout );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cajita
@@ -0,0 +1,135 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cajita_ScratchArena.hpp
+  \brief Shared scratch array pool for multi-stage solver pipelines
+*/
+#ifndef CAJITA_SCRATCHARENA_HPP
+#define CAJITA_SCRATCHARENA_HPP
+
+#include <Cajita_Array.hpp>
+#include <Cajita_IndexSpace.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace Cajita
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Pool of reusable scratch arrays keyed by array type and layout
+  extents.
+
+  Solvers and other multi-stage pipelines typically hold their work arrays
+  for the lifetime of the object even though the arrays are only touched
+  inside a single member function. When several such objects are alive at
+  once (e.g. the solvers of an operator-split scheme) each holds a full set
+  of temporaries and the memory high-water mark is the sum of all of them. A
+  scratch arena lets the objects share one set: an array is checked out for
+  the duration of the work and released back to the pool after, so
+  allocations are reused by any later checkout with a matching array type
+  and layout extents.
+
+  Checked-out arrays are not initialized - they contain whatever the
+  previous user left behind, like ArrayOp::clone. The arena is a host-side
+  bookkeeping structure and is not thread safe.
+*/
+class ScratchArena
+{
+  public:
+    /*!
+      \brief Check an array out of the arena.
+
+      If the pool holds a released array with the same type and layout
+      extents it is recycled (keeping its original label); otherwise a new
+      array is allocated with the given label.
+
+      \param label A label for the array if a new allocation is needed.
+      \param layout The array layout over which to construct the array.
+    */
+    template <class Scalar, class DeviceType, class EntityType, class MeshType>
+    std::shared_ptr<Array<Scalar, EntityType, MeshType, DeviceType>>
+    checkout( const std::string& label,
+              const std::shared_ptr<ArrayLayout<EntityType, MeshType>>& layout )
+    {
+        using array_type = Array<Scalar, EntityType, MeshType, DeviceType>;
+        auto key =
+            makeKey<array_type>( layout->indexSpace( Ghost(), Local() ) );
+        auto free_it = _free.find( key );
+        if ( free_it != _free.end() )
+        {
+            auto array =
+                std::static_pointer_cast<array_type>( free_it->second );
+            _free.erase( free_it );
+            return array;
+        }
+        return createArray<Scalar, DeviceType>( label, layout );
+    }
+
+    /*!
+      \brief Release an array back to the arena for reuse by a later
+      checkout.
+      \param array The array to release. The caller should drop its
+      reference - the data may be handed to another user at any time.
+    */
+    template <class Scalar, class EntityType, class MeshType, class... Params>
+    void release(
+        const std::shared_ptr<Array<Scalar, EntityType, MeshType, Params...>>&
+            array )
+    {
+        using array_type = Array<Scalar, EntityType, MeshType, Params...>;
+        auto key = makeKey<array_type>(
+            array->layout()->indexSpace( Ghost(), Local() ) );
+        _free.insert(
+            std::make_pair( key, std::static_pointer_cast<void>( array ) ) );
+    }
+
+    //! Get the number of arrays currently held by the pool.
+    std::size_t numFree() const { return _free.size(); }
+
+    //! Drop all pooled arrays, freeing their memory.
+    void clear() { _free.clear(); }
+
+  private:
+    // Arrays are interchangeable when they have the same complete array
+    // type (scalar, entity, mesh, and view parameters) and the same ghosted
+    // extents.
+    using key_type = std::pair<std::type_index, std::vector<long>>;
+
+    template <class ArrayType, long N>
+    key_type makeKey( const IndexSpace<N>& space ) const
+    {
+        std::vector<long> extents( N );
+        for ( long d = 0; d < N; ++d )
+            extents[d] = space.extent( d );
+        return key_type( std::type_index( typeid( ArrayType ) ), extents );
+    }
+
+    std::multimap<key_type, std::shared_ptr<void>> _free;
+};
+
+//---------------------------------------------------------------------------//
+//! Create a scratch arena to be shared among a group of solvers.
+inline std::shared_ptr<ScratchArena> createScratchArena()
+{
+    return std::make_shared<ScratchArena>();
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cajita
+
+#endif // end CAJITA_SCRATCHARENA_HPP
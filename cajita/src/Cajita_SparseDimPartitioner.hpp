@@ -457,6 +457,60 @@ class SparseDimPartitioner : public BlockPartitioner<3>
         return _max_optimize_iteration;
     }
 
+    /*!
+      \brief incrementally optimize the partition, bounding boundary movement
+      and weighing the projected imbalance gain against the migration cost
+      \param view particle positions view
+      \param particle_num total particle number
+      \param global_lower_corner the coordinate of the domain global lower
+      corner
+      \param dx cell dx size
+      \param comm MPI communicator used for workload reduction
+      \param max_boundary_shift max tiles a partition boundary may move in one
+      rebalance
+      \param migration_cost_coeff workload-units of imbalance gain required
+      per workload-unit of migrated data; the trial partition is rejected if
+      the reduction of the max rank workload does not exceed
+      migration_cost_coeff * migrated workload
+      \return true if the trial partition was accepted
+    */
+    template <class ParticlePosViewType, typename ArrayType, typename CellUnit>
+    bool optimizePartitionIncremental( const ParticlePosViewType& view,
+                                       int particle_num,
+                                       const ArrayType& global_lower_corner,
+                                       const CellUnit dx, MPI_Comm comm,
+                                       const int max_boundary_shift,
+                                       const float migration_cost_coeff )
+    {
+        computeLocalWorkLoad( view, particle_num, global_lower_corner, dx );
+        computeFullPrefixSum( comm );
+        return evaluateTrialPartition( max_boundary_shift,
+                                       migration_cost_coeff );
+    }
+
+    /*!
+      \brief incrementally optimize the partition, bounding boundary movement
+      and weighing the projected imbalance gain against the migration cost
+      \param sparseMap sparseMap in the current rank
+      \param comm MPI communicator used for workload reduction
+      \param max_boundary_shift max tiles a partition boundary may move in one
+      rebalance
+      \param migration_cost_coeff workload-units of imbalance gain required
+      per workload-unit of migrated data
+      \return true if the trial partition was accepted
+    */
+    template <class SparseMapType>
+    bool optimizePartitionIncremental( const SparseMapType& sparseMap,
+                                       MPI_Comm comm,
+                                       const int max_boundary_shift,
+                                       const float migration_cost_coeff )
+    {
+        computeLocalWorkLoad( sparseMap );
+        computeFullPrefixSum( comm );
+        return evaluateTrialPartition( max_boundary_shift,
+                                       migration_cost_coeff );
+    }
+
     /*!
       \brief optimize the partition in three dimensions seperately
       \param is_changed label if the partition is changed after the optimization
@@ -647,6 +701,78 @@ class SparseDimPartitioner : public BlockPartitioner<3>
                ( _ranks_per_dim[0] * _ranks_per_dim[1] * _ranks_per_dim[2] );
     }
 
+    /*!
+      \brief compute the max workload over all MPI ranks for a partition
+      \param rec_view Host mirror of a rectangle partition
+      \param prefix_sum_view Host mirror of _workload_prefix_sum
+      \return max rank workload of the given partition
+    */
+    template <typename PartitionViewHost, typename WorkloadViewHost>
+    int maxRankWorkload( PartitionViewHost& rec_view,
+                         WorkloadViewHost& prefix_sum_view )
+    {
+        SubWorkloadFunctor<PartitionViewHost, WorkloadViewHost>
+            compute_sub_workload_host( rec_view, prefix_sum_view );
+
+        // compute the max workload over all rank regions
+        int max_workload = 0;
+        for ( int i = 0; i < _ranks_per_dim[0]; ++i )
+            for ( int j = 0; j < _ranks_per_dim[1]; ++j )
+                for ( int k = 0; k < _ranks_per_dim[2]; ++k )
+                {
+                    int workload = compute_sub_workload_host(
+                        0, rec_view( i, 0 ), rec_view( i + 1, 0 ), 1, j, 2,
+                        k );
+                    max_workload =
+                        max_workload < workload ? workload : max_workload;
+                }
+        return max_workload;
+    }
+
+    /*!
+      \brief estimate the workload that changes ownership when moving from
+      one partition to another; for every boundary that moved, the workload
+      of the tile slab swept by the boundary (over the full cross section of
+      the two fixed dimensions) migrates between the adjacent rank layers
+      \param old_view Host mirror of the current rectangle partition
+      \param new_view Host mirror of the trial rectangle partition
+      \param prefix_sum_view Host mirror of _workload_prefix_sum
+      \return estimated migrated workload (overlapping slabs of different
+      dimensions are counted once per dimension)
+    */
+    template <typename PartitionViewHost, typename WorkloadViewHost>
+    int migratedWorkload( PartitionViewHost& old_view,
+                          PartitionViewHost& new_view,
+                          WorkloadViewHost& prefix_sum_view )
+    {
+        int ni = prefix_sum_view.extent( 0 ) - 1;
+        int nj = prefix_sum_view.extent( 1 ) - 1;
+        int nk = prefix_sum_view.extent( 2 ) - 1;
+        int migrated = 0;
+        for ( int d = 0; d < 3; ++d )
+            for ( int id = 1; id < _ranks_per_dim[d]; ++id )
+            {
+                int lo = old_view( id, d ) < new_view( id, d )
+                             ? old_view( id, d )
+                             : new_view( id, d );
+                int hi = old_view( id, d ) < new_view( id, d )
+                             ? new_view( id, d )
+                             : old_view( id, d );
+                if ( lo == hi )
+                    continue;
+                if ( 0 == d )
+                    migrated += prefix_sum_view( hi, nj, nk ) -
+                                prefix_sum_view( lo, nj, nk );
+                else if ( 1 == d )
+                    migrated += prefix_sum_view( ni, hi, nk ) -
+                                prefix_sum_view( ni, lo, nk );
+                else
+                    migrated += prefix_sum_view( ni, nj, hi ) -
+                                prefix_sum_view( ni, nj, lo );
+            }
+        return migrated;
+    }
+
     /*!
       \brief compute the imbalance factor for the current partition
       \param cart_comm MPI cartesian communicator
@@ -744,6 +870,66 @@ class SparseDimPartitioner : public BlockPartitioner<3>
     // ranks per dimension
     Kokkos::Array<int, 3> _ranks_per_dim;
 
+    // Run the partition optimization from the current partition, clamp the
+    // boundary movement to the given bound and accept the trial partition
+    // only if the reduction of the max rank workload exceeds the estimated
+    // migration cost. The workload prefix sum must be up to date.
+    bool evaluateTrialPartition( const int max_boundary_shift,
+                                 const float migration_cost_coeff )
+    {
+        // snapshot the current partition
+        partition_view_host old_partition(
+            "old_partition", _rectangle_partition_dev.extent( 0 ) );
+        Kokkos::deep_copy( old_partition, _rectangle_partition_dev );
+
+        // compute a trial partition with the standard optimization
+        bool is_changed = false;
+        for ( int i = 0; i < _max_optimize_iteration; ++i )
+        {
+            optimizePartition( is_changed, std::rand() % 3 );
+            if ( !is_changed )
+                break;
+        }
+
+        // bound the boundary movement: clamp every interior partition
+        // position to within max_boundary_shift tiles of its old position
+        // while keeping the partition monotonic
+        partition_view_host trial_partition(
+            "trial_partition", _rectangle_partition_dev.extent( 0 ) );
+        Kokkos::deep_copy( trial_partition, _rectangle_partition_dev );
+        for ( int d = 0; d < 3; ++d )
+            for ( int id = 1; id < _ranks_per_dim[d]; ++id )
+            {
+                int lo = old_partition( id, d ) - max_boundary_shift;
+                int hi = old_partition( id, d ) + max_boundary_shift;
+                int pos = trial_partition( id, d );
+                pos = pos < lo ? lo : pos;
+                pos = pos > hi ? hi : pos;
+                // keep the partition monotonic and inside the domain
+                int prev = trial_partition( id - 1, d );
+                pos = pos < prev ? prev : pos;
+                int last = old_partition( _ranks_per_dim[d], d );
+                pos = pos > last ? last : pos;
+                trial_partition( id, d ) = pos;
+            }
+
+        // weigh the projected imbalance gain against the migration cost
+        auto prefix_sum_mirror = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), _workload_prefix_sum );
+        int old_max = maxRankWorkload( old_partition, prefix_sum_mirror );
+        int new_max = maxRankWorkload( trial_partition, prefix_sum_mirror );
+        int migrated = migratedWorkload( old_partition, trial_partition,
+                                         prefix_sum_mirror );
+        if ( static_cast<float>( old_max - new_max ) >
+             migration_cost_coeff * static_cast<float>( migrated ) )
+        {
+            Kokkos::deep_copy( _rectangle_partition_dev, trial_partition );
+            return true;
+        }
+        Kokkos::deep_copy( _rectangle_partition_dev, old_partition );
+        return false;
+    }
+
     void allocate( const std::array<int, 3>& global_cells_per_dim )
     {
 
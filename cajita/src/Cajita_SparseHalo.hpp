@@ -0,0 +1,465 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cajita_SparseHalo.hpp
+  \brief Halo exchange of occupied sparse grid tiles
+*/
+#ifndef CAJITA_SPARSEHALO_HPP
+#define CAJITA_SPARSEHALO_HPP
+
+#include <Cajita_MpiTraits.hpp>
+#include <Cajita_SparseIndexSpace.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+namespace Cajita
+{
+namespace Experimental
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Halo exchange for the occupied tiles of a sparse grid block.
+
+  Exchanges sparse grid data with the neighbors of a block in a 3d Cartesian
+  decomposition without densifying the boundary regions. A gather performs a
+  tile-key handshake first - each rank sends the hash keys of its occupied
+  tiles within the halo width of a shared boundary - followed by the tile
+  payload messages. Received tiles are registered in the local sparse map
+  and their data unpacked into the tile-indexed array, so unoccupied tiles
+  generate no communication or storage.
+
+  Tile data is stored in a rank-2 view indexed as (tile,cell) where the tile
+  index is the tile number assigned by the sparse map and the second
+  dimension holds the flattened cell (and degree-of-freedom) data of the
+  tile. The view must have capacity for the ghost tiles registered by a
+  gather.
+
+  \tparam MemorySpace Memory space in which the sparse map and tile data
+  reside.
+  \tparam SparseMapType Sparse map type holding the occupied tiles.
+*/
+template <class MemorySpace, class SparseMapType>
+class SparseHalo
+{
+  public:
+    //! Memory space. Device and execution space types are also accepted.
+    using memory_space = typename MemorySpace::memory_space;
+    //! Sparse map type.
+    using sparse_map_type = SparseMapType;
+    //! Tile hash key type.
+    using key_type = typename sparse_map_type::key_type;
+    //! Tile number type.
+    using value_type = typename sparse_map_type::value_type;
+
+    //! Number of bits to shift a tile index to its first cell index.
+    static constexpr unsigned long long cell_bits_per_tile_dim =
+        sparse_map_type::cell_bits_per_tile_dim;
+
+    /*!
+      \brief Constructor.
+
+      \param cart_comm 3d Cartesian communicator over which the sparse
+      blocks are decomposed.
+      \param own_tile_min Global tile index of the low corner of the owned
+      block.
+      \param own_tile_max Global tile index of the high corner of the owned
+      block (exclusive).
+      \param halo_tile_width Width of the halo in tiles.
+    */
+    SparseHalo( MPI_Comm cart_comm, const std::array<int, 3>& own_tile_min,
+                const std::array<int, 3>& own_tile_max,
+                const int halo_tile_width )
+        : _own_tile_min( own_tile_min )
+        , _own_tile_max( own_tile_max )
+        , _halo_tile_width( halo_tile_width )
+    {
+        // Duplicate the communicator so we have our own communication space.
+        MPI_Comm_dup( cart_comm, &_comm );
+
+        // Get the Cartesian topology.
+        std::array<int, 3> dims;
+        std::array<int, 3> periods;
+        std::array<int, 3> coords;
+        MPI_Cart_get( _comm, 3, dims.data(), periods.data(), coords.data() );
+
+        // Enumerate the neighbors we communicate with.
+        for ( int i = -1; i < 2; ++i )
+            for ( int j = -1; j < 2; ++j )
+                for ( int k = -1; k < 2; ++k )
+                {
+                    if ( 0 == i && 0 == j && 0 == k )
+                        continue;
+
+                    std::array<int, 3> off = { i, j, k };
+                    std::array<int, 3> nc;
+                    bool valid = true;
+                    for ( int d = 0; d < 3; ++d )
+                    {
+                        nc[d] = coords[d] + off[d];
+                        if ( ( nc[d] < 0 || nc[d] >= dims[d] ) &&
+                             !periods[d] )
+                            valid = false;
+                    }
+                    if ( !valid )
+                        continue;
+
+                    int nr;
+                    MPI_Cart_rank( _comm, nc.data(), &nr );
+                    _neighbor_ranks.push_back( nr );
+                    _neighbor_offsets.push_back( off );
+                }
+    }
+
+    // Destructor.
+    ~SparseHalo() { MPI_Comm_free( &_comm ); }
+
+    /*!
+      \brief Gather the occupied tiles of our neighbors into our ghost
+      regions.
+
+      Performs the tile-key handshake with each neighbor and then exchanges
+      the payload of the occupied shared tiles. Received tiles are inserted
+      into the sparse map before their data is unpacked.
+
+      \param exec_space The execution space to use for pack/unpack.
+      \param map The sparse map of occupied tiles. Received ghost tiles are
+      registered in the map, which must have capacity for them.
+      \param tile_data The tile-indexed array to gather, indexed as
+      (tile,cell).
+    */
+    template <class ExecutionSpace, class TileDataViewType>
+    void gather( const ExecutionSpace& exec_space, SparseMapType& map,
+                 TileDataViewType& tile_data ) const
+    {
+        exchange( exec_space, map, tile_data, true );
+    }
+
+    /*!
+      \brief Scatter the data of our ghost tiles back to their owning ranks
+      and sum the contributions into the owner data.
+
+      Only the occupied tiles of the ghost regions are communicated. Tiles
+      a rank receives that it does not yet hold are inserted into its sparse
+      map.
+
+      \param exec_space The execution space to use for pack/unpack.
+      \param map The sparse map of occupied tiles.
+      \param tile_data The tile-indexed array to scatter, indexed as
+      (tile,cell).
+    */
+    template <class ExecutionSpace, class TileDataViewType>
+    void scatter( const ExecutionSpace& exec_space, SparseMapType& map,
+                  TileDataViewType& tile_data ) const
+    {
+        exchange( exec_space, map, tile_data, false );
+    }
+
+  private:
+    // Get the global tile bounds of the region exchanged with a neighbor.
+    // For a gather this is the slab of owned tiles within the halo width of
+    // the shared boundary. For a scatter it is the slab of ghost tiles on
+    // the neighbor side of the boundary.
+    void exchangeTileBounds( const std::array<int, 3>& off, const bool gather,
+                             int min[3], int max[3] ) const
+    {
+        for ( int d = 0; d < 3; ++d )
+        {
+            if ( -1 == off[d] )
+            {
+                min[d] = gather ? _own_tile_min[d]
+                                : _own_tile_min[d] - _halo_tile_width;
+                max[d] = gather ? _own_tile_min[d] + _halo_tile_width
+                                : _own_tile_min[d];
+            }
+            else if ( 1 == off[d] )
+            {
+                min[d] = gather ? _own_tile_max[d] - _halo_tile_width
+                                : _own_tile_max[d];
+                max[d] = gather ? _own_tile_max[d]
+                                : _own_tile_max[d] + _halo_tile_width;
+            }
+            else
+            {
+                min[d] = _own_tile_min[d];
+                max[d] = _own_tile_max[d];
+            }
+        }
+    }
+
+    // Encode a neighbor offset as a message tag modifier so messages from
+    // neighbors that map to the same rank stay distinct.
+    static int offsetTag( const std::array<int, 3>& off )
+    {
+        return ( off[0] + 1 ) * 9 + ( off[1] + 1 ) * 3 + ( off[2] + 1 );
+    }
+
+    // Exchange the occupied tiles of the gather or scatter regions with all
+    // neighbors.
+    template <class ExecutionSpace, class TileDataViewType>
+    void exchange( const ExecutionSpace&, SparseMapType& map,
+                   TileDataViewType& tile_data, const bool gather ) const
+    {
+        static_assert( 2 == TileDataViewType::Rank,
+                       "Sparse tile data must be a rank-2 (tile,cell) view" );
+        static_assert(
+            std::is_same<typename TileDataViewType::memory_space,
+                         memory_space>::value,
+            "Mismatching tile data/halo memory space." );
+        using data_type = typename TileDataViewType::value_type;
+
+        int num_n = _neighbor_ranks.size();
+        if ( 0 == num_n )
+            return;
+
+        const long payload_size = tile_data.extent( 1 );
+
+        // Pack the keys and payload of the occupied tiles in the exchange
+        // region of each neighbor.
+        std::vector<Kokkos::View<key_type*, memory_space>> send_keys;
+        std::vector<Kokkos::View<data_type*, memory_space>> send_data;
+        std::vector<int> send_counts( num_n );
+        for ( int n = 0; n < num_n; ++n )
+        {
+            int tile_min[3];
+            int tile_max[3];
+            exchangeTileBounds( _neighbor_offsets[n], gather, tile_min,
+                                tile_max );
+            Kokkos::Array<int, 3> bounds_min = { tile_min[0], tile_min[1],
+                                                 tile_min[2] };
+            Kokkos::Array<int, 3> bounds_max = { tile_max[0], tile_max[1],
+                                                 tile_max[2] };
+
+            // Count the occupied tiles in the exchange region.
+            int count = 0;
+            Kokkos::parallel_reduce(
+                "sparse_halo_count",
+                Kokkos::RangePolicy<ExecutionSpace>( 0, map.capacity() ),
+                KOKKOS_LAMBDA( const int t, int& result ) {
+                    if ( map.valid_at( t ) )
+                    {
+                        auto key = map.key_at( t );
+                        int ti, tj, tk;
+                        map.key2ijk( key, ti, tj, tk );
+                        if ( bounds_min[0] <= ti && ti < bounds_max[0] &&
+                             bounds_min[1] <= tj && tj < bounds_max[1] &&
+                             bounds_min[2] <= tk && tk < bounds_max[2] )
+                            ++result;
+                    }
+                },
+                count );
+            send_counts[n] = count;
+
+            // Pack the keys and payload of the occupied tiles.
+            Kokkos::View<key_type*, memory_space> keys(
+                Kokkos::ViewAllocateWithoutInitializing( "sparse_halo_keys" ),
+                count );
+            Kokkos::View<data_type*, memory_space> data(
+                Kokkos::ViewAllocateWithoutInitializing( "sparse_halo_data" ),
+                count * payload_size );
+            Kokkos::View<int, memory_space> pack_count( "pack_count" );
+            Kokkos::parallel_for(
+                "sparse_halo_pack",
+                Kokkos::RangePolicy<ExecutionSpace>( 0, map.capacity() ),
+                KOKKOS_LAMBDA( const int t ) {
+                    if ( map.valid_at( t ) )
+                    {
+                        auto key = map.key_at( t );
+                        int ti, tj, tk;
+                        map.key2ijk( key, ti, tj, tk );
+                        if ( bounds_min[0] <= ti && ti < bounds_max[0] &&
+                             bounds_min[1] <= tj && tj < bounds_max[1] &&
+                             bounds_min[2] <= tk && tk < bounds_max[2] )
+                        {
+                            int idx =
+                                Kokkos::atomic_fetch_add( &pack_count(), 1 );
+                            keys( idx ) = key;
+                            auto tid = map.queryTile(
+                                ti << cell_bits_per_tile_dim,
+                                tj << cell_bits_per_tile_dim,
+                                tk << cell_bits_per_tile_dim );
+                            for ( long c = 0; c < payload_size; ++c )
+                                data( idx * payload_size + c ) =
+                                    tile_data( tid, c );
+                        }
+                    }
+                } );
+            send_keys.push_back( keys );
+            send_data.push_back( data );
+        }
+        Kokkos::fence();
+
+        // Tile-key handshake: exchange the occupied tile counts.
+        std::vector<int> recv_counts( num_n );
+        std::vector<MPI_Request> count_requests( 2 * num_n );
+        for ( int n = 0; n < num_n; ++n )
+        {
+            std::array<int, 3> reverse_off = { -_neighbor_offsets[n][0],
+                                               -_neighbor_offsets[n][1],
+                                               -_neighbor_offsets[n][2] };
+            MPI_Irecv( &recv_counts[n], 1, MPI_INT, _neighbor_ranks[n],
+                       1000 + offsetTag( reverse_off ), _comm,
+                       &count_requests[n] );
+            MPI_Isend( &send_counts[n], 1, MPI_INT, _neighbor_ranks[n],
+                       1000 + offsetTag( _neighbor_offsets[n] ), _comm,
+                       &count_requests[num_n + n] );
+        }
+        MPI_Waitall( 2 * num_n, count_requests.data(), MPI_STATUSES_IGNORE );
+
+        // Exchange the keys and payload of the occupied tiles. Neighbors
+        // with no occupied tiles in the exchange region send nothing.
+        std::vector<Kokkos::View<key_type*, memory_space>> recv_keys;
+        std::vector<Kokkos::View<data_type*, memory_space>> recv_data;
+        std::vector<MPI_Request> data_requests;
+        data_requests.reserve( 4 * num_n );
+        for ( int n = 0; n < num_n; ++n )
+        {
+            Kokkos::View<key_type*, memory_space> keys(
+                Kokkos::ViewAllocateWithoutInitializing( "sparse_halo_keys" ),
+                recv_counts[n] );
+            Kokkos::View<data_type*, memory_space> data(
+                Kokkos::ViewAllocateWithoutInitializing( "sparse_halo_data" ),
+                recv_counts[n] * payload_size );
+            recv_keys.push_back( keys );
+            recv_data.push_back( data );
+
+            std::array<int, 3> reverse_off = { -_neighbor_offsets[n][0],
+                                               -_neighbor_offsets[n][1],
+                                               -_neighbor_offsets[n][2] };
+            if ( recv_counts[n] > 0 )
+            {
+                data_requests.push_back( MPI_Request() );
+                MPI_Irecv( keys.data(),
+                           recv_counts[n] * sizeof( key_type ), MPI_BYTE,
+                           _neighbor_ranks[n],
+                           2000 + offsetTag( reverse_off ), _comm,
+                           &data_requests.back() );
+                data_requests.push_back( MPI_Request() );
+                MPI_Irecv( data.data(), recv_counts[n] * payload_size,
+                           MpiTraits<data_type>::type(), _neighbor_ranks[n],
+                           3000 + offsetTag( reverse_off ), _comm,
+                           &data_requests.back() );
+            }
+            if ( send_counts[n] > 0 )
+            {
+                data_requests.push_back( MPI_Request() );
+                MPI_Isend( send_keys[n].data(),
+                           send_counts[n] * sizeof( key_type ), MPI_BYTE,
+                           _neighbor_ranks[n],
+                           2000 + offsetTag( _neighbor_offsets[n] ), _comm,
+                           &data_requests.back() );
+                data_requests.push_back( MPI_Request() );
+                MPI_Isend( send_data[n].data(),
+                           send_counts[n] * payload_size,
+                           MpiTraits<data_type>::type(), _neighbor_ranks[n],
+                           3000 + offsetTag( _neighbor_offsets[n] ), _comm,
+                           &data_requests.back() );
+            }
+        }
+        MPI_Waitall( data_requests.size(), data_requests.data(),
+                     MPI_STATUSES_IGNORE );
+
+        // Unpack. Insert the received tiles into the sparse map first so
+        // every received tile has a tile number, then copy or sum the
+        // payload into the tile data.
+        for ( int n = 0; n < num_n; ++n )
+        {
+            if ( 0 == recv_counts[n] )
+                continue;
+
+            auto keys = recv_keys[n];
+            auto data = recv_data[n];
+            Kokkos::parallel_for(
+                "sparse_halo_insert",
+                Kokkos::RangePolicy<ExecutionSpace>( 0, recv_counts[n] ),
+                KOKKOS_LAMBDA( const int t ) {
+                    auto key = keys( t );
+                    int ti, tj, tk;
+                    map.key2ijk( key, ti, tj, tk );
+                    map.insertTile( ti, tj, tk );
+                } );
+            Kokkos::fence();
+            Kokkos::parallel_for(
+                "sparse_halo_unpack",
+                Kokkos::RangePolicy<ExecutionSpace>( 0, recv_counts[n] ),
+                KOKKOS_LAMBDA( const int t ) {
+                    auto key = keys( t );
+                    int ti, tj, tk;
+                    map.key2ijk( key, ti, tj, tk );
+                    auto tid =
+                        map.queryTile( ti << cell_bits_per_tile_dim,
+                                       tj << cell_bits_per_tile_dim,
+                                       tk << cell_bits_per_tile_dim );
+                    for ( long c = 0; c < payload_size; ++c )
+                    {
+                        if ( gather )
+                            tile_data( tid, c ) =
+                                data( t * payload_size + c );
+                        else
+                            Kokkos::atomic_add(
+                                &tile_data( tid, c ),
+                                data( t * payload_size + c ) );
+                    }
+                } );
+        }
+        Kokkos::fence();
+    }
+
+  private:
+    // Communicator.
+    MPI_Comm _comm;
+
+    // Global tile bounds of the owned block.
+    std::array<int, 3> _own_tile_min;
+    std::array<int, 3> _own_tile_max;
+
+    // Halo width in tiles.
+    int _halo_tile_width;
+
+    // Neighbor ranks and their offsets relative to this block.
+    std::vector<int> _neighbor_ranks;
+    std::vector<std::array<int, 3>> _neighbor_offsets;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sparse halo creation function.
+
+  \param cart_comm 3d Cartesian communicator over which the sparse blocks
+  are decomposed.
+  \param own_tile_min Global tile index of the low corner of the owned
+  block.
+  \param own_tile_max Global tile index of the high corner of the owned
+  block (exclusive).
+  \param halo_tile_width Width of the halo in tiles.
+*/
+template <class MemorySpace, class SparseMapType>
+std::shared_ptr<SparseHalo<MemorySpace, SparseMapType>>
+createSparseHalo( MPI_Comm cart_comm, const std::array<int, 3>& own_tile_min,
+                  const std::array<int, 3>& own_tile_max,
+                  const int halo_tile_width )
+{
+    return std::make_shared<SparseHalo<MemorySpace, SparseMapType>>(
+        cart_comm, own_tile_min, own_tile_max, halo_tile_width );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Experimental
+} // end namespace Cajita
+
+#endif // end CAJITA_SPARSEHALO_HPP
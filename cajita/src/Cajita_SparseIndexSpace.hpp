@@ -474,6 +474,30 @@ class SparseMap
         _block_id_space.insert( tile_i, tile_j, tile_k );
     }
 
+    /*!
+      \brief (Device) Check if the tile of a cell is registered in the hash
+      table; Note that the ijk should be global
+      \param cell_i, cell_j, cell_k Cell ID in each dimension
+    */
+    KOKKOS_INLINE_FUNCTION
+    bool validCell( int cell_i, int cell_j, int cell_k ) const
+    {
+        return validTile( cell_i >> cell_bits_per_tile_dim,
+                          cell_j >> cell_bits_per_tile_dim,
+                          cell_k >> cell_bits_per_tile_dim );
+    }
+
+    /*!
+      \brief (Device) Check if a tile is registered in the hash table; Note
+      that the tile ijk should be global
+      \param tile_i, tile_j, tile_k Tile ID in each dimension
+    */
+    KOKKOS_INLINE_FUNCTION
+    bool validTile( int tile_i, int tile_j, int tile_k ) const
+    {
+        return _block_id_space.exists( tile_i, tile_j, tile_k );
+    }
+
     /*!
       \brief (Device) Query the 1D tile key from the 3D cell ijk
       \param cell_i, cell_j, cell_k Cell ID in each dimension
@@ -549,6 +573,16 @@ class SparseMap
         return _block_id_space.key_at( index );
     }
 
+    /*!
+      \brief (Device) Get tile No. at index
+      \param index index number in Kokkos unordered_map
+    */
+    KOKKOS_INLINE_FUNCTION
+    value_type value_at( uint32_t index ) const
+    {
+        return _block_id_space.value_at( index );
+    }
+
     /*!
       \brief (Device) Transfer block hash key to block ijk
       \param key Tile hash key
@@ -752,6 +786,26 @@ class BlockMap
             _tile_table.find( ijk2key( tile_i, tile_j, tile_k ) ) );
     }
 
+    /*!
+      \brief (Device) Get tile No. at index.
+      \param index index number in Kokkos unordered map
+    */
+    KOKKOS_INLINE_FUNCTION
+    value_type value_at( uint32_t index ) const
+    {
+        return _tile_table.value_at( index );
+    }
+
+    /*!
+      \brief (Device) Check whether a tile is registered in the hash table
+      \param tile_i, tile_j, tile_k Tile ID in each dimension
+    */
+    KOKKOS_INLINE_FUNCTION
+    bool exists( int tile_i, int tile_j, int tile_k ) const
+    {
+        return _tile_table.exists( ijk2key( tile_i, tile_j, tile_k ) );
+    }
+
     /*!
       \brief (Device) Transfer tile ijk to tile hash key
       \param tile_i, tile_j, tile_k Tile ID in each dimension
@@ -0,0 +1,430 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cajita_SparseInterpolation.hpp
+  \brief Grid-to-point interpolation directly on sparse grid tiles
+*/
+#ifndef CAJITA_SPARSEINTERPOLATION_HPP
+#define CAJITA_SPARSEINTERPOLATION_HPP
+
+#include <Cajita_Interpolation.hpp>
+#include <Cajita_LocalMesh.hpp>
+#include <Cajita_SparseIndexSpace.hpp>
+#include <Cajita_Splines.hpp>
+#include <Cajita_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <array>
+#include <type_traits>
+
+namespace Cajita
+{
+namespace Experimental
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Entity-indexed device view of tile-hash-mapped sparse grid data.
+
+  Sparse grids store field data per occupied tile in a rank-2 view indexed
+  as (tile,channel) - the layout exchanged by the sparse halo - instead of a
+  dense array over the full index space. This wrapper presents that storage
+  with the (i,j,k,comp) entity indexing the interpolation kernels use: an
+  access hashes the entity's tile through the sparse map and indexes the
+  flattened cell and component channel inside the tile, so interpolation can
+  consume sparse storage natively with no dense materialization of the
+  interpolation region.
+
+  The sparse map hashes global indices while interpolation stencils are
+  computed in the ghosted frame of a local mesh; the view applies the
+  local-to-global index offset of the block on each access. Every entity
+  accessed must lie in a registered tile - the sparse analog of the dense
+  requirement that a stencil be contained within the local grid.
+
+  \tparam TileDataView Rank-2 view of tile data indexed as (tile,channel)
+  with channel = flattened cell id * number of components + component.
+  \tparam SparseMapType Sparse map type registering the occupied tiles.
+*/
+template <class TileDataView, class SparseMapType>
+struct SparseArrayView
+{
+    static_assert( 2 == TileDataView::Rank,
+                   "Sparse tile data must be a rank-2 view" );
+
+    //! Value type of the tile data.
+    using value_type = typename TileDataView::value_type;
+    //! Reference type of the tile data.
+    using reference_type = typename TileDataView::reference_type;
+
+    //! The tile data indexed as (tile,channel).
+    TileDataView _tile_data;
+    //! The sparse map registering the occupied tiles.
+    SparseMapType _map;
+    //! Local-to-global entity index offset of the block.
+    Kokkos::Array<int, 3> _offset;
+    //! Number of components per entity.
+    int _num_comp;
+
+    //! Access the sparse data with entity indexing.
+    KOKKOS_INLINE_FUNCTION
+    reference_type operator()( const int i, const int j, const int k,
+                               const int comp ) const
+    {
+        auto cell = _map.queryCell( i + _offset[0], j + _offset[1],
+                                    k + _offset[2] );
+        auto tile_id = cell >> SparseMapType::cell_bits_per_tile;
+        auto cell_id = cell & ( SparseMapType::cell_num_per_tile - 1 );
+        return _tile_data( tile_id, cell_id * _num_comp + comp );
+    }
+};
+
+/*!
+  \brief Create an entity-indexed view of tile-hash-mapped sparse data.
+
+  \param tile_data The tile data indexed as (tile,channel).
+  \param map The sparse map registering the occupied tiles.
+  \param num_comp The number of components per entity.
+  \param index_offset Local-to-global entity index offset of the block: the
+  global index of the entity at index 0 of the ghosted local frame in which
+  the interpolation stencils are computed.
+*/
+template <class TileDataView, class SparseMapType>
+SparseArrayView<TileDataView, SparseMapType>
+createSparseArrayView( const TileDataView& tile_data, const SparseMapType& map,
+                       const int num_comp,
+                       const std::array<int, 3>& index_offset )
+{
+    return SparseArrayView<TileDataView, SparseMapType>{
+        tile_data,
+        map,
+        { index_offset[0], index_offset[1], index_offset[2] },
+        num_comp };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ \brief Sparse grid-to-point interpolation.
+
+  Interpolates from tile-hash-mapped sparse storage to points. The
+  interpolation stencils read the sparse view directly - the 5% of the
+  domain that is occupied is the only data touched and no dense array is
+  materialized. Every stencil entity of every point must lie in a registered
+  tile.
+
+  \param local_mesh The local mesh in whose ghosted frame the interpolation
+  stencils are computed. Must be consistent with the index offset of the
+  sparse view.
+
+  \param sparse_view The entity-indexed view of the sparse grid data to
+  interpolate from. Create with createSparseArrayView.
+
+  \param points The points over which to perform the interpolation. Will be
+  indexed as (point,dim).
+
+  \param num_point The number of points. This is the size of the first
+  dimension of points.
+
+  \param functor A functor that interpolates from a given entity to a given
+  point. The grid-to-point functors of the dense interpolation
+  (e.g. createScalarValueG2P) may be used directly.
+
+  \note Spline of SplineOrder passed for interpolation.
+  \note EntityType The entity type on which the sparse data lives.
+*/
+template <class PointEvalFunctor, class PointCoordinates, class TileDataView,
+          class SparseMapType, class MeshScalar, class EntityType,
+          int SplineOrder, class Device>
+void sparse_g2p(
+    const LocalMesh<Device, UniformMesh<MeshScalar>>& local_mesh,
+    const SparseArrayView<TileDataView, SparseMapType>& sparse_view,
+    const PointCoordinates& points, const std::size_t num_point,
+    Spline<SplineOrder>, EntityType, const PointEvalFunctor& functor )
+{
+    using execution_space = typename Device::execution_space;
+
+    // Loop over points and interpolate from the sparse grid.
+    Kokkos::parallel_for(
+        "sparse_g2p", Kokkos::RangePolicy<execution_space>( 0, num_point ),
+        KOKKOS_LAMBDA( const int p ) {
+            // Get the point coordinates.
+            MeshScalar px[3];
+            for ( std::size_t d = 0; d < 3; ++d )
+            {
+                px[d] = points( p, d );
+            }
+
+            // Create the local spline data.
+            using sd_type = SplineData<MeshScalar, SplineOrder, 3, EntityType>;
+            sd_type sd;
+            evaluateSpline( local_mesh, px, sd );
+
+            // Evaluate the functor.
+            functor( sd, p, sparse_view );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Entity-indexed wrapper over a tile region staged in team scratch. Indices
+// are in the same ghosted local frame as the spline stencils; the wrapper
+// subtracts the staged region origin.
+template <class ScratchView>
+struct StagedTileView
+{
+    using reference_type = typename ScratchView::reference_type;
+
+    ScratchView _staged;
+    int _i0, _j0, _k0;
+    int _extent;
+
+    KOKKOS_INLINE_FUNCTION
+    reference_type operator()( const int i, const int j, const int k,
+                               const int comp ) const
+    {
+        return _staged( ( ( i - _i0 ) * _extent + ( j - _j0 ) ) * _extent +
+                            ( k - _k0 ),
+                        comp );
+    }
+};
+
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+ \brief Sparse grid-to-point interpolation with per-tile scratch staging.
+
+  Performs the same interpolation as sparse_g2p but bins the points by their
+  home tile and processes one tile per team: the tile's data plus the
+  stencil margin into the neighboring tiles is staged into team scratch with
+  one hash query per staged entity, and all points of the tile then
+  interpolate from scratch. Each sparse entity is hashed and loaded from
+  global memory once per tile instead of once per point stencil entry, which
+  is most profitable for many points per occupied tile.
+
+  Staged entities in unregistered tiles are zero-filled; as with the flat
+  sparse_g2p the stencils of the points themselves must only touch
+  registered tiles.
+
+  \param local_mesh The local mesh in whose ghosted frame the interpolation
+  stencils are computed. Must be consistent with the index offset of the
+  sparse view.
+
+  \param sparse_view The entity-indexed view of the sparse grid data to
+  interpolate from. Create with createSparseArrayView.
+
+  \param points The points over which to perform the interpolation. Will be
+  indexed as (point,dim).
+
+  \param num_point The number of points. This is the size of the first
+  dimension of points.
+
+  \param functor A functor that interpolates from a given entity to a given
+  point. The grid-to-point functors of the dense interpolation
+  (e.g. createScalarValueG2P) may be used directly.
+
+  \note Spline of SplineOrder passed for interpolation.
+  \note EntityType The entity type on which the sparse data lives.
+*/
+template <class PointEvalFunctor, class PointCoordinates, class TileDataView,
+          class SparseMapType, class MeshScalar, class EntityType,
+          int SplineOrder, class Device>
+void sparse_g2p_staged(
+    const LocalMesh<Device, UniformMesh<MeshScalar>>& local_mesh,
+    const SparseArrayView<TileDataView, SparseMapType>& sparse_view,
+    const PointCoordinates& points, const std::size_t num_point,
+    Spline<SplineOrder>, EntityType, const PointEvalFunctor& functor )
+{
+    using execution_space = typename Device::execution_space;
+    using memory_space = typename Device::memory_space;
+    using sd_type = SplineData<MeshScalar, SplineOrder, 3, EntityType>;
+    using value_type = typename TileDataView::value_type;
+
+    constexpr int cell_per_tile_dim = SparseMapType::cell_num_per_tile_dim;
+    constexpr int cell_bits_per_tile_dim =
+        SparseMapType::cell_bits_per_tile_dim;
+
+    // The staged region of a tile covers its own entities plus the stencil
+    // margin reaching into the neighboring tiles on the high side. Points
+    // are binned by the tile of their first stencil index so stencils only
+    // extend upward from the staged origin.
+    constexpr int staged_extent = cell_per_tile_dim + sd_type::num_knot;
+    constexpr int staged_size =
+        staged_extent * staged_extent * staged_extent;
+
+    const auto map = sparse_view._map;
+    const auto offset = sparse_view._offset;
+    const int num_comp = sparse_view._num_comp;
+    const std::size_t num_tile = map.size();
+    if ( 0 == num_tile || 0 == num_point )
+        return;
+
+    Kokkos::RangePolicy<execution_space> point_policy( 0, num_point );
+
+    // Locate every point in its home tile - the tile of the first stencil
+    // index - and count the points per tile.
+    Kokkos::View<int*, memory_space> point_tiles(
+        Kokkos::ViewAllocateWithoutInitializing( "sparse_g2p_point_tiles" ),
+        num_point );
+    Kokkos::View<int*, memory_space> tile_counts( "sparse_g2p_tile_counts",
+                                                  num_tile );
+    Kokkos::parallel_for(
+        "sparse_g2p_bin_count", point_policy, KOKKOS_LAMBDA( const int p ) {
+            MeshScalar px[3];
+            for ( std::size_t d = 0; d < 3; ++d )
+                px[d] = points( p, d );
+            sd_type sd;
+            evaluateSpline( local_mesh, px, sd );
+            int tile_id = map.queryTile( sd.s[Dim::I][0] + offset[0],
+                                         sd.s[Dim::J][0] + offset[1],
+                                         sd.s[Dim::K][0] + offset[2] );
+            point_tiles( p ) = tile_id;
+            Kokkos::atomic_increment( &tile_counts( tile_id ) );
+        } );
+
+    // Scan the counts into per-tile point offsets.
+    Kokkos::View<int*, memory_space> tile_offsets(
+        Kokkos::ViewAllocateWithoutInitializing( "sparse_g2p_tile_offsets" ),
+        num_tile );
+    Kokkos::parallel_scan(
+        "sparse_g2p_bin_scan",
+        Kokkos::RangePolicy<execution_space>( 0, num_tile ),
+        KOKKOS_LAMBDA( const int t, int& update, const bool final_pass ) {
+            if ( final_pass )
+                tile_offsets( t ) = update;
+            update += tile_counts( t );
+        } );
+
+    // Scatter the point ids into tile order.
+    Kokkos::View<int*, memory_space> tile_points(
+        Kokkos::ViewAllocateWithoutInitializing( "sparse_g2p_tile_points" ),
+        num_point );
+    Kokkos::View<int*, memory_space> tile_fill( "sparse_g2p_tile_fill",
+                                                num_tile );
+    Kokkos::parallel_for(
+        "sparse_g2p_bin_scatter", point_policy, KOKKOS_LAMBDA( const int p ) {
+            int tile_id = point_tiles( p );
+            int j = Kokkos::atomic_fetch_add( &tile_fill( tile_id ), 1 );
+            tile_points( tile_offsets( tile_id ) + j ) = p;
+        } );
+
+    // Build the global tile origin of every tile number so a team can place
+    // its staged region.
+    Kokkos::View<int* [3], memory_space> tile_origins(
+        Kokkos::ViewAllocateWithoutInitializing( "sparse_g2p_tile_origins" ),
+        num_tile );
+    Kokkos::parallel_for(
+        "sparse_g2p_tile_origins",
+        Kokkos::RangePolicy<execution_space>( 0, map.capacity() ),
+        KOKKOS_LAMBDA( const uint32_t index ) {
+            if ( map.valid_at( index ) )
+            {
+                auto key = map.key_at( index );
+                int ti, tj, tk;
+                map.key2ijk( key, ti, tj, tk );
+                auto tile_id = map.value_at( index );
+                tile_origins( tile_id, Dim::I ) = ti << cell_bits_per_tile_dim;
+                tile_origins( tile_id, Dim::J ) = tj << cell_bits_per_tile_dim;
+                tile_origins( tile_id, Dim::K ) = tk << cell_bits_per_tile_dim;
+            }
+        } );
+
+    // One team per occupied tile. The staged tile region lives in team
+    // scratch.
+    using team_policy =
+        Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+    using staged_view =
+        Kokkos::View<value_type**,
+                     typename execution_space::scratch_memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    team_policy policy( num_tile, Kokkos::AUTO );
+    policy = policy.set_scratch_size(
+        0, Kokkos::PerTeam( staged_view::shmem_size( staged_size,
+                                                     num_comp ) ) );
+
+    auto tile_data = sparse_view._tile_data;
+    Kokkos::parallel_for(
+        "sparse_g2p_staged", policy,
+        KOKKOS_LAMBDA( const typename team_policy::member_type& team ) {
+            const int tile_id = team.league_rank();
+            const int num_tile_point = tile_counts( tile_id );
+            if ( 0 == num_tile_point )
+                return;
+
+            // Global origin of the staged region.
+            const int gi0 = tile_origins( tile_id, Dim::I );
+            const int gj0 = tile_origins( tile_id, Dim::J );
+            const int gk0 = tile_origins( tile_id, Dim::K );
+
+            // Stage the tile region. Each entity is hashed and loaded once
+            // per team; entities in unregistered tiles are zero-filled.
+            staged_view staged( team.team_scratch( 0 ), staged_size,
+                                num_comp );
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange( team, staged_size ),
+                [&]( const int n ) {
+                    int si = n / ( staged_extent * staged_extent );
+                    int sj = ( n / staged_extent ) % staged_extent;
+                    int sk = n % staged_extent;
+                    int gi = gi0 + si;
+                    int gj = gj0 + sj;
+                    int gk = gk0 + sk;
+                    if ( map.validCell( gi, gj, gk ) )
+                    {
+                        auto cell = map.queryCell( gi, gj, gk );
+                        auto tid =
+                            cell >> SparseMapType::cell_bits_per_tile;
+                        auto cid =
+                            cell & ( SparseMapType::cell_num_per_tile - 1 );
+                        for ( int c = 0; c < num_comp; ++c )
+                            staged( n, c ) =
+                                tile_data( tid, cid * num_comp + c );
+                    }
+                    else
+                    {
+                        for ( int c = 0; c < num_comp; ++c )
+                            staged( n, c ) = 0.0;
+                    }
+                } );
+            team.team_barrier();
+
+            // The staged wrapper indexes in the ghosted local frame of the
+            // spline stencils.
+            Impl::StagedTileView<staged_view> staged_tile{
+                staged, gi0 - offset[0], gj0 - offset[1], gk0 - offset[2],
+                staged_extent };
+
+            // All points of the tile interpolate from scratch.
+            const int point_begin = tile_offsets( tile_id );
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange( team, num_tile_point ),
+                [&]( const int n ) {
+                    const int p = tile_points( point_begin + n );
+                    MeshScalar px[3];
+                    for ( std::size_t d = 0; d < 3; ++d )
+                        px[d] = points( p, d );
+                    sd_type sd;
+                    evaluateSpline( local_mesh, px, sd );
+                    functor( sd, p, staged_tile );
+                } );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Experimental
+} // end namespace Cajita
+
+#endif // end CAJITA_SPARSEINTERPOLATION_HPP
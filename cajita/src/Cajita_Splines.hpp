@@ -23,6 +23,24 @@
 
 #include <type_traits>
 
+//---------------------------------------------------------------------------//
+/*!
+  \def CAJITA_SPLINE_UNROLL
+  \brief Force full unrolling of loops over the spline stencil footprint.
+
+  The trip counts of the stencil loops in spline evaluation and in the
+  p2g/g2p kernels are compile-time constants given by the spline order, but
+  not all device compilers unroll the nested loops on their own. Forcing the
+  unroll flattens the fixed-order kernels so they can vectorize.
+*/
+#if defined( __clang__ ) || defined( __CUDACC__ ) || defined( __HIP__ )
+#define CAJITA_SPLINE_UNROLL _Pragma( "unroll" )
+#elif defined( __GNUC__ ) && ( __GNUC__ >= 8 )
+#define CAJITA_SPLINE_UNROLL _Pragma( "GCC unroll 4" )
+#else
+#define CAJITA_SPLINE_UNROLL
+#endif
+
 namespace Cajita
 {
 //---------------------------------------------------------------------------//
@@ -773,6 +791,7 @@ KOKKOS_INLINE_FUNCTION
     for ( std::size_t d = 0; d < NumSpaceDim; ++d )
     {
         offset = low_x[d] - p[d];
+        CAJITA_SPLINE_UNROLL
         for ( int n = 0; n < spline_type::num_knot; ++n )
             data.d[d][n] = offset + data.s[d][n] * dx[d];
     }
@@ -406,6 +406,29 @@ void arrayOpTest()
                 for ( long l = 0; l < ghosted_space.extent( 3 ); ++l )
                     EXPECT_EQ( host_view( i, j, k, l ),
                                ( 3.0 + 1.0 + 6.0 ) * scales[l] );
+
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    // Do a fused update and dot product: array = 2 * array + 3 * array_2
+    // with the dot product of the updated array with itself in one pass.
+    ArrayOp::assign( *array, 1.0, Ghost() );
+    ArrayOp::assign( *array_2, 0.5, Ghost() );
+    std::vector<double> update_dots( dofs_per_cell );
+    ArrayOp::updateDot( *array, 2.0, *array_2, 3.0, update_dots );
+    Kokkos::deep_copy( host_view, array->view() );
+    for ( long i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( long j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( long k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+                for ( long l = 0; l < owned_space.extent( 3 ); ++l )
+                    EXPECT_EQ( host_view( i, j, k, l ), 3.5 );
+    int total_cells = global_grid->globalNumEntity( Cell(), Dim::I ) *
+                      global_grid->globalNumEntity( Cell(), Dim::J ) *
+                      global_grid->globalNumEntity( Cell(), Dim::K );
+    for ( int n = 0; n < dofs_per_cell; ++n )
+        EXPECT_FLOAT_EQ( update_dots[n], 3.5 * 3.5 * total_cells );
+#endif
 }
 
 //---------------------------------------------------------------------------//
@@ -114,9 +114,16 @@ void writeTest3d()
         auto node_halo = createHalo( NodeHaloPattern<3>(), 0, *node_field );
         node_halo->gather( TEST_EXECSPACE(), *node_field );
 
-        // Write the fields to a file.
+        // Write the fields to a file. Write the node field with the
+        // write-behind variant and wait on the future before reading back.
         Experimental::BovWriter::writeTimeStep( 302, 3.43, *cell_field );
-        Experimental::BovWriter::writeTimeStep( 1972, 12.457, *node_field );
+        auto write_done = Experimental::BovWriter::writeTimeStepAsync(
+            1972, 12.457, *node_field );
+        write_done.wait();
+
+        // Write the cell field again down-converted to single precision.
+        Experimental::BovWriter::writeTimeStep<float>( 303, 3.43,
+                                                       *cell_field );
     }
     // Read the data back in on rank 0 and make sure it is OK.
     int rank;
@@ -155,6 +162,39 @@ void writeTest3d()
         // Close the cell file.
         cell_data_file.close();
 
+        // Open the single precision cell file. The values were
+        // down-converted from double on write.
+        std::fstream float_data_file;
+        float_data_file.open( "grid_cell_field_3d_000303.dat",
+                              std::fstream::in | std::fstream::binary );
+        float float_value;
+        cell_id = 0;
+        for ( int k = 0; k < global_grid->globalNumEntity( Cell(), Dim::K );
+              ++k )
+            for ( int j = 0; j < global_grid->globalNumEntity( Cell(), Dim::J );
+                  ++j )
+                for ( int i = 0;
+                      i < global_grid->globalNumEntity( Cell(), Dim::I ); ++i )
+                {
+                    double xarg = double( i ) / global_num_cell[0];
+                    double yarg = double( j ) / global_num_cell[1];
+                    double zarg = double( k ) / global_num_cell[2];
+
+                    float_data_file.seekg( cell_id * sizeof( float ) );
+                    float_data_file.read( (char*)&float_value,
+                                          sizeof( float ) );
+
+                    EXPECT_FLOAT_EQ(
+                        float_value,
+                        static_cast<float>(
+                            1.0 + fabs( cos( pi2 * xarg ) * cos( pi2 * yarg ) *
+                                        cos( pi2 * zarg ) ) ) );
+                    ++cell_id;
+                }
+
+        // Close the single precision cell file.
+        float_data_file.close();
+
         // Open the node file.
         std::fstream node_data_file;
         node_data_file.open( "grid_node_field_3d_001972.dat",
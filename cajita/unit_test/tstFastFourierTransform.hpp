@@ -226,6 +226,223 @@ void forwardReverseTest2d( bool use_default, bool use_params )
         }
 }
 
+//---------------------------------------------------------------------------//
+void forwardReverseR2CTest3d()
+{
+    // Create the global mesh.
+    double cell_size = 0.1;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { -1.0, -2.0, -1.0 };
+    std::array<double, 3> global_high_corner = { 1.0, 1.0, 0.5 };
+    auto global_mesh = createUniformGlobalMesh( global_low_corner,
+                                                global_high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a local grid.
+    auto local_grid = createLocalGrid( global_grid, 0 );
+    auto owned_space = local_grid->indexSpace( Own(), Cell(), Local() );
+    auto ghosted_space = local_grid->indexSpace( Ghost(), Cell(), Local() );
+
+    // Create a random real vector to transform. Real data uses a single
+    // degree-of-freedom per entity.
+    auto vector_layout = createArrayLayout( local_grid, 1, Cell() );
+    auto lhs = createArray<double, TEST_DEVICE>( "lhs", vector_layout );
+    auto lhs_view = lhs->view();
+    auto lhs_host_view = Kokkos::create_mirror_view( lhs_view );
+    uint64_t seed =
+        global_grid->blockId() + ( 19383747 % ( global_grid->blockId() + 1 ) );
+    using rnd_type = Kokkos::Random_XorShift64_Pool<Kokkos::HostSpace>;
+    rnd_type pool;
+    pool.init( seed, ghosted_space.size() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+            {
+                auto rand = pool.get_state( i + j + k );
+                lhs_host_view( i, j, k, 0 ) =
+                    Kokkos::rand<decltype( rand ), double>::draw( rand, 0.0,
+                                                                  1.0 );
+            }
+
+    // Copy to the device.
+    Kokkos::deep_copy( lhs_view, lhs_host_view );
+
+    // Calculate forward and reverse real-to-complex FFT.
+    auto fft =
+        Experimental::createHeffteFastFourierTransformR2C<double, TEST_DEVICE>(
+            *vector_layout );
+    fft->forward( *lhs, Experimental::FFTScaleFull() );
+    fft->reverse( *lhs, Experimental::FFTScaleNone() );
+
+    // Check the results.
+    auto lhs_result =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), lhs->view() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+                EXPECT_FLOAT_EQ( lhs_host_view( i, j, k, 0 ),
+                                 lhs_result( i, j, k, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+void forwardReverseBatchedTest3d()
+{
+    // Create the global mesh.
+    double cell_size = 0.1;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { -1.0, -2.0, -1.0 };
+    std::array<double, 3> global_high_corner = { 1.0, 1.0, 0.5 };
+    auto global_mesh = createUniformGlobalMesh( global_low_corner,
+                                                global_high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a local grid.
+    auto local_grid = createLocalGrid( global_grid, 0 );
+    auto owned_space = local_grid->indexSpace( Own(), Cell(), Local() );
+    auto ghosted_space = local_grid->indexSpace( Ghost(), Cell(), Local() );
+
+    // Create random vectors to transform as a batch.
+    auto vector_layout = createArrayLayout( local_grid, 2, Cell() );
+    auto lhs_x = createArray<double, TEST_DEVICE>( "lhs_x", vector_layout );
+    auto lhs_y = createArray<double, TEST_DEVICE>( "lhs_y", vector_layout );
+    auto lhs_z = createArray<double, TEST_DEVICE>( "lhs_z", vector_layout );
+    auto lhs_x_host_view = Kokkos::create_mirror_view( lhs_x->view() );
+    auto lhs_y_host_view = Kokkos::create_mirror_view( lhs_y->view() );
+    auto lhs_z_host_view = Kokkos::create_mirror_view( lhs_z->view() );
+    uint64_t seed =
+        global_grid->blockId() + ( 19383747 % ( global_grid->blockId() + 1 ) );
+    using rnd_type = Kokkos::Random_XorShift64_Pool<Kokkos::HostSpace>;
+    rnd_type pool;
+    pool.init( seed, ghosted_space.size() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+                for ( int d = 0; d < 2; ++d )
+                {
+                    auto rand = pool.get_state( i + j + k + d );
+                    lhs_x_host_view( i, j, k, d ) =
+                        Kokkos::rand<decltype( rand ), double>::draw( rand, 0.0,
+                                                                      1.0 );
+                    lhs_y_host_view( i, j, k, d ) =
+                        Kokkos::rand<decltype( rand ), double>::draw( rand, 0.0,
+                                                                      1.0 );
+                    lhs_z_host_view( i, j, k, d ) =
+                        Kokkos::rand<decltype( rand ), double>::draw( rand, 0.0,
+                                                                      1.0 );
+                }
+
+    // Copy to the device.
+    Kokkos::deep_copy( lhs_x->view(), lhs_x_host_view );
+    Kokkos::deep_copy( lhs_y->view(), lhs_y_host_view );
+    Kokkos::deep_copy( lhs_z->view(), lhs_z_host_view );
+
+    // Transform all fields through one plan and work buffer.
+    auto fft =
+        Experimental::createHeffteFastFourierTransform<double, TEST_DEVICE>(
+            *vector_layout );
+    fft->forwardBatched( Experimental::FFTScaleFull(), *lhs_x, *lhs_y,
+                         *lhs_z );
+    fft->reverseBatched( Experimental::FFTScaleNone(), *lhs_x, *lhs_y,
+                         *lhs_z );
+
+    // Check the results.
+    auto lhs_x_result = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), lhs_x->view() );
+    auto lhs_y_result = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), lhs_y->view() );
+    auto lhs_z_result = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), lhs_z->view() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+                for ( int d = 0; d < 2; ++d )
+                {
+                    EXPECT_FLOAT_EQ( lhs_x_host_view( i, j, k, d ),
+                                     lhs_x_result( i, j, k, d ) );
+                    EXPECT_FLOAT_EQ( lhs_y_host_view( i, j, k, d ),
+                                     lhs_y_result( i, j, k, d ) );
+                    EXPECT_FLOAT_EQ( lhs_z_host_view( i, j, k, d ),
+                                     lhs_z_result( i, j, k, d ) );
+                }
+}
+
+//---------------------------------------------------------------------------//
+void sharedPlanTest3d()
+{
+    // Create the global mesh.
+    double cell_size = 0.1;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { -1.0, -2.0, -1.0 };
+    std::array<double, 3> global_high_corner = { 1.0, 1.0, 0.5 };
+    auto global_mesh = createUniformGlobalMesh( global_low_corner,
+                                                global_high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a local grid.
+    auto local_grid = createLocalGrid( global_grid, 0 );
+    auto owned_space = local_grid->indexSpace( Own(), Cell(), Local() );
+
+    // Create a vector to transform.
+    auto vector_layout = createArrayLayout( local_grid, 2, Cell() );
+    auto lhs = createArray<double, TEST_DEVICE>( "lhs", vector_layout );
+    ArrayOp::assign( *lhs, 1.0, Own() );
+    auto lhs_host_view =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), lhs->view() );
+
+    // Multiple transforms over the same layout share one plan and one
+    // workspace, so a field transformed by one object can be reversed by
+    // another.
+    auto fft_a =
+        Experimental::createHeffteFastFourierTransform<double, TEST_DEVICE>(
+            *vector_layout );
+    auto fft_b =
+        Experimental::createHeffteFastFourierTransform<double, TEST_DEVICE>(
+            *vector_layout );
+    fft_a->forward( *lhs, Experimental::FFTScaleFull() );
+    fft_b->reverse( *lhs, Experimental::FFTScaleNone() );
+
+    // Check the results.
+    auto lhs_result =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), lhs->view() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+            {
+                EXPECT_FLOAT_EQ( lhs_host_view( i, j, k, 0 ),
+                                 lhs_result( i, j, k, 0 ) );
+                EXPECT_FLOAT_EQ( lhs_host_view( i, j, k, 1 ),
+                                 lhs_result( i, j, k, 1 ) );
+            }
+}
+
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -260,6 +477,18 @@ TEST( fast_fourier_transform, forward_reverse_2d_test )
     forwardReverseTest2d<Experimental::FFTBackendMKL>( false, false );
 #endif
 }
+
+TEST( fast_fourier_transform, forward_reverse_r2c_3d_test )
+{
+    forwardReverseR2CTest3d();
+}
+
+TEST( fast_fourier_transform, shared_plan_3d_test ) { sharedPlanTest3d(); }
+
+TEST( fast_fourier_transform, forward_reverse_batched_3d_test )
+{
+    forwardReverseBatchedTest3d();
+}
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
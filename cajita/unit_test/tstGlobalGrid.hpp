@@ -18,7 +18,9 @@
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 using namespace Cajita;
 
@@ -237,6 +239,89 @@ void gridTest3d( const std::array<bool, 3>& is_dim_periodic )
             -1 );
 }
 
+//---------------------------------------------------------------------------//
+void nodeAwareGridTest3d()
+{
+    // Let MPI compute the partitioning for this test.
+    UniformDimPartitioner partitioner;
+
+    // Create the global mesh.
+    double cell_size = 0.23;
+    std::array<int, 3> global_num_cell = { 47, 38, 53 };
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+
+    // Create the global grid with node-aware rank placement. The placement
+    // only changes which block a rank owns so the same grid invariants
+    // must hold.
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner, true );
+
+    // Check the partitioning. The grid communicator has a Cartesian topology.
+    int comm_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+    auto grid_comm = global_grid->comm();
+    int grid_comm_size;
+    MPI_Comm_size( grid_comm, &grid_comm_size );
+    int grid_comm_rank;
+    MPI_Comm_rank( grid_comm, &grid_comm_rank );
+    EXPECT_EQ( grid_comm_size, comm_size );
+    EXPECT_EQ( global_grid->totalNumBlock(), grid_comm_size );
+    EXPECT_EQ( global_grid->blockId(), grid_comm_rank );
+
+    auto ranks_per_dim =
+        partitioner.ranksPerDimension( MPI_COMM_WORLD, global_num_cell );
+    std::vector<int> cart_dims( 3 );
+    std::vector<int> cart_period( 3 );
+    std::vector<int> cart_rank( 3 );
+    MPI_Cart_get( grid_comm, 3, cart_dims.data(), cart_period.data(),
+                  cart_rank.data() );
+    for ( int d = 0; d < 3; ++d )
+    {
+        EXPECT_EQ( cart_period[d], is_dim_periodic[d] );
+        EXPECT_EQ( global_grid->dimBlockId( d ), cart_rank[d] );
+        EXPECT_EQ( global_grid->dimNumBlock( d ), ranks_per_dim[d] );
+    }
+
+    // Every block must be owned by exactly one rank.
+    std::vector<int> block_owners( comm_size, 0 );
+    int block_index =
+        ( global_grid->dimBlockId( Dim::I ) * ranks_per_dim[Dim::J] +
+          global_grid->dimBlockId( Dim::J ) ) *
+            ranks_per_dim[Dim::K] +
+        global_grid->dimBlockId( Dim::K );
+    block_owners[block_index] = 1;
+    MPI_Allreduce( MPI_IN_PLACE, block_owners.data(), block_owners.size(),
+                   MPI_INT, MPI_SUM, MPI_COMM_WORLD );
+    for ( int b = 0; b < comm_size; ++b )
+        EXPECT_EQ( block_owners[b], 1 );
+
+    // The decomposition must still cover the global cells.
+    for ( int d = 0; d < 3; ++d )
+    {
+        std::vector<int> dim_cells_per_rank( global_grid->dimNumBlock( d ), 0 );
+        dim_cells_per_rank[global_grid->dimBlockId( d )] =
+            global_grid->ownedNumCell( d );
+        MPI_Allreduce( MPI_IN_PLACE, dim_cells_per_rank.data(),
+                       dim_cells_per_rank.size(), MPI_INT, MPI_MAX,
+                       MPI_COMM_WORLD );
+        int dim_offset = 0;
+        for ( int n = 0; n < global_grid->dimBlockId( d ); ++n )
+            dim_offset += dim_cells_per_rank[n];
+        int dim_sum = 0;
+        for ( int n = 0; n < global_grid->dimNumBlock( d ); ++n )
+            dim_sum += dim_cells_per_rank[n];
+        EXPECT_EQ( global_grid->globalOffset( d ), dim_offset );
+        EXPECT_EQ( global_grid->globalNumEntity( Cell(), d ), dim_sum );
+    }
+}
+
 //---------------------------------------------------------------------------//
 void gridTest2d( const std::array<bool, 2>& is_dim_periodic )
 {
@@ -370,6 +455,95 @@ void gridTest2d( const std::array<bool, 2>& is_dim_periodic )
 
 //---------------------------------------------------------------------------//
 // RUN TESTS
+//---------------------------------------------------------------------------//
+void subCommTest3d()
+{
+    // Create a grid.
+    UniformDimPartitioner partitioner;
+    double cell_size = 0.23;
+    std::array<int, 3> global_num_cell = { 22, 19, 21 };
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+    std::array<bool, 3> periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         periodic, partitioner );
+    int cart_rank;
+    MPI_Comm_rank( global_grid->comm(), &cart_rank );
+
+    for ( int d = 0; d < 3; ++d )
+    {
+        // The line communicator runs over the blocks of this block's line
+        // ordered by block id in the dimension.
+        MPI_Comm line_comm = global_grid->lineComm( d );
+        int line_size, line_rank;
+        MPI_Comm_size( line_comm, &line_size );
+        MPI_Comm_rank( line_comm, &line_rank );
+        EXPECT_EQ( line_size, global_grid->dimNumBlock( d ) );
+        EXPECT_EQ( line_rank, global_grid->dimBlockId( d ) );
+
+        // The communicator is cached.
+        EXPECT_EQ( line_comm, global_grid->lineComm( d ) );
+
+        // The plane communicator covers the rest of the blocks.
+        MPI_Comm plane_comm = global_grid->planeComm( d );
+        int plane_size;
+        MPI_Comm_size( plane_comm, &plane_size );
+        EXPECT_EQ( plane_size, global_grid->totalNumBlock() /
+                                   global_grid->dimNumBlock( d ) );
+        EXPECT_EQ( plane_comm, global_grid->planeComm( d ) );
+
+        // Exchange each block's Cartesian rank along the line. Block r of
+        // the received data came from the block with id r in the dimension.
+        std::vector<int> line_send( line_size, cart_rank );
+        std::vector<int> line_recv( line_size, -1 );
+        global_grid->lineExchange( d, line_send.data(), line_recv.data(),
+                                   sizeof( int ) );
+        std::array<int, 3> ijk = { global_grid->dimBlockId( Dim::I ),
+                                   global_grid->dimBlockId( Dim::J ),
+                                   global_grid->dimBlockId( Dim::K ) };
+        for ( int r = 0; r < line_size; ++r )
+        {
+            ijk[d] = r;
+            EXPECT_EQ( line_recv[r], global_grid->blockRank( ijk ) );
+        }
+
+        // The variable-size exchange gives the same result.
+        std::vector<int> byte_counts( line_size, sizeof( int ) );
+        std::fill( line_recv.begin(), line_recv.end(), -1 );
+        global_grid->lineExchange( d, line_send.data(), byte_counts,
+                                   line_recv.data(), byte_counts );
+        for ( int r = 0; r < line_size; ++r )
+        {
+            ijk[d] = r;
+            EXPECT_EQ( line_recv[r], global_grid->blockRank( ijk ) );
+        }
+
+        // Exchange over the plane. The blocks are ranked in row-major
+        // order of the remaining dimensions.
+        std::vector<int> plane_send( plane_size, cart_rank );
+        std::vector<int> plane_recv( plane_size, -1 );
+        global_grid->planeExchange( d, plane_send.data(), plane_recv.data(),
+                                    sizeof( int ) );
+        const int d1 = ( 0 == d ) ? 1 : 0;
+        const int d2 = ( 2 == d ) ? 1 : 2;
+        int idx = 0;
+        ijk[d] = global_grid->dimBlockId( d );
+        for ( int i = 0; i < global_grid->dimNumBlock( d1 ); ++i )
+            for ( int j = 0; j < global_grid->dimNumBlock( d2 ); ++j )
+            {
+                ijk[d1] = i;
+                ijk[d2] = j;
+                EXPECT_EQ( plane_recv[idx], global_grid->blockRank( ijk ) );
+                ++idx;
+            }
+    }
+}
+
 //---------------------------------------------------------------------------//
 TEST( global_grid, 3d_grid_test )
 {
@@ -379,6 +553,10 @@ TEST( global_grid, 3d_grid_test )
     gridTest3d( not_periodic );
 }
 
+TEST( global_grid, 3d_node_aware_grid_test ) { nodeAwareGridTest3d(); }
+
+TEST( global_grid, 3d_sub_comm_test ) { subCommTest3d(); }
+
 TEST( global_grid, 2d_grid_test )
 {
     std::array<bool, 2> periodic = { true, true };
@@ -208,6 +208,20 @@ void gatherScatterTest( const ManualBlockPartitioner<2>& partitioner,
 
         // Check the scatter.
         checkScatter( is_dim_periodic, halo_width, *array );
+
+        // Repeat the gather and scatter asynchronously. Waiting on the
+        // request must give the same results as the blocking version.
+        ArrayOp::assign( *array, 0.0, Ghost() );
+        ArrayOp::assign( *array, 1.0, Own() );
+
+        auto gather_request = halo->gatherAsync( TEST_EXECSPACE(), *array );
+        gather_request.wait();
+        checkGather( is_dim_periodic, halo_width, *array );
+
+        auto scatter_request = halo->scatterAsync(
+            TEST_EXECSPACE(), ScatterReduce::Sum(), *array );
+        scatter_request.wait();
+        checkScatter( is_dim_periodic, halo_width, *array );
     }
 
     // Repeat the process but this time with multiple arrays in a Halo
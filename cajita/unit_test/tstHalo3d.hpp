@@ -24,6 +24,7 @@
 
 #include <array>
 #include <cmath>
+#include <stdexcept>
 
 using namespace Cajita;
 
@@ -231,6 +232,35 @@ void gatherScatterTest( const ManualBlockPartitioner<3>& partitioner,
 
         // Check the scatter.
         checkScatter( is_dim_periodic, halo_width, *array );
+
+        // Repeat the gather and scatter asynchronously. Waiting on the
+        // request must give the same results as the blocking version.
+        ArrayOp::assign( *array, 0.0, Ghost() );
+        ArrayOp::assign( *array, 1.0, Own() );
+
+        auto gather_request = halo->gatherAsync( TEST_EXECSPACE(), *array );
+        gather_request.wait();
+        checkGather( is_dim_periodic, halo_width, *array );
+
+        auto scatter_request = halo->scatterAsync(
+            TEST_EXECSPACE(), ScatterReduce::Sum(), *array );
+        scatter_request.wait();
+        checkScatter( is_dim_periodic, halo_width, *array );
+
+        // Repeat the exchange with a reduced-precision wire type. The test
+        // values are exactly representable in the wire type so the results
+        // are identical to the full-precision exchange.
+        ArrayOp::assign( *array, 0.0, Ghost() );
+        ArrayOp::assign( *array, 1.0, Own() );
+
+        auto rp_array = createReducedPrecision<float>( *array );
+        auto rp_halo = createHalo( FullHaloPattern(), halo_width, rp_array );
+
+        rp_halo->gather( TEST_EXECSPACE(), rp_array );
+        checkGather( is_dim_periodic, halo_width, *array );
+
+        rp_halo->scatter( TEST_EXECSPACE(), ScatterReduce::Sum(), rp_array );
+        checkScatter( is_dim_periodic, halo_width, *array );
     }
 
     // Repeat the process but this time with multiple arrays in a Halo
@@ -454,6 +484,122 @@ void scatterReduceTest( const ReduceFunc& reduce )
     }
 }
 
+//---------------------------------------------------------------------------//
+// Apply one step of a 7-point stencil update over the given index space
+// reading a snapshot of the previous values.
+template <class View>
+void stencilStep( const View& view, const IndexSpace<4>& space )
+{
+    auto v = view;
+    Kokkos::View<double****, TEST_DEVICE> old(
+        Kokkos::ViewAllocateWithoutInitializing( "old" ), view.extent( 0 ),
+        view.extent( 1 ), view.extent( 2 ), view.extent( 3 ) );
+    Kokkos::deep_copy( old, view );
+    Kokkos::parallel_for(
+        "stencil_step", createExecutionPolicy( space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k, const int l ) {
+            v( i, j, k, l ) =
+                old( i, j, k, l ) +
+                0.125 * ( old( i - 1, j, k, l ) + old( i + 1, j, k, l ) +
+                          old( i, j - 1, k, l ) + old( i, j + 1, k, l ) +
+                          old( i, j, k - 1, l ) + old( i, j, k + 1, l ) -
+                          6.0 * old( i, j, k, l ) );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a deep halo exchanging every k steps gives the same owned
+// results as a unit-width halo exchanging every step. Between exchanges the
+// stencil redundantly updates the still-needed ghost bands locally.
+void deepHaloTest()
+{
+    // Create the global grid.
+    double cell_size = 0.23;
+    std::array<int, 3> global_num_cell = { 17, 20, 21 };
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+
+    // Create the global grid. Every boundary is periodic so all ghosts are
+    // exchanged.
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid =
+        createGlobalGrid( MPI_COMM_WORLD, global_mesh, is_dim_periodic,
+                          DimBlockPartitioner<3>() );
+
+    // Create two cell arrays with a halo deep enough for two steps.
+    int deep_width = 2;
+    auto layout = createArrayLayout( global_grid, deep_width, 2, Cell() );
+    auto deep_array = createArray<double, TEST_DEVICE>( "deep", layout );
+    auto ref_array = createArray<double, TEST_DEVICE>( "ref", layout );
+
+    // Assign both arrays the same owned data and zero ghosts.
+    ArrayOp::assign( *deep_array, 0.0, Ghost() );
+    auto owned_space = layout->indexSpace( Own(), Local() );
+    auto deep_view = deep_array->view();
+    Kokkos::parallel_for(
+        "init", createExecutionPolicy( owned_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k, const int l ) {
+            deep_view( i, j, k, l ) = 0.001 * ( i + 2 * j + 3 * k + l );
+        } );
+    Kokkos::deep_copy( ref_array->view(), deep_array->view() );
+
+    // A deep halo over the full array halo and a unit-width reference halo.
+    auto deep_halo =
+        createDeepHalo( NodeHaloPattern<3>(), deep_width, *deep_array );
+    auto ref_halo = createHalo( NodeHaloPattern<3>(), 1, *ref_array );
+
+    // No ghosts are valid before the first gather.
+    EXPECT_EQ( deep_halo->width(), deep_width );
+    EXPECT_EQ( deep_halo->validWidth(), 0 );
+
+    int num_step = 4;
+    for ( int s = 0; s < num_step; ++s )
+    {
+        // The deep halo only exchanges when its ghosts are exhausted.
+        bool exchanged = deep_halo->gather( TEST_EXECSPACE(), *deep_array );
+        EXPECT_EQ( exchanged, 0 == s % deep_width );
+
+        // Update the owned cells plus the still-needed ghost bands.
+        stencilStep( deep_array->view(),
+                     layout->indexSpace( Ghost(), Local(),
+                                         deep_halo->validWidth() - 1 ) );
+        deep_halo->advance();
+
+        // Reference: exchange and update the owned cells every step.
+        ref_halo->gather( TEST_EXECSPACE(), *ref_array );
+        stencilStep( ref_array->view(), owned_space );
+    }
+
+    // Advancing past the valid ghost width must throw.
+    EXPECT_EQ( deep_halo->validWidth(), 0 );
+    EXPECT_THROW( deep_halo->advance(), std::logic_error );
+
+    // A deep halo must gather at least one ghost cell per exchange.
+    EXPECT_THROW( createDeepHalo( NodeHaloPattern<3>(), 0, *deep_array ),
+                  std::logic_error );
+
+    // The owned results must match exactly.
+    auto deep_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), deep_array->view() );
+    auto ref_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                         ref_array->view() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+                for ( int l = owned_space.min( 3 ); l < owned_space.max( 3 );
+                      ++l )
+                    EXPECT_EQ( deep_host( i, j, k, l ),
+                               ref_host( i, j, k, l ) );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -548,6 +694,9 @@ TEST( TEST_CATEGORY, scatter_reduce_replace_test )
     scatterReduceTest( ScatterReduce::Replace() );
 }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, deep_halo_test ) { deepHaloTest(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
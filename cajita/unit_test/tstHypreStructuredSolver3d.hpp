@@ -171,11 +171,8 @@ void poissonTest( const std::string& solver_type,
                 EXPECT_FLOAT_EQ( lhs_host( i, j, k, 0 ),
                                  lhs_ref_host( i, j, k, 0 ) );
 
-    // Setup the problem again. We would need to do this if we changed the
-    // matrix entries.
-    solver->setup();
-
-    // Solve the problem again
+    // Solve the problem again with only a new RHS. The matrix is unchanged
+    // so no new setup is needed and the last one is reused.
     ArrayOp::assign( *rhs, 2.0, Own() );
     ArrayOp::assign( *lhs, 0.0, Own() );
     solver->solve( *rhs, *lhs );
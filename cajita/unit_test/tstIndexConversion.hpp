@@ -106,6 +106,48 @@ void testConversion3d( const std::array<bool, 3>& is_dim_periodic )
             l2g_view( i, j, k, Dim::K ) = gk;
         } );
 
+    // Do the same loop with the cached table indexer.
+    auto global_table_array =
+        createArray<int, TEST_DEVICE>( "global_indices", array_layout );
+    auto table_view = global_table_array->view();
+    auto l2g_table = IndexConversion::createL2GTable<TEST_MEMSPACE>(
+        *local_grid, EntityType() );
+    Kokkos::parallel_for(
+        "fill_l2g_table",
+        createExecutionPolicy( ghost_local_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            int gi, gj, gk;
+            l2g_table( i, j, k, gi, gj, gk );
+            table_view( i, j, k, Dim::I ) = gi;
+            table_view( i, j, k, Dim::J ) = gj;
+            table_view( i, j, k, Dim::K ) = gk;
+        } );
+
+    // Convert the ghosted local indices as a batched index list with the
+    // cached tables.
+    std::size_t num_ghost = ghost_local_space.size();
+    Kokkos::View<int* [3], TEST_MEMSPACE> batch_lijk( "batch_lijk",
+                                                      num_ghost );
+    Kokkos::View<int* [3], TEST_MEMSPACE> batch_gijk( "batch_gijk",
+                                                      num_ghost );
+    Kokkos::parallel_for(
+        "fill_batch",
+        createExecutionPolicy( ghost_local_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            std::size_t n =
+                ( i - ghost_local_space.min( Dim::I ) ) *
+                    ghost_local_space.extent( Dim::J ) *
+                    ghost_local_space.extent( Dim::K ) +
+                ( j - ghost_local_space.min( Dim::J ) ) *
+                    ghost_local_space.extent( Dim::K ) +
+                ( k - ghost_local_space.min( Dim::K ) );
+            batch_lijk( n, Dim::I ) = i;
+            batch_lijk( n, Dim::J ) = j;
+            batch_lijk( n, Dim::K ) = k;
+        } );
+    IndexConversion::batchedL2G( TEST_EXECSPACE(), l2g_table, batch_lijk,
+                                 batch_gijk );
+
     // Compare the results.
     // FIXME Change back to fine grained EXPECT_EQ when passing on all distros
     int pass_index_conversion_test = 1;
@@ -113,15 +155,36 @@ void testConversion3d( const std::array<bool, 3>& is_dim_periodic )
         Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), index_view );
     auto l2g_view_host =
         Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), l2g_view );
+    auto table_view_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), table_view );
+    auto batch_gijk_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), batch_gijk );
     auto check_results = [&]( const IndexSpace<3>& space ) {
         for ( int i = space.min( Dim::I ); i < space.max( Dim::I ); ++i )
             for ( int j = space.min( Dim::J ); j < space.max( Dim::J ); ++j )
                 for ( int k = space.min( Dim::K ); k < space.max( Dim::K );
                       ++k )
+                {
+                    std::size_t n =
+                        ( i - ghost_local_space.min( Dim::I ) ) *
+                            ghost_local_space.extent( Dim::J ) *
+                            ghost_local_space.extent( Dim::K ) +
+                        ( j - ghost_local_space.min( Dim::J ) ) *
+                            ghost_local_space.extent( Dim::K ) +
+                        ( k - ghost_local_space.min( Dim::K ) );
                     for ( int d = 0; d < 3; ++d )
+                    {
                         if ( l2g_view_host( i, j, k, d ) !=
                              index_view_host( i, j, k, d ) )
                             pass_index_conversion_test = 0;
+                        if ( table_view_host( i, j, k, d ) !=
+                             index_view_host( i, j, k, d ) )
+                            pass_index_conversion_test = 0;
+                        if ( batch_gijk_host( n, d ) !=
+                             index_view_host( i, j, k, d ) )
+                            pass_index_conversion_test = 0;
+                    }
+                }
     };
     check_results( own_local_space );
     for ( int i = -1; i < 2; ++i )
@@ -203,6 +266,22 @@ void testConversion2d( const std::array<bool, 2>& is_dim_periodic )
             l2g_view( i, j, Dim::J ) = gj;
         } );
 
+    // Do the same loop with the cached table indexer.
+    auto global_table_array =
+        createArray<int, TEST_DEVICE>( "global_indices", array_layout );
+    auto table_view = global_table_array->view();
+    auto l2g_table = IndexConversion::createL2GTable<TEST_MEMSPACE>(
+        *local_grid, EntityType() );
+    Kokkos::parallel_for(
+        "fill_l2g_table",
+        createExecutionPolicy( ghost_local_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j ) {
+            int gi, gj;
+            l2g_table( i, j, gi, gj );
+            table_view( i, j, Dim::I ) = gi;
+            table_view( i, j, Dim::J ) = gj;
+        } );
+
     // Compare the results.
     // FIXME Change back to fine grained EXPECT_EQ when passing on all distros
     int pass_index_conversion_test = 1;
@@ -210,13 +289,20 @@ void testConversion2d( const std::array<bool, 2>& is_dim_periodic )
         Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), index_view );
     auto l2g_view_host =
         Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), l2g_view );
+    auto table_view_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), table_view );
     auto check_results = [&]( const IndexSpace<2>& space ) {
         for ( int i = space.min( Dim::I ); i < space.max( Dim::I ); ++i )
             for ( int j = space.min( Dim::J ); j < space.max( Dim::J ); ++j )
                 for ( int d = 0; d < 2; ++d )
+                {
                     if ( l2g_view_host( i, j, d ) !=
                          index_view_host( i, j, d ) )
                         pass_index_conversion_test = 0;
+                    if ( table_view_host( i, j, d ) !=
+                         index_view_host( i, j, d ) )
+                        pass_index_conversion_test = 0;
+                }
     };
     check_results( own_local_space );
     for ( int i = -1; i < 2; ++i )
@@ -11,6 +11,9 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_LinkedCellList.hpp>
+
 #include <Cajita_Array.hpp>
 #include <Cajita_GlobalGrid.hpp>
 #include <Cajita_GlobalMesh.hpp>
@@ -246,6 +249,389 @@ void interpolationTest()
     Kokkos::deep_copy( scalar_point_host, scalar_point_field );
     for ( int p = 0; p < num_point; ++p )
         EXPECT_FLOAT_EQ( scalar_point_host( p ) + 1.0, 1.0 );
+
+    // Runtime spline order
+    // --------------------
+
+    // The runtime-order overloads dispatch to the same instantiations.
+    Kokkos::deep_copy( scalar_point_field, 3.5 );
+    ArrayOp::assign( *scalar_grid_field, 0.0, Ghost() );
+    p2g( scalar_p2g, points, num_point, 1, *scalar_halo,
+         *scalar_grid_field );
+    Kokkos::deep_copy( scalar_grid_host, scalar_grid_field->view() );
+    for ( int i = node_space.min( Dim::I ); i < node_space.max( Dim::I ); ++i )
+        for ( int j = node_space.min( Dim::J ); j < node_space.max( Dim::J );
+              ++j )
+            for ( int k = node_space.min( Dim::K );
+                  k < node_space.max( Dim::K ); ++k )
+                EXPECT_FLOAT_EQ( scalar_grid_host( i, j, k, 0 ), -1.75 );
+
+    ArrayOp::assign( *scalar_grid_field, 3.5, Own() );
+    Kokkos::deep_copy( scalar_point_field, 0.0 );
+    g2p( *scalar_grid_field, *scalar_halo, points, num_point, 1,
+         scalar_value_g2p );
+    Kokkos::deep_copy( scalar_point_host, scalar_point_field );
+    for ( int p = 0; p < num_point; ++p )
+        EXPECT_FLOAT_EQ( scalar_point_host( p ), -1.75 );
+
+    // An order outside the instantiated set is an error.
+    EXPECT_THROW( p2g( scalar_p2g, points, num_point, 4, *scalar_halo,
+                       *scalar_grid_field ),
+                  std::runtime_error );
+    EXPECT_THROW( g2p( *scalar_grid_field, *scalar_halo, points, num_point,
+                       -1, scalar_value_g2p ),
+                  std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+void fusedInterpolationTest()
+{
+    // Create the global mesh.
+    std::array<double, 3> low_corner = { -1.2, 0.1, 1.1 };
+    std::array<double, 3> high_corner = { -0.3, 9.5, 2.3 };
+    double cell_size = 0.1;
+    auto global_mesh =
+        createUniformGlobalMesh( low_corner, high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a  grid local_grid.
+    int halo_width = 1;
+    auto local_grid = createLocalGrid( global_grid, halo_width );
+    auto local_mesh = createLocalMesh<TEST_DEVICE>( *local_grid );
+
+    // Create a point in the center of every cell.
+    auto cell_space = local_grid->indexSpace( Own(), Cell(), Local() );
+    int num_point = cell_space.size();
+    Kokkos::View<double* [3], TEST_DEVICE> points(
+        Kokkos::ViewAllocateWithoutInitializing( "points" ), num_point );
+    Kokkos::parallel_for(
+        "fill_points", createExecutionPolicy( cell_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            int pi = i - halo_width;
+            int pj = j - halo_width;
+            int pk = k - halo_width;
+            int pid = pi + cell_space.extent( Dim::I ) *
+                               ( pj + cell_space.extent( Dim::J ) * pk );
+            int idx[3] = { i, j, k };
+            double x[3];
+            local_mesh.coordinates( Cell(), idx, x );
+            points( pid, Dim::I ) = x[Dim::I];
+            points( pid, Dim::J ) = x[Dim::J];
+            points( pid, Dim::K ) = x[Dim::K];
+        } );
+
+    // Node space.
+    auto node_space = local_grid->indexSpace( Own(), Node(), Local() );
+
+    // Create a scalar and a vector field on the grid with a single halo over
+    // both so the fused interpolation communicates them together.
+    auto scalar_layout = createArrayLayout( local_grid, 1, Node() );
+    auto scalar_grid_field =
+        createArray<double, TEST_DEVICE>( "scalar_grid_field", scalar_layout );
+    auto scalar_grid_host =
+        Kokkos::create_mirror_view( scalar_grid_field->view() );
+    auto vector_layout = createArrayLayout( local_grid, 3, Node() );
+    auto vector_grid_field =
+        createArray<double, TEST_DEVICE>( "vector_grid_field", vector_layout );
+    auto vector_grid_host =
+        Kokkos::create_mirror_view( vector_grid_field->view() );
+    auto halo = createHalo( FullHaloPattern(), halo_width, *scalar_grid_field,
+                            *vector_grid_field );
+
+    // Create scalar and vector point fields.
+    Kokkos::View<double*, TEST_DEVICE> scalar_point_field(
+        Kokkos::ViewAllocateWithoutInitializing( "scalar_point_field" ),
+        num_point );
+    auto scalar_point_host = Kokkos::create_mirror_view( scalar_point_field );
+    Kokkos::View<double* [3], TEST_DEVICE> vector_point_field(
+        Kokkos::ViewAllocateWithoutInitializing( "vector_point_field" ),
+        num_point );
+    auto vector_point_host = Kokkos::create_mirror_view( vector_point_field );
+
+    // Interpolate both point values to the grid in one fused pass.
+    Kokkos::deep_copy( scalar_point_field, 3.5 );
+    Kokkos::deep_copy( vector_point_field, 3.5 );
+    ArrayOp::assign( *scalar_grid_field, 0.0, Ghost() );
+    ArrayOp::assign( *vector_grid_field, 0.0, Ghost() );
+    p2g( points, num_point, Spline<1>(), *halo,
+         createInterpolationField(
+             createScalarValueP2G( scalar_point_field, -0.5 ),
+             *scalar_grid_field ),
+         createInterpolationField(
+             createVectorValueP2G( vector_point_field, -0.5 ),
+             *vector_grid_field ) );
+    Kokkos::deep_copy( scalar_grid_host, scalar_grid_field->view() );
+    Kokkos::deep_copy( vector_grid_host, vector_grid_field->view() );
+    for ( int i = node_space.min( Dim::I ); i < node_space.max( Dim::I ); ++i )
+        for ( int j = node_space.min( Dim::J ); j < node_space.max( Dim::J );
+              ++j )
+            for ( int k = node_space.min( Dim::K );
+                  k < node_space.max( Dim::K ); ++k )
+            {
+                EXPECT_FLOAT_EQ( scalar_grid_host( i, j, k, 0 ), -1.75 );
+                for ( int d = 0; d < 3; ++d )
+                    EXPECT_FLOAT_EQ( vector_grid_host( i, j, k, d ), -1.75 );
+            }
+
+    // Interpolate both grid values to the points in one fused pass.
+    ArrayOp::assign( *scalar_grid_field, 3.5, Own() );
+    ArrayOp::assign( *vector_grid_field, 3.5, Own() );
+    Kokkos::deep_copy( scalar_point_field, 0.0 );
+    Kokkos::deep_copy( vector_point_field, 0.0 );
+    g2p( *halo, points, num_point, Spline<1>(),
+         createInterpolationField(
+             createScalarValueG2P( scalar_point_field, -0.5 ),
+             *scalar_grid_field ),
+         createInterpolationField(
+             createVectorValueG2P( vector_point_field, -0.5 ),
+             *vector_grid_field ) );
+    Kokkos::deep_copy( scalar_point_host, scalar_point_field );
+    Kokkos::deep_copy( vector_point_host, vector_point_field );
+    for ( int p = 0; p < num_point; ++p )
+    {
+        EXPECT_FLOAT_EQ( scalar_point_host( p ), -1.75 );
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_FLOAT_EQ( vector_point_host( p, d ), -1.75 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Point kernel of the fused pipeline test. Doubles the gathered point value
+// into the point field the scatter deposits.
+template <class GatherView, class ScatterView>
+struct PipelinePushFunctor
+{
+    GatherView _gathered;
+    ScatterView _pushed;
+
+    template <class SplineDataType>
+    KOKKOS_INLINE_FUNCTION void operator()( const SplineDataType&,
+                                            const int p ) const
+    {
+        _pushed( p ) = 2.0 * _gathered( p );
+    }
+};
+
+//---------------------------------------------------------------------------//
+void fusedPipelineTest()
+{
+    // Create the global mesh.
+    std::array<double, 3> low_corner = { -1.2, 0.1, 1.1 };
+    std::array<double, 3> high_corner = { -0.3, 9.5, 2.3 };
+    double cell_size = 0.1;
+    auto global_mesh =
+        createUniformGlobalMesh( low_corner, high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a  grid local_grid.
+    int halo_width = 1;
+    auto local_grid = createLocalGrid( global_grid, halo_width );
+    auto local_mesh = createLocalMesh<TEST_DEVICE>( *local_grid );
+
+    // Create a point in the center of every cell.
+    auto cell_space = local_grid->indexSpace( Own(), Cell(), Local() );
+    int num_point = cell_space.size();
+    Kokkos::View<double* [3], TEST_DEVICE> points(
+        Kokkos::ViewAllocateWithoutInitializing( "points" ), num_point );
+    Kokkos::parallel_for(
+        "fill_points", createExecutionPolicy( cell_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            int pi = i - halo_width;
+            int pj = j - halo_width;
+            int pk = k - halo_width;
+            int pid = pi + cell_space.extent( Dim::I ) *
+                               ( pj + cell_space.extent( Dim::J ) * pk );
+            int idx[3] = { i, j, k };
+            double x[3];
+            local_mesh.coordinates( Cell(), idx, x );
+            points( pid, Dim::I ) = x[Dim::I];
+            points( pid, Dim::J ) = x[Dim::J];
+            points( pid, Dim::K ) = x[Dim::K];
+        } );
+
+    // Node space.
+    auto node_space = local_grid->indexSpace( Own(), Node(), Local() );
+
+    // Create the gathered and deposited grid fields with their halos.
+    auto scalar_layout = createArrayLayout( local_grid, 1, Node() );
+    auto gather_grid_field =
+        createArray<double, TEST_DEVICE>( "gather_grid_field", scalar_layout );
+    auto gather_halo =
+        createHalo( FullHaloPattern(), halo_width, *gather_grid_field );
+    auto scatter_grid_field = createArray<double, TEST_DEVICE>(
+        "scatter_grid_field", scalar_layout );
+    auto scatter_grid_host =
+        Kokkos::create_mirror_view( scatter_grid_field->view() );
+    auto scatter_halo =
+        createHalo( FullHaloPattern(), halo_width, *scatter_grid_field );
+
+    // Create the point fields the pipeline stages through.
+    Kokkos::View<double*, TEST_DEVICE> gather_point_field(
+        Kokkos::ViewAllocateWithoutInitializing( "gather_point_field" ),
+        num_point );
+    Kokkos::View<double*, TEST_DEVICE> push_point_field(
+        Kokkos::ViewAllocateWithoutInitializing( "push_point_field" ),
+        num_point );
+
+    // Gather the grid value to the points, double it in the push, and
+    // deposit the result back to the grid in one launch.
+    ArrayOp::assign( *gather_grid_field, 3.5, Own() );
+    ArrayOp::assign( *scatter_grid_field, 0.0, Ghost() );
+    PipelinePushFunctor<decltype( gather_point_field ),
+                        decltype( push_point_field )>
+        push{ gather_point_field, push_point_field };
+    g2p_push_p2g( *gather_halo, *scatter_halo, points, num_point, Spline<1>(),
+                  createInterpolationFieldGroup( createInterpolationField(
+                      createScalarValueG2P( gather_point_field, 1.0 ),
+                      *gather_grid_field ) ),
+                  push,
+                  createInterpolationFieldGroup( createInterpolationField(
+                      createScalarValueP2G( push_point_field, -0.5 ),
+                      *scatter_grid_field ) ) );
+
+    // Each point gathered 3.5 and deposited -0.5 * 7.0 with total stencil
+    // weight 1 per node.
+    Kokkos::deep_copy( scatter_grid_host, scatter_grid_field->view() );
+    for ( int i = node_space.min( Dim::I ); i < node_space.max( Dim::I ); ++i )
+        for ( int j = node_space.min( Dim::J ); j < node_space.max( Dim::J );
+              ++j )
+            for ( int k = node_space.min( Dim::K );
+                  k < node_space.max( Dim::K ); ++k )
+                EXPECT_FLOAT_EQ( scatter_grid_host( i, j, k, 0 ), -3.5 );
+
+    // The intermediate point fields hold the staged values.
+    auto gather_point_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), gather_point_field );
+    auto push_point_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), push_point_field );
+    for ( int p = 0; p < num_point; ++p )
+    {
+        EXPECT_FLOAT_EQ( gather_point_host( p ), 3.5 );
+        EXPECT_FLOAT_EQ( push_point_host( p ), 7.0 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void coloredP2GTest()
+{
+    // Create the global mesh.
+    std::array<double, 3> low_corner = { -1.2, 0.1, 1.1 };
+    std::array<double, 3> high_corner = { -0.3, 9.5, 2.3 };
+    double cell_size = 0.1;
+    auto global_mesh =
+        createUniformGlobalMesh( low_corner, high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a  grid local_grid.
+    int halo_width = 1;
+    auto local_grid = createLocalGrid( global_grid, halo_width );
+    auto local_mesh = createLocalMesh<TEST_DEVICE>( *local_grid );
+
+    // Create a point in the center of every cell.
+    auto cell_space = local_grid->indexSpace( Own(), Cell(), Local() );
+    int num_point = cell_space.size();
+    Kokkos::View<double* [3], TEST_DEVICE> points(
+        Kokkos::ViewAllocateWithoutInitializing( "points" ), num_point );
+    Kokkos::parallel_for(
+        "fill_points", createExecutionPolicy( cell_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            int pi = i - halo_width;
+            int pj = j - halo_width;
+            int pk = k - halo_width;
+            int pid = pi + cell_space.extent( Dim::I ) *
+                               ( pj + cell_space.extent( Dim::J ) * pk );
+            int idx[3] = { i, j, k };
+            double x[3];
+            local_mesh.coordinates( Cell(), idx, x );
+            points( pid, Dim::I ) = x[Dim::I];
+            points( pid, Dim::J ) = x[Dim::J];
+            points( pid, Dim::K ) = x[Dim::K];
+        } );
+
+    // Bin the points by the owned cells of the grid.
+    auto host_mesh = createLocalMesh<Kokkos::HostSpace>( *local_grid );
+    double grid_delta[3] = { cell_size, cell_size, cell_size };
+    double grid_min[3];
+    double grid_max[3];
+    for ( int d = 0; d < 3; ++d )
+    {
+        grid_min[d] = host_mesh.lowCorner( Own(), d );
+        grid_max[d] = host_mesh.highCorner( Own(), d );
+    }
+    Cabana::AoSoA<Cabana::MemberTypes<double[3]>, TEST_DEVICE> point_aosoa(
+        "point_aosoa", num_point );
+    auto position = Cabana::slice<0>( point_aosoa );
+    Kokkos::parallel_for(
+        "fill_positions",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_point ),
+        KOKKOS_LAMBDA( const int p ) {
+            for ( int d = 0; d < 3; ++d )
+                position( p, d ) = points( p, d );
+        } );
+    Cabana::LinkedCellList<TEST_DEVICE> cell_list( position, grid_delta,
+                                                   grid_min, grid_max );
+
+    // Node space.
+    auto node_space = local_grid->indexSpace( Own(), Node(), Local() );
+
+    // Create a scalar field on the grid.
+    auto scalar_layout = createArrayLayout( local_grid, 1, Node() );
+    auto scalar_grid_field =
+        createArray<double, TEST_DEVICE>( "scalar_grid_field", scalar_layout );
+    auto scalar_halo = createHalo( *scalar_grid_field, FullHaloPattern() );
+    auto scalar_grid_host =
+        Kokkos::create_mirror_view( scalar_grid_field->view() );
+
+    // Create a scalar point field.
+    Kokkos::View<double*, TEST_DEVICE> scalar_point_field(
+        Kokkos::ViewAllocateWithoutInitializing( "scalar_point_field" ),
+        num_point );
+    Kokkos::deep_copy( scalar_point_field, 3.5 );
+
+    // Interpolate a scalar point value to the grid with the colored
+    // scatter.
+    ArrayOp::assign( *scalar_grid_field, 0.0, Ghost() );
+    auto scalar_p2g = createScalarValueP2G( scalar_point_field, -0.5 );
+    p2g( scalar_p2g, points, cell_list, Spline<1>(), *scalar_halo,
+         *scalar_grid_field );
+    Kokkos::deep_copy( scalar_grid_host, scalar_grid_field->view() );
+    for ( int i = node_space.min( Dim::I ); i < node_space.max( Dim::I ); ++i )
+        for ( int j = node_space.min( Dim::J ); j < node_space.max( Dim::J );
+              ++j )
+            for ( int k = node_space.min( Dim::K );
+                  k < node_space.max( Dim::K ); ++k )
+                EXPECT_FLOAT_EQ( scalar_grid_host( i, j, k, 0 ), -1.75 );
+
+    // Interpolate again with the same binning and check the result is
+    // bitwise reproducible.
+    ArrayOp::assign( *scalar_grid_field, 0.0, Ghost() );
+    p2g( scalar_p2g, points, cell_list, Spline<1>(), *scalar_halo,
+         *scalar_grid_field );
+    auto repeat_grid_host =
+        Kokkos::create_mirror( scalar_grid_field->view() );
+    Kokkos::deep_copy( repeat_grid_host, scalar_grid_field->view() );
+    for ( int i = node_space.min( Dim::I ); i < node_space.max( Dim::I ); ++i )
+        for ( int j = node_space.min( Dim::J ); j < node_space.max( Dim::J );
+              ++j )
+            for ( int k = node_space.min( Dim::K );
+                  k < node_space.max( Dim::K ); ++k )
+                EXPECT_EQ( repeat_grid_host( i, j, k, 0 ),
+                           scalar_grid_host( i, j, k, 0 ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -253,6 +639,12 @@ void interpolationTest()
 //---------------------------------------------------------------------------//
 TEST( interpolation, interpolation_test ) { interpolationTest(); }
 
+TEST( interpolation, fused_interpolation_test ) { fusedInterpolationTest(); }
+
+TEST( interpolation, fused_pipeline_test ) { fusedPipelineTest(); }
+
+TEST( interpolation, colored_p2g_test ) { coloredP2GTest(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
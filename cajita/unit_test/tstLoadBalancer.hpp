@@ -0,0 +1,229 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+
+#include <Cajita_Array.hpp>
+#include <Cajita_GlobalGrid.hpp>
+#include <Cajita_GlobalMesh.hpp>
+#include <Cajita_LoadBalancer.hpp>
+#include <Cajita_LocalGrid.hpp>
+#include <Cajita_LocalMesh.hpp>
+#include <Cajita_Partitioner.hpp>
+#include <Cajita_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+using namespace Cajita;
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Encode a global cell index and dof in a single value so redistributed
+// array data can be checked against the decomposition it lands in.
+double cellValue( const int gi, const int gj, const int gk, const int dof )
+{
+    return gi + 1e3 * gj + 1e6 * gk + 1e9 * dof;
+}
+
+//---------------------------------------------------------------------------//
+void testLoadBalancer()
+{
+    // Create the global grid. The cells must tile evenly for the balancer.
+    DimBlockPartitioner<3> partitioner;
+    double cell_size = 0.25;
+    std::array<int, 3> global_num_cell = { 32, 32, 32 };
+    std::array<double, 3> global_low_corner = { -1.1, 0.7, 2.3 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+    std::array<bool, 3> periodic = { false, false, false };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         periodic, partitioner );
+
+    // Create the balancer. It immediately installs a tile-aligned
+    // partition.
+    int halo_width = 1;
+    int num_particle_global = global_num_cell[0] * global_num_cell[1] *
+                              global_num_cell[2];
+    auto balancer = createLoadBalancer<TEST_DEVICE>(
+        global_grid, halo_width, 1.2f, num_particle_global );
+    auto local_grid = balancer->localGrid();
+
+    // The installed decomposition covers the global cells.
+    long owned_volume = 1;
+    for ( int d = 0; d < 3; ++d )
+        owned_volume *= global_grid->ownedNumCell( d );
+    long total_volume = 0;
+    MPI_Allreduce( &owned_volume, &total_volume, 1, MPI_LONG, MPI_SUM,
+                   MPI_COMM_WORLD );
+    EXPECT_EQ( total_volume, static_cast<long>( global_num_cell[0] ) *
+                                 global_num_cell[1] * global_num_cell[2] );
+
+    // Create one particle at the center of every owned cell, plus a
+    // workload hotspot: the block at the grid origin loads its first tile
+    // of cells with extra particles.
+    auto own_cell_space =
+        local_grid->indexSpace( Own(), Cell(), Local() );
+    bool origin_block = true;
+    for ( int d = 0; d < 3; ++d )
+        if ( global_grid->dimBlockId( d ) != 0 )
+            origin_block = false;
+    int num_extra_per_cell = 10;
+    int tile = static_cast<int>(
+        LoadBalancer<TEST_DEVICE, UniformMesh<double>>::partitioner_type::
+            cell_num_per_tile_dim );
+    int num_particle = own_cell_space.size();
+    if ( origin_block )
+        num_particle += num_extra_per_cell * tile * tile * tile;
+
+    using MemberTypes = Cabana::MemberTypes<double[3]>;
+    Cabana::AoSoA<MemberTypes, Kokkos::HostSpace> particles_host(
+        "particles", num_particle );
+    auto coords_host = Cabana::slice<0>( particles_host );
+    int pid = 0;
+    for ( int i = own_cell_space.min( Dim::I );
+          i < own_cell_space.max( Dim::I ); ++i )
+        for ( int j = own_cell_space.min( Dim::J );
+              j < own_cell_space.max( Dim::J ); ++j )
+            for ( int k = own_cell_space.min( Dim::K );
+                  k < own_cell_space.max( Dim::K ); ++k )
+            {
+                int gijk[3] = { i - own_cell_space.min( Dim::I ) +
+                                    global_grid->globalOffset( Dim::I ),
+                                j - own_cell_space.min( Dim::J ) +
+                                    global_grid->globalOffset( Dim::J ),
+                                k - own_cell_space.min( Dim::K ) +
+                                    global_grid->globalOffset( Dim::K ) };
+                int num_in_cell = 1;
+                if ( origin_block && gijk[0] < tile && gijk[1] < tile &&
+                     gijk[2] < tile )
+                    num_in_cell += num_extra_per_cell;
+                for ( int p = 0; p < num_in_cell; ++p )
+                {
+                    for ( int d = 0; d < 3; ++d )
+                        coords_host( pid, d ) = global_low_corner[d] +
+                                                ( gijk[d] + 0.5 ) *
+                                                    cell_size;
+                    ++pid;
+                }
+            }
+    EXPECT_EQ( pid, num_particle );
+    auto particles =
+        Cabana::create_mirror_view_and_copy( TEST_DEVICE(), particles_host );
+
+    // Create a cell array on the current decomposition holding its global
+    // cell index so the redistributed data can be checked.
+    int dofs = 2;
+    auto layout = createArrayLayout( local_grid, dofs, Cell() );
+    auto array = createArray<double, TEST_DEVICE>( "rebalance", layout );
+    auto array_host = Kokkos::create_mirror_view( array->view() );
+    for ( int i = own_cell_space.min( Dim::I );
+          i < own_cell_space.max( Dim::I ); ++i )
+        for ( int j = own_cell_space.min( Dim::J );
+              j < own_cell_space.max( Dim::J ); ++j )
+            for ( int k = own_cell_space.min( Dim::K );
+                  k < own_cell_space.max( Dim::K ); ++k )
+                for ( int n = 0; n < dofs; ++n )
+                    array_host( i, j, k, n ) = cellValue(
+                        i - own_cell_space.min( Dim::I ) +
+                            global_grid->globalOffset( Dim::I ),
+                        j - own_cell_space.min( Dim::J ) +
+                            global_grid->globalOffset( Dim::J ),
+                        k - own_cell_space.min( Dim::K ) +
+                            global_grid->globalOffset( Dim::K ),
+                        n );
+    Kokkos::deep_copy( array->view(), array_host );
+
+    // Rebalance from the particle positions.
+    auto coords = Cabana::slice<0>( particles );
+    auto new_local_grid = balancer->rebalance( coords, particles );
+
+    // The new decomposition still covers the global cells.
+    owned_volume = 1;
+    for ( int d = 0; d < 3; ++d )
+        owned_volume *= global_grid->ownedNumCell( d );
+    MPI_Allreduce( &owned_volume, &total_volume, 1, MPI_LONG, MPI_SUM,
+                   MPI_COMM_WORLD );
+    EXPECT_EQ( total_volume, static_cast<long>( global_num_cell[0] ) *
+                                 global_num_cell[1] * global_num_cell[2] );
+
+    // No particles were lost or duplicated by the migration.
+    long num_local = particles.size();
+    long num_global = 0;
+    MPI_Allreduce( &num_local, &num_global, 1, MPI_LONG, MPI_SUM,
+                   MPI_COMM_WORLD );
+    long num_expected_local = pid;
+    long num_expected = 0;
+    MPI_Allreduce( &num_expected_local, &num_expected, 1, MPI_LONG, MPI_SUM,
+                   MPI_COMM_WORLD );
+    EXPECT_EQ( num_global, num_expected );
+
+    // Every particle lies inside the new owned block.
+    auto migrated_host = Cabana::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), particles );
+    auto migrated_coords = Cabana::slice<0>( migrated_host );
+    auto local_mesh =
+        createLocalMesh<Kokkos::HostSpace>( *new_local_grid );
+    int num_outside = 0;
+    for ( std::size_t p = 0; p < migrated_host.size(); ++p )
+        for ( int d = 0; d < 3; ++d )
+            if ( migrated_coords( p, d ) < local_mesh.lowCorner( Own(), d ) ||
+                 migrated_coords( p, d ) >= local_mesh.highCorner( Own(), d ) )
+                ++num_outside;
+    EXPECT_EQ( num_outside, 0 );
+
+    // Redistribute the array and check every owned value against its
+    // global cell index under the new decomposition.
+    auto new_array = balancer->redistribute( *array );
+    auto new_array_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), new_array->view() );
+    auto new_own_space =
+        new_local_grid->indexSpace( Own(), Cell(), Local() );
+    int num_wrong = 0;
+    for ( int i = new_own_space.min( Dim::I );
+          i < new_own_space.max( Dim::I ); ++i )
+        for ( int j = new_own_space.min( Dim::J );
+              j < new_own_space.max( Dim::J ); ++j )
+            for ( int k = new_own_space.min( Dim::K );
+                  k < new_own_space.max( Dim::K ); ++k )
+                for ( int n = 0; n < dofs; ++n )
+                    if ( new_array_host( i, j, k, n ) !=
+                         cellValue(
+                             i - new_own_space.min( Dim::I ) +
+                                 global_grid->globalOffset( Dim::I ),
+                             j - new_own_space.min( Dim::J ) +
+                                 global_grid->globalOffset( Dim::J ),
+                             k - new_own_space.min( Dim::K ) +
+                                 global_grid->globalOffset( Dim::K ),
+                             n ) )
+                        ++num_wrong;
+    EXPECT_EQ( num_wrong, 0 );
+}
+
+//---------------------------------------------------------------------------//
+TEST( load_balancer, rebalance_test ) { testLoadBalancer(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
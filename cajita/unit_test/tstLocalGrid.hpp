@@ -21,6 +21,7 @@
 
 #include <array>
 #include <numeric>
+#include <stdexcept>
 
 using namespace Cajita;
 
@@ -3352,6 +3353,123 @@ void notPeriodicTest2d()
     MPI_Comm_free( &serial_comm );
 }
 
+//---------------------------------------------------------------------------//
+void cachedQueryTest3d()
+{
+    // Let MPI compute the partitioning for this test.
+    UniformDimPartitioner partitioner;
+
+    // Create the global mesh.
+    double cell_size = 0.23;
+    std::array<int, 3> global_num_cell = { 47, 38, 53 };
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+
+    // Create the global grid.
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a local grid.
+    int halo_width = 2;
+    auto local_grid = createLocalGrid( global_grid, halo_width );
+
+    // Repeated index space queries must return the memoized result.
+    auto first_space = local_grid->indexSpace( Ghost(), Node(), Local() );
+    auto second_space = local_grid->indexSpace( Ghost(), Node(), Local() );
+    for ( int d = 0; d < 3; ++d )
+    {
+        EXPECT_EQ( first_space.min( d ), second_space.min( d ) );
+        EXPECT_EQ( first_space.max( d ), second_space.max( d ) );
+    }
+
+    // Shared index spaces with different halo widths must be memoized
+    // separately. The default width query must match the explicit width.
+    auto narrow_space =
+        local_grid->sharedIndexSpace( Own(), Cell(), { -1, 0, 1 }, 1 );
+    auto full_space =
+        local_grid->sharedIndexSpace( Own(), Cell(), { -1, 0, 1 } );
+    auto explicit_full_space = local_grid->sharedIndexSpace(
+        Own(), Cell(), { -1, 0, 1 }, halo_width );
+    for ( int d = 0; d < 3; ++d )
+    {
+        EXPECT_EQ( full_space.min( d ), explicit_full_space.min( d ) );
+        EXPECT_EQ( full_space.max( d ), explicit_full_space.max( d ) );
+    }
+    EXPECT_LE( narrow_space.size(), full_space.size() );
+}
+
+//---------------------------------------------------------------------------//
+void dilatedIndexSpaceTest3d()
+{
+    // Let MPI compute the partitioning for this test.
+    UniformDimPartitioner partitioner;
+
+    // Create the global mesh.
+    double cell_size = 0.23;
+    std::array<int, 3> global_num_cell = { 47, 38, 53 };
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+
+    // Create the global grid.
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a local grid.
+    int halo_width = 2;
+    auto local_grid = createLocalGrid( global_grid, halo_width );
+
+    // The dilated space widens the owned space by the requested number of
+    // halo cells.
+    auto own_cell = local_grid->indexSpace( Own(), Cell(), Local() );
+    for ( int w = 0; w <= halo_width; ++w )
+    {
+        auto dilated = local_grid->indexSpace( Ghost(), Cell(), Local(), w );
+        for ( int d = 0; d < 3; ++d )
+        {
+            EXPECT_EQ( dilated.min( d ), own_cell.min( d ) - w );
+            EXPECT_EQ( dilated.max( d ), own_cell.max( d ) + w );
+        }
+    }
+
+    // The full-width dilated cell space is the ghosted cell space.
+    auto ghost_cell = local_grid->indexSpace( Ghost(), Cell(), Local() );
+    auto full_dilated =
+        local_grid->indexSpace( Ghost(), Cell(), Local(), halo_width );
+    for ( int d = 0; d < 3; ++d )
+    {
+        EXPECT_EQ( full_dilated.min( d ), ghost_cell.min( d ) );
+        EXPECT_EQ( full_dilated.max( d ), ghost_cell.max( d ) );
+    }
+
+    // Other entity types dilate their owned spaces the same way.
+    auto own_node = local_grid->indexSpace( Own(), Node(), Local() );
+    auto dilated_node = local_grid->indexSpace( Ghost(), Node(), Local(), 1 );
+    for ( int d = 0; d < 3; ++d )
+    {
+        EXPECT_EQ( dilated_node.min( d ), own_node.min( d ) - 1 );
+        EXPECT_EQ( dilated_node.max( d ), own_node.max( d ) + 1 );
+    }
+
+    // Widths outside the local grid halo are invalid.
+    EXPECT_THROW( local_grid->indexSpace( Ghost(), Cell(), Local(), -1 ),
+                  std::logic_error );
+    EXPECT_THROW(
+        local_grid->indexSpace( Ghost(), Cell(), Local(), halo_width + 1 ),
+        std::logic_error );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -3359,6 +3477,8 @@ TEST( local_grid, 3d_api_test )
 {
     periodicTest3d();
     notPeriodicTest3d();
+    cachedQueryTest3d();
+    dilatedIndexSpaceTest3d();
 }
 
 TEST( local_grid, 2d_api_test )
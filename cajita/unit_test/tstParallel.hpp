@@ -396,6 +396,180 @@ void parallelMultiSpaceTest()
                 }
 }
 
+//---------------------------------------------------------------------------//
+void parallelTiledTest()
+{
+    // Rank-3 index space with tile dimensions that do not evenly divide the
+    // extents so boundary tiles are clipped.
+    IndexSpace<3> is3( { 2, 3, 1 }, { 23, 22, 26 } );
+    Kokkos::View<double***, TEST_DEVICE> v3( "v3", 25, 25, 27 );
+    grid_parallel_for(
+        "fill_tiled_rank_3", TEST_EXECSPACE(), is3, createTileShape( 4, 8, 5 ),
+        KOKKOS_LAMBDA( const long i, const long j, const long k ) {
+            v3( i, j, k ) += 1.0;
+        } );
+    auto v3_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), v3 );
+    for ( int i = 0; i < 25; ++i )
+        for ( int j = 0; j < 25; ++j )
+            for ( int k = 0; k < 27; ++k )
+            {
+                long idx[3] = { i, j, k };
+                if ( is3.inRange( idx ) )
+                    EXPECT_EQ( v3_mirror( i, j, k ), 1.0 );
+                else
+                    EXPECT_EQ( v3_mirror( i, j, k ), 0.0 );
+            }
+
+    // Rank-2 index space.
+    IndexSpace<2> is2( { 1, 2 }, { 18, 21 } );
+    Kokkos::View<double**, TEST_DEVICE> v2( "v2", 20, 22 );
+    grid_parallel_for(
+        "fill_tiled_rank_2", TEST_EXECSPACE(), is2, createTileShape( 6, 7 ),
+        KOKKOS_LAMBDA( const long i, const long j ) { v2( i, j ) += 1.0; } );
+    auto v2_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), v2 );
+    for ( int i = 0; i < 20; ++i )
+        for ( int j = 0; j < 22; ++j )
+        {
+            long idx[2] = { i, j };
+            if ( is2.inRange( idx ) )
+                EXPECT_EQ( v2_mirror( i, j ), 1.0 );
+            else
+                EXPECT_EQ( v2_mirror( i, j ), 0.0 );
+        }
+}
+
+//---------------------------------------------------------------------------//
+void parallelCostWeightedTest()
+{
+    // Rank-3 index space with a per-cell cost view heavily skewed to one
+    // side of the space. Every cell must still be visited exactly once.
+    IndexSpace<3> is3( { 2, 3, 1 }, { 23, 22, 26 } );
+    Kokkos::View<double***, TEST_DEVICE> v3( "v3", 25, 25, 27 );
+    Kokkos::View<double***, TEST_DEVICE> cell_cost( "cell_cost", 25, 25, 27 );
+    grid_parallel_for(
+        "fill_cell_cost", TEST_EXECSPACE(), is3,
+        KOKKOS_LAMBDA( const long i, const long j, const long k ) {
+            cell_cost( i, j, k ) = ( i < 6 ) ? 50.0 : 1.0;
+        } );
+    grid_parallel_for(
+        "fill_cost_weighted_rank_3", TEST_EXECSPACE(), is3, cell_cost,
+        KOKKOS_LAMBDA( const long i, const long j, const long k ) {
+            v3( i, j, k ) += 1.0;
+        } );
+    auto v3_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), v3 );
+    for ( int i = 0; i < 25; ++i )
+        for ( int j = 0; j < 25; ++j )
+            for ( int k = 0; k < 27; ++k )
+            {
+                long idx[3] = { i, j, k };
+                if ( is3.inRange( idx ) )
+                    EXPECT_EQ( v3_mirror( i, j, k ), 1.0 );
+                else
+                    EXPECT_EQ( v3_mirror( i, j, k ), 0.0 );
+            }
+
+    // Same space with a per-row cost view. An all-zero cost view exercises
+    // the uniform fallback.
+    Kokkos::View<double**, TEST_DEVICE> row_cost( "row_cost", 25, 25 );
+    grid_parallel_for(
+        "fill_cost_weighted_rank_3_row", TEST_EXECSPACE(), is3, row_cost,
+        KOKKOS_LAMBDA( const long i, const long j, const long k ) {
+            v3( i, j, k ) += 1.0;
+        } );
+    Kokkos::deep_copy( v3_mirror, v3 );
+    for ( int i = 0; i < 25; ++i )
+        for ( int j = 0; j < 25; ++j )
+            for ( int k = 0; k < 27; ++k )
+            {
+                long idx[3] = { i, j, k };
+                if ( is3.inRange( idx ) )
+                    EXPECT_EQ( v3_mirror( i, j, k ), 2.0 );
+                else
+                    EXPECT_EQ( v3_mirror( i, j, k ), 0.0 );
+            }
+
+    // Rank-2 index space with a per-row cost view.
+    IndexSpace<2> is2( { 1, 2 }, { 18, 21 } );
+    Kokkos::View<double**, TEST_DEVICE> v2( "v2", 20, 22 );
+    Kokkos::View<double*, TEST_DEVICE> row_cost_2d( "row_cost_2d", 20 );
+    grid_parallel_for(
+        "fill_row_cost_2d", TEST_EXECSPACE(),
+        IndexSpace<1>( { 1 }, { 18 } ),
+        KOKKOS_LAMBDA( const long i ) {
+            row_cost_2d( i ) = ( i % 4 == 0 ) ? 100.0 : 1.0;
+        } );
+    grid_parallel_for(
+        "fill_cost_weighted_rank_2", TEST_EXECSPACE(), is2, row_cost_2d,
+        KOKKOS_LAMBDA( const long i, const long j ) { v2( i, j ) += 1.0; } );
+    auto v2_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), v2 );
+    for ( int i = 0; i < 20; ++i )
+        for ( int j = 0; j < 22; ++j )
+        {
+            long idx[2] = { i, j };
+            if ( is2.inRange( idx ) )
+                EXPECT_EQ( v2_mirror( i, j ), 1.0 );
+            else
+                EXPECT_EQ( v2_mirror( i, j ), 0.0 );
+        }
+}
+
+//---------------------------------------------------------------------------//
+void parallelFusedTest()
+{
+    // Rank-3 index space with a shared input field and one output per
+    // fused functor. One traversal must produce all outputs.
+    IndexSpace<3> is3( { 2, 3, 1 }, { 23, 22, 26 } );
+    Kokkos::View<double***, TEST_DEVICE> input( "input", 25, 25, 27 );
+    Kokkos::View<double***, TEST_DEVICE> shifted( "shifted", 25, 25, 27 );
+    Kokkos::View<double***, TEST_DEVICE> doubled( "doubled", 25, 25, 27 );
+    Kokkos::View<double***, TEST_DEVICE> squared( "squared", 25, 25, 27 );
+    grid_parallel_for(
+        "fill_fused_input", TEST_EXECSPACE(), is3,
+        KOKKOS_LAMBDA( const long i, const long j, const long k ) {
+            input( i, j, k ) = i + j + k;
+        } );
+    grid_fused_parallel_for(
+        "fused_rank_3", TEST_EXECSPACE(), is3,
+        KOKKOS_LAMBDA( const long i, const long j, const long k ) {
+            shifted( i, j, k ) = input( i, j, k ) + 1.0;
+        },
+        KOKKOS_LAMBDA( const long i, const long j, const long k ) {
+            doubled( i, j, k ) = 2.0 * input( i, j, k );
+        },
+        KOKKOS_LAMBDA( const long i, const long j, const long k ) {
+            squared( i, j, k ) = input( i, j, k ) * input( i, j, k );
+        } );
+    auto shifted_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), shifted );
+    auto doubled_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), doubled );
+    auto squared_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), squared );
+    for ( int i = 0; i < 25; ++i )
+        for ( int j = 0; j < 25; ++j )
+            for ( int k = 0; k < 27; ++k )
+            {
+                long idx[3] = { i, j, k };
+                if ( is3.inRange( idx ) )
+                {
+                    double x = i + j + k;
+                    EXPECT_EQ( shifted_mirror( i, j, k ), x + 1.0 );
+                    EXPECT_EQ( doubled_mirror( i, j, k ), 2.0 * x );
+                    EXPECT_EQ( squared_mirror( i, j, k ), x * x );
+                }
+                else
+                {
+                    EXPECT_EQ( shifted_mirror( i, j, k ), 0.0 );
+                    EXPECT_EQ( doubled_mirror( i, j, k ), 0.0 );
+                    EXPECT_EQ( squared_mirror( i, j, k ), 0.0 );
+                }
+            }
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -405,6 +579,15 @@ TEST( TEST_CATEGORY, parallel_local_grid_test ) { parallelLocalGridTest(); }
 
 TEST( TEST_CATEGORY, parallel_multispace_test ) { parallelMultiSpaceTest(); }
 
+TEST( TEST_CATEGORY, parallel_tiled_test ) { parallelTiledTest(); }
+
+TEST( TEST_CATEGORY, parallel_fused_test ) { parallelFusedTest(); }
+
+TEST( TEST_CATEGORY, parallel_cost_weighted_test )
+{
+    parallelCostWeightedTest();
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
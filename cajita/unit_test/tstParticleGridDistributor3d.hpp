@@ -134,6 +134,18 @@ void migrateTest( const GridType global_grid, const double cell_size,
         particles = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
                                                          particles_dst );
     }
+    // Do the migration with the fast path that only communicates the
+    // rank-crossing particles and rebuilds the AoSoA in place.
+    else if ( test_type == 2 )
+    {
+        Cajita::particleGridFastMigrate( *block, coords_mirror,
+                                         particles_mirror, test_halo_size,
+                                         force_comm );
+
+        // Copy back to check.
+        particles = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                         particles_mirror );
+    }
 
     coords = Cabana::slice<0>( particles, "coords" );
     linear_ids = Cabana::slice<1>( particles, "linear_ids" );
@@ -306,6 +318,11 @@ void testParticleGridMigrate( const bool periodic )
     // Retest with separate destination AoSoA.
     migrateTest( global_grid, cell_size, 2, 2, true, 1 );
 
+    // Retest with the fast in-place path.
+    for ( int j = 0; j < 3; j++ )
+        migrateTest( global_grid, cell_size, 2, j, false, 2 );
+    migrateTest( global_grid, cell_size, 2, 2, true, 2 );
+
     // Test with forced communication.
     migrateTest( global_grid, cell_size, 2, 2, true, 0 );
 
@@ -0,0 +1,478 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cajita_Array.hpp>
+#include <Cajita_GlobalGrid.hpp>
+#include <Cajita_GlobalMesh.hpp>
+#include <Cajita_LocalMesh.hpp>
+#include <Cajita_Partitioner.hpp>
+#include <Cajita_ReferenceStructuredSolver.hpp>
+#include <Cajita_ScratchArena.hpp>
+#include <Cajita_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using namespace Cajita;
+
+namespace Test
+{
+
+//---------------------------------------------------------------------------//
+void matrixFreeTest()
+{
+    // Create the global grid. The problem is periodic so the same stencil
+    // coefficients apply at every grid point and the matrix-free
+    // constant-coefficient operator is exact.
+    double cell_size = 0.25;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { -1.0, -2.0, -1.0 };
+    std::array<double, 3> global_high_corner = { 1.0, 1.0, 0.5 };
+    auto global_mesh = createUniformGlobalMesh( global_low_corner,
+                                                global_high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a local grid.
+    auto local_mesh = createLocalGrid( global_grid, 1 );
+    auto owned_space = local_mesh->indexSpace( Own(), Cell(), Local() );
+
+    // Create the RHS.
+    auto vector_layout = createArrayLayout( local_mesh, 1, Cell() );
+    auto rhs = createArray<double, TEST_DEVICE>( "rhs", vector_layout );
+    ArrayOp::assign( *rhs, 1.0, Own() );
+
+    // A shifted 7-point 3d laplacian stencil. The diagonal shift keeps the
+    // periodic operator nonsingular.
+    std::vector<std::array<int, 3>> stencil = {
+        { 0, 0, 0 }, { -1, 0, 0 }, { 1, 0, 0 }, { 0, -1, 0 },
+        { 0, 1, 0 }, { 0, 0, -1 }, { 0, 0, 1 } };
+
+    // Solve with the array-based matrix representation.
+    auto lhs_ref = createArray<double, TEST_DEVICE>( "lhs_ref", vector_layout );
+    ArrayOp::assign( *lhs_ref, 0.0, Own() );
+
+    auto ref_solver =
+        createReferenceConjugateGradient<double, TEST_DEVICE>( *vector_layout );
+    ref_solver->setMatrixStencil( stencil );
+    const auto& ref_entries = ref_solver->getMatrixValues();
+    auto matrix_view = ref_entries.view();
+    Kokkos::parallel_for(
+        "fill_ref_entries",
+        createExecutionPolicy( owned_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            matrix_view( i, j, k, 0 ) = 7.0;
+            for ( int c = 1; c < 7; ++c )
+                matrix_view( i, j, k, c ) = -1.0;
+        } );
+
+    std::vector<std::array<int, 3>> diag_stencil = { { 0, 0, 0 } };
+    ref_solver->setPreconditionerStencil( diag_stencil );
+    const auto& preconditioner_entries = ref_solver->getPreconditionerValues();
+    auto preconditioner_view = preconditioner_entries.view();
+    Kokkos::parallel_for(
+        "fill_preconditioner_entries",
+        createExecutionPolicy( owned_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            preconditioner_view( i, j, k, 0 ) = 1.0 / 7.0;
+        } );
+
+    ref_solver->setTolerance( 1.0e-11 );
+    ref_solver->setPrintLevel( 1 );
+    ref_solver->setup();
+    ref_solver->solve( *rhs, *lhs_ref );
+
+    // Solve the same problem with matrix-free constant-coefficient
+    // operators. No matrix or preconditioner arrays are allocated on this
+    // path.
+    auto lhs_mf = createArray<double, TEST_DEVICE>( "lhs_mf", vector_layout );
+    ArrayOp::assign( *lhs_mf, 0.0, Own() );
+
+    std::array<std::array<int, 3>, 7> op_stencil = {
+        { { 0, 0, 0 },
+          { -1, 0, 0 },
+          { 1, 0, 0 },
+          { 0, -1, 0 },
+          { 0, 1, 0 },
+          { 0, 0, -1 },
+          { 0, 0, 1 } } };
+    std::array<double, 7> op_coefficients = { 7.0,  -1.0, -1.0, -1.0,
+                                              -1.0, -1.0, -1.0 };
+    auto A_op = createConstantStencilOperator( op_stencil, op_coefficients );
+
+    std::array<std::array<int, 3>, 1> diag_op_stencil = { { { 0, 0, 0 } } };
+    std::array<double, 1> diag_op_coefficients = { 1.0 / 7.0 };
+    auto M_op =
+        createConstantStencilOperator( diag_op_stencil, diag_op_coefficients );
+
+    auto mf_solver =
+        createReferenceConjugateGradient<double, TEST_DEVICE>( *vector_layout );
+    mf_solver->setMatrixOperator( A_op );
+    mf_solver->setPreconditionerOperator( M_op );
+    mf_solver->setTolerance( 1.0e-11 );
+    mf_solver->setPrintLevel( 1 );
+    mf_solver->setup();
+    mf_solver->solve( *rhs, *lhs_mf, A_op, M_op );
+
+    // The matrix-free path applies the same operator so the solutions
+    // should match.
+    EXPECT_EQ( ref_solver->getNumIter(), mf_solver->getNumIter() );
+    auto lhs_ref_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), lhs_ref->view() );
+    auto lhs_mf_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), lhs_mf->view() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+                EXPECT_FLOAT_EQ( lhs_ref_host( i, j, k, 0 ),
+                                 lhs_mf_host( i, j, k, 0 ) );
+
+    // Solve again with the pipelined iteration. Pipelining changes only
+    // the communication schedule, not the arithmetic, so the result and
+    // iteration count are identical.
+    ArrayOp::assign( *lhs_mf, 0.0, Own() );
+    mf_solver->setPipelined( true );
+    mf_solver->solve( *rhs, *lhs_mf, A_op, M_op );
+
+    EXPECT_EQ( ref_solver->getNumIter(), mf_solver->getNumIter() );
+    lhs_mf_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                       lhs_mf->view() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+                EXPECT_FLOAT_EQ( lhs_ref_host( i, j, k, 0 ),
+                                 lhs_mf_host( i, j, k, 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Solve a periodic shifted Poisson problem with geometric multigrid and
+// return the number of V-cycles. The RHS is a discrete eigenfunction of the
+// operator so the exact discrete solution is known in closed form.
+int multigridSolve( const int num_cell_per_dim )
+{
+    // Create the global grid. The domain is the periodic unit cube.
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { 0.0, 0.0, 0.0 };
+    std::array<double, 3> global_high_corner = { 1.0, 1.0, 1.0 };
+    std::array<int, 3> global_num_cell = { num_cell_per_dim, num_cell_per_dim,
+                                           num_cell_per_dim };
+    auto global_mesh = createUniformGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+
+    DimBlockPartitioner<3> partitioner;
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+    auto local_grid = createLocalGrid( global_grid, 1 );
+    auto owned_space = local_grid->indexSpace( Own(), Cell(), Local() );
+    auto local_mesh = createLocalMesh<TEST_DEVICE>( *local_grid );
+
+    // Shifted 7-point Laplacian rediscretized on each level. The shift
+    // keeps the periodic operator nonsingular.
+    const double sigma = 1.0;
+    std::array<std::array<int, 3>, 7> op_stencil = {
+        { { 0, 0, 0 },
+          { -1, 0, 0 },
+          { 1, 0, 0 },
+          { 0, -1, 0 },
+          { 0, 1, 0 },
+          { 0, 0, -1 },
+          { 0, 0, 1 } } };
+    auto make_op = [&]( const double h ) {
+        std::array<double, 7> coefficients = {
+            sigma + 6.0 / ( h * h ), -1.0 / ( h * h ), -1.0 / ( h * h ),
+            -1.0 / ( h * h ),        -1.0 / ( h * h ), -1.0 / ( h * h ),
+            -1.0 / ( h * h ) };
+        return createConstantStencilOperator( op_stencil, coefficients );
+    };
+    const double h = 1.0 / num_cell_per_dim;
+    std::vector<decltype( make_op( h ) )> level_ops = {
+        make_op( h ), make_op( 2.0 * h ), make_op( 4.0 * h ) };
+
+    // The RHS is an eigenfunction of the discrete operator so the exact
+    // discrete solution is the RHS scaled by the inverse eigenvalue.
+    auto vector_layout = createArrayLayout( local_grid, 1, Cell() );
+    auto rhs = createArray<double, TEST_DEVICE>( "rhs", vector_layout );
+    auto lhs = createArray<double, TEST_DEVICE>( "lhs", vector_layout );
+    ArrayOp::assign( *lhs, 0.0, Own() );
+    auto rhs_view = rhs->view();
+    const double pi = 4.0 * atan( 1.0 );
+    Kokkos::parallel_for(
+        "fill_rhs", createExecutionPolicy( owned_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            int idx[3] = { i, j, k };
+            double x[3];
+            local_mesh.coordinates( Cell(), idx, x );
+            rhs_view( i, j, k, 0 ) = cos( 2.0 * pi * x[0] ) *
+                                     cos( 2.0 * pi * x[1] ) *
+                                     cos( 2.0 * pi * x[2] );
+        } );
+    const double eigenvalue =
+        sigma + 3.0 * ( 2.0 - 2.0 * cos( 2.0 * pi * h ) ) / ( h * h );
+
+    // Solve with V-cycles.
+    auto multigrid = createReferenceGeometricMultigrid<double, TEST_DEVICE>(
+        *vector_layout, level_ops );
+    multigrid->setTolerance( 1.0e-10 );
+    multigrid->setMaxIter( 50 );
+    multigrid->setPrintLevel( 1 );
+    multigrid->solve( *rhs, *lhs );
+
+    EXPECT_LE( multigrid->getFinalRelativeResidualNorm(), 1.0e-10 );
+
+    // Check the solution against the exact discrete solution.
+    auto lhs_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                         lhs->view() );
+    auto rhs_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                         rhs->view() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+                EXPECT_NEAR( lhs_host( i, j, k, 0 ),
+                             rhs_host( i, j, k, 0 ) / eigenvalue, 1.0e-8 );
+
+    return multigrid->getNumIter();
+}
+
+//---------------------------------------------------------------------------//
+void multigridTest()
+{
+    // Solve the same problem on two resolutions. The V-cycle contracts all
+    // error frequencies so the iteration count should not grow with the
+    // mesh resolution. The cell counts stay divisible through three levels
+    // for every block decomposition the test harness uses.
+    int coarse_iters = multigridSolve( 48 );
+    int fine_iters = multigridSolve( 96 );
+    EXPECT_LE( fine_iters, coarse_iters + 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Fill the matrix and preconditioner of a solver with the shifted 7-point
+// laplacian through the standard interface.
+template <class SolverType, class IndexSpaceType>
+void fillShiftedLaplacian( SolverType& solver,
+                           const IndexSpaceType& owned_space )
+{
+    std::vector<std::array<int, 3>> stencil = {
+        { 0, 0, 0 }, { -1, 0, 0 }, { 1, 0, 0 }, { 0, -1, 0 },
+        { 0, 1, 0 }, { 0, 0, -1 }, { 0, 0, 1 } };
+    solver.setMatrixStencil( stencil );
+    auto matrix_view = solver.getMatrixValues().view();
+    Kokkos::parallel_for(
+        "fill_matrix_entries",
+        createExecutionPolicy( owned_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            matrix_view( i, j, k, 0 ) = 7.0;
+            for ( int c = 1; c < 7; ++c )
+                matrix_view( i, j, k, c ) = -1.0;
+        } );
+
+    std::vector<std::array<int, 3>> diag_stencil = { { 0, 0, 0 } };
+    solver.setPreconditionerStencil( diag_stencil );
+    auto preconditioner_view = solver.getPreconditionerValues().view();
+    Kokkos::parallel_for(
+        "fill_preconditioner_entries",
+        createExecutionPolicy( owned_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            preconditioner_view( i, j, k, 0 ) = 1.0 / 7.0;
+        } );
+}
+
+//---------------------------------------------------------------------------//
+void mixedPrecisionTest()
+{
+    // Create the global grid. The problem is periodic.
+    double cell_size = 0.25;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { -1.0, -2.0, -1.0 };
+    std::array<double, 3> global_high_corner = { 1.0, 1.0, 0.5 };
+    auto global_mesh = createUniformGlobalMesh( global_low_corner,
+                                                global_high_corner, cell_size );
+    DimBlockPartitioner<3> partitioner;
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+    auto local_mesh = createLocalGrid( global_grid, 1 );
+    auto owned_space = local_mesh->indexSpace( Own(), Cell(), Local() );
+
+    // Create the RHS.
+    auto vector_layout = createArrayLayout( local_mesh, 1, Cell() );
+    auto rhs = createArray<double, TEST_DEVICE>( "rhs", vector_layout );
+    ArrayOp::assign( *rhs, 1.0, Own() );
+
+    // Solve in full double precision as a reference.
+    auto lhs_ref = createArray<double, TEST_DEVICE>( "lhs_ref", vector_layout );
+    ArrayOp::assign( *lhs_ref, 0.0, Own() );
+    auto ref_solver =
+        createReferenceConjugateGradient<double, TEST_DEVICE>( *vector_layout );
+    fillShiftedLaplacian( *ref_solver, owned_space );
+    ref_solver->setTolerance( 1.0e-11 );
+    ref_solver->setup();
+    ref_solver->solve( *rhs, *lhs_ref );
+
+    // Solve with mixed-precision iterative refinement. The inner iteration
+    // runs in float but the refinement loop must still reach the full
+    // double-precision tolerance.
+    auto lhs_ir = createArray<double, TEST_DEVICE>( "lhs_ir", vector_layout );
+    ArrayOp::assign( *lhs_ir, 0.0, Own() );
+    auto ir_solver = createReferenceIterativeRefinement<double, TEST_DEVICE>(
+        *vector_layout );
+    fillShiftedLaplacian( *ir_solver, owned_space );
+    ir_solver->setTolerance( 1.0e-11 );
+    ir_solver->setPrintLevel( 1 );
+    ir_solver->setup();
+    ir_solver->solve( *rhs, *lhs_ir );
+
+    EXPECT_LE( ir_solver->getFinalRelativeResidualNorm(), 1.0e-11 );
+
+    // The refined solution matches the double-precision solution to the
+    // outer tolerance even though the inner sweeps ran in float.
+    auto lhs_ref_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), lhs_ref->view() );
+    auto lhs_ir_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                            lhs_ir->view() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+                EXPECT_NEAR( lhs_ref_host( i, j, k, 0 ),
+                             lhs_ir_host( i, j, k, 0 ), 1.0e-9 );
+}
+
+//---------------------------------------------------------------------------//
+void scratchArenaTest()
+{
+    // Create the global grid. The problem is periodic.
+    double cell_size = 0.25;
+    std::array<bool, 3> is_dim_periodic = { true, true, true };
+    std::array<double, 3> global_low_corner = { -1.0, -2.0, -1.0 };
+    std::array<double, 3> global_high_corner = { 1.0, 1.0, 0.5 };
+    auto global_mesh = createUniformGlobalMesh( global_low_corner,
+                                                global_high_corner, cell_size );
+    DimBlockPartitioner<3> partitioner;
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+    auto local_mesh = createLocalGrid( global_grid, 1 );
+    auto owned_space = local_mesh->indexSpace( Own(), Cell(), Local() );
+
+    // Check the arena recycles an array with a matching type and layout.
+    auto arena = createScratchArena();
+    auto vector_layout = createArrayLayout( local_mesh, 1, Cell() );
+    auto scratch =
+        arena->checkout<double, TEST_DEVICE>( "scratch", vector_layout );
+    auto scratch_data = scratch->view().data();
+    arena->release( scratch );
+    scratch.reset();
+    EXPECT_EQ( arena->numFree(), 1 );
+    auto recycled =
+        arena->checkout<double, TEST_DEVICE>( "recycled", vector_layout );
+    EXPECT_EQ( recycled->view().data(), scratch_data );
+    EXPECT_EQ( arena->numFree(), 0 );
+    arena->release( recycled );
+    recycled.reset();
+    arena->clear();
+
+    // Create the RHS.
+    auto rhs = createArray<double, TEST_DEVICE>( "rhs", vector_layout );
+    ArrayOp::assign( *rhs, 1.0, Own() );
+
+    // Solve with a solver holding its own work vectors as a reference.
+    auto lhs_ref = createArray<double, TEST_DEVICE>( "lhs_ref", vector_layout );
+    ArrayOp::assign( *lhs_ref, 0.0, Own() );
+    auto ref_solver =
+        createReferenceConjugateGradient<double, TEST_DEVICE>( *vector_layout );
+    fillShiftedLaplacian( *ref_solver, owned_space );
+    ref_solver->setTolerance( 1.0e-11 );
+    ref_solver->setup();
+    ref_solver->solve( *rhs, *lhs_ref );
+
+    // Solve the same problem with two solvers sharing one arena. The work
+    // vectors are checked out per solve so both solvers reuse a single
+    // allocation instead of each holding its own.
+    auto solver_a =
+        createReferenceConjugateGradient<double, TEST_DEVICE>( *vector_layout );
+    fillShiftedLaplacian( *solver_a, owned_space );
+    solver_a->setTolerance( 1.0e-11 );
+    solver_a->setScratchArena( arena );
+    solver_a->setup();
+
+    auto solver_b =
+        createReferenceConjugateGradient<double, TEST_DEVICE>( *vector_layout );
+    fillShiftedLaplacian( *solver_b, owned_space );
+    solver_b->setTolerance( 1.0e-11 );
+    solver_b->setScratchArena( arena );
+    solver_b->setup();
+
+    auto lhs_a = createArray<double, TEST_DEVICE>( "lhs_a", vector_layout );
+    ArrayOp::assign( *lhs_a, 0.0, Own() );
+    solver_a->solve( *rhs, *lhs_a );
+
+    auto lhs_b = createArray<double, TEST_DEVICE>( "lhs_b", vector_layout );
+    ArrayOp::assign( *lhs_b, 0.0, Own() );
+    solver_b->solve( *rhs, *lhs_b );
+
+    // One set of work vectors was allocated and both solvers released it
+    // back to the pool.
+    EXPECT_EQ( arena->numFree(), 1 );
+
+    // Both arena-backed solutions match the reference.
+    EXPECT_EQ( ref_solver->getNumIter(), solver_a->getNumIter() );
+    EXPECT_EQ( ref_solver->getNumIter(), solver_b->getNumIter() );
+    auto lhs_ref_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), lhs_ref->view() );
+    auto lhs_a_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           lhs_a->view() );
+    auto lhs_b_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           lhs_b->view() );
+    for ( int i = owned_space.min( Dim::I ); i < owned_space.max( Dim::I );
+          ++i )
+        for ( int j = owned_space.min( Dim::J ); j < owned_space.max( Dim::J );
+              ++j )
+            for ( int k = owned_space.min( Dim::K );
+                  k < owned_space.max( Dim::K ); ++k )
+            {
+                EXPECT_FLOAT_EQ( lhs_ref_host( i, j, k, 0 ),
+                                 lhs_a_host( i, j, k, 0 ) );
+                EXPECT_FLOAT_EQ( lhs_ref_host( i, j, k, 0 ),
+                                 lhs_b_host( i, j, k, 0 ) );
+            }
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, matrix_free_pcg_test ) { matrixFreeTest(); }
+
+TEST( TEST_CATEGORY, mixed_precision_test ) { mixedPrecisionTest(); }
+
+TEST( TEST_CATEGORY, multigrid_test ) { multigridTest(); }
+
+TEST( TEST_CATEGORY, scratch_arena_test ) { scratchArenaTest(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
@@ -454,6 +454,114 @@ void random_distribution_automatic_rank( int occupy_num_per_rank,
     EXPECT_FLOAT_EQ( imbalance_factor, 1.0f );
 }
 
+/*!
+  \brief In this test, every tile is registered (uniform workload) but the
+  partition is initialized with skewed boundaries; the incremental
+  optimization must move every boundary at most max_boundary_shift tiles
+  and must reject the trial partition when the migration cost coefficient
+  outweighs the imbalance gain
+*/
+void incremental_rebalance_test()
+{
+    // define the domain size
+    constexpr int size_tile_per_dim = 16;
+    constexpr int cell_per_tile_dim = 4;
+    constexpr int size_per_dim = size_tile_per_dim * cell_per_tile_dim;
+    constexpr int total_size = size_per_dim * size_per_dim * size_per_dim;
+
+    // some settings for partitioner
+    float max_workload_coeff = 1.5;
+    int workload_num = total_size;
+    int num_step_rebalance = 100;
+    int max_optimize_iteration = 10;
+    std::array<int, 3> global_cells_per_dim = { size_per_dim, size_per_dim,
+                                                size_per_dim };
+
+    // partitioner
+    SparseDimPartitioner<TEST_DEVICE, cell_per_tile_dim> partitioner(
+        MPI_COMM_WORLD, max_workload_coeff, workload_num, num_step_rebalance,
+        global_cells_per_dim, max_optimize_iteration );
+    auto ranks_per_dim =
+        partitioner.ranksPerDimension( MPI_COMM_WORLD, global_cells_per_dim );
+
+    // initialize a skewed partition: every interior boundary is shifted two
+    // tiles off the average position
+    const int skew = 2;
+    std::array<std::vector<int>, 3> skew_partitions;
+    bool has_interior_boundary = false;
+    for ( int d = 0; d < 3; ++d )
+    {
+        int ele = size_tile_per_dim / ranks_per_dim[d];
+        for ( int id = 0; id < ranks_per_dim[d] + 1; ++id )
+        {
+            int part = id * ele;
+            if ( id > 0 && id < ranks_per_dim[d] )
+            {
+                part += skew;
+                part = part > size_tile_per_dim ? size_tile_per_dim : part;
+                has_interior_boundary = true;
+            }
+            if ( id == ranks_per_dim[d] )
+                part = size_tile_per_dim;
+            skew_partitions[d].push_back( part );
+        }
+    }
+    partitioner.initializeRecPartition(
+        skew_partitions[0], skew_partitions[1], skew_partitions[2] );
+
+    // initialize sparseMap, register every tile on every MPI rank
+    double cell_size = 0.1;
+    int pre_alloc_size = size_per_dim * size_per_dim;
+    std::array<double, 3> global_low_corner = { 1.2, 3.3, -2.8 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_cells_per_dim[0],
+        global_low_corner[1] + cell_size * global_cells_per_dim[1],
+        global_low_corner[2] + cell_size * global_cells_per_dim[2] };
+    auto global_mesh = createSparseGlobalMesh(
+        global_low_corner, global_high_corner, global_cells_per_dim );
+    auto sis = createSparseMap<TEST_EXECSPACE>( global_mesh, pre_alloc_size );
+    Kokkos::parallel_for(
+        "insert_cell_to_sparse_map",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, size_per_dim ),
+        KOKKOS_LAMBDA( int i ) {
+            for ( int j = 0; j < size_per_dim; j++ )
+                for ( int k = 0; k < size_per_dim; k++ )
+                {
+                    sis.insertCell( i, j, k );
+                }
+        } );
+
+    // incremental optimization with zero migration cost: the skewed
+    // boundaries move toward the average position, so the trial partition
+    // should be accepted whenever there is an interior boundary to move
+    const int max_boundary_shift = 1;
+    bool accepted = partitioner.optimizePartitionIncremental(
+        sis, MPI_COMM_WORLD, max_boundary_shift, 0.0f );
+    EXPECT_EQ( accepted, has_interior_boundary );
+
+    // every boundary moved at most max_boundary_shift tiles
+    auto part = partitioner.getCurrentPartition();
+    for ( int d = 0; d < 3; ++d )
+        for ( int id = 0; id < ranks_per_dim[d] + 1; id++ )
+        {
+            int shift = part[d][id] - skew_partitions[d][id];
+            shift = shift < 0 ? -shift : shift;
+            EXPECT_LE( shift, max_boundary_shift );
+        }
+
+    // with a prohibitive migration cost coefficient the trial partition
+    // must be rejected and the partition left unchanged
+    partitioner.initializeRecPartition(
+        skew_partitions[0], skew_partitions[1], skew_partitions[2] );
+    accepted = partitioner.optimizePartitionIncremental(
+        sis, MPI_COMM_WORLD, max_boundary_shift, 1.0e6f );
+    EXPECT_EQ( accepted, false );
+    part = partitioner.getCurrentPartition();
+    for ( int d = 0; d < 3; ++d )
+        for ( int id = 0; id < ranks_per_dim[d] + 1; id++ )
+            EXPECT_EQ( part[d][id], skew_partitions[d][id] );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -469,5 +577,9 @@ TEST( sparse_dim_partitioner, sparse_dim_partitioner_random_par_test )
 {
     random_distribution_automatic_rank( 50, false );
 }
+TEST( sparse_dim_partitioner, sparse_dim_partitioner_incremental_test )
+{
+    incremental_rebalance_test();
+}
 //---------------------------------------------------------------------------//
 } // end namespace Test
\ No newline at end of file
@@ -0,0 +1,262 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cajita_GlobalMesh.hpp>
+#include <Cajita_SparseHalo.hpp>
+#include <Cajita_SparseIndexSpace.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <array>
+
+using namespace Cajita;
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+void sparseHaloGatherTest()
+{
+    // Build a 3d Cartesian decomposition of the communicator.
+    int comm_size;
+    MPI_Comm_size( MPI_COMM_WORLD, &comm_size );
+    std::array<int, 3> ranks_per_dim = { 0, 0, 0 };
+    MPI_Dims_create( comm_size, 3, ranks_per_dim.data() );
+    std::array<int, 3> periods = { 0, 0, 0 };
+    MPI_Comm cart_comm;
+    MPI_Cart_create( MPI_COMM_WORLD, 3, ranks_per_dim.data(), periods.data(),
+                     0, &cart_comm );
+    std::array<int, 3> cart_rank;
+    int linear_rank;
+    MPI_Comm_rank( cart_comm, &linear_rank );
+    MPI_Cart_coords( cart_comm, linear_rank, 3, cart_rank.data() );
+
+    // Each rank owns a block of tiles of a sparse global mesh.
+    constexpr int cell_per_tile_dim = 4;
+    constexpr int cell_per_tile =
+        cell_per_tile_dim * cell_per_tile_dim * cell_per_tile_dim;
+    const int tile_per_rank_dim = 4;
+    const int halo_tile_width = 1;
+    std::array<int, 3> global_num_tile = {
+        ranks_per_dim[0] * tile_per_rank_dim,
+        ranks_per_dim[1] * tile_per_rank_dim,
+        ranks_per_dim[2] * tile_per_rank_dim };
+    std::array<int, 3> own_tile_min;
+    std::array<int, 3> own_tile_max;
+    for ( int d = 0; d < 3; ++d )
+    {
+        own_tile_min[d] = cart_rank[d] * tile_per_rank_dim;
+        own_tile_max[d] = own_tile_min[d] + tile_per_rank_dim;
+    }
+
+    // Create the sparse map over the global mesh.
+    double cell_size = 0.1;
+    std::array<int, 3> global_num_cell = {
+        global_num_tile[0] * cell_per_tile_dim,
+        global_num_tile[1] * cell_per_tile_dim,
+        global_num_tile[2] * cell_per_tile_dim };
+    std::array<double, 3> global_low_corner = { 0.0, 0.0, 0.0 };
+    std::array<double, 3> global_high_corner = {
+        global_low_corner[0] + cell_size * global_num_cell[0],
+        global_low_corner[1] + cell_size * global_num_cell[1],
+        global_low_corner[2] + cell_size * global_num_cell[2] };
+    auto global_mesh = createSparseGlobalMesh(
+        global_low_corner, global_high_corner, global_num_cell );
+    int pre_alloc_size =
+        global_num_tile[0] * global_num_tile[1] * global_num_tile[2];
+    auto map = createSparseMap<TEST_EXECSPACE>( global_mesh, pre_alloc_size );
+    using map_type = decltype( map );
+
+    // Occupy every other tile of the owned block so the exchange regions
+    // are only partially occupied.
+    Kokkos::Array<int, 3> tmin = { own_tile_min[0], own_tile_min[1],
+                                   own_tile_min[2] };
+    Kokkos::Array<int, 3> tmax = { own_tile_max[0], own_tile_max[1],
+                                   own_tile_max[2] };
+    Kokkos::parallel_for(
+        "insert_tiles",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( tmin[0], tmax[0] ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int j = tmin[1]; j < tmax[1]; ++j )
+                for ( int k = tmin[2]; k < tmax[2]; ++k )
+                    if ( 0 == ( i + j + k ) % 2 )
+                        map.insertTile( i, j, k );
+        } );
+    Kokkos::fence();
+    auto num_own_tile = map.size();
+
+    // Allocate the tile data with room for the ghost tiles the gather will
+    // register in the map. Assign each occupied tile a payload that is a
+    // function of its global tile index so received ghost data can be
+    // checked independently of the sending rank.
+    Kokkos::View<double**, TEST_DEVICE> tile_data(
+        "tile_data", pre_alloc_size, cell_per_tile );
+    Kokkos::parallel_for(
+        "fill_tiles",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, map.capacity() ),
+        KOKKOS_LAMBDA( const int t ) {
+            if ( map.valid_at( t ) )
+            {
+                auto key = map.key_at( t );
+                int ti, tj, tk;
+                map.key2ijk( key, ti, tj, tk );
+                auto tid =
+                    map.queryTile( ti << map_type::cell_bits_per_tile_dim,
+                                   tj << map_type::cell_bits_per_tile_dim,
+                                   tk << map_type::cell_bits_per_tile_dim );
+                for ( int c = 0; c < cell_per_tile; ++c )
+                    tile_data( tid, c ) =
+                        ti + 100.0 * tj + 10000.0 * tk + 0.5 * c;
+            }
+        } );
+    Kokkos::fence();
+
+    // Gather the occupied tiles of our neighbors.
+    auto halo = Experimental::createSparseHalo<TEST_EXECSPACE, map_type>(
+        cart_comm, own_tile_min, own_tile_max, halo_tile_width );
+    halo->gather( TEST_EXECSPACE(), map, tile_data );
+
+    // The map should now also hold the occupied ghost tiles. Count the
+    // expected ghosts on the host: occupied tiles of the neighbor blocks
+    // within the halo width of our boundary.
+    int num_ghost_tile = 0;
+    for ( int i = own_tile_min[0] - halo_tile_width;
+          i < own_tile_max[0] + halo_tile_width; ++i )
+        for ( int j = own_tile_min[1] - halo_tile_width;
+              j < own_tile_max[1] + halo_tile_width; ++j )
+            for ( int k = own_tile_min[2] - halo_tile_width;
+                  k < own_tile_max[2] + halo_tile_width; ++k )
+            {
+                if ( i < 0 || i >= global_num_tile[0] || j < 0 ||
+                     j >= global_num_tile[1] || k < 0 ||
+                     k >= global_num_tile[2] )
+                    continue;
+                bool own = own_tile_min[0] <= i && i < own_tile_max[0] &&
+                           own_tile_min[1] <= j && j < own_tile_max[1] &&
+                           own_tile_min[2] <= k && k < own_tile_max[2];
+                if ( !own && 0 == ( i + j + k ) % 2 )
+                    ++num_ghost_tile;
+            }
+    EXPECT_EQ( map.size(), num_own_tile + num_ghost_tile );
+
+    // Check the ghost tile payloads against the global-index function.
+    Kokkos::View<int, TEST_DEVICE> error_count( "error_count" );
+    Kokkos::parallel_for(
+        "check_ghosts",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, map.capacity() ),
+        KOKKOS_LAMBDA( const int t ) {
+            if ( map.valid_at( t ) )
+            {
+                auto key = map.key_at( t );
+                int ti, tj, tk;
+                map.key2ijk( key, ti, tj, tk );
+                auto tid =
+                    map.queryTile( ti << map_type::cell_bits_per_tile_dim,
+                                   tj << map_type::cell_bits_per_tile_dim,
+                                   tk << map_type::cell_bits_per_tile_dim );
+                for ( int c = 0; c < cell_per_tile; ++c )
+                {
+                    double expected =
+                        ti + 100.0 * tj + 10000.0 * tk + 0.5 * c;
+                    if ( tile_data( tid, c ) != expected )
+                        Kokkos::atomic_add( &error_count(), 1 );
+                }
+            }
+        } );
+    Kokkos::fence();
+    auto error_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), error_count );
+    EXPECT_EQ( error_host(), 0 );
+
+    // Scatter the ghost data back. Each rank that ghosts one of our owned
+    // boundary tiles sends its (gathered) copy back, so the tile should
+    // accumulate one copy of its payload per ghosting neighbor.
+    halo->scatter( TEST_EXECSPACE(), map, tile_data );
+    Kokkos::Array<int, 3> rpd = { ranks_per_dim[0], ranks_per_dim[1],
+                                  ranks_per_dim[2] };
+    Kokkos::Array<int, 3> crank = { cart_rank[0], cart_rank[1],
+                                    cart_rank[2] };
+    Kokkos::View<int, TEST_DEVICE> scatter_errors( "scatter_errors" );
+    Kokkos::parallel_for(
+        "check_scatter",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, map.capacity() ),
+        KOKKOS_LAMBDA( const int t ) {
+            if ( map.valid_at( t ) )
+            {
+                auto key = map.key_at( t );
+                int ti, tj, tk;
+                map.key2ijk( key, ti, tj, tk );
+                if ( tmin[0] <= ti && ti < tmax[0] && tmin[1] <= tj &&
+                     tj < tmax[1] && tmin[2] <= tk && tk < tmax[2] )
+                {
+                    // Count the neighbor ranks that ghost this tile.
+                    int tile_ijk[3] = { ti, tj, tk };
+                    int num_ghosting = 0;
+                    for ( int oi = -1; oi < 2; ++oi )
+                        for ( int oj = -1; oj < 2; ++oj )
+                            for ( int ok = -1; ok < 2; ++ok )
+                            {
+                                if ( 0 == oi && 0 == oj && 0 == ok )
+                                    continue;
+                                int off[3] = { oi, oj, ok };
+                                bool ghosted = true;
+                                for ( int d = 0; d < 3; ++d )
+                                {
+                                    int nc = crank[d] + off[d];
+                                    if ( nc < 0 || nc >= rpd[d] )
+                                        ghosted = false;
+                                    if ( -1 == off[d] &&
+                                         !( tile_ijk[d] <
+                                            tmin[d] + halo_tile_width ) )
+                                        ghosted = false;
+                                    if ( 1 == off[d] &&
+                                         !( tile_ijk[d] >=
+                                            tmax[d] - halo_tile_width ) )
+                                        ghosted = false;
+                                }
+                                if ( ghosted )
+                                    ++num_ghosting;
+                            }
+
+                    auto tid = map.queryTile(
+                        ti << map_type::cell_bits_per_tile_dim,
+                        tj << map_type::cell_bits_per_tile_dim,
+                        tk << map_type::cell_bits_per_tile_dim );
+                    for ( int c = 0; c < cell_per_tile; ++c )
+                    {
+                        double expected =
+                            ( 1.0 + num_ghosting ) *
+                            ( ti + 100.0 * tj + 10000.0 * tk + 0.5 * c );
+                        if ( tile_data( tid, c ) != expected )
+                            Kokkos::atomic_add( &scatter_errors(), 1 );
+                    }
+                }
+            }
+        } );
+    Kokkos::fence();
+    auto scatter_error_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), scatter_errors );
+    EXPECT_EQ( scatter_error_host(), 0 );
+
+    MPI_Comm_free( &cart_comm );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( sparse_halo, gather_test ) { sparseHaloGatherTest(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
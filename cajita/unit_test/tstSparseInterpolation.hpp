@@ -0,0 +1,189 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cajita_GlobalGrid.hpp>
+#include <Cajita_GlobalMesh.hpp>
+#include <Cajita_Interpolation.hpp>
+#include <Cajita_LocalGrid.hpp>
+#include <Cajita_LocalMesh.hpp>
+#include <Cajita_SparseIndexSpace.hpp>
+#include <Cajita_SparseInterpolation.hpp>
+#include <Cajita_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <array>
+
+using namespace Cajita;
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Interpolate a linear nodal field from sparse tile storage to points and
+// check the result is exact. Exercised with the flat and the tile-staged
+// kernel.
+void sparseInterpolationTest( const bool staged )
+{
+    // Create the global mesh. 16 cells per dimension - a multiple of the
+    // 4x4x4 sparse tile size.
+    std::array<double, 3> low_corner = { 0.0, 0.0, 0.0 };
+    std::array<double, 3> high_corner = { 1.6, 1.6, 1.6 };
+    double cell_size = 0.1;
+    auto global_mesh =
+        createUniformGlobalMesh( low_corner, high_corner, cell_size );
+
+    // Create the global grid.
+    DimBlockPartitioner<3> partitioner;
+    std::array<bool, 3> is_dim_periodic = { false, false, false };
+    auto global_grid = createGlobalGrid( MPI_COMM_WORLD, global_mesh,
+                                         is_dim_periodic, partitioner );
+
+    // Create a local grid and mesh.
+    int halo_width = 1;
+    auto local_grid = createLocalGrid( global_grid, halo_width );
+    auto local_mesh = createLocalMesh<TEST_DEVICE>( *local_grid );
+
+    // Create a sparse map over the global cell space.
+    constexpr int cell_per_tile_dim = 4;
+    constexpr int cell_per_tile =
+        cell_per_tile_dim * cell_per_tile_dim * cell_per_tile_dim;
+    using map_type = SparseMap<TEST_MEMSPACE>;
+    std::array<int, 3> global_num_cell = {
+        global_grid->globalNumEntity( Cell(), Dim::I ),
+        global_grid->globalNumEntity( Cell(), Dim::J ),
+        global_grid->globalNumEntity( Cell(), Dim::K ) };
+    int pre_alloc_size = 256;
+    map_type map( global_num_cell, pre_alloc_size );
+
+    // Register the tiles covering the owned cells plus one cell of overlap -
+    // the stencil footprint - clamped to the global domain.
+    std::array<int, 3> reg_min;
+    std::array<int, 3> reg_max;
+    for ( int d = 0; d < 3; ++d )
+    {
+        reg_min[d] = global_grid->globalOffset( d ) - 1;
+        if ( reg_min[d] < 0 )
+            reg_min[d] = 0;
+        reg_max[d] = global_grid->globalOffset( d ) +
+                     global_grid->ownedNumCell( d ) + 1;
+        if ( reg_max[d] > global_num_cell[d] )
+            reg_max[d] = global_num_cell[d];
+    }
+    Kokkos::parallel_for(
+        "register_tiles",
+        Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<3>>(
+            { reg_min[0], reg_min[1], reg_min[2] },
+            { reg_max[0], reg_max[1], reg_max[2] } ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            map.insertCell( i, j, k );
+        } );
+
+    // Fill the tile storage with a linear nodal field f = 2x + 3y + 4z + 1.
+    // Linear fields are reproduced exactly by linear spline interpolation.
+    Kokkos::View<double**, TEST_DEVICE> tile_data( "tile_data",
+                                                   pre_alloc_size,
+                                                   cell_per_tile );
+    Kokkos::parallel_for(
+        "fill_tiles",
+        Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<3>>(
+            { reg_min[0], reg_min[1], reg_min[2] },
+            { reg_max[0], reg_max[1], reg_max[2] } ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            auto cell = map.queryCell( i, j, k );
+            auto tid = cell >> map_type::cell_bits_per_tile;
+            auto cid = cell & ( map_type::cell_num_per_tile - 1 );
+            double x = i * 0.1;
+            double y = j * 0.1;
+            double z = k * 0.1;
+            tile_data( tid, cid ) = 2.0 * x + 3.0 * y + 4.0 * z + 1.0;
+        } );
+
+    // Create the entity-indexed sparse view. The ghosted local frame index 0
+    // sits at the global offset minus the halo width.
+    std::array<int, 3> index_offset;
+    for ( int d = 0; d < 3; ++d )
+        index_offset[d] = global_grid->globalOffset( d ) - halo_width;
+    auto sparse_view = Experimental::createSparseArrayView(
+        tile_data, map, 1, index_offset );
+
+    // Create a point in the center of every owned cell that is at least one
+    // cell from the global boundary so all stencils touch registered tiles.
+    auto cell_space = local_grid->indexSpace( Own(), Cell(), Local() );
+    Kokkos::View<double* [3], TEST_DEVICE> points(
+        Kokkos::ViewAllocateWithoutInitializing( "points" ),
+        cell_space.size() );
+    Kokkos::View<int, TEST_DEVICE> point_count( "point_count" );
+    auto index_offset_i = index_offset[0];
+    auto index_offset_j = index_offset[1];
+    auto index_offset_k = index_offset[2];
+    auto gnc = global_num_cell;
+    Kokkos::parallel_for(
+        "fill_points", createExecutionPolicy( cell_space, TEST_EXECSPACE() ),
+        KOKKOS_LAMBDA( const int i, const int j, const int k ) {
+            int gi = i + index_offset_i;
+            int gj = j + index_offset_j;
+            int gk = k + index_offset_k;
+            if ( gi < 1 || gi >= gnc[0] - 1 || gj < 1 || gj >= gnc[1] - 1 ||
+                 gk < 1 || gk >= gnc[2] - 1 )
+                return;
+            int pid = Kokkos::atomic_fetch_add( &point_count(), 1 );
+            int idx[3] = { i, j, k };
+            double x[3];
+            local_mesh.coordinates( Cell(), idx, x );
+            points( pid, Dim::I ) = x[Dim::I];
+            points( pid, Dim::J ) = x[Dim::J];
+            points( pid, Dim::K ) = x[Dim::K];
+        } );
+    auto count_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                             point_count );
+    int num_point = count_host();
+
+    // Interpolate the sparse nodal field to the points.
+    Kokkos::View<double*, TEST_DEVICE> point_field( "point_field",
+                                                    cell_space.size() );
+    if ( staged )
+        Experimental::sparse_g2p_staged(
+            local_mesh, sparse_view, points, num_point, Spline<1>(), Node(),
+            createScalarValueG2P( point_field, 1.0 ) );
+    else
+        Experimental::sparse_g2p(
+            local_mesh, sparse_view, points, num_point, Spline<1>(), Node(),
+            createScalarValueG2P( point_field, 1.0 ) );
+
+    // Check the interpolation is exact for the linear field.
+    auto field_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           point_field );
+    auto points_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), points );
+    for ( int p = 0; p < num_point; ++p )
+    {
+        double expected = 2.0 * points_host( p, Dim::I ) +
+                          3.0 * points_host( p, Dim::J ) +
+                          4.0 * points_host( p, Dim::K ) + 1.0;
+        EXPECT_FLOAT_EQ( field_host( p ), expected );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( sparse_interpolation, flat_test ) { sparseInterpolationTest( false ); }
+
+TEST( sparse_interpolation, staged_test ) { sparseInterpolationTest( true ); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
@@ -26,13 +26,21 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 
 namespace Cabana
 {
+//---------------------------------------------------------------------------//
+//! Tag requesting first-touch initialization of AoSoA allocations.
+struct FirstTouch
+{
+};
+
 //---------------------------------------------------------------------------//
 // AoSoA forward declaration.
 template <class DataTypes, class DeviceType, int VectorLength,
@@ -60,6 +68,27 @@ struct is_aosoa : public is_aosoa_impl<typename std::remove_cv<T>::type>::type
 {
 };
 
+namespace Impl
+{
+//! \cond Impl
+// Zero-initialize a struct allocation with a parallel kernel in the
+// execution space. On NUMA hosts the first write to a page binds it to the
+// domain of the writing thread, so touching the structs with the same
+// static partitioning later parallel loops use places each page next to
+// its consumers.
+template <class ExecutionSpace, class SoAView>
+void firstTouchView( const SoAView& view )
+{
+    using soa_type = typename SoAView::value_type;
+    Kokkos::parallel_for(
+        "Cabana::AoSoA::firstTouch",
+        Kokkos::RangePolicy<ExecutionSpace>( 0, view.extent( 0 ) ),
+        KOKKOS_LAMBDA( const int s ) { view( s ) = soa_type(); } );
+    Kokkos::fence();
+}
+//! \endcond
+} // end namespace Impl
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Create a slice from an AoSoA.
@@ -84,6 +113,47 @@ slice( const AoSoA_t& aosoa, const std::string& slice_label = "" )
         slice_label );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create an unmanaged AoSoA over a contiguous tuple range of an AoSoA.
+
+  \tparam AoSoA_t AoSoA type.
+
+  \param aosoa The AoSoA to create a subview of.
+
+  \param begin The first tuple index in the range. Must be a multiple of the
+  AoSoA vector length so the range starts on a struct boundary.
+
+  \param end One past the last tuple index in the range.
+
+  \return A non-owning AoSoA aliasing the tuples in [begin,end). The subview
+  shares the data of the input so it may be sliced and used in parallel
+  kernels without copying, with all indexing local to the range. It is
+  invalidated if the input AoSoA reallocates.
+*/
+template <class AoSoA_t>
+AoSoA<typename AoSoA_t::member_types, typename AoSoA_t::device_type,
+      AoSoA_t::vector_length, Kokkos::MemoryUnmanaged>
+subview( const AoSoA_t& aosoa, const std::size_t begin, const std::size_t end )
+{
+    static_assert( is_aosoa<AoSoA_t>::value, "subview() requires an AoSoA" );
+
+    if ( 0 != begin % AoSoA_t::vector_length )
+        throw std::invalid_argument(
+            "Subview begin must be a multiple of the vector length" );
+    if ( begin > end || end > aosoa.size() )
+        throw std::invalid_argument( "Subview range is not valid" );
+
+    std::size_t size = end - begin;
+    std::size_t num_soa = size / AoSoA_t::vector_length;
+    if ( 0 < size % AoSoA_t::vector_length )
+        ++num_soa;
+    return AoSoA<typename AoSoA_t::member_types,
+                 typename AoSoA_t::device_type, AoSoA_t::vector_length,
+                 Kokkos::MemoryUnmanaged>(
+        aosoa.data() + begin / AoSoA_t::vector_length, num_soa, size );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Array-of-Struct-of-Arrays
@@ -110,6 +180,17 @@ slice( const AoSoA_t& aosoa, const std::string& slice_label = "" )
 
   \tparam MemoryTraits (optional) Memory traits for the AoSoA data. Can be
   used to indicate managed memory, unmanaged memory, etc.
+
+  Memory placement: by default allocations are not initialized, so on NUMA
+  hosts the physical pages bind to whichever thread happens to write them
+  first - often a single thread in a serial setup loop, leaving parallel
+  kernels reading remote memory. Constructing with the FirstTouch tag (or
+  calling setFirstTouch() before the first resize) touches every allocation
+  with a parallel kernel in the container execution space so pages bind to
+  the domains of the threads that will process them. Binding to a memory
+  kind (e.g. high-bandwidth memory on mixed HBM/DDR nodes) is selected
+  through the device type template parameter; hot and cold fields may be
+  split across containers in different memory spaces.
  */
 template <class DataTypes, class DeviceType,
           int VectorLength = Impl::PerformanceTraits<
@@ -169,6 +250,10 @@ class AoSoA
     //! Tuple type.
     using tuple_type = Tuple<member_types>;
 
+    //! Default capacity growth factor used when resizing beyond the current
+    //! capacity.
+    static constexpr double default_growth_factor = 1.5;
+
     //! Member data type at a given index M. Note this is the user-defined
     //! member data type - not the potentially transformed type actually stored
     //! by the structs (SoAs) to achieve a given layout.
@@ -185,10 +270,16 @@ class AoSoA
     using member_pointer_type =
         typename std::add_pointer<member_value_type<M>>::type;
 
+    //! Member data type at a given index M as stored by the structs,
+    //! including any storage layout wrapper.
+    template <std::size_t M>
+    using member_stored_type =
+        typename MemberTypeAtIndex<M, member_types>::stored_type;
+
     //! Member slice type at a given member index M.
     template <std::size_t M>
     using member_slice_type =
-        Slice<member_data_type<M>, device_type, DefaultAccessMemory,
+        Slice<member_stored_type<M>, device_type, DefaultAccessMemory,
               vector_length,
               sizeof( soa_type ) / sizeof( member_value_type<M> )>;
 
@@ -204,6 +295,8 @@ class AoSoA
         : _size( 0 )
         , _capacity( 0 )
         , _num_soa( 0 )
+        , _growth_factor( default_growth_factor )
+        , _first_touch( false )
         , _data( Kokkos::ViewAllocateWithoutInitializing( label ), 0 )
     {
         static_assert(
@@ -222,6 +315,35 @@ class AoSoA
         : _size( n )
         , _capacity( 0 )
         , _num_soa( 0 )
+        , _growth_factor( default_growth_factor )
+        , _first_touch( false )
+        , _data( Kokkos::ViewAllocateWithoutInitializing( label ), 0 )
+    {
+        static_assert(
+            !memory_traits::is_unmanaged,
+            "Construction by allocation cannot use unmanaged memory" );
+        resize( _size );
+    }
+
+    /*!
+      \brief Allocate a container with n tuples with first-touch
+      initialization.
+
+      \param label A label for the data structure.
+
+      \param n The number of tuples in the container.
+
+      The allocation is zero-initialized by a parallel kernel in the
+      container execution space before use so that on NUMA hosts pages bind
+      to the domains of the threads that will process them. All later
+      reallocations of the container are touched the same way.
+    */
+    AoSoA( FirstTouch, const std::string label, const size_type n )
+        : _size( n )
+        , _capacity( 0 )
+        , _num_soa( 0 )
+        , _growth_factor( default_growth_factor )
+        , _first_touch( true )
         , _data( Kokkos::ViewAllocateWithoutInitializing( label ), 0 )
     {
         static_assert(
@@ -243,6 +365,8 @@ class AoSoA
         : _size( n )
         , _capacity( num_soa * vector_length )
         , _num_soa( num_soa )
+        , _growth_factor( default_growth_factor )
+        , _first_touch( false )
         , _data( ptr, num_soa )
     {
         static_assert( memory_traits::is_unmanaged,
@@ -302,6 +426,20 @@ class AoSoA
     KOKKOS_FUNCTION
     size_type capacity() const { return _capacity; }
 
+    /*!
+      \brief Get the number of bytes of memory allocated by the container.
+
+      \return The number of allocated bytes.
+
+      This measures the allocated storage, which covers the full capacity of
+      the container rather than just its current size.
+    */
+    std::size_t memoryUsage() const
+    {
+        return _data.span() * sizeof( soa_type ) +
+               ( _device_size.data() ? sizeof( size_type ) : 0 );
+    }
+
     /*!
       \brief Resizes the container so that it contains n tuples.
 
@@ -318,14 +456,24 @@ class AoSoA
       inserting or erasing tuples from it. If reallocation occurs, all slices
       and all references to the elements are invalidated. If no reallocation
       takes place, no slices or references are invalidated.
+
+      When the requested size exceeds the current capacity the new capacity
+      is at least the old capacity multiplied by the growth factor so that
+      repeated resizing in a loop is amortized constant time. Capacity is
+      never reduced by this function - call shrinkToFit() to release unused
+      storage.
     */
     void resize( const size_type n )
     {
         static_assert( !memory_traits::is_unmanaged,
                        "Cannot resize unmanaged memory" );
 
-        // Reserve memory if needed.
-        reserve( n );
+        // Reserve memory if needed. Grow the capacity geometrically when the
+        // current allocation is exhausted to amortize reallocation copies
+        // over many resize calls.
+        if ( n > _capacity )
+            reserve( std::max(
+                n, static_cast<size_type>( _capacity * _growth_factor ) ) );
 
         // Update the sizes of the data. This is potentially different than
         // the amount of allocated data.
@@ -376,10 +524,14 @@ class AoSoA
         _capacity = num_soa_alloc * vector_length;
 
         // We need more SoA objects so allocate a new view and copy the
-        // existing data.
+        // existing data. Touch the new allocation in the execution space
+        // before the copy so pages bind to the domains of the threads that
+        // will process them rather than to whichever thread copies first.
         soa_view resized_data(
             Kokkos::ViewAllocateWithoutInitializing( _data.label() ),
             num_soa_alloc );
+        if ( _first_touch )
+            Impl::firstTouchView<execution_space>( resized_data );
         if ( _num_soa > 0 )
             Kokkos::deep_copy(
                 Kokkos::subview(
@@ -418,6 +570,8 @@ class AoSoA
         soa_view resized_data(
             Kokkos::ViewAllocateWithoutInitializing( _data.label() ),
             _num_soa );
+        if ( _first_touch )
+            Impl::firstTouchView<execution_space>( resized_data );
         if ( _num_soa > 0 )
             Kokkos::deep_copy(
                 resized_data,
@@ -426,6 +580,93 @@ class AoSoA
         _data = resized_data;
     }
 
+    /*!
+      \brief Get a device-resident counter holding the container size.
+
+      \return A rank-0 view in the container memory space holding the size.
+
+      The counter is allocated on first use and refreshed with the current
+      host size on every call. Kernels may consume and update the counter
+      (e.g. a stream compaction writing the surviving count) without a host
+      round-trip; call syncSizeFromDevice() afterwards to commit the device
+      value as the container size.
+    */
+    Kokkos::View<size_type, memory_space> deviceSize()
+    {
+        static_assert( !memory_traits::is_unmanaged,
+                       "Cannot track the size of unmanaged memory" );
+
+        if ( nullptr == _device_size.data() )
+            _device_size = Kokkos::View<size_type, memory_space>(
+                Kokkos::ViewAllocateWithoutInitializing(
+                    std::string( label() ).append( "_device_size" ) ) );
+        Kokkos::deep_copy( _device_size, _size );
+        return _device_size;
+    }
+
+    /*!
+      \brief Resize the container to the value of the device size counter.
+
+      Copies the counter obtained from deviceSize() back to the host and
+      resizes the container to it. This is the only point in the
+      device-counter workflow that blocks on a device-to-host transfer, so
+      it can be deferred past other host work to hide the latency.
+    */
+    void syncSizeFromDevice()
+    {
+        if ( nullptr == _device_size.data() )
+            return;
+        size_type n;
+        Kokkos::deep_copy( n, _device_size );
+        resize( n );
+    }
+
+    /*!
+      \brief Set the capacity growth factor.
+
+      \param growth_factor The factor by which the capacity is multiplied
+      when a resize exceeds the current capacity. Must be at least 1.0. A
+      value of 1.0 disables geometric growth and reallocates to the exact
+      requested size.
+    */
+    void setGrowthFactor( const double growth_factor )
+    {
+        if ( growth_factor < 1.0 )
+            throw std::invalid_argument( "Growth factor must be >= 1.0" );
+        _growth_factor = growth_factor;
+    }
+
+    /*!
+      \brief Get the capacity growth factor.
+
+      \return The factor by which the capacity is multiplied when a resize
+      exceeds the current capacity.
+    */
+    double growthFactor() const { return _growth_factor; }
+
+    /*!
+      \brief Enable or disable first-touch initialization of allocations.
+
+      \param first_touch If true, zero-initialize every new allocation with
+      a parallel kernel in the container execution space so that on NUMA
+      hosts pages bind to the domains of the threads that will process
+      them. Only affects allocations made after the call - set it before
+      the first resize (or construct with the FirstTouch tag) to place the
+      initial allocation.
+    */
+    void setFirstTouch( const bool first_touch )
+    {
+        _first_touch = first_touch;
+    }
+
+    /*!
+      \brief Get whether first-touch initialization of allocations is
+      enabled.
+
+      \return True if new allocations are touched in the execution space.
+    */
+    bool firstTouch() const { return _first_touch; }
+
     /*!
       \brief Get the number of structs-of-arrays in the container.
 
@@ -504,6 +745,18 @@ class AoSoA
     // Number of structs-of-arrays in the array.
     size_type _num_soa;
 
+    // Capacity growth factor applied when a resize exceeds the current
+    // capacity.
+    double _growth_factor;
+
+    // Whether new allocations are zero-initialized in the execution space
+    // for first-touch page placement.
+    bool _first_touch;
+
+    // Optional device-resident size counter. Allocated on first use by
+    // deviceSize().
+    Kokkos::View<size_type, memory_space> _device_size;
+
     // Structs-of-Arrays managed data. This Kokkos View manages the block of
     // memory owned by this class such that the copy constructor and
     // assignment operator for this class perform a shallow and reference
@@ -0,0 +1,735 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Checkpoint.hpp
+  \brief Binary AoSoA checkpoint and restart with parallel MPI-IO
+*/
+#ifndef CABANA_CHECKPOINT_HPP
+#define CABANA_CHECKPOINT_HPP
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_VerletList.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Cabana
+{
+namespace Experimental
+{
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+
+// Fixed-size file header written at offset zero of a checkpoint file. The
+// particle data that follows is the raw SoA block layout of the AoSoA so a
+// restart with a matching member type list and vector length can read
+// directly into the container allocation without a repacking pass.
+struct CheckpointHeader
+{
+    // Format identification string.
+    char magic[8];
+
+    // AoSoA vector length used to write the data.
+    unsigned long long vector_length;
+
+    // Size of a single SoA block in bytes.
+    unsigned long long soa_bytes;
+
+    // Number of ranks that wrote the file.
+    unsigned long long num_rank;
+
+    // Total number of particles across all ranks.
+    unsigned long long global_num_particle;
+};
+
+// Format identifier. Bump the trailing digit if the layout ever changes.
+inline const char* checkpointMagic() { return "CBNCKPT1"; }
+
+// Number of bytes a given particle count occupies in the file. Data is
+// written in whole SoA blocks so partially-filled trailing blocks are
+// included.
+template <class AoSoA_t>
+MPI_Offset checkpointDataBytes( const unsigned long long num_particle )
+{
+    unsigned long long num_soa = num_particle / AoSoA_t::vector_length;
+    if ( 0 != num_particle % AoSoA_t::vector_length )
+        ++num_soa;
+    return num_soa * sizeof( typename AoSoA_t::soa_type );
+}
+
+//---------------------------------------------------------------------------//
+// Fixed-size file header written at offset zero of a neighbor list
+// checkpoint file.
+struct NeighborHeader
+{
+    // Format identification string.
+    char magic[8];
+
+    // Identifier of the neighbor data layout.
+    unsigned long long layout_id;
+
+    // Size of the neighbor index type in bytes.
+    unsigned long long index_bytes;
+
+    // Number of ranks that wrote the file.
+    unsigned long long num_rank;
+
+    // Neighborhood radius the list was built with, including any skin. The
+    // list covers all interactions up to this distance.
+    double neighborhood_radius;
+};
+
+// Format identifier. Bump the trailing digit if the layout ever changes.
+inline const char* neighborMagic() { return "CBNNBRL1"; }
+
+// Layout identifiers stored in the header.
+inline unsigned long long neighborLayoutId( VerletLayoutCSR ) { return 0; }
+inline unsigned long long neighborLayoutId( VerletLayout2D ) { return 1; }
+inline unsigned long long neighborLayoutId( VerletLayoutCompressed2D )
+{
+    return 2;
+}
+
+// Per-rank extent record. The neighbor extent is the CSR or compressed
+// neighbor storage size, or the row width of the 2D layout. The capacity is
+// only meaningful for the CSR layout and is zero otherwise.
+struct NeighborRecord
+{
+    unsigned long long num_particle;
+    unsigned long long neighbor_extent;
+    unsigned long long capacity;
+};
+
+template <class MemorySpace, class IndexType>
+NeighborRecord makeNeighborRecord(
+    const VerletListData<MemorySpace, VerletLayoutCSR, IndexType>& data )
+{
+    return { data.counts.extent( 0 ), data.neighbors.extent( 0 ),
+             static_cast<unsigned long long>( data.capacity ) };
+}
+
+template <class MemorySpace, class IndexType>
+NeighborRecord makeNeighborRecord(
+    const VerletListData<MemorySpace, VerletLayout2D, IndexType>& data )
+{
+    return { data.counts.extent( 0 ), data.neighbors.extent( 1 ), 0 };
+}
+
+template <class MemorySpace, class IndexType>
+NeighborRecord makeNeighborRecord(
+    const VerletListData<MemorySpace, VerletLayoutCompressed2D, IndexType>&
+        data )
+{
+    return { data.counts.extent( 0 ), data.neighbors.extent( 0 ), 0 };
+}
+
+// Number of bytes one rank's neighbor data occupies in the file.
+inline MPI_Offset neighborDataBytes( VerletLayoutCSR,
+                                     const NeighborRecord& record,
+                                     const unsigned long long index_bytes )
+{
+    return ( 2 * record.num_particle + record.neighbor_extent ) * index_bytes;
+}
+
+inline MPI_Offset neighborDataBytes( VerletLayout2D,
+                                     const NeighborRecord& record,
+                                     const unsigned long long index_bytes )
+{
+    return ( record.num_particle +
+             record.num_particle * record.neighbor_extent ) *
+           index_bytes;
+}
+
+inline MPI_Offset neighborDataBytes( VerletLayoutCompressed2D,
+                                     const NeighborRecord& record,
+                                     const unsigned long long index_bytes )
+{
+    return ( 3 * record.num_particle + record.neighbor_extent ) * index_bytes;
+}
+
+// Allocate the neighbor data views to the extents in a record.
+template <class MemorySpace, class IndexType>
+void allocateNeighborData(
+    VerletListData<MemorySpace, VerletLayoutCSR, IndexType>& data,
+    const NeighborRecord& record )
+{
+    data.counts = Kokkos::View<IndexType*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "num_neighbors" ),
+        record.num_particle );
+    data.offsets = Kokkos::View<IndexType*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbor_offsets" ),
+        record.num_particle );
+    data.neighbors = Kokkos::View<IndexType*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
+        record.neighbor_extent );
+    data.capacity = static_cast<IndexType>( record.capacity );
+}
+
+template <class MemorySpace, class IndexType>
+void allocateNeighborData(
+    VerletListData<MemorySpace, VerletLayout2D, IndexType>& data,
+    const NeighborRecord& record )
+{
+    data.counts = Kokkos::View<IndexType*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "num_neighbors" ),
+        record.num_particle );
+    data.neighbors = Kokkos::View<IndexType**, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
+        record.num_particle, record.neighbor_extent );
+}
+
+template <class MemorySpace, class IndexType>
+void allocateNeighborData(
+    VerletListData<MemorySpace, VerletLayoutCompressed2D, IndexType>& data,
+    const NeighborRecord& record )
+{
+    data.counts = Kokkos::View<IndexType*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "num_neighbors" ),
+        record.num_particle );
+    data.row_start = Kokkos::View<IndexType*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "row_start" ),
+        record.num_particle );
+    data.row_stride = Kokkos::View<IndexType*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "row_stride" ),
+        record.num_particle );
+    data.neighbors = Kokkos::View<IndexType*, MemorySpace>(
+        Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
+        record.neighbor_extent );
+}
+
+// Write one view's contiguous data with a collective call and return the
+// offset past it. Write in whole index units so the count stays well within
+// the int range even for very large lists.
+template <class ViewType>
+MPI_Offset writeNeighborView( MPI_File file, MPI_Offset offset,
+                              const ViewType& view )
+{
+    using value_type = typename ViewType::value_type;
+    MPI_Datatype mpi_type;
+    MPI_Type_contiguous( sizeof( value_type ), MPI_BYTE, &mpi_type );
+    MPI_Type_commit( &mpi_type );
+    MPI_File_write_at_all( file, offset, view.data(), view.span(), mpi_type,
+                           MPI_STATUS_IGNORE );
+    MPI_Type_free( &mpi_type );
+    return offset + view.span() * sizeof( value_type );
+}
+
+// Read one view's contiguous data with a collective call and return the
+// offset past it.
+template <class ViewType>
+MPI_Offset readNeighborView( MPI_File file, MPI_Offset offset,
+                             ViewType& view )
+{
+    using value_type = typename ViewType::value_type;
+    MPI_Datatype mpi_type;
+    MPI_Type_contiguous( sizeof( value_type ), MPI_BYTE, &mpi_type );
+    MPI_Type_commit( &mpi_type );
+    MPI_File_read_at_all( file, offset, view.data(), view.span(), mpi_type,
+                          MPI_STATUS_IGNORE );
+    MPI_Type_free( &mpi_type );
+    return offset + view.span() * sizeof( value_type );
+}
+
+// Write the views of one rank's neighbor data in layout order. Device data
+// is staged through host mirrors; host data is written in place.
+template <class MemorySpace, class IndexType>
+void writeNeighborData(
+    MPI_File file, MPI_Offset offset,
+    const VerletListData<MemorySpace, VerletLayoutCSR, IndexType>& data )
+{
+    auto counts = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                       data.counts );
+    auto offsets = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                        data.offsets );
+    auto neighbors = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                          data.neighbors );
+    offset = writeNeighborView( file, offset, counts );
+    offset = writeNeighborView( file, offset, offsets );
+    writeNeighborView( file, offset, neighbors );
+}
+
+template <class MemorySpace, class IndexType>
+void writeNeighborData(
+    MPI_File file, MPI_Offset offset,
+    const VerletListData<MemorySpace, VerletLayout2D, IndexType>& data )
+{
+    auto counts = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                       data.counts );
+    auto neighbors = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                          data.neighbors );
+    offset = writeNeighborView( file, offset, counts );
+    writeNeighborView( file, offset, neighbors );
+}
+
+template <class MemorySpace, class IndexType>
+void writeNeighborData(
+    MPI_File file, MPI_Offset offset,
+    const VerletListData<MemorySpace, VerletLayoutCompressed2D, IndexType>&
+        data )
+{
+    auto counts = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                       data.counts );
+    auto row_start = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                          data.row_start );
+    auto row_stride = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), data.row_stride );
+    auto neighbors = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                          data.neighbors );
+    offset = writeNeighborView( file, offset, counts );
+    offset = writeNeighborView( file, offset, row_start );
+    offset = writeNeighborView( file, offset, row_stride );
+    writeNeighborView( file, offset, neighbors );
+}
+
+// Read the views of one rank's neighbor data in layout order. Host-resident
+// data is read into directly; device data is staged through host mirrors and
+// deep-copied once.
+template <class MemorySpace, class IndexType>
+void readNeighborData(
+    MPI_File file, MPI_Offset offset,
+    VerletListData<MemorySpace, VerletLayoutCSR, IndexType>& data )
+{
+    auto counts = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                              data.counts );
+    auto offsets = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                               data.offsets );
+    auto neighbors = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                                 data.neighbors );
+    offset = readNeighborView( file, offset, counts );
+    offset = readNeighborView( file, offset, offsets );
+    readNeighborView( file, offset, neighbors );
+    Kokkos::deep_copy( data.counts, counts );
+    Kokkos::deep_copy( data.offsets, offsets );
+    Kokkos::deep_copy( data.neighbors, neighbors );
+}
+
+template <class MemorySpace, class IndexType>
+void readNeighborData(
+    MPI_File file, MPI_Offset offset,
+    VerletListData<MemorySpace, VerletLayout2D, IndexType>& data )
+{
+    auto counts = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                              data.counts );
+    auto neighbors = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                                 data.neighbors );
+    offset = readNeighborView( file, offset, counts );
+    readNeighborView( file, offset, neighbors );
+    Kokkos::deep_copy( data.counts, counts );
+    Kokkos::deep_copy( data.neighbors, neighbors );
+}
+
+template <class MemorySpace, class IndexType>
+void readNeighborData(
+    MPI_File file, MPI_Offset offset,
+    VerletListData<MemorySpace, VerletLayoutCompressed2D, IndexType>& data )
+{
+    auto counts = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                              data.counts );
+    auto row_start = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                                 data.row_start );
+    auto row_stride = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                                  data.row_stride );
+    auto neighbors = Kokkos::create_mirror_view( Kokkos::HostSpace(),
+                                                 data.neighbors );
+    offset = readNeighborView( file, offset, counts );
+    offset = readNeighborView( file, offset, row_start );
+    offset = readNeighborView( file, offset, row_stride );
+    readNeighborView( file, offset, neighbors );
+    Kokkos::deep_copy( data.counts, counts );
+    Kokkos::deep_copy( data.row_start, row_start );
+    Kokkos::deep_copy( data.row_stride, row_stride );
+    Kokkos::deep_copy( data.neighbors, neighbors );
+}
+
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Write an AoSoA to a binary checkpoint file with collective MPI-IO.
+
+  \tparam AoSoA_t AoSoA type.
+
+  \param comm The communicator over which the particles are distributed. All
+  ranks in the communicator must call this function.
+
+  \param file_name Name of the checkpoint file. An existing file with this
+  name is overwritten.
+
+  \param aosoa The particles to checkpoint.
+
+  The file holds a small header describing the SoA layout, a per-rank
+  particle count table, and then each rank's SoA blocks as raw bytes in rank
+  order. Device-resident data is staged through a host mirror; host-resident
+  data is written in place with no copy. All ranks write their blocks with a
+  single collective call so the file system sees one large contiguous write
+  per rank rather than a stream of slice-sized fragments.
+*/
+template <class AoSoA_t>
+void checkpoint( MPI_Comm comm, const std::string& file_name,
+                 const AoSoA_t& aosoa )
+{
+    using soa_type = typename AoSoA_t::soa_type;
+
+    int comm_rank;
+    MPI_Comm_rank( comm, &comm_rank );
+    int comm_size;
+    MPI_Comm_size( comm, &comm_size );
+
+    // Stage the data on the host. If the AoSoA is already host-accessible
+    // this is a shallow copy and no data movement occurs.
+    auto host_aosoa =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+
+    // Gather the particle counts from all ranks so every rank can compute
+    // its own file offset independently.
+    unsigned long long local_count = aosoa.size();
+    std::vector<unsigned long long> counts( comm_size );
+    MPI_Allgather( &local_count, 1, MPI_UNSIGNED_LONG_LONG, counts.data(), 1,
+                   MPI_UNSIGNED_LONG_LONG, comm );
+
+    // Compute this rank's offset past the header, the count table, and the
+    // blocks of all lower ranks.
+    MPI_Offset offset = sizeof( Impl::CheckpointHeader ) +
+                        comm_size * sizeof( unsigned long long );
+    unsigned long long global_count = 0;
+    for ( int r = 0; r < comm_size; ++r )
+    {
+        if ( r < comm_rank )
+            offset += Impl::checkpointDataBytes<AoSoA_t>( counts[r] );
+        global_count += counts[r];
+    }
+
+    // Open the file.
+    MPI_File file;
+    MPI_File_open( comm, file_name.c_str(),
+                   MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &file );
+
+    // The first rank writes the header and the count table.
+    if ( 0 == comm_rank )
+    {
+        Impl::CheckpointHeader header;
+        std::memcpy( header.magic, Impl::checkpointMagic(),
+                     sizeof( header.magic ) );
+        header.vector_length = AoSoA_t::vector_length;
+        header.soa_bytes = sizeof( soa_type );
+        header.num_rank = comm_size;
+        header.global_num_particle = global_count;
+        MPI_File_write_at( file, 0, &header, sizeof( header ), MPI_BYTE,
+                           MPI_STATUS_IGNORE );
+        MPI_File_write_at( file, sizeof( header ), counts.data(),
+                           comm_size * sizeof( unsigned long long ), MPI_BYTE,
+                           MPI_STATUS_IGNORE );
+    }
+
+    // Collectively write the SoA blocks. Write whole SoA units so the count
+    // stays well within the int range even for very large particle counts.
+    MPI_Datatype soa_mpi_type;
+    MPI_Type_contiguous( sizeof( soa_type ), MPI_BYTE, &soa_mpi_type );
+    MPI_Type_commit( &soa_mpi_type );
+    MPI_File_write_at_all( file, offset, host_aosoa.data(),
+                           host_aosoa.numSoA(), soa_mpi_type,
+                           MPI_STATUS_IGNORE );
+    MPI_Type_free( &soa_mpi_type );
+
+    // Close the file.
+    MPI_File_close( &file );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Restore an AoSoA from a binary checkpoint file with collective
+  MPI-IO.
+
+  \tparam AoSoA_t AoSoA type.
+
+  \param comm The communicator over which the particles are distributed. All
+  ranks in the communicator must call this function. The communicator must
+  have the same number of ranks as the one that wrote the file.
+
+  \param file_name Name of the checkpoint file.
+
+  \param aosoa The particles to restore. Resized to the count this rank wrote
+  at checkpoint time. Any existing contents are discarded.
+
+  The AoSoA member types and vector length must match those used to write
+  the file - the header is validated and a std::runtime_error is thrown on
+  mismatch. Host-resident containers are read into directly with no
+  intermediate copy; device-resident containers are read into a host mirror
+  and deep-copied once.
+*/
+template <class AoSoA_t>
+void restore( MPI_Comm comm, const std::string& file_name, AoSoA_t& aosoa )
+{
+    using soa_type = typename AoSoA_t::soa_type;
+
+    int comm_rank;
+    MPI_Comm_rank( comm, &comm_rank );
+    int comm_size;
+    MPI_Comm_size( comm, &comm_size );
+
+    // Open the file.
+    MPI_File file;
+    int open_error = MPI_File_open( comm, file_name.c_str(), MPI_MODE_RDONLY,
+                                    MPI_INFO_NULL, &file );
+    if ( MPI_SUCCESS != open_error )
+        throw std::runtime_error( "Unable to open checkpoint file " +
+                                  file_name );
+
+    // Read and validate the header. Every rank reads it independently to
+    // avoid a broadcast.
+    Impl::CheckpointHeader header;
+    MPI_File_read_at( file, 0, &header, sizeof( header ), MPI_BYTE,
+                      MPI_STATUS_IGNORE );
+    std::string header_error;
+    if ( 0 != std::memcmp( header.magic, Impl::checkpointMagic(),
+                           sizeof( header.magic ) ) )
+        header_error = file_name + " is not a Cabana checkpoint file";
+    else if ( header.vector_length != AoSoA_t::vector_length )
+        header_error = "Checkpoint vector length does not match the AoSoA";
+    else if ( header.soa_bytes != sizeof( soa_type ) )
+        header_error =
+            "Checkpoint SoA size does not match the AoSoA member types";
+    else if ( header.num_rank != static_cast<unsigned long long>( comm_size ) )
+        header_error = "Checkpoint was written with a different number of "
+                       "ranks";
+    if ( !header_error.empty() )
+    {
+        MPI_File_close( &file );
+        throw std::runtime_error( header_error );
+    }
+
+    // Read the per-rank count table.
+    std::vector<unsigned long long> counts( comm_size );
+    MPI_File_read_at( file, sizeof( header ), counts.data(),
+                      comm_size * sizeof( unsigned long long ), MPI_BYTE,
+                      MPI_STATUS_IGNORE );
+
+    // Compute this rank's offset.
+    MPI_Offset offset = sizeof( Impl::CheckpointHeader ) +
+                        comm_size * sizeof( unsigned long long );
+    for ( int r = 0; r < comm_rank; ++r )
+        offset += Impl::checkpointDataBytes<AoSoA_t>( counts[r] );
+
+    // Size the container and get a host view of its memory. If the AoSoA is
+    // host-accessible the mirror view aliases the container and the read
+    // lands directly in its allocation.
+    aosoa.resize( counts[comm_rank] );
+    auto host_aosoa = Cabana::create_mirror_view( Kokkos::HostSpace(), aosoa );
+
+    // Collectively read the SoA blocks.
+    MPI_Datatype soa_mpi_type;
+    MPI_Type_contiguous( sizeof( soa_type ), MPI_BYTE, &soa_mpi_type );
+    MPI_Type_commit( &soa_mpi_type );
+    MPI_File_read_at_all( file, offset, host_aosoa.data(),
+                          host_aosoa.numSoA(), soa_mpi_type,
+                          MPI_STATUS_IGNORE );
+    MPI_Type_free( &soa_mpi_type );
+
+    // Close the file.
+    MPI_File_close( &file );
+
+    // Copy to the device if the data was staged through a mirror.
+    if ( static_cast<void*>( host_aosoa.data() ) !=
+         static_cast<void*>( aosoa.data() ) )
+        Cabana::deep_copy( aosoa, host_aosoa );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Write Verlet list data to a binary checkpoint file with collective
+  MPI-IO.
+
+  \tparam MemorySpace Kokkos memory space of the list data.
+  \tparam LayoutTag Neighbor data layout tag.
+  \tparam IndexType Neighbor index type.
+
+  \param comm The communicator over which the particles are distributed. All
+  ranks in the communicator must call this function.
+
+  \param file_name Name of the neighbor checkpoint file. An existing file
+  with this name is overwritten.
+
+  \param data The neighbor list data to checkpoint, e.g. the \c _data member
+  of a VerletList.
+
+  \param neighborhood_radius The neighborhood radius the list was built
+  with, including any skin. Stored in the file and checked on restore.
+
+  Written alongside an AoSoA checkpoint of the matching particle state this
+  makes a warm restart neighbor-search-free: the checkpointed positions are
+  exactly the positions the list matched, so the restored list is valid
+  without a rebuild for any cutoff the stored radius covers.
+*/
+template <class MemorySpace, class LayoutTag, class IndexType>
+void checkpointNeighbors(
+    MPI_Comm comm, const std::string& file_name,
+    const VerletListData<MemorySpace, LayoutTag, IndexType>& data,
+    const double neighborhood_radius )
+{
+    int comm_rank;
+    MPI_Comm_rank( comm, &comm_rank );
+    int comm_size;
+    MPI_Comm_size( comm, &comm_size );
+
+    // Gather the extent records from all ranks so every rank can compute
+    // its own file offset independently.
+    Impl::NeighborRecord record = Impl::makeNeighborRecord( data );
+    std::vector<Impl::NeighborRecord> records( comm_size );
+    MPI_Allgather( &record, sizeof( record ), MPI_BYTE, records.data(),
+                   sizeof( record ), MPI_BYTE, comm );
+
+    // Compute this rank's offset past the header, the record table, and the
+    // data of all lower ranks.
+    MPI_Offset offset = sizeof( Impl::NeighborHeader ) +
+                        comm_size * sizeof( Impl::NeighborRecord );
+    for ( int r = 0; r < comm_rank; ++r )
+        offset += Impl::neighborDataBytes( LayoutTag(), records[r],
+                                           sizeof( IndexType ) );
+
+    // Open the file.
+    MPI_File file;
+    MPI_File_open( comm, file_name.c_str(),
+                   MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &file );
+
+    // The first rank writes the header and the record table.
+    if ( 0 == comm_rank )
+    {
+        Impl::NeighborHeader header;
+        std::memcpy( header.magic, Impl::neighborMagic(),
+                     sizeof( header.magic ) );
+        header.layout_id = Impl::neighborLayoutId( LayoutTag() );
+        header.index_bytes = sizeof( IndexType );
+        header.num_rank = comm_size;
+        header.neighborhood_radius = neighborhood_radius;
+        MPI_File_write_at( file, 0, &header, sizeof( header ), MPI_BYTE,
+                           MPI_STATUS_IGNORE );
+        MPI_File_write_at( file, sizeof( header ), records.data(),
+                           comm_size * sizeof( Impl::NeighborRecord ),
+                           MPI_BYTE, MPI_STATUS_IGNORE );
+    }
+
+    // Collectively write the neighbor data.
+    Impl::writeNeighborData( file, offset, data );
+
+    // Close the file.
+    MPI_File_close( &file );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Restore Verlet list data from a binary checkpoint file with
+  collective MPI-IO.
+
+  \tparam MemorySpace Kokkos memory space of the list data.
+  \tparam LayoutTag Neighbor data layout tag.
+  \tparam IndexType Neighbor index type.
+
+  \param comm The communicator over which the particles are distributed. All
+  ranks in the communicator must call this function. The communicator must
+  have the same number of ranks as the one that wrote the file.
+
+  \param file_name Name of the neighbor checkpoint file.
+
+  \param data The neighbor list data to restore. Reallocated to the extents
+  this rank wrote at checkpoint time. Any existing contents are discarded.
+
+  \param neighborhood_radius The neighborhood radius the restored list must
+  cover. A std::runtime_error is thrown if the stored radius is smaller -
+  the list would miss interactions and must be rebuilt instead.
+
+  The layout tag and index type must match those used to write the file -
+  the header is validated and a std::runtime_error is thrown on mismatch.
+  The restored list is only valid for the particle state checkpointed with
+  it, so restore the matching AoSoA first.
+*/
+template <class MemorySpace, class LayoutTag, class IndexType>
+void restoreNeighbors( MPI_Comm comm, const std::string& file_name,
+                       VerletListData<MemorySpace, LayoutTag, IndexType>& data,
+                       const double neighborhood_radius )
+{
+    int comm_rank;
+    MPI_Comm_rank( comm, &comm_rank );
+    int comm_size;
+    MPI_Comm_size( comm, &comm_size );
+
+    // Open the file.
+    MPI_File file;
+    int open_error = MPI_File_open( comm, file_name.c_str(), MPI_MODE_RDONLY,
+                                    MPI_INFO_NULL, &file );
+    if ( MPI_SUCCESS != open_error )
+        throw std::runtime_error( "Unable to open neighbor checkpoint file " +
+                                  file_name );
+
+    // Read and validate the header. Every rank reads it independently to
+    // avoid a broadcast.
+    Impl::NeighborHeader header;
+    MPI_File_read_at( file, 0, &header, sizeof( header ), MPI_BYTE,
+                      MPI_STATUS_IGNORE );
+    std::string header_error;
+    if ( 0 != std::memcmp( header.magic, Impl::neighborMagic(),
+                           sizeof( header.magic ) ) )
+        header_error = file_name + " is not a Cabana neighbor checkpoint "
+                                   "file";
+    else if ( header.layout_id != Impl::neighborLayoutId( LayoutTag() ) )
+        header_error = "Neighbor checkpoint layout does not match the list";
+    else if ( header.index_bytes != sizeof( IndexType ) )
+        header_error =
+            "Neighbor checkpoint index size does not match the list";
+    else if ( header.num_rank != static_cast<unsigned long long>( comm_size ) )
+        header_error = "Neighbor checkpoint was written with a different "
+                       "number of ranks";
+    else if ( header.neighborhood_radius < neighborhood_radius )
+        header_error = "Stored neighbor list does not cover the requested "
+                       "neighborhood radius";
+    if ( !header_error.empty() )
+    {
+        MPI_File_close( &file );
+        throw std::runtime_error( header_error );
+    }
+
+    // Read the per-rank record table.
+    std::vector<Impl::NeighborRecord> records( comm_size );
+    MPI_File_read_at( file, sizeof( header ), records.data(),
+                      comm_size * sizeof( Impl::NeighborRecord ), MPI_BYTE,
+                      MPI_STATUS_IGNORE );
+
+    // Compute this rank's offset.
+    MPI_Offset offset = sizeof( Impl::NeighborHeader ) +
+                        comm_size * sizeof( Impl::NeighborRecord );
+    for ( int r = 0; r < comm_rank; ++r )
+        offset += Impl::neighborDataBytes( LayoutTag(), records[r],
+                                           sizeof( IndexType ) );
+
+    // Size the data and collectively read the neighbor views.
+    Impl::allocateNeighborData( data, records[comm_rank] );
+    Impl::readNeighborData( file, offset, data );
+
+    // Close the file.
+    MPI_File_close( &file );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Experimental
+} // end namespace Cabana
+
+#endif // end CABANA_CHECKPOINT_HPP
@@ -18,20 +18,88 @@
 
 #include <CabanaCore_config.hpp>
 
+#include <Cabana_PinnedBufferPool.hpp>
+
 #include <Kokkos_Core.hpp>
 #include <Kokkos_ScatterView.hpp>
 
 #include <mpi.h>
+#if defined( OPEN_MPI )
+#include <mpi-ext.h>
+#endif
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <exception>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
 namespace Cabana
 {
+//---------------------------------------------------------------------------//
+/*!
+  \brief Get a mutable reference to the neighbor count up to which steering
+  construction histograms all neighbors in one shared-memory pass.
+
+  Larger neighbor counts are processed in multiple shared-memory passes over
+  windows of this size instead of falling back to per-element global
+  atomics. The default of 64 covers a 3d halo; assign to tune the crossover
+  for a given decomposition (e.g. multi-box layouts with 100+ neighbors).
+*/
+inline int& steeringHistogramCrossover()
+{
+    static int crossover = 64;
+    return crossover;
+}
+
+//---------------------------------------------------------------------------//
+//! Steering construction algorithm selection.
+enum class SteeringAlgorithm
+{
+    //! Choose per plan from the export count and neighbor distribution.
+    automatic,
+    //! Shared-memory histogram accumulated with atomics.
+    atomic,
+    //! Thread-duplicated counts reduced without atomics.
+    duplicated
+};
+
+/*!
+  \brief Get a mutable reference to the algorithm used to count sends and
+  build the export steering vector.
+
+  The default automatic selection measures the export distribution at plan
+  creation and prefers the duplicated algorithm when its thread-replicated
+  arrays fit within steeringDuplicationBudget() per histogram pass the
+  atomic algorithm would otherwise run. Assign to force one algorithm (e.g.
+  duplicated on a low-neighbor-count slab decomposition where the automatic
+  selection falls back to atomics).
+*/
+inline SteeringAlgorithm& steeringAlgorithm()
+{
+    static SteeringAlgorithm algorithm = SteeringAlgorithm::automatic;
+    return algorithm;
+}
+
+/*!
+  \brief Get a mutable reference to the memory (in bytes) the automatic
+  steering algorithm selection grants the duplicated algorithm's
+  thread-replicated arrays for each histogram pass the atomic algorithm
+  would need to cover the ranks exported to.
+*/
+inline std::size_t& steeringDuplicationBudget()
+{
+    static std::size_t budget = 1 << 26;
+    return budget;
+}
+
 namespace Impl
 {
 //! \cond Impl
@@ -45,46 +113,103 @@ struct CountSendsAndCreateSteeringAtomic
 };
 
 //---------------------------------------------------------------------------//
-// Count sends and create steering algorithm selector.
-template <class ExecutionSpace>
-struct CountSendsAndCreateSteeringAlgorithm;
-
-// CUDA and HIP use atomics.
-#ifdef KOKKOS_ENABLE_CUDA
-template <>
-struct CountSendsAndCreateSteeringAlgorithm<Kokkos::Cuda>
-{
-    using type = CountSendsAndCreateSteeringAtomic;
-};
-#endif // end KOKKOS_ENABLE_CUDA
-#ifdef KOKKOS_ENABLE_HIP
-template <>
-struct CountSendsAndCreateSteeringAlgorithm<Kokkos::Experimental::HIP>
-{
-    using type = CountSendsAndCreateSteeringAtomic;
-};
-#endif // end KOKKOS_ENABLE_HIP
-#ifdef KOKKOS_ENABLE_SYCL
-template <>
-struct CountSendsAndCreateSteeringAlgorithm<Kokkos::Experimental::SYCL>
+// One shared-memory histogram pass of the steering construction over a
+// window of the neighbor ranks. Elements whose export rank falls outside
+// the window are ignored; a full construction runs enough passes to cover
+// all of the neighbors.
+template <class ExportRankView, class CountView, class IdView>
+void countSendsAndCreateSteeringPass(
+    const ExportRankView element_export_ranks, CountView neighbor_counts,
+    IdView neighbor_ids, const int rank_begin, const int num_rank )
 {
-    using type = CountSendsAndCreateSteeringAtomic;
-};
-#endif // end KOKKOS_ENABLE_SYCL
-#ifdef KOKKOS_ENABLE_OPENMPTARGET
-template <>
-struct CountSendsAndCreateSteeringAlgorithm<Kokkos::Experimental::OpenMPTarget>
-{
-    using type = CountSendsAndCreateSteeringAtomic;
-};
-#endif // end KOKKOS_ENABLE_OPENMPTARGET
+    using execution_space = typename ExportRankView::execution_space;
 
-// The default is to use duplication.
-template <class ExecutionSpace>
-struct CountSendsAndCreateSteeringAlgorithm
-{
-    using type = CountSendsAndCreateSteeringDuplicated;
-};
+    constexpr int team_size = 256;
+    Kokkos::TeamPolicy<execution_space> team_policy(
+        ( element_export_ranks.size() + team_size - 1 ) / team_size,
+        team_size );
+    team_policy = team_policy.set_scratch_size(
+        0, Kokkos::PerTeam( sizeof( int ) * ( team_size + 2 * num_rank ) ) );
+    Kokkos::parallel_for(
+        "Cabana::CommunicationPlan::countSendsAndCreateSteeringShared",
+        team_policy,
+        KOKKOS_LAMBDA(
+            const typename Kokkos::TeamPolicy<execution_space>::member_type&
+                team ) {
+            // NOTE: `get_shmem` returns shared memory pointers *aligned to
+            // 8 bytes*, so if `num_rank` is odd we can get erroneously
+            // padded offsets if we call `get_shmem` separately for each
+            // shared memory intermediary. Acquiring all the needed scratch
+            // memory at once then computing pointer offsets by hand avoids
+            // this issue.
+            int* scratch = (int*)team.team_shmem().get_shmem(
+                ( team.team_size() + 2 * num_rank ) * sizeof( int ), 0 );
+
+            // local neighbor_ids, gives the local offset relative to
+            // calculated global offset. Size team.team_size() * sizeof(int)
+            int* local_neighbor_ids = scratch;
+            // local histogram over the rank window, `num_rank` in size
+            int* histo = local_neighbor_ids + team.team_size();
+            // offset into global array, `num_rank` in size
+            int* global_offset = histo + num_rank;
+            // overall element `tid`
+            const auto tid =
+                team.team_rank() + team.league_rank() * team.team_size();
+            // local element
+            const int local_id = team.team_rank();
+            // total number of elements, for convenience
+            const int num_elements = element_export_ranks.size();
+            // my element export rank
+            const int my_element_export_rank =
+                ( tid < num_elements ? element_export_ranks( tid ) : -1 );
+
+            // cannot outright terminate early b/c threads share work
+            // if (tid >= num_elements) return;
+            const bool in_bounds = tid < num_elements &&
+                                   my_element_export_rank >= rank_begin &&
+                                   my_element_export_rank <
+                                       rank_begin + num_rank;
+            // my rank relative to the window
+            const int my_local_rank = my_element_export_rank - rank_begin;
+
+            Kokkos::parallel_for( Kokkos::TeamThreadRange( team, num_rank ),
+                                  [&]( const int i ) { histo[i] = 0; } );
+
+            // synchronize zeroing
+            team.team_barrier();
+
+            // build local histogram, need to encode num_elements check here
+            if ( in_bounds )
+            {
+                // shared memory atomic add, accumulate into local offset
+                local_neighbor_ids[local_id] =
+                    Kokkos::atomic_fetch_add( &histo[my_local_rank], 1 );
+            }
+
+            // synchronize local histogram build
+            team.team_barrier();
+
+            // reserve space in global array via a loop over neighbor counts
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange( team, num_rank ),
+                [&]( const int i ) {
+                    // global memory atomic add, reserves space
+                    global_offset[i] = Kokkos::atomic_fetch_add(
+                        &neighbor_counts( rank_begin + i ), histo[i] );
+                } );
+
+            // synchronize block-stride loop
+            team.team_barrier();
+
+            // and now store to my location
+            if ( in_bounds )
+            {
+                neighbor_ids( tid ) =
+                    global_offset[my_local_rank] +
+                    local_neighbor_ids[local_id];
+            }
+        } );
+}
 
 //---------------------------------------------------------------------------//
 // Count sends and generate the steering vector. Atomic version.
@@ -97,7 +222,6 @@ auto countSendsAndCreateSteering( const ExportRankView element_export_ranks,
                               typename ExportRankView::device_type>>
 {
     using device_type = typename ExportRankView::device_type;
-    using execution_space = typename ExportRankView::execution_space;
     using size_type = typename ExportRankView::size_type;
 
     // Create views.
@@ -107,110 +231,22 @@ auto countSendsAndCreateSteering( const ExportRankView element_export_ranks,
         Kokkos::ViewAllocateWithoutInitializing( "neighbor_ids" ),
         element_export_ranks.size() );
 
-    // Count the sends and create the steering vector.
-
-    // For smaller values of comm_size, use the optimized scratch memory path
-    // Value of 64 is arbitrary, should be at least 27 to cover 3-d halos?
-    if ( comm_size <= 64 )
+    // Count the sends and create the steering vector with the shared-memory
+    // histogram. Neighbor counts up to the crossover fit in one scratch
+    // histogram; beyond it the ranks are processed in multiple passes over
+    // crossover-sized windows, which keeps the shared-memory accumulation
+    // (one global atomic per team per rank instead of one per element) at
+    // the cost of re-reading the export ranks once per pass.
+    const int crossover = steeringHistogramCrossover();
+    const int window = ( comm_size < crossover ) ? comm_size : crossover;
+    for ( int rank_begin = 0; rank_begin < comm_size; rank_begin += window )
     {
-        constexpr int team_size = 256;
-        Kokkos::TeamPolicy<execution_space> team_policy(
-            ( element_export_ranks.size() + team_size - 1 ) / team_size,
-            team_size );
-        team_policy = team_policy.set_scratch_size(
-            0,
-            Kokkos::PerTeam( sizeof( int ) * ( team_size + 2 * comm_size ) ) );
-        Kokkos::parallel_for(
-            "Cabana::CommunicationPlan::countSendsAndCreateSteeringShared",
-            team_policy,
-            KOKKOS_LAMBDA(
-                const typename Kokkos::TeamPolicy<execution_space>::member_type&
-                    team ) {
-                // NOTE: `get_shmem` returns shared memory pointers *aligned to
-                // 8 bytes*, so if `comm_size` is odd we can get erroneously
-                // padded offsets if we call `get_shmem` separately for each
-                // shared memory intermediary. Acquiring all the needed scratch
-                // memory at once then computing pointer offsets by hand avoids
-                // this issue.
-                int* scratch = (int*)team.team_shmem().get_shmem(
-                    ( team.team_size() + 2 * comm_size ) * sizeof( int ), 0 );
-
-                // local neighbor_ids, gives the local offset relative to
-                // calculated global offset. Size team.team_size() * sizeof(int)
-                int* local_neighbor_ids = scratch;
-                // local histogram, `comm_size` in size
-                int* histo = local_neighbor_ids + team.team_size();
-                // offset into global array, `comm_size` in size
-                int* global_offset = histo + comm_size;
-                // overall element `tid`
-                const auto tid =
-                    team.team_rank() + team.league_rank() * team.team_size();
-                // local element
-                const int local_id = team.team_rank();
-                // total number of elements, for convenience
-                const int num_elements = element_export_ranks.size();
-                // my element export rank
-                const int my_element_export_rank =
-                    ( tid < num_elements ? element_export_ranks( tid ) : -1 );
-
-                // cannot outright terminate early b/c threads share work
-                // if (tid >= num_elements) return;
-                const bool in_bounds =
-                    tid < num_elements && my_element_export_rank >= 0;
-
-                Kokkos::parallel_for(
-                    Kokkos::TeamThreadRange( team, comm_size ),
-                    [&]( const int i ) { histo[i] = 0; } );
-
-                // synchronize zeroing
-                team.team_barrier();
-
-                // build local histogram, need to encode num_elements check here
-                if ( in_bounds )
-                {
-                    // shared memory atomic add, accumulate into local offset
-                    local_neighbor_ids[local_id] = Kokkos::atomic_fetch_add(
-                        &histo[my_element_export_rank], 1 );
-                }
-
-                // synchronize local histogram build
-                team.team_barrier();
-
-                // reserve space in global array via a loop over neighbor counts
-                Kokkos::parallel_for(
-                    Kokkos::TeamThreadRange( team, comm_size ),
-                    [&]( const int i ) {
-                        // global memory atomic add, reserves space
-                        global_offset[i] = Kokkos::atomic_fetch_add(
-                            &neighbor_counts( i ), histo[i] );
-                    } );
-
-                // synchronize block-stride loop
-                team.team_barrier();
-
-                // and now store to my location
-                if ( in_bounds )
-                {
-                    neighbor_ids( tid ) =
-                        global_offset[my_element_export_rank] +
-                        local_neighbor_ids[local_id];
-                }
-            } );
-    }
-    else
-    {
-        // For larger numbers of export ranks (for ex, migration) we use the
-        // global memory version, though this is a point of future optimization
-
-        Kokkos::parallel_for(
-            "Cabana::CommunicationPlan::countSendsAndCreateSteering",
-            Kokkos::RangePolicy<execution_space>( 0,
-                                                  element_export_ranks.size() ),
-            KOKKOS_LAMBDA( const size_type i ) {
-                if ( element_export_ranks( i ) >= 0 )
-                    neighbor_ids( i ) = Kokkos::atomic_fetch_add(
-                        &neighbor_counts( element_export_ranks( i ) ), 1 );
-            } );
+        const int num_rank = ( rank_begin + window < comm_size )
+                                 ? window
+                                 : comm_size - rank_begin;
+        countSendsAndCreateSteeringPass( element_export_ranks,
+                                         neighbor_counts, neighbor_ids,
+                                         rank_begin, num_rank );
     }
     Kokkos::fence();
 
@@ -354,6 +390,75 @@ auto countSendsAndCreateSteering( const ExportRankView element_export_ranks,
     return std::make_pair( neighbor_counts, neighbor_ids );
 }
 
+//---------------------------------------------------------------------------//
+// Count sends and generate the steering vector, selecting the algorithm at
+// runtime. Explicit selections dispatch directly. The automatic selection
+// weighs the duplicated algorithm's thread-replicated storage - which
+// scales with the execution space concurrency - against the number of
+// histogram passes the atomic algorithm needs to cover the ranks actually
+// exported to.
+template <class ExportRankView>
+auto countSendsAndCreateSteering( const ExportRankView element_export_ranks,
+                                  const int comm_size )
+    -> std::pair<Kokkos::View<int*, typename ExportRankView::device_type>,
+                 Kokkos::View<typename ExportRankView::size_type*,
+                              typename ExportRankView::device_type>>
+{
+    using execution_space = typename ExportRankView::execution_space;
+    using size_type = typename ExportRankView::size_type;
+
+    const auto algorithm = steeringAlgorithm();
+    if ( SteeringAlgorithm::atomic == algorithm )
+        return countSendsAndCreateSteering(
+            element_export_ranks, comm_size,
+            CountSendsAndCreateSteeringAtomic() );
+    if ( SteeringAlgorithm::duplicated == algorithm )
+        return countSendsAndCreateSteering(
+            element_export_ranks, comm_size,
+            CountSendsAndCreateSteeringDuplicated() );
+
+    // Automatic selection. Compute the storage the duplicated algorithm
+    // would replicate across the concurrent threads.
+    Kokkos::Experimental::UniqueToken<
+        execution_space, Kokkos::Experimental::UniqueTokenScope::Global>
+        unique_token;
+    const std::size_t duplicated_bytes =
+        static_cast<std::size_t>( unique_token.size() ) *
+        ( comm_size * sizeof( int ) +
+          element_export_ranks.size() * sizeof( size_type ) );
+
+    // Measure the span of ranks actually exported to - it bounds the
+    // number of histogram passes the atomic algorithm runs.
+    int max_export_rank = -1;
+    Kokkos::parallel_reduce(
+        "Cabana::CommunicationPlan::maxExportRank",
+        Kokkos::RangePolicy<execution_space>( 0,
+                                              element_export_ranks.size() ),
+        KOKKOS_LAMBDA( const size_type i, int& result ) {
+            if ( element_export_ranks( i ) > result )
+                result = element_export_ranks( i );
+        },
+        Kokkos::Max<int>( max_export_rank ) );
+    Kokkos::fence();
+    const int crossover = steeringHistogramCrossover();
+    const std::size_t num_pass =
+        ( max_export_rank < 0 ) ? 1
+                                : ( max_export_rank + crossover ) / crossover;
+
+    // The duplicated algorithm reads the export ranks once while the
+    // atomic algorithm re-reads them every pass, so grant the duplication
+    // budget once per pass. Low-concurrency (host) spaces then duplicate
+    // as before, while on accelerators duplication is only chosen when the
+    // export distribution spans enough neighbors to make the repeated
+    // atomic sweeps the more expensive option.
+    if ( duplicated_bytes <= num_pass * steeringDuplicationBudget() )
+        return countSendsAndCreateSteering(
+            element_export_ranks, comm_size,
+            CountSendsAndCreateSteeringDuplicated() );
+    return countSendsAndCreateSteering( element_export_ranks, comm_size,
+                                        CountSendsAndCreateSteeringAtomic() );
+}
+
 //---------------------------------------------------------------------------//
 // Return unique neighbor ranks, with the current rank first.
 std::vector<int> getUniqueTopology( std::vector<int> topology )
@@ -388,6 +493,11 @@ std::vector<int> getUniqueTopology( std::vector<int> topology )
   \tparam DeviceType Device type for which the data for this class will be
   allocated and where parallel execution will occur.
 
+  \tparam ExportIndexType Integer type of the export steering vector
+  entries. Defaults to std::size_t. A 32-bit type halves the steering
+  memory when the number of local elements fits in it - steering creation
+  checks this at runtime and throws if the type is too narrow.
+
   The communication plan computes how to redistribute elements in a parallel
   data structure using MPI. Given a list of data elements on the local MPI
   rank and their destination ranks, the communication plan computes which rank
@@ -407,10 +517,13 @@ std::vector<int> getUniqueTopology( std::vector<int> topology )
   means is that neighbor 0 is the local rank and the data for that rank that
   is being exported will appear first in the steering vector.
 */
-template <class DeviceType>
+template <class DeviceType, class ExportIndexType = std::size_t>
 class CommunicationPlan
 {
   public:
+    static_assert( std::is_integral<ExportIndexType>::value,
+                   "Export index type must be an integral type" );
+
     //! Device type.
     using device_type = DeviceType;
 
@@ -423,6 +536,9 @@ class CommunicationPlan
     //! Size type.
     using size_type = typename memory_space::size_type;
 
+    //! Export steering vector index type.
+    using export_index_type = ExportIndexType;
+
     /*!
       \brief Constructor.
 
@@ -445,6 +561,24 @@ class CommunicationPlan
                 MPI_Comm_free( p );
                 delete p;
             } );
+
+        // Create the communication buffer storage. Like the communicator
+        // this is held through a shared pointer so the buffers can be
+        // updated through const references to the plan and shared between
+        // copies.
+        _buffers = std::make_shared<BufferStorage>();
+        _rma = std::make_shared<RmaState>();
+        _node = std::make_shared<NodeState>();
+        _progress = std::make_shared<ProgressState>();
+        _pinned_pool = std::make_shared<PinnedBufferPool>();
+
+        // Pass buffers directly to MPI if they are host accessible or the
+        // MPI library advertises that it is GPU-aware. Otherwise stage
+        // through host memory.
+        _device_direct =
+            Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                       memory_space>::accessible ||
+            gpuAwareMpiSupported();
     }
 
     /*!
@@ -541,11 +675,582 @@ class CommunicationPlan
       (i.e. all elements going to neighbor with local id 0 first, then all
       elements going to neighbor with local id 1, etc.).
     */
-    Kokkos::View<std::size_t*, device_type> getExportSteering() const
+    Kokkos::View<ExportIndexType*, device_type> getExportSteering() const
     {
         return _export_steering;
     }
 
+    /*!
+      \brief Get the number of bytes of memory allocated by the plan.
+
+      \return The number of allocated bytes. This counts the export steering
+      vector, the communication buffers currently held (which persist
+      between calls when persistent buffers are enabled), and the host-side
+      neighbor bookkeeping.
+    */
+    std::size_t memoryUsage() const
+    {
+        std::size_t bytes =
+            _export_steering.span() * sizeof( ExportIndexType );
+        if ( _buffers )
+            bytes += _buffers->send.span() + _buffers->recv.span();
+        bytes += _neighbors.capacity() * sizeof( int ) +
+                 ( _num_export.capacity() + _num_import.capacity() ) *
+                     sizeof( std::size_t );
+        return bytes;
+    }
+
+    /*!
+      \brief Get whether the MPI library advertises that it can operate
+      directly on device-resident buffers (i.e. it is GPU-aware).
+
+      Only meaningful for memory spaces that are not host accessible. Note
+      that not all GPU-aware MPI libraries advertise the capability - use
+      enableDeviceDirect() to assert it explicitly in that case.
+    */
+    static bool gpuAwareMpiSupported()
+    {
+        return Impl::gpuAwareMpiSupported();
+    }
+
+    /*!
+      \brief Enable passing device-resident communication buffers directly
+      to MPI.
+
+      This is the default when the plan's memory space is host accessible
+      or when gpuAwareMpiSupported() reports that the MPI library is
+      GPU-aware. Call this to assert the capability explicitly for
+      GPU-aware MPI libraries that do not advertise it.
+    */
+    void enableDeviceDirect() { _device_direct = true; }
+
+    /*!
+      \brief Disable device-direct MPI. Exchanges that apply this plan stage
+      the communication buffers through host memory.
+    */
+    void disableDeviceDirect() { _device_direct = false; }
+
+    /*!
+      \brief Get whether communication buffers are passed directly to MPI
+      or staged through host memory.
+    */
+    bool deviceDirectEnabled() const { return _device_direct; }
+
+    /*!
+      \brief Get the pinned host buffer pool used to stage exchanges when
+      device-direct MPI is disabled.
+
+      The pool is shared between copies of the plan so repeated exchanges
+      reuse the same pinned pages instead of re-pinning on every call.
+    */
+    PinnedBufferPool& pinnedPool() const { return *_pinned_pool; }
+
+    /*!
+      \brief Enable the MPI progression thread.
+
+      Many MPI stacks only advance non-blocking transfers inside MPI calls,
+      so the communication started by an asynchronous exchange does not
+      actually overlap with computation unless something polls the library.
+      When enabled, a dedicated thread polls the plan's communicator with
+      MPI_Iprobe while asynchronous exchanges created from this plan are in
+      flight, driving the progress engine without any help from the
+      application. The thread is started when the first in-flight exchange
+      arms it through progressGuard() and joined when the last one
+      completes - no thread exists while no exchange is pending.
+
+      \note Requires the MPI library to be initialized with
+      MPI_THREAD_MULTIPLE. Throws if a lower thread support level was
+      provided.
+    */
+    void enableProgressThread()
+    {
+        int provided;
+        MPI_Query_thread( &provided );
+        if ( provided < MPI_THREAD_MULTIPLE )
+            throw std::runtime_error(
+                "MPI progression thread requires MPI_THREAD_MULTIPLE" );
+        _progress->enabled = true;
+    }
+
+    /*!
+      \brief Disable the MPI progression thread (the default). Asynchronous
+      exchanges only progress inside MPI calls made by the application.
+    */
+    void disableProgressThread() { _progress->enabled = false; }
+
+    /*!
+      \brief Get whether asynchronous exchanges are progressed by a
+      dedicated thread.
+    */
+    bool progressThreadEnabled() const { return _progress->enabled; }
+
+    /*!
+      \brief Arm the progression thread for the lifetime of the returned
+      handle.
+
+      Asynchronous exchange requests hold the handle until their
+      communication completes. The thread is started when the number of
+      outstanding handles goes from zero to one and joined when it returns
+      to zero. Returns an empty handle when the progression thread is
+      disabled.
+    */
+    std::shared_ptr<void> progressGuard() const
+    {
+        if ( !_progress->enabled )
+            return nullptr;
+
+        auto state = _progress;
+        {
+            std::lock_guard<std::mutex> lock( state->mutex );
+            if ( 0 == state->num_active++ )
+            {
+                // First outstanding exchange - start the polling thread.
+                // Any MPI call drives the progress engine and a probe for
+                // an arbitrary message consumes nothing. The thread gets
+                // its own stop token so a guard released while another
+                // thread concurrently arms a fresh poller stops this
+                // thread and only this thread.
+                auto stop = std::make_shared<std::atomic<bool>>( false );
+                state->stop = stop;
+                MPI_Comm comm_in = comm();
+                state->thread = std::thread(
+                    [stop, comm_in]() {
+                        while ( !( *stop ) )
+                        {
+                            int flag;
+                            MPI_Iprobe( MPI_ANY_SOURCE, MPI_ANY_TAG, comm_in,
+                                        &flag, MPI_STATUS_IGNORE );
+                            std::this_thread::sleep_for(
+                                std::chrono::microseconds( 10 ) );
+                        }
+                    } );
+            }
+        }
+
+        // The handle disarms the thread on destruction. It keeps the
+        // progress state alive so destruction order relative to the plan
+        // does not matter.
+        return std::shared_ptr<void>(
+            nullptr, [state]( void* ) {
+                std::thread poller;
+                {
+                    std::lock_guard<std::mutex> lock( state->mutex );
+                    if ( 0 == --state->num_active )
+                    {
+                        *state->stop = true;
+                        poller = std::move( state->thread );
+                    }
+                }
+                // Join outside the lock - the thread does not take it but
+                // holding a lock across a join is asking for trouble.
+                if ( poller.joinable() )
+                    poller.join();
+            } );
+    }
+
+    /*!
+      \brief Enable the MPI neighbor collective backend.
+
+      Creates a distributed graph communicator over the current neighbor
+      topology of this plan. When enabled, exchanges that apply this plan
+      (e.g. in migrate, gather, and scatter) use MPI_Neighbor_alltoallv over
+      the graph communicator instead of point-to-point send/receive loops,
+      allowing the MPI library to use topology-optimized communication
+      patterns. When disabled (the default) the point-to-point path is used.
+
+      \note Must be called after the plan is created as the graph
+      communicator is built from the plan's neighbor list. This is a
+      collective operation over the plan's communicator.
+    */
+    void enableNeighborCollectives()
+    {
+        // Create the graph communicator with this plan's neighbors as both
+        // sources and destinations. Reordering is disabled so the neighbor
+        // ordering of the graph communicator matches the neighbor ordering
+        // of the plan.
+        MPI_Comm comm_in = comm();
+        const std::vector<int>& neighbors = _neighbors;
+        _graph_comm_ptr.reset(
+            [comm_in, &neighbors]() {
+                auto p = std::make_unique<MPI_Comm>();
+                MPI_Dist_graph_create_adjacent(
+                    comm_in, neighbors.size(), neighbors.data(),
+                    MPI_UNWEIGHTED, neighbors.size(), neighbors.data(),
+                    MPI_UNWEIGHTED, MPI_INFO_NULL, 0, p.get() );
+                return p.release();
+            }(),
+            []( MPI_Comm* p ) {
+                MPI_Comm_free( p );
+                delete p;
+            } );
+    }
+
+    /*!
+      \brief Disable the MPI neighbor collective backend and free the graph
+      communicator.
+    */
+    void disableNeighborCollectives() { _graph_comm_ptr.reset(); }
+
+    /*!
+      \brief Get whether the MPI neighbor collective backend is enabled.
+    */
+    bool neighborCollectivesEnabled() const
+    {
+        return static_cast<bool>( _graph_comm_ptr );
+    }
+
+    /*!
+      \brief Get the distributed graph communicator. Only valid if the
+      neighbor collective backend is enabled.
+    */
+    MPI_Comm graphComm() const { return *_graph_comm_ptr; }
+
+    /*!
+      \brief Enable the one-sided MPI (RMA) exchange backend.
+
+      Exchanges with each neighbor the location of this rank's data in that
+      neighbor's receive buffer so that exchanges which apply this plan
+      (e.g. the halo gather) can expose their receive buffer as an MPI
+      window and let neighbors MPI_Put packed data directly into place. For
+      communication patterns that are static over many steps this avoids
+      the per-message matching and rendezvous overhead of the two-sided
+      path. Persistent buffers are also enabled so the window over the
+      receive buffer can be retained from call to call while the buffer
+      does not change.
+
+      \note Must be called after the plan is created as the remote offsets
+      are derived from the plan's import counts. This is a collective
+      operation over the plan's communicator.
+    */
+    void enableRmaExchange()
+    {
+        // Get the MPI rank we are currently on.
+        int my_rank = -1;
+        MPI_Comm_rank( comm(), &my_rank );
+
+        // Pick an mpi tag for communication. This object has it's own
+        // communication space so any mpi tag will do.
+        const int mpi_tag = 3344;
+
+        // Compute the offset of each neighbor's segment in our receive
+        // buffer.
+        int num_n = _neighbors.size();
+        std::vector<std::size_t> recv_begin( num_n, 0 );
+        for ( int n = 1; n < num_n; ++n )
+            recv_begin[n] = recv_begin[n - 1] + _num_import[n - 1];
+
+        // Tell each neighbor where its data lands in our receive buffer
+        // and learn where our data lands in theirs.
+        _rma->put_offsets.assign( num_n, 0 );
+        std::vector<MPI_Request> requests;
+        requests.reserve( num_n );
+        for ( int n = 0; n < num_n; ++n )
+            if ( my_rank != _neighbors[n] )
+            {
+                requests.push_back( MPI_Request() );
+                MPI_Irecv( &_rma->put_offsets[n], 1, MPI_UNSIGNED_LONG,
+                           _neighbors[n], mpi_tag, comm(),
+                           &( requests.back() ) );
+            }
+            else
+                _rma->put_offsets[n] = recv_begin[n];
+        for ( int n = 0; n < num_n; ++n )
+            if ( my_rank != _neighbors[n] )
+                MPI_Send( &recv_begin[n], 1, MPI_UNSIGNED_LONG, _neighbors[n],
+                          mpi_tag, comm() );
+        std::vector<MPI_Status> status( requests.size() );
+        const int ec =
+            MPI_Waitall( requests.size(), requests.data(), status.data() );
+        if ( MPI_SUCCESS != ec )
+            throw std::logic_error( "Failed MPI Communication" );
+
+        // Retain the receive buffer between calls so the window over it
+        // can be reused while the buffer does not change.
+        enablePersistentBuffers();
+
+        _rma->enabled = true;
+
+        // Barrier before continuing to ensure synchronization.
+        MPI_Barrier( comm() );
+    }
+
+    /*!
+      \brief Disable the one-sided MPI (RMA) exchange backend and free the
+      window if one is active. This is a collective operation over the
+      plan's communicator if a window is active.
+    */
+    void disableRmaExchange()
+    {
+        if ( _rma->window_active )
+        {
+            MPI_Win_free( &_rma->window );
+            _rma->window_active = false;
+        }
+        _rma->enabled = false;
+        _rma->put_offsets.clear();
+    }
+
+    /*!
+      \brief Get whether the one-sided MPI exchange backend is enabled.
+    */
+    bool rmaExchangeEnabled() const { return _rma->enabled; }
+
+    /*!
+      \brief Get the element offset of this rank's data in the given
+      neighbor's receive buffer. Only valid if the RMA exchange backend is
+      enabled.
+
+      \param neighbor The local id of the neighbor.
+    */
+    std::size_t rmaPutOffset( const int neighbor ) const
+    {
+        return _rma->put_offsets[neighbor];
+    }
+
+    /*!
+      \brief Get an MPI window over the given receive buffer, creating or
+      recreating the window if the buffer changed since the last call. Only
+      valid if the RMA exchange backend is enabled. This is a collective
+      operation over the plan's communicator.
+
+      \param base The beginning of the receive buffer.
+
+      \param num_bytes The size of the receive buffer in bytes.
+    */
+    MPI_Win rmaWindow( void* base, const std::size_t num_bytes ) const
+    {
+        if ( !_rma->window_active || _rma->base != base ||
+             _rma->bytes != num_bytes )
+        {
+            if ( _rma->window_active )
+                MPI_Win_free( &_rma->window );
+            MPI_Win_create( base, num_bytes, 1, MPI_INFO_NULL, comm(),
+                            &_rma->window );
+            _rma->window_active = true;
+            _rma->base = base;
+            _rma->bytes = num_bytes;
+        }
+        return _rma->window;
+    }
+
+    /*!
+      \brief Enable the node-aware exchange backend.
+
+      Splits a shared-memory node communicator from the plan's communicator
+      and records which neighbors live on the same node. Exchanges that
+      apply this plan (e.g. migrate) can then route the intra-node
+      transfers through direct shared-memory copies and reserve the network
+      path for the off-node neighbors.
+
+      \note Must be called after the plan is created as the on-node
+      neighbors are derived from the plan's neighbor list, and must be
+      re-enabled if the plan is recreated. This is a collective operation
+      over the plan's communicator.
+    */
+    void enableNodeAwareExchange()
+    {
+        // Get the MPI rank we are currently on.
+        int my_rank = -1;
+        MPI_Comm_rank( comm(), &my_rank );
+
+        // Split the shared-memory node communicator.
+        if ( !_node->comm_active )
+        {
+            MPI_Comm_split_type( comm(), MPI_COMM_TYPE_SHARED, 0,
+                                 MPI_INFO_NULL, &_node->comm );
+            _node->comm_active = true;
+        }
+
+        // Gather the plan ranks of the node.
+        int node_size = -1;
+        MPI_Comm_size( _node->comm, &node_size );
+        std::vector<int> node_plan_ranks( node_size );
+        MPI_Allgather( &my_rank, 1, MPI_INT, node_plan_ranks.data(), 1,
+                       MPI_INT, _node->comm );
+
+        // Record the node rank of each neighbor that shares the node.
+        int num_n = _neighbors.size();
+        _node->neighbor_node_rank.assign( num_n, -1 );
+        for ( int n = 0; n < num_n; ++n )
+            for ( int r = 0; r < node_size; ++r )
+                if ( node_plan_ranks[r] == _neighbors[n] )
+                    _node->neighbor_node_rank[n] = r;
+
+        _node->enabled = true;
+    }
+
+    /*!
+      \brief Disable the node-aware exchange backend and free the node
+      communicator if one is active.
+    */
+    void disableNodeAwareExchange()
+    {
+        if ( _node->comm_active )
+        {
+            MPI_Comm_free( &_node->comm );
+            _node->comm_active = false;
+        }
+        _node->enabled = false;
+        _node->neighbor_node_rank.clear();
+    }
+
+    /*!
+      \brief Get whether the node-aware exchange backend is enabled.
+    */
+    bool nodeAwareExchangeEnabled() const { return _node->enabled; }
+
+    /*!
+      \brief Get whether the given neighbor is on the same node as this
+      rank. Only valid if the node-aware exchange backend is enabled.
+
+      \param neighbor The local id of the neighbor.
+    */
+    bool neighborIsOnNode( const int neighbor ) const
+    {
+        return _node->enabled &&
+               _node->neighbor_node_rank[neighbor] >= 0;
+    }
+
+    /*!
+      \brief Get the rank of the given neighbor in the node communicator,
+      or -1 if the neighbor is off-node. Only valid if the node-aware
+      exchange backend is enabled.
+
+      \param neighbor The local id of the neighbor.
+    */
+    int neighborNodeRank( const int neighbor ) const
+    {
+        return _node->neighbor_node_rank[neighbor];
+    }
+
+    /*!
+      \brief Get the shared-memory node communicator. Only valid if the
+      node-aware exchange backend is enabled.
+    */
+    MPI_Comm nodeComm() const { return _node->comm; }
+
+    /*!
+      \brief Enable persistent communication buffers.
+
+      When enabled, the send and receive buffers used to apply this plan
+      (e.g. in migrate, gather, and scatter) are retained on this object
+      between calls and only reallocated when a call needs more space than a
+      previous call did. Steady-state exchanges with a fixed particle data
+      type then perform no device allocation. When disabled (the default)
+      buffers are allocated fresh on every call as before.
+
+      The buffers are shared between copies of this plan in the same manner
+      as the MPI communicator.
+    */
+    void enablePersistentBuffers() { _buffers->persistent = true; }
+
+    /*!
+      \brief Disable persistent communication buffers and release any
+      buffer memory currently held by this plan.
+    */
+    void disablePersistentBuffers()
+    {
+        _buffers->persistent = false;
+        _buffers->send = Kokkos::View<char*, memory_space>();
+        _buffers->recv = Kokkos::View<char*, memory_space>();
+    }
+
+    /*!
+      \brief Get whether persistent communication buffers are enabled.
+    */
+    bool persistentBuffersEnabled() const { return _buffers->persistent; }
+
+    /*!
+      \brief Get the capacity of the send buffer in bytes.
+    */
+    std::size_t sendBufferCapacity() const
+    {
+        return _buffers->send.extent( 0 );
+    }
+
+    /*!
+      \brief Get the capacity of the receive buffer in bytes.
+    */
+    std::size_t receiveBufferCapacity() const
+    {
+        return _buffers->recv.extent( 0 );
+    }
+
+    /*!
+      \brief Get a send buffer with the given number of elements of type T.
+
+      If persistent buffers are enabled the buffer from the previous call is
+      reused, growing it only if more space is needed. Otherwise a fresh
+      buffer is allocated. The returned view is unmanaged - the underlying
+      allocation is owned by this plan and is valid until the next buffer
+      request or until the plan is destroyed.
+    */
+    template <class T>
+    Kokkos::View<T*, memory_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+    getSendBuffer( const std::size_t num_element ) const
+    {
+        assignBufferStorage( _buffers->send, num_element * sizeof( T ),
+                             _buffers->persistent, "comm_plan_send_buffer" );
+        return Kokkos::View<T*, memory_space,
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+            reinterpret_cast<T*>( _buffers->send.data() ), num_element );
+    }
+
+    /*!
+      \brief Get a rank-2 send buffer with the given number of elements of
+      type T with the given number of components each. The components of an
+      element are consecutive in memory.
+    */
+    template <class T>
+    Kokkos::View<T**, Kokkos::LayoutRight, memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+    getSendBuffer( const std::size_t num_element,
+                   const std::size_t num_comp ) const
+    {
+        assignBufferStorage( _buffers->send,
+                             num_element * num_comp * sizeof( T ),
+                             _buffers->persistent, "comm_plan_send_buffer" );
+        return Kokkos::View<T**, Kokkos::LayoutRight, memory_space,
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+            reinterpret_cast<T*>( _buffers->send.data() ), num_element,
+            num_comp );
+    }
+
+    /*!
+      \brief Get a receive buffer with the given number of elements of type
+      T. Same reuse semantics as getSendBuffer().
+    */
+    template <class T>
+    Kokkos::View<T*, memory_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+    getReceiveBuffer( const std::size_t num_element ) const
+    {
+        assignBufferStorage( _buffers->recv, num_element * sizeof( T ),
+                             _buffers->persistent, "comm_plan_recv_buffer" );
+        return Kokkos::View<T*, memory_space,
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+            reinterpret_cast<T*>( _buffers->recv.data() ), num_element );
+    }
+
+    /*!
+      \brief Get a rank-2 receive buffer with the given number of elements of
+      type T with the given number of components each. The components of an
+      element are consecutive in memory.
+    */
+    template <class T>
+    Kokkos::View<T**, Kokkos::LayoutRight, memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+    getReceiveBuffer( const std::size_t num_element,
+                      const std::size_t num_comp ) const
+    {
+        assignBufferStorage( _buffers->recv,
+                             num_element * num_comp * sizeof( T ),
+                             _buffers->persistent, "comm_plan_recv_buffer" );
+        return Kokkos::View<T**, Kokkos::LayoutRight, memory_space,
+                            Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+            reinterpret_cast<T*>( _buffers->recv.data() ), num_element,
+            num_comp );
+    }
+
     // The functions in the public block below would normally be protected but
     // we make them public to allow using private class data in CUDA kernels
     // with lambda functions.
@@ -616,9 +1321,7 @@ class CommunicationPlan
         // Count the number of sends this rank will do to other ranks. Keep
         // track of which slot we get in our neighbor's send buffer.
         auto counts_and_ids = Impl::countSendsAndCreateSteering(
-            element_export_ranks, comm_size,
-            typename Impl::CountSendsAndCreateSteeringAlgorithm<
-                execution_space>::type() );
+            element_export_ranks, comm_size );
 
         // Copy the counts to the host.
         auto neighbor_counts_host = Kokkos::create_mirror_view_and_copy(
@@ -671,7 +1374,10 @@ class CommunicationPlan
       \brief Export rank creator. Use this when you don't know who you will
       receiving from - only who you are sending to. This is less efficient
       than if we already knew who our neighbors were because we have to
-      determine the topology of the point-to-point communication first.
+      determine the topology of the point-to-point communication first. The
+      topology is discovered with a sparse non-blocking exchange so the cost
+      scales with the number of neighbors rather than the size of the
+      communicator.
 
       \param element_export_ranks The destination rank in the target
       decomposition of each locally owned element in the source
@@ -717,16 +1423,13 @@ class CommunicationPlan
         // Count the number of sends this rank will do to other ranks. Keep
         // track of which slot we get in our neighbor's send buffer.
         auto counts_and_ids = Impl::countSendsAndCreateSteering(
-            element_export_ranks, comm_size,
-            typename Impl::CountSendsAndCreateSteeringAlgorithm<
-                execution_space>::type() );
+            element_export_ranks, comm_size );
 
         // Copy the counts to the host.
         auto neighbor_counts_host = Kokkos::create_mirror_view_and_copy(
             Kokkos::HostSpace(), counts_and_ids.first );
 
-        // Extract the export ranks and number of exports and then flag the
-        // send ranks.
+        // Extract the export ranks and number of exports.
         _neighbors.clear();
         _num_export.clear();
         _total_num_export = 0;
@@ -736,7 +1439,6 @@ class CommunicationPlan
                 _neighbors.push_back( r );
                 _num_export.push_back( neighbor_counts_host( r ) );
                 _total_num_export += neighbor_counts_host( r );
-                neighbor_counts_host( r ) = 1;
             }
 
         // Get the number of export ranks and initially allocate the import
@@ -757,34 +1459,61 @@ class CommunicationPlan
                 break;
             }
 
-        // Determine how many total import ranks each neighbor has.
-        int num_import_rank = -1;
-        std::vector<int> recv_counts( comm_size, 1 );
-        MPI_Reduce_scatter( neighbor_counts_host.data(), &num_import_rank,
-                            recv_counts.data(), MPI_INT, MPI_SUM, comm() );
-        if ( self_send )
-            --num_import_rank;
-
-        // Post the expected number of receives and indicate we might get them
-        // from any rank.
-        std::vector<std::size_t> import_sizes( num_import_rank );
-        std::vector<MPI_Request> requests( num_import_rank );
-        for ( int n = 0; n < num_import_rank; ++n )
-            MPI_Irecv( &import_sizes[n], 1, MPI_UNSIGNED_LONG, MPI_ANY_SOURCE,
-                       mpi_tag, comm(), &requests[n] );
-
-        // Do blocking sends. Dont do any self sends.
+        // Discover the ranks we will import from with the NBX dynamic
+        // sparse data exchange of Hoefler et al. Each rank synchronously
+        // sends its export count to the ranks it exports to and probes for
+        // incoming counts from any rank. Once all of its own sends have
+        // been matched it enters a non-blocking barrier and keeps probing
+        // until the barrier completes, at which point every count message
+        // in the system has been received. The cost scales with the number
+        // of neighbors instead of the size of the communicator. Dont do
+        // any self sends.
         int self_offset = ( self_send ) ? 1 : 0;
+        std::vector<MPI_Request> requests( num_export_rank - self_offset );
         for ( int n = self_offset; n < num_export_rank; ++n )
-            MPI_Send( &_num_export[n], 1, MPI_UNSIGNED_LONG, _neighbors[n],
-                      mpi_tag, comm() );
+            MPI_Issend( &_num_export[n], 1, MPI_UNSIGNED_LONG, _neighbors[n],
+                        mpi_tag, comm(), &requests[n - self_offset] );
+        std::vector<int> import_ranks;
+        std::vector<std::size_t> import_sizes;
+        MPI_Request barrier_request;
+        bool barrier_active = false;
+        int exchange_done = 0;
+        while ( !exchange_done )
+        {
+            // Receive an incoming count message if one is available.
+            int message_pending = 0;
+            MPI_Status probe_status;
+            MPI_Iprobe( MPI_ANY_SOURCE, mpi_tag, comm(), &message_pending,
+                        &probe_status );
+            if ( message_pending )
+            {
+                std::size_t count = 0;
+                MPI_Recv( &count, 1, MPI_UNSIGNED_LONG,
+                          probe_status.MPI_SOURCE, mpi_tag, comm(),
+                          MPI_STATUS_IGNORE );
+                import_ranks.push_back( probe_status.MPI_SOURCE );
+                import_sizes.push_back( count );
+            }
 
-        // Wait on non-blocking receives.
-        std::vector<MPI_Status> status( requests.size() );
-        const int ec =
-            MPI_Waitall( requests.size(), requests.data(), status.data() );
-        if ( MPI_SUCCESS != ec )
-            throw std::logic_error( "Failed MPI Communication" );
+            // Once our own synchronous sends have all been matched enter
+            // the non-blocking barrier. The exchange is complete when the
+            // barrier is.
+            if ( barrier_active )
+                MPI_Test( &barrier_request, &exchange_done,
+                          MPI_STATUS_IGNORE );
+            else
+            {
+                int sends_matched = 0;
+                MPI_Testall( requests.size(), requests.data(), &sends_matched,
+                             MPI_STATUSES_IGNORE );
+                if ( sends_matched )
+                {
+                    MPI_Ibarrier( comm(), &barrier_request );
+                    barrier_active = true;
+                }
+            }
+        }
+        int num_import_rank = import_ranks.size();
 
         // Compute the total number of imports.
         _total_num_import =
@@ -796,7 +1525,7 @@ class CommunicationPlan
         for ( int i = 0; i < num_import_rank; ++i )
         {
             // Get the message source.
-            const auto source = status[i].MPI_SOURCE;
+            const auto source = import_ranks[i];
 
             // See if the neighbor we received stuff from was someone we also
             // sent stuff to.
@@ -829,6 +1558,165 @@ class CommunicationPlan
         return counts_and_ids.second;
     }
 
+    /*!
+      \brief Incrementally update the plan for a small set of changed export
+      ranks.
+
+      Use this instead of a full rebuild when only a small fraction of the
+      elements changed destination rank since the plan was created. The
+      counts and the steering vector are patched for the changed elements
+      only and the neighbor topology and MPI neighbor discovery are reused,
+      so the cost scales with the size of the delta plus a single steering
+      upload rather than with a full counting pass.
+
+      \param element_ids The local ids of the elements whose export rank
+      changed. The input is expected to be a Kokkos view or Cabana slice in
+      the same memory space as the communication plan.
+
+      \param element_export_ranks The new export rank of each element in
+      element_ids. Each rank must be an existing neighbor of this plan (or
+      -1 to stop exporting the element) - an incremental update cannot add
+      new neighbors. Must be the same length as element_ids.
+
+      \note Only valid for plans created with unique element ids (e.g. a
+      Distributor) where each element appears at most once in the steering
+      vector.
+
+      \note This is a collective operation - the import sizes are
+      re-exchanged with the existing neighbors.
+    */
+    template <class IdViewType, class RankViewType>
+    void updateFromChangedExports( const IdViewType& element_ids,
+                                   const RankViewType& element_export_ranks )
+    {
+        if ( element_ids.size() != element_export_ranks.size() )
+            throw std::runtime_error( "Export ids and ranks different sizes!" );
+
+        int num_n = _neighbors.size();
+
+        // Get the MPI rank we are currently on.
+        int my_rank = -1;
+        MPI_Comm_rank( comm(), &my_rank );
+
+        // Mirror the delta and the current steering vector on the host.
+        auto ids_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), element_ids );
+        auto ranks_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), element_export_ranks );
+        auto steering_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), _export_steering );
+
+        // Reconstruct the per-neighbor chunks of the steering vector and
+        // the current destination of each element. Elements that are not
+        // exported have a destination of -1.
+        std::vector<std::vector<std::size_t>> chunks( num_n );
+        std::vector<int> element_neighbor( _num_export_element, -1 );
+        std::vector<std::size_t> element_chunk_id( _num_export_element, 0 );
+        std::size_t offset = 0;
+        for ( int n = 0; n < num_n; ++n )
+        {
+            chunks[n].resize( _num_export[n] );
+            for ( std::size_t j = 0; j < _num_export[n]; ++j )
+            {
+                auto e = steering_host( offset + j );
+                chunks[n][j] = e;
+                element_neighbor[e] = n;
+                element_chunk_id[e] = j;
+            }
+            offset += _num_export[n];
+        }
+
+        // Apply the delta. A removal swaps the last element of the chunk
+        // into the hole so the chunks stay dense.
+        for ( std::size_t i = 0; i < ids_host.size(); ++i )
+        {
+            std::size_t e = ids_host( i );
+            if ( e >= _num_export_element )
+                throw std::runtime_error( "Export id out of bounds!" );
+
+            // Find the local neighbor id of the new export rank.
+            int new_r = ranks_host( i );
+            int new_n = -1;
+            if ( new_r >= 0 )
+            {
+                auto found =
+                    std::find( _neighbors.begin(), _neighbors.end(), new_r );
+                if ( found == std::end( _neighbors ) )
+                    throw std::runtime_error(
+                        "Incremental update cannot add new neighbors!" );
+                new_n = std::distance( _neighbors.begin(), found );
+            }
+
+            // Nothing to do if the destination did not change.
+            int old_n = element_neighbor[e];
+            if ( old_n == new_n )
+                continue;
+
+            // Remove the element from its old chunk.
+            if ( old_n >= 0 )
+            {
+                auto& chunk = chunks[old_n];
+                auto moved = chunk.back();
+                chunk[element_chunk_id[e]] = moved;
+                element_chunk_id[moved] = element_chunk_id[e];
+                chunk.pop_back();
+            }
+
+            // Append the element to its new chunk.
+            if ( new_n >= 0 )
+            {
+                element_chunk_id[e] = chunks[new_n].size();
+                chunks[new_n].push_back( e );
+            }
+            element_neighbor[e] = new_n;
+        }
+
+        // Update the export counts.
+        for ( int n = 0; n < num_n; ++n )
+            _num_export[n] = chunks[n].size();
+        _total_num_export =
+            std::accumulate( _num_export.begin(), _num_export.end(), 0 );
+
+        // Re-exchange the counts with the existing neighbors.
+        const int mpi_tag = 1221;
+        std::vector<MPI_Request> requests;
+        requests.reserve( num_n );
+        for ( int n = 0; n < num_n; ++n )
+            if ( my_rank != _neighbors[n] )
+            {
+                requests.push_back( MPI_Request() );
+                MPI_Irecv( &_num_import[n], 1, MPI_UNSIGNED_LONG, _neighbors[n],
+                           mpi_tag, comm(), &( requests.back() ) );
+            }
+            else
+                _num_import[n] = _num_export[n];
+        for ( int n = 0; n < num_n; ++n )
+            if ( my_rank != _neighbors[n] )
+                MPI_Send( &_num_export[n], 1, MPI_UNSIGNED_LONG, _neighbors[n],
+                          mpi_tag, comm() );
+        std::vector<MPI_Status> status( requests.size() );
+        const int ec =
+            MPI_Waitall( requests.size(), requests.data(), status.data() );
+        if ( MPI_SUCCESS != ec )
+            throw std::logic_error( "Failed MPI Communication" );
+        _total_num_import =
+            std::accumulate( _num_import.begin(), _num_import.end(), 0 );
+
+        // Upload the patched steering vector.
+        Kokkos::View<ExportIndexType*, Kokkos::HostSpace> new_steering_host(
+            Kokkos::ViewAllocateWithoutInitializing( "export_steering" ),
+            _total_num_export );
+        offset = 0;
+        for ( int n = 0; n < num_n; ++n )
+            for ( std::size_t j = 0; j < _num_export[n]; ++j )
+                new_steering_host( offset++ ) = chunks[n][j];
+        _export_steering = Kokkos::create_mirror_view_and_copy(
+            memory_space(), new_steering_host );
+
+        // Barrier before continuing to ensure synchronization.
+        MPI_Barrier( comm() );
+    }
+
     /*!
       \brief Create the export steering vector.
 
@@ -891,6 +1779,14 @@ class CommunicationPlan
              ( element_export_ids.size() != element_export_ranks.size() ) )
             throw std::runtime_error( "Export ids and ranks different sizes!" );
 
+        // The steering vector stores local element ids so every id must be
+        // representable in the steering index type.
+        if ( _num_export_element >
+             static_cast<std::size_t>(
+                 std::numeric_limits<ExportIndexType>::max() ) )
+            throw std::runtime_error(
+                "Export index type too narrow for the local element count!" );
+
         // Get the size of this communicator.
         int comm_size = -1;
         MPI_Comm_size( *_comm_ptr, &comm_size );
@@ -913,7 +1809,7 @@ class CommunicationPlan
         // Create the export steering vector for writing local elements into
         // the send buffer. Note we create a local, shallow copy - this is a
         // CUDA workaround for handling class private data.
-        _export_steering = Kokkos::View<std::size_t*, memory_space>(
+        _export_steering = Kokkos::View<ExportIndexType*, memory_space>(
             Kokkos::ViewAllocateWithoutInitializing( "export_steering" ),
             _total_num_export );
         auto steer_vec = _export_steering;
@@ -924,21 +1820,107 @@ class CommunicationPlan
                 if ( element_export_ranks( i ) >= 0 )
                     steer_vec( rank_offsets( element_export_ranks( i ) ) +
                                neighbor_ids( i ) ) =
-                        ( use_iota ) ? i : element_export_ids( i );
+                        static_cast<ExportIndexType>(
+                            ( use_iota ) ? i : element_export_ids( i ) );
             } );
         Kokkos::fence();
     }
     //! \endcond
 
   private:
+    // Communication buffer storage. The raw byte buffers are aliased with
+    // the data type of a given communication call through the unmanaged
+    // views returned by the buffer accessors.
+    struct BufferStorage
+    {
+        Kokkos::View<char*, memory_space> send;
+        Kokkos::View<char*, memory_space> recv;
+        bool persistent = false;
+    };
+
+    // Ensure a byte buffer has storage for the given number of bytes. In
+    // persistent mode the buffer only ever grows. Otherwise a fresh
+    // exact-size allocation is made every time, matching the original
+    // allocate-per-call behavior.
+    static void assignBufferStorage( Kokkos::View<char*, memory_space>& buffer,
+                                     const std::size_t num_bytes,
+                                     const bool persistent,
+                                     const std::string& label )
+    {
+        if ( !persistent || buffer.extent( 0 ) < num_bytes )
+            buffer = Kokkos::View<char*, memory_space>(
+                Kokkos::ViewAllocateWithoutInitializing( label ), num_bytes );
+    }
+
+    // One-sided exchange state. The window over the receive buffer is
+    // cached between calls while the buffer does not change. The state is
+    // shared between copies of this plan in the same manner as the MPI
+    // communicator.
+    struct RmaState
+    {
+        bool enabled = false;
+        bool window_active = false;
+        void* base = nullptr;
+        std::size_t bytes = 0;
+        MPI_Win window;
+        std::vector<std::size_t> put_offsets;
+        ~RmaState()
+        {
+            if ( window_active )
+                MPI_Win_free( &window );
+        }
+    };
+
+    // Node-aware exchange state. The shared-memory node communicator and
+    // the node rank of each neighbor (or -1 for off-node neighbors) are
+    // computed once when the backend is enabled. The state is shared
+    // between copies of this plan in the same manner as the MPI
+    // communicator.
+    struct NodeState
+    {
+        bool enabled = false;
+        bool comm_active = false;
+        MPI_Comm comm;
+        std::vector<int> neighbor_node_rank;
+        ~NodeState()
+        {
+            if ( comm_active )
+                MPI_Comm_free( &comm );
+        }
+    };
+
+    // Progression thread state. The thread only runs while asynchronous
+    // exchanges are in flight and is reference counted through the guards
+    // returned by progressGuard(). The state is shared between copies of
+    // this plan in the same manner as the MPI communicator.
+    struct ProgressState
+    {
+        bool enabled = false;
+        std::mutex mutex;
+        int num_active = 0;
+        // Stop token of the current poller. Each spawned thread owns its
+        // token exclusively - a new arm installs a fresh token instead of
+        // reusing this one, so releasing the last guard can never be
+        // un-stopped by a concurrent arm racing the old thread's exit.
+        std::shared_ptr<std::atomic<bool>> stop;
+        std::thread thread;
+    };
+
     std::shared_ptr<MPI_Comm> _comm_ptr;
+    std::shared_ptr<MPI_Comm> _graph_comm_ptr;
+    std::shared_ptr<BufferStorage> _buffers;
+    std::shared_ptr<RmaState> _rma;
+    std::shared_ptr<NodeState> _node;
+    std::shared_ptr<ProgressState> _progress;
+    std::shared_ptr<PinnedBufferPool> _pinned_pool;
+    bool _device_direct;
     std::vector<int> _neighbors;
     std::size_t _total_num_export;
     std::size_t _total_num_import;
     std::vector<std::size_t> _num_export;
     std::vector<std::size_t> _num_import;
     std::size_t _num_export_element;
-    Kokkos::View<std::size_t*, device_type> _export_steering;
+    Kokkos::View<ExportIndexType*, device_type> _export_steering;
 };
 
 //---------------------------------------------------------------------------//
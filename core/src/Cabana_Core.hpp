@@ -20,22 +20,43 @@
 
 #include <Cabana_AoSoA.hpp>
 #include <Cabana_DeepCopy.hpp>
+#include <Cabana_DynamicAoSoA.hpp>
+#include <Cabana_Ensemble.hpp>
+#include <Cabana_Insert.hpp>
+#include <Cabana_KernelGraph.hpp>
 #include <Cabana_LinkedCellList.hpp>
 #include <Cabana_MemberTypes.hpp>
+#include <Cabana_MemoryPool.hpp>
+#include <Cabana_MemoryUsage.hpp>
 #include <Cabana_NeighborList.hpp>
+#include <Cabana_NeighborListTuner.hpp>
 #include <Cabana_Parallel.hpp>
 #include <Cabana_ParameterPack.hpp>
+#include <Cabana_Profiling.hpp>
+#include <Cabana_Random.hpp>
+#include <Cabana_RemoveIf.hpp>
+#include <Cabana_ScatterSlice.hpp>
 #include <Cabana_Slice.hpp>
+#include <Cabana_SliceSnapshot.hpp>
 #include <Cabana_SoA.hpp>
 #include <Cabana_Sort.hpp>
+#include <Cabana_SplitAoSoA.hpp>
+#include <Cabana_TripletList.hpp>
+#include <Cabana_Tuner.hpp>
 #include <Cabana_Tuple.hpp>
 #include <Cabana_Types.hpp>
+#include <Cabana_VectorLengthDispatch.hpp>
 #include <Cabana_VerletList.hpp>
 #include <Cabana_Version.hpp>
 
 #ifdef Cabana_ENABLE_MPI
+#include <Cabana_Checkpoint.hpp>
 #include <Cabana_Distributor.hpp>
 #include <Cabana_Halo.hpp>
+#include <Cabana_PinnedBufferPool.hpp>
+#ifdef Cabana_ENABLE_HDF5
+#include <Cabana_HDF5ParticleOutput.hpp>
+#endif
 #endif
 
 #ifdef Cabana_ENABLE_ARBORX
@@ -157,8 +157,11 @@ create_mirror_view_and_copy(
 template <class DstAoSoA, class SrcAoSoA>
 inline void
 deep_copy( DstAoSoA& dst, const SrcAoSoA& src,
-           typename std::enable_if<( is_aosoa<DstAoSoA>::value &&
-                                     is_aosoa<SrcAoSoA>::value )>::type* = 0 )
+           typename std::enable_if<(
+               is_aosoa<DstAoSoA>::value && is_aosoa<SrcAoSoA>::value &&
+               std::is_same<typename DstAoSoA::member_types,
+                            typename SrcAoSoA::member_types>::value )>::type* =
+               0 )
 {
     using dst_type = DstAoSoA;
     using src_type = SrcAoSoA;
@@ -167,12 +170,6 @@ deep_copy( DstAoSoA& dst, const SrcAoSoA& src,
     using dst_soa_type = typename dst_type::soa_type;
     using src_soa_type = typename src_type::soa_type;
 
-    // Check that the data types are the same.
-    static_assert(
-        std::is_same<typename dst_type::member_types,
-                     typename src_type::member_types>::value,
-        "Attempted to deep copy AoSoA objects of different member types" );
-
     // Check for the same number of values.
     if ( dst.size() != src.size() )
     {
@@ -230,6 +227,211 @@ deep_copy( DstAoSoA& dst, const SrcAoSoA& src,
     }
 }
 
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+
+// Convert and copy a single member between AoSoAs of the same shape
+// residing in the same memory space.
+template <std::size_t M, class DstAoSoA, class SrcAoSoA>
+void deepCopyConvertMember( DstAoSoA& dst, const SrcAoSoA& src )
+{
+    auto dst_slice = slice<M>( dst );
+    auto src_slice = slice<M>( src );
+    using dst_slice_type = decltype( dst_slice );
+    using src_slice_type = decltype( src_slice );
+
+    // Get the number of components in the member elements.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < dst_slice.rank(); ++d )
+        num_comp *= dst_slice.extent( d );
+
+    // Copy element-by-element with conversion on assignment.
+    auto dst_data = dst_slice.data();
+    auto src_data = src_slice.data();
+    auto convert_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto dst_offset =
+            dst_slice_type::index_type::s( i ) * dst_slice.stride( 0 ) +
+            dst_slice_type::index_type::a( i );
+        auto src_offset =
+            src_slice_type::index_type::s( i ) * src_slice.stride( 0 ) +
+            src_slice_type::index_type::a( i );
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            dst_data[dst_offset + dst_slice_type::vector_length * n] =
+                src_data[src_offset + src_slice_type::vector_length * n];
+    };
+    Kokkos::RangePolicy<typename DstAoSoA::execution_space> policy(
+        0, dst.size() );
+    Kokkos::parallel_for( "Cabana::deep_copy::convert_member", policy,
+                          convert_func );
+}
+
+// Convert and copy all members via member index recursion.
+template <class DstAoSoA, class SrcAoSoA>
+void deepCopyConvert( DstAoSoA& dst, const SrcAoSoA& src,
+                      std::integral_constant<std::size_t, 0> )
+{
+    deepCopyConvertMember<0>( dst, src );
+}
+
+template <std::size_t M, class DstAoSoA, class SrcAoSoA>
+void deepCopyConvert( DstAoSoA& dst, const SrcAoSoA& src,
+                      std::integral_constant<std::size_t, M> )
+{
+    deepCopyConvertMember<M>( dst, src );
+    deepCopyConvert( dst, src, std::integral_constant<std::size_t, M - 1>() );
+}
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Deep copy data between AoSoA objects with element-wise conversion.
+
+  \param dst The destination for the copied data.
+
+  \param src The source of the copied data.
+
+  This overload is selected when the member types of the two AoSoAs are not
+  identical but have the same shape member-by-member with convertible value
+  types (e.g. they differ only in precision). Each member is converted on
+  copy, so a double-precision AoSoA can be copied directly to a
+  single-precision staging AoSoA for communication or output without
+  per-member glue kernels.
+*/
+template <class DstAoSoA, class SrcAoSoA>
+inline void
+deep_copy( DstAoSoA& dst, const SrcAoSoA& src,
+           typename std::enable_if<(
+               is_aosoa<DstAoSoA>::value && is_aosoa<SrcAoSoA>::value &&
+               !std::is_same<typename DstAoSoA::member_types,
+                             typename SrcAoSoA::member_types>::value &&
+               MemberTypesAreConvertible<
+                   typename DstAoSoA::member_types,
+                   typename SrcAoSoA::member_types>::value )>::type* = 0 )
+{
+    // Check for the same number of values.
+    if ( dst.size() != src.size() )
+    {
+        throw std::runtime_error(
+            "Attempted to deep copy AoSoA objects of different sizes" );
+    }
+
+    // Stage the source in the destination space with its original member
+    // types, then convert member-by-member in the destination space.
+    auto src_copy_on_dst =
+        create_mirror_view_and_copy( typename DstAoSoA::memory_space(), src );
+    Impl::deepCopyConvert(
+        dst, src_copy_on_dst,
+        std::integral_constant<std::size_t,
+                               DstAoSoA::number_of_members - 1>() );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Asynchronously deep copy data between compatible AoSoA objects.
+
+  \param exec_space The execution space instance (e.g. stream) on which to
+  enqueue the copy.
+
+  \param dst The destination for the copied data.
+
+  \param src The source of the copied data.
+
+  Only AoSoA objects with the same set of member data types and size may be
+  copied. The copy is enqueued on the given execution space instance and
+  this function returns without fencing - the caller is responsible for
+  synchronizing with the instance before using the destination data. If the
+  objects have different layouts the data must be staged through a temporary
+  copy and only the final permutation kernel is asynchronous.
+*/
+template <class ExecutionSpace, class DstAoSoA, class SrcAoSoA>
+inline void
+deep_copy( const ExecutionSpace& exec_space, DstAoSoA& dst,
+           const SrcAoSoA& src,
+           typename std::enable_if<(
+               Kokkos::is_execution_space<ExecutionSpace>::value &&
+               is_aosoa<DstAoSoA>::value && is_aosoa<SrcAoSoA>::value )>::type* =
+               0 )
+{
+    using dst_type = DstAoSoA;
+    using src_type = SrcAoSoA;
+    using dst_memory_space = typename dst_type::memory_space;
+    using src_memory_space = typename src_type::memory_space;
+    using dst_soa_type = typename dst_type::soa_type;
+    using src_soa_type = typename src_type::soa_type;
+
+    // Check that the data types are the same.
+    static_assert(
+        std::is_same<typename dst_type::member_types,
+                     typename src_type::member_types>::value,
+        "Attempted to deep copy AoSoA objects of different member types" );
+
+    // Check for the same number of values.
+    if ( dst.size() != src.size() )
+    {
+        throw std::runtime_error(
+            "Attempted to deep copy AoSoA objects of different sizes" );
+    }
+
+    // Get the pointers to the beginning of the data blocks.
+    void* dst_data = dst.data();
+    const void* src_data = src.data();
+
+    // Return if both pointers are null.
+    if ( dst_data == nullptr && src_data == nullptr )
+    {
+        return;
+    }
+
+    // Get the number of SoA's in each object.
+    auto dst_num_soa = dst.numSoA();
+    auto src_num_soa = src.numSoA();
+
+    // Return if the AoSoA memory occupies the same space.
+    if ( ( dst_data == src_data ) && ( dst_num_soa * sizeof( dst_soa_type ) ==
+                                       src_num_soa * sizeof( src_soa_type ) ) )
+    {
+        return;
+    }
+
+    // If the inner array size is the same and both AoSoAs have the same number
+    // of values then we can do a byte-wise copy directly on the given
+    // execution space instance.
+    if ( std::is_same<dst_soa_type, src_soa_type>::value )
+    {
+        Kokkos::Impl::DeepCopy<dst_memory_space, src_memory_space,
+                               ExecutionSpace>(
+            exec_space, dst_data, src_data,
+            dst_num_soa * sizeof( dst_soa_type ) );
+    }
+
+    // Otherwise copy the data element-by-element because the data layout is
+    // different. The staging copy blocks but the permutation kernel is
+    // enqueued on the given instance.
+    else
+    {
+        // Create an AoSoA in the destination space with the same data layout
+        // as the source.
+        auto src_copy_on_dst = create_mirror_view_and_copy(
+            typename dst_type::memory_space(), src );
+
+        // Copy via tuples.
+        auto copy_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            dst.setTuple( i, src_copy_on_dst.getTuple( i ) );
+        };
+        Kokkos::RangePolicy<ExecutionSpace> exec_policy( exec_space, 0,
+                                                         dst.size() );
+        Kokkos::parallel_for( "Cabana::deep_copy_async", exec_policy,
+                              copy_func );
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Fill an AoSoA with a tuple.
@@ -269,18 +471,15 @@ inline void deep_copy( AoSoA_t& aosoa,
 template <class DstSlice, class SrcSlice>
 inline void
 deep_copy( DstSlice& dst, const SrcSlice& src,
-           typename std::enable_if<( is_slice<DstSlice>::value &&
-                                     is_slice<SrcSlice>::value )>::type* = 0 )
+           typename std::enable_if<(
+               is_slice<DstSlice>::value && is_slice<SrcSlice>::value &&
+               std::is_same<typename DstSlice::value_type,
+                            typename SrcSlice::value_type>::value )>::type* =
+               0 )
 {
     using dst_type = DstSlice;
     using src_type = SrcSlice;
 
-    // Check that the data types are the same.
-    static_assert(
-        std::is_same<typename dst_type::value_type,
-                     typename src_type::value_type>::value,
-        "Attempted to deep copy Slice objects of different value types" );
-
     // Check that the element dimensions are the same.
     static_assert( SrcSlice::view_layout::D0 == SrcSlice::view_layout::D0,
                    "Slice dimension 0 is different" );
@@ -369,6 +568,499 @@ deep_copy( DstSlice& dst, const SrcSlice& src,
     Kokkos::fence();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Deep copy data between Slice objects with element-wise conversion.
+
+  \param dst The destination for the copied data.
+
+  \param src The source of the copied data.
+
+  This overload is selected when the value types of the two slices are not
+  identical but are convertible (e.g. they differ only in precision). The
+  data is staged in the source value type and converted on the final
+  scatter into the destination slice.
+*/
+template <class DstSlice, class SrcSlice>
+inline void
+deep_copy( DstSlice& dst, const SrcSlice& src,
+           typename std::enable_if<(
+               is_slice<DstSlice>::value && is_slice<SrcSlice>::value &&
+               !std::is_same<typename DstSlice::value_type,
+                             typename SrcSlice::value_type>::value &&
+               std::is_convertible<
+                   typename SrcSlice::value_type,
+                   typename DstSlice::value_type>::value )>::type* = 0 )
+{
+    using dst_type = DstSlice;
+    using src_type = SrcSlice;
+
+    // Check for the same number of elements.
+    if ( dst.size() != src.size() )
+    {
+        throw std::runtime_error(
+            "Attempted to deep copy Slice objects of different sizes" );
+    }
+
+    // Get the number of components in each slice element.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < dst.rank(); ++d )
+        num_comp *= dst.extent( d );
+    std::size_t src_num_comp = 1;
+    for ( std::size_t d = 2; d < src.rank(); ++d )
+        src_num_comp *= src.extent( d );
+    if ( num_comp != src_num_comp )
+    {
+        throw std::runtime_error(
+            "Attempted to deep copy Slice objects of different shapes" );
+    }
+
+    // Get the pointers to the beginning of the data blocks.
+    auto dst_data = dst.data();
+    const auto src_data = src.data();
+
+    // Return if both pointers are null.
+    if ( dst_data == nullptr && src_data == nullptr )
+    {
+        return;
+    }
+
+    // Gather the slice data in a flat view in the source space and copy it
+    // to the destination space keeping the source value type.
+    Kokkos::View<typename src_type::value_type*,
+                 typename dst_type::memory_space>
+        gather_dst( Kokkos::ViewAllocateWithoutInitializing( "gather_dst" ),
+                    num_comp * dst.size() );
+    {
+        Kokkos::View<typename src_type::value_type*,
+                     typename src_type::memory_space>
+            gather_src(
+                Kokkos::ViewAllocateWithoutInitializing( "gather_src" ),
+                num_comp * src.size() );
+        auto gather_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            auto src_offset = SrcSlice::index_type::s( i ) * src.stride( 0 ) +
+                              SrcSlice::index_type::a( i );
+            for ( std::size_t n = 0; n < num_comp; ++n )
+                gather_src( i * num_comp + n ) =
+                    src_data[src_offset + SrcSlice::vector_length * n];
+        };
+        Kokkos::RangePolicy<typename src_type::execution_space> gather_policy(
+            0, src.size() );
+        Kokkos::parallel_for( "Cabana::deep_copy::gather", gather_policy,
+                              gather_func );
+        Kokkos::fence();
+        Kokkos::deep_copy( gather_dst, gather_src );
+    }
+
+    // Scatter into the destination slice, converting on assignment.
+    auto scatter_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto dst_offset = DstSlice::index_type::s( i ) * dst.stride( 0 ) +
+                          DstSlice::index_type::a( i );
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            dst_data[dst_offset + DstSlice::vector_length * n] =
+                static_cast<typename dst_type::value_type>(
+                    gather_dst( i * num_comp + n ) );
+    };
+    Kokkos::RangePolicy<typename dst_type::execution_space> scatter_policy(
+        0, dst.size() );
+    Kokkos::parallel_for( "Cabana::deep_copy::scatter", scatter_policy,
+                          scatter_func );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+
+// Deep copy one member of an AoSoA into a member of another AoSoA with the
+// same data type through the slice copy.
+template <std::size_t DstM, std::size_t SrcM, class DstAoSoA, class SrcAoSoA>
+void deepCopyMember( DstAoSoA& dst, const SrcAoSoA& src )
+{
+    auto dst_slice = slice<DstM>( dst );
+    auto src_slice = slice<SrcM>( src );
+    deep_copy( dst_slice, src_slice );
+}
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Deep copy a subset of the members between compatible AoSoA objects.
+
+  \param dst The destination for the copied data.
+
+  \param src The source of the copied data.
+
+  Only the members selected by the index list are copied - the remaining
+  members of the destination are untouched. The objects must have the same
+  member types and size but may be in different memory spaces and have
+  different vector lengths.
+*/
+template <std::size_t... M, class DstAoSoA, class SrcAoSoA>
+inline void
+deep_copy( DstAoSoA& dst, const SrcAoSoA& src, MemberIndexList<M...>,
+           typename std::enable_if<( is_aosoa<DstAoSoA>::value &&
+                                     is_aosoa<SrcAoSoA>::value )>::type* = 0 )
+{
+    static_assert( sizeof...( M ) > 0,
+                   "Member index list must not be empty" );
+    static_assert( std::is_same<typename DstAoSoA::member_types,
+                                typename SrcAoSoA::member_types>::value,
+                   "Subset deep copy requires the same member types" );
+
+    // Copy each selected member through its slice.
+    std::initializer_list<int>{
+        ( Impl::deepCopyMember<M, M>( dst, src ), 0 )... };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Asynchronously deep copy data between compatible Slice objects.
+
+  \param exec_space The execution space instance (e.g. stream) on which to
+  enqueue the copy.
+
+  \param dst The destination for the copied data.
+
+  \param src The source of the copied data.
+
+  Only Slice objects with the same set of member data types and size may be
+  copied. All kernels and transfers are enqueued on the given execution
+  space instance and this function returns without fencing - the caller is
+  responsible for synchronizing with the instance before using the
+  destination data.
+
+  Both slices must be accessible from the given execution space instance -
+  ordering every operation on one instance rules out staging through a
+  second space. For copies that cross memory spaces use the synchronous
+  overload, which runs the gather and scatter in the spaces of the
+  respective slices.
+*/
+template <class ExecutionSpace, class DstSlice, class SrcSlice>
+inline void
+deep_copy( const ExecutionSpace& exec_space, DstSlice& dst,
+           const SrcSlice& src,
+           typename std::enable_if<(
+               Kokkos::is_execution_space<ExecutionSpace>::value &&
+               is_slice<DstSlice>::value && is_slice<SrcSlice>::value )>::type* =
+               0 )
+{
+    using dst_type = DstSlice;
+    using src_type = SrcSlice;
+
+    // Check that the data types are the same.
+    static_assert(
+        std::is_same<typename dst_type::value_type,
+                     typename src_type::value_type>::value,
+        "Attempted to deep copy Slice objects of different value types" );
+
+    // The gather and scatter kernels both run on the given instance so both
+    // slices must be accessible from it.
+    static_assert(
+        is_accessible_from<typename dst_type::memory_space,
+                           ExecutionSpace>::value,
+        "Destination slice must be accessible from the given execution "
+        "space" );
+    static_assert( is_accessible_from<typename src_type::memory_space,
+                                      ExecutionSpace>::value,
+                   "Source slice must be accessible from the given execution "
+                   "space" );
+
+    // Check for the same number of elements.
+    if ( dst.size() != src.size() )
+    {
+        throw std::runtime_error(
+            "Attempted to deep copy Slice objects of different sizes" );
+    }
+
+    // Get the pointers to the beginning of the data blocks.
+    auto dst_data = dst.data();
+    const auto src_data = src.data();
+
+    // Return if both pointers are null.
+    if ( dst_data == nullptr && src_data == nullptr )
+    {
+        return;
+    }
+
+    // Return if the slice memory occupies the same space.
+    if ( ( dst_data == src_data ) && ( dst.numSoA() * dst.stride( 0 ) ==
+                                       src.numSoA() * src.stride( 0 ) ) )
+    {
+        return;
+    }
+
+    // Get the number of components in each slice element.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < dst.rank(); ++d )
+        num_comp *= dst.extent( d );
+
+    // Gather the slice data in a flat view in the source space and copy it to
+    // the destination space. All operations are ordered on the given
+    // instance.
+    Kokkos::View<typename dst_type::value_type*,
+                 typename dst_type::memory_space>
+        gather_dst( Kokkos::ViewAllocateWithoutInitializing( "gather_dst" ),
+                    num_comp * dst.size() );
+    {
+        Kokkos::View<typename src_type::value_type*,
+                     typename src_type::memory_space>
+            gather_src(
+                Kokkos::ViewAllocateWithoutInitializing( "gather_src" ),
+                num_comp * src.size() );
+        auto gather_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            auto src_offset = SrcSlice::index_type::s( i ) * src.stride( 0 ) +
+                              SrcSlice::index_type::a( i );
+            for ( std::size_t n = 0; n < num_comp; ++n )
+                gather_src( i * num_comp + n ) =
+                    src_data[src_offset + SrcSlice::vector_length * n];
+        };
+        Kokkos::RangePolicy<ExecutionSpace> gather_policy( exec_space, 0,
+                                                           src.size() );
+        Kokkos::parallel_for( "Cabana::deep_copy_async::gather", gather_policy,
+                              gather_func );
+        Kokkos::deep_copy( exec_space, gather_dst, gather_src );
+    }
+
+    // Scatter back into the destination slice from the gathered slice.
+    auto scatter_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto dst_offset = DstSlice::index_type::s( i ) * dst.stride( 0 ) +
+                          DstSlice::index_type::a( i );
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            dst_data[dst_offset + DstSlice::vector_length * n] =
+                gather_dst( i * num_comp + n );
+    };
+    Kokkos::RangePolicy<ExecutionSpace> scatter_policy( exec_space, 0,
+                                                        dst.size() );
+    Kokkos::parallel_for( "Cabana::deep_copy_async::scatter", scatter_policy,
+                          scatter_func );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Block-transpose a slice into a flat column-major view.
+
+  \tparam ViewType Rank-2 LayoutLeft view type for the flat data.
+
+  \tparam SliceType Slice type.
+
+  \param dst The flat data. Entry (i,n) holds component n of tuple i with
+  the components of a multidimensional member flattened in layout
+  order. Must have extents (slice size, number of components) and be
+  accessible from the slice execution space.
+
+  \param src The slice to transpose.
+
+  Use this to hand particle data to external packages (e.g. implicit
+  solvers) that want contiguous per-component column arrays. Each team
+  transposes one SoA block: the team vector lanes run over the inner array
+  index so both the SoA reads and the column writes are contiguous, running
+  at streaming bandwidth rather than the strided scalar copy of an
+  element-wise loop.
+*/
+template <class ViewType, class SliceType>
+void deep_copy(
+    ViewType& dst, const SliceType& src,
+    typename std::enable_if<( Kokkos::is_view<ViewType>::value &&
+                              is_slice<SliceType>::value ),
+                            int>::type* = 0 )
+{
+    static_assert( std::is_same<typename ViewType::array_layout,
+                                Kokkos::LayoutLeft>::value,
+                   "Flat transpose view must be LayoutLeft" );
+    static_assert(
+        is_accessible_from<typename ViewType::memory_space,
+                           typename SliceType::execution_space>::value,
+        "Flat view must be accessible from the slice execution space" );
+
+    // Get the number of components in the slice elements.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < src.rank(); ++d )
+        num_comp *= src.extent( d );
+
+    if ( dst.extent( 0 ) != src.size() || dst.extent( 1 ) != num_comp )
+        throw std::runtime_error( "Flat transpose view is the wrong size!" );
+
+    // Transpose one SoA block per team.
+    using execution_space = typename SliceType::execution_space;
+    using kokkos_policy = Kokkos::TeamPolicy<execution_space>;
+    constexpr int vector_length = SliceType::vector_length;
+    const std::size_t num_tuple = src.size();
+    const std::size_t soa_stride = src.stride( 0 );
+    auto src_data = src.data();
+    kokkos_policy team_policy( src.numSoA(), Kokkos::AUTO, vector_length );
+    Kokkos::parallel_for(
+        "Cabana::deep_copy::sliceToFlat", team_policy,
+        KOKKOS_LAMBDA( const typename kokkos_policy::member_type& team ) {
+            const std::size_t s = team.league_rank();
+            const int num_a = ( ( s + 1 ) * vector_length <= num_tuple )
+                                  ? vector_length
+                                  : num_tuple - s * vector_length;
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange( team, num_comp ),
+                [&]( const std::size_t n ) {
+                    Kokkos::parallel_for(
+                        Kokkos::ThreadVectorRange( team, num_a ),
+                        [&]( const int a ) {
+                            dst( s * vector_length + a, n ) =
+                                src_data[s * soa_stride + a +
+                                         vector_length * n];
+                        } );
+                } );
+        } );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Asynchronously block-transpose a slice into a flat column-major
+  view.
+
+  \param exec_space The execution space instance (e.g. stream) on which to
+  enqueue the transpose.
+
+  \param dst The flat data. Entry (i,n) holds component n of tuple i with
+  the components of a multidimensional member flattened in layout
+  order. Must have extents (slice size, number of components) and be
+  accessible from the given execution space.
+
+  \param src The slice to transpose.
+
+  Identical to the fencing slice-to-view deep_copy except the transpose
+  kernel is enqueued on the given execution space instance and this
+  function returns without fencing - the caller is responsible for
+  synchronizing with the instance before using the destination data.
+*/
+template <class ExecutionSpace, class ViewType, class SliceType>
+void deep_copy(
+    const ExecutionSpace& exec_space, ViewType& dst, const SliceType& src,
+    typename std::enable_if<( Kokkos::is_execution_space<
+                                  ExecutionSpace>::value &&
+                              Kokkos::is_view<ViewType>::value &&
+                              is_slice<SliceType>::value ),
+                            int>::type* = 0 )
+{
+    static_assert( std::is_same<typename ViewType::array_layout,
+                                Kokkos::LayoutLeft>::value,
+                   "Flat transpose view must be LayoutLeft" );
+    static_assert(
+        is_accessible_from<typename ViewType::memory_space,
+                           ExecutionSpace>::value,
+        "Flat view must be accessible from the given execution space" );
+
+    // Get the number of components in the slice elements.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < src.rank(); ++d )
+        num_comp *= src.extent( d );
+
+    if ( dst.extent( 0 ) != src.size() || dst.extent( 1 ) != num_comp )
+        throw std::runtime_error( "Flat transpose view is the wrong size!" );
+
+    // Transpose one SoA block per team.
+    using kokkos_policy = Kokkos::TeamPolicy<ExecutionSpace>;
+    constexpr int vector_length = SliceType::vector_length;
+    const std::size_t num_tuple = src.size();
+    const std::size_t soa_stride = src.stride( 0 );
+    auto src_data = src.data();
+    kokkos_policy team_policy( exec_space, src.numSoA(), Kokkos::AUTO,
+                               vector_length );
+    Kokkos::parallel_for(
+        "Cabana::deep_copy_async::sliceToFlat", team_policy,
+        KOKKOS_LAMBDA( const typename kokkos_policy::member_type& team ) {
+            const std::size_t s = team.league_rank();
+            const int num_a = ( ( s + 1 ) * vector_length <= num_tuple )
+                                  ? vector_length
+                                  : num_tuple - s * vector_length;
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange( team, num_comp ),
+                [&]( const std::size_t n ) {
+                    Kokkos::parallel_for(
+                        Kokkos::ThreadVectorRange( team, num_a ),
+                        [&]( const int a ) {
+                            dst( s * vector_length + a, n ) =
+                                src_data[s * soa_stride + a +
+                                         vector_length * n];
+                        } );
+                } );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Block-transpose a flat column-major view into a slice.
+
+  \tparam SliceType Slice type.
+
+  \tparam ViewType Rank-2 LayoutLeft view type holding the flat data.
+
+  \param dst The slice to transpose into.
+
+  \param src The flat data, in the format produced by the slice-to-view
+  deep_copy. Must have extents (slice size, number of components) and be
+  accessible from the slice execution space.
+
+  Use this to take solver results in contiguous per-component column arrays
+  back into the particle layout.
+*/
+template <class SliceType, class ViewType>
+void deep_copy(
+    SliceType& dst, const ViewType& src,
+    typename std::enable_if<( is_slice<SliceType>::value &&
+                              Kokkos::is_view<ViewType>::value ),
+                            int>::type* = 0 )
+{
+    static_assert( std::is_same<typename ViewType::array_layout,
+                                Kokkos::LayoutLeft>::value,
+                   "Flat transpose view must be LayoutLeft" );
+    static_assert(
+        is_accessible_from<typename ViewType::memory_space,
+                           typename SliceType::execution_space>::value,
+        "Flat view must be accessible from the slice execution space" );
+
+    // Get the number of components in the slice elements.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < dst.rank(); ++d )
+        num_comp *= dst.extent( d );
+
+    if ( src.extent( 0 ) != dst.size() || src.extent( 1 ) != num_comp )
+        throw std::runtime_error( "Flat transpose view is the wrong size!" );
+
+    // Transpose one SoA block per team.
+    using execution_space = typename SliceType::execution_space;
+    using kokkos_policy = Kokkos::TeamPolicy<execution_space>;
+    constexpr int vector_length = SliceType::vector_length;
+    const std::size_t num_tuple = dst.size();
+    const std::size_t soa_stride = dst.stride( 0 );
+    auto dst_data = dst.data();
+    kokkos_policy team_policy( dst.numSoA(), Kokkos::AUTO, vector_length );
+    Kokkos::parallel_for(
+        "Cabana::deep_copy::flatToSlice", team_policy,
+        KOKKOS_LAMBDA( const typename kokkos_policy::member_type& team ) {
+            const std::size_t s = team.league_rank();
+            const int num_a = ( ( s + 1 ) * vector_length <= num_tuple )
+                                  ? vector_length
+                                  : num_tuple - s * vector_length;
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange( team, num_comp ),
+                [&]( const std::size_t n ) {
+                    Kokkos::parallel_for(
+                        Kokkos::ThreadVectorRange( team, num_a ),
+                        [&]( const int a ) {
+                            dst_data[s * soa_stride + a + vector_length * n] =
+                                src( s * vector_length + a, n );
+                        } );
+                } );
+        } );
+    Kokkos::fence();
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Fill a slice with a scalar.
@@ -18,13 +18,21 @@
 
 #include <Cabana_AoSoA.hpp>
 #include <Cabana_CommunicationPlan.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_Halo.hpp>
+#include <Cabana_LinkedCellList.hpp>
+#include <Cabana_PinnedBufferPool.hpp>
 #include <Cabana_Slice.hpp>
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_ScatterView.hpp>
 
 #include <mpi.h>
 
+#include <algorithm>
+#include <cstring>
 #include <exception>
+#include <utility>
 #include <vector>
 
 namespace Cabana
@@ -37,6 +45,10 @@ namespace Cabana
   \tparam DeviceType Device type for which the data for this class will be
   allocated and where parallel compuations will be executed.
 
+  \tparam ExportIndexType Integer type of the export steering vector
+  entries. Defaults to std::size_t. A 32-bit type halves the steering
+  memory when the number of local elements fits in it.
+
   The Distributor allows data to be migrated to an entirely new
   decomposition. Only uniquely-owned decompositions are handled (i.e. each
   local element in the source rank has a single unique destination rank).
@@ -57,8 +69,8 @@ namespace Cabana
   user must allocate their own destination data structure.
 
 */
-template <class DeviceType>
-class Distributor : public CommunicationPlan<DeviceType>
+template <class DeviceType, class ExportIndexType = std::size_t>
+class Distributor : public CommunicationPlan<DeviceType, ExportIndexType>
 {
   public:
     /*!
@@ -98,7 +110,7 @@ class Distributor : public CommunicationPlan<DeviceType>
     template <class ViewType>
     Distributor( MPI_Comm comm, const ViewType& element_export_ranks,
                  const std::vector<int>& neighbor_ranks )
-        : CommunicationPlan<DeviceType>( comm )
+        : CommunicationPlan<DeviceType, ExportIndexType>( comm )
     {
         auto neighbor_ids = this->createFromExportsAndTopology(
             element_export_ranks, neighbor_ranks );
@@ -134,7 +146,7 @@ class Distributor : public CommunicationPlan<DeviceType>
     */
     template <class ViewType>
     Distributor( MPI_Comm comm, const ViewType& element_export_ranks )
-        : CommunicationPlan<DeviceType>( comm )
+        : CommunicationPlan<DeviceType, ExportIndexType>( comm )
     {
         auto neighbor_ids = this->createFromExportsOnly( element_export_ranks );
         this->createExportSteering( neighbor_ids, element_export_ranks );
@@ -148,8 +160,9 @@ struct is_distributor_impl : public std::false_type
 {
 };
 
-template <typename DeviceType>
-struct is_distributor_impl<Distributor<DeviceType>> : public std::true_type
+template <typename DeviceType, typename ExportIndexType>
+struct is_distributor_impl<Distributor<DeviceType, ExportIndexType>>
+    : public std::true_type
 {
 };
 //! \endcond
@@ -165,12 +178,312 @@ struct is_distributor
 namespace Impl
 {
 //! \cond Impl
+//---------------------------------------------------------------------------//
+// Exchange the on-node transfers of the plan through an MPI-3 shared-memory
+// window. Each rank exposes its on-node send data in a window segment on the
+// node communicator and the receivers copy their imports directly out of the
+// owner's segment, bypassing the network path entirely.
+template <class Distributor_t>
+void exchangeOnNodeShared( const Distributor_t& distributor,
+                           const char* send_data, char* recv_data,
+                           const std::size_t tuple_bytes, const int my_rank )
+{
+    MPI_Comm node_comm = distributor.nodeComm();
+    int num_n = distributor.numNeighbor();
+    const int mpi_tag = 1236;
+
+    // Compute the byte range of each neighbor's data in the send and
+    // receive buffers. The send buffer does not contain the self sends.
+    std::vector<std::size_t> send_begin( num_n, 0 );
+    std::vector<std::size_t> recv_begin( num_n, 0 );
+    std::size_t send_offset = 0;
+    std::size_t recv_offset = 0;
+    for ( int n = 0; n < num_n; ++n )
+    {
+        send_begin[n] = send_offset;
+        recv_begin[n] = recv_offset;
+        if ( distributor.neighborRank( n ) != my_rank )
+            send_offset += distributor.numExport( n ) * tuple_bytes;
+        recv_offset += distributor.numImport( n ) * tuple_bytes;
+    }
+
+    // Size the shared segment by the on-node sends and record the offset
+    // of each on-node neighbor's data within it.
+    std::vector<std::size_t> segment_begin( num_n, 0 );
+    MPI_Aint segment_bytes = 0;
+    for ( int n = 0; n < num_n; ++n )
+        if ( distributor.neighborIsOnNode( n ) &&
+             distributor.neighborRank( n ) != my_rank )
+        {
+            segment_begin[n] = segment_bytes;
+            segment_bytes += distributor.numExport( n ) * tuple_bytes;
+        }
+
+    // Allocate the node window and stage the on-node send data in it.
+    char* segment = nullptr;
+    MPI_Win window;
+    MPI_Win_allocate_shared( segment_bytes, 1, MPI_INFO_NULL, node_comm,
+                             &segment, &window );
+    MPI_Win_lock_all( MPI_MODE_NOCHECK, window );
+    for ( int n = 0; n < num_n; ++n )
+        if ( distributor.neighborIsOnNode( n ) &&
+             distributor.neighborRank( n ) != my_rank &&
+             distributor.numExport( n ) > 0 )
+            std::memcpy( segment + segment_begin[n], send_data + send_begin[n],
+                         distributor.numExport( n ) * tuple_bytes );
+
+    // Tell each on-node neighbor where its data sits in our segment and
+    // learn where our data sits in theirs.
+    std::vector<std::size_t> peer_begin( num_n, 0 );
+    std::vector<MPI_Request> requests;
+    requests.reserve( num_n );
+    for ( int n = 0; n < num_n; ++n )
+        if ( distributor.neighborIsOnNode( n ) &&
+             distributor.neighborRank( n ) != my_rank )
+        {
+            requests.push_back( MPI_Request() );
+            MPI_Irecv( &peer_begin[n], 1, MPI_UNSIGNED_LONG,
+                       distributor.neighborNodeRank( n ), mpi_tag, node_comm,
+                       &( requests.back() ) );
+        }
+    for ( int n = 0; n < num_n; ++n )
+        if ( distributor.neighborIsOnNode( n ) &&
+             distributor.neighborRank( n ) != my_rank )
+            MPI_Send( &segment_begin[n], 1, MPI_UNSIGNED_LONG,
+                      distributor.neighborNodeRank( n ), mpi_tag, node_comm );
+    std::vector<MPI_Status> status( requests.size() );
+    if ( MPI_SUCCESS !=
+         MPI_Waitall( requests.size(), requests.data(), status.data() ) )
+        throw std::logic_error( "Failed MPI Communication" );
+
+    // Make the staged data visible and copy our imports directly out of
+    // the owners' segments.
+    MPI_Win_sync( window );
+    MPI_Barrier( node_comm );
+    for ( int n = 0; n < num_n; ++n )
+        if ( distributor.neighborIsOnNode( n ) &&
+             distributor.neighborRank( n ) != my_rank &&
+             distributor.numImport( n ) > 0 )
+        {
+            MPI_Aint peer_bytes;
+            int peer_disp;
+            char* peer_segment;
+            MPI_Win_shared_query( window, distributor.neighborNodeRank( n ),
+                                  &peer_bytes, &peer_disp,
+                                  (void**)&peer_segment );
+            std::memcpy( recv_data + recv_begin[n],
+                         peer_segment + peer_begin[n],
+                         distributor.numImport( n ) * tuple_bytes );
+        }
+
+    // All copies must complete before the segments are freed.
+    MPI_Barrier( node_comm );
+    MPI_Win_unlock_all( window );
+    MPI_Win_free( &window );
+}
+
+//---------------------------------------------------------------------------//
+// Execute the point-to-point exchange of the plan through pinned host
+// staging buffers when the MPI library cannot access device allocations.
+// The messages are split into fixed-size chunks and the device-to-host copy
+// of each chunk overlaps the blocking send of the previous one so the PCIe
+// transfer and the network stay busy at the same time. Both sides derive
+// the same chunking from the element counts so sends and receives match.
+// The send and receive buffers must be contiguous and the data staying on
+// this rank must already be in the front of the device receive buffer.
+template <class Distributor_t, class SendBuffer_t, class RecvBuffer_t>
+void pinnedStagedDistribute( const Distributor_t& distributor,
+                             const SendBuffer_t& send_buffer,
+                             const RecvBuffer_t& recv_buffer,
+                             const std::size_t element_bytes,
+                             const std::size_t num_stay, const int my_rank,
+                             const bool node_shared )
+{
+    using execution_space = typename Distributor_t::execution_space;
+    using memory_space = typename Distributor_t::memory_space;
+
+    int num_n = distributor.numNeighbor();
+    const int mpi_tag = 1234;
+
+    // Stage through pooled pinned host allocations.
+    auto& pool = distributor.pinnedPool();
+    PinnedMirror<SendBuffer_t> send_stage( pool, send_buffer );
+    PinnedMirror<RecvBuffer_t> recv_stage( pool, recv_buffer );
+
+    // Byte views over the contiguous buffers for chunked ranged copies.
+    std::size_t num_send = distributor.totalNumExport() - num_stay;
+    Kokkos::View<const char*, memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+        send_dev( reinterpret_cast<const char*>( send_buffer.data() ),
+                  num_send * element_bytes );
+    Kokkos::View<char*, PinnedHostSpace,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+        send_host( reinterpret_cast<char*>( send_stage.view.data() ),
+                   num_send * element_bytes );
+    char* recv_host = reinterpret_cast<char*>( recv_stage.view.data() );
+
+    // Chunk in whole elements so a chunk boundary never splits an element.
+    std::size_t chunk_elements = std::max(
+        std::size_t( 1 ), pinned_staging_chunk_bytes / element_bytes );
+
+    // Post non-blocking receives into the pinned staging buffer, one per
+    // chunk.
+    std::vector<MPI_Request> requests;
+    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        recv_range.second = recv_range.first + distributor.numImport( n );
+
+        if ( ( distributor.numImport( n ) > 0 ) &&
+             ( distributor.neighborRank( n ) != my_rank ) &&
+             !( node_shared && distributor.neighborIsOnNode( n ) ) )
+        {
+            for ( std::size_t begin = recv_range.first;
+                  begin < recv_range.second; begin += chunk_elements )
+            {
+                std::size_t end =
+                    std::min( begin + chunk_elements, recv_range.second );
+
+                requests.push_back( MPI_Request() );
+
+                MPI_Irecv( recv_host + begin * element_bytes,
+                           ( end - begin ) * element_bytes, MPI_BYTE,
+                           distributor.neighborRank( n ), mpi_tag,
+                           distributor.comm(), &( requests.back() ) );
+            }
+        }
+
+        recv_range.first = recv_range.second;
+    }
+
+    // Build the flat list of send chunks in neighbor order. The on-node
+    // segments are not sent over the network but still must be staged for
+    // the shared-memory exchange.
+    struct SendChunk
+    {
+        std::size_t begin_byte;
+        std::size_t num_byte;
+        int rank;
+    };
+    std::vector<SendChunk> chunks;
+    std::vector<std::pair<std::size_t, std::size_t>> on_node_ranges;
+    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+    for ( int n = 0; n < num_n; ++n )
+    {
+        if ( ( distributor.numExport( n ) > 0 ) &&
+             ( distributor.neighborRank( n ) != my_rank ) )
+        {
+            send_range.second = send_range.first + distributor.numExport( n );
+
+            if ( !( node_shared && distributor.neighborIsOnNode( n ) ) )
+            {
+                for ( std::size_t begin = send_range.first;
+                      begin < send_range.second; begin += chunk_elements )
+                {
+                    std::size_t end =
+                        std::min( begin + chunk_elements, send_range.second );
+                    chunks.push_back( { begin * element_bytes,
+                                        ( end - begin ) * element_bytes,
+                                        distributor.neighborRank( n ) } );
+                }
+            }
+            else
+            {
+                on_node_ranges.push_back(
+                    { send_range.first * element_bytes,
+                      send_range.second * element_bytes } );
+            }
+
+            send_range.first = send_range.second;
+        }
+    }
+
+    // Launch the device-to-host copy of a chunk without fencing.
+    execution_space exec{};
+    auto stage_bytes = [&]( const std::size_t begin_byte,
+                            const std::size_t end_byte ) {
+        auto byte_range = std::make_pair( begin_byte, end_byte );
+        Kokkos::deep_copy( exec, Kokkos::subview( send_host, byte_range ),
+                           Kokkos::subview( send_dev, byte_range ) );
+    };
+
+    // Prime the pipeline with the first chunk and the on-node segments.
+    if ( !chunks.empty() )
+        stage_bytes( chunks.front().begin_byte,
+                     chunks.front().begin_byte + chunks.front().num_byte );
+    for ( auto& range : on_node_ranges )
+        stage_bytes( range.first, range.second );
+    exec.fence();
+
+    // Send each chunk once staged while the next chunk's copy is in
+    // flight.
+    for ( std::size_t c = 0; c < chunks.size(); ++c )
+    {
+        if ( c + 1 < chunks.size() )
+            stage_bytes( chunks[c + 1].begin_byte,
+                         chunks[c + 1].begin_byte + chunks[c + 1].num_byte );
+
+        MPI_Send( send_host.data() + chunks[c].begin_byte,
+                  chunks[c].num_byte, MPI_BYTE, chunks[c].rank, mpi_tag,
+                  distributor.comm() );
+
+        exec.fence();
+    }
+
+    // Exchange the on-node transfers through direct shared-memory copies
+    // while the network messages are in flight.
+    if ( node_shared )
+        exchangeOnNodeShared( distributor, send_host.data(), recv_host,
+                              element_bytes, my_rank );
+
+    // Wait on the non-blocking receives.
+    std::vector<MPI_Status> status( requests.size() );
+    const int ec =
+        MPI_Waitall( requests.size(), requests.data(), status.data() );
+    if ( MPI_SUCCESS != ec )
+        throw std::logic_error( "Failed MPI Communication" );
+
+    // Copy back only the received section - the self-send section at the
+    // front of the receive buffer was already filled on device.
+    if ( distributor.totalNumImport() > num_stay )
+    {
+        std::pair<std::size_t, std::size_t> mpi_byte_range = {
+            num_stay * element_bytes,
+            distributor.totalNumImport() * element_bytes };
+        Kokkos::View<char*, memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+            recv_dev( reinterpret_cast<char*>( recv_buffer.data() ),
+                      distributor.totalNumImport() * element_bytes );
+        Kokkos::View<const char*, PinnedHostSpace,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+            recv_host_view( recv_host,
+                            distributor.totalNumImport() * element_bytes );
+        Kokkos::deep_copy( Kokkos::subview( recv_dev, mpi_byte_range ),
+                           Kokkos::subview( recv_host_view, mpi_byte_range ) );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// No-op unpack hook for the plain data distribution path.
+struct NoOpUnpack
+{
+    template <class TupleType>
+    KOKKOS_INLINE_FUNCTION void operator()( const std::size_t,
+                                            const TupleType& ) const
+    {
+    }
+};
+
 //---------------------------------------------------------------------------//
 // Synchronously move data between a source and destination AoSoA by executing
-// the forward communication plan.
-template <class Distributor_t, class AoSoA_t>
+// the forward communication plan. The unpack hook is called once per
+// imported element with its destination index and tuple while the tuple is
+// still in registers, letting callers fuse work over the arriving data
+// (e.g. cell counting) into the unpack kernel.
+template <class Distributor_t, class AoSoA_t, class UnpackOp>
 void distributeData(
     const Distributor_t& distributor, const AoSoA_t& src, AoSoA_t& dst,
+    const UnpackOp& unpack_op,
     typename std::enable_if<( is_distributor<Distributor_t>::value &&
                               is_aosoa<AoSoA_t>::value ),
                             int>::type* = 0 )
@@ -191,20 +504,17 @@ void distributeData(
             ? distributor.numExport( 0 )
             : 0;
 
-    // Allocate a send buffer.
+    // Get a send buffer. If the distributor has persistent buffers enabled
+    // this reuses the buffer from the previous call, growing it if needed.
     std::size_t num_send = distributor.totalNumExport() - num_stay;
-    Kokkos::View<typename AoSoA_t::tuple_type*,
-                 typename Distributor_t::memory_space>
-        send_buffer( Kokkos::ViewAllocateWithoutInitializing(
-                         "distributor_send_buffer" ),
-                     num_send );
-
-    // Allocate a receive buffer.
-    Kokkos::View<typename AoSoA_t::tuple_type*,
-                 typename Distributor_t::memory_space>
-        recv_buffer( Kokkos::ViewAllocateWithoutInitializing(
-                         "distributor_recv_buffer" ),
-                     distributor.totalNumImport() );
+    auto send_buffer =
+        distributor.template getSendBuffer<typename AoSoA_t::tuple_type>(
+            num_send );
+
+    // Get a receive buffer.
+    auto recv_buffer =
+        distributor.template getReceiveBuffer<typename AoSoA_t::tuple_type>(
+            distributor.totalNumImport() );
 
     // Get the steering vector for the sends.
     auto steering = distributor.getExportSteering();
@@ -212,81 +522,235 @@ void distributeData(
     // Gather the exports from the source AoSoA into the tuple-contiguous send
     // buffer or the receive buffer if the data is staying. We know that the
     // steering vector is ordered such that the data staying on this rank
-    // comes first.
-    auto build_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    // comes first. A thread-per-tuple copy strides the global writes by the
+    // tuple size so each team stages a tile of tuples in scratch memory and
+    // flushes the tile word-by-word with consecutive threads writing
+    // consecutive buffer words.
+    using tuple_type = typename AoSoA_t::tuple_type;
+    constexpr std::size_t tuple_bytes = sizeof( tuple_type );
+    using copy_word_type = typename std::conditional<
+        ( 0 == tuple_bytes % sizeof( unsigned long long ) &&
+          0 == alignof( tuple_type ) % sizeof( unsigned long long ) ),
+        unsigned long long,
+        typename std::conditional<
+            ( 0 == tuple_bytes % sizeof( unsigned int ) &&
+              0 == alignof( tuple_type ) % sizeof( unsigned int ) ),
+            unsigned int, unsigned char>::type>::type;
+    constexpr std::size_t words_per_tuple =
+        tuple_bytes / sizeof( copy_word_type );
+
+    // Size the tile so the scratch stays within on-chip limits for large
+    // tuples.
+    const std::size_t tile_size = std::max(
+        std::size_t( 1 ),
+        std::min( std::size_t( 128 ), std::size_t( 16384 ) / tuple_bytes ) );
+    const std::size_t total_num_export = distributor.totalNumExport();
+    const std::size_t num_tile = ( total_num_export + tile_size - 1 ) / tile_size;
+
+    using team_policy =
+        Kokkos::TeamPolicy<typename Distributor_t::execution_space>;
+    auto build_send_buffer_func =
+        KOKKOS_LAMBDA( const typename team_policy::member_type& team )
     {
-        auto tpl = src.getTuple( steering( i ) );
-        if ( i < num_stay )
-            recv_buffer( i ) = tpl;
-        else
-            send_buffer( i - num_stay ) = tpl;
+        std::size_t tile_begin = team.league_rank() * tile_size;
+        std::size_t num_elem = ( tile_begin + tile_size <= total_num_export )
+                                   ? tile_size
+                                   : total_num_export - tile_begin;
+        tuple_type* tile = (tuple_type*)team.team_shmem().get_shmem(
+            tile_size * tuple_bytes );
+
+        // Gather one tuple per thread into the tile.
+        Kokkos::parallel_for( Kokkos::TeamThreadRange( team, num_elem ),
+                              [&]( const std::size_t e ) {
+                                  tile[e] = src.getTuple(
+                                      steering( tile_begin + e ) );
+                              } );
+        team.team_barrier();
+
+        // Flush the tile to the buffers with coalesced word writes.
+        const copy_word_type* tile_words = (const copy_word_type*)tile;
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange( team, num_elem * words_per_tuple ),
+            [&]( const std::size_t w ) {
+                std::size_t i = tile_begin + w / words_per_tuple;
+                std::size_t r = w % words_per_tuple;
+                copy_word_type* dst_words =
+                    ( i < num_stay )
+                        ? (copy_word_type*)&recv_buffer( i )
+                        : (copy_word_type*)&send_buffer( i - num_stay );
+                dst_words[r] = tile_words[w];
+            } );
     };
-    Kokkos::RangePolicy<typename Distributor_t::execution_space>
-        build_send_buffer_policy( 0, distributor.totalNumExport() );
+    team_policy build_send_buffer_policy( num_tile, Kokkos::AUTO );
+    build_send_buffer_policy = build_send_buffer_policy.set_scratch_size(
+        0, Kokkos::PerTeam( tile_size * tuple_bytes ) );
     Kokkos::parallel_for( "Cabana::Impl::distributeData::build_send_buffer",
                           build_send_buffer_policy, build_send_buffer_func );
     Kokkos::fence();
 
-    // The distributor has its own communication space so choose any tag.
-    const int mpi_tag = 1234;
-
-    // Post non-blocking receives.
-    std::vector<MPI_Request> requests;
-    requests.reserve( num_n );
-    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
-    {
-        recv_range.second = recv_range.first + distributor.numImport( n );
-
-        if ( ( distributor.numImport( n ) > 0 ) &&
-             ( distributor.neighborRank( n ) != my_rank ) )
+    // Route the intra-node transfers through direct shared-memory copies
+    // when the node-aware backend is enabled. This applies to the
+    // host-staged point-to-point path - device-direct MPI already performs
+    // its own peer-to-peer transfers on-node.
+    const bool node_shared = distributor.nodeAwareExchangeEnabled() &&
+                             !distributor.neighborCollectivesEnabled() &&
+                             !distributor.deviceDirectEnabled();
+
+    // Issue the exchange on the given send and receive buffers. A generic
+    // lambda so the same code runs on the device buffers or on host
+    // staging copies. The data staying on this rank was copied directly
+    // into the receive buffer so the self counts are zero.
+    auto do_exchange = [&]( auto& mpi_send_buffer, auto& mpi_recv_buffer ) {
+        // Exchange with a neighbor collective over the distributor's graph
+        // communicator if that backend is enabled.
+        if ( distributor.neighborCollectivesEnabled() )
         {
-            auto recv_subview = Kokkos::subview( recv_buffer, recv_range );
-
-            requests.push_back( MPI_Request() );
-
-            MPI_Irecv( recv_subview.data(),
-                       recv_subview.size() *
-                           sizeof( typename AoSoA_t::tuple_type ),
-                       MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
-                       distributor.comm(), &( requests.back() ) );
+            std::vector<int> send_counts( num_n ), send_displs( num_n ),
+                recv_counts( num_n ), recv_displs( num_n );
+            int send_offset = 0;
+            int recv_offset = 0;
+            for ( int n = 0; n < num_n; ++n )
+            {
+                bool is_self = ( distributor.neighborRank( n ) == my_rank );
+                send_counts[n] =
+                    is_self ? 0 : distributor.numExport( n ) * tuple_bytes;
+                recv_counts[n] =
+                    is_self ? 0 : distributor.numImport( n ) * tuple_bytes;
+                send_displs[n] = send_offset;
+                recv_displs[n] = recv_offset;
+                send_offset += send_counts[n];
+                recv_offset += distributor.numImport( n ) * tuple_bytes;
+            }
+            const int ec = MPI_Neighbor_alltoallv(
+                mpi_send_buffer.data(), send_counts.data(),
+                send_displs.data(), MPI_BYTE, mpi_recv_buffer.data(),
+                recv_counts.data(), recv_displs.data(), MPI_BYTE,
+                distributor.graphComm() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
         }
+        else
+        {
+            // The distributor has its own communication space so choose any
+            // tag.
+            const int mpi_tag = 1234;
+
+            // Post non-blocking receives.
+            std::vector<MPI_Request> requests;
+            requests.reserve( num_n );
+            std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+            for ( int n = 0; n < num_n; ++n )
+            {
+                recv_range.second =
+                    recv_range.first + distributor.numImport( n );
+
+                if ( ( distributor.numImport( n ) > 0 ) &&
+                     ( distributor.neighborRank( n ) != my_rank ) &&
+                     !( node_shared && distributor.neighborIsOnNode( n ) ) )
+                {
+                    auto recv_subview =
+                        Kokkos::subview( mpi_recv_buffer, recv_range );
+
+                    requests.push_back( MPI_Request() );
+
+                    MPI_Irecv( recv_subview.data(),
+                               recv_subview.size() *
+                                   sizeof( typename AoSoA_t::tuple_type ),
+                               MPI_BYTE, distributor.neighborRank( n ),
+                               mpi_tag, distributor.comm(),
+                               &( requests.back() ) );
+                }
+
+                recv_range.first = recv_range.second;
+            }
+
+            // Do blocking sends. The on-node data stays in the send buffer
+            // for the shared-memory exchange.
+            std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+            for ( int n = 0; n < num_n; ++n )
+            {
+                if ( ( distributor.numExport( n ) > 0 ) &&
+                     ( distributor.neighborRank( n ) != my_rank ) )
+                {
+                    send_range.second =
+                        send_range.first + distributor.numExport( n );
+
+                    if ( !( node_shared &&
+                            distributor.neighborIsOnNode( n ) ) )
+                    {
+                        auto send_subview =
+                            Kokkos::subview( mpi_send_buffer, send_range );
+
+                        MPI_Send( send_subview.data(),
+                                  send_subview.size() *
+                                      sizeof( typename AoSoA_t::tuple_type ),
+                                  MPI_BYTE, distributor.neighborRank( n ),
+                                  mpi_tag, distributor.comm() );
+                    }
+
+                    send_range.first = send_range.second;
+                }
+            }
+
+            // Exchange the on-node transfers through direct shared-memory
+            // copies while the network messages are in flight.
+            if ( node_shared )
+                exchangeOnNodeShared(
+                    distributor,
+                    reinterpret_cast<const char*>( mpi_send_buffer.data() ),
+                    reinterpret_cast<char*>( mpi_recv_buffer.data() ),
+                    sizeof( typename AoSoA_t::tuple_type ), my_rank );
+
+            // Wait on non-blocking receives.
+            std::vector<MPI_Status> status( requests.size() );
+            const int ec =
+                MPI_Waitall( requests.size(), requests.data(), status.data() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+        }
+    };
 
-        recv_range.first = recv_range.second;
-    }
-
-    // Do blocking sends.
-    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
+    // Pass the device buffers directly to MPI or stage them through host
+    // memory if the MPI library cannot access device allocations.
+    if ( distributor.deviceDirectEnabled() )
+        do_exchange( send_buffer, recv_buffer );
+    else if ( distributor.neighborCollectivesEnabled() )
     {
-        if ( ( distributor.numExport( n ) > 0 ) &&
-             ( distributor.neighborRank( n ) != my_rank ) )
+        // The collective needs the whole send buffer at once so stage a
+        // single copy through pooled pinned host allocations.
+        PinnedMirror<decltype( send_buffer )> send_stage(
+            distributor.pinnedPool(), send_buffer );
+        PinnedMirror<decltype( recv_buffer )> recv_stage(
+            distributor.pinnedPool(), recv_buffer );
+        Kokkos::deep_copy( send_stage.view, send_buffer );
+        do_exchange( send_stage.view, recv_stage.view );
+
+        // Copy back only the received section - the self-send section at
+        // the front of the receive buffer was already filled on device.
+        if ( distributor.totalNumImport() > num_stay )
         {
-            send_range.second = send_range.first + distributor.numExport( n );
-
-            auto send_subview = Kokkos::subview( send_buffer, send_range );
-
-            MPI_Send( send_subview.data(),
-                      send_subview.size() *
-                          sizeof( typename AoSoA_t::tuple_type ),
-                      MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
-                      distributor.comm() );
-
-            send_range.first = send_range.second;
+            std::pair<std::size_t, std::size_t> mpi_range = {
+                num_stay, distributor.totalNumImport() };
+            auto recv_dev_subview = Kokkos::subview( recv_buffer, mpi_range );
+            auto recv_host_subview =
+                Kokkos::subview( recv_stage.view, mpi_range );
+            Kokkos::deep_copy( recv_dev_subview, recv_host_subview );
         }
     }
-
-    // Wait on non-blocking receives.
-    std::vector<MPI_Status> status( requests.size() );
-    const int ec =
-        MPI_Waitall( requests.size(), requests.data(), status.data() );
-    if ( MPI_SUCCESS != ec )
-        throw std::logic_error( "Failed MPI Communication" );
+    else
+    {
+        // The point-to-point path pipelines chunked pinned staging copies
+        // with the sends.
+        pinnedStagedDistribute( distributor, send_buffer, recv_buffer,
+                                tuple_bytes, num_stay, my_rank, node_shared );
+    }
 
     // Extract the receive buffer into the destination AoSoA.
     auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
     {
-        dst.setTuple( i, recv_buffer( i ) );
+        auto recv_tuple = recv_buffer( i );
+        dst.setTuple( i, recv_tuple );
+        unpack_op( i, recv_tuple );
     };
     Kokkos::RangePolicy<typename Distributor_t::execution_space>
         extract_recv_buffer_policy( 0, distributor.totalNumImport() );
@@ -299,6 +763,19 @@ void distributeData(
     MPI_Barrier( distributor.comm() );
 }
 
+//---------------------------------------------------------------------------//
+// Synchronously move data between a source and destination AoSoA by executing
+// the forward communication plan.
+template <class Distributor_t, class AoSoA_t>
+void distributeData(
+    const Distributor_t& distributor, const AoSoA_t& src, AoSoA_t& dst,
+    typename std::enable_if<( is_distributor<Distributor_t>::value &&
+                              is_aosoa<AoSoA_t>::value ),
+                            int>::type* = 0 )
+{
+    distributeData( distributor, src, dst, NoOpUnpack() );
+}
+
 //---------------------------------------------------------------------------//
 //! \endcond
 } // end namespace Impl
@@ -342,6 +819,176 @@ void migrate( const Distributor_t& distributor, const AoSoA_t& src,
     Impl::distributeData( distributor, src, dst );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously migrate data between two different decompositions and
+  bin the migrated data in a linked cell list in one fused pass.
+
+  \tparam PositionIndex The member index of the particle positions.
+
+  \tparam Distributor_t Distributor type - must be a distributor.
+
+  \tparam AoSoA_t AoSoA type - must be an AoSoA.
+
+  \tparam DeviceType Linked cell list device type.
+
+  \param distributor The distributor to use for the migration.
+
+  \param src The AoSoA containing the data to be migrated. Must have the same
+  number of elements as the inputs used to construct the distributor.
+
+  \param dst The AoSoA to which the migrated data will be written. Must be the
+  same size as the number of imports given by the distributor on this rank.
+
+  \param cell_list The linked cell list to bin the migrated data with. Must
+  hold the grid geometry covering the destination positions (e.g. from the
+  grid-only constructor or a previous build).
+
+  A migration is almost always followed by a rebinning of the arrived
+  particles, which re-reads all the data the unpack just wrote. This fused
+  path instead computes each incoming particle's cell key while its tuple is
+  still in registers and feeds the binning count pass from the unpack
+  kernel, so the linked cell list build skips its counting pass over the
+  migrated data.
+*/
+template <std::size_t PositionIndex, class Distributor_t, class AoSoA_t,
+          class DeviceType>
+void migrate( const Distributor_t& distributor, const AoSoA_t& src,
+              AoSoA_t& dst, LinkedCellList<DeviceType>& cell_list,
+              typename std::enable_if<( is_distributor<Distributor_t>::value &&
+                                        is_aosoa<AoSoA_t>::value ),
+                                      int>::type* = 0 )
+{
+    // Check that src and dst are the right size.
+    if ( src.size() != distributor.exportSize() )
+        throw std::runtime_error( "Source is the wrong size for migration!" );
+    if ( dst.size() != distributor.totalNumImport() )
+        throw std::runtime_error(
+            "Destination is the wrong size for migration!" );
+
+    // Zero the cell counts so the unpack kernel can accumulate into them.
+    auto counts = cell_list.startCount();
+    auto counts_sv = Kokkos::Experimental::create_scatter_view( counts );
+
+    // Count the cell occupancy of each arriving particle as its tuple
+    // lands.
+    auto list = cell_list;
+    auto count_unpack =
+        KOKKOS_LAMBDA( const std::size_t,
+                       const typename AoSoA_t::tuple_type& recv_tuple )
+    {
+        auto counts_data = counts_sv.access();
+        counts_data( list.pointBinIndex(
+            get<PositionIndex>( recv_tuple, 0 ),
+            get<PositionIndex>( recv_tuple, 1 ),
+            get<PositionIndex>( recv_tuple, 2 ) ) ) += 1;
+    };
+
+    // Move the data.
+    Impl::distributeData( distributor, src, dst, count_unpack );
+    Kokkos::Experimental::contribute( counts, counts_sv );
+
+    // Finish the binning with the counting pass already done.
+    auto positions = slice<PositionIndex>( dst );
+    cell_list.buildFromCounts( positions );
+}
+
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+
+// Copy the selected members of an AoSoA into the members of a compact
+// subset AoSoA in index list order.
+template <class SubsetAoSoA, class SrcAoSoA, std::size_t... M,
+          std::size_t... J>
+void gatherSubsetMembers( SubsetAoSoA& subset, const SrcAoSoA& src,
+                          MemberIndexList<M...>, std::index_sequence<J...> )
+{
+    std::initializer_list<int>{
+        ( deepCopyMember<J, M>( subset, src ), 0 )... };
+}
+
+// Copy the members of a compact subset AoSoA back into the selected
+// members of an AoSoA.
+template <class DstAoSoA, class SubsetAoSoA, std::size_t... M,
+          std::size_t... J>
+void scatterSubsetMembers( DstAoSoA& dst, const SubsetAoSoA& subset,
+                           MemberIndexList<M...>, std::index_sequence<J...> )
+{
+    std::initializer_list<int>{
+        ( deepCopyMember<M, J>( dst, subset ), 0 )... };
+}
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously migrate a compile-time subset of the members between
+  two different decompositions using the distributor forward communication
+  plan.
+
+  Migrating whole tuples moves every member over the wire even when the new
+  decomposition only needs a few of them. This version stages the members
+  selected by the index list in a compact AoSoA so a single exchange moves
+  only the requested bytes, then scatters them into the destination. The
+  remaining members of the destination are untouched.
+
+  \tparam M The indices of the members to migrate.
+
+  \tparam Distributor_t Distributor type - must be a distributor.
+
+  \tparam AoSoA_t AoSoA type - must be an AoSoA.
+
+  \param distributor The distributor to use for the migration.
+
+  \param src The AoSoA containing the data to be migrated. Must have the same
+  number of elements as the inputs used to construct the distributor.
+
+  \param dst The AoSoA to which the migrated data will be written. Must be the
+  same size as the number of imports given by the distributor on this
+  rank. Call totalNumImport() on the distributor to get this size value.
+*/
+template <std::size_t... M, class Distributor_t, class AoSoA_t>
+void migrate( const Distributor_t& distributor, const AoSoA_t& src,
+              AoSoA_t& dst, MemberIndexList<M...>,
+              typename std::enable_if<( is_distributor<Distributor_t>::value &&
+                                        is_aosoa<AoSoA_t>::value ),
+                                      int>::type* = 0 )
+{
+    static_assert( sizeof...( M ) > 0,
+                   "Member index list must not be empty" );
+
+    // Check that src and dst are the right size.
+    if ( src.size() != distributor.exportSize() )
+        throw std::runtime_error( "Source is the wrong size for migration!" );
+    if ( dst.size() != distributor.totalNumImport() )
+        throw std::runtime_error(
+            "Destination is the wrong size for migration!" );
+
+    // Stage the selected members in compact AoSoAs with only the subset of
+    // the members so the wire format contains only the requested bytes.
+    using subset_types =
+        typename SubsetMemberTypes<typename AoSoA_t::member_types,
+                                   MemberIndexList<M...>>::type;
+    using subset_aosoa =
+        AoSoA<subset_types, typename AoSoA_t::memory_space,
+              AoSoA_t::vector_length>;
+    subset_aosoa subset_src( "migrate_subset_src", src.size() );
+    subset_aosoa subset_dst( "migrate_subset_dst",
+                             distributor.totalNumImport() );
+    Impl::gatherSubsetMembers( subset_src, src, MemberIndexList<M...>{},
+                               std::make_index_sequence<sizeof...( M )>{} );
+
+    // Move the subset data.
+    Impl::distributeData( distributor, subset_src, subset_dst );
+
+    // Scatter the migrated members into the destination.
+    Impl::scatterSubsetMembers( dst, subset_dst, MemberIndexList<M...>{},
+                                std::make_index_sequence<sizeof...( M )>{} );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Synchronously migrate data between two different decompositions using
@@ -364,7 +1011,10 @@ void migrate( const Distributor_t& distributor, const AoSoA_t& src,
   destributor. At output, it will be the same size as th enumber of import
   elements on this rank provided by the distributor. Before using this
   function, consider reserving enough memory in the data structure so
-  reallocating is not necessary.
+  reallocating is not necessary. If the import count exceeds the current
+  capacity the exchange lands in a fresh allocation reserved with the
+  growth policy and the container adopts it - all slices and references are
+  invalidated, as with any reallocating resize.
 */
 template <class Distributor_t, class AoSoA_t>
 void migrate( const Distributor_t& distributor, AoSoA_t& aosoa,
@@ -381,8 +1031,32 @@ void migrate( const Distributor_t& distributor, AoSoA_t& aosoa,
     bool dst_is_bigger =
         ( distributor.totalNumImport() > distributor.exportSize() );
 
+    // If the destination decomposition is bigger than the current capacity,
+    // growing in place would reallocate and copy the source data - wasted
+    // work, since the exchange stages every element through the
+    // communication buffers (including the elements staying on this rank)
+    // and the unpack rewrites all of the destination. Instead exchange into
+    // a fresh allocation reserved up front with the growth policy and adopt
+    // it, so the migration never pays the reallocation copy.
+    if ( distributor.totalNumImport() > aosoa.capacity() )
+    {
+        AoSoA_t dst( aosoa.label() );
+        dst.setGrowthFactor( aosoa.growthFactor() );
+        dst.setFirstTouch( aosoa.firstTouch() );
+        dst.reserve( std::max(
+            distributor.totalNumImport(),
+            static_cast<std::size_t>( aosoa.capacity() *
+                                      aosoa.growthFactor() ) ) );
+        dst.resize( distributor.totalNumImport() );
+        Impl::distributeData( distributor, aosoa, dst );
+        aosoa = dst;
+        return;
+    }
+
     // If the destination decomposition is bigger than the source
-    // decomposition resize now so we have enough space to do the operation.
+    // decomposition resize now so we have enough space to do the
+    // operation. The capacity check above guarantees this does not
+    // reallocate.
     if ( dst_is_bigger )
         aosoa.resize( distributor.totalNumImport() );
 
@@ -457,120 +1131,477 @@ void migrate( const Distributor_t& distributor, const Slice_t& src,
             ? distributor.numExport( 0 )
             : 0;
 
-    // Allocate a send buffer. Note this one is layout right so the components
-    // of each element are consecutive in memory.
+    // Get a send buffer. Note this one is layout right so the components of
+    // each element are consecutive in memory. If the distributor has
+    // persistent buffers enabled this reuses the buffer from the previous
+    // call, growing it if needed.
     std::size_t num_send = distributor.totalNumExport() - num_stay;
-    Kokkos::View<typename Slice_t::value_type**, Kokkos::LayoutRight,
-                 typename Distributor_t::memory_space>
-        send_buffer( Kokkos::ViewAllocateWithoutInitializing(
-                         "distributor_send_buffer" ),
-                     num_send, num_comp );
-
-    // Allocate a receive buffer. Note this one is layout right so the
-    // components of each element are consecutive in memory.
-    Kokkos::View<typename Slice_t::value_type**, Kokkos::LayoutRight,
-                 typename Distributor_t::memory_space>
-        recv_buffer( Kokkos::ViewAllocateWithoutInitializing(
-                         "distributor_recv_buffer" ),
-                     distributor.totalNumImport(), num_comp );
+    auto send_buffer =
+        distributor.template getSendBuffer<typename Slice_t::value_type>(
+            num_send, num_comp );
+
+    // Get a receive buffer. Note this one is layout right so the components
+    // of each element are consecutive in memory.
+    auto recv_buffer =
+        distributor.template getReceiveBuffer<typename Slice_t::value_type>(
+            distributor.totalNumImport(), num_comp );
 
     // Get the steering vector for the sends.
     auto steering = distributor.getExportSteering();
 
     // Gather from the source Slice into the contiguous send buffer or,
     // if it is part of the local copy, put it directly in the destination
-    // Slice.
-    auto build_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    // Slice. The pack is flattened over elements and components so
+    // consecutive threads write consecutive entries of the layout-right
+    // buffers.
+    auto build_send_buffer_func = KOKKOS_LAMBDA( const std::size_t f )
     {
+        std::size_t i = f / num_comp;
+        std::size_t n = f % num_comp;
         auto s_src = Slice_t::index_type::s( steering( i ) );
         auto a_src = Slice_t::index_type::a( steering( i ) );
         std::size_t src_offset = s_src * src.stride( 0 ) + a_src;
         if ( i < num_stay )
-            for ( std::size_t n = 0; n < num_comp; ++n )
-                recv_buffer( i, n ) =
-                    src_data[src_offset + n * Slice_t::vector_length];
+            recv_buffer( i, n ) =
+                src_data[src_offset + n * Slice_t::vector_length];
         else
-            for ( std::size_t n = 0; n < num_comp; ++n )
-                send_buffer( i - num_stay, n ) =
-                    src_data[src_offset + n * Slice_t::vector_length];
+            send_buffer( i - num_stay, n ) =
+                src_data[src_offset + n * Slice_t::vector_length];
     };
     Kokkos::RangePolicy<typename Distributor_t::execution_space>
-        build_send_buffer_policy( 0, distributor.totalNumExport() );
+        build_send_buffer_policy( 0, distributor.totalNumExport() * num_comp );
     Kokkos::parallel_for( "Cabana::migrate::build_send_buffer",
                           build_send_buffer_policy, build_send_buffer_func );
     Kokkos::fence();
 
-    // The distributor has its own communication space so choose any tag.
-    const int mpi_tag = 1234;
+    // Route intra-node transfers through the shared-memory window when the
+    // node-aware mode is enabled on the host-staged point-to-point path.
+    const bool node_shared = distributor.nodeAwareExchangeEnabled() &&
+                             !distributor.neighborCollectivesEnabled() &&
+                             !distributor.deviceDirectEnabled();
+
+    // Issue the exchange on the given send and receive buffers. A generic
+    // lambda so the same code runs on the device buffers or on host
+    // staging copies. The data staying on this rank was copied directly
+    // into the receive buffer so the self counts are zero.
+    auto do_exchange = [&]( auto& mpi_send_buffer, auto& mpi_recv_buffer ) {
+        // Exchange with a neighbor collective over the distributor's graph
+        // communicator if that backend is enabled.
+        if ( distributor.neighborCollectivesEnabled() )
+        {
+            const int element_bytes =
+                num_comp * sizeof( typename Slice_t::value_type );
+            std::vector<int> send_counts( num_n ), send_displs( num_n ),
+                recv_counts( num_n ), recv_displs( num_n );
+            int send_offset = 0;
+            int recv_offset = 0;
+            for ( int n = 0; n < num_n; ++n )
+            {
+                bool is_self = ( distributor.neighborRank( n ) == my_rank );
+                send_counts[n] =
+                    is_self ? 0 : distributor.numExport( n ) * element_bytes;
+                recv_counts[n] =
+                    is_self ? 0 : distributor.numImport( n ) * element_bytes;
+                send_displs[n] = send_offset;
+                recv_displs[n] = recv_offset;
+                send_offset += send_counts[n];
+                recv_offset += distributor.numImport( n ) * element_bytes;
+            }
+            const int ec = MPI_Neighbor_alltoallv(
+                mpi_send_buffer.data(), send_counts.data(),
+                send_displs.data(), MPI_BYTE, mpi_recv_buffer.data(),
+                recv_counts.data(), recv_displs.data(), MPI_BYTE,
+                distributor.graphComm() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+        }
+        else
+        {
+            // The distributor has its own communication space so choose any
+            // tag.
+            const int mpi_tag = 1234;
+
+            // Post non-blocking receives.
+            std::vector<MPI_Request> requests;
+            requests.reserve( num_n );
+            std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+            for ( int n = 0; n < num_n; ++n )
+            {
+                recv_range.second =
+                    recv_range.first + distributor.numImport( n );
+
+                if ( ( distributor.numImport( n ) > 0 ) &&
+                     ( distributor.neighborRank( n ) != my_rank ) &&
+                     !( node_shared && distributor.neighborIsOnNode( n ) ) )
+                {
+                    auto recv_subview = Kokkos::subview(
+                        mpi_recv_buffer, recv_range, Kokkos::ALL );
+
+                    requests.push_back( MPI_Request() );
+
+                    MPI_Irecv( recv_subview.data(),
+                               recv_subview.size() *
+                                   sizeof( typename Slice_t::value_type ),
+                               MPI_BYTE, distributor.neighborRank( n ),
+                               mpi_tag, distributor.comm(),
+                               &( requests.back() ) );
+                }
+
+                recv_range.first = recv_range.second;
+            }
+
+            // Do blocking sends. The on-node data stays in the send buffer
+            // for the shared-memory exchange.
+            std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+            for ( int n = 0; n < num_n; ++n )
+            {
+                if ( ( distributor.numExport( n ) > 0 ) &&
+                     ( distributor.neighborRank( n ) != my_rank ) )
+                {
+                    send_range.second =
+                        send_range.first + distributor.numExport( n );
+
+                    if ( !( node_shared &&
+                            distributor.neighborIsOnNode( n ) ) )
+                    {
+                        auto send_subview = Kokkos::subview(
+                            mpi_send_buffer, send_range, Kokkos::ALL );
+
+                        MPI_Send( send_subview.data(),
+                                  send_subview.size() *
+                                      sizeof( typename Slice_t::value_type ),
+                                  MPI_BYTE, distributor.neighborRank( n ),
+                                  mpi_tag, distributor.comm() );
+                    }
+
+                    send_range.first = send_range.second;
+                }
+            }
+
+            // Exchange the on-node transfers through direct shared-memory
+            // copies while the network messages are in flight.
+            if ( node_shared )
+                Impl::exchangeOnNodeShared(
+                    distributor,
+                    reinterpret_cast<const char*>( mpi_send_buffer.data() ),
+                    reinterpret_cast<char*>( mpi_recv_buffer.data() ),
+                    num_comp * sizeof( typename Slice_t::value_type ),
+                    my_rank );
+
+            // Wait on non-blocking receives.
+            std::vector<MPI_Status> status( requests.size() );
+            const int ec =
+                MPI_Waitall( requests.size(), requests.data(), status.data() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+        }
+    };
 
-    // Post non-blocking receives.
-    std::vector<MPI_Request> requests;
-    requests.reserve( num_n );
-    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
+    // Pass the device buffers directly to MPI or stage them through host
+    // memory if the MPI library cannot access device allocations.
+    if ( distributor.deviceDirectEnabled() )
+        do_exchange( send_buffer, recv_buffer );
+    else if ( distributor.neighborCollectivesEnabled() )
     {
-        recv_range.second = recv_range.first + distributor.numImport( n );
-
-        if ( ( distributor.numImport( n ) > 0 ) &&
-             ( distributor.neighborRank( n ) != my_rank ) )
+        // The collective needs the whole send buffer at once so stage a
+        // single copy through pooled pinned host allocations.
+        PinnedMirror<decltype( send_buffer )> send_stage(
+            distributor.pinnedPool(), send_buffer );
+        PinnedMirror<decltype( recv_buffer )> recv_stage(
+            distributor.pinnedPool(), recv_buffer );
+        Kokkos::deep_copy( send_stage.view, send_buffer );
+        do_exchange( send_stage.view, recv_stage.view );
+
+        // Copy back only the received section - the self-send section at
+        // the front of the receive buffer was already filled on device.
+        if ( distributor.totalNumImport() > num_stay )
         {
-            auto recv_subview =
-                Kokkos::subview( recv_buffer, recv_range, Kokkos::ALL );
+            std::pair<std::size_t, std::size_t> mpi_range = {
+                num_stay, distributor.totalNumImport() };
+            auto recv_dev_subview =
+                Kokkos::subview( recv_buffer, mpi_range, Kokkos::ALL );
+            auto recv_host_subview =
+                Kokkos::subview( recv_stage.view, mpi_range, Kokkos::ALL );
+            Kokkos::deep_copy( recv_dev_subview, recv_host_subview );
+        }
+    }
+    else
+    {
+        // The point-to-point path pipelines chunked pinned staging copies
+        // with the sends.
+        Impl::pinnedStagedDistribute(
+            distributor, send_buffer, recv_buffer,
+            num_comp * sizeof( typename Slice_t::value_type ), num_stay,
+            my_rank, node_shared );
+    }
 
-            requests.push_back( MPI_Request() );
+    // Extract the data from the receive buffer into the destination Slice.
+    auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto s = Slice_t::index_type::s( i );
+        auto a = Slice_t::index_type::a( i );
+        std::size_t dst_offset = s * dst.stride( 0 ) + a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            dst_data[dst_offset + n * Slice_t::vector_length] =
+                recv_buffer( i, n );
+    };
+    Kokkos::RangePolicy<typename Distributor_t::execution_space>
+        extract_recv_buffer_policy( 0, distributor.totalNumImport() );
+    Kokkos::parallel_for( "Cabana::migrate::extract_recv_buffer",
+                          extract_recv_buffer_policy,
+                          extract_recv_buffer_func );
+    Kokkos::fence();
 
-            MPI_Irecv( recv_subview.data(),
-                       recv_subview.size() *
-                           sizeof( typename Slice_t::value_type ),
-                       MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
-                       distributor.comm(), &( requests.back() ) );
-        }
+    // Barrier before completing to ensure synchronization.
+    MPI_Barrier( distributor.comm() );
+}
 
-        recv_range.first = recv_range.second;
-    }
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously migrate contribution data to owner ranks and
+  combine it into an owner array with a reduction operator.
+
+  Partial contributions computed away from the owner of an element (e.g.
+  partial forces in a long-range solver) are traditionally migrated as
+  (index, value) tuples and then sorted and reduced on the owner. This
+  primitive fuses the reduction into the migration unpack: each export
+  carries the index of its target element in the owner's destination slice
+  and its value, and the receive buffer is combined directly into the
+  destination with the given reduction operator. No intermediate tuple
+  container or post-migration sort is needed. The destination is not
+  overwritten - contributions combine with the values already there, so
+  initialize it (e.g. to zero for a sum) before calling.
 
-    // Do blocking sends.
-    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
+  \tparam Distributor_t Distributor type - must be a distributor.
+
+  \tparam Slice_t Slice type - must be a Slice.
+
+  \tparam IndexViewType Integer Kokkos view type holding the owner-local
+  index of each export's target element.
+
+  \tparam ReduceOp Reduction operator type - must be a ScatterReduce tag
+  with an atomic apply (Sum, Min, or Max).
+
+  \param distributor The distributor to use for the migration. Each
+  export's destination rank is the owner its contribution is combined on.
+
+  \param src The slice of contribution values. Must have the same number
+  of elements as the inputs used to construct the distributor.
+
+  \param export_indices The index in the destination rank's dst slice
+  that each element of src is combined into. Must be the same size as src.
+
+  \param dst The slice the migrated contributions are combined into on
+  the owner rank. Indexed by the migrated indices, not by import order, so
+  it is sized by the owner's data and not by totalNumImport().
+
+  \param reduce_op The reduction operator combining each contribution
+  with the destination value.
+*/
+template <class Distributor_t, class Slice_t, class IndexViewType,
+          class ReduceOp>
+void migrateReduce(
+    const Distributor_t& distributor, const Slice_t& src,
+    const IndexViewType& export_indices, Slice_t& dst, ReduceOp reduce_op,
+    typename std::enable_if<( is_distributor<Distributor_t>::value &&
+                              is_slice<Slice_t>::value ),
+                            int>::type* = 0 )
+{
+    using value_type = typename Slice_t::value_type;
+    using index_type = typename IndexViewType::non_const_value_type;
+    static_assert( std::is_integral<index_type>::value,
+                   "Export indices must be an integral type" );
+
+    // Check that src and the indices are the right size.
+    if ( src.size() != distributor.exportSize() )
+        throw std::runtime_error( "Source is the wrong size for migration!" );
+    if ( export_indices.size() != src.size() )
+        throw std::runtime_error(
+            "Export indices are the wrong size for migration!" );
+
+    // Get the number of components in the slices.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < src.rank(); ++d )
+        num_comp *= src.extent( d );
+
+    // Each element travels as its owner-local index followed by its
+    // component values, padded so both segments and each element are
+    // aligned in the byte buffers.
+    constexpr std::size_t element_align =
+        ( alignof( index_type ) > alignof( value_type ) )
+            ? alignof( index_type )
+            : alignof( value_type );
+    constexpr std::size_t value_offset =
+        ( ( sizeof( index_type ) + alignof( value_type ) - 1 ) /
+          alignof( value_type ) ) *
+        alignof( value_type );
+    const std::size_t element_bytes =
+        ( ( value_offset + num_comp * sizeof( value_type ) +
+            element_align - 1 ) /
+          element_align ) *
+        element_align;
+
+    // Get the raw slice data.
+    auto src_data = src.data();
+    auto dst_data = dst.data();
+
+    // Get the MPI rank we are currently on.
+    int my_rank = -1;
+    MPI_Comm_rank( distributor.comm(), &my_rank );
+
+    // Get the number of neighbors.
+    int num_n = distributor.numNeighbor();
+
+    // Calculate the number of elements that are staying on this rank. As
+    // in migrate they are packed directly into the receive buffer.
+    std::size_t num_stay =
+        ( num_n > 0 && distributor.neighborRank( 0 ) == my_rank )
+            ? distributor.numExport( 0 )
+            : 0;
+
+    // Get the send and receive byte buffers.
+    std::size_t num_send = distributor.totalNumExport() - num_stay;
+    auto send_buffer =
+        distributor.template getSendBuffer<char>( num_send, element_bytes );
+    auto recv_buffer = distributor.template getReceiveBuffer<char>(
+        distributor.totalNumImport(), element_bytes );
+
+    // Get the steering vector for the sends.
+    auto steering = distributor.getExportSteering();
+
+    // Pack each contribution as its destination index and values.
+    auto build_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
     {
-        if ( ( distributor.numExport( n ) > 0 ) &&
-             ( distributor.neighborRank( n ) != my_rank ) )
+        char* element = ( i < num_stay )
+                            ? &recv_buffer( i, 0 )
+                            : &send_buffer( i - num_stay, 0 );
+        *reinterpret_cast<index_type*>( element ) =
+            export_indices( steering( i ) );
+        value_type* values =
+            reinterpret_cast<value_type*>( element + value_offset );
+        auto s_src = Slice_t::index_type::s( steering( i ) );
+        auto a_src = Slice_t::index_type::a( steering( i ) );
+        std::size_t src_offset = s_src * src.stride( 0 ) + a_src;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            values[n] = src_data[src_offset + n * Slice_t::vector_length];
+    };
+    Kokkos::RangePolicy<typename Distributor_t::execution_space>
+        build_send_buffer_policy( 0, distributor.totalNumExport() );
+    Kokkos::parallel_for( "Cabana::migrateReduce::build_send_buffer",
+                          build_send_buffer_policy, build_send_buffer_func );
+    Kokkos::fence();
+
+    // Issue the exchange on the given send and receive buffers. A generic
+    // lambda so the same code runs on the device buffers or on host
+    // staging copies.
+    auto do_exchange = [&]( auto& mpi_send_buffer, auto& mpi_recv_buffer ) {
+        // The distributor has its own communication space so choose any
+        // tag.
+        const int mpi_tag = 1234;
+
+        // Post non-blocking receives.
+        std::vector<MPI_Request> requests;
+        requests.reserve( num_n );
+        std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+        for ( int n = 0; n < num_n; ++n )
         {
-            send_range.second = send_range.first + distributor.numExport( n );
+            recv_range.second = recv_range.first + distributor.numImport( n );
 
-            auto send_subview =
-                Kokkos::subview( send_buffer, send_range, Kokkos::ALL );
+            if ( ( distributor.numImport( n ) > 0 ) &&
+                 ( distributor.neighborRank( n ) != my_rank ) )
+            {
+                auto recv_subview = Kokkos::subview(
+                    mpi_recv_buffer, recv_range, Kokkos::ALL );
 
-            MPI_Send( send_subview.data(),
-                      send_subview.size() *
-                          sizeof( typename Slice_t::value_type ),
-                      MPI_BYTE, distributor.neighborRank( n ), mpi_tag,
-                      distributor.comm() );
+                requests.push_back( MPI_Request() );
 
-            send_range.first = send_range.second;
+                MPI_Irecv( recv_subview.data(), recv_subview.size(), MPI_BYTE,
+                           distributor.neighborRank( n ), mpi_tag,
+                           distributor.comm(), &( requests.back() ) );
+            }
+
+            recv_range.first = recv_range.second;
         }
-    }
 
-    // Wait on non-blocking receives.
-    std::vector<MPI_Status> status( requests.size() );
-    const int ec =
-        MPI_Waitall( requests.size(), requests.data(), status.data() );
-    if ( MPI_SUCCESS != ec )
-        throw std::logic_error( "Failed MPI Communication" );
+        // Do blocking sends.
+        std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+        for ( int n = 0; n < num_n; ++n )
+        {
+            if ( ( distributor.numExport( n ) > 0 ) &&
+                 ( distributor.neighborRank( n ) != my_rank ) )
+            {
+                send_range.second =
+                    send_range.first + distributor.numExport( n );
 
-    // Extract the data from the receive buffer into the destination Slice.
+                auto send_subview = Kokkos::subview(
+                    mpi_send_buffer, send_range, Kokkos::ALL );
+
+                MPI_Send( send_subview.data(), send_subview.size(), MPI_BYTE,
+                          distributor.neighborRank( n ), mpi_tag,
+                          distributor.comm() );
+
+                send_range.first = send_range.second;
+            }
+        }
+
+        // Wait on non-blocking receives.
+        std::vector<MPI_Status> status( requests.size() );
+        const int ec =
+            MPI_Waitall( requests.size(), requests.data(), status.data() );
+        if ( MPI_SUCCESS != ec )
+            throw std::logic_error( "Failed MPI Communication" );
+    };
+
+    // Pass the device buffers directly to MPI or stage them through pooled
+    // pinned host memory if the MPI library cannot access device
+    // allocations.
+    if ( distributor.deviceDirectEnabled() )
+        do_exchange( send_buffer, recv_buffer );
+    else
+    {
+        PinnedMirror<decltype( send_buffer )> send_stage(
+            distributor.pinnedPool(), send_buffer );
+        PinnedMirror<decltype( recv_buffer )> recv_stage(
+            distributor.pinnedPool(), recv_buffer );
+        Kokkos::deep_copy( send_stage.view, send_buffer );
+        do_exchange( send_stage.view, recv_stage.view );
+
+        // Copy back only the received section - the self section at the
+        // front of the receive buffer was already filled on device.
+        if ( distributor.totalNumImport() > num_stay )
+        {
+            std::pair<std::size_t, std::size_t> mpi_range = {
+                num_stay, distributor.totalNumImport() };
+            auto recv_dev_subview =
+                Kokkos::subview( recv_buffer, mpi_range, Kokkos::ALL );
+            auto recv_host_subview =
+                Kokkos::subview( recv_stage.view, mpi_range, Kokkos::ALL );
+            Kokkos::deep_copy( recv_dev_subview, recv_host_subview );
+        }
+    }
+
+    // Combine the received contributions into the destination at the
+    // migrated indices. Atomics are required because an element may
+    // receive contributions from many sources.
     auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
     {
-        auto s = Slice_t::index_type::s( i );
-        auto a = Slice_t::index_type::a( i );
+        const char* element = &recv_buffer( i, 0 );
+        const index_type idx =
+            *reinterpret_cast<const index_type*>( element );
+        const value_type* values =
+            reinterpret_cast<const value_type*>( element + value_offset );
+        auto s = Slice_t::index_type::s( idx );
+        auto a = Slice_t::index_type::a( idx );
         std::size_t dst_offset = s * dst.stride( 0 ) + a;
         for ( std::size_t n = 0; n < num_comp; ++n )
-            dst_data[dst_offset + n * Slice_t::vector_length] =
-                recv_buffer( i, n );
+            Impl::scatterReduceApply(
+                reduce_op,
+                &dst_data[dst_offset + n * Slice_t::vector_length],
+                values[n] );
     };
     Kokkos::RangePolicy<typename Distributor_t::execution_space>
         extract_recv_buffer_policy( 0, distributor.totalNumImport() );
-    Kokkos::parallel_for( "Cabana::migrate::extract_recv_buffer",
+    Kokkos::parallel_for( "Cabana::migrateReduce::extract_recv_buffer",
                           extract_recv_buffer_policy,
                           extract_recv_buffer_func );
     Kokkos::fence();
@@ -579,6 +1610,24 @@ void migrate( const Distributor_t& distributor, const Slice_t& src,
     MPI_Barrier( distributor.comm() );
 }
 
+/*!
+  \brief Synchronously migrate contribution data to owner ranks and sum it
+  into an owner array.
+
+  Equivalent to the migrateReduce overload with ScatterReduce::Sum.
+*/
+template <class Distributor_t, class Slice_t, class IndexViewType>
+void migrateReduce(
+    const Distributor_t& distributor, const Slice_t& src,
+    const IndexViewType& export_indices, Slice_t& dst,
+    typename std::enable_if<( is_distributor<Distributor_t>::value &&
+                              is_slice<Slice_t>::value ),
+                            int>::type* = 0 )
+{
+    migrateReduce( distributor, src, export_indices, dst,
+                   ScatterReduce::Sum() );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
@@ -0,0 +1,351 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_DynamicAoSoA.hpp
+  \brief Array-of-Struct-of-Arrays described at runtime
+*/
+#ifndef CABANA_DYNAMICAOSOA_HPP
+#define CABANA_DYNAMICAOSOA_HPP
+
+#include <impl/Cabana_Index.hpp>
+#include <impl/Cabana_PerformanceTraits.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Runtime description of one member of a DynamicAoSoA.
+
+  Describes a member as an array of \c components elements of an
+  unstructured value type of \c value_bytes each. The value type itself is
+  only named when a typed slice is taken.
+*/
+struct MemberDescriptor
+{
+    //! Member name used to look the member up.
+    std::string name;
+    //! Size of a single value of the member value type in bytes.
+    std::size_t value_bytes;
+    //! Number of values per tuple (e.g. 3 for a coordinate).
+    std::size_t components;
+};
+
+/*!
+  \brief Create a runtime member descriptor for a given value type.
+  \tparam T The member value type.
+  \param name The member name.
+  \param components The number of values per tuple.
+*/
+template <class T>
+MemberDescriptor createMemberDescriptor( const std::string& name,
+                                         const std::size_t components = 1 )
+{
+    return MemberDescriptor{ name, sizeof( T ), components };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Typed view of one member of a DynamicAoSoA.
+
+  Holds the raw member layout - base address, struct stride, and component
+  count - resolved from the runtime description when the slice is taken.
+  The value type is a compile-time template parameter, so inside a kernel
+  every access specializes to the same pointer arithmetic as a static
+  Slice: one struct-stride multiply and a vector-length offset per element.
+
+  \tparam T The member value type.
+  \tparam VectorLength The vector length of the container.
+*/
+template <class T, int VectorLength>
+struct DynamicSlice
+{
+    //! Member value type.
+    using value_type = T;
+    //! Index type.
+    using index_type = Impl::Index<VectorLength>;
+    //! Vector length.
+    static constexpr int vector_length = VectorLength;
+
+    //! Base address of the member block in the first struct.
+    char* base;
+    //! Distance between consecutive structs in bytes.
+    std::size_t struct_bytes;
+    //! Number of values per tuple.
+    std::size_t num_component;
+    //! Number of tuples.
+    std::size_t num_tuple;
+
+    //! Get the number of tuples.
+    KOKKOS_INLINE_FUNCTION
+    std::size_t size() const { return num_tuple; }
+
+    //! Get the number of values per tuple.
+    KOKKOS_INLINE_FUNCTION
+    std::size_t components() const { return num_component; }
+
+    //! Access a scalar member value.
+    KOKKOS_FORCEINLINE_FUNCTION
+    T& operator()( const std::size_t i ) const
+    {
+        return reinterpret_cast<T*>(
+            base + index_type::s( i ) * struct_bytes )[index_type::a( i )];
+    }
+
+    //! Access a member value component. Components of a tuple are stored
+    //! as separate vector-length arrays, matching the static SoA layout.
+    KOKKOS_FORCEINLINE_FUNCTION
+    T& operator()( const std::size_t i, const std::size_t d ) const
+    {
+        return reinterpret_cast<T*>( base + index_type::s( i ) *
+                                                struct_bytes )[d * VectorLength +
+                                                               index_type::a( i )];
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Array-of-Struct-of-Arrays with a member set described at runtime.
+
+  The static AoSoA fixes its members at compile time, which forces
+  applications that discover particle attributes at runtime (e.g. from an
+  input deck driving plugins) to compile the superset of all possible
+  members and allocate the unused ones. This container takes the member
+  set as a vector of runtime descriptors instead and computes the same
+  blocked struct-of-arrays layout - vector-length value blocks per member,
+  each aligned to its value size - so only the described members consume
+  memory.
+
+  Element access goes through typed slices: slice<T>() resolves a member's
+  byte offsets once on the host and returns a DynamicSlice whose value
+  type is a compile-time parameter, so each kernel instantiation
+  specializes the access path and the per-element cost matches the static
+  container. The value size of T is checked against the descriptor when
+  the slice is taken.
+
+  \tparam MemorySpace The memory space in which the data resides.
+
+  \tparam VectorLength (optional) The vector length within the structs. If
+  not specified, this defaults to the preferred layout for the memory
+  space.
+*/
+template <class MemorySpace,
+          int VectorLength = Impl::PerformanceTraits<typename MemorySpace::
+                                 execution_space>::vector_length>
+class DynamicAoSoA
+{
+  public:
+    //! Memory space.
+    using memory_space = MemorySpace;
+
+    //! Execution space.
+    using execution_space = typename memory_space::execution_space;
+
+    //! Size type.
+    using size_type = typename memory_space::size_type;
+
+    //! Vector length (size of the arrays held by the structs).
+    static constexpr int vector_length = VectorLength;
+
+    //! Member slice type for a given value type.
+    template <class T>
+    using slice_type = DynamicSlice<T, vector_length>;
+
+    /*!
+      \brief Allocate a container with n tuples of the described members.
+
+      \param label A label for the data structure.
+      \param members The runtime member descriptors.
+      \param n The number of tuples in the container.
+    */
+    DynamicAoSoA( const std::string& label,
+                  const std::vector<MemberDescriptor>& members,
+                  const size_type n = 0 )
+        : _members( members )
+        , _size( 0 )
+        , _num_soa( 0 )
+        , _data( Kokkos::ViewAllocateWithoutInitializing( label ), 0 )
+    {
+        if ( _members.empty() )
+            throw std::invalid_argument(
+                "DynamicAoSoA requires at least one member" );
+
+        // Compute the byte offset of each member block within a struct.
+        // Each block holds a vector length of values per component and is
+        // aligned to its value size; the struct is padded to the largest
+        // value size so every struct starts aligned.
+        std::size_t offset = 0;
+        std::size_t max_align = 1;
+        for ( const auto& m : _members )
+        {
+            if ( 0 == m.value_bytes || 0 == m.components )
+                throw std::invalid_argument(
+                    "Member value size and components must not be zero" );
+            offset =
+                ( ( offset + m.value_bytes - 1 ) / m.value_bytes ) *
+                m.value_bytes;
+            _offsets.push_back( offset );
+            offset += m.value_bytes * m.components * vector_length;
+            if ( m.value_bytes > max_align )
+                max_align = m.value_bytes;
+        }
+        _struct_bytes = ( ( offset + max_align - 1 ) / max_align ) * max_align;
+
+        resize( n );
+    }
+
+    //! Returns the data structure label.
+    std::string label() const { return _data.label(); }
+
+    //! Returns the number of tuples in the container.
+    size_type size() const { return _size; }
+
+    //! Returns if the container is empty or not.
+    bool empty() const { return ( 0 == _size ); }
+
+    //! Get the number of structs-of-arrays in the container.
+    size_type numSoA() const { return _num_soa; }
+
+    //! Get the number of members in the container.
+    std::size_t numMember() const { return _members.size(); }
+
+    //! Get the descriptor of a member.
+    const MemberDescriptor& member( const std::size_t m ) const
+    {
+        return _members.at( m );
+    }
+
+    //! Get the number of bytes in one struct.
+    std::size_t structBytes() const { return _struct_bytes; }
+
+    //! Get the number of bytes of memory allocated by the container.
+    std::size_t memoryUsage() const { return _data.span(); }
+
+    //! Get the raw byte storage of the container.
+    Kokkos::View<char*, memory_space> data() const { return _data; }
+
+    /*!
+      \brief Get the index of a member by name.
+      \param name The member name.
+      \return The member index. Throws if no member has the given name.
+    */
+    std::size_t memberIndex( const std::string& name ) const
+    {
+        for ( std::size_t m = 0; m < _members.size(); ++m )
+            if ( _members[m].name == name )
+                return m;
+        throw std::runtime_error( "No member with name " + name );
+    }
+
+    /*!
+      \brief Resizes the container so that it contains n tuples.
+
+      Existing tuples are preserved. If the number of structs changes the
+      data is reallocated and all slices taken before this call are
+      invalidated.
+    */
+    void resize( const size_type n )
+    {
+        size_type num_soa = n / vector_length;
+        if ( 0 < n % vector_length )
+            ++num_soa;
+        _size = n;
+        if ( num_soa == _num_soa )
+            return;
+
+        // Allocate new storage and copy the common struct prefix. The
+        // layout within a struct does not change so the copy is a single
+        // contiguous byte copy.
+        Kokkos::View<char*, memory_space> resized_data(
+            Kokkos::ViewAllocateWithoutInitializing( _data.label() ),
+            num_soa * _struct_bytes );
+        size_type copy_soa = ( num_soa < _num_soa ) ? num_soa : _num_soa;
+        if ( 0 < copy_soa )
+            Kokkos::deep_copy(
+                Kokkos::subview(
+                    resized_data,
+                    Kokkos::pair<size_type, size_type>(
+                        0, copy_soa * _struct_bytes ) ),
+                Kokkos::subview( _data, Kokkos::pair<size_type, size_type>(
+                                            0, copy_soa * _struct_bytes ) ) );
+        _data = resized_data;
+        _num_soa = num_soa;
+    }
+
+    /*!
+      \brief Create a typed slice of a member.
+
+      \tparam T The member value type. Its size is checked against the
+      member descriptor.
+
+      \param m The member index.
+      \return A typed slice of the member.
+    */
+    template <class T>
+    slice_type<T> slice( const std::size_t m ) const
+    {
+        if ( m >= _members.size() )
+            throw std::runtime_error( "Member index out of range" );
+        if ( sizeof( T ) != _members[m].value_bytes )
+            throw std::runtime_error( "Slice value type size does not match "
+                                      "member descriptor of " +
+                                      _members[m].name );
+        return slice_type<T>{ const_cast<char*>( _data.data() ) + _offsets[m],
+                              _struct_bytes, _members[m].components, _size };
+    }
+
+    /*!
+      \brief Create a typed slice of a member by name.
+
+      \tparam T The member value type. Its size is checked against the
+      member descriptor.
+
+      \param name The member name.
+      \return A typed slice of the member.
+    */
+    template <class T>
+    slice_type<T> slice( const std::string& name ) const
+    {
+        return slice<T>( memberIndex( name ) );
+    }
+
+  private:
+    // Member descriptors.
+    std::vector<MemberDescriptor> _members;
+
+    // Byte offset of each member block within a struct.
+    std::vector<std::size_t> _offsets;
+
+    // Size of one struct in bytes.
+    std::size_t _struct_bytes;
+
+    // Total number of tuples in the container.
+    size_type _size;
+
+    // Number of structs-of-arrays in the array.
+    size_type _num_soa;
+
+    // Raw struct storage.
+    Kokkos::View<char*, memory_space> _data;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_DYNAMICAOSOA_HPP
@@ -0,0 +1,660 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Ensemble.hpp
+  \brief Batched processing of many independent particle replicas
+*/
+#ifndef CABANA_ENSEMBLE_HPP
+#define CABANA_ENSEMBLE_HPP
+
+#include <Cabana_LinkedCellList.hpp>
+#include <Cabana_NeighborList.hpp>
+#include <Cabana_Parallel.hpp>
+#include <Cabana_Profiling.hpp>
+#include <Cabana_Slice.hpp>
+#include <Cabana_VerletList.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <numeric>
+#include <vector>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Replica segmentation of a single super-AoSoA.
+
+  Ensemble simulations (e.g. replica exchange) run many independent copies of
+  a small system. Dispatching a kernel per replica leaves wide devices mostly
+  idle - a 5k particle replica cannot fill a modern GPU - and pays the launch
+  latency once per replica. The ensemble instead stores all replicas
+  back-to-back in one AoSoA and this class records where each replica's
+  contiguous segment begins, so a single launch over the concatenated range
+  covers every replica.
+
+  The segmentation is the ensemble analog of the CSR row offsets: replica r
+  owns the global particle indices [replicaBegin(r), replicaEnd(r)). For the
+  common case of equally sized replicas the replica of a particle is a single
+  division; otherwise it is a binary search of the offsets.
+
+  \tparam MemorySpace Kokkos memory space in which the offsets live. Must
+  match the memory space of the ensemble AoSoA.
+*/
+template <class MemorySpace>
+class Ensemble
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Memory space size type.
+    using size_type = typename memory_space::size_type;
+    //! Offset view type.
+    using OffsetView = Kokkos::View<size_type*, memory_space>;
+
+    //! Default constructor.
+    Ensemble()
+        : _num_replica( 0 )
+        , _total_particles( 0 )
+        , _uniform_size( 0 )
+    {
+    }
+
+    /*!
+      \brief Uniform constructor.
+
+      \param num_replica The number of replicas in the ensemble.
+      \param replica_size The number of particles in every replica.
+    */
+    Ensemble( const std::size_t num_replica, const std::size_t replica_size )
+        : _num_replica( num_replica )
+        , _total_particles( num_replica * replica_size )
+        , _uniform_size( replica_size )
+    {
+        buildOffsets( std::vector<std::size_t>( num_replica, replica_size ) );
+    }
+
+    /*!
+      \brief General constructor.
+
+      \param replica_sizes The number of particles in each replica.
+    */
+    Ensemble( const std::vector<std::size_t>& replica_sizes )
+        : _num_replica( replica_sizes.size() )
+        , _total_particles( std::accumulate( replica_sizes.begin(),
+                                             replica_sizes.end(),
+                                             std::size_t( 0 ) ) )
+        , _uniform_size( 0 )
+    {
+        // Detect uniform sizes to enable the constant-time replica lookup.
+        if ( !replica_sizes.empty() )
+        {
+            bool uniform = true;
+            for ( auto s : replica_sizes )
+                if ( s != replica_sizes.front() )
+                    uniform = false;
+            if ( uniform )
+                _uniform_size = replica_sizes.front();
+        }
+        buildOffsets( replica_sizes );
+    }
+
+    //! Get the number of replicas in the ensemble.
+    KOKKOS_INLINE_FUNCTION
+    std::size_t numReplica() const { return _num_replica; }
+
+    //! Get the total number of particles over all replicas.
+    KOKKOS_INLINE_FUNCTION
+    std::size_t totalParticles() const { return _total_particles; }
+
+    //! Get the first global particle index of a replica.
+    KOKKOS_INLINE_FUNCTION
+    size_type replicaBegin( const std::size_t r ) const
+    {
+        return _offsets( r );
+    }
+
+    //! Get the global particle index one past the end of a replica.
+    KOKKOS_INLINE_FUNCTION
+    size_type replicaEnd( const std::size_t r ) const
+    {
+        return _offsets( r + 1 );
+    }
+
+    //! Get the number of particles in a replica.
+    KOKKOS_INLINE_FUNCTION
+    size_type replicaSize( const std::size_t r ) const
+    {
+        return _offsets( r + 1 ) - _offsets( r );
+    }
+
+    /*!
+      \brief Get the replica owning a global particle index.
+
+      Uniform ensembles resolve this with a division; otherwise the offsets
+      are binary searched.
+    */
+    KOKKOS_INLINE_FUNCTION
+    std::size_t replicaId( const size_type p ) const
+    {
+        if ( _uniform_size > 0 )
+            return p / _uniform_size;
+
+        // Find the last offset less than or equal to p.
+        std::size_t lo = 0;
+        std::size_t hi = _num_replica;
+        while ( hi - lo > 1 )
+        {
+            std::size_t mid = lo + ( hi - lo ) / 2;
+            if ( _offsets( mid ) <= p )
+                lo = mid;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+  private:
+    void buildOffsets( const std::vector<std::size_t>& replica_sizes )
+    {
+        _offsets = OffsetView(
+            Kokkos::ViewAllocateWithoutInitializing( "ensemble_offsets" ),
+            _num_replica + 1 );
+        auto host_offsets = Kokkos::create_mirror_view( _offsets );
+        host_offsets( 0 ) = 0;
+        for ( std::size_t r = 0; r < _num_replica; ++r )
+            host_offsets( r + 1 ) = host_offsets( r ) + replica_sizes[r];
+        Kokkos::deep_copy( _offsets, host_offsets );
+    }
+
+    std::size_t _num_replica;
+    std::size_t _total_particles;
+    std::size_t _uniform_size;
+    OffsetView _offsets;
+};
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+template <typename>
+struct is_ensemble_impl : public std::false_type
+{
+};
+
+template <typename MemorySpace>
+struct is_ensemble_impl<Ensemble<MemorySpace>> : public std::true_type
+{
+};
+//! \endcond
+
+//! Ensemble static type checker.
+template <class T>
+struct is_ensemble
+    : public is_ensemble_impl<typename std::remove_cv<T>::type>::type
+{
+};
+
+//---------------------------------------------------------------------------//
+// Ensemble Parallel For
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a functor in parallel over every particle of every replica
+  with a single kernel launch.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam EnsembleType The ensemble segmentation type.
+  \tparam ExecParameters Execution policy parameters.
+
+  \param exec_policy The policy over the global (concatenated) particle
+  range. Must not extend past the total particle count of the ensemble.
+  \param functor The functor to execute in parallel. Must accept a replica
+  index and a global particle index.
+  \param ensemble The replica segmentation of the particle data.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+
+  The functor is called once per particle with the owning replica resolved
+  from the segmentation:
+
+  \code
+  void operator() ( const int replica, const int particle ) const ;
+  \endcode
+
+  where \c particle is the global index into the super-AoSoA. Per-replica
+  data (temperatures, random streams, box parameters) is indexed with the
+  replica argument while particle data is indexed with the global index, so
+  one launch spans the whole ensemble and device occupancy is set by the
+  total particle count rather than a single replica's.
+*/
+template <class FunctorType, class EnsembleType, class... ExecParameters>
+inline void ensemble_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const EnsembleType& ensemble,
+    const std::string& str = "",
+    typename std::enable_if<( is_ensemble<EnsembleType>::value ), int>::type* =
+        0 )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using index_type =
+        typename Kokkos::RangePolicy<ExecParameters...>::index_type;
+
+    static_assert( is_accessible_from<typename EnsembleType::memory_space,
+                                      execution_space>{},
+                   "" );
+
+    auto ensemble_func = KOKKOS_LAMBDA( const index_type p )
+    {
+        const index_type r = ensemble.replicaId( p );
+        Impl::functorTagDispatch<work_tag>( functor, r, p );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( exec_policy, ensemble_func );
+    else
+        Kokkos::parallel_for( str, exec_policy, ensemble_func );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a functor reduction in parallel over every particle of every
+  replica with a single kernel launch.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam EnsembleType The ensemble segmentation type.
+  \tparam ReduceType The reduction type.
+  \tparam ExecParameters Execution policy parameters.
+
+  \param exec_policy The policy over the global (concatenated) particle
+  range.
+  \param functor The functor to execute in parallel. Must accept a replica
+  index, a global particle index, and the reduction value.
+  \param ensemble The replica segmentation of the particle data.
+  \param reduce_val Scalar to be reduced across all indices. The reduction
+  is a sum.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_reduce called by this code and can be used for
+  identification and profiling purposes.
+
+  Reductions over a single replica (e.g. a replica's potential energy) are
+  expressed by contributing zero outside the replica of interest or, more
+  efficiently, by restricting the policy range to that replica's segment.
+*/
+template <class FunctorType, class EnsembleType, class ReduceType,
+          class... ExecParameters>
+inline void ensemble_parallel_reduce(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const EnsembleType& ensemble,
+    ReduceType& reduce_val, const std::string& str = "",
+    typename std::enable_if<( is_ensemble<EnsembleType>::value ), int>::type* =
+        0 )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using index_type =
+        typename Kokkos::RangePolicy<ExecParameters...>::index_type;
+
+    static_assert( is_accessible_from<typename EnsembleType::memory_space,
+                                      execution_space>{},
+                   "" );
+
+    auto ensemble_func =
+        KOKKOS_LAMBDA( const index_type p, ReduceType& ival )
+    {
+        const index_type r = ensemble.replicaId( p );
+        Impl::functorTagDispatch<work_tag>( functor, r, p, ival );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_reduce( exec_policy, ensemble_func, reduce_val );
+    else
+        Kokkos::parallel_reduce( str, exec_policy, ensemble_func, reduce_val );
+}
+
+//---------------------------------------------------------------------------//
+// Ensemble Verlet List
+//---------------------------------------------------------------------------//
+/*!
+  \brief Segment-local neighbor lists for all replicas built in one pass.
+
+  Each replica is an independent system - particles of different replicas
+  never interact even though they share the super-AoSoA. Building a
+  VerletList per replica would again serialize on launch count, so this list
+  bins all particles of all replicas at once using a composite bin key of
+  (replica, cell): particles land in the bin of their spatial cell within
+  their replica's private copy of the grid. The neighbor search then walks
+  the cell stencil inside the particle's own replica only, producing CSR
+  neighbor data in which every neighbor of a particle belongs to the same
+  replica. All passes (binning, counting, filling) iterate the concatenated
+  particle range, so the build cost is a fixed number of launches independent
+  of the replica count.
+
+  The resulting list implements the common NeighborList interface and can be
+  consumed by neighbor_parallel_for over the global particle range.
+
+  \tparam MemorySpace The Kokkos memory space for the list data.
+  \tparam AlgorithmTag Tag indicating whether to build a full or half
+  neighbor list.
+  \tparam IndexType Neighbor index type.
+*/
+template <class MemorySpace, class AlgorithmTag, class IndexType = int>
+class EnsembleVerletList
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Kokkos execution space.
+    using execution_space = typename memory_space::execution_space;
+    //! Memory space size type.
+    using size_type = typename memory_space::size_type;
+
+    //! Neighbor list data.
+    VerletListData<MemorySpace, VerletLayoutCSR, IndexType> _data;
+
+    //! Default constructor.
+    EnsembleVerletList() = default;
+
+    /*!
+      \brief Constructor. Builds the neighbor lists of all replicas.
+
+      \param x The slice containing the particle positions of the whole
+      ensemble.
+      \param ensemble The replica segmentation of the position slice.
+      \param neighborhood_radius The radius of the neighborhood.
+      \param cell_size_ratio The ratio of the cell size in the Cartesian grid
+      to the neighborhood radius.
+      \param grid_min The minimum value of the grid containing the particles
+      in each dimension. All replicas share the same grid bounds.
+      \param grid_max The maximum value of the grid containing the particles
+      in each dimension.
+    */
+    template <class PositionSlice, class EnsembleType>
+    EnsembleVerletList(
+        PositionSlice x, const EnsembleType& ensemble,
+        const typename PositionSlice::value_type neighborhood_radius,
+        const typename PositionSlice::value_type cell_size_ratio,
+        const typename PositionSlice::value_type grid_min[3],
+        const typename PositionSlice::value_type grid_max[3],
+        typename std::enable_if<( is_slice<PositionSlice>::value &&
+                                  is_ensemble<EnsembleType>::value ),
+                                int>::type* = 0 )
+    {
+        build( x, ensemble, neighborhood_radius, cell_size_ratio, grid_min,
+               grid_max );
+    }
+
+    /*!
+      \brief Given the positions build the neighbor lists of all replicas.
+
+      \param x The slice containing the particle positions of the whole
+      ensemble.
+      \param ensemble The replica segmentation of the position slice.
+      \param neighborhood_radius The radius of the neighborhood.
+      \param cell_size_ratio The ratio of the cell size in the Cartesian grid
+      to the neighborhood radius.
+      \param grid_min The minimum value of the grid containing the particles
+      in each dimension.
+      \param grid_max The maximum value of the grid containing the particles
+      in each dimension.
+    */
+    template <class PositionSlice, class EnsembleType>
+    void build( PositionSlice x, const EnsembleType& ensemble,
+                const typename PositionSlice::value_type neighborhood_radius,
+                const typename PositionSlice::value_type cell_size_ratio,
+                const typename PositionSlice::value_type grid_min[3],
+                const typename PositionSlice::value_type grid_max[3] )
+    {
+        Profiling::ScopedRegion region( "Cabana::EnsembleVerletList::build" );
+
+        using value_type = typename PositionSlice::value_type;
+
+        const std::size_t num_particle = ensemble.totalParticles();
+        const std::size_t num_replica = ensemble.numReplica();
+
+        // The stencil carries the shared Cartesian grid all replicas are
+        // binned against.
+        Impl::LinkedCellStencil<value_type> stencil(
+            neighborhood_radius, cell_size_ratio, grid_min, grid_max );
+        auto grid = stencil.grid;
+        const std::size_t num_cell = grid.totalNumCells();
+        const std::size_t num_bin = num_replica * num_cell;
+
+        Kokkos::RangePolicy<execution_space> particle_policy( 0,
+                                                              num_particle );
+
+        // Locate every particle of every replica in one pass. The composite
+        // bin key gives each replica a private block of cells so the
+        // spatial binning of all replicas is a single count-scan-scatter.
+        Kokkos::View<size_type*, memory_space> bin_ids(
+            Kokkos::ViewAllocateWithoutInitializing( "ensemble_bin_ids" ),
+            num_particle );
+        Kokkos::View<int*, memory_space> bin_counts( "ensemble_bin_counts",
+                                                     num_bin );
+        auto locate_op = KOKKOS_LAMBDA( const std::size_t p )
+        {
+            int ci, cj, ck;
+            grid.locatePoint( x( p, 0 ), x( p, 1 ), x( p, 2 ), ci, cj, ck );
+            size_type bin =
+                ensemble.replicaId( p ) * num_cell +
+                grid.cardinalCellIndex( ci, cj, ck );
+            bin_ids( p ) = bin;
+            Kokkos::atomic_increment( &bin_counts( bin ) );
+        };
+        Kokkos::parallel_for( "Cabana::EnsembleVerletList::locate",
+                              particle_policy, locate_op );
+
+        Kokkos::View<size_type*, memory_space> bin_offsets(
+            Kokkos::ViewAllocateWithoutInitializing( "ensemble_bin_offsets" ),
+            num_bin );
+        auto bin_scan_op = KOKKOS_LAMBDA( const std::size_t b,
+                                          size_type& update,
+                                          const bool final_pass )
+        {
+            if ( final_pass )
+                bin_offsets( b ) = update;
+            update += bin_counts( b );
+        };
+        Kokkos::parallel_scan(
+            "Cabana::EnsembleVerletList::bin_scan",
+            Kokkos::RangePolicy<execution_space>( 0, num_bin ), bin_scan_op );
+
+        Kokkos::View<size_type*, memory_space> bin_particles(
+            Kokkos::ViewAllocateWithoutInitializing(
+                "ensemble_bin_particles" ),
+            num_particle );
+        Kokkos::View<int*, memory_space> bin_fill( "ensemble_bin_fill",
+                                                   num_bin );
+        auto scatter_op = KOKKOS_LAMBDA( const std::size_t p )
+        {
+            size_type bin = bin_ids( p );
+            int j = Kokkos::atomic_fetch_add( &bin_fill( bin ), 1 );
+            bin_particles( bin_offsets( bin ) + j ) = p;
+        };
+        Kokkos::parallel_for( "Cabana::EnsembleVerletList::scatter",
+                              particle_policy, scatter_op );
+
+        // Count the neighbors of every particle. The stencil walk stays
+        // inside the particle's own replica block of bins.
+        _data.counts = Kokkos::View<IndexType*, memory_space>(
+            "ensemble_neighbor_counts", num_particle );
+        auto data = _data;
+        const value_type rsqr = neighborhood_radius * neighborhood_radius;
+        auto count_op = KOKKOS_LAMBDA( const std::size_t p )
+        {
+            const size_type replica_block =
+                ensemble.replicaId( p ) * num_cell;
+            const value_type x_p = x( p, 0 );
+            const value_type y_p = x( p, 1 );
+            const value_type z_p = x( p, 2 );
+
+            int ci, cj, ck;
+            grid.locatePoint( x_p, y_p, z_p, ci, cj, ck );
+            int cell = grid.cardinalCellIndex( ci, cj, ck );
+            int imin, imax, jmin, jmax, kmin, kmax;
+            stencil.getCells( cell, imin, imax, jmin, jmax, kmin, kmax );
+
+            IndexType count = 0;
+            for ( int i = imin; i < imax; ++i )
+                for ( int j = jmin; j < jmax; ++j )
+                    for ( int k = kmin; k < kmax; ++k )
+                    {
+                        if ( !stencil.cellInRange( ci, cj, ck, i, j, k ) )
+                            continue;
+                        size_type bin = replica_block +
+                                        grid.cardinalCellIndex( i, j, k );
+                        size_type n_offset = bin_offsets( bin );
+                        int num_n = bin_counts( bin );
+                        for ( int n = 0; n < num_n; ++n )
+                        {
+                            size_type nid = bin_particles( n_offset + n );
+                            const value_type x_n = x( nid, 0 );
+                            const value_type y_n = x( nid, 1 );
+                            const value_type z_n = x( nid, 2 );
+                            value_type dx = x_p - x_n;
+                            value_type dy = y_p - y_n;
+                            value_type dz = z_p - z_n;
+                            value_type dist_sqr =
+                                dx * dx + dy * dy + dz * dz;
+                            if ( dist_sqr <= rsqr &&
+                                 Impl::NeighborDiscriminator<AlgorithmTag>::isValid(
+                                     p, x_p, y_p, z_p, nid, x_n, y_n, z_n ) )
+                                ++count;
+                        }
+                    }
+            data.counts( p ) = count;
+        };
+        Kokkos::parallel_for( "Cabana::EnsembleVerletList::count",
+                              particle_policy, count_op );
+
+        // Exact-size the CSR storage.
+        _data.offsets = Kokkos::View<IndexType*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing(
+                "ensemble_neighbor_offsets" ),
+            num_particle );
+        data = _data;
+        IndexType total_neighbors = 0;
+        auto offset_scan_op = KOKKOS_LAMBDA( const std::size_t p,
+                                             IndexType& update,
+                                             const bool final_pass )
+        {
+            if ( final_pass )
+                data.offsets( p ) = update;
+            update += data.counts( p );
+        };
+        Kokkos::parallel_scan( "Cabana::EnsembleVerletList::offset_scan",
+                               particle_policy, offset_scan_op,
+                               total_neighbors );
+
+        _data.neighbors = Kokkos::View<IndexType*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "ensemble_neighbors" ),
+            total_neighbors );
+        Kokkos::deep_copy( _data.counts, 0 );
+        data = _data;
+
+        // Fill pass - identical traversal order to the count pass.
+        auto fill_op = KOKKOS_LAMBDA( const std::size_t p )
+        {
+            const size_type replica_block =
+                ensemble.replicaId( p ) * num_cell;
+            const value_type x_p = x( p, 0 );
+            const value_type y_p = x( p, 1 );
+            const value_type z_p = x( p, 2 );
+
+            int ci, cj, ck;
+            grid.locatePoint( x_p, y_p, z_p, ci, cj, ck );
+            int cell = grid.cardinalCellIndex( ci, cj, ck );
+            int imin, imax, jmin, jmax, kmin, kmax;
+            stencil.getCells( cell, imin, imax, jmin, jmax, kmin, kmax );
+
+            for ( int i = imin; i < imax; ++i )
+                for ( int j = jmin; j < jmax; ++j )
+                    for ( int k = kmin; k < kmax; ++k )
+                    {
+                        if ( !stencil.cellInRange( ci, cj, ck, i, j, k ) )
+                            continue;
+                        size_type bin = replica_block +
+                                        grid.cardinalCellIndex( i, j, k );
+                        size_type n_offset = bin_offsets( bin );
+                        int num_n = bin_counts( bin );
+                        for ( int n = 0; n < num_n; ++n )
+                        {
+                            size_type nid = bin_particles( n_offset + n );
+                            const value_type x_n = x( nid, 0 );
+                            const value_type y_n = x( nid, 1 );
+                            const value_type z_n = x( nid, 2 );
+                            value_type dx = x_p - x_n;
+                            value_type dy = y_p - y_n;
+                            value_type dz = z_p - z_n;
+                            value_type dist_sqr =
+                                dx * dx + dy * dy + dz * dz;
+                            if ( dist_sqr <= rsqr &&
+                                 Impl::NeighborDiscriminator<AlgorithmTag>::isValid(
+                                     p, x_p, y_p, z_p, nid, x_n, y_n, z_n ) )
+                                data.addNeighbor( p, nid );
+                        }
+                    }
+        };
+        Kokkos::parallel_for( "Cabana::EnsembleVerletList::fill",
+                              particle_policy, fill_op );
+        Kokkos::fence();
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Neighbor list interface implementation.
+//---------------------------------------------------------------------------//
+//! EnsembleVerletList NeighborList interface.
+template <class MemorySpace, class AlgorithmTag, class IndexType>
+class NeighborList<EnsembleVerletList<MemorySpace, AlgorithmTag, IndexType>>
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Neighbor list type.
+    using list_type = EnsembleVerletList<MemorySpace, AlgorithmTag, IndexType>;
+
+    //! Get the total number of neighbors (maximum size of CSR list).
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t maxNeighbor( const list_type& list )
+    {
+        return list._data.neighbors.extent( 0 );
+    }
+
+    //! Get the number of neighbors for a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t numNeighbor( const list_type& list,
+                                    const std::size_t particle_index )
+    {
+        return list._data.counts( particle_index );
+    }
+
+    //! Get the id for a neighbor for a given particle index and the index of
+    //! the neighbor relative to the particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t getNeighbor( const list_type& list,
+                                    const std::size_t particle_index,
+                                    const std::size_t neighbor_index )
+    {
+        return list._data.neighbors( list._data.offsets( particle_index ) +
+                                     neighbor_index );
+    }
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_ENSEMBLE_HPP
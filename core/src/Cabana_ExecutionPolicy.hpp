@@ -20,6 +20,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <cstddef>
+#include <stdexcept>
 #include <type_traits>
 
 namespace Cabana
@@ -116,6 +118,160 @@ class SimdPolicy
               Impl::StructRange<VectorLength, index_type>::structEnd( end ) )
         , _array_begin( Impl::Index<VectorLength>::a( begin ) )
         , _array_end( Impl::Index<VectorLength>::a( end ) )
+        , _chunk_size( 1 )
+    {
+    }
+
+    /*!
+      \brief Chunked range constructor.
+      \param begin The begininning of the 1D range. This will be decomposed
+      into 2D indices.
+      \param end The ending of the 1D range. This will be decomposed
+      into 2D indices.
+      \param chunk_size The number of structs each work item processes.
+
+      The policy schedules its work items dynamically, so the chunks form a
+      task queue the threads drain: threads that finish cheap chunks pick up
+      the remaining ones instead of idling. When per-struct costs are very
+      uneven (e.g. dense and empty regions of spatially sorted data) a chunk
+      size larger than one amortizes the scheduling overhead while keeping
+      the load balanced; a chunk size of one gives maximum balance.
+    */
+    SimdPolicy( const index_type begin, const index_type end,
+                const index_type chunk_size )
+        : base_type( ( Impl::StructRange<VectorLength, index_type>::size(
+                           begin, end ) +
+                       chunk_size - 1 ) /
+                         chunk_size,
+                     1, VectorLength )
+        , _struct_begin(
+              Impl::StructRange<VectorLength, index_type>::structBegin(
+                  begin ) )
+        , _struct_end(
+              Impl::StructRange<VectorLength, index_type>::structEnd( end ) )
+        , _array_begin( Impl::Index<VectorLength>::a( begin ) )
+        , _array_end( Impl::Index<VectorLength>::a( end ) )
+        , _chunk_size( chunk_size )
+    {
+    }
+
+    /*!
+      \brief Chunked range constructor with an explicit team size.
+      \param begin The begininning of the 1D range. This will be decomposed
+      into 2D indices.
+      \param end The ending of the 1D range. This will be decomposed
+      into 2D indices.
+      \param chunk_size The number of structs each work item processes.
+      \param team_size The number of threads per team. The structs of a chunk
+      are distributed over the team threads while each struct still vectorizes
+      over the inner array index.
+
+      The default team size of one matches the historical behavior of this
+      policy. Larger teams are useful on devices where the per-backend
+      defaults in \c Impl::PerformanceTraits are stale - see
+      \c Experimental::tune for measuring the best configuration at runtime.
+    */
+    SimdPolicy( const index_type begin, const index_type end,
+                const index_type chunk_size, const int team_size )
+        : base_type( ( Impl::StructRange<VectorLength, index_type>::size(
+                           begin, end ) +
+                       chunk_size - 1 ) /
+                         chunk_size,
+                     team_size, VectorLength )
+        , _struct_begin(
+              Impl::StructRange<VectorLength, index_type>::structBegin(
+                  begin ) )
+        , _struct_end(
+              Impl::StructRange<VectorLength, index_type>::structEnd( end ) )
+        , _array_begin( Impl::Index<VectorLength>::a( begin ) )
+        , _array_end( Impl::Index<VectorLength>::a( end ) )
+        , _chunk_size( chunk_size )
+    {
+    }
+
+    /*!
+      \brief Range constructor on a given execution space instance.
+      \param space The execution space instance to dispatch on. Independent
+      kernels submitted on different instances (e.g. CUDA/HIP streams) may
+      overlap on the device.
+      \param begin The begininning of the 1D range. This will be decomposed
+      into 2D indices.
+      \param end The ending of the 1D range. This will be decomposed
+      into 2D indices.
+    */
+    SimdPolicy( const execution_space& space, const index_type begin,
+                const index_type end )
+        : base_type(
+              space,
+              Impl::StructRange<VectorLength, index_type>::size( begin, end ),
+              1, VectorLength )
+        , _struct_begin(
+              Impl::StructRange<VectorLength, index_type>::structBegin(
+                  begin ) )
+        , _struct_end(
+              Impl::StructRange<VectorLength, index_type>::structEnd( end ) )
+        , _array_begin( Impl::Index<VectorLength>::a( begin ) )
+        , _array_end( Impl::Index<VectorLength>::a( end ) )
+        , _chunk_size( 1 )
+    {
+    }
+
+    /*!
+      \brief Chunked range constructor on a given execution space instance.
+      \param space The execution space instance to dispatch on.
+      \param begin The begininning of the 1D range. This will be decomposed
+      into 2D indices.
+      \param end The ending of the 1D range. This will be decomposed
+      into 2D indices.
+      \param chunk_size The number of structs each work item processes.
+    */
+    SimdPolicy( const execution_space& space, const index_type begin,
+                const index_type end, const index_type chunk_size )
+        : base_type( space,
+                     ( Impl::StructRange<VectorLength, index_type>::size(
+                           begin, end ) +
+                       chunk_size - 1 ) /
+                         chunk_size,
+                     1, VectorLength )
+        , _struct_begin(
+              Impl::StructRange<VectorLength, index_type>::structBegin(
+                  begin ) )
+        , _struct_end(
+              Impl::StructRange<VectorLength, index_type>::structEnd( end ) )
+        , _array_begin( Impl::Index<VectorLength>::a( begin ) )
+        , _array_end( Impl::Index<VectorLength>::a( end ) )
+        , _chunk_size( chunk_size )
+    {
+    }
+
+    /*!
+      \brief Chunked range constructor with an explicit team size on a given
+      execution space instance.
+      \param space The execution space instance to dispatch on.
+      \param begin The begininning of the 1D range. This will be decomposed
+      into 2D indices.
+      \param end The ending of the 1D range. This will be decomposed
+      into 2D indices.
+      \param chunk_size The number of structs each work item processes.
+      \param team_size The number of threads per team.
+    */
+    SimdPolicy( const execution_space& space, const index_type begin,
+                const index_type end, const index_type chunk_size,
+                const int team_size )
+        : base_type( space,
+                     ( Impl::StructRange<VectorLength, index_type>::size(
+                           begin, end ) +
+                       chunk_size - 1 ) /
+                         chunk_size,
+                     team_size, VectorLength )
+        , _struct_begin(
+              Impl::StructRange<VectorLength, index_type>::structBegin(
+                  begin ) )
+        , _struct_end(
+              Impl::StructRange<VectorLength, index_type>::structEnd( end ) )
+        , _array_begin( Impl::Index<VectorLength>::a( begin ) )
+        , _array_end( Impl::Index<VectorLength>::a( end ) )
+        , _chunk_size( chunk_size )
     {
     }
 
@@ -149,11 +305,114 @@ class SimdPolicy
                    : VectorLength;
     }
 
+    //! Get the number of structs each work item processes.
+    KOKKOS_INLINE_FUNCTION index_type chunkSize() const
+    {
+        return _chunk_size;
+    }
+
+    //! Given a work item id get the first struct index of its chunk.
+    KOKKOS_INLINE_FUNCTION index_type
+    chunkStructBegin( const index_type rank ) const
+    {
+        return _struct_begin + rank * _chunk_size;
+    }
+
+    //! Given a work item id get the ending struct index of its chunk.
+    KOKKOS_INLINE_FUNCTION index_type
+    chunkStructEnd( const index_type rank ) const
+    {
+        index_type chunk_end = chunkStructBegin( rank ) + _chunk_size;
+        return ( chunk_end < _struct_end ) ? chunk_end : _struct_end;
+    }
+
   private:
     index_type _struct_begin;
     index_type _struct_end;
     index_type _array_begin;
     index_type _array_end;
+    index_type _chunk_size;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Fractional split of a 1D index range between two execution spaces.
+
+  Heterogeneous nodes with a shared address space can execute the leading
+  part of a particle range on the device while the host cores work on the
+  trailing part. The split holds the fraction of the range assigned to the
+  device and computes the dividing index, optionally rounded down to an
+  alignment boundary so an AoSoA struct is never shared between the two
+  partitions.
+
+  The fraction is calibrated from measurement: time each partition of a
+  representative kernel and pass the times to \c update(), which moves the
+  split toward the point where both partitions finish together. Repeating
+  this over a few steps converges to the balanced ratio for that kernel and
+  problem size.
+*/
+class HybridSplit
+{
+  public:
+    /*!
+      \brief Constructor.
+      \param device_fraction The fraction of the range assigned to the
+      device partition. Must be in [0,1].
+    */
+    explicit HybridSplit( const double device_fraction = 0.9 )
+        : _device_fraction( device_fraction )
+    {
+        if ( _device_fraction < 0.0 || _device_fraction > 1.0 )
+            throw std::runtime_error( "Device fraction must be in [0,1]" );
+    }
+
+    /*!
+      \brief Compute the index dividing the device and host partitions.
+      \param begin The beginning of the range.
+      \param end The end of the range.
+      \param alignment Round the split down to a multiple of this value so
+      the device partition ends on an alignment boundary (e.g. the AoSoA
+      vector length).
+      \return The dividing index. The device partition is [begin,split) and
+      the host partition is [split,end).
+    */
+    std::size_t splitIndex( const std::size_t begin, const std::size_t end,
+                            const std::size_t alignment = 1 ) const
+    {
+        std::size_t split =
+            begin + static_cast<std::size_t>( _device_fraction *
+                                              static_cast<double>( end -
+                                                                   begin ) );
+        split = ( split / alignment ) * alignment;
+        return ( split > begin ) ? split : begin;
+    }
+
+    /*!
+      \brief Rebalance the split from measured partition times.
+
+      Sets the fraction so both partitions would have finished together at
+      the measured per-element rates. Non-positive times and fractions
+      pinned at 0 or 1 (where one rate is unmeasured) leave the split
+      unchanged.
+
+      \param device_time Measured time of the device partition.
+      \param host_time Measured time of the host partition.
+    */
+    void update( const double device_time, const double host_time )
+    {
+        if ( device_time <= 0.0 || host_time <= 0.0 )
+            return;
+        const double device_rate = _device_fraction / device_time;
+        const double host_rate = ( 1.0 - _device_fraction ) / host_time;
+        if ( device_rate > 0.0 && host_rate > 0.0 )
+            _device_fraction = device_rate / ( device_rate + host_rate );
+    }
+
+    //! Get the fraction of the range assigned to the device partition.
+    double deviceFraction() const { return _device_fraction; }
+
+  private:
+    double _device_fraction;
 };
 
 //---------------------------------------------------------------------------//
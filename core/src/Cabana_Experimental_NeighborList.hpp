@@ -24,6 +24,7 @@
 #include <Kokkos_Core.hpp>
 
 #include <cassert>
+#include <type_traits>
 
 namespace Cabana
 {
@@ -59,6 +60,47 @@ struct SubsliceAndRadius
     value_type radius;
 };
 
+// Primitives wrapper bounding each particle by its own radius so that tree
+// queries with per-particle radii cover all pairs within the sum of the two
+// radii.
+template <typename Slice, typename RadiusSlice,
+          typename = std::enable_if_t<Cabana::is_slice<Slice>::value>>
+struct SliceAndRadii
+{
+    using slice_type = Slice;
+    using memory_space = typename Slice::memory_space;
+    Slice slice;
+    RadiusSlice radii;
+};
+
+// Predicates wrapper with per-particle query radii.
+template <typename Slice, typename RadiusSlice,
+          typename = std::enable_if_t<Cabana::is_slice<Slice>::value>>
+struct SubsliceAndRadii
+{
+    using slice_type = Slice;
+    using memory_space = typename Slice::memory_space;
+    Slice slice;
+    RadiusSlice radii;
+    using size_type = typename Slice::size_type;
+    size_type first;
+    size_type last;
+};
+
+// Predicates wrapper for k-nearest queries.
+template <typename Slice,
+          typename = std::enable_if_t<Cabana::is_slice<Slice>::value>>
+struct SubsliceAndK
+{
+    using slice_type = Slice;
+    using memory_space = typename Slice::memory_space;
+    Slice slice;
+    using size_type = typename Slice::size_type;
+    size_type first;
+    size_type last;
+    int num_neighbor;
+};
+
 template <typename Slice, typename = std::enable_if_t<Cabana::is_slice<
                               std::remove_reference_t<Slice>>::value>>
 auto makePredicates(
@@ -69,6 +111,31 @@ auto makePredicates(
     return Impl::SubsliceAndRadius<stdcxx20::remove_cvref_t<Slice>>{
         std::forward<Slice>( slice ), first, last, radius };
 }
+
+template <typename Slice, typename RadiusSlice,
+          typename = std::enable_if_t<Cabana::is_slice<
+              std::remove_reference_t<Slice>>::value>>
+auto makePredicates(
+    Slice&& slice, typename stdcxx20::remove_cvref_t<Slice>::size_type first,
+    typename stdcxx20::remove_cvref_t<Slice>::size_type last,
+    RadiusSlice const& radii,
+    std::enable_if_t<!std::is_arithmetic<RadiusSlice>::value>* = nullptr )
+{
+    return Impl::SubsliceAndRadii<stdcxx20::remove_cvref_t<Slice>,
+                                  RadiusSlice>{ std::forward<Slice>( slice ),
+                                                radii, first, last };
+}
+
+template <typename Slice, typename = std::enable_if_t<Cabana::is_slice<
+                              std::remove_reference_t<Slice>>::value>>
+auto makeNearestPredicates(
+    Slice&& slice, typename stdcxx20::remove_cvref_t<Slice>::size_type first,
+    typename stdcxx20::remove_cvref_t<Slice>::size_type last,
+    int num_neighbor )
+{
+    return Impl::SubsliceAndK<stdcxx20::remove_cvref_t<Slice>>{
+        std::forward<Slice>( slice ), first, last, num_neighbor };
+}
 //! \endcond
 } // namespace Impl
 } // namespace Experimental
@@ -95,6 +162,33 @@ struct AccessTraits<Slice, PrimitivesTag,
                  static_cast<float>( x( i, 2 ) ) };
     }
 };
+//! Neighbor access trait for a Cabana slice with per-particle radii.
+template <typename Slice, typename RadiusSlice>
+struct AccessTraits<
+    Cabana::Experimental::Impl::SliceAndRadii<Slice, RadiusSlice>,
+    PrimitivesTag>
+{
+    //! Primitives type.
+    using primitives_type =
+        Cabana::Experimental::Impl::SliceAndRadii<Slice, RadiusSlice>;
+    //! Kokkos memory space.
+    using memory_space = typename Slice::memory_space;
+    //! Size type.
+    using size_type = typename Slice::size_type;
+    //! Get number of particles.
+    static KOKKOS_FUNCTION size_type size( primitives_type const& x )
+    {
+        return x.slice.size();
+    }
+    //! Get the particle at the index, bounded by its own radius.
+    static KOKKOS_FUNCTION Box get( primitives_type const& x, size_type i )
+    {
+        auto const point = AccessTraits<Slice, PrimitivesTag>::get( x.slice, i );
+        auto const r = static_cast<float>( x.radii( i ) );
+        return { { point[0] - r, point[1] - r, point[2] - r },
+                 { point[0] + r, point[1] + r, point[2] + r } };
+    }
+};
 //! Neighbor access trait.
 template <typename SliceLike>
 struct AccessTraits<SliceLike, PredicatesTag>
@@ -118,6 +212,61 @@ struct AccessTraits<SliceLike, PredicatesTag>
         return attach( intersects( Sphere{ point, x.radius } ), (int)i );
     }
 };
+//! Neighbor access trait with per-particle query radii.
+template <typename Slice, typename RadiusSlice>
+struct AccessTraits<
+    Cabana::Experimental::Impl::SubsliceAndRadii<Slice, RadiusSlice>,
+    PredicatesTag>
+{
+    //! Predicates type.
+    using predicates_type =
+        Cabana::Experimental::Impl::SubsliceAndRadii<Slice, RadiusSlice>;
+    //! Kokkos memory space.
+    using memory_space = typename predicates_type::memory_space;
+    //! Size type.
+    using size_type = typename predicates_type::size_type;
+    //! Get number of particles.
+    static KOKKOS_FUNCTION size_type size( predicates_type const& x )
+    {
+        return x.last - x.first;
+    }
+    //! Get the particle at the index with its own query radius.
+    static KOKKOS_FUNCTION auto get( predicates_type const& x, size_type i )
+    {
+        assert( i < size( x ) );
+        auto const point =
+            AccessTraits<typename predicates_type::slice_type,
+                         PrimitivesTag>::get( x.slice, x.first + i );
+        auto const r = static_cast<float>( x.radii( x.first + i ) );
+        return attach( intersects( Sphere{ point, r } ), (int)i );
+    }
+};
+//! Neighbor access trait for k-nearest queries.
+template <typename Slice>
+struct AccessTraits<Cabana::Experimental::Impl::SubsliceAndK<Slice>,
+                    PredicatesTag>
+{
+    //! Predicates type.
+    using predicates_type = Cabana::Experimental::Impl::SubsliceAndK<Slice>;
+    //! Kokkos memory space.
+    using memory_space = typename predicates_type::memory_space;
+    //! Size type.
+    using size_type = typename predicates_type::size_type;
+    //! Get number of particles.
+    static KOKKOS_FUNCTION size_type size( predicates_type const& x )
+    {
+        return x.last - x.first;
+    }
+    //! Get the k-nearest query for the particle at the index.
+    static KOKKOS_FUNCTION auto get( predicates_type const& x, size_type i )
+    {
+        assert( i < size( x ) );
+        auto const point =
+            AccessTraits<typename predicates_type::slice_type,
+                         PrimitivesTag>::get( x.slice, x.first + i );
+        return attach( nearest( point, x.num_neighbor ), (int)i );
+    }
+};
 } // namespace ArborX
 
 namespace Cabana
@@ -146,17 +295,79 @@ struct CollisionFilter<HalfNeighborTag>
     KOKKOS_FUNCTION static bool keep( int i, int j ) noexcept { return i > j; }
 };
 
+// Trivial pair filter keeping every collision reported by the tree.
+struct KeepAllPairs
+{
+    KOKKOS_FUNCTION bool operator()( int, int ) const noexcept { return true; }
+};
+
+// Exact pair test against the larger of the two particle radii. Tree
+// queries with per-particle radii only guarantee a superset of these pairs.
+template <typename Slice, typename RadiusSlice>
+struct MaxRadiusPairFilter
+{
+    Slice slice;
+    RadiusSlice radii;
+    typename Slice::size_type first;
+
+    KOKKOS_FUNCTION bool operator()( int predicate_index,
+                                     int primitive_index ) const
+    {
+        using value_type = typename Slice::value_type;
+        auto const p = first + predicate_index;
+        auto const n = primitive_index;
+        value_type const r_p = radii( p );
+        value_type const r_n = radii( n );
+        value_type const r = ( r_p > r_n ) ? r_p : r_n;
+        value_type dist_sqr = 0;
+        for ( int d = 0; d < 3; ++d )
+        {
+            value_type const dx = slice( p, d ) - slice( n, d );
+            dist_sqr += dx * dx;
+        }
+        return dist_sqr <= r * r;
+    }
+};
+
+// Exact pair test against the true cutoff and the current positions. Used
+// when querying a stale tree with an inflated radius only guarantees a
+// superset of the pairs.
+template <typename Slice>
+struct FixedRadiusPairFilter
+{
+    Slice slice;
+    typename Slice::value_type radius;
+    typename Slice::size_type first;
+
+    KOKKOS_FUNCTION bool operator()( int predicate_index,
+                                     int primitive_index ) const
+    {
+        using value_type = typename Slice::value_type;
+        auto const p = first + predicate_index;
+        auto const n = primitive_index;
+        value_type dist_sqr = 0;
+        for ( int d = 0; d < 3; ++d )
+        {
+            value_type const dx = slice( p, d ) - slice( n, d );
+            dist_sqr += dx * dx;
+        }
+        return dist_sqr <= radius * radius;
+    }
+};
+
 // Custom callback for ArborX::BVH::query()
-template <typename Tag>
+template <typename Tag, typename PairFilter = KeepAllPairs>
 struct NeighborDiscriminatorCallback
 {
+    PairFilter filter;
     template <typename Predicate, typename OutputFunctor>
     KOKKOS_FUNCTION void operator()( Predicate const& predicate,
                                      int primitive_index,
                                      OutputFunctor const& out ) const
     {
         int const predicate_index = getData( predicate );
-        if ( CollisionFilter<Tag>::keep( predicate_index, primitive_index ) )
+        if ( CollisionFilter<Tag>::keep( predicate_index, primitive_index ) &&
+             filter( predicate_index, primitive_index ) )
         {
             out( primitive_index );
         }
@@ -164,16 +375,18 @@ struct NeighborDiscriminatorCallback
 };
 
 // Count in the first pass
-template <typename Counts, typename Tag>
+template <typename Counts, typename Tag, typename PairFilter = KeepAllPairs>
 struct NeighborDiscriminatorCallback2D_FirstPass
 {
     Counts counts;
+    PairFilter filter;
     template <typename Predicate>
     KOKKOS_FUNCTION void operator()( Predicate const& predicate,
                                      int primitive_index ) const
     {
         int const predicate_index = getData( predicate );
-        if ( CollisionFilter<Tag>::keep( predicate_index, primitive_index ) )
+        if ( CollisionFilter<Tag>::keep( predicate_index, primitive_index ) &&
+             filter( predicate_index, primitive_index ) )
         {
             ++counts( predicate_index ); // WARNING see below**
         }
@@ -181,18 +394,21 @@ struct NeighborDiscriminatorCallback2D_FirstPass
 };
 
 // Preallocate and attempt fill in the first pass
-template <typename Counts, typename Neighbors, typename Tag>
+template <typename Counts, typename Neighbors, typename Tag,
+          typename PairFilter = KeepAllPairs>
 struct NeighborDiscriminatorCallback2D_FirstPass_BufferOptimization
 {
     Counts counts;
     Neighbors neighbors;
+    PairFilter filter;
     template <typename Predicate>
     KOKKOS_FUNCTION void operator()( Predicate const& predicate,
                                      int primitive_index ) const
     {
         int const predicate_index = getData( predicate );
         auto& count = counts( predicate_index );
-        if ( CollisionFilter<Tag>::keep( predicate_index, primitive_index ) )
+        if ( CollisionFilter<Tag>::keep( predicate_index, primitive_index ) &&
+             filter( predicate_index, primitive_index ) )
         {
             if ( count < (int)neighbors.extent( 1 ) )
             {
@@ -208,18 +424,21 @@ struct NeighborDiscriminatorCallback2D_FirstPass_BufferOptimization
 };
 
 // Fill in the second pass
-template <typename Counts, typename Neighbors, typename Tag>
+template <typename Counts, typename Neighbors, typename Tag,
+          typename PairFilter = KeepAllPairs>
 struct NeighborDiscriminatorCallback2D_SecondPass
 {
     Counts counts;
     Neighbors neighbors;
+    PairFilter filter;
     template <typename Predicate>
     KOKKOS_FUNCTION void operator()( Predicate const& predicate,
                                      int primitive_index ) const
     {
         int const predicate_index = getData( predicate );
         auto& count = counts( predicate_index );
-        if ( CollisionFilter<Tag>::keep( predicate_index, primitive_index ) )
+        if ( CollisionFilter<Tag>::keep( predicate_index, primitive_index ) &&
+             filter( predicate_index, primitive_index ) )
         {
             assert( count < (int)neighbors.extent( 1 ) );
             neighbors( predicate_index, count++ ) =
@@ -296,6 +515,234 @@ auto makeNeighborList( Tag, Slice const& coordinate_slice,
                                        std::move( offset ), first, bvh.size() };
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Neighbor list implementation using ArborX with per-particle
+  neighborhood radii and a 1D compressed layout for particles and neighbors.
+
+  \tparam Slice The position slice type.
+  \tparam RadiusSlice The per-particle radius slice or view type.
+  \tparam DeviceType The device type to use for building and storing the
+  neighbor list.
+  \tparam AlgorithmTag Tag indicating whether to build a full or half neighbor
+  list.
+
+  \param coordinate_slice The slice containing the particle positions.
+  \param first The beginning particle index to compute neighbors for.
+  \param last The end particle index to compute neighbors for.
+  \param radius Per-particle neighborhood radii, accessed as radius(p). Two
+  particles are neighbors when they are within the larger of their two radii,
+  keeping the neighborhood relation symmetric.
+  \param buffer_size Optional guess for maximum number of neighbors.
+
+  The tree bounds each particle by its own radius so queries cover all
+  candidate pairs, while each pair is tested exactly against its own cutoff.
+*/
+template <typename DeviceType, typename Slice, typename RadiusSlice,
+          typename Tag>
+auto makeNeighborList(
+    Tag, Slice const& coordinate_slice, typename Slice::size_type first,
+    typename Slice::size_type last, RadiusSlice const& radius,
+    int buffer_size = 0,
+    std::enable_if_t<!std::is_arithmetic<RadiusSlice>::value>* = nullptr )
+{
+    assert( buffer_size >= 0 );
+
+    using MemorySpace = typename DeviceType::memory_space;
+    using ExecutionSpace = typename DeviceType::execution_space;
+    ExecutionSpace space{};
+
+    Impl::SliceAndRadii<Slice, RadiusSlice> primitives{ coordinate_slice,
+                                                        radius };
+    ArborX::BVH<MemorySpace> bvh( space, primitives );
+
+    using filter_type = Impl::MaxRadiusPairFilter<Slice, RadiusSlice>;
+    Kokkos::View<int*, DeviceType> indices(
+        Kokkos::view_alloc( "indices", Kokkos::WithoutInitializing ), 0 );
+    Kokkos::View<int*, DeviceType> offset(
+        Kokkos::view_alloc( "offset", Kokkos::WithoutInitializing ), 0 );
+    bvh.query(
+        space, Impl::makePredicates( coordinate_slice, first, last, radius ),
+        Impl::NeighborDiscriminatorCallback<Tag, filter_type>{
+            filter_type{ coordinate_slice, radius, first } },
+        indices, offset,
+        ArborX::Experimental::TraversalPolicy().setBufferSize( buffer_size ) );
+
+    return CrsGraph<MemorySpace, Tag>{ std::move( indices ),
+                                       std::move( offset ), first, bvh.size() };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief k-nearest-neighbor list implementation using ArborX with a 1D
+  compressed layout for particles and neighbors.
+
+  \tparam Slice The position slice type.
+  \tparam DeviceType The device type to use for building and storing the
+  neighbor list.
+  \tparam AlgorithmTag Tag indicating whether to build a full or half neighbor
+  list.
+
+  \param coordinate_slice The slice containing the particle positions.
+  \param first The beginning particle index to compute neighbors for.
+  \param last The end particle index to compute neighbors for.
+  \param num_neighbor The number of nearest neighbors to find for each
+  particle.
+
+  Finds the num_neighbor nearest particles to each particle in a single tree
+  traversal regardless of the local particle density, which a fixed-radius
+  search can only approximate by iterating radius guesses. With
+  FullNeighborTag each particle gets exactly num_neighbor neighbors (fewer
+  only if the system holds fewer particles); with HalfNeighborTag the
+  lower-index half of those pairs is kept.
+*/
+template <typename DeviceType, typename Slice, typename Tag>
+auto makeNearestNeighborList( Tag, Slice const& coordinate_slice,
+                              typename Slice::size_type first,
+                              typename Slice::size_type last,
+                              const int num_neighbor )
+{
+    assert( num_neighbor > 0 );
+
+    using MemorySpace = typename DeviceType::memory_space;
+    using ExecutionSpace = typename DeviceType::execution_space;
+    ExecutionSpace space{};
+
+    ArborX::BVH<MemorySpace> bvh( space, coordinate_slice );
+
+    Kokkos::View<int*, DeviceType> indices(
+        Kokkos::view_alloc( "indices", Kokkos::WithoutInitializing ), 0 );
+    Kokkos::View<int*, DeviceType> offset(
+        Kokkos::view_alloc( "offset", Kokkos::WithoutInitializing ), 0 );
+    // Request one extra candidate because each particle finds itself at
+    // distance zero and the collision filter discards it.
+    bvh.query( space,
+               Impl::makeNearestPredicates( coordinate_slice, first, last,
+                                            num_neighbor + 1 ),
+               Impl::NeighborDiscriminatorCallback<Tag>{}, indices, offset );
+
+    return CrsGraph<MemorySpace, Tag>{ std::move( indices ),
+                                       std::move( offset ), first, bvh.size() };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief ArborX tree reused across neighbor list builds under bounded
+  particle motion.
+
+  \tparam DeviceType The device type to use for building and storing the
+  tree.
+  \tparam Slice The position slice type.
+
+  Caches the bounding volume hierarchy so several neighbor list builds can
+  share one tree construction. ArborX does not expose a leaf refit, but a
+  tree built from positions at most a known bound away from the current
+  ones still covers every pair within the cutoff when queried with the
+  cutoff inflated by that bound, so the tree stays valid while the
+  accumulated per-particle motion is below the bound passed to
+  makeNeighborList. Call rebuild() when the motion bound is exceeded.
+*/
+template <typename DeviceType, typename Slice>
+class ReusableNeighborTree
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = typename DeviceType::memory_space;
+    //! Kokkos execution space.
+    using execution_space = typename DeviceType::execution_space;
+    //! Tree type.
+    using bvh_type = ArborX::BVH<memory_space>;
+
+    /*!
+      \brief Constructor. Builds the tree from the current positions.
+      \param coordinate_slice The slice containing the particle positions.
+    */
+    ReusableNeighborTree( Slice const& coordinate_slice )
+        : _bvh( execution_space{}, coordinate_slice )
+    {
+    }
+
+    /*!
+      \brief Rebuild the tree from the current positions.
+      \param coordinate_slice The slice containing the particle positions.
+    */
+    void rebuild( Slice const& coordinate_slice )
+    {
+        _bvh = bvh_type( execution_space{}, coordinate_slice );
+    }
+
+    //! Get the tree.
+    bvh_type const& bvh() const { return _bvh; }
+
+  private:
+    // The bounding volume hierarchy.
+    bvh_type _bvh;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Neighbor list implementation reusing an existing ArborX tree for
+  particles within the interaction distance with a 1D compressed layout for
+  particles and neighbors.
+
+  \tparam Slice The position slice type.
+  \tparam DeviceType The device type to use for building and storing the
+  neighbor list.
+  \tparam AlgorithmTag Tag indicating whether to build a full or half neighbor
+  list.
+
+  \param tree Tree built from positions at most motion_bound away from the
+  current ones.
+  \param coordinate_slice The slice containing the current particle
+  positions.
+  \param first The beginning particle index to compute neighbors for.
+  \param last The end particle index to compute neighbors for.
+  \param radius The radius of the neighborhood. Particles within this radius
+  are considered neighbors.
+  \param motion_bound Upper bound on the distance any particle has moved
+  since the tree was built.
+  \param buffer_size Optional guess for maximum number of neighbors.
+
+  The tree is traversed with the cutoff inflated by the motion bound so the
+  stale leaf bounds still cover all candidate pairs, and each pair is then
+  tested exactly against the true cutoff at the current positions. For small
+  motion this is much cheaper than full tree construction.
+*/
+template <typename DeviceType, typename Slice, typename Tag>
+auto makeNeighborList( Tag, ReusableNeighborTree<DeviceType, Slice>& tree,
+                       Slice const& coordinate_slice,
+                       typename Slice::size_type first,
+                       typename Slice::size_type last,
+                       typename Slice::value_type radius,
+                       typename Slice::value_type motion_bound,
+                       int buffer_size = 0 )
+{
+    assert( buffer_size >= 0 );
+    assert( motion_bound >= 0 );
+
+    using MemorySpace = typename DeviceType::memory_space;
+    using ExecutionSpace = typename DeviceType::execution_space;
+    ExecutionSpace space{};
+
+    using filter_type = Impl::FixedRadiusPairFilter<Slice>;
+    Kokkos::View<int*, DeviceType> indices(
+        Kokkos::view_alloc( "indices", Kokkos::WithoutInitializing ), 0 );
+    Kokkos::View<int*, DeviceType> offset(
+        Kokkos::view_alloc( "offset", Kokkos::WithoutInitializing ), 0 );
+    tree.bvh().query(
+        space,
+        Impl::makePredicates( coordinate_slice, first, last,
+                              radius + motion_bound ),
+        Impl::NeighborDiscriminatorCallback<Tag, filter_type>{
+            filter_type{ coordinate_slice, radius, first } },
+        indices, offset,
+        ArborX::Experimental::TraversalPolicy().setBufferSize( buffer_size ) );
+
+    return CrsGraph<MemorySpace, Tag>{ std::move( indices ),
+                                       std::move( offset ), first,
+                                       tree.bvh().size() };
+}
+
 //! 2d ArborX neighbor list storage layout.
 template <typename MemorySpace, typename Tag>
 struct Dense
@@ -397,6 +844,94 @@ auto make2DNeighborList( Tag, Slice const& coordinate_slice,
     return Dense<MemorySpace, Tag>{ counts, neighbors, first, bvh.size() };
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Neighbor list implementation using ArborX with per-particle
+  neighborhood radii and a 2D layout for particles and neighbors.
+
+  \tparam Slice The position slice type.
+  \tparam RadiusSlice The per-particle radius slice or view type.
+  \tparam DeviceType The device type to use for building and storing the
+  neighbor list.
+  \tparam AlgorithmTag Tag indicating whether to build a full or half neighbor
+  list.
+
+  \param coordinate_slice The slice containing the particle positions.
+  \param first The beginning particle index to compute neighbors for.
+  \param last The end particle index to compute neighbors for.
+  \param radius Per-particle neighborhood radii, accessed as radius(p). Two
+  particles are neighbors when they are within the larger of their two radii.
+  \param buffer_size Optional guess for maximum number of neighbors per
+  particle.
+*/
+template <typename DeviceType, typename Slice, typename RadiusSlice,
+          typename Tag>
+auto make2DNeighborList(
+    Tag, Slice const& coordinate_slice, typename Slice::size_type first,
+    typename Slice::size_type last, RadiusSlice const& radius,
+    int buffer_size = 0,
+    std::enable_if_t<!std::is_arithmetic<RadiusSlice>::value>* = nullptr )
+{
+    assert( buffer_size >= 0 );
+
+    using MemorySpace = typename DeviceType::memory_space;
+    using ExecutionSpace = typename DeviceType::execution_space;
+    ExecutionSpace space{};
+
+    Impl::SliceAndRadii<Slice, RadiusSlice> primitives{ coordinate_slice,
+                                                        radius };
+    ArborX::BVH<MemorySpace> bvh( space, primitives );
+
+    auto const predicates =
+        Impl::makePredicates( coordinate_slice, first, last, radius );
+
+    auto const n_queries =
+        ArborX::AccessTraits<decltype( predicates ),
+                             ArborX::PredicatesTag>::size( predicates );
+
+    using filter_type = Impl::MaxRadiusPairFilter<Slice, RadiusSlice>;
+    filter_type filter{ coordinate_slice, radius, first };
+
+    Kokkos::View<int**, DeviceType> neighbors;
+    Kokkos::View<int*, DeviceType> counts( "counts", n_queries );
+    if ( buffer_size > 0 )
+    {
+        neighbors = Kokkos::View<int**, DeviceType>(
+            Kokkos::view_alloc( "neighbors", Kokkos::WithoutInitializing ),
+            n_queries, buffer_size );
+        bvh.query(
+            space, predicates,
+            Impl::NeighborDiscriminatorCallback2D_FirstPass_BufferOptimization<
+                decltype( counts ), decltype( neighbors ), Tag, filter_type>{
+                counts, neighbors, filter } );
+    }
+    else
+    {
+        bvh.query( space, predicates,
+                   Impl::NeighborDiscriminatorCallback2D_FirstPass<
+                       decltype( counts ), Tag, filter_type>{ counts,
+                                                              filter } );
+    }
+
+    auto const max_neighbors = ArborX::max( space, counts );
+    if ( max_neighbors <= buffer_size )
+    {
+        // NOTE We do not bother shrinking to eliminate the excess allocation.
+        return Dense<MemorySpace, Tag>{ counts, neighbors, first, bvh.size() };
+    }
+
+    neighbors = Kokkos::View<int**, DeviceType>(
+        Kokkos::view_alloc( "neighbors", Kokkos::WithoutInitializing ),
+        n_queries, max_neighbors ); // realloc storage for neighbors
+    Kokkos::deep_copy( counts, 0 ); // reset counts to zero
+    bvh.query( space, predicates,
+               Impl::NeighborDiscriminatorCallback2D_SecondPass<
+                   decltype( counts ), decltype( neighbors ), Tag,
+                   filter_type>{ counts, neighbors, filter } );
+
+    return Dense<MemorySpace, Tag>{ counts, neighbors, first, bvh.size() };
+}
+
 } // namespace Experimental
 
 //! 1d ArborX NeighborList interface.
@@ -0,0 +1,434 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_HDF5ParticleOutput.hpp
+  \brief HDF5/XDMF particle time series output with collective parallel IO
+*/
+#ifndef CABANA_HDF5PARTICLEOUTPUT_HPP
+#define CABANA_HDF5PARTICLEOUTPUT_HPP
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_Slice.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <hdf5.h>
+
+#include <mpi.h>
+
+#include <array>
+#include <fstream>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Cabana
+{
+namespace Experimental
+{
+namespace HDF5ParticleOutput
+{
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+
+// Map C++ value types to native HDF5 types and the XDMF type descriptors.
+template <typename T>
+struct HDF5Traits;
+
+template <>
+struct HDF5Traits<float>
+{
+    static hid_t type() { return H5T_NATIVE_FLOAT; }
+    static const char* xdmfType() { return "Float"; }
+    static constexpr int xdmf_precision = 4;
+};
+
+template <>
+struct HDF5Traits<double>
+{
+    static hid_t type() { return H5T_NATIVE_DOUBLE; }
+    static const char* xdmfType() { return "Float"; }
+    static constexpr int xdmf_precision = 8;
+};
+
+template <>
+struct HDF5Traits<int>
+{
+    static hid_t type() { return H5T_NATIVE_INT; }
+    static const char* xdmfType() { return "Int"; }
+    static constexpr int xdmf_precision = 4;
+};
+
+template <>
+struct HDF5Traits<long>
+{
+    static hid_t type() { return H5T_NATIVE_LONG; }
+    static const char* xdmfType() { return "Int"; }
+    static constexpr int xdmf_precision = 8;
+};
+
+template <>
+struct HDF5Traits<unsigned int>
+{
+    static hid_t type() { return H5T_NATIVE_UINT; }
+    static const char* xdmfType() { return "UInt"; }
+    static constexpr int xdmf_precision = 4;
+};
+
+template <>
+struct HDF5Traits<unsigned long>
+{
+    static hid_t type() { return H5T_NATIVE_ULONG; }
+    static const char* xdmfType() { return "UInt"; }
+    static constexpr int xdmf_precision = 8;
+};
+
+// Number of flattened components in a slice. Slice dimensions 0 and 1 index
+// the particles - any remaining dimensions are member components.
+template <class Slice_t>
+std::size_t sliceComponents( const Slice_t& slice )
+{
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.rank(); ++d )
+        num_comp *= slice.extent( d );
+    return num_comp;
+}
+
+// Create the file dataset for member M with the full global extents.
+template <std::size_t M, class AoSoA_t>
+hid_t createFieldDataset( hid_t file, const std::string& name,
+                          const unsigned long long global_num_particle,
+                          const AoSoA_t& aosoa )
+{
+    using value_type = typename AoSoA_t::template member_value_type<M>;
+    std::size_t num_comp = sliceComponents( Cabana::slice<M>( aosoa ) );
+    hsize_t dims[2] = { global_num_particle, num_comp };
+    int ndim = ( num_comp > 1 ) ? 2 : 1;
+    hid_t filespace = H5Screate_simple( ndim, dims, nullptr );
+    hid_t dataset =
+        H5Dcreate( file, name.c_str(), HDF5Traits<value_type>::type(),
+                   filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    H5Sclose( filespace );
+    return dataset;
+}
+
+// Pack one chunk of member M from a host staging buffer into a contiguous
+// buffer and write it as a collective hyperslab. Ranks that have exhausted
+// their local data call with num_write zero and make an empty selection so
+// the collective semantics hold across unequal particle counts.
+template <std::size_t M, class HostAoSoA>
+void writeFieldChunk( hid_t dataset, hid_t dxpl, const HostAoSoA& buffer,
+                      const std::size_t num_write,
+                      const unsigned long long file_offset )
+{
+    using value_type = typename HostAoSoA::template member_value_type<M>;
+    using slice_type = typename HostAoSoA::template member_slice_type<M>;
+
+    auto slice = Cabana::slice<M>( buffer );
+    std::size_t num_comp = sliceComponents( slice );
+
+    // Repack the SoA-interleaved chunk into an element-contiguous buffer.
+    Kokkos::View<value_type**, Kokkos::LayoutRight, Kokkos::HostSpace> pack(
+        Kokkos::ViewAllocateWithoutInitializing( "hdf5_pack" ), num_write,
+        num_comp );
+    auto slice_data = slice.data();
+    for ( std::size_t p = 0; p < num_write; ++p )
+    {
+        auto s = slice_type::index_type::s( p );
+        auto a = slice_type::index_type::a( p );
+        std::size_t offset = s * slice.stride( 0 ) + a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            pack( p, n ) =
+                slice_data[offset + slice_type::vector_length * n];
+    }
+
+    // Select this rank's rows in the file.
+    hid_t filespace = H5Dget_space( dataset );
+    hsize_t start[2] = { file_offset, 0 };
+    hsize_t count[2] = { num_write, num_comp };
+    int ndim = ( num_comp > 1 ) ? 2 : 1;
+    hid_t memspace = H5Screate_simple( ndim, count, nullptr );
+    if ( num_write > 0 )
+    {
+        H5Sselect_hyperslab( filespace, H5S_SELECT_SET, start, nullptr, count,
+                             nullptr );
+    }
+    else
+    {
+        H5Sselect_none( filespace );
+        H5Sselect_none( memspace );
+    }
+
+    H5Dwrite( dataset, HDF5Traits<value_type>::type(), memspace, filespace,
+              dxpl, pack.data() );
+
+    H5Sclose( memspace );
+    H5Sclose( filespace );
+}
+
+// Write the XDMF description of one time step so the HDF5 file can be
+// loaded directly by ParaView/VisIt as a point cloud.
+inline void writeXdmf( const std::string& xmf_name,
+                       const std::string& h5_name, const double time,
+                       const unsigned long long global_num_particle,
+                       const std::vector<std::string>& field_names,
+                       const std::vector<std::size_t>& field_comps,
+                       const std::vector<std::string>& field_types,
+                       const std::vector<int>& field_precisions )
+{
+    std::ofstream xmf( xmf_name );
+    xmf << "<?xml version=\"1.0\" ?>\n"
+        << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+        << "<Xdmf Version=\"2.0\">\n"
+        << "  <Domain>\n"
+        << "    <Grid Name=\"particles\" GridType=\"Uniform\">\n"
+        << "      <Time Value=\"" << time << "\"/>\n"
+        << "      <Topology TopologyType=\"Polyvertex\" NumberOfElements=\""
+        << global_num_particle << "\"/>\n"
+        << "      <Geometry GeometryType=\"XYZ\">\n"
+        << "        <DataItem Dimensions=\"" << global_num_particle << " "
+        << field_comps[0] << "\" NumberType=\"" << field_types[0]
+        << "\" Precision=\"" << field_precisions[0]
+        << "\" Format=\"HDF\">\n"
+        << "          " << h5_name << ":/" << field_names[0] << "\n"
+        << "        </DataItem>\n"
+        << "      </Geometry>\n";
+    for ( std::size_t f = 1; f < field_names.size(); ++f )
+    {
+        xmf << "      <Attribute Name=\"" << field_names[f]
+            << "\" AttributeType=\""
+            << ( ( field_comps[f] > 1 ) ? "Vector" : "Scalar" )
+            << "\" Center=\"Node\">\n"
+            << "        <DataItem Dimensions=\"" << global_num_particle;
+        if ( field_comps[f] > 1 )
+            xmf << " " << field_comps[f];
+        xmf << "\" NumberType=\"" << field_types[f] << "\" Precision=\""
+            << field_precisions[f] << "\" Format=\"HDF\">\n"
+            << "          " << h5_name << ":/" << field_names[f] << "\n"
+            << "        </DataItem>\n"
+            << "      </Attribute>\n";
+    }
+    xmf << "    </Grid>\n"
+        << "  </Domain>\n"
+        << "</Xdmf>\n";
+}
+
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Write a time step of particle data to an HDF5 file with an XDMF
+  description.
+
+  \tparam CoordIndex AoSoA member index of the particle coordinates.
+
+  \tparam FieldIndex AoSoA member indices of the fields to write.
+
+  \tparam AoSoA_t AoSoA type.
+
+  \param comm The communicator over which the particles are distributed. All
+  ranks in the communicator must call this function.
+
+  \param prefix Output file name prefix. Step files are named
+  prefix_<step>.h5 with a matching prefix_<step>.xmf description.
+
+  \param time_step_index The index of the time step.
+
+  \param time The current time.
+
+  \param aosoa The particles to write.
+
+  \param field_names Dataset names, one per written member with the
+  coordinate name first. Sizes other than 1 + sizeof...(FieldIndex) throw a
+  std::runtime_error.
+
+  \param chunk_size Number of particles staged to the host per pipeline
+  chunk.
+
+  Each member becomes one dataset written collectively by all ranks, with
+  rank data concatenated in rank order. Device data is staged to the host in
+  chunks through a pair of pinned staging buffers - while one chunk is being
+  repacked and written the next device-to-host copy is in flight on the
+  container's execution space instance, so the transfer overlaps the IO
+  instead of serializing a full-container copy in front of it. Scalar and
+  multidimensional members are both supported; multidimensional components
+  are flattened in layout order.
+*/
+template <std::size_t CoordIndex, std::size_t... FieldIndex, class AoSoA_t>
+void writeTimeStep( MPI_Comm comm, const std::string& prefix,
+                    const int time_step_index, const double time,
+                    const AoSoA_t& aosoa,
+                    const std::vector<std::string>& field_names,
+                    const std::size_t chunk_size = 1048576 )
+{
+    using member_types = typename AoSoA_t::member_types;
+    using soa_type = typename AoSoA_t::soa_type;
+    using execution_space = typename AoSoA_t::execution_space;
+    using host_aosoa_type =
+        Cabana::AoSoA<member_types, Kokkos::HostSpace,
+                      AoSoA_t::vector_length>;
+
+    constexpr std::size_t num_field = 1 + sizeof...( FieldIndex );
+    if ( field_names.size() != num_field )
+        throw std::runtime_error(
+            "Number of field names does not match the written members" );
+
+    int comm_rank;
+    MPI_Comm_rank( comm, &comm_rank );
+
+    // Compute this rank's row offset and the global particle count.
+    unsigned long long local_num_particle = aosoa.size();
+    unsigned long long offset = 0;
+    MPI_Exscan( &local_num_particle, &offset, 1, MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM, comm );
+    unsigned long long global_num_particle = 0;
+    MPI_Allreduce( &local_num_particle, &global_num_particle, 1,
+                   MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm );
+
+    // Open the file for collective access.
+    std::string h5_name =
+        prefix + "_" + std::to_string( time_step_index ) + ".h5";
+    hid_t fapl = H5Pcreate( H5P_FILE_ACCESS );
+    H5Pset_fapl_mpio( fapl, comm, MPI_INFO_NULL );
+    hid_t file =
+        H5Fcreate( h5_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl );
+    H5Pclose( fapl );
+    if ( file < 0 )
+        throw std::runtime_error( "Unable to create HDF5 file " + h5_name );
+
+    // Create the datasets with their full global extents.
+    std::size_t name_id = 0;
+    std::array<hid_t, num_field> datasets = {
+        Impl::createFieldDataset<CoordIndex>(
+            file, field_names[name_id++], global_num_particle, aosoa ),
+        Impl::createFieldDataset<FieldIndex>(
+            file, field_names[name_id++], global_num_particle, aosoa )... };
+
+    // All data transfers are collective.
+    hid_t dxpl = H5Pcreate( H5P_DATASET_XFER );
+    H5Pset_dxpl_mpio( dxpl, H5FD_MPIO_COLLECTIVE );
+
+    // Size the staging pipeline in whole SoA units.
+    std::size_t chunk_soa = chunk_size / AoSoA_t::vector_length;
+    if ( 0 == chunk_soa )
+        chunk_soa = 1;
+    std::size_t chunk_particle = chunk_soa * AoSoA_t::vector_length;
+    unsigned long long num_chunk_local =
+        ( aosoa.numSoA() + chunk_soa - 1 ) / chunk_soa;
+    unsigned long long num_chunk = 0;
+    MPI_Allreduce( &num_chunk_local, &num_chunk, 1, MPI_UNSIGNED_LONG_LONG,
+                   MPI_MAX, comm );
+
+    // Double-buffered host staging - one buffer is written while the next
+    // device-to-host copy is in flight.
+    host_aosoa_type buffers[2] = {
+        host_aosoa_type( "hdf5_stage_0", chunk_particle ),
+        host_aosoa_type( "hdf5_stage_1", chunk_particle ) };
+    execution_space exec_space{};
+
+    // Enqueue the device-to-host copy of a chunk of SoA blocks.
+    auto copy_chunk = [&]( const unsigned long long c )
+    {
+        std::size_t soa_begin = c * chunk_soa;
+        std::size_t num_copy_soa = chunk_soa;
+        if ( soa_begin + num_copy_soa > aosoa.numSoA() )
+            num_copy_soa = aosoa.numSoA() - soa_begin;
+        Kokkos::Impl::DeepCopy<Kokkos::HostSpace,
+                               typename AoSoA_t::memory_space,
+                               execution_space>(
+            exec_space, buffers[c % 2].data(), aosoa.data() + soa_begin,
+            num_copy_soa * sizeof( soa_type ) );
+    };
+    if ( num_chunk_local > 0 )
+    {
+        copy_chunk( 0 );
+        exec_space.fence();
+    }
+
+    // Write the chunks. Ranks past their local data keep participating in
+    // the collective writes with empty selections.
+    for ( unsigned long long c = 0; c < num_chunk; ++c )
+    {
+        if ( c + 1 < num_chunk_local )
+            copy_chunk( c + 1 );
+
+        std::size_t num_write = 0;
+        unsigned long long particle_begin = c * chunk_particle;
+        if ( particle_begin < local_num_particle )
+            num_write = ( local_num_particle - particle_begin <
+                          chunk_particle )
+                            ? local_num_particle - particle_begin
+                            : chunk_particle;
+
+        std::size_t field_id = 0;
+        (void)std::initializer_list<int>{
+            ( Impl::writeFieldChunk<CoordIndex>(
+                  datasets[field_id++], dxpl, buffers[c % 2], num_write,
+                  offset + particle_begin ),
+              0 ),
+            ( Impl::writeFieldChunk<FieldIndex>(
+                  datasets[field_id++], dxpl, buffers[c % 2], num_write,
+                  offset + particle_begin ),
+              0 )... };
+
+        // The next buffer must be full before it is written.
+        if ( c + 1 < num_chunk_local )
+            exec_space.fence();
+    }
+
+    for ( std::size_t f = 0; f < num_field; ++f )
+        H5Dclose( datasets[f] );
+    H5Pclose( dxpl );
+    H5Fclose( file );
+
+    // The first rank writes the XDMF description.
+    if ( 0 == comm_rank )
+    {
+        std::vector<std::size_t> field_comps = { Impl::sliceComponents(
+            Cabana::slice<CoordIndex>( aosoa ) ) };
+        std::vector<std::string> field_types = { Impl::HDF5Traits<
+            typename AoSoA_t::template member_value_type<CoordIndex>>::
+                                                     xdmfType() };
+        std::vector<int> field_precisions = { Impl::HDF5Traits<
+            typename AoSoA_t::template member_value_type<CoordIndex>>::
+                                                  xdmf_precision };
+        (void)std::initializer_list<int>{
+            ( field_comps.push_back( Impl::sliceComponents(
+                  Cabana::slice<FieldIndex>( aosoa ) ) ),
+              field_types.push_back(
+                  Impl::HDF5Traits<typename AoSoA_t::template
+                                       member_value_type<FieldIndex>>::
+                      xdmfType() ),
+              field_precisions.push_back(
+                  Impl::HDF5Traits<typename AoSoA_t::template
+                                       member_value_type<FieldIndex>>::
+                      xdmf_precision ),
+              0 )... };
+        std::string xmf_name =
+            prefix + "_" + std::to_string( time_step_index ) + ".xmf";
+        Impl::writeXdmf( xmf_name, h5_name, time, global_num_particle,
+                         field_names, field_comps, field_types,
+                         field_precisions );
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace HDF5ParticleOutput
+} // end namespace Experimental
+} // end namespace Cabana
+
+#endif // end CABANA_HDF5PARTICLEOUTPUT_HPP
@@ -18,13 +18,20 @@
 
 #include <Cabana_AoSoA.hpp>
 #include <Cabana_CommunicationPlan.hpp>
+#include <Cabana_PinnedBufferPool.hpp>
+#include <Cabana_Profiling.hpp>
 #include <Cabana_Slice.hpp>
 
 #include <Kokkos_Core.hpp>
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <exception>
+#include <map>
+#include <numeric>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace Cabana
@@ -36,6 +43,10 @@ namespace Cabana
   \tparam DeviceType Device type for which the data for this class will be
   allocated and where parallel execution occurs.
 
+  \tparam ExportIndexType Integer type of the export steering vector
+  entries. Defaults to std::size_t. A 32-bit type halves the steering
+  memory when the number of local elements fits in it.
+
   The halo allows for scatter and gather operations between locally-owned and
   ghosted data. All data in the Halo (e.g. export and import data) is from the
   point of view of the forward *GATHER* operation such that, for example, the
@@ -54,8 +65,8 @@ namespace Cabana
   ghost from is the unique owner of that data. Import is used in the context
   of the forward communication plan (the gather).
 */
-template <class DeviceType>
-class Halo : public CommunicationPlan<DeviceType>
+template <class DeviceType, class ExportIndexType = std::size_t>
+class Halo : public CommunicationPlan<DeviceType, ExportIndexType>
 {
   public:
     /*!
@@ -103,7 +114,7 @@ class Halo : public CommunicationPlan<DeviceType>
           const IdViewType& element_export_ids,
           const RankViewType& element_export_ranks,
           const std::vector<int>& neighbor_ranks )
-        : CommunicationPlan<DeviceType>( comm )
+        : CommunicationPlan<DeviceType, ExportIndexType>( comm )
         , _num_local( num_local )
     {
         if ( element_export_ids.size() != element_export_ranks.size() )
@@ -152,7 +163,7 @@ class Halo : public CommunicationPlan<DeviceType>
     Halo( MPI_Comm comm, const std::size_t num_local,
           const IdViewType& element_export_ids,
           const RankViewType& element_export_ranks )
-        : CommunicationPlan<DeviceType>( comm )
+        : CommunicationPlan<DeviceType, ExportIndexType>( comm )
         , _num_local( num_local )
     {
         if ( element_export_ids.size() != element_export_ranks.size() )
@@ -190,8 +201,8 @@ struct is_halo_impl : public std::false_type
 {
 };
 
-template <typename DeviceType>
-struct is_halo_impl<Halo<DeviceType>> : public std::true_type
+template <typename DeviceType, typename ExportIndexType>
+struct is_halo_impl<Halo<DeviceType, ExportIndexType>> : public std::true_type
 {
 };
 //! \endcond
@@ -202,6 +213,584 @@ struct is_halo : public is_halo_impl<typename std::remove_cv<T>::type>::type
 {
 };
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a range policy over the locally-owned elements of a
+  halo-decomposed container.
+
+  Halo-decomposed containers hold the locally-owned elements in the first
+  halo.numLocal() entries and the ghosted elements in the next
+  halo.numGhost() entries. Kernels that treat owned and ghosted elements
+  differently should launch over these ranges directly instead of storing
+  a per-element ownership flag and branching on it - the element order
+  already encodes the ownership test.
+
+  \tparam ExecutionSpace The execution space the policy launches in.
+
+  \param halo The halo describing the owned/ghosted decomposition.
+
+  \return A range policy over the locally-owned elements.
+*/
+template <class ExecutionSpace, class Halo_t>
+Kokkos::RangePolicy<ExecutionSpace> ownedPolicy( const Halo_t& halo )
+{
+    static_assert( is_halo<Halo_t>::value, "ownedPolicy requires a Halo" );
+    return Kokkos::RangePolicy<ExecutionSpace>( 0, halo.numLocal() );
+}
+
+/*!
+  \brief Create a range policy over the ghosted elements of a
+  halo-decomposed container.
+
+  The counterpart of ownedPolicy() covering the ghosted elements that
+  follow the locally-owned elements.
+
+  \tparam ExecutionSpace The execution space the policy launches in.
+
+  \param halo The halo describing the owned/ghosted decomposition.
+
+  \return A range policy over the ghosted elements.
+*/
+template <class ExecutionSpace, class Halo_t>
+Kokkos::RangePolicy<ExecutionSpace> ghostPolicy( const Halo_t& halo )
+{
+    static_assert( is_halo<Halo_t>::value, "ghostPolicy requires a Halo" );
+    return Kokkos::RangePolicy<ExecutionSpace>(
+        halo.numLocal(), halo.numLocal() + halo.numGhost() );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Version counter tracking whether the ghosted copy of a slice is
+  current.
+
+  Sub-stepped and multi-rate integrators conservatively re-gather every
+  ghosted slice each sub-step even though many slices did not change since
+  the last gather. A SliceVersion pairs with a slice (or AoSoA) and records
+  two counters: a write version bumped by modify() whenever a kernel writes
+  the locally owned data, and a gather version recorded when the ghosts were
+  last refreshed. gatherIfStale() compares the two and skips the exchange
+  entirely when the ghosts are already current.
+
+  Because the gather is a collective, modify() must be called symmetrically
+  on all ranks that share the halo (i.e. every rank declares the write for
+  the same sub-steps) so that all ranks agree on whether the exchange runs.
+  This is the natural pattern in an SPMD time integrator and avoids a global
+  reduction on every query.
+*/
+class SliceVersion
+{
+  public:
+    //! Declare that the locally owned data has been modified. Must be
+    //! called on all ranks sharing the halo.
+    void modify() { ++_write_version; }
+
+    //! Returns true if the owned data has been modified since the ghosted
+    //! data was last gathered.
+    bool stale() const { return _gather_version != _write_version; }
+
+    //! Record that the ghosted data now matches the owned data.
+    void markCurrent() { _gather_version = _write_version; }
+
+  private:
+    // Start with the write version ahead of the gather version so the
+    // first gather always runs.
+    unsigned long long _write_version = 1;
+    unsigned long long _gather_version = 0;
+};
+
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+//---------------------------------------------------------------------------//
+// Stage the ghost requests of a pull-mode halo on the host grouped by the
+// owning rank. Request order within an owner is preserved.
+template <class IdViewType, class RankViewType>
+std::map<int, std::vector<std::size_t>>
+groupHaloRequests( const IdViewType& element_import_ids,
+                   const RankViewType& element_import_ranks )
+{
+    using device_type = typename RankViewType::device_type;
+    using execution_space = typename device_type::execution_space;
+
+    if ( element_import_ids.size() != element_import_ranks.size() )
+        throw std::runtime_error( "Import ids and ranks different sizes!" );
+
+    std::size_t num_request = element_import_ranks.size();
+
+    // Stage the request data in rank-1 views so both views and slices can
+    // be copied to the host.
+    Kokkos::View<int*, device_type> import_ranks(
+        Kokkos::ViewAllocateWithoutInitializing( "import_ranks" ),
+        num_request );
+    Kokkos::View<std::size_t*, device_type> import_ids(
+        Kokkos::ViewAllocateWithoutInitializing( "import_ids" ), num_request );
+    Kokkos::parallel_for(
+        "Cabana::createHaloFromImports::stage_requests",
+        Kokkos::RangePolicy<execution_space>( 0, num_request ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            import_ranks( i ) = element_import_ranks( i );
+            import_ids( i ) = element_import_ids( i );
+        } );
+    Kokkos::fence();
+    auto host_ranks = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           import_ranks );
+    auto host_ids =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), import_ids );
+
+    // Group the requests by owner.
+    std::map<int, std::vector<std::size_t>> request_lists;
+    for ( std::size_t i = 0; i < num_request; ++i )
+    {
+        if ( host_ranks( i ) < 0 )
+            throw std::runtime_error( "Negative owner rank in halo request!" );
+        request_lists[host_ranks( i )].push_back( host_ids( i ) );
+    }
+    return request_lists;
+}
+
+//---------------------------------------------------------------------------//
+// Build a halo from the requests received by the owning side of a pull-mode
+// exchange. The received request lists become the export ids and the
+// requesters become the export ranks.
+template <class DeviceType>
+Halo<DeviceType>
+buildHaloFromRequests( MPI_Comm comm, const std::size_t num_local,
+                       const std::vector<int>& requester_ranks,
+                       const std::vector<std::vector<std::size_t>>& requests,
+                       const std::vector<int>& neighbor_ranks )
+{
+    using memory_space = typename DeviceType::memory_space;
+
+    std::size_t total_export = 0;
+    for ( auto& ids : requests )
+        total_export += ids.size();
+
+    Kokkos::View<std::size_t*, Kokkos::HostSpace> host_export_ids(
+        Kokkos::ViewAllocateWithoutInitializing( "halo_export_ids" ),
+        total_export );
+    Kokkos::View<int*, Kokkos::HostSpace> host_export_ranks(
+        Kokkos::ViewAllocateWithoutInitializing( "halo_export_ranks" ),
+        total_export );
+    std::size_t offset = 0;
+    for ( std::size_t n = 0; n < requester_ranks.size(); ++n )
+        for ( auto id : requests[n] )
+        {
+            if ( id >= num_local )
+                throw std::runtime_error(
+                    "Requested halo id is not locally owned!" );
+            host_export_ids( offset ) = id;
+            host_export_ranks( offset ) = requester_ranks[n];
+            ++offset;
+        }
+
+    auto export_ids =
+        Kokkos::create_mirror_view_and_copy( memory_space(), host_export_ids );
+    auto export_ranks = Kokkos::create_mirror_view_and_copy(
+        memory_space(), host_export_ranks );
+
+    return Halo<DeviceType>( comm, num_local, export_ids, export_ranks,
+                             neighbor_ranks );
+}
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a halo in pull mode from the ghosts this rank wants to
+  receive.
+
+  \tparam IdViewType The container type for the requested element ids. This
+  container type can be either a Kokkos View or a Cabana Slice.
+
+  \tparam RankViewType The container type for the owning ranks of the
+  requested elements. This container type can be either a Kokkos View or a
+  Cabana Slice.
+
+  \param comm The MPI communicator over which the halo is defined.
+
+  \param num_local The number of locally-owned elements on this rank.
+
+  \param element_import_ids The local ids *on the owning rank* of the
+  elements this rank wants as ghosts. Must be the same length as
+  element_import_ranks. The input is expected to be a Kokkos view or Cabana
+  slice in the same memory space as the communication plan.
+
+  \param element_import_ranks The rank owning each requested element. A rank
+  is allowed to request from itself. Must be the same length as
+  element_import_ids.
+
+  \return A halo whose forward gather sends the requested data from the
+  owners to this rank.
+
+  The regular halo constructors are push mode: the owner lists the elements
+  it exports and the receivers discover what they get. In pull mode the
+  receiver lists the elements it wants and compact request lists are sent to
+  the owners, which then build the export side of the plan from the received
+  requests. This is cheaper whenever the requesting side changes faster than
+  the owned data layout since only the small id lists are communicated to
+  rebuild the plan. The request lists are exchanged with the same
+  non-blocking sparse exchange used for topology discovery in the
+  communication plan so the cost scales with the number of neighbors.
+
+  As with the push-mode constructors the ghosts of the forward gather arrive
+  grouped by owning rank; gather an id member to identify individual ghosts
+  when the order within an owner matters.
+*/
+template <class IdViewType, class RankViewType>
+auto createHaloFromImports( MPI_Comm comm, const std::size_t num_local,
+                            const IdViewType& element_import_ids,
+                            const RankViewType& element_import_ranks )
+    -> Halo<typename RankViewType::device_type>
+{
+    using device_type = typename RankViewType::device_type;
+
+    int my_rank = -1;
+    MPI_Comm_rank( comm, &my_rank );
+
+    // Group the requests by owner.
+    auto request_lists =
+        Impl::groupHaloRequests( element_import_ids, element_import_ranks );
+
+    // Pick an mpi tag for the request exchange.
+    const int mpi_tag = 1223;
+
+    // Send each owner its request list with the NBX dynamic sparse
+    // exchange. The message payload is the id list itself so no separate
+    // count exchange is needed. Don't do any self sends.
+    std::vector<MPI_Request> send_requests;
+    for ( auto& pair : request_lists )
+        if ( pair.first != my_rank )
+        {
+            send_requests.push_back( MPI_Request() );
+            MPI_Issend( pair.second.data(), pair.second.size(),
+                        MPI_UNSIGNED_LONG, pair.first, mpi_tag, comm,
+                        &send_requests.back() );
+        }
+    std::vector<int> requester_ranks;
+    std::vector<std::vector<std::size_t>> requested_ids;
+    MPI_Request barrier_request;
+    bool barrier_active = false;
+    int exchange_done = 0;
+    while ( !exchange_done )
+    {
+        // Receive an incoming request list if one is available.
+        int message_pending = 0;
+        MPI_Status probe_status;
+        MPI_Iprobe( MPI_ANY_SOURCE, mpi_tag, comm, &message_pending,
+                    &probe_status );
+        if ( message_pending )
+        {
+            int count = 0;
+            MPI_Get_count( &probe_status, MPI_UNSIGNED_LONG, &count );
+            std::vector<std::size_t> ids( count );
+            MPI_Recv( ids.data(), count, MPI_UNSIGNED_LONG,
+                      probe_status.MPI_SOURCE, mpi_tag, comm,
+                      MPI_STATUS_IGNORE );
+            requester_ranks.push_back( probe_status.MPI_SOURCE );
+            requested_ids.push_back( std::move( ids ) );
+        }
+
+        // Once our own synchronous sends have all been matched enter the
+        // non-blocking barrier. The exchange is complete when the barrier
+        // is.
+        if ( barrier_active )
+            MPI_Test( &barrier_request, &exchange_done, MPI_STATUS_IGNORE );
+        else
+        {
+            int sends_matched = 0;
+            MPI_Testall( send_requests.size(), send_requests.data(),
+                         &sends_matched, MPI_STATUSES_IGNORE );
+            if ( sends_matched )
+            {
+                MPI_Ibarrier( comm, &barrier_request );
+                barrier_active = true;
+            }
+        }
+    }
+
+    // Self requests don't need communication.
+    auto self_request = request_lists.find( my_rank );
+    if ( self_request != request_lists.end() )
+    {
+        requester_ranks.push_back( my_rank );
+        requested_ids.push_back( self_request->second );
+    }
+
+    // The topology is now known: we export to the requesters and import
+    // from the owners.
+    std::vector<int> neighbor_ranks = requester_ranks;
+    for ( auto& pair : request_lists )
+        neighbor_ranks.push_back( pair.first );
+    std::sort( neighbor_ranks.begin(), neighbor_ranks.end() );
+    neighbor_ranks.erase(
+        std::unique( neighbor_ranks.begin(), neighbor_ranks.end() ),
+        neighbor_ranks.end() );
+
+    return Impl::buildHaloFromRequests<device_type>(
+        comm, num_local, requester_ranks, requested_ids, neighbor_ranks );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a halo in pull mode from the ghosts this rank wants to
+  receive when the topology of the communication is already known.
+
+  \tparam IdViewType The container type for the requested element ids. This
+  container type can be either a Kokkos View or a Cabana Slice.
+
+  \tparam RankViewType The container type for the owning ranks of the
+  requested elements. This container type can be either a Kokkos View or a
+  Cabana Slice.
+
+  \param comm The MPI communicator over which the halo is defined.
+
+  \param num_local The number of locally-owned elements on this rank.
+
+  \param element_import_ids The local ids *on the owning rank* of the
+  elements this rank wants as ghosts. Must be the same length as
+  element_import_ranks.
+
+  \param element_import_ranks The rank owning each requested element. Each
+  rank must be one of the neighbor ranks. A rank is allowed to request from
+  itself.
+
+  \param neighbor_ranks List of ranks this rank will send to and receive
+  from. This list can include the calling rank. The elements in this list
+  must be unique.
+
+  \return A halo whose forward gather sends the requested data from the
+  owners to this rank.
+
+  Use this overload when the neighbor topology is stable across steps and
+  only the requested ghost sets change: the sparse topology discovery is
+  skipped and only the request counts and id lists are exchanged with the
+  known neighbors.
+*/
+template <class IdViewType, class RankViewType>
+auto createHaloFromImports( MPI_Comm comm, const std::size_t num_local,
+                            const IdViewType& element_import_ids,
+                            const RankViewType& element_import_ranks,
+                            const std::vector<int>& neighbor_ranks )
+    -> Halo<typename RankViewType::device_type>
+{
+    using device_type = typename RankViewType::device_type;
+
+    int my_rank = -1;
+    MPI_Comm_rank( comm, &my_rank );
+
+    // Group the requests by owner.
+    auto request_lists =
+        Impl::groupHaloRequests( element_import_ids, element_import_ranks );
+
+    // Pick mpi tags for the count and id exchanges.
+    const int mpi_tag_count = 1224;
+    const int mpi_tag_ids = 1225;
+
+    // Exchange request counts with the known neighbors.
+    int num_neighbor = neighbor_ranks.size();
+    std::vector<std::size_t> send_counts( num_neighbor, 0 );
+    std::vector<std::size_t> recv_counts( num_neighbor, 0 );
+    for ( int n = 0; n < num_neighbor; ++n )
+    {
+        auto list = request_lists.find( neighbor_ranks[n] );
+        if ( list != request_lists.end() )
+            send_counts[n] = list->second.size();
+    }
+    std::vector<MPI_Request> count_requests( num_neighbor );
+    for ( int n = 0; n < num_neighbor; ++n )
+        MPI_Irecv( &recv_counts[n], 1, MPI_UNSIGNED_LONG, neighbor_ranks[n],
+                   mpi_tag_count, comm, &count_requests[n] );
+    for ( int n = 0; n < num_neighbor; ++n )
+        MPI_Send( &send_counts[n], 1, MPI_UNSIGNED_LONG, neighbor_ranks[n],
+                  mpi_tag_count, comm );
+    MPI_Waitall( count_requests.size(), count_requests.data(),
+                 MPI_STATUSES_IGNORE );
+
+    // Exchange the request id lists.
+    std::vector<int> requester_ranks;
+    std::vector<std::vector<std::size_t>> requested_ids;
+    std::vector<MPI_Request> id_requests;
+    for ( int n = 0; n < num_neighbor; ++n )
+        if ( recv_counts[n] > 0 )
+        {
+            requester_ranks.push_back( neighbor_ranks[n] );
+            requested_ids.push_back(
+                std::vector<std::size_t>( recv_counts[n] ) );
+            id_requests.push_back( MPI_Request() );
+            MPI_Irecv( requested_ids.back().data(), recv_counts[n],
+                       MPI_UNSIGNED_LONG, neighbor_ranks[n], mpi_tag_ids,
+                       comm, &id_requests.back() );
+        }
+    for ( int n = 0; n < num_neighbor; ++n )
+        if ( send_counts[n] > 0 )
+            MPI_Send( request_lists[neighbor_ranks[n]].data(), send_counts[n],
+                      MPI_UNSIGNED_LONG, neighbor_ranks[n], mpi_tag_ids,
+                      comm );
+    MPI_Waitall( id_requests.size(), id_requests.data(),
+                 MPI_STATUSES_IGNORE );
+
+    return Impl::buildHaloFromRequests<device_type>(
+        comm, num_local, requester_ranks, requested_ids, neighbor_ranks );
+}
+
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+//---------------------------------------------------------------------------//
+// Index of the neighbor in the halo plan that is this rank itself, or -1 if
+// the plan has no self neighbor. The self segment never needs to touch MPI -
+// it moves between the send and receive buffers with a plain peer copy,
+// which for device buffers is a direct device-to-device transfer.
+template <class Halo_t>
+int selfNeighbor( const Halo_t& halo )
+{
+    int my_rank = -1;
+    MPI_Comm_rank( halo.comm(), &my_rank );
+    for ( int n = 0; n < halo.numNeighbor(); ++n )
+        if ( halo.neighborRank( n ) == my_rank )
+            return n;
+    return -1;
+}
+
+//---------------------------------------------------------------------------//
+// Check that every slice in a fused gather is the right size.
+inline void checkFusedSliceSizes( const std::size_t ) {}
+
+template <class Slice_t, class... Slices>
+void checkFusedSliceSizes( const std::size_t size, const Slice_t& slice,
+                           const Slices&... rest )
+{
+    if ( slice.size() != size )
+        throw std::runtime_error( "Slice is the wrong size for gather!" );
+    checkFusedSliceSizes( size, rest... );
+}
+
+//---------------------------------------------------------------------------//
+// Compute the byte offset of each slice within a fused buffer element and
+// accumulate the total element size in bytes. Each slice is aligned within
+// the element to its value type.
+inline void fusedSliceLayout( std::size_t&, std::vector<std::size_t>& ) {}
+
+template <class Slice_t, class... Slices>
+void fusedSliceLayout( std::size_t& element_bytes,
+                       std::vector<std::size_t>& offsets, const Slice_t& slice,
+                       const Slices&... rest )
+{
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.rank(); ++d )
+        num_comp *= slice.extent( d );
+    const std::size_t value_bytes = sizeof( typename Slice_t::value_type );
+    element_bytes =
+        ( ( element_bytes + value_bytes - 1 ) / value_bytes ) * value_bytes;
+    offsets.push_back( element_bytes );
+    element_bytes += num_comp * value_bytes;
+    fusedSliceLayout( element_bytes, offsets, rest... );
+}
+
+//---------------------------------------------------------------------------//
+// Get the largest value type size over a set of slices. The fused element
+// stride is padded to this size so every buffer row stays aligned.
+inline constexpr std::size_t fusedMaxValueBytes() { return 1; }
+
+template <class Slice_t, class... Slices>
+constexpr std::size_t fusedMaxValueBytes( const Slice_t&,
+                                          const Slices&... rest )
+{
+    return ( sizeof( typename Slice_t::value_type ) >
+             fusedMaxValueBytes( rest... ) )
+               ? sizeof( typename Slice_t::value_type )
+               : fusedMaxValueBytes( rest... );
+}
+
+//---------------------------------------------------------------------------//
+// Pack each slice into its section of the fused send buffer.
+template <class Halo_t, class Buffer_t, class Steering_t>
+void packFusedSendBuffer( const Halo_t&, const Buffer_t&, const Steering_t&,
+                          const std::vector<std::size_t>&, const std::size_t )
+{
+}
+
+template <class Halo_t, class Buffer_t, class Steering_t, class Slice_t,
+          class... Slices>
+void packFusedSendBuffer( const Halo_t& halo, const Buffer_t& send_buffer,
+                          const Steering_t& steering,
+                          const std::vector<std::size_t>& offsets,
+                          const std::size_t s, const Slice_t& slice,
+                          const Slices&... rest )
+{
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.rank(); ++d )
+        num_comp *= slice.extent( d );
+    auto slice_data = slice.data();
+    const std::size_t offset = offsets[s];
+    auto pack_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto is = Slice_t::index_type::s( steering( i ) );
+        auto ia = Slice_t::index_type::a( steering( i ) );
+        std::size_t slice_offset = is * slice.stride( 0 ) + ia;
+        auto* buffer_data = reinterpret_cast<typename Slice_t::value_type*>(
+            &send_buffer( i, offset ) );
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            buffer_data[n] =
+                slice_data[slice_offset + n * Slice_t::vector_length];
+    };
+    Kokkos::RangePolicy<typename Halo_t::execution_space> pack_policy(
+        0, halo.totalNumExport() );
+    Kokkos::parallel_for( "Cabana::gather::pack_fused_send_buffer",
+                          pack_policy, pack_func );
+    packFusedSendBuffer( halo, send_buffer, steering, offsets, s + 1,
+                         rest... );
+}
+
+//---------------------------------------------------------------------------//
+// Unpack each slice from its section of the fused receive buffer into the
+// ghosted elements.
+template <class Halo_t, class Buffer_t>
+void unpackFusedRecvBuffer( const Halo_t&, const Buffer_t&,
+                            const std::vector<std::size_t>&,
+                            const std::size_t )
+{
+}
+
+template <class Halo_t, class Buffer_t, class Slice_t, class... Slices>
+void unpackFusedRecvBuffer( const Halo_t& halo, const Buffer_t& recv_buffer,
+                            const std::vector<std::size_t>& offsets,
+                            const std::size_t s, const Slice_t& slice,
+                            const Slices&... rest )
+{
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.rank(); ++d )
+        num_comp *= slice.extent( d );
+    auto slice_data = slice.data();
+    const std::size_t offset = offsets[s];
+    const std::size_t num_local = halo.numLocal();
+    auto unpack_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        std::size_t ghost_idx = i + num_local;
+        auto is = Slice_t::index_type::s( ghost_idx );
+        auto ia = Slice_t::index_type::a( ghost_idx );
+        std::size_t slice_offset = is * slice.stride( 0 ) + ia;
+        const auto* buffer_data =
+            reinterpret_cast<const typename Slice_t::value_type*>(
+                &recv_buffer( i, offset ) );
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            slice_data[slice_offset + Slice_t::vector_length * n] =
+                buffer_data[n];
+    };
+    Kokkos::RangePolicy<typename Halo_t::execution_space> unpack_policy(
+        0, halo.totalNumImport() );
+    Kokkos::parallel_for( "Cabana::gather::unpack_fused_recv_buffer",
+                          unpack_policy, unpack_func );
+    unpackFusedRecvBuffer( halo, recv_buffer, offsets, s + 1, rest... );
+}
+
+//---------------------------------------------------------------------------//
+//! \endcond
+} // end namespace Impl
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Synchronously gather data from the local decomposition to the ghosts
@@ -236,88 +825,273 @@ void gather( const Halo_t& halo, AoSoA_t& aosoa,
     if ( aosoa.size() != halo.numLocal() + halo.numGhost() )
         throw std::runtime_error( "AoSoA is the wrong size for gather!" );
 
-    // Allocate a send buffer.
-    Kokkos::View<typename AoSoA_t::tuple_type*, typename Halo_t::memory_space>
-        send_buffer(
-            Kokkos::ViewAllocateWithoutInitializing( "halo_send_buffer" ),
+    Profiling::ScopedRegion region( "Cabana::gather" );
+    Profiling::addCounter( "Cabana::gather::bytes_packed",
+                           halo.totalNumExport() *
+                               sizeof( typename AoSoA_t::tuple_type ) );
+
+    // Get a send buffer. If the halo has persistent buffers enabled this
+    // reuses the buffer from the previous call, growing it if needed.
+    auto send_buffer =
+        halo.template getSendBuffer<typename AoSoA_t::tuple_type>(
             halo.totalNumExport() );
 
     // Get the steering vector for the sends.
     auto steering = halo.getExportSteering();
 
-    // Gather from the local data into a tuple-contiguous send buffer.
-    auto gather_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
-    {
-        send_buffer( i ) = aosoa.getTuple( steering( i ) );
-    };
-    Kokkos::RangePolicy<typename Halo_t::execution_space>
-        gather_send_buffer_policy( 0, halo.totalNumExport() );
-    Kokkos::parallel_for( "Cabana::gather::gather_send_buffer",
-                          gather_send_buffer_policy, gather_send_buffer_func );
-    Kokkos::fence();
-
-    // Allocate a receive buffer.
-    Kokkos::View<typename AoSoA_t::tuple_type*, typename Halo_t::memory_space>
-        recv_buffer(
-            Kokkos::ViewAllocateWithoutInitializing( "halo_recv_buffer" ),
+    // Get a receive buffer.
+    auto recv_buffer =
+        halo.template getReceiveBuffer<typename AoSoA_t::tuple_type>(
             halo.totalNumImport() );
 
-    // The halo has it's own communication space so choose any mpi tag.
-    const int mpi_tag = 2345;
+    // Gather a range of the local data into the tuple-contiguous send
+    // buffer.
+    auto pack_segment = [&]( const std::size_t begin, const std::size_t end ) {
+        auto gather_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            send_buffer( i ) = aosoa.getTuple( steering( i ) );
+        };
+        Kokkos::RangePolicy<typename Halo_t::execution_space>
+            gather_send_buffer_policy( begin, end );
+        Kokkos::parallel_for( "Cabana::gather::gather_send_buffer",
+                              gather_send_buffer_policy,
+                              gather_send_buffer_func );
+    };
+
+    // Extract a range of the receive buffer into the ghosted elements.
+    std::size_t num_local = halo.numLocal();
+    auto unpack_segment = [&]( const std::size_t begin,
+                               const std::size_t end ) {
+        auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            std::size_t ghost_idx = i + num_local;
+            aosoa.setTuple( ghost_idx, recv_buffer( i ) );
+        };
+        Kokkos::RangePolicy<typename Halo_t::execution_space>
+            extract_recv_buffer_policy( begin, end );
+        Kokkos::parallel_for( "Cabana::gather::extract_recv_buffer",
+                              extract_recv_buffer_policy,
+                              extract_recv_buffer_func );
+    };
 
-    // Post non-blocking receives.
+    // Compute the offset of each neighbor's segment in the buffers.
     int num_n = halo.numNeighbor();
-    std::vector<MPI_Request> requests( num_n );
-    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+    std::vector<std::size_t> send_begin( num_n ), recv_begin( num_n );
     for ( int n = 0; n < num_n; ++n )
     {
-        recv_range.second = recv_range.first + halo.numImport( n );
-
-        auto recv_subview = Kokkos::subview( recv_buffer, recv_range );
-
-        MPI_Irecv( recv_subview.data(),
-                   recv_subview.size() * sizeof( typename AoSoA_t::tuple_type ),
-                   MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm(),
-                   &( requests[n] ) );
-
-        recv_range.first = recv_range.second;
+        send_begin[n] = ( 0 == n )
+                            ? 0
+                            : send_begin[n - 1] + halo.numExport( n - 1 );
+        recv_begin[n] = ( 0 == n )
+                            ? 0
+                            : recv_begin[n - 1] + halo.numImport( n - 1 );
     }
 
-    // Do blocking sends.
-    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
-    {
-        send_range.second = send_range.first + halo.numExport( n );
-
-        auto send_subview = Kokkos::subview( send_buffer, send_range );
-
-        MPI_Send( send_subview.data(),
-                  send_subview.size() * sizeof( typename AoSoA_t::tuple_type ),
-                  MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm() );
+    // Issue the exchange on the given send and receive buffers. A generic
+    // lambda so the same code runs on the device buffers or on host staging
+    // copies. The staging lambdas move a segment of the buffers between the
+    // device and the host and are no-ops when MPI uses the device buffers
+    // directly.
+    auto do_exchange = [&]( auto& mpi_send_buffer, auto& mpi_recv_buffer,
+                            auto&& stage_send, auto&& stage_recv ) {
+        // Exchange with a neighbor collective over the halo's graph
+        // communicator if that backend is enabled.
+        if ( halo.neighborCollectivesEnabled() )
+        {
+            pack_segment( 0, halo.totalNumExport() );
+            Kokkos::fence();
+            stage_send( 0, halo.totalNumExport() );
+
+            const int tuple_bytes = sizeof( typename AoSoA_t::tuple_type );
+            std::vector<int> send_counts( num_n ), send_displs( num_n ),
+                recv_counts( num_n ), recv_displs( num_n );
+            int send_offset = 0;
+            int recv_offset = 0;
+            for ( int n = 0; n < num_n; ++n )
+            {
+                send_counts[n] = halo.numExport( n ) * tuple_bytes;
+                recv_counts[n] = halo.numImport( n ) * tuple_bytes;
+                send_displs[n] = send_offset;
+                recv_displs[n] = recv_offset;
+                send_offset += send_counts[n];
+                recv_offset += recv_counts[n];
+            }
+            const int ec = MPI_Neighbor_alltoallv(
+                mpi_send_buffer.data(), send_counts.data(),
+                send_displs.data(), MPI_BYTE, mpi_recv_buffer.data(),
+                recv_counts.data(), recv_displs.data(), MPI_BYTE,
+                halo.graphComm() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+
+            stage_recv( 0, halo.totalNumImport() );
+            unpack_segment( 0, halo.totalNumImport() );
+            Kokkos::fence();
+        }
+        // Exchange one-sided if the RMA backend is enabled - expose the
+        // receive buffer as a window and put the packed data directly into
+        // each neighbor's buffer, avoiding per-message matching for static
+        // communication patterns.
+        else if ( halo.rmaExchangeEnabled() )
+        {
+            pack_segment( 0, halo.totalNumExport() );
+            Kokkos::fence();
+            stage_send( 0, halo.totalNumExport() );
+
+            const int tuple_bytes = sizeof( typename AoSoA_t::tuple_type );
+            auto window =
+                halo.rmaWindow( mpi_recv_buffer.data(),
+                                halo.totalNumImport() * tuple_bytes );
+            MPI_Win_fence( 0, window );
+            for ( int n = 0; n < num_n; ++n )
+            {
+                std::pair<std::size_t, std::size_t> send_range = {
+                    send_begin[n], send_begin[n] + halo.numExport( n ) };
+
+                auto send_subview =
+                    Kokkos::subview( mpi_send_buffer, send_range );
+
+                MPI_Put( send_subview.data(),
+                         send_subview.size() * tuple_bytes, MPI_BYTE,
+                         halo.neighborRank( n ),
+                         halo.rmaPutOffset( n ) * tuple_bytes,
+                         send_subview.size() * tuple_bytes, MPI_BYTE,
+                         window );
+            }
+            const int ec = MPI_Win_fence( 0, window );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+
+            stage_recv( 0, halo.totalNumImport() );
+            unpack_segment( 0, halo.totalNumImport() );
+            Kokkos::fence();
+        }
+        else
+        {
+            // The halo has it's own communication space so choose any mpi
+            // tag.
+            const int mpi_tag = 2345;
+
+            // A neighbor that is this rank itself bypasses MPI entirely -
+            // its segment moves with a direct buffer-to-buffer peer copy.
+            const int self_n = Impl::selfNeighbor( halo );
+
+            // Post non-blocking receives.
+            std::vector<MPI_Request> recv_requests( num_n,
+                                                    MPI_REQUEST_NULL );
+            for ( int n = 0; n < num_n; ++n )
+            {
+                if ( n == self_n )
+                    continue;
+
+                std::pair<std::size_t, std::size_t> recv_range = {
+                    recv_begin[n], recv_begin[n] + halo.numImport( n ) };
+
+                auto recv_subview =
+                    Kokkos::subview( mpi_recv_buffer, recv_range );
+
+                MPI_Irecv( recv_subview.data(),
+                           recv_subview.size() *
+                               sizeof( typename AoSoA_t::tuple_type ),
+                           MPI_BYTE, halo.neighborRank( n ), mpi_tag,
+                           halo.comm(), &( recv_requests[n] ) );
+            }
+
+            // Pipeline the packs with the sends - pack each neighbor's
+            // segment and put its message on the wire immediately so the
+            // remaining pack kernels overlap the message transit time.
+            std::vector<MPI_Request> send_requests( num_n,
+                                                    MPI_REQUEST_NULL );
+            for ( int n = 0; n < num_n; ++n )
+            {
+                std::pair<std::size_t, std::size_t> send_range = {
+                    send_begin[n], send_begin[n] + halo.numExport( n ) };
+
+                pack_segment( send_range.first, send_range.second );
+                Kokkos::fence();
+                stage_send( send_range.first, send_range.second );
+
+                if ( n == self_n )
+                {
+                    // Peer copy the self segment straight into the receive
+                    // buffer and unpack it - no message, no matching.
+                    std::pair<std::size_t, std::size_t> recv_range = {
+                        recv_begin[n], recv_begin[n] + halo.numImport( n ) };
+                    Kokkos::deep_copy(
+                        Kokkos::subview( mpi_recv_buffer, recv_range ),
+                        Kokkos::subview( mpi_send_buffer, send_range ) );
+                    stage_recv( recv_range.first, recv_range.second );
+                    unpack_segment( recv_range.first, recv_range.second );
+                    continue;
+                }
+
+                auto send_subview =
+                    Kokkos::subview( mpi_send_buffer, send_range );
+
+                MPI_Isend( send_subview.data(),
+                           send_subview.size() *
+                               sizeof( typename AoSoA_t::tuple_type ),
+                           MPI_BYTE, halo.neighborRank( n ), mpi_tag,
+                           halo.comm(), &( send_requests[n] ) );
+            }
+
+            // Unpack each receive as it completes instead of waiting for
+            // them all so the unpack kernels overlap the remaining wire
+            // time.
+            const int num_msg = ( self_n >= 0 ) ? num_n - 1 : num_n;
+            for ( int r = 0; r < num_msg; ++r )
+            {
+                int n = -1;
+                const int ec = MPI_Waitany( recv_requests.size(),
+                                            recv_requests.data(), &n,
+                                            MPI_STATUS_IGNORE );
+                if ( MPI_SUCCESS != ec )
+                    throw std::logic_error( "Failed MPI Communication" );
+
+                stage_recv( recv_begin[n],
+                            recv_begin[n] + halo.numImport( n ) );
+                unpack_segment( recv_begin[n],
+                                recv_begin[n] + halo.numImport( n ) );
+            }
+            Kokkos::fence();
+
+            // Complete the sends.
+            const int ec = MPI_Waitall( send_requests.size(),
+                                        send_requests.data(),
+                                        MPI_STATUSES_IGNORE );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+        }
+    };
 
-        send_range.first = send_range.second;
+    // Pass the device buffers directly to MPI or stage them through host
+    // memory if the MPI library cannot access device allocations.
+    if ( halo.deviceDirectEnabled() )
+    {
+        auto no_stage = []( const std::size_t, const std::size_t ) {};
+        do_exchange( send_buffer, recv_buffer, no_stage, no_stage );
     }
-
-    // Wait on non-blocking receives.
-    std::vector<MPI_Status> status( num_n );
-    const int ec =
-        MPI_Waitall( requests.size(), requests.data(), status.data() );
-    if ( MPI_SUCCESS != ec )
-        throw std::logic_error( "Failed MPI Communication" );
-
-    // Extract the receive buffer into the ghosted elements.
-    std::size_t num_local = halo.numLocal();
-    auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    else
     {
-        std::size_t ghost_idx = i + num_local;
-        aosoa.setTuple( ghost_idx, recv_buffer( i ) );
-    };
-    Kokkos::RangePolicy<typename Halo_t::execution_space>
-        extract_recv_buffer_policy( 0, halo.totalNumImport() );
-    Kokkos::parallel_for( "Cabana::gather::extract_recv_buffer",
-                          extract_recv_buffer_policy,
-                          extract_recv_buffer_func );
-    Kokkos::fence();
+        PinnedMirror<decltype( send_buffer )> send_stage( halo.pinnedPool(),
+                                                          send_buffer );
+        PinnedMirror<decltype( recv_buffer )> recv_stage( halo.pinnedPool(),
+                                                          recv_buffer );
+        auto stage_send = [&]( const std::size_t begin,
+                               const std::size_t end ) {
+            std::pair<std::size_t, std::size_t> range = { begin, end };
+            Kokkos::deep_copy( Kokkos::subview( send_stage.view, range ),
+                               Kokkos::subview( send_buffer, range ) );
+        };
+        auto stage_recv = [&]( const std::size_t begin,
+                               const std::size_t end ) {
+            std::pair<std::size_t, std::size_t> range = { begin, end };
+            Kokkos::deep_copy( Kokkos::subview( recv_buffer, range ),
+                               Kokkos::subview( recv_stage.view, range ) );
+        };
+        do_exchange( send_stage.view, recv_stage.view, stage_send,
+                     stage_recv );
+    }
 
     // Barrier before completing to ensure synchronization.
     MPI_Barrier( halo.comm() );
@@ -357,168 +1131,1329 @@ void gather( const Halo_t& halo, Slice_t& slice,
     if ( slice.size() != halo.numLocal() + halo.numGhost() )
         throw std::runtime_error( "Slice is the wrong size for gather!" );
 
+    Profiling::ScopedRegion region( "Cabana::gather" );
+
     // Get the number of components in the slice.
     std::size_t num_comp = 1;
     for ( std::size_t d = 2; d < slice.rank(); ++d )
         num_comp *= slice.extent( d );
 
+    Profiling::addCounter( "Cabana::gather::bytes_packed",
+                           halo.totalNumExport() * num_comp *
+                               sizeof( typename Slice_t::value_type ) );
+
     // Get the raw slice data.
     auto slice_data = slice.data();
 
-    // Allocate a send buffer. Note this one is layout right so the components
-    // are consecutive.
-    Kokkos::View<typename Slice_t::value_type**, Kokkos::LayoutRight,
-                 typename Halo_t::memory_space>
-        send_buffer(
-            Kokkos::ViewAllocateWithoutInitializing( "halo_send_buffer" ),
+    // Get a send buffer. Note this one is layout right so the components are
+    // consecutive. If the halo has persistent buffers enabled this reuses
+    // the buffer from the previous call, growing it if needed.
+    auto send_buffer =
+        halo.template getSendBuffer<typename Slice_t::value_type>(
             halo.totalNumExport(), num_comp );
 
     // Get the steering vector for the sends.
     auto steering = halo.getExportSteering();
 
-    // Gather from the local data into a tuple-contiguous send buffer.
-    auto gather_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
-    {
-        auto s = Slice_t::index_type::s( steering( i ) );
-        auto a = Slice_t::index_type::a( steering( i ) );
-        std::size_t slice_offset = s * slice.stride( 0 ) + a;
-        for ( std::size_t n = 0; n < num_comp; ++n )
-            send_buffer( i, n ) =
-                slice_data[slice_offset + n * Slice_t::vector_length];
-    };
-    Kokkos::RangePolicy<typename Halo_t::execution_space>
-        gather_send_buffer_policy( 0, halo.totalNumExport() );
-    Kokkos::parallel_for( "Cabana::gather::gather_send_buffer",
-                          gather_send_buffer_policy, gather_send_buffer_func );
-    Kokkos::fence();
-
-    // Allocate a receive buffer. Note this one is layout right so the
-    // components are consecutive.
-    Kokkos::View<typename Slice_t::value_type**, Kokkos::LayoutRight,
-                 typename Halo_t::memory_space>
-        recv_buffer(
-            Kokkos::ViewAllocateWithoutInitializing( "halo_recv_buffer" ),
+    // Get a receive buffer. Note this one is layout right so the components
+    // are consecutive.
+    auto recv_buffer =
+        halo.template getReceiveBuffer<typename Slice_t::value_type>(
             halo.totalNumImport(), num_comp );
 
-    // The halo has it's own communication space so choose any mpi tag.
-    const int mpi_tag = 2345;
+    // Gather a range of the local data into a tuple-contiguous send buffer.
+    auto pack_segment = [&]( const std::size_t begin, const std::size_t end ) {
+        auto gather_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            auto s = Slice_t::index_type::s( steering( i ) );
+            auto a = Slice_t::index_type::a( steering( i ) );
+            std::size_t slice_offset = s * slice.stride( 0 ) + a;
+            for ( std::size_t n = 0; n < num_comp; ++n )
+                send_buffer( i, n ) =
+                    slice_data[slice_offset + n * Slice_t::vector_length];
+        };
+        Kokkos::RangePolicy<typename Halo_t::execution_space>
+            gather_send_buffer_policy( begin, end );
+        Kokkos::parallel_for( "Cabana::gather::gather_send_buffer",
+                              gather_send_buffer_policy,
+                              gather_send_buffer_func );
+    };
+
+    // Extract a range of the receive buffer into the ghosted elements.
+    std::size_t num_local = halo.numLocal();
+    auto unpack_segment = [&]( const std::size_t begin,
+                               const std::size_t end ) {
+        auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            std::size_t ghost_idx = i + num_local;
+            auto s = Slice_t::index_type::s( ghost_idx );
+            auto a = Slice_t::index_type::a( ghost_idx );
+            std::size_t slice_offset = s * slice.stride( 0 ) + a;
+            for ( std::size_t n = 0; n < num_comp; ++n )
+                slice_data[slice_offset + Slice_t::vector_length * n] =
+                    recv_buffer( i, n );
+        };
+        Kokkos::RangePolicy<typename Halo_t::execution_space>
+            extract_recv_buffer_policy( begin, end );
+        Kokkos::parallel_for( "Cabana::gather::extract_recv_buffer",
+                              extract_recv_buffer_policy,
+                              extract_recv_buffer_func );
+    };
 
-    // Post non-blocking receives.
+    // Compute the offset of each neighbor's segment in the buffers.
     int num_n = halo.numNeighbor();
-    std::vector<MPI_Request> requests( num_n );
-    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+    std::vector<std::size_t> send_begin( num_n ), recv_begin( num_n );
     for ( int n = 0; n < num_n; ++n )
     {
-        recv_range.second = recv_range.first + halo.numImport( n );
-
-        auto recv_subview =
-            Kokkos::subview( recv_buffer, recv_range, Kokkos::ALL );
+        send_begin[n] = ( 0 == n )
+                            ? 0
+                            : send_begin[n - 1] + halo.numExport( n - 1 );
+        recv_begin[n] = ( 0 == n )
+                            ? 0
+                            : recv_begin[n - 1] + halo.numImport( n - 1 );
+    }
 
-        MPI_Irecv( recv_subview.data(),
-                   recv_subview.size() * sizeof( typename Slice_t::value_type ),
-                   MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm(),
-                   &( requests[n] ) );
+    // Issue the exchange on the given send and receive buffers. A generic
+    // lambda so the same code runs on the device buffers or on host staging
+    // copies. The staging lambdas move a segment of the buffers between the
+    // device and the host and are no-ops when MPI uses the device buffers
+    // directly.
+    auto do_exchange = [&]( auto& mpi_send_buffer, auto& mpi_recv_buffer,
+                            auto&& stage_send, auto&& stage_recv ) {
+        // Exchange with a neighbor collective over the halo's graph
+        // communicator if that backend is enabled.
+        if ( halo.neighborCollectivesEnabled() )
+        {
+            pack_segment( 0, halo.totalNumExport() );
+            Kokkos::fence();
+            stage_send( 0, halo.totalNumExport() );
+
+            const int element_bytes =
+                num_comp * sizeof( typename Slice_t::value_type );
+            std::vector<int> send_counts( num_n ), send_displs( num_n ),
+                recv_counts( num_n ), recv_displs( num_n );
+            int send_offset = 0;
+            int recv_offset = 0;
+            for ( int n = 0; n < num_n; ++n )
+            {
+                send_counts[n] = halo.numExport( n ) * element_bytes;
+                recv_counts[n] = halo.numImport( n ) * element_bytes;
+                send_displs[n] = send_offset;
+                recv_displs[n] = recv_offset;
+                send_offset += send_counts[n];
+                recv_offset += recv_counts[n];
+            }
+            const int ec = MPI_Neighbor_alltoallv(
+                mpi_send_buffer.data(), send_counts.data(),
+                send_displs.data(), MPI_BYTE, mpi_recv_buffer.data(),
+                recv_counts.data(), recv_displs.data(), MPI_BYTE,
+                halo.graphComm() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+
+            stage_recv( 0, halo.totalNumImport() );
+            unpack_segment( 0, halo.totalNumImport() );
+            Kokkos::fence();
+        }
+        // Exchange one-sided if the RMA backend is enabled - expose the
+        // receive buffer as a window and put the packed data directly into
+        // each neighbor's buffer, avoiding per-message matching for static
+        // communication patterns.
+        else if ( halo.rmaExchangeEnabled() )
+        {
+            pack_segment( 0, halo.totalNumExport() );
+            Kokkos::fence();
+            stage_send( 0, halo.totalNumExport() );
+
+            const int element_bytes =
+                num_comp * sizeof( typename Slice_t::value_type );
+            auto window =
+                halo.rmaWindow( mpi_recv_buffer.data(),
+                                halo.totalNumImport() * element_bytes );
+            MPI_Win_fence( 0, window );
+            for ( int n = 0; n < num_n; ++n )
+            {
+                std::pair<std::size_t, std::size_t> send_range = {
+                    send_begin[n], send_begin[n] + halo.numExport( n ) };
+
+                auto send_subview = Kokkos::subview( mpi_send_buffer,
+                                                     send_range, Kokkos::ALL );
+
+                MPI_Put( send_subview.data(),
+                         send_subview.size() *
+                             sizeof( typename Slice_t::value_type ),
+                         MPI_BYTE, halo.neighborRank( n ),
+                         halo.rmaPutOffset( n ) * element_bytes,
+                         send_subview.size() *
+                             sizeof( typename Slice_t::value_type ),
+                         MPI_BYTE, window );
+            }
+            const int ec = MPI_Win_fence( 0, window );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+
+            stage_recv( 0, halo.totalNumImport() );
+            unpack_segment( 0, halo.totalNumImport() );
+            Kokkos::fence();
+        }
+        else
+        {
+            // The halo has it's own communication space so choose any mpi
+            // tag.
+            const int mpi_tag = 2345;
+
+            // A neighbor that is this rank itself bypasses MPI entirely -
+            // its segment moves with a direct buffer-to-buffer peer copy.
+            const int self_n = Impl::selfNeighbor( halo );
+
+            // Post non-blocking receives.
+            std::vector<MPI_Request> recv_requests( num_n,
+                                                    MPI_REQUEST_NULL );
+            for ( int n = 0; n < num_n; ++n )
+            {
+                if ( n == self_n )
+                    continue;
+
+                std::pair<std::size_t, std::size_t> recv_range = {
+                    recv_begin[n], recv_begin[n] + halo.numImport( n ) };
+
+                auto recv_subview = Kokkos::subview( mpi_recv_buffer,
+                                                     recv_range, Kokkos::ALL );
+
+                MPI_Irecv( recv_subview.data(),
+                           recv_subview.size() *
+                               sizeof( typename Slice_t::value_type ),
+                           MPI_BYTE, halo.neighborRank( n ), mpi_tag,
+                           halo.comm(), &( recv_requests[n] ) );
+            }
+
+            // Pipeline the packs with the sends - pack each neighbor's
+            // segment and put its message on the wire immediately so the
+            // remaining pack kernels overlap the message transit time.
+            std::vector<MPI_Request> send_requests( num_n,
+                                                    MPI_REQUEST_NULL );
+            for ( int n = 0; n < num_n; ++n )
+            {
+                std::pair<std::size_t, std::size_t> send_range = {
+                    send_begin[n], send_begin[n] + halo.numExport( n ) };
+
+                pack_segment( send_range.first, send_range.second );
+                Kokkos::fence();
+                stage_send( send_range.first, send_range.second );
+
+                if ( n == self_n )
+                {
+                    // Peer copy the self segment straight into the receive
+                    // buffer and unpack it - no message, no matching.
+                    std::pair<std::size_t, std::size_t> recv_range = {
+                        recv_begin[n], recv_begin[n] + halo.numImport( n ) };
+                    Kokkos::deep_copy(
+                        Kokkos::subview( mpi_recv_buffer, recv_range,
+                                         Kokkos::ALL ),
+                        Kokkos::subview( mpi_send_buffer, send_range,
+                                         Kokkos::ALL ) );
+                    stage_recv( recv_range.first, recv_range.second );
+                    unpack_segment( recv_range.first, recv_range.second );
+                    continue;
+                }
+
+                auto send_subview = Kokkos::subview( mpi_send_buffer,
+                                                     send_range, Kokkos::ALL );
+
+                MPI_Isend( send_subview.data(),
+                           send_subview.size() *
+                               sizeof( typename Slice_t::value_type ),
+                           MPI_BYTE, halo.neighborRank( n ), mpi_tag,
+                           halo.comm(), &( send_requests[n] ) );
+            }
+
+            // Unpack each receive as it completes instead of waiting for
+            // them all so the unpack kernels overlap the remaining wire
+            // time.
+            const int num_msg = ( self_n >= 0 ) ? num_n - 1 : num_n;
+            for ( int r = 0; r < num_msg; ++r )
+            {
+                int n = -1;
+                const int ec = MPI_Waitany( recv_requests.size(),
+                                            recv_requests.data(), &n,
+                                            MPI_STATUS_IGNORE );
+                if ( MPI_SUCCESS != ec )
+                    throw std::logic_error( "Failed MPI Communication" );
+
+                stage_recv( recv_begin[n],
+                            recv_begin[n] + halo.numImport( n ) );
+                unpack_segment( recv_begin[n],
+                                recv_begin[n] + halo.numImport( n ) );
+            }
+            Kokkos::fence();
+
+            // Complete the sends.
+            const int ec = MPI_Waitall( send_requests.size(),
+                                        send_requests.data(),
+                                        MPI_STATUSES_IGNORE );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+        }
+    };
 
-        recv_range.first = recv_range.second;
+    // Pass the device buffers directly to MPI or stage them through host
+    // memory if the MPI library cannot access device allocations.
+    if ( halo.deviceDirectEnabled() )
+    {
+        auto no_stage = []( const std::size_t, const std::size_t ) {};
+        do_exchange( send_buffer, recv_buffer, no_stage, no_stage );
     }
-
-    // Do blocking sends.
-    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
+    else
     {
-        send_range.second = send_range.first + halo.numExport( n );
+        PinnedMirror<decltype( send_buffer )> send_stage( halo.pinnedPool(),
+                                                          send_buffer );
+        PinnedMirror<decltype( recv_buffer )> recv_stage( halo.pinnedPool(),
+                                                          recv_buffer );
+        auto stage_send = [&]( const std::size_t begin,
+                               const std::size_t end ) {
+            std::pair<std::size_t, std::size_t> range = { begin, end };
+            Kokkos::deep_copy(
+                Kokkos::subview( send_stage.view, range, Kokkos::ALL ),
+                Kokkos::subview( send_buffer, range, Kokkos::ALL ) );
+        };
+        auto stage_recv = [&]( const std::size_t begin,
+                               const std::size_t end ) {
+            std::pair<std::size_t, std::size_t> range = { begin, end };
+            Kokkos::deep_copy(
+                Kokkos::subview( recv_buffer, range, Kokkos::ALL ),
+                Kokkos::subview( recv_stage.view, range, Kokkos::ALL ) );
+        };
+        do_exchange( send_stage.view, recv_stage.view, stage_send,
+                     stage_recv );
+    }
 
-        auto send_subview =
-            Kokkos::subview( send_buffer, send_range, Kokkos::ALL );
+    // Barrier before completing to ensure synchronization.
+    MPI_Barrier( halo.comm() );
+}
 
-        MPI_Send( send_subview.data(),
-                  send_subview.size() * sizeof( typename Slice_t::value_type ),
-                  MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm() );
+//---------------------------------------------------------------------------//
+/*!
+  \brief Gather data from the local decomposition to the ghosts only if the
+  owned data changed since the last gather.
 
-        send_range.first = send_range.second;
-    }
+  If the version reports that the owned data was not modified since the
+  ghosts were last refreshed this is a no-op; otherwise the regular gather
+  runs and the version is marked current. Because the gather is a
+  collective, the version must be modified symmetrically on all ranks
+  sharing the halo - see SliceVersion.
 
-    // Wait on non-blocking receives.
-    std::vector<MPI_Status> status( num_n );
-    const int ec =
-        MPI_Waitall( requests.size(), requests.data(), status.data() );
-    if ( MPI_SUCCESS != ec )
-        throw std::logic_error( "Failed MPI Communication" );
+  \tparam Halo_t Halo type - must be a Halo.
 
-    // Extract the receive buffer into the ghosted elements.
-    std::size_t num_local = halo.numLocal();
-    auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
-    {
-        std::size_t ghost_idx = i + num_local;
-        auto s = Slice_t::index_type::s( ghost_idx );
-        auto a = Slice_t::index_type::a( ghost_idx );
-        std::size_t slice_offset = s * slice.stride( 0 ) + a;
-        for ( std::size_t n = 0; n < num_comp; ++n )
-            slice_data[slice_offset + Slice_t::vector_length * n] =
-                recv_buffer( i, n );
-    };
-    Kokkos::RangePolicy<typename Halo_t::execution_space>
-        extract_recv_buffer_policy( 0, halo.totalNumImport() );
-    Kokkos::parallel_for( "Cabana::gather::extract_recv_buffer",
-                          extract_recv_buffer_policy,
-                          extract_recv_buffer_func );
-    Kokkos::fence();
+  \tparam AoSoA_t AoSoA type - must be an AoSoA.
 
-    // Barrier before completing to ensure synchronization.
-    MPI_Barrier( halo.comm() );
+  \param halo The halo to use for the gather.
+
+  \param aosoa The AoSoA on which to perform the gather.
+
+  \param version The version counter tracking modifications of the AoSoA.
+
+  \return True if the gather was performed, false if the ghosts were
+  already current.
+*/
+template <class Halo_t, class AoSoA_t>
+bool gatherIfStale( const Halo_t& halo, AoSoA_t& aosoa,
+                    SliceVersion& version,
+                    typename std::enable_if<( is_halo<Halo_t>::value &&
+                                              is_aosoa<AoSoA_t>::value ),
+                                            int>::type* = 0 )
+{
+    if ( !version.stale() )
+        return false;
+
+    gather( halo, aosoa );
+    version.markCurrent();
+    return true;
 }
 
 //---------------------------------------------------------------------------//
 /*!
-  \brief Synchronously scatter data from the ghosts to the local decomposition
-  of a slice using the halo reverse communication plan. This is a
-  multiply-owned to uniquely owned communication.
+  \brief Gather slice data from the local decomposition to the ghosts only
+  if the owned data changed since the last gather.
 
-  In a scatter operation results from ghosted values on other processors are
-  scattered back to the owning processor of the ghost and the value associated
-  with the ghost is summed into the locally owned value the ghost
-  represents. If a locally owned element is ghosted on multiple ranks, then
-  multiple contributions will be made to the sum, one for each rank.
+  If the version reports that the owned data was not modified since the
+  ghosts were last refreshed this is a no-op; otherwise the regular gather
+  runs and the version is marked current. Because the gather is a
+  collective, the version must be modified symmetrically on all ranks
+  sharing the halo - see SliceVersion.
 
   \tparam Halo_t Halo type - must be a Halo.
 
   \tparam Slice_t Slice type - must be a Slice.
 
-  \param halo The halo to use for the scatter.
+  \param halo The halo to use for the gather.
 
-  \param slice The Slice on which to perform the scatter. The Slice should have
-  a size equivalent to halo.numGhost() + halo.numLocal(). The locally owned
-  elements are expected to appear first (i.e. in the first halo.numLocal()
-  elements) and the ghosted elements are expected to appear second (i.e. in
-  the next halo.numGhost() elements()).
+  \param slice The Slice on which to perform the gather.
+
+  \param version The version counter tracking modifications of the slice.
+
+  \return True if the gather was performed, false if the ghosts were
+  already current.
 */
 template <class Halo_t, class Slice_t>
-void scatter( const Halo_t& halo, Slice_t& slice,
-              typename std::enable_if<( is_halo<Halo_t>::value &&
-                                        is_slice<Slice_t>::value ),
-                                      int>::type* = 0 )
+bool gatherIfStale( const Halo_t& halo, Slice_t& slice, SliceVersion& version,
+                    typename std::enable_if<( is_halo<Halo_t>::value &&
+                                              is_slice<Slice_t>::value ),
+                                            int>::type* = 0 )
+{
+    if ( !version.stale() )
+        return false;
+
+    gather( halo, slice );
+    version.markCurrent();
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously gather multiple slices using the halo forward
+  communication plan with a single fused message exchange. This is a
+  uniquely-owned to multiply-owned communication.
+
+  Gathering several slices with separate calls sends a separate (often small)
+  message per slice to each neighbor and pays the message latency once per
+  slice. This version packs all of the given slices into one interleaved
+  buffer per neighbor and sends a single message, amortizing the latency
+  across the slices. The result is identical to calling the single-slice
+  gather on each slice in turn.
+
+  \tparam Halo_t Halo type - must be a Halo.
+
+  \tparam Slice0_t First slice type - must be a Slice.
+
+  \tparam Slice1_t Second slice type - must be a Slice.
+
+  \tparam SliceRest_t Remaining slice types - must be Slices.
+
+  \param halo The halo to use for the gather.
+
+  \param slice_0 The first Slice on which to perform the gather.
+
+  \param slice_1 The second Slice on which to perform the gather.
+
+  \param slice_rest The remaining Slices on which to perform the gather. All
+  slices should have a size equivalent to halo.numGhost() + halo.numLocal()
+  with the locally owned elements first and the ghosted elements second.
+*/
+template <class Halo_t, class Slice0_t, class Slice1_t, class... SliceRest_t>
+typename std::enable_if<( is_halo<Halo_t>::value &&
+                          is_slice<Slice0_t>::value &&
+                          is_slice<Slice1_t>::value ),
+                        void>::type
+gather( const Halo_t& halo, Slice0_t& slice_0, Slice1_t& slice_1,
+        SliceRest_t&... slice_rest )
+{
+    // Check that the slices are the right size.
+    Impl::checkFusedSliceSizes( halo.numLocal() + halo.numGhost(), slice_0,
+                                slice_1, slice_rest... );
+
+    Profiling::ScopedRegion region( "Cabana::gather" );
+
+    // Compute the byte offset of each slice within a fused buffer element.
+    std::vector<std::size_t> offsets;
+    std::size_t element_bytes = 0;
+    Impl::fusedSliceLayout( element_bytes, offsets, slice_0, slice_1,
+                            slice_rest... );
+
+    // Pad the element stride to the largest value type so every buffer row
+    // stays aligned for the reinterpreted stores.
+    const std::size_t max_value_bytes =
+        Impl::fusedMaxValueBytes( slice_0, slice_1, slice_rest... );
+    element_bytes = ( ( element_bytes + max_value_bytes - 1 ) /
+                      max_value_bytes ) *
+                    max_value_bytes;
+
+    Profiling::addCounter( "Cabana::gather::bytes_packed",
+                           halo.totalNumExport() * element_bytes );
+
+    // Get a fused send buffer with one row of bytes per exported element. If
+    // the halo has persistent buffers enabled this reuses the buffer from
+    // the previous call, growing it if needed.
+    auto send_buffer = halo.template getSendBuffer<char>(
+        halo.totalNumExport(), element_bytes );
+
+    // Get the steering vector for the sends.
+    auto steering = halo.getExportSteering();
+
+    // Pack all slices into the fused send buffer.
+    Impl::packFusedSendBuffer( halo, send_buffer, steering, offsets, 0,
+                               slice_0, slice_1, slice_rest... );
+    Kokkos::fence();
+
+    // Get a fused receive buffer.
+    auto recv_buffer = halo.template getReceiveBuffer<char>(
+        halo.totalNumImport(), element_bytes );
+
+    // Issue the exchange on the given send and receive buffers. A generic
+    // lambda so the same code runs on the device buffers or on host
+    // staging copies.
+    int num_n = halo.numNeighbor();
+    auto do_exchange = [&]( auto& mpi_send_buffer, auto& mpi_recv_buffer ) {
+        // Exchange with a neighbor collective over the halo's graph
+        // communicator if that backend is enabled.
+        if ( halo.neighborCollectivesEnabled() )
+        {
+            std::vector<int> send_counts( num_n ), send_displs( num_n ),
+                recv_counts( num_n ), recv_displs( num_n );
+            int send_offset = 0;
+            int recv_offset = 0;
+            for ( int n = 0; n < num_n; ++n )
+            {
+                send_counts[n] = halo.numExport( n ) * element_bytes;
+                recv_counts[n] = halo.numImport( n ) * element_bytes;
+                send_displs[n] = send_offset;
+                recv_displs[n] = recv_offset;
+                send_offset += send_counts[n];
+                recv_offset += recv_counts[n];
+            }
+            const int ec = MPI_Neighbor_alltoallv(
+                mpi_send_buffer.data(), send_counts.data(),
+                send_displs.data(), MPI_BYTE, mpi_recv_buffer.data(),
+                recv_counts.data(), recv_displs.data(), MPI_BYTE,
+                halo.graphComm() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+        }
+        else
+        {
+            // The halo has it's own communication space so choose any mpi
+            // tag.
+            const int mpi_tag = 2345;
+
+            // A neighbor that is this rank itself bypasses MPI entirely -
+            // its segment moves with a direct buffer-to-buffer peer copy.
+            const int self_n = Impl::selfNeighbor( halo );
+
+            // Post non-blocking receives.
+            std::vector<MPI_Request> requests( num_n, MPI_REQUEST_NULL );
+            std::pair<std::size_t, std::size_t> self_recv_range = { 0, 0 };
+            std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+            for ( int n = 0; n < num_n; ++n )
+            {
+                recv_range.second = recv_range.first + halo.numImport( n );
+
+                if ( n == self_n )
+                {
+                    self_recv_range = recv_range;
+                }
+                else
+                {
+                    auto recv_subview = Kokkos::subview(
+                        mpi_recv_buffer, recv_range, Kokkos::ALL );
+
+                    MPI_Irecv( recv_subview.data(), recv_subview.size(),
+                               MPI_BYTE, halo.neighborRank( n ), mpi_tag,
+                               halo.comm(), &( requests[n] ) );
+                }
+
+                recv_range.first = recv_range.second;
+            }
+
+            // Do blocking sends. The self segment is peer copied straight
+            // into the receive buffer - no message, no matching.
+            std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+            for ( int n = 0; n < num_n; ++n )
+            {
+                send_range.second = send_range.first + halo.numExport( n );
+
+                if ( n == self_n )
+                {
+                    Kokkos::deep_copy(
+                        Kokkos::subview( mpi_recv_buffer, self_recv_range,
+                                         Kokkos::ALL ),
+                        Kokkos::subview( mpi_send_buffer, send_range,
+                                         Kokkos::ALL ) );
+                }
+                else
+                {
+                    auto send_subview = Kokkos::subview(
+                        mpi_send_buffer, send_range, Kokkos::ALL );
+
+                    MPI_Send( send_subview.data(), send_subview.size(),
+                              MPI_BYTE, halo.neighborRank( n ), mpi_tag,
+                              halo.comm() );
+                }
+
+                send_range.first = send_range.second;
+            }
+
+            // Wait on non-blocking receives.
+            std::vector<MPI_Status> status( num_n );
+            const int ec =
+                MPI_Waitall( requests.size(), requests.data(), status.data() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+        }
+    };
+
+    // Pass the device buffers directly to MPI or stage them through host
+    // memory if the MPI library cannot access device allocations.
+    if ( halo.deviceDirectEnabled() )
+        do_exchange( send_buffer, recv_buffer );
+    else
+    {
+        PinnedMirror<decltype( send_buffer )> send_stage( halo.pinnedPool(),
+                                                          send_buffer );
+        PinnedMirror<decltype( recv_buffer )> recv_stage( halo.pinnedPool(),
+                                                          recv_buffer );
+        Kokkos::deep_copy( send_stage.view, send_buffer );
+        do_exchange( send_stage.view, recv_stage.view );
+        Kokkos::deep_copy( recv_buffer, recv_stage.view );
+    }
+
+    // Unpack all slices from the fused receive buffer into the ghosted
+    // elements.
+    Impl::unpackFusedRecvBuffer( halo, recv_buffer, offsets, 0, slice_0,
+                                 slice_1, slice_rest... );
+    Kokkos::fence();
+
+    // Barrier before completing to ensure synchronization.
+    MPI_Barrier( halo.comm() );
+}
+
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+
+// Expand a tuple of slices into a gather call.
+template <class Halo_t, class SliceTuple_t, std::size_t... Is>
+void gatherSliceTuple( const Halo_t& halo, SliceTuple_t& slices,
+                       std::index_sequence<Is...> )
+{
+    gather( halo, std::get<Is>( slices )... );
+}
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously gather a compile-time subset of the members of an
+  AoSoA using the halo forward communication plan. This is a uniquely-owned
+  to multiply-owned communication.
+
+  Ghosted particles often only need a few of the members of the particle
+  data structure (e.g. positions and charges but not forces). Gathering the
+  whole AoSoA moves every member over the wire. This version packs only the
+  members selected by the index list into a single fused message exchange,
+  so the communicated bytes cover exactly the requested members.
+
+  \tparam M The indices of the members to gather.
+
+  \tparam Halo_t Halo type - must be a Halo.
+
+  \tparam AoSoA_t AoSoA type - must be an AoSoA.
+
+  \param halo The halo to use for the gather.
+
+  \param aosoa The AoSoA on which to perform the gather. The AoSoA should
+  have a size equivalent to halo.numGhost() + halo.numLocal(). The locally
+  owned elements are expected to appear first (i.e. in the first
+  halo.numLocal() elements) and the ghosted elements are expected to appear
+  second (i.e. in the next halo.numGhost() elements()).
+*/
+template <std::size_t... M, class Halo_t, class AoSoA_t>
+typename std::enable_if<( is_halo<Halo_t>::value &&
+                          is_aosoa<AoSoA_t>::value ),
+                        void>::type
+gather( const Halo_t& halo, AoSoA_t& aosoa, MemberIndexList<M...> )
+{
+    static_assert( sizeof...( M ) > 0,
+                   "Member index list must not be empty" );
+
+    // Gather the selected member slices with a single fused exchange.
+    auto slices = std::make_tuple( slice<M>( aosoa )... );
+    Impl::gatherSliceTuple( halo, slices,
+                            std::make_index_sequence<sizeof...( M )>{} );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Request object for an asynchronous gather.
+
+  \tparam Halo_t Halo type - must be a Halo.
+
+  \tparam Container_t Container type - must be an AoSoA or a Slice.
+
+  Created by gather_async(). On creation the local data is packed and all
+  MPI communication is issued with non-blocking sends and receives. The
+  caller can then do local work that does not touch the ghosted elements
+  while the messages are in flight and call wait() to complete the
+  communication and unpack the ghosts. The request owns its communication
+  buffers so multiple gathers may be in flight at once.
+*/
+template <class Halo_t, class Container_t, class SFINAE = void>
+class GatherRequest;
+
+//---------------------------------------------------------------------------//
+//! GatherRequest AoSoA specialization.
+template <class Halo_t, class AoSoA_t>
+class GatherRequest<Halo_t, AoSoA_t,
+                    typename std::enable_if<is_aosoa<AoSoA_t>::value>::type>
+{
+  public:
+    /*!
+      \brief Constructor. Packs the local data and issues the non-blocking
+      communication. Prefer gather_async() to calling this directly.
+    */
+    GatherRequest( const Halo_t& halo, AoSoA_t& aosoa )
+        : _halo( halo )
+        , _aosoa( aosoa )
+        , _completed( false )
+    {
+        // Check that the AoSoA is the right size.
+        if ( aosoa.size() != halo.numLocal() + halo.numGhost() )
+            throw std::runtime_error( "AoSoA is the wrong size for gather!" );
+
+        Profiling::ScopedRegion region( "Cabana::gather_async::start" );
+        Profiling::addCounter( "Cabana::gather::bytes_packed",
+                               halo.totalNumExport() *
+                                   sizeof( typename AoSoA_t::tuple_type ) );
+
+        // Allocate the buffers. The request owns these so gathers may
+        // overlap with other communication on the same halo.
+        _send_buffer = buffer_type(
+            Kokkos::ViewAllocateWithoutInitializing( "halo_send_buffer" ),
+            halo.totalNumExport() );
+        _recv_buffer = buffer_type(
+            Kokkos::ViewAllocateWithoutInitializing( "halo_recv_buffer" ),
+            halo.totalNumImport() );
+
+        // Get the steering vector for the sends.
+        auto steering = halo.getExportSteering();
+
+        // Gather from the local data into a tuple-contiguous send buffer.
+        // Note we create local shallow copies for the lambda - this is a
+        // CUDA workaround for handling class private data.
+        auto send_buffer = _send_buffer;
+        auto gather_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            send_buffer( i ) = aosoa.getTuple( steering( i ) );
+        };
+        Kokkos::RangePolicy<typename Halo_t::execution_space>
+            gather_send_buffer_policy( 0, halo.totalNumExport() );
+        Kokkos::parallel_for( "Cabana::gather_async::gather_send_buffer",
+                              gather_send_buffer_policy,
+                              gather_send_buffer_func );
+        Kokkos::fence();
+
+        // Arm the progression thread (if enabled on the halo) for the
+        // lifetime of this request so the messages below make progress
+        // while the application computes.
+        _progress = halo.progressGuard();
+
+        // The halo has it's own communication space so choose any mpi tag.
+        const int mpi_tag = 2345;
+
+        // Post non-blocking receives.
+        int num_n = halo.numNeighbor();
+        _requests.resize( num_n );
+        std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+        for ( int n = 0; n < num_n; ++n )
+        {
+            recv_range.second = recv_range.first + halo.numImport( n );
+
+            auto recv_subview = Kokkos::subview( _recv_buffer, recv_range );
+
+            MPI_Irecv( recv_subview.data(),
+                       recv_subview.size() *
+                           sizeof( typename AoSoA_t::tuple_type ),
+                       MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm(),
+                       &( _requests[n] ) );
+
+            recv_range.first = recv_range.second;
+        }
+
+        // Post non-blocking sends.
+        std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+        for ( int n = 0; n < num_n; ++n )
+        {
+            send_range.second = send_range.first + halo.numExport( n );
+
+            auto send_subview = Kokkos::subview( _send_buffer, send_range );
+
+            _requests.push_back( MPI_Request() );
+
+            MPI_Isend( send_subview.data(),
+                       send_subview.size() *
+                           sizeof( typename AoSoA_t::tuple_type ),
+                       MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm(),
+                       &( _requests.back() ) );
+
+            send_range.first = send_range.second;
+        }
+    }
+
+    //! Move constructor. The moved-from request is marked complete.
+    GatherRequest( GatherRequest&& other )
+        : _halo( other._halo )
+        , _aosoa( other._aosoa )
+        , _send_buffer( other._send_buffer )
+        , _recv_buffer( other._recv_buffer )
+        , _requests( std::move( other._requests ) )
+        , _progress( std::move( other._progress ) )
+        , _completed( other._completed )
+    {
+        other._completed = true;
+    }
+
+    //! Requests are not copyable - the MPI requests have a single owner.
+    GatherRequest( const GatherRequest& ) = delete;
+    //! Requests are not assignable.
+    GatherRequest& operator=( const GatherRequest& ) = delete;
+    //! Requests are not move assignable.
+    GatherRequest& operator=( GatherRequest&& ) = delete;
+
+    //! Destructor. Waits on any outstanding communication without
+    //! unpacking.
+    ~GatherRequest()
+    {
+        if ( !_completed )
+            MPI_Waitall( _requests.size(), _requests.data(),
+                         MPI_STATUSES_IGNORE );
+    }
+
+    /*!
+      \brief Complete the gather. Waits on the communication and unpacks the
+      received data into the ghosted elements. Calling wait() again is a
+      no-op.
+    */
+    void wait()
+    {
+        if ( _completed )
+            return;
+
+        Profiling::ScopedRegion region( "Cabana::gather_async::wait" );
+
+        // Wait on the non-blocking sends and receives.
+        std::vector<MPI_Status> status( _requests.size() );
+        const int ec =
+            MPI_Waitall( _requests.size(), _requests.data(), status.data() );
+        if ( MPI_SUCCESS != ec )
+            throw std::logic_error( "Failed MPI Communication" );
+
+        // Communication is done - disarm the progression thread.
+        _progress.reset();
+
+        // Extract the receive buffer into the ghosted elements.
+        auto aosoa = _aosoa;
+        auto recv_buffer = _recv_buffer;
+        std::size_t num_local = _halo.numLocal();
+        auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            std::size_t ghost_idx = i + num_local;
+            aosoa.setTuple( ghost_idx, recv_buffer( i ) );
+        };
+        Kokkos::RangePolicy<typename Halo_t::execution_space>
+            extract_recv_buffer_policy( 0, _halo.totalNumImport() );
+        Kokkos::parallel_for( "Cabana::gather_async::extract_recv_buffer",
+                              extract_recv_buffer_policy,
+                              extract_recv_buffer_func );
+        Kokkos::fence();
+
+        _completed = true;
+    }
+
+  private:
+    using buffer_type = Kokkos::View<typename AoSoA_t::tuple_type*,
+                                     typename Halo_t::memory_space>;
+
+    Halo_t _halo;
+    AoSoA_t _aosoa;
+    buffer_type _send_buffer;
+    buffer_type _recv_buffer;
+    std::vector<MPI_Request> _requests;
+    std::shared_ptr<void> _progress;
+    bool _completed;
+};
+
+//---------------------------------------------------------------------------//
+//! GatherRequest Slice specialization.
+template <class Halo_t, class Slice_t>
+class GatherRequest<Halo_t, Slice_t,
+                    typename std::enable_if<is_slice<Slice_t>::value>::type>
+{
+  public:
+    /*!
+      \brief Constructor. Packs the local data and issues the non-blocking
+      communication. Prefer gather_async() to calling this directly.
+    */
+    GatherRequest( const Halo_t& halo, Slice_t& slice )
+        : _halo( halo )
+        , _slice( slice )
+        , _completed( false )
+    {
+        // Check that the Slice is the right size.
+        if ( slice.size() != halo.numLocal() + halo.numGhost() )
+            throw std::runtime_error( "Slice is the wrong size for gather!" );
+
+        Profiling::ScopedRegion region( "Cabana::gather_async::start" );
+
+        // Get the number of components in the slice.
+        _num_comp = 1;
+        for ( std::size_t d = 2; d < slice.rank(); ++d )
+            _num_comp *= slice.extent( d );
+
+        Profiling::addCounter( "Cabana::gather::bytes_packed",
+                               halo.totalNumExport() * _num_comp *
+                                   sizeof( typename Slice_t::value_type ) );
+
+        // Allocate the buffers. Note these are layout right so the
+        // components are consecutive. The request owns these so gathers may
+        // overlap with other communication on the same halo.
+        _send_buffer = buffer_type(
+            Kokkos::ViewAllocateWithoutInitializing( "halo_send_buffer" ),
+            halo.totalNumExport(), _num_comp );
+        _recv_buffer = buffer_type(
+            Kokkos::ViewAllocateWithoutInitializing( "halo_recv_buffer" ),
+            halo.totalNumImport(), _num_comp );
+
+        // Get the raw slice data.
+        auto slice_data = slice.data();
+
+        // Get the steering vector for the sends.
+        auto steering = halo.getExportSteering();
+
+        // Gather from the local data into the send buffer. Note we create
+        // local shallow copies for the lambda - this is a CUDA workaround
+        // for handling class private data.
+        auto send_buffer = _send_buffer;
+        auto num_comp = _num_comp;
+        auto gather_send_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            auto s = Slice_t::index_type::s( steering( i ) );
+            auto a = Slice_t::index_type::a( steering( i ) );
+            std::size_t slice_offset = s * slice.stride( 0 ) + a;
+            for ( std::size_t n = 0; n < num_comp; ++n )
+                send_buffer( i, n ) =
+                    slice_data[slice_offset + n * Slice_t::vector_length];
+        };
+        Kokkos::RangePolicy<typename Halo_t::execution_space>
+            gather_send_buffer_policy( 0, halo.totalNumExport() );
+        Kokkos::parallel_for( "Cabana::gather_async::gather_send_buffer",
+                              gather_send_buffer_policy,
+                              gather_send_buffer_func );
+        Kokkos::fence();
+
+        // Arm the progression thread (if enabled on the halo) for the
+        // lifetime of this request so the messages below make progress
+        // while the application computes.
+        _progress = halo.progressGuard();
+
+        // The halo has it's own communication space so choose any mpi tag.
+        const int mpi_tag = 2345;
+
+        // Post non-blocking receives.
+        int num_n = halo.numNeighbor();
+        _requests.resize( num_n );
+        std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+        for ( int n = 0; n < num_n; ++n )
+        {
+            recv_range.second = recv_range.first + halo.numImport( n );
+
+            auto recv_subview =
+                Kokkos::subview( _recv_buffer, recv_range, Kokkos::ALL );
+
+            MPI_Irecv( recv_subview.data(),
+                       recv_subview.size() *
+                           sizeof( typename Slice_t::value_type ),
+                       MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm(),
+                       &( _requests[n] ) );
+
+            recv_range.first = recv_range.second;
+        }
+
+        // Post non-blocking sends.
+        std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+        for ( int n = 0; n < num_n; ++n )
+        {
+            send_range.second = send_range.first + halo.numExport( n );
+
+            auto send_subview =
+                Kokkos::subview( _send_buffer, send_range, Kokkos::ALL );
+
+            _requests.push_back( MPI_Request() );
+
+            MPI_Isend( send_subview.data(),
+                       send_subview.size() *
+                           sizeof( typename Slice_t::value_type ),
+                       MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm(),
+                       &( _requests.back() ) );
+
+            send_range.first = send_range.second;
+        }
+    }
+
+    //! Move constructor. The moved-from request is marked complete.
+    GatherRequest( GatherRequest&& other )
+        : _halo( other._halo )
+        , _slice( other._slice )
+        , _num_comp( other._num_comp )
+        , _send_buffer( other._send_buffer )
+        , _recv_buffer( other._recv_buffer )
+        , _requests( std::move( other._requests ) )
+        , _progress( std::move( other._progress ) )
+        , _completed( other._completed )
+    {
+        other._completed = true;
+    }
+
+    //! Requests are not copyable - the MPI requests have a single owner.
+    GatherRequest( const GatherRequest& ) = delete;
+    //! Requests are not assignable.
+    GatherRequest& operator=( const GatherRequest& ) = delete;
+    //! Requests are not move assignable.
+    GatherRequest& operator=( GatherRequest&& ) = delete;
+
+    //! Destructor. Waits on any outstanding communication without
+    //! unpacking.
+    ~GatherRequest()
+    {
+        if ( !_completed )
+            MPI_Waitall( _requests.size(), _requests.data(),
+                         MPI_STATUSES_IGNORE );
+    }
+
+    /*!
+      \brief Complete the gather. Waits on the communication and unpacks the
+      received data into the ghosted elements. Calling wait() again is a
+      no-op.
+    */
+    void wait()
+    {
+        if ( _completed )
+            return;
+
+        Profiling::ScopedRegion region( "Cabana::gather_async::wait" );
+
+        // Wait on the non-blocking sends and receives.
+        std::vector<MPI_Status> status( _requests.size() );
+        const int ec =
+            MPI_Waitall( _requests.size(), _requests.data(), status.data() );
+        if ( MPI_SUCCESS != ec )
+            throw std::logic_error( "Failed MPI Communication" );
+
+        // Communication is done - disarm the progression thread.
+        _progress.reset();
+
+        // Extract the receive buffer into the ghosted elements.
+        auto slice = _slice;
+        auto slice_data = slice.data();
+        auto recv_buffer = _recv_buffer;
+        auto num_comp = _num_comp;
+        std::size_t num_local = _halo.numLocal();
+        auto extract_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            std::size_t ghost_idx = i + num_local;
+            auto s = Slice_t::index_type::s( ghost_idx );
+            auto a = Slice_t::index_type::a( ghost_idx );
+            std::size_t slice_offset = s * slice.stride( 0 ) + a;
+            for ( std::size_t n = 0; n < num_comp; ++n )
+                slice_data[slice_offset + Slice_t::vector_length * n] =
+                    recv_buffer( i, n );
+        };
+        Kokkos::RangePolicy<typename Halo_t::execution_space>
+            extract_recv_buffer_policy( 0, _halo.totalNumImport() );
+        Kokkos::parallel_for( "Cabana::gather_async::extract_recv_buffer",
+                              extract_recv_buffer_policy,
+                              extract_recv_buffer_func );
+        Kokkos::fence();
+
+        _completed = true;
+    }
+
+  private:
+    using buffer_type =
+        Kokkos::View<typename Slice_t::value_type**, Kokkos::LayoutRight,
+                     typename Halo_t::memory_space>;
+
+    Halo_t _halo;
+    Slice_t _slice;
+    std::size_t _num_comp;
+    buffer_type _send_buffer;
+    buffer_type _recv_buffer;
+    std::vector<MPI_Request> _requests;
+    std::shared_ptr<void> _progress;
+    bool _completed;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Asynchronously gather data from the local decomposition to the
+  ghosts using the halo forward communication plan.
+
+  Packs the local data and issues all MPI communication with non-blocking
+  sends and receives, then returns immediately. The caller can overlap
+  local work that does not touch the ghosted elements with the
+  communication and must call wait() on the returned request to complete
+  the gather and unpack the ghosts.
+
+  \tparam Halo_t Halo type - must be a Halo.
+
+  \tparam Container_t Container type - must be an AoSoA or a Slice.
+
+  \param halo The halo to use for the gather.
+
+  \param container The AoSoA or Slice on which to perform the gather. The
+  container should have a size equivalent to halo.numGhost() +
+  halo.numLocal() with the locally owned elements first.
+
+  \return A request object. Call wait() on it to complete the gather.
+*/
+template <class Halo_t, class Container_t>
+GatherRequest<Halo_t, Container_t>
+gather_async( const Halo_t& halo, Container_t& container,
+              typename std::enable_if<( is_halo<Halo_t>::value &&
+                                        ( is_aosoa<Container_t>::value ||
+                                          is_slice<Container_t>::value ) ),
+                                      int>::type* = 0 )
+{
+    return GatherRequest<Halo_t, Container_t>( halo, container );
+}
+
+//---------------------------------------------------------------------------//
+//! Reduction operators for combining ghost contributions in a scatter.
+namespace ScatterReduce
+{
+//! Sum the ghost contributions into the local value with atomics.
+struct Sum
+{
+};
+
+//! Sum the ghost contributions into the local value deterministically by
+//! binning them by target element and reducing each bin in a fixed order.
+struct DeterministicSum
+{
+};
+
+//! Keep the minimum of the local value and the ghost contributions.
+struct Min
+{
+};
+
+//! Keep the maximum of the local value and the ghost contributions.
+struct Max
+{
+};
+
+} // end namespace ScatterReduce
+
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+//---------------------------------------------------------------------------//
+// Combine a single ghost contribution with a local value. Atomics are
+// required because a local element may receive contributions from many
+// ghosts in the same kernel.
+template <class T>
+KOKKOS_INLINE_FUNCTION void scatterReduceApply( ScatterReduce::Sum, T* local,
+                                                const T value )
+{
+    Kokkos::atomic_add( local, value );
+}
+
+template <class T>
+KOKKOS_INLINE_FUNCTION void scatterReduceApply( ScatterReduce::Min, T* local,
+                                                const T value )
+{
+    Kokkos::atomic_fetch_min( local, value );
+}
+
+template <class T>
+KOKKOS_INLINE_FUNCTION void scatterReduceApply( ScatterReduce::Max, T* local,
+                                                const T value )
+{
+    Kokkos::atomic_fetch_max( local, value );
+}
+
+//---------------------------------------------------------------------------//
+// Combine the receive buffer into the local values one contribution at a
+// time with the given atomic reduction operator.
+template <class ReduceOp, class Halo_t, class Slice_t, class Buffer_t,
+          class Steering_t>
+void scatterRecvBuffer( ReduceOp, const Halo_t& halo, Slice_t& slice,
+                        const Buffer_t& recv_buffer,
+                        const Steering_t& steering,
+                        const std::size_t num_comp )
+{
+    // Get the raw slice data. Wrap in a 1D Kokkos View so we can unroll the
+    // components of each slice element.
+    Kokkos::View<typename Slice_t::value_type*, typename Slice_t::memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+        slice_data( slice.data(), slice.numSoA() * slice.stride( 0 ) );
+
+    auto scatter_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto s = Slice_t::index_type::s( steering( i ) );
+        auto a = Slice_t::index_type::a( steering( i ) );
+        std::size_t slice_offset = s * slice.stride( 0 ) + a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            scatterReduceApply(
+                ReduceOp(),
+                &slice_data( slice_offset + Slice_t::vector_length * n ),
+                recv_buffer( i, n ) );
+    };
+    Kokkos::RangePolicy<typename Halo_t::execution_space>
+        scatter_recv_buffer_policy( 0, halo.totalNumExport() );
+    Kokkos::parallel_for( "Cabana::scatter::scatter_recv_buffer",
+                          scatter_recv_buffer_policy,
+                          scatter_recv_buffer_func );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+// Combine the receive buffer into the local values deterministically. The
+// buffer positions are binned by their target element with a stable sort so
+// each element is reduced by a single thread in an order that depends only
+// on the communication plan, trading a small sort for reproducible sums and
+// no atomic contention.
+template <class Halo_t, class Slice_t, class Buffer_t, class Steering_t>
+void scatterRecvBuffer( ScatterReduce::DeterministicSum, const Halo_t& halo,
+                        Slice_t& slice, const Buffer_t& recv_buffer,
+                        const Steering_t& steering,
+                        const std::size_t num_comp )
+{
+    using memory_space = typename Halo_t::memory_space;
+
+    // Get the raw slice data. Wrap in a 1D Kokkos View so we can unroll the
+    // components of each slice element.
+    Kokkos::View<typename Slice_t::value_type*, typename Slice_t::memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+        slice_data( slice.data(), slice.numSoA() * slice.stride( 0 ) );
+
+    // Stable-sort the buffer positions by target element on the host. The
+    // steering vector is fixed for the life of the plan so the resulting
+    // reduction order is reproducible from call to call and run to run.
+    const std::size_t num_recv = halo.totalNumExport();
+    auto steering_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), steering );
+    Kokkos::View<std::size_t*, Kokkos::HostSpace> order_host(
+        Kokkos::ViewAllocateWithoutInitializing( "scatter_bin_order" ),
+        num_recv );
+    std::iota( order_host.data(), order_host.data() + num_recv, 0 );
+    std::stable_sort( order_host.data(), order_host.data() + num_recv,
+                      [&]( const std::size_t a, const std::size_t b ) {
+                          return steering_host( a ) < steering_host( b );
+                      } );
+
+    // Mark the start of each bin of equal target elements.
+    std::vector<std::size_t> bin_start_host;
+    for ( std::size_t i = 0; i < num_recv; ++i )
+        if ( 0 == i || steering_host( order_host( i ) ) !=
+                           steering_host( order_host( i - 1 ) ) )
+            bin_start_host.push_back( i );
+    const std::size_t num_bin = bin_start_host.size();
+    bin_start_host.push_back( num_recv );
+    Kokkos::View<const std::size_t*, Kokkos::HostSpace,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+        bin_start_wrapper( bin_start_host.data(), num_bin + 1 );
+
+    // Move the bin structure to the device.
+    auto order = Kokkos::create_mirror_view_and_copy( memory_space(),
+                                                      order_host );
+    auto bin_start = Kokkos::create_mirror_view_and_copy( memory_space(),
+                                                          bin_start_wrapper );
+
+    // Reduce each bin with a single thread. No atomics are needed because
+    // each thread owns all contributions to its target element.
+    auto scatter_bin_func = KOKKOS_LAMBDA( const std::size_t b )
+    {
+        auto steer = steering( order( bin_start( b ) ) );
+        auto s = Slice_t::index_type::s( steer );
+        auto a = Slice_t::index_type::a( steer );
+        std::size_t slice_offset = s * slice.stride( 0 ) + a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+        {
+            typename Slice_t::value_type sum = 0;
+            for ( std::size_t i = bin_start( b ); i < bin_start( b + 1 );
+                  ++i )
+                sum += recv_buffer( order( i ), n );
+            slice_data( slice_offset + Slice_t::vector_length * n ) += sum;
+        }
+    };
+    Kokkos::RangePolicy<typename Halo_t::execution_space> scatter_bin_policy(
+        0, num_bin );
+    Kokkos::parallel_for( "Cabana::scatter::scatter_recv_buffer_binned",
+                          scatter_bin_policy, scatter_bin_func );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously scatter data from the ghosts to the local decomposition
+  of a slice using the halo reverse communication plan with the given
+  reduction operator. This is a multiply-owned to uniquely owned
+  communication.
+
+  In a scatter operation results from ghosted values on other processors are
+  scattered back to the owning processor of the ghost and the value associated
+  with the ghost is combined into the locally owned value the ghost
+  represents. If a locally owned element is ghosted on multiple ranks, then
+  multiple contributions will be made, one for each rank.
+
+  \tparam Halo_t Halo type - must be a Halo.
+
+  \tparam Slice_t Slice type - must be a Slice.
+
+  \tparam ReduceOp Reduction operator type - must be a ScatterReduce tag.
+
+  \param halo The halo to use for the scatter.
+
+  \param slice The Slice on which to perform the scatter. The Slice should have
+  a size equivalent to halo.numGhost() + halo.numLocal(). The locally owned
+  elements are expected to appear first (i.e. in the first halo.numLocal()
+  elements) and the ghosted elements are expected to appear second (i.e. in
+  the next halo.numGhost() elements()).
+
+  \param reduce_op The operator used to combine ghost contributions with the
+  local value. ScatterReduce::Sum combines with atomics and is the default.
+  ScatterReduce::DeterministicSum produces run-to-run reproducible sums by
+  reducing the contributions to each element in a fixed order.
+  ScatterReduce::Min and ScatterReduce::Max keep the extremum of the local
+  value and the contributions.
+*/
+template <class Halo_t, class Slice_t, class ReduceOp>
+void scatter( const Halo_t& halo, Slice_t& slice, ReduceOp reduce_op,
+              typename std::enable_if<( is_halo<Halo_t>::value &&
+                                        is_slice<Slice_t>::value ),
+                                      int>::type* = 0 )
 {
     // Check that the Slice is the right size.
     if ( slice.size() != halo.numLocal() + halo.numGhost() )
         throw std::runtime_error( "Slice is the wrong size for scatter!" );
 
+    Profiling::ScopedRegion region( "Cabana::scatter" );
+
     // Get the number of components in the slice.
     std::size_t num_comp = 1;
     for ( std::size_t d = 2; d < slice.rank(); ++d )
         num_comp *= slice.extent( d );
 
+    Profiling::addCounter( "Cabana::scatter::bytes_packed",
+                           halo.totalNumImport() * num_comp *
+                               sizeof( typename Slice_t::value_type ) );
+
     // Get the raw slice data. Wrap in a 1D Kokkos View so we can unroll the
     // components of each slice element.
     Kokkos::View<typename Slice_t::value_type*, typename Slice_t::memory_space,
                  Kokkos::MemoryTraits<Kokkos::Unmanaged>>
         slice_data( slice.data(), slice.numSoA() * slice.stride( 0 ) );
 
-    // Allocate a send buffer. Note this one is layout right so the components
-    // are consecutive.
-    Kokkos::View<typename Slice_t::value_type**, Kokkos::LayoutRight,
-                 typename Halo_t::memory_space>
-        send_buffer(
-            Kokkos::ViewAllocateWithoutInitializing( "halo_send_buffer" ),
+    // Get a send buffer. Note this one is layout right so the components are
+    // consecutive. If the halo has persistent buffers enabled this reuses
+    // the buffer from the previous call, growing it if needed.
+    auto send_buffer =
+        halo.template getSendBuffer<typename Slice_t::value_type>(
             halo.totalNumImport(), num_comp );
 
     // Extract the send buffer from the ghosted elements.
@@ -540,84 +2475,181 @@ void scatter( const Halo_t& halo, Slice_t& slice,
                           extract_send_buffer_func );
     Kokkos::fence();
 
-    // Allocate a receive buffer. Note this one is layout right so the
-    // components are consecutive.
-    Kokkos::View<typename Slice_t::value_type**, Kokkos::LayoutRight,
-                 typename Halo_t::memory_space>
-        recv_buffer(
-            Kokkos::ViewAllocateWithoutInitializing( "halo_recv_buffer" ),
+    // Get a receive buffer. Note this one is layout right so the components
+    // are consecutive.
+    auto recv_buffer =
+        halo.template getReceiveBuffer<typename Slice_t::value_type>(
             halo.totalNumExport(), num_comp );
 
-    // The halo has it's own communication space so choose any mpi tag.
-    const int mpi_tag = 2345;
-
-    // Post non-blocking receives.
+    // Issue the exchange on the given send and receive buffers. A generic
+    // lambda so the same code runs on the device buffers or on host
+    // staging copies. The scatter is the reverse communication plan so the
+    // send counts are the imports and the receive counts are the exports.
     int num_n = halo.numNeighbor();
-    std::vector<MPI_Request> requests( num_n );
-    std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
-    {
-        recv_range.second = recv_range.first + halo.numExport( n );
-
-        auto recv_subview =
-            Kokkos::subview( recv_buffer, recv_range, Kokkos::ALL );
-
-        MPI_Irecv( recv_subview.data(),
-                   recv_subview.size() * sizeof( typename Slice_t::value_type ),
-                   MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm(),
-                   &( requests[n] ) );
-
-        recv_range.first = recv_range.second;
-    }
+    auto do_exchange = [&]( auto& mpi_send_buffer, auto& mpi_recv_buffer ) {
+        // Exchange with a neighbor collective over the halo's graph
+        // communicator if that backend is enabled.
+        if ( halo.neighborCollectivesEnabled() )
+        {
+            const int element_bytes =
+                num_comp * sizeof( typename Slice_t::value_type );
+            std::vector<int> send_counts( num_n ), send_displs( num_n ),
+                recv_counts( num_n ), recv_displs( num_n );
+            int send_offset = 0;
+            int recv_offset = 0;
+            for ( int n = 0; n < num_n; ++n )
+            {
+                send_counts[n] = halo.numImport( n ) * element_bytes;
+                recv_counts[n] = halo.numExport( n ) * element_bytes;
+                send_displs[n] = send_offset;
+                recv_displs[n] = recv_offset;
+                send_offset += send_counts[n];
+                recv_offset += recv_counts[n];
+            }
+            const int ec = MPI_Neighbor_alltoallv(
+                mpi_send_buffer.data(), send_counts.data(),
+                send_displs.data(), MPI_BYTE, mpi_recv_buffer.data(),
+                recv_counts.data(), recv_displs.data(), MPI_BYTE,
+                halo.graphComm() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+        }
+        else
+        {
+            // The halo has it's own communication space so choose any mpi
+            // tag.
+            const int mpi_tag = 2345;
+
+            // A neighbor that is this rank itself bypasses MPI entirely -
+            // its segment moves with a direct buffer-to-buffer peer copy.
+            const int self_n = Impl::selfNeighbor( halo );
+
+            // Post non-blocking receives.
+            std::vector<MPI_Request> requests( num_n, MPI_REQUEST_NULL );
+            std::pair<std::size_t, std::size_t> self_recv_range = { 0, 0 };
+            std::pair<std::size_t, std::size_t> recv_range = { 0, 0 };
+            for ( int n = 0; n < num_n; ++n )
+            {
+                recv_range.second = recv_range.first + halo.numExport( n );
+
+                if ( n == self_n )
+                {
+                    self_recv_range = recv_range;
+                }
+                else
+                {
+                    auto recv_subview = Kokkos::subview(
+                        mpi_recv_buffer, recv_range, Kokkos::ALL );
+
+                    MPI_Irecv( recv_subview.data(),
+                               recv_subview.size() *
+                                   sizeof( typename Slice_t::value_type ),
+                               MPI_BYTE, halo.neighborRank( n ), mpi_tag,
+                               halo.comm(), &( requests[n] ) );
+                }
+
+                recv_range.first = recv_range.second;
+            }
+
+            // Do blocking sends. The self segment is peer copied straight
+            // into the receive buffer - no message, no matching.
+            std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
+            for ( int n = 0; n < num_n; ++n )
+            {
+                send_range.second = send_range.first + halo.numImport( n );
+
+                if ( n == self_n )
+                {
+                    Kokkos::deep_copy(
+                        Kokkos::subview( mpi_recv_buffer, self_recv_range,
+                                         Kokkos::ALL ),
+                        Kokkos::subview( mpi_send_buffer, send_range,
+                                         Kokkos::ALL ) );
+                }
+                else
+                {
+                    auto send_subview = Kokkos::subview(
+                        mpi_send_buffer, send_range, Kokkos::ALL );
+
+                    MPI_Send( send_subview.data(),
+                              send_subview.size() *
+                                  sizeof( typename Slice_t::value_type ),
+                              MPI_BYTE, halo.neighborRank( n ), mpi_tag,
+                              halo.comm() );
+                }
+
+                send_range.first = send_range.second;
+            }
+
+            // Wait on non-blocking receives.
+            std::vector<MPI_Status> status( num_n );
+            const int ec =
+                MPI_Waitall( requests.size(), requests.data(), status.data() );
+            if ( MPI_SUCCESS != ec )
+                throw std::logic_error( "Failed MPI Communication" );
+        }
+    };
 
-    // Do blocking sends.
-    std::pair<std::size_t, std::size_t> send_range = { 0, 0 };
-    for ( int n = 0; n < num_n; ++n )
+    // Pass the device buffers directly to MPI or stage them through host
+    // memory if the MPI library cannot access device allocations.
+    if ( halo.deviceDirectEnabled() )
+        do_exchange( send_buffer, recv_buffer );
+    else
     {
-        send_range.second = send_range.first + halo.numImport( n );
-
-        auto send_subview =
-            Kokkos::subview( send_buffer, send_range, Kokkos::ALL );
-
-        MPI_Send( send_subview.data(),
-                  send_subview.size() * sizeof( typename Slice_t::value_type ),
-                  MPI_BYTE, halo.neighborRank( n ), mpi_tag, halo.comm() );
-
-        send_range.first = send_range.second;
+        PinnedMirror<decltype( send_buffer )> send_stage( halo.pinnedPool(),
+                                                          send_buffer );
+        PinnedMirror<decltype( recv_buffer )> recv_stage( halo.pinnedPool(),
+                                                          recv_buffer );
+        Kokkos::deep_copy( send_stage.view, send_buffer );
+        do_exchange( send_stage.view, recv_stage.view );
+        Kokkos::deep_copy( recv_buffer, recv_stage.view );
     }
 
-    // Wait on non-blocking receives.
-    std::vector<MPI_Status> status( num_n );
-    const int ec =
-        MPI_Waitall( requests.size(), requests.data(), status.data() );
-    if ( MPI_SUCCESS != ec )
-        throw std::logic_error( "Failed MPI Communication" );
-
     // Get the steering vector for the sends.
     auto steering = halo.getExportSteering();
 
-    // Scatter the ghosts in the receive buffer into the local values.
-    auto scatter_recv_buffer_func = KOKKOS_LAMBDA( const std::size_t i )
-    {
-        auto s = Slice_t::index_type::s( steering( i ) );
-        auto a = Slice_t::index_type::a( steering( i ) );
-        std::size_t slice_offset = s * slice.stride( 0 ) + a;
-        for ( std::size_t n = 0; n < num_comp; ++n )
-            Kokkos::atomic_add(
-                &slice_data( slice_offset + Slice_t::vector_length * n ),
-                recv_buffer( i, n ) );
-    };
-    Kokkos::RangePolicy<typename Halo_t::execution_space>
-        scatter_recv_buffer_policy( 0, halo.totalNumExport() );
-    Kokkos::parallel_for( "Cabana::scatter::scatter_recv_buffer",
-                          scatter_recv_buffer_policy,
-                          scatter_recv_buffer_func );
-    Kokkos::fence();
+    // Combine the ghosts in the receive buffer into the local values with
+    // the requested reduction operator.
+    Impl::scatterRecvBuffer( reduce_op, halo, slice, recv_buffer, steering,
+                             num_comp );
 
     // Barrier before completing to ensure synchronization.
     MPI_Barrier( halo.comm() );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Synchronously scatter data from the ghosts to the local decomposition
+  of a slice using the halo reverse communication plan. This is a
+  multiply-owned to uniquely owned communication.
+
+  In a scatter operation results from ghosted values on other processors are
+  scattered back to the owning processor of the ghost and the value associated
+  with the ghost is summed into the locally owned value the ghost
+  represents. If a locally owned element is ghosted on multiple ranks, then
+  multiple contributions will be made to the sum, one for each rank.
+
+  \tparam Halo_t Halo type - must be a Halo.
+
+  \tparam Slice_t Slice type - must be a Slice.
+
+  \param halo The halo to use for the scatter.
+
+  \param slice The Slice on which to perform the scatter. The Slice should have
+  a size equivalent to halo.numGhost() + halo.numLocal(). The locally owned
+  elements are expected to appear first (i.e. in the first halo.numLocal()
+  elements) and the ghosted elements are expected to appear second (i.e. in
+  the next halo.numGhost() elements()).
+*/
+template <class Halo_t, class Slice_t>
+void scatter( const Halo_t& halo, Slice_t& slice,
+              typename std::enable_if<( is_halo<Halo_t>::value &&
+                                        is_slice<Slice_t>::value ),
+                                      int>::type* = 0 )
+{
+    scatter( halo, slice, ScatterReduce::Sum() );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
@@ -0,0 +1,100 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Insert.hpp
+  \brief Bulk insertion of AoSoA particle data
+*/
+#ifndef CABANA_INSERT_HPP
+#define CABANA_INSERT_HPP
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdlib>
+#include <type_traits>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Append a batch of tuples to the end of an AoSoA on device.
+
+  \tparam DstAoSoA The AoSoA type to insert into.
+
+  \tparam SrcAoSoA The AoSoA type holding the tuples to insert. Must have
+  the same member types as the destination. The vector lengths may differ.
+
+  \param aosoa The AoSoA to insert into. Resized to hold the appended
+  tuples, so slices taken before this call must be re-taken if the
+  capacity is exceeded.
+
+  \param particles The tuples to append. Must be accessible from the
+  destination execution space.
+
+  \return The container size after the insertion.
+
+  The append is a single device kernel into the reserved capacity of the
+  container - no host-side staging or scattered writes. Injection bursts
+  (inflow boundaries, chemistry creating products) amortize the occasional
+  reallocation through the container growth factor; call reserve() ahead of
+  a known burst to avoid it entirely.
+
+  Appending deliberately does not disturb any existing binning or neighbor
+  structure: a LinkedCellList binning simply does not cover the appended
+  tail until its next build, which merges the inserted particles into the
+  bin order. Use VerletList::tolerateInsertions() to keep a neighbor list
+  usable over the grown range until its deferred rebuild.
+*/
+template <class DstAoSoA, class SrcAoSoA>
+std::size_t
+insert( DstAoSoA& aosoa, const SrcAoSoA& particles,
+        typename std::enable_if<( is_aosoa<DstAoSoA>::value &&
+                                  is_aosoa<SrcAoSoA>::value ),
+                                int>::type* = 0 )
+{
+    static_assert( std::is_same<typename DstAoSoA::member_types,
+                                typename SrcAoSoA::member_types>::value,
+                   "Inserted tuples must have the same member types" );
+
+    using execution_space = typename DstAoSoA::execution_space;
+    static_assert(
+        is_accessible_from<typename SrcAoSoA::memory_space,
+                           execution_space>{},
+        "Inserted data must be accessible from the destination space" );
+
+    // Grow the container. The growth factor amortizes the reallocation
+    // over repeated insertion bursts.
+    std::size_t old_size = aosoa.size();
+    std::size_t num_insert = particles.size();
+    aosoa.resize( old_size + num_insert );
+
+    // Append the tuples on device.
+    auto dst = aosoa;
+    auto src = particles;
+    Kokkos::parallel_for(
+        "Cabana::insert::append",
+        Kokkos::RangePolicy<execution_space>( 0, num_insert ),
+        KOKKOS_LAMBDA( const std::size_t i ) {
+            dst.setTuple( old_size + i, src.getTuple( i ) );
+        } );
+    Kokkos::fence();
+
+    return aosoa.size();
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_INSERT_HPP
@@ -0,0 +1,282 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_KernelGraph.hpp
+  \brief Capture and replay of fixed kernel sequences as device graphs
+*/
+#ifndef CABANA_KERNELGRAPH_HPP
+#define CABANA_KERNELGRAPH_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace Cabana
+{
+namespace Impl
+{
+//! \cond Impl
+//---------------------------------------------------------------------------//
+// Graph capture backend. The generic version has no device graph support -
+// replay falls back to re-enqueueing the recorded sequence, which still
+// amortizes any host-side setup the caller hoisted out of the sequence.
+template <class ExecutionSpace>
+class GraphCaptureBackend
+{
+  public:
+    GraphCaptureBackend() = default;
+
+    ExecutionSpace space() const { return _space; }
+
+    static constexpr bool deviceGraphs() { return false; }
+
+    void beginCapture() {}
+
+    void endCapture() {}
+
+    void launchGraph() {}
+
+  private:
+    ExecutionSpace _space;
+};
+
+//---------------------------------------------------------------------------//
+// CUDA backend. Kernels enqueued on the dedicated stream between begin and
+// end capture are recorded into a CUDA graph without executing; the
+// instantiated graph then replays the whole sequence with one launch.
+#ifdef KOKKOS_ENABLE_CUDA
+template <>
+class GraphCaptureBackend<Kokkos::Cuda>
+{
+  public:
+    GraphCaptureBackend()
+    {
+        checkCuda( cudaStreamCreate( &_stream ) );
+        _space = Kokkos::Cuda( _stream );
+    }
+
+    ~GraphCaptureBackend()
+    {
+        destroyGraph();
+        cudaStreamDestroy( _stream );
+    }
+
+    GraphCaptureBackend( const GraphCaptureBackend& ) = delete;
+    GraphCaptureBackend& operator=( const GraphCaptureBackend& ) = delete;
+
+    Kokkos::Cuda space() const { return _space; }
+
+    static constexpr bool deviceGraphs() { return true; }
+
+    void beginCapture()
+    {
+        destroyGraph();
+        checkCuda( cudaStreamBeginCapture( _stream,
+                                           cudaStreamCaptureModeThreadLocal ) );
+    }
+
+    void endCapture()
+    {
+        cudaGraph_t graph;
+        checkCuda( cudaStreamEndCapture( _stream, &graph ) );
+        checkCuda(
+            cudaGraphInstantiate( &_graph_exec, graph, nullptr, nullptr, 0 ) );
+        cudaGraphDestroy( graph );
+    }
+
+    void launchGraph() { checkCuda( cudaGraphLaunch( _graph_exec, _stream ) ); }
+
+  private:
+    static void checkCuda( const cudaError_t error )
+    {
+        if ( cudaSuccess != error )
+            throw std::runtime_error( cudaGetErrorString( error ) );
+    }
+
+    void destroyGraph()
+    {
+        if ( _graph_exec )
+        {
+            cudaGraphExecDestroy( _graph_exec );
+            _graph_exec = nullptr;
+        }
+    }
+
+    cudaStream_t _stream;
+    Kokkos::Cuda _space;
+    cudaGraphExec_t _graph_exec = nullptr;
+};
+#endif // end KOKKOS_ENABLE_CUDA
+
+//---------------------------------------------------------------------------//
+// HIP backend.
+#ifdef KOKKOS_ENABLE_HIP
+template <>
+class GraphCaptureBackend<Kokkos::Experimental::HIP>
+{
+  public:
+    GraphCaptureBackend()
+    {
+        checkHip( hipStreamCreate( &_stream ) );
+        _space = Kokkos::Experimental::HIP( _stream );
+    }
+
+    ~GraphCaptureBackend()
+    {
+        destroyGraph();
+        hipStreamDestroy( _stream );
+    }
+
+    GraphCaptureBackend( const GraphCaptureBackend& ) = delete;
+    GraphCaptureBackend& operator=( const GraphCaptureBackend& ) = delete;
+
+    Kokkos::Experimental::HIP space() const { return _space; }
+
+    static constexpr bool deviceGraphs() { return true; }
+
+    void beginCapture()
+    {
+        destroyGraph();
+        checkHip( hipStreamBeginCapture( _stream,
+                                         hipStreamCaptureModeThreadLocal ) );
+    }
+
+    void endCapture()
+    {
+        hipGraph_t graph;
+        checkHip( hipStreamEndCapture( _stream, &graph ) );
+        checkHip(
+            hipGraphInstantiate( &_graph_exec, graph, nullptr, nullptr, 0 ) );
+        hipGraphDestroy( graph );
+    }
+
+    void launchGraph() { checkHip( hipGraphLaunch( _graph_exec, _stream ) ); }
+
+  private:
+    static void checkHip( const hipError_t error )
+    {
+        if ( hipSuccess != error )
+            throw std::runtime_error( hipGetErrorString( error ) );
+    }
+
+    void destroyGraph()
+    {
+        if ( _graph_exec )
+        {
+            hipGraphExecDestroy( _graph_exec );
+            _graph_exec = nullptr;
+        }
+    }
+
+    hipStream_t _stream;
+    Kokkos::Experimental::HIP _space;
+    hipGraphExec_t _graph_exec = nullptr;
+};
+#endif // end KOKKOS_ENABLE_HIP
+
+//---------------------------------------------------------------------------//
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Capture a fixed sequence of kernels and replay it with one launch.
+
+  Time integration loops re-launch the same short kernels every step - simd
+  and neighbor parallel loops, communication pack and unpack kernels, grid
+  interpolation - and at small per-rank problem sizes the per-kernel launch
+  latency dominates the device time. A KernelGraph records such a fixed
+  sequence once and replays it as a single device graph on backends with
+  stream capture (CUDA and HIP); on other backends replay re-enqueues the
+  recorded sequence so calling code is portable.
+
+  The sequence is a callable taking the execution space instance on which
+  every contained kernel must be launched. During capture on a device graph
+  backend the kernels are recorded, not executed, so the sequence must not
+  fence, allocate, or read results back. Replay re-issues exactly the
+  recorded launches: if the data sizes change (particle resize,
+  communication plan rebuild) the sequence must be captured again.
+
+  \tparam ExecutionSpace The execution space in which to launch kernels.
+*/
+template <class ExecutionSpace>
+class KernelGraph
+{
+  public:
+    //! Kokkos execution space.
+    using execution_space = ExecutionSpace;
+
+    /*!
+      \brief Get the execution space instance on which captured sequences
+      must launch their kernels.
+    */
+    execution_space space() const { return _backend.space(); }
+
+    //! True if replay launches a single device graph on this backend.
+    static constexpr bool deviceGraph()
+    {
+        return Impl::GraphCaptureBackend<execution_space>::deviceGraphs();
+    }
+
+    //! True if a sequence has been captured.
+    bool captured() const { return static_cast<bool>( _sequence ); }
+
+    /*!
+      \brief Capture a kernel sequence, replacing any previous capture.
+
+      \param sequence Callable of signature void(const execution_space&)
+      enqueueing the kernel launches to record. The kernels are not executed
+      during capture on device graph backends.
+    */
+    template <class Functor>
+    void capture( Functor&& sequence )
+    {
+        _sequence = std::function<void( const execution_space& )>(
+            std::forward<Functor>( sequence ) );
+        if ( deviceGraph() )
+        {
+            // Quiesce the stream - capture must begin on an idle stream.
+            _backend.space().fence();
+            _backend.beginCapture();
+            _sequence( _backend.space() );
+            _backend.endCapture();
+        }
+    }
+
+    /*!
+      \brief Replay the captured sequence.
+
+      The replay is asynchronous on the graph's execution space instance -
+      fence space() before consuming the results on the host.
+    */
+    void replay()
+    {
+        if ( !captured() )
+            throw std::runtime_error( "No kernel sequence has been captured!" );
+        if ( deviceGraph() )
+            _backend.launchGraph();
+        else
+            _sequence( _backend.space() );
+    }
+
+  private:
+    Impl::GraphCaptureBackend<execution_space> _backend;
+    std::function<void( const execution_space& )> _sequence;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_KERNELGRAPH_HPP
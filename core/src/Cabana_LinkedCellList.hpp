@@ -16,6 +16,8 @@
 #ifndef CABANA_LINKEDCELLLIST_HPP
 #define CABANA_LINKEDCELLLIST_HPP
 
+#include <Cabana_NeighborList.hpp>
+#include <Cabana_Parallel.hpp>
 #include <Cabana_Slice.hpp>
 #include <Cabana_Sort.hpp>
 #include <impl/Cabana_CartesianGrid.hpp>
@@ -23,8 +25,80 @@
 #include <Kokkos_Core.hpp>
 #include <Kokkos_ScatterView.hpp>
 
+#include <cmath>
+#include <stdexcept>
+
 namespace Cabana
 {
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+
+//---------------------------------------------------------------------------//
+// Cell stencil.
+template <class Scalar>
+struct LinkedCellStencil
+{
+    Scalar rsqr;
+    CartesianGrid<double> grid;
+    int max_cells_dir;
+    int max_cells;
+    int cell_range;
+
+    LinkedCellStencil( const Scalar neighborhood_radius,
+                       const Scalar cell_size_ratio, const Scalar grid_min[3],
+                       const Scalar grid_max[3] )
+        : rsqr( neighborhood_radius * neighborhood_radius )
+    {
+        Scalar dx = neighborhood_radius * cell_size_ratio;
+        grid = CartesianGrid<double>( grid_min[0], grid_min[1], grid_min[2],
+                                      grid_max[0], grid_max[1], grid_max[2], dx,
+                                      dx, dx );
+        cell_range = std::ceil( 1 / cell_size_ratio );
+        max_cells_dir = 2 * cell_range + 1;
+        max_cells = max_cells_dir * max_cells_dir * max_cells_dir;
+    }
+
+    // Given a cell, get the index bounds of the cell stencil.
+    KOKKOS_INLINE_FUNCTION
+    void getCells( const int cell, int& imin, int& imax, int& jmin, int& jmax,
+                   int& kmin, int& kmax ) const
+    {
+        int i, j, k;
+        grid.ijkBinIndex( cell, i, j, k );
+
+        kmin = ( k - cell_range > 0 ) ? k - cell_range : 0;
+        kmax =
+            ( k + cell_range + 1 < grid._nz ) ? k + cell_range + 1 : grid._nz;
+
+        jmin = ( j - cell_range > 0 ) ? j - cell_range : 0;
+        jmax =
+            ( j + cell_range + 1 < grid._ny ) ? j + cell_range + 1 : grid._ny;
+
+        imin = ( i - cell_range > 0 ) ? i - cell_range : 0;
+        imax =
+            ( i + cell_range + 1 < grid._nx ) ? i + cell_range + 1 : grid._nx;
+    }
+
+    // Given the ijk indices of a home cell and a candidate stencil cell
+    // decide if any point of the candidate cell can be within the
+    // neighborhood radius of any point of the home cell. Candidate cells
+    // that fail this test cannot contain neighbors of any particle in the
+    // home cell and can be skipped outright. With cell_size_ratio < 1 this
+    // culls the corners of the cubic stencil that lie entirely outside the
+    // cutoff sphere.
+    KOKKOS_INLINE_FUNCTION
+    bool cellInRange( const int ci, const int cj, const int ck, const int i,
+                      const int j, const int k ) const
+    {
+        return grid.minDistanceToCell( ci, cj, ck, i, j, k ) <= rsqr;
+    }
+};
+
+//! \endcond
+} // end namespace Impl
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Data describing the bin sizes and offsets resulting from a binning
@@ -52,6 +126,26 @@ class LinkedCellList
     */
     LinkedCellList() {}
 
+    /*!
+      \brief Grid-only constructor.
+
+      \param grid_delta Grid sizes in each cardinal direction.
+
+      \param grid_min Grid minimum value in each direction.
+
+      \param grid_max Grid maximum value in each direction.
+
+      Creates the grid geometry without binning any particles - call build()
+      or buildFromCounts() to bin.
+    */
+    LinkedCellList( const double grid_delta[3], const double grid_min[3],
+                    const double grid_max[3] )
+        : _grid( grid_min[0], grid_min[1], grid_min[2], grid_max[0],
+                 grid_max[1], grid_max[2], grid_delta[0], grid_delta[1],
+                 grid_delta[2] )
+    {
+    }
+
     /*!
       \brief Slice constructor
 
@@ -161,6 +255,22 @@ class LinkedCellList
         _grid.ijkBinIndex( cardinal, i, j, k );
     }
 
+    /*!
+      \brief Given a point get the cardinal index of the bin containing it.
+      \param x The point x coordinate.
+      \param y The point y coordinate.
+      \param z The point z coordinate.
+      \return The cardinal bin index.
+    */
+    KOKKOS_INLINE_FUNCTION
+    size_type pointBinIndex( const double x, const double y,
+                             const double z ) const
+    {
+        int i, j, k;
+        _grid.locatePoint( x, y, z, i, j, k );
+        return _grid.cardinalCellIndex( i, j, k );
+    }
+
     /*!
       \brief Given a bin get the number of particles it contains.
       \param i The i bin index (x).
@@ -217,6 +327,18 @@ class LinkedCellList
     */
     BinningData<DeviceType> binningData() const { return _bin_data; }
 
+    /*!
+      \brief Get the number of bytes of memory allocated by the list.
+
+      \return The number of allocated bytes. The bin data aliases the count,
+      offset, and permutation storage so it adds nothing on top of them.
+    */
+    std::size_t memoryUsage() const
+    {
+        return _counts.span() * sizeof( int ) +
+               ( _offsets.span() + _permutes.span() ) * sizeof( size_type );
+    }
+
     /*!
       \brief Build the linked cell list with a subset of particles.
 
@@ -248,9 +370,6 @@ class LinkedCellList
 
         // Get local copies of class data for lambda function capture.
         auto grid = _grid;
-        auto counts = _counts;
-        auto offsets = _offsets;
-        auto permutes = _permutes;
 
         // Count.
         Kokkos::RangePolicy<execution_space> particle_range( begin, end );
@@ -269,7 +388,136 @@ class LinkedCellList
         Kokkos::fence();
         Kokkos::Experimental::contribute( _counts, counts_sv );
 
+        // Finish with the offset scan and permutation fill.
+        finishBuild( positions, begin, end );
+    }
+
+    /*!
+      \brief Build the linked cell list with all particles.
+
+      \tparam SliceType Slice type for positions.
+
+      \param positions Slice of positions.
+    */
+    template <class SliceType>
+    void build( SliceType positions )
+    {
+        build( positions, 0, positions.size() );
+    }
+
+    /*!
+      \brief Size and zero the cell count array for an external count pass.
+
+      \return The cell count array indexed by cardinal bin index.
+
+      Use this with buildFromCounts() when a kernel that already touches the
+      particle data (e.g. a migration unpack) can count cell occupancy as a
+      side effect, removing the counting pass over the positions from the
+      build. Fill the returned array with one count per particle at the bin
+      given by pointBinIndex() of its position - atomically or through a
+      scatter view - then call buildFromCounts().
+    */
+    CountView startCount()
+    {
+        std::size_t ncell = totalBins();
+        if ( _counts.extent( 0 ) != ncell )
+        {
+            Kokkos::resize( _counts, ncell );
+            Kokkos::resize( _offsets, ncell );
+        }
+        Kokkos::deep_copy( _counts, 0 );
+        return _counts;
+    }
+
+    /*!
+      \brief Build the linked cell list from externally computed counts.
+
+      \tparam SliceType Slice type for positions.
+
+      \param positions Slice of positions. Must be the data the counts were
+      computed from.
+
+      \param begin The beginning index of the slice range to sort.
+
+      \param end The end index of the slice range to sort.
+
+      The cell count array returned by startCount() must hold the occupancy
+      of every particle in the range. Only the offset scan and permutation
+      fill run - the counting pass is skipped.
+    */
+    template <class SliceType>
+    void buildFromCounts( SliceType positions, const std::size_t begin,
+                          const std::size_t end )
+    {
+        if ( _counts.extent( 0 ) != static_cast<std::size_t>( totalBins() ) )
+            throw std::runtime_error(
+                "Counts were not computed for this grid!" );
+        std::size_t nparticles = end - begin;
+        if ( _permutes.extent( 0 ) != nparticles )
+        {
+            Kokkos::resize( _permutes, nparticles );
+        }
+        finishBuild( positions, begin, end );
+    }
+
+    /*!
+      \brief Build the linked cell list from externally computed counts with
+      all particles.
+
+      \tparam SliceType Slice type for positions.
+
+      \param positions Slice of positions.
+    */
+    template <class SliceType>
+    void buildFromCounts( SliceType positions )
+    {
+        buildFromCounts( positions, 0, positions.size() );
+    }
+
+    /*!
+      \brief Reset the permutation vector to the identity.
+
+      Use this after the particle data has been moved into bin order (e.g.
+      once the AoSoA the list was built from has been permuted) so binned
+      particle indices address the container directly.
+    */
+    void setIdentityPermutation()
+    {
+        auto begin = _bin_data.rangeBegin();
+        auto permutes = _permutes;
+        auto identity_op = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            permutes( i ) = begin + i;
+        };
+        Kokkos::parallel_for(
+            "Cabana::LinkedCellList::setIdentityPermutation",
+            Kokkos::RangePolicy<execution_space>( 0, _permutes.extent( 0 ) ),
+            identity_op );
+        Kokkos::fence();
+    }
+
+  private:
+    BinningData<DeviceType> _bin_data;
+    Impl::CartesianGrid<double> _grid;
+
+    CountView _counts;
+    OffsetView _offsets;
+    OffsetView _permutes;
+
+    // Finish a build from filled counts: offset scan, permutation fill, and
+    // binning data creation.
+    template <class SliceType>
+    void finishBuild( SliceType positions, const std::size_t begin,
+                      const std::size_t end )
+    {
+        // Get local copies of class data for lambda function capture.
+        auto grid = _grid;
+        auto counts = _counts;
+        auto offsets = _offsets;
+        auto permutes = _permutes;
+
         // Compute offsets.
+        std::size_t ncell = totalBins();
         Kokkos::RangePolicy<execution_space> cell_range( 0, ncell );
         auto offset_scan = KOKKOS_LAMBDA( const std::size_t c, int& update,
                                           const bool final_pass )
@@ -286,6 +534,7 @@ class LinkedCellList
         Kokkos::deep_copy( _counts, 0 );
 
         // Compute the permutation vector.
+        Kokkos::RangePolicy<execution_space> particle_range( begin, end );
         auto create_permute = KOKKOS_LAMBDA( const std::size_t p )
         {
             int i, j, k;
@@ -304,27 +553,6 @@ class LinkedCellList
             BinningData<DeviceType>( begin, end, _counts, _offsets, _permutes );
     }
 
-    /*!
-      \brief Build the linked cell list with all particles.
-
-      \tparam SliceType Slice type for positions.
-
-      \param positions Slice of positions.
-    */
-    template <class SliceType>
-    void build( SliceType positions )
-    {
-        build( positions, 0, positions.size() );
-    }
-
-  private:
-    BinningData<DeviceType> _bin_data;
-    Impl::CartesianGrid<double> _grid;
-
-    CountView _counts;
-    OffsetView _offsets;
-    OffsetView _permutes;
-
     void allocate( const int ncell, const int nparticles )
     {
         _counts = CountView(
@@ -404,6 +632,1064 @@ void permute(
     permute( linked_cell_list.binningData(), slice );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a linked cell list and sort the AoSoA into bin order in a
+  single traversal of the particle data.
+
+  \tparam PositionIndex The AoSoA member index of the particle positions.
+
+  \tparam AoSoA_t The AoSoA type.
+
+  \param aosoa The AoSoA to bin and sort. The container is replaced by the
+  sorted container, so slices taken before this call must be re-taken.
+
+  \param grid_delta Grid sizes in each cardinal direction.
+
+  \param grid_min Grid minimum value in each direction.
+
+  \param grid_max Grid maximum value in each direction.
+
+  \return The linked cell list over the sorted container. The permutation is
+  the identity - binned particle indices address the container directly.
+
+  Building the list followed by a separate permute() stages the permuted
+  data in scratch and copies it back, reading and writing the full particle
+  state twice. This fused path builds the bins from the position slice alone
+  and then gathers each tuple directly to its sorted position in a fresh
+  container that replaces the input, so the full particle state is read and
+  written exactly once per rebuild.
+*/
+template <std::size_t PositionIndex, class AoSoA_t,
+          class DeviceType = typename AoSoA_t::device_type>
+LinkedCellList<DeviceType> createSortedLinkedCellList(
+    AoSoA_t& aosoa,
+    const typename AoSoA_t::template member_slice_type<
+        PositionIndex>::value_type grid_delta[3],
+    const typename AoSoA_t::template member_slice_type<
+        PositionIndex>::value_type grid_min[3],
+    const typename AoSoA_t::template member_slice_type<
+        PositionIndex>::value_type grid_max[3],
+    typename std::enable_if<( is_aosoa<AoSoA_t>::value ), int>::type* = 0 )
+{
+    // Build the bins and permutation from the position slice alone.
+    auto positions = slice<PositionIndex>( aosoa );
+    LinkedCellList<DeviceType> linked_cell_list( positions, grid_delta,
+                                                 grid_min, grid_max );
+
+    // Gather every tuple directly to its sorted position in a new container.
+    AoSoA_t sorted_aosoa( aosoa.label(), aosoa.size() );
+    auto bin_data = linked_cell_list.binningData();
+    auto gather_op = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        sorted_aosoa.setTuple( i, aosoa.getTuple( bin_data.permutation( i ) ) );
+    };
+    Kokkos::parallel_for(
+        "Cabana::createSortedLinkedCellList::gather_op",
+        Kokkos::RangePolicy<typename DeviceType::execution_space>(
+            0, aosoa.size() ),
+        gather_op );
+    Kokkos::fence();
+
+    // The sorted container replaces the input and is already in bin order.
+    aosoa = sorted_aosoa;
+    linked_cell_list.setIdentityPermutation();
+    return linked_cell_list;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin data of one level of a hierarchical linked cell list.
+
+  Provides the same bin queries as LinkedCellList over the shared particle
+  permutation so a force loop can traverse cells at this level's
+  granularity. Note that the cardinal ordering of a level is nested - the
+  cells inside one coarse cell are contiguous - so cardinal indices of
+  different levels are not interchangeable.
+*/
+template <class DeviceType>
+class LinkedCellLevel
+{
+  public:
+    //! Kokkos device_type.
+    using device_type = DeviceType;
+    //! Kokkos memory space.
+    using memory_space = typename device_type::memory_space;
+    //! Memory space size type.
+    using size_type = typename memory_space::size_type;
+    //! Binning view type.
+    using CountView = Kokkos::View<int*, device_type>;
+    //! Offset view type.
+    using OffsetView = Kokkos::View<size_type*, device_type>;
+
+    /*!
+      \brief Default constructor.
+    */
+    LinkedCellLevel() {}
+
+    //! \cond Impl
+    // Levels are created by HierarchicalLinkedCellList.
+    LinkedCellLevel( CountView counts, OffsetView offsets,
+                     OffsetView permutes, const int nx, const int ny,
+                     const int nz, const int refinement, const int coarse_ny,
+                     const int coarse_nz )
+        : _counts( counts )
+        , _offsets( offsets )
+        , _permutes( permutes )
+        , _nx( nx )
+        , _ny( ny )
+        , _nz( nz )
+        , _r( refinement )
+        , _r3( refinement * refinement * refinement )
+        , _coarse_ny( coarse_ny )
+        , _coarse_nz( coarse_nz )
+    {
+    }
+    //! \endcond
+
+    /*!
+      \brief Get the total number of bins of this level.
+      \return the total number of bins.
+    */
+    KOKKOS_INLINE_FUNCTION
+    int totalBins() const { return _nx * _ny * _nz; }
+
+    /*!
+      \brief Get the number of bins in a given dimension.
+      \param dim The dimension to get the number of bins for.
+      \return The number of bins.
+    */
+    KOKKOS_INLINE_FUNCTION
+    int numBin( const int dim ) const
+    {
+        if ( 0 == dim )
+            return _nx;
+        else if ( 1 == dim )
+            return _ny;
+        else if ( 2 == dim )
+            return _nz;
+        else
+            return -1;
+    }
+
+    /*!
+      \brief Given the ijk index of a bin get its cardinal index in the
+      nested ordering of the hierarchy.
+      \param i The i bin index (x).
+      \param j The j bin index (y).
+      \param k The k bin index (z).
+      \return The cardinal bin index.
+    */
+    KOKKOS_INLINE_FUNCTION
+    size_type cardinalBinIndex( const int i, const int j, const int k ) const
+    {
+        return ( ( ( i / _r ) * _coarse_ny + ( j / _r ) ) * _coarse_nz +
+                 ( k / _r ) ) *
+                   _r3 +
+               ( ( i % _r ) * _r + ( j % _r ) ) * _r + ( k % _r );
+    }
+
+    /*!
+      \brief Given a bin get the number of particles it contains.
+      \param i The i bin index (x).
+      \param j The j bin index (y).
+      \param k The k bin index (z).
+      \return The number of particles in the bin.
+    */
+    KOKKOS_INLINE_FUNCTION
+    int binSize( const int i, const int j, const int k ) const
+    {
+        return _counts( cardinalBinIndex( i, j, k ) );
+    }
+
+    /*!
+      \brief Given a bin get the particle index at which it sorts.
+      \param i The i bin index (x).
+      \param j The j bin index (y).
+      \param k The k bin index (z).
+      \return The starting particle index of the bin.
+    */
+    KOKKOS_INLINE_FUNCTION
+    size_type binOffset( const int i, const int j, const int k ) const
+    {
+        return _offsets( cardinalBinIndex( i, j, k ) );
+    }
+
+    /*!
+      \brief Given a local particle id in the binned layout, get the id of the
+      particle in the old (unbinned) layout.
+      \param particle_id The id of the particle in the binned layout.
+      \return The particle id in the old (unbinned) layout.
+    */
+    KOKKOS_INLINE_FUNCTION
+    size_type permutation( const int particle_id ) const
+    {
+        return _permutes( particle_id );
+    }
+
+  private:
+    CountView _counts;
+    OffsetView _offsets;
+    OffsetView _permutes;
+
+    int _nx;
+    int _ny;
+    int _nz;
+    int _r;
+    int _r3;
+    int _coarse_ny;
+    int _coarse_nz;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Two-level linked cell hierarchy sharing one particle permutation.
+
+  Mixed-range interactions need cell searches at two granularities: one
+  linked cell list sized for the long cutoff makes the short-range search
+  visit far too many candidates, while two independent lists bin the
+  particles twice and produce incompatible permutations. The hierarchy bins
+  once on the fine grid with a nested cell ordering - fine cells sort
+  within their enclosing coarse cell - so the bins of both levels are
+  contiguous ranges of the same permutation. Each force loop then queries
+  the level matching its cutoff.
+
+  The coarse cell size is the fine cell size times an integer refinement
+  factor in each direction.
+*/
+template <class DeviceType>
+class HierarchicalLinkedCellList
+{
+  public:
+    //! Kokkos device_type.
+    using device_type = DeviceType;
+    //! Kokkos memory space.
+    using memory_space = typename device_type::memory_space;
+    //! Kokkos execution space.
+    using execution_space = typename device_type::execution_space;
+    //! Memory space size type.
+    using size_type = typename memory_space::size_type;
+    //! Binning view type.
+    using CountView = Kokkos::View<int*, device_type>;
+    //! Offset view type.
+    using OffsetView = Kokkos::View<size_type*, device_type>;
+    //! Level bin data type.
+    using level_type = LinkedCellLevel<DeviceType>;
+
+    /*!
+      \brief Default constructor.
+    */
+    HierarchicalLinkedCellList() {}
+
+    /*!
+      \brief Slice constructor
+
+      \tparam SliceType Slice type for positions.
+
+      \param positions Slice of positions.
+
+      \param grid_delta Fine grid cell sizes in each cardinal direction,
+      sized for the short cutoff.
+
+      \param refinement Number of fine cells per coarse cell in each
+      direction. The coarse cell size is grid_delta times this factor and
+      should be sized for the long cutoff.
+
+      \param grid_min Grid minimum value in each direction.
+
+      \param grid_max Grid maximum value in each direction.
+    */
+    template <class SliceType>
+    HierarchicalLinkedCellList(
+        SliceType positions, const typename SliceType::value_type grid_delta[3],
+        const int refinement,
+        const typename SliceType::value_type grid_min[3],
+        const typename SliceType::value_type grid_max[3],
+        typename std::enable_if<( is_slice<SliceType>::value ), int>::type* =
+            0 )
+        : _grid( grid_min[0], grid_min[1], grid_min[2], grid_max[0],
+                 grid_max[1], grid_max[2], grid_delta[0], grid_delta[1],
+                 grid_delta[2] )
+        , _refinement( refinement )
+    {
+        setupLevels();
+        std::size_t np = positions.size();
+        allocate( np );
+        build( positions, 0, np );
+    }
+
+    /*!
+      \brief Slice range constructor
+
+      \tparam SliceType Slice type for positions.
+
+      \param positions Slice of positions.
+
+      \param begin The beginning index of the AoSoA range to sort.
+
+      \param end The end index of the AoSoA range to sort.
+
+      \param grid_delta Fine grid cell sizes in each cardinal direction,
+      sized for the short cutoff.
+
+      \param refinement Number of fine cells per coarse cell in each
+      direction. The coarse cell size is grid_delta times this factor and
+      should be sized for the long cutoff.
+
+      \param grid_min Grid minimum value in each direction.
+
+      \param grid_max Grid maximum value in each direction.
+    */
+    template <class SliceType>
+    HierarchicalLinkedCellList(
+        SliceType positions, const std::size_t begin, const std::size_t end,
+        const typename SliceType::value_type grid_delta[3],
+        const int refinement,
+        const typename SliceType::value_type grid_min[3],
+        const typename SliceType::value_type grid_max[3],
+        typename std::enable_if<( is_slice<SliceType>::value ), int>::type* =
+            0 )
+        : _grid( grid_min[0], grid_min[1], grid_min[2], grid_max[0],
+                 grid_max[1], grid_max[2], grid_delta[0], grid_delta[1],
+                 grid_delta[2] )
+        , _refinement( refinement )
+    {
+        setupLevels();
+        allocate( end - begin );
+        build( positions, begin, end );
+    }
+
+    //! Get the fine level bin data, sized for the short cutoff.
+    level_type fine() const
+    {
+        return level_type( _counts, _offsets, _permutes, _grid._nx, _grid._ny,
+                           _grid._nz, _refinement, _coarse_ny, _coarse_nz );
+    }
+
+    //! Get the coarse level bin data, sized for the long cutoff.
+    level_type coarse() const
+    {
+        return level_type( _coarse_counts, _coarse_offsets, _permutes,
+                           _coarse_nx, _coarse_ny, _coarse_nz, 1, _coarse_ny,
+                           _coarse_nz );
+    }
+
+    //! Get the number of fine cells per coarse cell in each direction.
+    int refinement() const { return _refinement; }
+
+    /*!
+      \brief Get the 1d bin data of the shared binning.
+      \return The 1d bin data.
+    */
+    BinningData<DeviceType> binningData() const { return _bin_data; }
+
+    /*!
+      \brief Get the number of bytes of memory allocated by the hierarchy.
+
+      \return The number of allocated bytes. Relative to a single linked
+      cell list over the fine grid only the aggregated coarse counts and
+      offsets are added - the permutation is shared between the levels.
+    */
+    std::size_t memoryUsage() const
+    {
+        return ( _counts.span() + _coarse_counts.span() ) * sizeof( int ) +
+               ( _offsets.span() + _coarse_offsets.span() +
+                 _permutes.span() ) *
+                   sizeof( size_type );
+    }
+
+    /*!
+      \brief Build the hierarchy with a subset of particles.
+
+      \tparam SliceType Slice type for positions.
+
+      \param positions Slice of positions.
+
+      \param begin The beginning index of the slice range to sort.
+
+      \param end The end index of the slice range to sort.
+    */
+    template <class SliceType>
+    void build( SliceType positions, const std::size_t begin,
+                const std::size_t end )
+    {
+        // Resize the binning data. Note that the permutation vector spans
+        // only the length of begin-end;
+        std::size_t ncell = totalFineBins();
+        if ( _counts.extent( 0 ) != ncell )
+        {
+            Kokkos::resize( _counts, ncell );
+            Kokkos::resize( _offsets, ncell );
+        }
+        std::size_t ncoarse = totalCoarseBins();
+        if ( _coarse_counts.extent( 0 ) != ncoarse )
+        {
+            Kokkos::resize( _coarse_counts, ncoarse );
+            Kokkos::resize( _coarse_offsets, ncoarse );
+        }
+        std::size_t nparticles = end - begin;
+        if ( _permutes.extent( 0 ) != nparticles )
+        {
+            Kokkos::resize( _permutes, nparticles );
+        }
+
+        // Get local copies of class data for lambda function capture. The
+        // fine level view provides the nested cardinal index that keeps the
+        // fine cells of one coarse cell contiguous so both levels bin from
+        // one pass.
+        auto grid = _grid;
+        auto counts = _counts;
+        auto offsets = _offsets;
+        auto permutes = _permutes;
+        const int r3 = _refinement * _refinement * _refinement;
+        auto fine_level = fine();
+
+        // Count.
+        Kokkos::RangePolicy<execution_space> particle_range( begin, end );
+        Kokkos::deep_copy( _counts, 0 );
+        auto counts_sv = Kokkos::Experimental::create_scatter_view( _counts );
+        auto cell_count = KOKKOS_LAMBDA( const std::size_t p )
+        {
+            int i, j, k;
+            grid.locatePoint( positions( p, 0 ), positions( p, 1 ),
+                              positions( p, 2 ), i, j, k );
+            auto counts_data = counts_sv.access();
+            counts_data( fine_level.cardinalBinIndex( i, j, k ) ) += 1;
+        };
+        Kokkos::parallel_for(
+            "Cabana::HierarchicalLinkedCellList::build::cell_count",
+            particle_range, cell_count );
+        Kokkos::fence();
+        Kokkos::Experimental::contribute( _counts, counts_sv );
+
+        // Compute offsets.
+        Kokkos::RangePolicy<execution_space> cell_range( 0, ncell );
+        auto offset_scan = KOKKOS_LAMBDA( const std::size_t c, int& update,
+                                          const bool final_pass )
+        {
+            if ( final_pass )
+                offsets( c ) = update;
+            update += counts( c );
+        };
+        Kokkos::parallel_scan(
+            "Cabana::HierarchicalLinkedCellList::build::offset_scan",
+            cell_range, offset_scan );
+        Kokkos::fence();
+
+        // Reset counts.
+        Kokkos::deep_copy( _counts, 0 );
+
+        // Compute the permutation vector.
+        auto create_permute = KOKKOS_LAMBDA( const std::size_t p )
+        {
+            int i, j, k;
+            grid.locatePoint( positions( p, 0 ), positions( p, 1 ),
+                              positions( p, 2 ), i, j, k );
+            auto cell_id = fine_level.cardinalBinIndex( i, j, k );
+            int c = Kokkos::atomic_fetch_add( &counts( cell_id ), 1 );
+            permutes( offsets( cell_id ) + c ) = p;
+        };
+        Kokkos::parallel_for(
+            "Cabana::HierarchicalLinkedCellList::build::create_permute",
+            particle_range, create_permute );
+        Kokkos::fence();
+
+        // Aggregate the coarse bins. The fine cells of a coarse cell are
+        // contiguous in the nested ordering so a coarse bin starts at its
+        // first fine bin and its size is the sum of the fine counts.
+        auto coarse_counts = _coarse_counts;
+        auto coarse_offsets = _coarse_offsets;
+        auto coarse_aggregate = KOKKOS_LAMBDA( const std::size_t c )
+        {
+            int sum = 0;
+            for ( int l = 0; l < r3; ++l )
+                sum += counts( c * r3 + l );
+            coarse_counts( c ) = sum;
+            coarse_offsets( c ) = offsets( c * r3 );
+        };
+        Kokkos::parallel_for(
+            "Cabana::HierarchicalLinkedCellList::build::coarse_aggregate",
+            Kokkos::RangePolicy<execution_space>( 0, ncoarse ),
+            coarse_aggregate );
+        Kokkos::fence();
+
+        // Create the binning data.
+        _bin_data =
+            BinningData<DeviceType>( begin, end, _counts, _offsets, _permutes );
+    }
+
+    /*!
+      \brief Build the hierarchy with all particles.
+
+      \tparam SliceType Slice type for positions.
+
+      \param positions Slice of positions.
+    */
+    template <class SliceType>
+    void build( SliceType positions )
+    {
+        build( positions, 0, positions.size() );
+    }
+
+  private:
+    BinningData<DeviceType> _bin_data;
+    Impl::CartesianGrid<double> _grid;
+    int _refinement;
+
+    int _coarse_nx;
+    int _coarse_ny;
+    int _coarse_nz;
+
+    CountView _counts;
+    OffsetView _offsets;
+    OffsetView _permutes;
+    CountView _coarse_counts;
+    OffsetView _coarse_offsets;
+
+    // The coarse grid covers the fine grid. The last coarse cell in a
+    // direction may be partially filled if the refinement does not evenly
+    // divide the fine cell count.
+    void setupLevels()
+    {
+        if ( _refinement < 1 )
+            throw std::runtime_error(
+                "Hierarchical cell refinement must be at least 1!" );
+        _coarse_nx = ( _grid._nx + _refinement - 1 ) / _refinement;
+        _coarse_ny = ( _grid._ny + _refinement - 1 ) / _refinement;
+        _coarse_nz = ( _grid._nz + _refinement - 1 ) / _refinement;
+    }
+
+    // Total fine bins in the nested ordering. Coarse cells are padded to a
+    // full refinement block so this can exceed the fine grid cell count;
+    // the padding bins stay empty.
+    std::size_t totalFineBins() const
+    {
+        return totalCoarseBins() * _refinement * _refinement * _refinement;
+    }
+
+    std::size_t totalCoarseBins() const
+    {
+        return std::size_t( _coarse_nx ) * _coarse_ny * _coarse_nz;
+    }
+
+    void allocate( const int nparticles )
+    {
+        _counts = CountView(
+            Kokkos::view_alloc( Kokkos::WithoutInitializing, "counts" ),
+            totalFineBins() );
+        _offsets = OffsetView(
+            Kokkos::view_alloc( Kokkos::WithoutInitializing, "offsets" ),
+            totalFineBins() );
+        _permutes = OffsetView(
+            Kokkos::view_alloc( Kokkos::WithoutInitializing, "permutes" ),
+            nparticles );
+        _coarse_counts = CountView(
+            Kokkos::view_alloc( Kokkos::WithoutInitializing, "coarse_counts" ),
+            totalCoarseBins() );
+        _coarse_offsets = OffsetView(
+            Kokkos::view_alloc( Kokkos::WithoutInitializing, "coarse_offsets" ),
+            totalCoarseBins() );
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+template <typename>
+struct is_hierarchical_linked_cell_list_impl : public std::false_type
+{
+};
+
+template <typename DeviceType>
+struct is_hierarchical_linked_cell_list_impl<
+    HierarchicalLinkedCellList<DeviceType>> : public std::true_type
+{
+};
+//! \endcond
+
+//! HierarchicalLinkedCellList static type checker.
+template <class T>
+struct is_hierarchical_linked_cell_list
+    : public is_hierarchical_linked_cell_list_impl<
+          typename std::remove_cv<T>::type>::type
+{
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Given a hierarchical linked cell list permute an AoSoA.
+
+  \tparam HierarchicalListType The hierarchical linked cell list type.
+
+  \tparam AoSoA_t The AoSoA type.
+
+  \param list The hierarchical linked cell list to permute the AoSoA with.
+
+  \param aosoa The AoSoA to permute.
+ */
+template <class HierarchicalListType, class AoSoA_t>
+void permute(
+    const HierarchicalListType& list, AoSoA_t& aosoa,
+    typename std::enable_if<
+        ( is_hierarchical_linked_cell_list<HierarchicalListType>::value &&
+          is_aosoa<AoSoA_t>::value ),
+        int>::type* = 0 )
+{
+    permute( list.binningData(), aosoa );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Given a hierarchical linked cell list permute a slice.
+
+  \tparam HierarchicalListType The hierarchical linked cell list type.
+
+  \tparam SliceType The slice type.
+
+  \param list The hierarchical linked cell list to permute the slice with.
+
+  \param slice The slice to permute.
+ */
+template <class HierarchicalListType, class SliceType>
+void permute(
+    const HierarchicalListType& list, SliceType& slice,
+    typename std::enable_if<
+        ( is_hierarchical_linked_cell_list<HierarchicalListType>::value &&
+          is_slice<SliceType>::value ),
+        int>::type* = 0 )
+{
+    permute( list.binningData(), slice );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief On-the-fly neighbor candidate enumeration from a linked cell list.
+
+  Materialized Verlet storage can cost more memory than the particle data
+  itself. This adapter implements the common NeighborList interface
+  directly over the binned cells: the neighbors of a particle are the
+  particles of its stencil cells, enumerated from the shared bin data with
+  no per-particle storage at all. Candidates are not distance-filtered -
+  kernels apply their cutoff test inline, exactly as they already do to
+  tolerate the skin of a Verlet list - so pair kernels trade extra cutoff
+  tests for the entire neighbor list allocation.
+
+  The positions must be those the linked cell list was built with and the
+  grid cell size the list was built with must equal the neighborhood radius
+  times the cell size ratio.
+
+  \tparam LinkedCellListType The linked cell list type.
+  \tparam PositionSlice The position slice type.
+*/
+template <class LinkedCellListType, class PositionSlice>
+class LinkedCellNeighborList
+{
+  public:
+    //! Linked cell list type.
+    using list_type = LinkedCellListType;
+    //! Kokkos memory space.
+    using memory_space = typename list_type::memory_space;
+    //! Memory space size type.
+    using size_type = typename list_type::size_type;
+    //! Position value type.
+    using value_type = typename PositionSlice::value_type;
+
+    /*!
+      \brief Constructor.
+
+      \param list The linked cell list the positions were binned with.
+
+      \param positions The slice of positions the list was built with.
+
+      \param neighborhood_radius The radius of the neighborhood.
+
+      \param cell_size_ratio The ratio of the cell size in the Cartesian
+      grid to the neighborhood radius.
+
+      \param grid_min The minimum value of the grid in each dimension.
+
+      \param grid_max The maximum value of the grid in each dimension.
+    */
+    LinkedCellNeighborList( const LinkedCellListType& list,
+                            const PositionSlice& positions,
+                            const value_type neighborhood_radius,
+                            const value_type cell_size_ratio,
+                            const value_type grid_min[3],
+                            const value_type grid_max[3] )
+        : _list( list )
+        , _positions( positions )
+        , _stencil( neighborhood_radius, cell_size_ratio, grid_min, grid_max )
+    {
+        static_assert( is_linked_cell_list<LinkedCellListType>::value,
+                       "The list must be a linked cell list" );
+        static_assert( is_slice<PositionSlice>::value,
+                       "The positions must be a slice" );
+    }
+
+    /*!
+      \brief Get the number of neighbor candidates of a particle.
+      \param particle_index The particle id in the layout the list was built
+      with.
+      \return The number of candidates in the stencil cells, excluding the
+      particle itself.
+    */
+    KOKKOS_INLINE_FUNCTION
+    std::size_t numCandidate( const std::size_t particle_index ) const
+    {
+        int imin, imax, jmin, jmax, kmin, kmax, ci, cj, ck;
+        locate( particle_index, imin, imax, jmin, jmax, kmin, kmax, ci, cj,
+                ck );
+
+        std::size_t num = 0;
+        for ( int i = imin; i < imax; ++i )
+            for ( int j = jmin; j < jmax; ++j )
+                for ( int k = kmin; k < kmax; ++k )
+                {
+                    if ( !_stencil.cellInRange( ci, cj, ck, i, j, k ) )
+                        continue;
+                    num += _list.binSize( i, j, k );
+                }
+
+        // The particle is a candidate of its own cell if it was binned.
+        if ( particle_index >= _list.rangeBegin() &&
+             particle_index < _list.rangeEnd() )
+            --num;
+        return num;
+    }
+
+    /*!
+      \brief Get the id of a neighbor candidate of a particle.
+      \param particle_index The particle id in the layout the list was built
+      with.
+      \param candidate_index The index of the candidate relative to the
+      particle.
+      \return The candidate particle id.
+    */
+    KOKKOS_INLINE_FUNCTION
+    std::size_t getCandidate( const std::size_t particle_index,
+                              const std::size_t candidate_index ) const
+    {
+        int imin, imax, jmin, jmax, kmin, kmax, ci, cj, ck;
+        locate( particle_index, imin, imax, jmin, jmax, kmin, kmax, ci, cj,
+                ck );
+
+        // Walk the stencil cells in the order numCandidate() counted them.
+        std::size_t n = candidate_index;
+        for ( int i = imin; i < imax; ++i )
+            for ( int j = jmin; j < jmax; ++j )
+                for ( int k = kmin; k < kmax; ++k )
+                {
+                    if ( !_stencil.cellInRange( ci, cj, ck, i, j, k ) )
+                        continue;
+
+                    std::size_t s = _list.binSize( i, j, k );
+                    size_type offset = _list.binOffset( i, j, k );
+                    if ( i == ci && j == cj && k == ck )
+                    {
+                        // Skip the particle itself within its own bin.
+                        for ( std::size_t slot = 0; slot < s; ++slot )
+                        {
+                            std::size_t id =
+                                _list.permutation( offset + slot );
+                            if ( id == particle_index )
+                                continue;
+                            if ( 0 == n )
+                                return id;
+                            --n;
+                        }
+                    }
+                    else
+                    {
+                        if ( n < s )
+                            return _list.permutation( offset + n );
+                        n -= s;
+                    }
+                }
+
+        // Unreachable for a valid candidate index.
+        return particle_index;
+    }
+
+  private:
+    // Locate the cell of a particle and the index bounds of its stencil.
+    KOKKOS_INLINE_FUNCTION
+    void locate( const std::size_t particle_index, int& imin, int& imax,
+                 int& jmin, int& jmax, int& kmin, int& kmax, int& ci, int& cj,
+                 int& ck ) const
+    {
+        _stencil.grid.locatePoint( _positions( particle_index, 0 ),
+                                   _positions( particle_index, 1 ),
+                                   _positions( particle_index, 2 ), ci, cj,
+                                   ck );
+        _stencil.getCells( _stencil.grid.cardinalCellIndex( ci, cj, ck ), imin,
+                           imax, jmin, jmax, kmin, kmax );
+    }
+
+    list_type _list;
+    PositionSlice _positions;
+    Impl::LinkedCellStencil<value_type> _stencil;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create an on-the-fly neighbor list over a linked cell list.
+
+  \param list The linked cell list the positions were binned with.
+
+  \param positions The slice of positions the list was built with.
+
+  \param neighborhood_radius The radius of the neighborhood.
+
+  \param cell_size_ratio The ratio of the cell size in the Cartesian grid to
+  the neighborhood radius.
+
+  \param grid_min The minimum value of the grid in each dimension.
+
+  \param grid_max The maximum value of the grid in each dimension.
+
+  \return A NeighborList-compatible adapter enumerating neighbor candidates
+  directly from the binned cells.
+*/
+template <class LinkedCellListType, class PositionSlice>
+LinkedCellNeighborList<LinkedCellListType, PositionSlice>
+createLinkedCellNeighborList(
+    const LinkedCellListType& list, const PositionSlice& positions,
+    const typename PositionSlice::value_type neighborhood_radius,
+    const typename PositionSlice::value_type cell_size_ratio,
+    const typename PositionSlice::value_type grid_min[3],
+    const typename PositionSlice::value_type grid_max[3],
+    typename std::enable_if<( is_linked_cell_list<LinkedCellListType>::value &&
+                              is_slice<PositionSlice>::value ),
+                            int>::type* = 0 )
+{
+    return LinkedCellNeighborList<LinkedCellListType, PositionSlice>(
+        list, positions, neighborhood_radius, cell_size_ratio, grid_min,
+        grid_max );
+}
+
+//---------------------------------------------------------------------------//
+//! On-the-fly linked cell NeighborList interface.
+template <class LinkedCellListType, class PositionSlice>
+class NeighborList<LinkedCellNeighborList<LinkedCellListType, PositionSlice>>
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = typename LinkedCellListType::memory_space;
+    //! Neighbor list type.
+    using list_type = LinkedCellNeighborList<LinkedCellListType, PositionSlice>;
+
+    //! Get the number of neighbor candidates for a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t numNeighbor( const list_type& list,
+                                    const std::size_t particle_index )
+    {
+        return list.numCandidate( particle_index );
+    }
+
+    //! Get the id for a candidate for a given particle index and the index
+    //! of the candidate relative to the particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t getNeighbor( const list_type& list,
+                                    const std::size_t particle_index,
+                                    const std::size_t neighbor_index )
+    {
+        return list.getCandidate( particle_index, neighbor_index );
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Linked Cell Parallel For
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor in parallel over particle pairs directly from a
+  linked cell list, staging candidate neighbor positions in team scratch.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam LinkedCellListType The linked cell list type.
+  \tparam PositionSlice The position slice type.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor. Only
+  particles within the policy range have the functor applied to their pairs.
+  \param functor The functor to execute in parallel
+  \param list The linked cell list the positions were binned with.
+  \param position The slice containing the particle positions. Must be the
+  positions the linked cell list was built with.
+  \param neighborhood_radius The radius of the neighborhood. Must match the
+  grid cell size the linked cell list was built with times the cell size
+  ratio.
+  \param cell_size_ratio The ratio of the cell size in the Cartesian grid to
+  the neighborhood radius.
+  \param grid_min The minimum value of the grid containing the particles in
+  each dimension.
+  \param grid_max The maximum value of the grid containing the particles in
+  each dimension.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+
+  Each team operates on one cell. The positions of the candidate neighbors
+  from the stencil cells are staged into team scratch in tiles and every
+  particle of the cell then iterates the tile from shared memory, so each
+  candidate position is loaded from global memory once per cell instead of
+  once per particle. This is most profitable for bandwidth-bound pair
+  kernels evaluated without a stored neighbor list.
+
+  The functor is applied to every distinct pair within the radius in both
+  orderings, equivalent to iterating a full neighbor list, with the
+  signature of a first neighbor operation:
+
+  \code
+  void operator() ( const int i, const int j ) const ;
+  \endcode
+*/
+template <class FunctorType, class LinkedCellListType, class PositionSlice,
+          class... ExecParameters>
+inline void linked_cell_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const LinkedCellListType& list,
+    const PositionSlice& position,
+    const typename PositionSlice::value_type neighborhood_radius,
+    const typename PositionSlice::value_type cell_size_ratio,
+    const typename PositionSlice::value_type grid_min[3],
+    const typename PositionSlice::value_type grid_max[3],
+    const std::string& str = "",
+    typename std::enable_if<( is_linked_cell_list<LinkedCellListType>::value &&
+                              is_slice<PositionSlice>::value ),
+                            int>::type* = 0 )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using memory_space = typename LinkedCellListType::memory_space;
+
+    static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
+
+    using kokkos_policy =
+        Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+
+    using index_type = typename kokkos_policy::index_type;
+
+    // Scratch tiles for the staged candidate positions and ids.
+    using scratch_space = typename execution_space::scratch_memory_space;
+    using position_tile_type =
+        Kokkos::View<double* [3], scratch_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+    using index_tile_type =
+        Kokkos::View<int*, scratch_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+    constexpr int tile_size = 128;
+
+    Impl::LinkedCellStencil<typename PositionSlice::value_type> stencil(
+        neighborhood_radius, cell_size_ratio, grid_min, grid_max );
+
+    auto bin_data_1d = list.binningData();
+
+    kokkos_policy team_policy( bin_data_1d.numBin(), Kokkos::AUTO );
+    team_policy = team_policy.set_scratch_size(
+        0, Kokkos::PerTeam( position_tile_type::shmem_size( tile_size ) +
+                            index_tile_type::shmem_size( tile_size ) ) );
+
+    const std::size_t pid_begin = exec_policy.begin();
+    const std::size_t pid_end = exec_policy.end();
+    const double rsqr = neighborhood_radius * neighborhood_radius;
+
+    auto cell_func =
+        KOKKOS_LAMBDA( const typename kokkos_policy::member_type& team )
+    {
+        // The league rank of the team is the cardinal cell index we are
+        // working on.
+        int cell = team.league_rank();
+
+        // Get the stencil for this cell.
+        int imin, imax, jmin, jmax, kmin, kmax;
+        stencil.getCells( cell, imin, imax, jmin, jmax, kmin, kmax );
+        int c_i, c_j, c_k;
+        stencil.grid.ijkBinIndex( cell, c_i, c_j, c_k );
+
+        position_tile_type tile_x( team.team_scratch( 0 ), tile_size );
+        index_tile_type tile_id( team.team_scratch( 0 ), tile_size );
+
+        std::size_t b_offset = bin_data_1d.binOffset( cell );
+        int b_size = bin_data_1d.binSize( cell );
+
+        // Loop over the cell stencil.
+        for ( int i = imin; i < imax; ++i )
+            for ( int j = jmin; j < jmax; ++j )
+                for ( int k = kmin; k < kmax; ++k )
+                {
+                    // Skip cells that cannot contain neighbors of any
+                    // particle in this cell.
+                    if ( !stencil.cellInRange( c_i, c_j, c_k, i, j, k ) )
+                        continue;
+
+                    std::size_t n_offset = list.binOffset( i, j, k );
+                    int num_n = list.binSize( i, j, k );
+
+                    // Process the candidates of this bin in tiles.
+                    for ( int tb = 0; tb < num_n; tb += tile_size )
+                    {
+                        int tn = ( tile_size < num_n - tb ) ? tile_size
+                                                            : num_n - tb;
+
+                        // Stage the tile. Each candidate position is read
+                        // from global memory once per team.
+                        Kokkos::parallel_for(
+                            Kokkos::TeamThreadRange( team, tn ),
+                            [&]( const index_type t ) {
+                                std::size_t nid = list.permutation(
+                                    n_offset + tb + t );
+                                tile_id( t ) = nid;
+                                for ( int d = 0; d < 3; ++d )
+                                    tile_x( t, d ) = position( nid, d );
+                            } );
+                        team.team_barrier();
+
+                        // Every particle of the cell iterates the staged
+                        // tile from shared memory.
+                        Kokkos::parallel_for(
+                            Kokkos::TeamThreadRange( team, b_size ),
+                            [&]( const index_type bi ) {
+                                std::size_t pid =
+                                    list.permutation( bi + b_offset );
+                                if ( ( pid < pid_begin ) ||
+                                     ( pid >= pid_end ) )
+                                    return;
+
+                                // Cache the particle coordinates.
+                                double x_p = position( pid, 0 );
+                                double y_p = position( pid, 1 );
+                                double z_p = position( pid, 2 );
+
+                                for ( int t = 0; t < tn; ++t )
+                                {
+                                    int nid = tile_id( t );
+                                    if ( nid == static_cast<int>( pid ) )
+                                        continue;
+
+                                    double dx = x_p - tile_x( t, 0 );
+                                    double dy = y_p - tile_x( t, 1 );
+                                    double dz = z_p - tile_x( t, 2 );
+                                    double dist_sqr =
+                                        dx * dx + dy * dy + dz * dz;
+                                    if ( dist_sqr <= rsqr )
+                                        Impl::functorTagDispatch<work_tag>(
+                                            functor,
+                                            static_cast<index_type>( pid ),
+                                            static_cast<index_type>( nid ) );
+                                }
+                            } );
+                        team.team_barrier();
+                    }
+                }
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( team_policy, cell_func );
+    else
+        Kokkos::parallel_for( str, team_policy, cell_func );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
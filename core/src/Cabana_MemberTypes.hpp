@@ -16,6 +16,9 @@
 #ifndef CABANA_MEMBERTYPES_HPP
 #define CABANA_MEMBERTYPES_HPP
 
+#include <Kokkos_Macros.hpp>
+
+#include <cstdint>
 #include <cstdlib>
 #include <type_traits>
 
@@ -50,6 +53,154 @@ struct is_member_types
 {
 };
 
+//---------------------------------------------------------------------------//
+// Interleaved member storage.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Opt-in interleaved, padded storage for a rank-1 member.
+
+  A member declared Interleaved<T[3]> stores the components of each tuple
+  adjacently, padded to the next power-of-two width, instead of the default
+  layout that strides them by the vector length. All components of a tuple
+  then form one aligned vector-width block (e.g. float[3] pads to a
+  16-byte float4 block) so kernels gathering whole tuples at random
+  indices move each tuple with a single wide memory transaction instead of
+  one scalar transaction per component. The padding increases the member
+  footprint (4/3 for 3-component members) and access to a single component
+  is no longer contiguous across a struct, so the layout is opt-in per
+  member. Slices of interleaved members expose the same access interface
+  as the default layout.
+*/
+template <class T>
+struct Interleaved
+{
+    static_assert( 1 == std::rank<T>::value,
+                   "Interleaved storage requires a rank-1 member type" );
+    //! Member data type.
+    using member_type = T;
+};
+
+//---------------------------------------------------------------------------//
+// Packed bitfield member storage.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Packed bitfield member holding NumBits single-bit flags.
+
+  A member declared PackedBits<NumBits> stores its flags in the smallest
+  unsigned integer that holds the requested number of bits instead of one
+  full integer member per flag. A particle's ownership or status flags
+  then cost one byte (for up to 8 flags) rather than one int each. Slices
+  of a packed bitfield member expose the whole storage word; the static
+  get() and set() helpers manipulate individual flag bits:
+
+  \code
+  using Types = Cabana::MemberTypes<double[3], Cabana::PackedBits<2>>;
+  auto flags = Cabana::slice<1>( aosoa );
+  flags( i ) = Cabana::PackedBits<2>::set( flags( i ), ghost_bit, true );
+  if ( Cabana::PackedBits<2>::get( flags( i ), ghost_bit ) ) ...
+  \endcode
+
+  Prefer iterating owned and ghosted elements as separate index ranges
+  (see ownedPolicy() and ghostPolicy() in Cabana_Halo.hpp) over storing an
+  ownership flag at all - the bitfield is for flags that cannot be encoded
+  in the element order.
+*/
+template <std::size_t NumBits>
+struct PackedBits
+{
+    static_assert( NumBits >= 1 && NumBits <= 64,
+                   "Packed bitfields hold between 1 and 64 bits" );
+
+    //! Smallest unsigned storage type holding the requested bits.
+    using member_type = typename std::conditional<
+        NumBits <= 8, std::uint8_t,
+        typename std::conditional<
+            NumBits <= 16, std::uint16_t,
+            typename std::conditional<NumBits <= 32, std::uint32_t,
+                                      std::uint64_t>::type>::type>::type;
+
+    //! Number of flag bits.
+    static constexpr std::size_t num_bits = NumBits;
+
+    //! Get flag bit \p bit of a packed word.
+    KOKKOS_FORCEINLINE_FUNCTION
+    static bool get( const member_type word, const std::size_t bit )
+    {
+        return ( word >> bit ) & member_type( 1 );
+    }
+
+    //! Return the word with flag bit \p bit set to \p value.
+    KOKKOS_FORCEINLINE_FUNCTION
+    static member_type set( const member_type word, const std::size_t bit,
+                            const bool value )
+    {
+        return value ? ( word | ( member_type( 1 ) << bit ) )
+                     : ( word & ~( member_type( 1 ) << bit ) );
+    }
+};
+
+namespace Impl
+{
+//! \cond Impl
+
+// Strip a storage wrapper from a member type declaration.
+template <class T>
+struct UnwrapMemberType
+{
+    using type = T;
+};
+
+template <class T>
+struct UnwrapMemberType<Interleaved<T>>
+{
+    using type = T;
+};
+
+template <std::size_t NumBits>
+struct UnwrapMemberType<PackedBits<NumBits>>
+{
+    using type = typename PackedBits<NumBits>::member_type;
+};
+
+// Whether a member type declaration requests interleaved storage.
+template <class T>
+struct IsInterleaved : public std::false_type
+{
+};
+
+template <class T>
+struct IsInterleaved<Interleaved<T>> : public std::true_type
+{
+};
+
+// Member data rank and extent through any storage wrapper.
+template <class T>
+struct MemberRank
+    : public std::integral_constant<
+          std::size_t, std::rank<typename UnwrapMemberType<T>::type>::value>
+{
+};
+
+template <class T, std::size_t D>
+struct MemberExtent
+    : public std::integral_constant<
+          std::size_t,
+          std::extent<typename UnwrapMemberType<T>::type, D>::value>
+{
+};
+
+// Smallest power of two not less than the given value. Interleaved members
+// pad their tuple dimension to this width so each tuple's components form
+// an aligned block.
+constexpr std::size_t nextPowerOfTwo( const std::size_t n,
+                                      const std::size_t p = 1 )
+{
+    return ( p >= n ) ? p : nextPowerOfTwo( n, 2 * p );
+}
+
+//! \endcond
+} // end namespace Impl
+
 //---------------------------------------------------------------------------//
 // Get the type of the member at a given index.
 //---------------------------------------------------------------------------//
@@ -78,8 +229,61 @@ struct MemberTypeAtIndex;
 template <std::size_t M, typename... Types>
 struct MemberTypeAtIndex<M, MemberTypes<Types...>>
 {
-    //! Member type.
-    using type = typename MemberTypeAtIndexImpl<M, Types...>::type;
+    //! Member type as declared, including any storage wrapper.
+    using stored_type = typename MemberTypeAtIndexImpl<M, Types...>::type;
+
+    //! Member data type.
+    using type = typename Impl::UnwrapMemberType<stored_type>::type;
+};
+
+//---------------------------------------------------------------------------//
+// Compile-time member index subsetting.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Compile-time list of member indices.
+
+  Selects a subset of an AoSoA's members for communication and copy
+  operations so the packed wire format and the moved bytes cover only the
+  requested members instead of whole tuples.
+*/
+template <std::size_t... M>
+struct MemberIndexList
+{
+    //! Number of selected members.
+    static constexpr std::size_t size = sizeof...( M );
+};
+
+//! \cond Impl
+template <class>
+struct is_member_index_list_impl : public std::false_type
+{
+};
+
+template <std::size_t... M>
+struct is_member_index_list_impl<MemberIndexList<M...>>
+    : public std::true_type
+{
+};
+//! \endcond
+
+//! Static type checker.
+template <class T>
+struct is_member_index_list
+    : public is_member_index_list_impl<typename std::remove_cv<T>::type>::type
+{
+};
+
+//! Get the member types of the subset selected by a member index list.
+template <class Types, class IndexList>
+struct SubsetMemberTypes;
+
+//! Get the member types of the subset selected by a member index list.
+template <typename... Types, std::size_t... M>
+struct SubsetMemberTypes<MemberTypes<Types...>, MemberIndexList<M...>>
+{
+    //! Subset member types in index list order.
+    using type = MemberTypes<
+        typename MemberTypeAtIndex<M, MemberTypes<Types...>>::type...>;
 };
 
 //---------------------------------------------------------------------------//
@@ -92,7 +296,7 @@ struct CheckMemberTypesImpl;
 template <typename T, typename... Types>
 struct CheckMemberTypesImpl<0, T, Types...>
 {
-    using type = T;
+    using type = typename Impl::UnwrapMemberType<T>::type;
     static_assert( std::is_trivial<type>::value,
                    "Member types must be trivial" );
 
@@ -107,7 +311,7 @@ struct CheckMemberTypesImpl<0, T, Types...>
 template <std::size_t M, typename T, typename... Types>
 struct CheckMemberTypesImpl
 {
-    using type = T;
+    using type = typename Impl::UnwrapMemberType<T>::type;
     static_assert( std::is_trivial<type>::value,
                    "Member types must be trivial" );
 
@@ -134,6 +338,57 @@ struct CheckMemberTypes<MemberTypes<Types...>>
         CheckMemberTypesImpl<size - 1, Types...>::value;
 };
 
+//---------------------------------------------------------------------------//
+// Check that two sets of member types are convertible.
+//---------------------------------------------------------------------------//
+//! \cond Impl
+template <typename DstT, typename SrcT>
+struct IsConvertibleMemberType
+{
+    static constexpr bool value =
+        ( std::rank<DstT>::value == std::rank<SrcT>::value ) &&
+        ( std::extent<DstT, 0>::value == std::extent<SrcT, 0>::value ) &&
+        ( std::extent<DstT, 1>::value == std::extent<SrcT, 1>::value ) &&
+        ( std::extent<DstT, 2>::value == std::extent<SrcT, 2>::value ) &&
+        std::is_convertible<typename std::remove_all_extents<SrcT>::type,
+                            typename std::remove_all_extents<DstT>::type>::value;
+};
+
+template <typename DstTypes, typename SrcTypes>
+struct MemberTypesAreConvertibleImpl : public std::false_type
+{
+};
+
+template <>
+struct MemberTypesAreConvertibleImpl<MemberTypes<>, MemberTypes<>>
+    : public std::true_type
+{
+};
+
+template <typename DstT, typename... DstTypes, typename SrcT,
+          typename... SrcTypes>
+struct MemberTypesAreConvertibleImpl<MemberTypes<DstT, DstTypes...>,
+                                     MemberTypes<SrcT, SrcTypes...>>
+{
+    static constexpr bool value =
+        IsConvertibleMemberType<DstT, SrcT>::value &&
+        MemberTypesAreConvertibleImpl<MemberTypes<DstTypes...>,
+                                      MemberTypes<SrcTypes...>>::value;
+};
+//! \endcond
+
+//! Check that two sets of member types have the same shape (rank and
+//! extents) member-by-member with convertible value types, e.g. they differ
+//! only in precision.
+template <typename DstTypes, typename SrcTypes>
+struct MemberTypesAreConvertible
+    : public std::integral_constant<
+          bool, MemberTypesAreConvertibleImpl<
+                    typename std::remove_cv<DstTypes>::type,
+                    typename std::remove_cv<SrcTypes>::type>::value>
+{
+};
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
@@ -0,0 +1,215 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_MemoryPool.hpp
+  \brief Arena allocator for transient device allocations
+*/
+#ifndef CABANA_MEMORYPOOL_HPP
+#define CABANA_MEMORYPOOL_HPP
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_Types.hpp>
+#include <impl/Cabana_PerformanceTraits.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Arena allocator for transient device allocations.
+
+  The pool makes a single large allocation up front and then serves
+  allocations from it with a pointer bump, so repeated creation of temporary
+  containers (e.g. communication buffers or scratch AoSoAs built every time
+  step) does not pay the device allocation latency on each use.
+
+  Allocations are not individually freed. Instead the entire pool is recycled
+  at once with reset(), which invalidates every allocation previously served
+  by the pool. The intended usage is to reset the pool at a point in the
+  application (e.g. the top of a time step) where no transient data from the
+  previous cycle is still alive.
+
+  \tparam DeviceType Device type in which the pool memory will be allocated.
+*/
+template <class DeviceType>
+class MemoryPool
+{
+  public:
+    //! Device type.
+    using device_type = DeviceType;
+
+    //! Memory space.
+    using memory_space = typename device_type::memory_space;
+
+    //! Size type.
+    using size_type = std::size_t;
+
+    //! Alignment of all allocations served by the pool.
+    static constexpr size_type alignment = 256;
+
+    /*!
+      \brief Allocating constructor.
+
+      \param label A label for the pool. This label will be assigned to the
+      underlying Kokkos view holding the pool memory.
+
+      \param capacity_bytes The total number of bytes held by the pool.
+    */
+    MemoryPool( const std::string& label, const size_type capacity_bytes )
+        : _data( Kokkos::ViewAllocateWithoutInitializing( label ),
+                 capacity_bytes )
+        , _offset( 0 )
+        , _high_water_mark( 0 )
+    {
+    }
+
+    /*!
+      \brief Allocate an aligned block of bytes from the pool.
+
+      \param num_bytes The number of bytes to allocate.
+
+      \return Pointer to the allocated block in the pool memory space.
+
+      Throws if the pool does not have enough remaining capacity. The block
+      remains valid until the next call to reset().
+    */
+    void* allocate( const size_type num_bytes )
+    {
+        size_type padded = paddedSize( num_bytes );
+        if ( _offset + padded > capacity() )
+            throw std::runtime_error( "Cabana::MemoryPool exhausted" );
+        void* ptr = _data.data() + _offset;
+        _offset += padded;
+        if ( _offset > _high_water_mark )
+            _high_water_mark = _offset;
+        return ptr;
+    }
+
+    /*!
+      \brief Allocate an unmanaged view of n elements from the pool.
+
+      \tparam T The view value type.
+
+      \param n The number of elements to allocate.
+
+      \return An unmanaged rank-1 view of pool memory.
+    */
+    template <class T>
+    Kokkos::View<T*, device_type, Kokkos::MemoryUnmanaged>
+    allocateView( const size_type n )
+    {
+        return Kokkos::View<T*, device_type, Kokkos::MemoryUnmanaged>(
+            static_cast<T*>( allocate( n * sizeof( T ) ) ), n );
+    }
+
+    /*!
+      \brief Recycle the pool.
+
+      Makes the entire pool capacity available again. All allocations
+      previously served by the pool are invalidated.
+    */
+    void reset() { _offset = 0; }
+
+    //! Total number of bytes held by the pool.
+    size_type capacity() const { return _data.extent( 0 ); }
+
+    //! Number of bytes currently allocated from the pool including
+    //! alignment padding.
+    size_type used() const { return _offset; }
+
+    //! Largest number of bytes ever simultaneously allocated from the pool.
+    //! Useful for sizing the pool capacity.
+    size_type highWaterMark() const { return _high_water_mark; }
+
+  private:
+    // Pad an allocation size to the pool alignment. The pool memory itself
+    // is at least this aligned so aligning the offsets aligns the pointers.
+    static size_type paddedSize( const size_type num_bytes )
+    {
+        return ( ( num_bytes + alignment - 1 ) / alignment ) * alignment;
+    }
+
+    // Pool managed data.
+    Kokkos::View<char*, device_type> _data;
+
+    // Current bump-allocation offset in bytes.
+    size_type _offset;
+
+    // High water mark of the bump-allocation offset in bytes.
+    size_type _high_water_mark;
+};
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+template <class>
+struct is_memory_pool_impl : public std::false_type
+{
+};
+
+template <class DeviceType>
+struct is_memory_pool_impl<MemoryPool<DeviceType>> : public std::true_type
+{
+};
+//! \endcond
+
+//! MemoryPool static type checker.
+template <class T>
+struct is_memory_pool
+    : public is_memory_pool_impl<typename std::remove_cv<T>::type>::type
+{
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create an unmanaged AoSoA drawing its storage from a memory pool.
+
+  \tparam DataTypes AoSoA member types.
+
+  \tparam DeviceType Device type matching the pool.
+
+  \tparam VectorLength AoSoA vector length. If not specified, this defaults
+  to the preferred layout for the <tt>DeviceType</tt>.
+
+  \param pool The pool to allocate from.
+
+  \param n The number of tuples in the container.
+
+  \return An unmanaged AoSoA backed by pool memory. The AoSoA cannot be
+  resized and is valid until the next call to reset() on the pool.
+*/
+template <class DataTypes, class DeviceType,
+          int VectorLength = Impl::PerformanceTraits<
+              typename DeviceType::execution_space>::vector_length>
+AoSoA<DataTypes, DeviceType, VectorLength, Kokkos::MemoryUnmanaged>
+createPoolAoSoA( MemoryPool<DeviceType>& pool, const std::size_t n )
+{
+    using aosoa_type =
+        AoSoA<DataTypes, DeviceType, VectorLength, Kokkos::MemoryUnmanaged>;
+    using soa_type = typename aosoa_type::soa_type;
+    std::size_t num_soa = n / VectorLength;
+    if ( 0 < n % VectorLength )
+        ++num_soa;
+    auto* ptr = static_cast<soa_type*>(
+        pool.allocate( num_soa * sizeof( soa_type ) ) );
+    return aosoa_type( ptr, num_soa, n );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_MEMORYPOOL_HPP
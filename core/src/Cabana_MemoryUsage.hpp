@@ -0,0 +1,157 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_MemoryUsage.hpp
+  \brief Memory usage introspection and aggregate tracking
+*/
+#ifndef CABANA_MEMORYUSAGE_HPP
+#define CABANA_MEMORYUSAGE_HPP
+
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Get the number of bytes allocated by a Cabana data structure.
+
+  \tparam Container Cabana container type providing a \c memoryUsage() member
+  (e.g. AoSoA, VerletList, LinkedCellList, CommunicationPlan).
+
+  \param container The container to query.
+
+  \return The number of bytes of memory the container has allocated,
+  including allocations beyond its current size (e.g. reserved AoSoA
+  capacity or persistent communication buffers). Unmanaged views of user
+  data are not counted.
+*/
+template <class Container>
+std::size_t memoryUsage( const Container& container )
+{
+    return container.memoryUsage();
+}
+
+namespace Impl
+{
+//! \cond Impl
+
+// Registry of tracked memory usage snapshots keyed by name.
+class MemoryRegistry
+{
+  public:
+    static MemoryRegistry& get()
+    {
+        static MemoryRegistry registry;
+        return registry;
+    }
+
+    std::map<std::string, std::size_t> entries;
+
+  private:
+    MemoryRegistry() = default;
+};
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Record the current memory usage of a structure in the aggregate
+  registry under the given name.
+
+  \param name Name identifying the structure in the registry.
+
+  \param container The container to snapshot.
+
+  The registry stores a snapshot of the byte count, not a reference to the
+  structure, so entries stay valid after the structure is destroyed but must
+  be re-recorded after operations that reallocate (e.g. a resize or a list
+  rebuild).
+*/
+template <class Container>
+void trackMemoryUsage( const std::string& name, const Container& container )
+{
+    Impl::MemoryRegistry::get().entries[name] = memoryUsage( container );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Get the recorded memory usage of a tracked structure.
+
+  \param name Name identifying the structure.
+
+  \return The recorded byte count or zero if the name was never tracked.
+*/
+inline std::size_t trackedMemoryUsage( const std::string& name )
+{
+    auto& entries = Impl::MemoryRegistry::get().entries;
+    auto entry = entries.find( name );
+    return ( entry == entries.end() ) ? 0 : entry->second;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Get the sum of all recorded memory usage in the aggregate registry.
+*/
+inline std::size_t totalTrackedMemory()
+{
+    std::size_t total = 0;
+    for ( const auto& entry : Impl::MemoryRegistry::get().entries )
+        total += entry.second;
+    return total;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Remove a structure from the aggregate registry.
+
+  \param name Name identifying the structure.
+*/
+inline void untrackMemoryUsage( const std::string& name )
+{
+    Impl::MemoryRegistry::get().entries.erase( name );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Remove all entries from the aggregate registry.
+*/
+inline void clearTrackedMemory()
+{
+    Impl::MemoryRegistry::get().entries.clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Write a report of all tracked memory usage to a stream.
+
+  \param stream The stream to write to.
+
+  One line per tracked structure with its recorded byte count, followed by
+  the total.
+*/
+inline void memoryReport( std::ostream& stream )
+{
+    stream << "Cabana tracked memory usage\n";
+    for ( const auto& entry : Impl::MemoryRegistry::get().entries )
+        stream << "  " << entry.first << ": " << entry.second << " bytes\n";
+    stream << "  total: " << totalTrackedMemory() << " bytes\n";
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_MEMORYUSAGE_HPP
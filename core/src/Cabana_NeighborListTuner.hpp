@@ -0,0 +1,468 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_NeighborListTuner.hpp
+  \brief Auto-tuned neighbor list backend selection
+*/
+#ifndef CABANA_NEIGHBORLISTTUNER_HPP
+#define CABANA_NEIGHBORLISTTUNER_HPP
+
+#include <CabanaCore_config.hpp>
+
+#include <Cabana_NeighborList.hpp>
+#include <Cabana_Slice.hpp>
+#include <Cabana_VerletList.hpp>
+
+#ifdef Cabana_ENABLE_ARBORX
+#include <Cabana_Experimental_NeighborList.hpp>
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Neighbor list that selects its backend at runtime by timing the
+  candidates on the actual workload.
+
+  The fastest neighbor construction strategy depends on the device and the
+  particle density, so a single binary deployed across architectures cannot
+  commit to one backend at compile time. The tuner times each candidate
+  backend on one of the first build calls - the CSR and 2D Verlet layouts
+  and, when available, the ArborX tree-based list - and once every candidate
+  has built the real workload it locks in the fastest one for all further
+  rebuilds.
+
+  Queries go through the common NeighborList interface and always reflect the
+  backend used by the most recent build, so the list is fully usable during
+  the tuning phase as well.
+*/
+template <class MemorySpace, class AlgorithmTag>
+class TunedNeighborList
+{
+  public:
+    static_assert( Kokkos::is_memory_space<MemorySpace>::value, "" );
+
+    //! Kokkos memory space in which the neighbor list data resides.
+    using memory_space = MemorySpace;
+
+    //! Kokkos default execution space for this memory space.
+    using execution_space = typename memory_space::execution_space;
+
+    //! Verlet list candidate with CSR layout.
+    using verlet_csr_type =
+        VerletList<memory_space, AlgorithmTag, VerletLayoutCSR, TeamOpTag>;
+
+    //! Verlet list candidate with 2D layout.
+    using verlet_2d_type =
+        VerletList<memory_space, AlgorithmTag, VerletLayout2D, TeamOpTag>;
+
+#ifdef Cabana_ENABLE_ARBORX
+    //! ArborX tree-based candidate.
+    using arborx_list_type = Experimental::CrsGraph<memory_space, AlgorithmTag>;
+#endif
+
+    //! Candidate backend identifiers.
+    enum NeighborBackend
+    {
+        //! Verlet list with CSR layout.
+        verlet_csr = 0,
+        //! Verlet list with 2D layout.
+        verlet_2d = 1,
+#ifdef Cabana_ENABLE_ARBORX
+        //! ArborX tree-based list.
+        arborx_csr = 2,
+#endif
+        //! Number of candidate backends.
+        num_backend
+    };
+
+    //! Verlet CSR candidate list.
+    verlet_csr_type _verlet_csr;
+
+    //! Verlet 2D candidate list.
+    verlet_2d_type _verlet_2d;
+
+#ifdef Cabana_ENABLE_ARBORX
+    //! ArborX candidate list.
+    arborx_list_type _arborx;
+#endif
+
+    //! Backend used by the most recent build. Queries dispatch to this
+    //! backend.
+    int _active = verlet_csr;
+
+    //! The locked-in winner. Negative until every candidate has been timed.
+    int _best = -1;
+
+    //! Build time of each candidate in seconds.
+    double _times[num_backend];
+
+    //! Number of candidates timed so far.
+    int _num_timed = 0;
+
+    /*!
+      \brief Default constructor.
+    */
+    TunedNeighborList() {}
+
+    /*!
+      \brief Constructor. Builds the neighbor list with the first candidate
+      backend.
+
+      \param x The slice containing the particle positions.
+
+      \param begin The beginning particle index to compute neighbors for.
+
+      \param end The end particle index to compute neighbors for.
+
+      \param neighborhood_radius The radius of the neighborhood. Particles
+      within this radius are considered neighbors.
+
+      \param cell_size_ratio The ratio of the cell size in the Cartesian grid
+      to the neighborhood radius used by the Verlet candidates.
+
+      \param grid_min The minimum value of the grid containing the particles
+      in each dimension.
+
+      \param grid_max The maximum value of the grid containing the particles
+      in each dimension.
+    */
+    template <class PositionSlice>
+    TunedNeighborList(
+        PositionSlice x, const std::size_t begin, const std::size_t end,
+        const typename PositionSlice::value_type neighborhood_radius,
+        const typename PositionSlice::value_type cell_size_ratio,
+        const typename PositionSlice::value_type grid_min[3],
+        const typename PositionSlice::value_type grid_max[3],
+        typename std::enable_if<( is_slice<PositionSlice>::value ),
+                                int>::type* = 0 )
+    {
+        build( x, begin, end, neighborhood_radius, cell_size_ratio, grid_min,
+               grid_max );
+    }
+
+    /*!
+      \brief Rebuild the neighbor list. While tuning, each call times the
+      next untimed candidate; afterwards the locked-in winner is rebuilt.
+    */
+    template <class PositionSlice>
+    void build( PositionSlice x, const std::size_t begin,
+                const std::size_t end,
+                const typename PositionSlice::value_type neighborhood_radius,
+                const typename PositionSlice::value_type cell_size_ratio,
+                const typename PositionSlice::value_type grid_min[3],
+                const typename PositionSlice::value_type grid_max[3] )
+    {
+        const int backend = ( _best >= 0 ) ? _best : _num_timed;
+
+        // Time the build. The timings are only meaningful for the actual
+        // workload so the candidates are measured on real build calls
+        // rather than on a synthetic problem.
+        Kokkos::fence();
+        Kokkos::Timer timer;
+        buildBackend( backend, x, begin, end, neighborhood_radius,
+                      cell_size_ratio, grid_min, grid_max );
+        Kokkos::fence();
+        const double seconds = timer.seconds();
+
+        _active = backend;
+
+        // Record the time while tuning and lock in the fastest candidate
+        // once all of them have built the workload.
+        if ( _best < 0 )
+        {
+            _times[backend] = seconds;
+            ++_num_timed;
+            if ( _num_timed == num_backend )
+            {
+                _best = 0;
+                for ( int b = 1; b < num_backend; ++b )
+                    if ( _times[b] < _times[_best] )
+                        _best = b;
+            }
+        }
+    }
+
+    //! Whether the tuning phase is finished and a backend is locked in.
+    bool tuned() const { return _best >= 0; }
+
+    //! The backend used by the most recent build.
+    int activeBackend() const { return _active; }
+
+  private:
+    template <class PositionSlice>
+    void buildBackend(
+        const int backend, PositionSlice x, const std::size_t begin,
+        const std::size_t end,
+        const typename PositionSlice::value_type neighborhood_radius,
+        const typename PositionSlice::value_type cell_size_ratio,
+        const typename PositionSlice::value_type grid_min[3],
+        const typename PositionSlice::value_type grid_max[3] )
+    {
+        switch ( backend )
+        {
+#ifdef Cabana_ENABLE_ARBORX
+        case arborx_csr:
+        {
+            using device_type = Kokkos::Device<execution_space, memory_space>;
+            _arborx = Experimental::makeNeighborList<device_type>(
+                AlgorithmTag{}, x, begin, end, neighborhood_radius );
+            break;
+        }
+#endif
+        case verlet_2d:
+            _verlet_2d.build( x, begin, end, neighborhood_radius,
+                              cell_size_ratio, grid_min, grid_max );
+            break;
+        default:
+            _verlet_csr.build( x, begin, end, neighborhood_radius,
+                               cell_size_ratio, grid_min, grid_max );
+            break;
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Neighbor list interface implementation.
+//---------------------------------------------------------------------------//
+//! Tuned neighbor list interface. Dispatches to the active backend.
+template <class MemorySpace, class AlgorithmTag>
+class NeighborList<TunedNeighborList<MemorySpace, AlgorithmTag>>
+{
+  public:
+    //! Neighbor list type.
+    using list_type = TunedNeighborList<MemorySpace, AlgorithmTag>;
+
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+
+    //! Get the number of neighbors for a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t numNeighbor( const list_type& list,
+                                    const std::size_t particle_index )
+    {
+        switch ( list._active )
+        {
+#ifdef Cabana_ENABLE_ARBORX
+        case list_type::arborx_csr:
+            return NeighborList<typename list_type::arborx_list_type>::
+                numNeighbor( list._arborx, particle_index );
+#endif
+        case list_type::verlet_2d:
+            return NeighborList<typename list_type::verlet_2d_type>::
+                numNeighbor( list._verlet_2d, particle_index );
+        default:
+            return NeighborList<typename list_type::verlet_csr_type>::
+                numNeighbor( list._verlet_csr, particle_index );
+        }
+    }
+
+    //! Get the id for a neighbor for a given particle index and the index
+    //! of the neighbor relative to the particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t getNeighbor( const list_type& list,
+                                    const std::size_t particle_index,
+                                    const std::size_t neighbor_index )
+    {
+        switch ( list._active )
+        {
+#ifdef Cabana_ENABLE_ARBORX
+        case list_type::arborx_csr:
+            return NeighborList<typename list_type::arborx_list_type>::
+                getNeighbor( list._arborx, particle_index, neighbor_index );
+#endif
+        case list_type::verlet_2d:
+            return NeighborList<typename list_type::verlet_2d_type>::
+                getNeighbor( list._verlet_2d, particle_index, neighbor_index );
+        default:
+            return NeighborList<typename list_type::verlet_csr_type>::
+                getNeighbor( list._verlet_csr, particle_index,
+                             neighbor_index );
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Online feedback controller for the Verlet list skin radius and cell
+  size ratio.
+
+  The optimal skin and cell size ratio for VerletList::build depend on the
+  system and the machine: a larger skin makes rebuilds less frequent but the
+  list bigger and every force traversal slower, and the best cell size ratio
+  follows the particle density. Choosing them with an offline sweep has to
+  be redone per problem. This controller tunes them online from timings the
+  application already has: feed it the measured time of each list rebuild
+  and of each force traversal and read back the skin and cell size ratio to
+  use for the next build.
+
+  The interval between two rebuilds is one measurement window. When a window
+  closes the controller computes the total time per step - the rebuild cost
+  amortized over the steps it served plus the mean traversal cost - and
+  hill-climbs one parameter at a time: a step that lowered the per-step cost
+  keeps its direction, a step that raised it reverses and shrinks the step
+  factor. When the factor has contracted the search switches to the other
+  parameter, cycling between the two.
+
+  The controller is a host-side object with no collective behavior. In an
+  MPI application each rank may tune independently, or one rank can tune and
+  broadcast if bitwise-identical trajectories across runs matter.
+*/
+template <class Scalar = double>
+class VerletSkinTuner
+{
+  public:
+    /*!
+      \brief Constructor.
+      \param initial_skin Starting skin radius.
+      \param min_skin Smallest skin the controller may choose. Must be large
+      enough that a rebuild is triggered before any particle moves half the
+      skin.
+      \param max_skin Largest skin the controller may choose.
+      \param initial_cell_size_ratio Starting ratio of cell size to
+      neighborhood radius.
+    */
+    VerletSkinTuner( const Scalar initial_skin, const Scalar min_skin,
+                     const Scalar max_skin,
+                     const Scalar initial_cell_size_ratio = 1.0 )
+        : _skin( initial_skin )
+        , _min_skin( min_skin )
+        , _max_skin( max_skin )
+        , _cell_size_ratio( initial_cell_size_ratio )
+    {
+        if ( min_skin > initial_skin || initial_skin > max_skin )
+            throw std::runtime_error( "Initial skin outside of skin bounds" );
+    }
+
+    //! Get the skin radius to use for the next build.
+    Scalar skin() const { return _skin; }
+
+    //! Get the cell size ratio to use for the next build.
+    Scalar cellSizeRatio() const { return _cell_size_ratio; }
+
+    /*!
+      \brief Record a list rebuild.
+
+      Closes the measurement window started by the previous rebuild (if any
+      steps were taken in it) and updates the tuned parameters.
+
+      \param seconds The measured time of the rebuild.
+    */
+    void recordRebuild( const double seconds )
+    {
+        if ( _window_steps > 0 )
+        {
+            double cost = ( _window_rebuild + _window_traversal ) /
+                          static_cast<double>( _window_steps );
+            step( cost );
+        }
+        _window_rebuild = seconds;
+        _window_traversal = 0.0;
+        _window_steps = 0;
+    }
+
+    /*!
+      \brief Record one force traversal over the list.
+      \param seconds The measured time of the traversal.
+    */
+    void recordTraversal( const double seconds )
+    {
+        _window_traversal += seconds;
+        ++_window_steps;
+    }
+
+    //! Get the number of measurement windows closed so far.
+    int numWindow() const { return _num_window; }
+
+    //! Get the per-step cost of the last closed window in seconds.
+    double costPerStep() const { return _last_cost; }
+
+  private:
+    // Hill-climb on the closed window cost.
+    void step( const double cost )
+    {
+        // The first window establishes the baseline - take a step without
+        // judging it.
+        if ( 0 == _num_window )
+        {
+            _last_cost = cost;
+            ++_num_window;
+            apply();
+            return;
+        }
+
+        // A step that raised the cost reverses direction and contracts the
+        // step factor. When the factor has contracted the active parameter
+        // is converged for now - switch to the other one and restart with a
+        // fresh factor.
+        if ( cost > _last_cost )
+        {
+            _direction = -_direction;
+            _factor = std::sqrt( _factor );
+            if ( _factor < 1.02 )
+            {
+                _tune_skin = !_tune_skin;
+                _factor = 1.25;
+            }
+        }
+
+        _last_cost = cost;
+        ++_num_window;
+        apply();
+    }
+
+    // Apply a multiplicative step to the active parameter.
+    void apply()
+    {
+        double factor = ( _direction > 0 ) ? _factor : 1.0 / _factor;
+        if ( _tune_skin )
+            _skin = std::min( _max_skin,
+                              std::max( _min_skin,
+                                        static_cast<Scalar>( _skin * factor ) ) );
+        else
+            _cell_size_ratio = std::min(
+                _max_cell_size_ratio,
+                std::max( _min_cell_size_ratio,
+                          static_cast<Scalar>( _cell_size_ratio * factor ) ) );
+    }
+
+    Scalar _skin;
+    Scalar _min_skin;
+    Scalar _max_skin;
+    Scalar _cell_size_ratio;
+    Scalar _min_cell_size_ratio = 0.25;
+    Scalar _max_cell_size_ratio = 2.0;
+
+    // Open measurement window.
+    double _window_rebuild = 0.0;
+    double _window_traversal = 0.0;
+    int _window_steps = 0;
+
+    // Controller state.
+    bool _tune_skin = true;
+    int _direction = 1;
+    double _factor = 1.25;
+    double _last_cost = 0.0;
+    int _num_window = 0;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_NEIGHBORLISTTUNER_HPP
@@ -18,6 +18,8 @@
 
 #include <Cabana_ExecutionPolicy.hpp>
 #include <Cabana_NeighborList.hpp>
+#include <impl/Cabana_PerformanceTraits.hpp>
+#include <Cabana_Slice.hpp>
 #include <Cabana_Types.hpp> // is_accessible_from
 
 #include <Kokkos_Core.hpp>
@@ -74,6 +76,63 @@ KOKKOS_FORCEINLINE_FUNCTION
     functor( t, std::forward<IndexTypes>( indices )..., reduce_val );
 }
 
+// No work tag was provided so call the active-neighbor version without a
+// tag argument. The functor returns whether the neighbor was active.
+template <class WorkTag, class FunctorType, class... IndexTypes>
+KOKKOS_FORCEINLINE_FUNCTION
+    typename std::enable_if<std::is_same<WorkTag, void>::value, bool>::type
+    functorActiveDispatch( const FunctorType& functor,
+                           IndexTypes&&... indices )
+{
+    return functor( std::forward<IndexTypes>( indices )... );
+}
+
+// The user gave us a tag so call the active-neighbor version using that.
+template <class WorkTag, class FunctorType, class... IndexTypes>
+KOKKOS_FORCEINLINE_FUNCTION
+    typename std::enable_if<!std::is_same<WorkTag, void>::value, bool>::type
+    functorActiveDispatch( const FunctorType& functor,
+                           IndexTypes&&... indices )
+{
+    const WorkTag t{};
+    return functor( t, std::forward<IndexTypes>( indices )... );
+}
+
+// Number of field components in a slice used for symmetric pair
+// accumulation. Scalar fields have a single component.
+template <class SliceType>
+struct SymmetricSumNumComp
+{
+    static constexpr std::size_t value =
+        ( 1 == SliceType::Rank )
+            ? 1
+            : std::extent<typename SliceType::view_wrapper::data_type,
+                          1>::value;
+};
+
+// Add a signed pair contribution to a scalar field slice.
+template <std::size_t NumComp, class SliceType, class IndexType,
+          class ValueType>
+KOKKOS_FORCEINLINE_FUNCTION
+    typename std::enable_if<1 == SliceType::Rank>::type
+    symmetricSumUpdate( const SliceType& sum, const IndexType p,
+                        const ValueType* contrib, const ValueType sign )
+{
+    sum( p ) += sign * contrib[0];
+}
+
+// Add a signed pair contribution to a vector field slice.
+template <std::size_t NumComp, class SliceType, class IndexType,
+          class ValueType>
+KOKKOS_FORCEINLINE_FUNCTION
+    typename std::enable_if<2 == SliceType::Rank>::type
+    symmetricSumUpdate( const SliceType& sum, const IndexType p,
+                        const ValueType* contrib, const ValueType sign )
+{
+    for ( std::size_t d = 0; d < NumComp; ++d )
+        sum( p, d ) += sign * contrib[d];
+}
+
 //! \endcond
 } // end namespace Impl
 
@@ -136,12 +195,24 @@ inline void simd_parallel_for(
     auto simd_func =
         KOKKOS_LAMBDA( const typename team_policy::member_type& team )
     {
-        index_type s = team.league_rank() + exec_policy.structBegin();
+        // Each work item processes a chunk of structs. The policy schedules
+        // the work items dynamically, so with a chunk size of one this is a
+        // struct per work item while larger chunks amortize the scheduling
+        // overhead for kernels with uneven per-struct costs. The structs of a
+        // chunk are distributed over the team threads (a single thread per
+        // team by default) while each struct vectorizes over the array index.
         Kokkos::parallel_for(
-            Kokkos::ThreadVectorRange( team, exec_policy.arrayBegin( s ),
-                                       exec_policy.arrayEnd( s ) ),
-            [&]( const index_type a ) {
-                Impl::functorTagDispatch<work_tag>( functor, s, a );
+            Kokkos::TeamThreadRange(
+                team, exec_policy.chunkStructBegin( team.league_rank() ),
+                exec_policy.chunkStructEnd( team.league_rank() ) ),
+            [&]( const index_type s ) {
+                Kokkos::parallel_for(
+                    Kokkos::ThreadVectorRange( team,
+                                               exec_policy.arrayBegin( s ),
+                                               exec_policy.arrayEnd( s ) ),
+                    [&]( const index_type a ) {
+                        Impl::functorTagDispatch<work_tag>( functor, s, a );
+                    } );
             } );
     };
     if ( str.empty() )
@@ -152,6 +223,183 @@ inline void simd_parallel_for(
             str, dynamic_cast<const team_policy&>( exec_policy ), simd_func );
 }
 
+//---------------------------------------------------------------------------//
+// SIMD Parallel Reduce
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a vectorized functor reduction in parallel with a 2d
+  execution policy.
+
+  \tparam FunctorType The functor type to execute.
+
+  \tparam VectorLength The length of the vector over which to execute the
+  vectorized code.
+
+  \tparam ReduceType The reduction type.
+
+  \tparam ExecParameters Execution policy parameters.
+
+  \param exec_policy The 2D range policy over which to execute the functor.
+
+  \param functor The vectorized functor to execute in parallel. Must accept
+  both a struct and array index along with the reduction value.
+
+  \param reduce_val Scalar to be reduced across all indices. The reduction
+  is a sum.
+
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_reduce called by this code and can be used for
+  identification and profiling purposes.
+
+  The functor has the signature of a \c simd_parallel_for functor with the
+  reduction value appended:
+
+  \code
+  class FunctorType {
+  public:
+  typedef  ...  execution_space ;
+  void operator() ( const int struct, const int array, double& sum ) const ;
+  };
+  \endcode
+
+  The inner reduction over the array index is vectorized just like the inner
+  loop of \c simd_parallel_for, so slice sums (kinetic energy, momentum,
+  diagnostics) keep the vector-length-aware access pattern instead of
+  falling back to a flat 1D reduction.
+
+  \note The work tag gets applied at the user functor level, not at the level
+  of the functor in this implementation that wraps the user functor.
+*/
+template <class FunctorType, int VectorLength, class ReduceType,
+          class... ExecParameters>
+inline void simd_parallel_reduce(
+    const SimdPolicy<VectorLength, ExecParameters...>& exec_policy,
+    const FunctorType& functor, ReduceType& reduce_val,
+    const std::string& str = "" )
+{
+    using simd_policy = SimdPolicy<VectorLength, ExecParameters...>;
+
+    using work_tag = typename simd_policy::work_tag;
+
+    using team_policy = typename simd_policy::base_type;
+
+    using index_type = typename team_policy::index_type;
+
+    auto simd_func = KOKKOS_LAMBDA(
+        const typename team_policy::member_type& team, ReduceType& ival )
+    {
+        ReduceType team_sum = 0;
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(
+                team, exec_policy.chunkStructBegin( team.league_rank() ),
+                exec_policy.chunkStructEnd( team.league_rank() ) ),
+            [&]( const index_type s, ReduceType& sval ) {
+                ReduceType reduce_s = 0;
+                Kokkos::parallel_reduce(
+                    Kokkos::ThreadVectorRange( team,
+                                               exec_policy.arrayBegin( s ),
+                                               exec_policy.arrayEnd( s ) ),
+                    [&]( const index_type a, ReduceType& aval ) {
+                        Impl::functorTagDispatch<work_tag>( functor, s, a,
+                                                            aval );
+                    },
+                    reduce_s );
+                Kokkos::single( Kokkos::PerThread( team ),
+                                [&]() { sval += reduce_s; } );
+            },
+            team_sum );
+        Kokkos::single( Kokkos::PerTeam( team ),
+                        [&]() { ival += team_sum; } );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_reduce( dynamic_cast<const team_policy&>( exec_policy ),
+                                 simd_func, reduce_val );
+    else
+        Kokkos::parallel_reduce( str,
+                                 dynamic_cast<const team_policy&>( exec_policy ),
+                                 simd_func, reduce_val );
+}
+
+//---------------------------------------------------------------------------//
+// Fused SIMD kernels.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Functor applying two functors in order to every index.
+
+  \tparam FunctorA The first functor type.
+
+  \tparam FunctorB The second functor type.
+
+  Building block of \c fuseFunctors. Passing a composition to a single
+  \c simd_parallel_for call executes a sequence of small slice-updating
+  kernels (e.g. the stages of a time integrator) while streaming the
+  particle data through memory once, where separate calls would re-read and
+  re-write it once per kernel. All composed functors must share the same
+  index signature; with a work tag in the policy the tag is forwarded to
+  every functor.
+*/
+template <class FunctorA, class FunctorB>
+struct FusedFunctor
+{
+    //! The first functor.
+    FunctorA _a;
+    //! The second functor.
+    FunctorB _b;
+
+    //! Construct from the two functors to apply in order.
+    FusedFunctor( const FunctorA& a, const FunctorB& b )
+        : _a( a )
+        , _b( b )
+    {
+    }
+
+    //! Apply both functors in order to the given indices.
+    template <class... IndexTypes>
+    KOKKOS_FORCEINLINE_FUNCTION void
+    operator()( IndexTypes&&... indices ) const
+    {
+        _a( indices... );
+        _b( std::forward<IndexTypes>( indices )... );
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Compose two functors into a single functor applying them in order.
+
+  \param a The first functor to apply.
+
+  \param b The second functor to apply.
+
+  \return A functor applying both given functors in order to every index.
+*/
+template <class FunctorA, class FunctorB>
+FusedFunctor<FunctorA, FunctorB> fuseFunctors( const FunctorA& a,
+                                               const FunctorB& b )
+{
+    return FusedFunctor<FunctorA, FunctorB>( a, b );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Compose functors into a single functor applying them in order.
+
+  \param a The first functor to apply.
+
+  \param b The second functor to apply.
+
+  \param functors The remaining functors to apply in the given order.
+
+  \return A functor applying each given functor in order to every index.
+*/
+template <class FunctorA, class FunctorB, class... FunctorTypes>
+auto fuseFunctors( const FunctorA& a, const FunctorB& b,
+                   const FunctorTypes&... functors )
+{
+    return fuseFunctors( FusedFunctor<FunctorA, FunctorB>( a, b ),
+                         functors... );
+}
+
 //---------------------------------------------------------------------------//
 // Neighbor Parallel For
 //---------------------------------------------------------------------------//
@@ -182,6 +430,13 @@ class TeamVectorOpTag
 {
 };
 
+//! Neighbor operations are executed cooperatively across vector lanes in
+//! vector-length chunks and the neighbor loop exits once an entire chunk is
+//! inactive. The functor returns whether its neighbor was active.
+class TeamVectorEarlyExitOpTag
+{
+};
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Execute functor in parallel according to the execution policy over
@@ -240,7 +495,7 @@ inline void neighbor_parallel_for(
     auto begin = exec_policy.begin();
     auto end = exec_policy.end();
     using linear_policy_type = Kokkos::RangePolicy<execution_space, void, void>;
-    linear_policy_type linear_exec_policy( begin, end );
+    linear_policy_type linear_exec_policy( exec_policy.space(), begin, end );
 
     static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
 
@@ -300,7 +555,7 @@ inline void neighbor_parallel_for(
     auto begin = exec_policy.begin();
     auto end = exec_policy.end();
     using linear_policy_type = Kokkos::RangePolicy<execution_space, void, void>;
-    linear_policy_type linear_exec_policy( begin, end );
+    linear_policy_type linear_exec_policy( exec_policy.space(), begin, end );
 
     static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
 
@@ -359,7 +614,8 @@ inline void neighbor_parallel_for(
 
     using kokkos_policy =
         Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
-    kokkos_policy team_policy( exec_policy.end() - exec_policy.begin(),
+    kokkos_policy team_policy( exec_policy.space(),
+                               exec_policy.end() - exec_policy.begin(),
                                Kokkos::AUTO );
 
     using index_type = typename kokkos_policy::index_type;
@@ -426,7 +682,8 @@ inline void neighbor_parallel_for(
 
     using kokkos_policy =
         Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
-    kokkos_policy team_policy( exec_policy.end() - exec_policy.begin(),
+    kokkos_policy team_policy( exec_policy.space(),
+                               exec_policy.end() - exec_policy.begin(),
                                Kokkos::AUTO );
 
     using index_type = typename kokkos_policy::index_type;
@@ -499,7 +756,8 @@ inline void neighbor_parallel_for(
 
     using kokkos_policy =
         Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
-    kokkos_policy team_policy( exec_policy.end() - exec_policy.begin(),
+    kokkos_policy team_policy( exec_policy.space(),
+                               exec_policy.end() - exec_policy.begin(),
                                Kokkos::AUTO );
 
     using index_type = typename kokkos_policy::index_type;
@@ -538,6 +796,312 @@ inline void neighbor_parallel_for(
         Kokkos::parallel_for( str, team_policy, neigh_func );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor in parallel according to the execution policy over
+  particles with cooperative vector-lane loops over particle first neighbors
+  that exit early once all lanes go inactive.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam NeighborListType The neighbor list type.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor.
+  \param functor The functor to execute in parallel. Returns whether its
+  neighbor was active (e.g. within the cutoff):
+
+  \code
+  bool operator() ( const int i, const int j ) const ;
+  \endcode
+
+  \param list The neighbor list over which to execute the neighbor operations.
+  \param FirstNeighborsTag Tag indicating operations over particle first
+  neighbors.
+  \param TeamVectorEarlyExitOpTag Tag indicating a cooperative vector-lane
+  loop strategy over neighbors with early exit.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+
+  Neighbors are processed in vector-length chunks: each chunk assigns one
+  neighbor per vector lane and reduces the lane activity across the chunk,
+  which compiles to a warp ballot on GPU hardware. Once a whole chunk is
+  inactive the remaining neighbors of the particle are skipped. This pays off
+  when the neighbors of each particle are sorted by distance so the neighbors
+  beyond the cutoff cluster at the end of the row; on unsorted lists it
+  degenerates to the full loop plus the reduction overhead.
+*/
+template <class FunctorType, class NeighborListType, class... ExecParameters>
+inline void neighbor_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const NeighborListType& list,
+    const FirstNeighborsTag, const TeamVectorEarlyExitOpTag,
+    const std::string& str = "" )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    // One thread per team with the preferred vector length of the space so
+    // the chunk activity count reduces within a single warp on GPU hardware.
+    constexpr int vector_length =
+        Impl::PerformanceTraits<execution_space>::vector_length;
+
+    using kokkos_policy =
+        Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+    kokkos_policy team_policy( exec_policy.space(),
+                               exec_policy.end() - exec_policy.begin(), 1,
+                               vector_length );
+
+    using index_type = typename kokkos_policy::index_type;
+
+    using neighbor_list_traits = NeighborList<NeighborListType>;
+
+    using memory_space = typename neighbor_list_traits::memory_space;
+
+    static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
+
+    const auto range_begin = exec_policy.begin();
+
+    auto neigh_func =
+        KOKKOS_LAMBDA( const typename kokkos_policy::member_type& team )
+    {
+        index_type i = team.league_rank() + range_begin;
+
+        const index_type nn = neighbor_list_traits::numNeighbor( list, i );
+        for ( index_type c = 0; c < nn; c += vector_length )
+        {
+            const index_type c_end =
+                ( c + vector_length < nn ) ? c + vector_length : nn;
+            int num_active = 0;
+            Kokkos::parallel_reduce(
+                Kokkos::ThreadVectorRange( team, c, c_end ),
+                [&]( const index_type n, int& active ) {
+                    if ( Impl::functorActiveDispatch<work_tag>(
+                             functor, i,
+                             static_cast<index_type>(
+                                 neighbor_list_traits::getNeighbor( list, i,
+                                                                    n ) ) ) )
+                        ++active;
+                },
+                num_active );
+            if ( 0 == num_active )
+                break;
+        }
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( team_policy, neigh_func );
+    else
+        Kokkos::parallel_for( str, team_policy, neigh_func );
+}
+
+//---------------------------------------------------------------------------//
+// Symmetric Neighbor Parallel For
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a pair functor in parallel with a thread-local serial loop
+  over particle first neighbors, accumulating the pair contribution
+  symmetrically to both particles.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam NeighborListType The neighbor list type.
+  \tparam SliceType The slice type receiving the accumulated contributions.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor.
+  \param functor The functor to execute in parallel
+  \param list The neighbor list over which to execute the neighbor operations.
+  \param sum The slice into which pair contributions are accumulated.
+  \param FirstNeighborsTag Tag indicating operations over particle first
+  neighbors.
+  \param SerialOpTag Tag indicating a serial loop strategy over neighbors.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+
+  Unlike neighbor_parallel_for, the functor computes the contribution of the
+  pair rather than updating particle data directly:
+
+  \code
+  void operator() ( const int i, const int j, double f_ij[] ) const ;
+  \endcode
+
+  On return from the functor each component of \c f_ij (zero-initialized, with
+  as many components as the sum slice field) is added to particle \c i and
+  subtracted from particle \c j, consistent with Newton's third law for pair
+  forces. The neighbor side of each pair may be written by many threads
+  concurrently and is updated through an atomic access slice; the owned side
+  is accumulated in thread-private storage and written once per particle.
+
+  This is intended for use with half neighbor lists (e.g. a VerletList built
+  with HalfNeighborTag) where each pair is stored only once, halving the
+  number of functor evaluations relative to a full list. With a full list
+  every pair would be accumulated twice.
+*/
+template <class FunctorType, class NeighborListType, class SliceType,
+          class... ExecParameters>
+inline void symmetric_neighbor_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const NeighborListType& list,
+    const SliceType& sum, const FirstNeighborsTag, const SerialOpTag,
+    const std::string& str = "" )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using index_type =
+        typename Kokkos::RangePolicy<ExecParameters...>::index_type;
+
+    using neighbor_list_traits = NeighborList<NeighborListType>;
+
+    using memory_space = typename neighbor_list_traits::memory_space;
+
+    using value_type = typename SliceType::value_type;
+
+    static_assert( SliceType::Rank <= 2,
+                   "Symmetric accumulation supports scalar and vector slice "
+                   "fields" );
+    constexpr std::size_t num_comp = Impl::SymmetricSumNumComp<SliceType>::value;
+
+    auto begin = exec_policy.begin();
+    auto end = exec_policy.end();
+    using linear_policy_type = Kokkos::RangePolicy<execution_space, void, void>;
+    linear_policy_type linear_exec_policy( exec_policy.space(), begin, end );
+
+    static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
+
+    // Each particle is owned by a single thread so its own side of the pair
+    // accumulates in registers. The neighbor side may belong to any thread
+    // and is updated atomically.
+    typename SliceType::atomic_access_slice sum_atomic = sum;
+
+    auto neigh_func = KOKKOS_LAMBDA( const index_type i )
+    {
+        value_type sum_i[num_comp];
+        for ( std::size_t d = 0; d < num_comp; ++d )
+            sum_i[d] = 0;
+
+        for ( index_type n = 0;
+              n < neighbor_list_traits::numNeighbor( list, i ); ++n )
+        {
+            const index_type j = static_cast<index_type>(
+                neighbor_list_traits::getNeighbor( list, i, n ) );
+
+            value_type f_ij[num_comp];
+            for ( std::size_t d = 0; d < num_comp; ++d )
+                f_ij[d] = 0;
+            Impl::functorTagDispatch<work_tag>( functor, i, j, f_ij );
+
+            for ( std::size_t d = 0; d < num_comp; ++d )
+                sum_i[d] += f_ij[d];
+            Impl::symmetricSumUpdate<num_comp>( sum_atomic, j, f_ij,
+                                                value_type( -1 ) );
+        }
+
+        Impl::symmetricSumUpdate<num_comp>( sum, i, sum_i, value_type( 1 ) );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( linear_exec_policy, neigh_func );
+    else
+        Kokkos::parallel_for( str, linear_exec_policy, neigh_func );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a pair functor in parallel with team parallelism over
+  particle first neighbors, accumulating the pair contribution symmetrically
+  to both particles.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam NeighborListType The neighbor list type.
+  \tparam SliceType The slice type receiving the accumulated contributions.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor.
+  \param functor The functor to execute in parallel
+  \param list The neighbor list over which to execute the neighbor operations.
+  \param sum The slice into which pair contributions are accumulated.
+  \param FirstNeighborsTag Tag indicating operations over particle first
+  neighbors.
+  \param TeamOpTag Tag indicating a team parallel strategy over neighbors.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+
+  See the SerialOpTag overload for the pair functor interface and the
+  symmetric accumulation semantics. With team parallelism the neighbors of a
+  particle are distributed over the team so both sides of each pair are
+  updated through an atomic access slice.
+*/
+template <class FunctorType, class NeighborListType, class SliceType,
+          class... ExecParameters>
+inline void symmetric_neighbor_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const NeighborListType& list,
+    const SliceType& sum, const FirstNeighborsTag, const TeamOpTag,
+    const std::string& str = "" )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using kokkos_policy =
+        Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+    kokkos_policy team_policy( exec_policy.space(),
+                               exec_policy.end() - exec_policy.begin(),
+                               Kokkos::AUTO );
+
+    using index_type = typename kokkos_policy::index_type;
+
+    using neighbor_list_traits = NeighborList<NeighborListType>;
+
+    using memory_space = typename neighbor_list_traits::memory_space;
+
+    using value_type = typename SliceType::value_type;
+
+    static_assert( SliceType::Rank <= 2,
+                   "Symmetric accumulation supports scalar and vector slice "
+                   "fields" );
+    constexpr std::size_t num_comp = Impl::SymmetricSumNumComp<SliceType>::value;
+
+    static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
+
+    typename SliceType::atomic_access_slice sum_atomic = sum;
+
+    const auto range_begin = exec_policy.begin();
+
+    auto neigh_func =
+        KOKKOS_LAMBDA( const typename kokkos_policy::member_type& team )
+    {
+        index_type i = team.league_rank() + range_begin;
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(
+                team, neighbor_list_traits::numNeighbor( list, i ) ),
+            [&]( const index_type n ) {
+                const index_type j = static_cast<index_type>(
+                    neighbor_list_traits::getNeighbor( list, i, n ) );
+
+                value_type f_ij[num_comp];
+                for ( std::size_t d = 0; d < num_comp; ++d )
+                    f_ij[d] = 0;
+                Impl::functorTagDispatch<work_tag>( functor, i, j, f_ij );
+
+                Impl::symmetricSumUpdate<num_comp>( sum_atomic, i, f_ij,
+                                                    value_type( 1 ) );
+                Impl::symmetricSumUpdate<num_comp>( sum_atomic, j, f_ij,
+                                                    value_type( -1 ) );
+            } );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( team_policy, neigh_func );
+    else
+        Kokkos::parallel_for( str, team_policy, neigh_func );
+}
+
 //---------------------------------------------------------------------------//
 // Neighbor Parallel Reduce
 //---------------------------------------------------------------------------//
@@ -603,7 +1167,7 @@ inline void neighbor_parallel_reduce(
     auto begin = exec_policy.begin();
     auto end = exec_policy.end();
     using linear_policy_type = Kokkos::RangePolicy<execution_space, void, void>;
-    linear_policy_type linear_exec_policy( begin, end );
+    linear_policy_type linear_exec_policy( exec_policy.space(), begin, end );
 
     static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
 
@@ -669,7 +1233,7 @@ inline void neighbor_parallel_reduce(
     auto begin = exec_policy.begin();
     auto end = exec_policy.end();
     using linear_policy_type = Kokkos::RangePolicy<execution_space, void, void>;
-    linear_policy_type linear_exec_policy( begin, end );
+    linear_policy_type linear_exec_policy( exec_policy.space(), begin, end );
 
     static_assert( is_accessible_from<memory_space, execution_space>{}, "" );
 
@@ -734,7 +1298,8 @@ inline void neighbor_parallel_reduce(
 
     using kokkos_policy =
         Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
-    kokkos_policy team_policy( exec_policy.end() - exec_policy.begin(),
+    kokkos_policy team_policy( exec_policy.space(),
+                               exec_policy.end() - exec_policy.begin(),
                                Kokkos::AUTO );
 
     using index_type = typename kokkos_policy::index_type;
@@ -810,7 +1375,8 @@ inline void neighbor_parallel_reduce(
 
     using kokkos_policy =
         Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
-    kokkos_policy team_policy( exec_policy.end() - exec_policy.begin(),
+    kokkos_policy team_policy( exec_policy.space(),
+                               exec_policy.end() - exec_policy.begin(),
                                Kokkos::AUTO );
 
     using index_type = typename kokkos_policy::index_type;
@@ -891,7 +1457,8 @@ inline void neighbor_parallel_reduce(
 
     using kokkos_policy =
         Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
-    kokkos_policy team_policy( exec_policy.end() - exec_policy.begin(),
+    kokkos_policy team_policy( exec_policy.space(),
+                               exec_policy.end() - exec_policy.begin(),
                                Kokkos::AUTO );
 
     using index_type = typename kokkos_policy::index_type;
@@ -938,6 +1505,182 @@ inline void neighbor_parallel_reduce(
         Kokkos::parallel_reduce( str, team_policy, neigh_reduce, reduce_val );
 }
 
+//---------------------------------------------------------------------------//
+// Hybrid host-device dispatch.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute a vectorized functor in parallel split between a device and
+  a host execution space.
+
+  \tparam VectorLength The length of the vector over which to execute the
+  vectorized code.
+
+  \tparam DeviceExecSpace The execution space for the leading partition.
+
+  \tparam HostExecSpace The execution space for the trailing partition.
+
+  \tparam FunctorType The functor type to execute.
+
+  \param split The fractional split of the range between the two spaces.
+
+  \param begin The beginning of the 1D range.
+
+  \param end The end of the 1D range.
+
+  \param functor The vectorized functor to execute in parallel. Must accept
+  both a struct and array index.
+
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for calls made by this code and can be used for
+  identification and profiling purposes.
+
+  The device partition [begin,split) is launched asynchronously and the host
+  partition [split,end) executes on the calling thread concurrently with it;
+  the call returns once both have completed. The split is rounded down to a
+  struct boundary so no struct is written by both spaces. All data accessed
+  by the functor must be accessible from both execution spaces (a shared or
+  host-pinned memory space). On nodes where host and device share the
+  physical address space this recovers the host cores that would otherwise
+  idle during the device kernel; calibrate the split with
+  \c HybridSplit::update() from measured partition times.
+*/
+template <int VectorLength, class DeviceExecSpace, class HostExecSpace,
+          class FunctorType>
+inline void hybrid_simd_parallel_for( const HybridSplit& split,
+                                      const std::size_t begin,
+                                      const std::size_t end,
+                                      const FunctorType& functor,
+                                      const std::string& str = "" )
+{
+    const std::size_t middle = split.splitIndex( begin, end, VectorLength );
+    DeviceExecSpace device_space;
+    if ( middle > begin )
+        simd_parallel_for(
+            SimdPolicy<VectorLength, DeviceExecSpace>( begin, middle ),
+            functor, str );
+    if ( middle < end )
+        simd_parallel_for(
+            SimdPolicy<VectorLength, HostExecSpace>( middle, end ), functor,
+            str );
+    device_space.fence();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor in parallel over particle first neighbors with the
+  particle range split between a device and a host execution space.
+
+  \tparam DeviceExecSpace The execution space for the leading partition.
+
+  \tparam HostExecSpace The execution space for the trailing partition.
+
+  \tparam FunctorType The functor type to execute.
+
+  \tparam NeighborListType The neighbor list type.
+
+  \param split The fractional split of the range between the two spaces.
+
+  \param begin The beginning particle index.
+
+  \param end The end particle index.
+
+  \param functor The functor to execute in parallel.
+
+  \param list The neighbor list over which to execute the neighbor
+  operations.
+
+  \param FirstNeighborsTag Tag indicating operations over particle first
+  neighbors.
+
+  \param SerialOpTag Tag indicating a serial loop strategy over neighbors.
+
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for calls made by this code and can be used for
+  identification and profiling purposes.
+
+  The device partition [begin,split) is launched asynchronously and the host
+  partition [split,end) executes on the calling thread concurrently with it;
+  the call returns once both have completed. The neighbor list and all data
+  accessed by the functor must be accessible from both execution spaces.
+*/
+template <class DeviceExecSpace, class HostExecSpace, class FunctorType,
+          class NeighborListType>
+inline void hybrid_neighbor_parallel_for(
+    const HybridSplit& split, const std::size_t begin, const std::size_t end,
+    const FunctorType& functor, const NeighborListType& list,
+    const FirstNeighborsTag, const SerialOpTag, const std::string& str = "" )
+{
+    const std::size_t middle = split.splitIndex( begin, end );
+    DeviceExecSpace device_space;
+    if ( middle > begin )
+        neighbor_parallel_for(
+            Kokkos::RangePolicy<DeviceExecSpace>( device_space, begin,
+                                                  middle ),
+            functor, list, FirstNeighborsTag(), SerialOpTag(), str );
+    if ( middle < end )
+        neighbor_parallel_for( Kokkos::RangePolicy<HostExecSpace>( middle,
+                                                                   end ),
+                               functor, list, FirstNeighborsTag(),
+                               SerialOpTag(), str );
+    device_space.fence();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor in parallel over particle first neighbors with team
+  parallelism over neighbors and the particle range split between a device
+  and a host execution space.
+
+  \tparam DeviceExecSpace The execution space for the leading partition.
+
+  \tparam HostExecSpace The execution space for the trailing partition.
+
+  \tparam FunctorType The functor type to execute.
+
+  \tparam NeighborListType The neighbor list type.
+
+  \param split The fractional split of the range between the two spaces.
+
+  \param begin The beginning particle index.
+
+  \param end The end particle index.
+
+  \param functor The functor to execute in parallel.
+
+  \param list The neighbor list over which to execute the neighbor
+  operations.
+
+  \param FirstNeighborsTag Tag indicating operations over particle first
+  neighbors.
+
+  \param TeamOpTag Tag indicating a team parallel strategy over neighbors.
+
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for calls made by this code and can be used for
+  identification and profiling purposes.
+*/
+template <class DeviceExecSpace, class HostExecSpace, class FunctorType,
+          class NeighborListType>
+inline void hybrid_neighbor_parallel_for(
+    const HybridSplit& split, const std::size_t begin, const std::size_t end,
+    const FunctorType& functor, const NeighborListType& list,
+    const FirstNeighborsTag, const TeamOpTag, const std::string& str = "" )
+{
+    const std::size_t middle = split.splitIndex( begin, end );
+    DeviceExecSpace device_space;
+    if ( middle > begin )
+        neighbor_parallel_for(
+            Kokkos::RangePolicy<DeviceExecSpace>( device_space, begin,
+                                                  middle ),
+            functor, list, FirstNeighborsTag(), TeamOpTag(), str );
+    if ( middle < end )
+        neighbor_parallel_for( Kokkos::RangePolicy<HostExecSpace>( middle,
+                                                                   end ),
+                               functor, list, FirstNeighborsTag(), TeamOpTag(),
+                               str );
+    device_space.fence();
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Execute functor in serial within existing parallel kernel over particle
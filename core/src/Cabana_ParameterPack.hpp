@@ -193,6 +193,197 @@ ParameterPack<Types...> makeParameterPack( const Types&... ts )
     return pp;
 }
 
+//---------------------------------------------------------------------------//
+// Device-resident parameter pack with in-place update.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Parameter pack in persistent device storage with in-place update.
+
+  Per-step scalar parameters (timestep, field strength, ramped
+  coefficients) change every step, and refreshing them by rebuilding a
+  ParameterPack re-captures it in fresh functors - re-instantiating the
+  capture object and moving the whole pack host-to-device for every
+  kernel. A device pack stores one ParameterPack in a persistent device
+  allocation. Kernels capture the pack handle once (copying it is a
+  shallow view copy) and read the current values through get(); a per-step
+  refresh is a single small update() copy into the same allocation with no
+  functor rebuild. The values read by a kernel are the values of the last
+  update() submitted before it in the execution space instance.
+
+  \tparam MemorySpace Kokkos memory space in which the parameters are
+  stored.
+
+  \tparam Types The parameter types. All elements must be copyable to
+  device.
+*/
+template <class MemorySpace, typename... Types>
+struct DeviceParameterPack
+{
+    //! Packed parameter type.
+    using pack_type = ParameterPack<Types...>;
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+
+    //! Packed type.
+    template <std::size_t N>
+    using value_type = typename pack_type::template value_type<N>;
+
+    //! Pack size.
+    static constexpr std::size_t size = pack_type::size;
+
+    //! Persistent device storage of the pack.
+    Kokkos::View<pack_type, MemorySpace> _device;
+    //! Host staging copy of the pack.
+    typename Kokkos::View<pack_type, MemorySpace>::HostMirror _host;
+
+    //! Constructor. Allocates the storage and sets the initial values.
+    DeviceParameterPack( const Types&... ts )
+        : _device( Kokkos::ViewAllocateWithoutInitializing(
+              "device_parameter_pack" ) )
+        , _host( Kokkos::create_mirror_view( _device ) )
+    {
+        update( ts... );
+    }
+
+    /*!
+      \brief Update the parameter values in place.
+
+      Synchronous - the new values are visible to any kernel launched
+      after this call returns.
+    */
+    void update( const Types&... ts )
+    {
+        fillParameterPack( _host(), ts... );
+        Kokkos::deep_copy( _device, _host );
+    }
+
+    /*!
+      \brief Asynchronously update the parameter values in place.
+
+      The copy is enqueued on the given execution space instance so it
+      orders with the kernels submitted on it without a fence.
+    */
+    template <class ExecutionSpace>
+    void update( const ExecutionSpace& exec_space, const Types&... ts )
+    {
+        fillParameterPack( _host(), ts... );
+        Kokkos::deep_copy( exec_space, _device, _host );
+    }
+
+    //! Access the stored pack. Device-callable in the pack's memory space.
+    KOKKOS_FORCEINLINE_FUNCTION
+    const pack_type& pack() const { return _device(); }
+};
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+template <class>
+struct is_device_parameter_pack_impl : public std::false_type
+{
+};
+
+template <class MemorySpace, typename... Types>
+struct is_device_parameter_pack_impl<DeviceParameterPack<MemorySpace, Types...>>
+    : public std::true_type
+{
+};
+//! \endcond
+
+//! DeviceParameterPack static type checker.
+template <class T>
+struct is_device_parameter_pack
+    : public is_device_parameter_pack_impl<
+          typename std::remove_cv<T>::type>::type
+{
+};
+
+//---------------------------------------------------------------------------//
+//! Get an element from a device-resident parameter pack.
+template <std::size_t N, class DevicePack_t>
+KOKKOS_FORCEINLINE_FUNCTION typename std::enable_if<
+    is_device_parameter_pack<DevicePack_t>::value,
+    const typename DevicePack_t::template value_type<N>&>::type
+get( const DevicePack_t& dpp )
+{
+    return get<N>( dpp.pack() );
+}
+
+//---------------------------------------------------------------------------//
+//! Create a device-resident parameter pack in the given memory space.
+template <class MemorySpace, typename... Types>
+DeviceParameterPack<MemorySpace, Types...>
+makeDeviceParameterPack( const Types&... ts )
+{
+    return DeviceParameterPack<MemorySpace, Types...>( ts... );
+}
+
+//---------------------------------------------------------------------------//
+// Read-only parameter binding.
+//---------------------------------------------------------------------------//
+/*!
+  \brief Read-only binding of a parameter view.
+
+  Parameter tables (e.g. tabulated force-field coefficients indexed per pair
+  type) are written once on the host and then only read inside kernels, but
+  a plain view gives the compiler no way to know that. The read-only binding
+  re-types the view with const data and the RandomAccess, Restrict, and
+  Aligned memory traits: const RandomAccess data is routed through the
+  read-only cache path on GPU hardware (texture loads on NVIDIA, the scalar
+  cache on AMD), Restrict asserts the table does not alias the particle data
+  written by the kernel, and Aligned asserts the Kokkos allocation
+  alignment. The binding aliases the original allocation - no data is
+  copied.
+
+  \tparam ViewType The view type being bound. Must be a Kokkos::View.
+*/
+template <class ViewType>
+struct ReadOnlyView
+{
+    static_assert( Kokkos::is_view<ViewType>::value,
+                   "Read-only binding requires a Kokkos::View" );
+
+    //! Read-only view type.
+    using type =
+        Kokkos::View<typename ViewType::const_data_type,
+                     typename ViewType::array_layout,
+                     typename ViewType::device_type,
+                     Kokkos::MemoryTraits<Kokkos::RandomAccess |
+                                          Kokkos::Restrict | Kokkos::Aligned>>;
+};
+
+/*!
+  \brief Create a read-only binding of a parameter view.
+
+  \param view The view of kernel parameters to bind. Must be the full view
+  of a Kokkos allocation - subviews may violate the alignment assertion.
+
+  \return A view of the same data with the read-only access traits.
+*/
+template <class ViewType>
+typename ReadOnlyView<ViewType>::type makeReadOnlyView( const ViewType& view )
+{
+    return view;
+}
+
+/*!
+  \brief Create a parameter pack of read-only bindings of parameter views.
+
+  Packs the read-only binding of each view so a kernel captures the whole
+  parameter table set with the fast read path in one object:
+
+  \code
+  auto params = Cabana::makeReadOnlyParameterPack( epsilon, sigma );
+  ...
+  auto eps = Cabana::get<0>( params );
+  \endcode
+*/
+template <typename... Types>
+ParameterPack<typename ReadOnlyView<Types>::type...>
+makeReadOnlyParameterPack( const Types&... ts )
+{
+    return makeParameterPack( makeReadOnlyView( ts )... );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
@@ -0,0 +1,183 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_PinnedBufferPool.hpp
+  \brief Pooled pinned host allocations for staging device communication
+  buffers.
+*/
+#ifndef CABANA_PINNEDBUFFERPOOL_HPP
+#define CABANA_PINNEDBUFFERPOOL_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+#if defined( OPEN_MPI )
+#include <mpi-ext.h>
+#endif
+
+#include <cstddef>
+#include <vector>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Host memory space used for staging device communication buffers.
+
+  When a device backend is enabled this is the backend's page-locked host
+  space so staging copies run at full PCIe bandwidth and may be issued
+  asynchronously. On host-only builds it is the regular host space.
+*/
+#if defined( KOKKOS_ENABLE_CUDA )
+using PinnedHostSpace = Kokkos::CudaHostPinnedSpace;
+#elif defined( KOKKOS_ENABLE_HIP )
+using PinnedHostSpace = Kokkos::Experimental::HIPHostPinnedSpace;
+#else
+using PinnedHostSpace = Kokkos::HostSpace;
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Pool of pinned host staging buffers.
+
+  Pinning host pages is expensive so allocations are recycled: checkout()
+  returns the smallest free buffer large enough for the request, allocating
+  a new one only when none fits, and release() returns a buffer to the pool
+  for reuse. Checked-out buffers hold uninitialized data.
+
+  The pool is a host-side object and is not thread safe. Communication
+  plans own a pool shared between copies of the plan so repeated exchanges
+  reuse the same pinned pages.
+*/
+class PinnedBufferPool
+{
+  public:
+    //! Pooled allocation type.
+    using buffer_type = Kokkos::View<char*, PinnedHostSpace>;
+
+    /*!
+      \brief Check out a pinned buffer of at least the given size.
+      \param bytes Minimum buffer size in bytes.
+      \return A pinned allocation of at least the requested size.
+    */
+    buffer_type checkout( const std::size_t bytes )
+    {
+        auto best = _free.end();
+        for ( auto it = _free.begin(); it != _free.end(); ++it )
+            if ( it->extent( 0 ) >= bytes &&
+                 ( best == _free.end() ||
+                   it->extent( 0 ) < best->extent( 0 ) ) )
+                best = it;
+        if ( best != _free.end() )
+        {
+            auto buffer = *best;
+            _free.erase( best );
+            return buffer;
+        }
+        return buffer_type(
+            Kokkos::ViewAllocateWithoutInitializing( "pinned_stage" ),
+            bytes );
+    }
+
+    /*!
+      \brief Return a buffer to the pool for reuse.
+      \param buffer A buffer obtained from checkout().
+    */
+    void release( const buffer_type& buffer ) { _free.push_back( buffer ); }
+
+    //! Get the number of free buffers in the pool.
+    std::size_t numFree() const { return _free.size(); }
+
+    //! Release all pooled allocations.
+    void clear() { _free.clear(); }
+
+  private:
+    std::vector<buffer_type> _free;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Pinned host mirror of a device communication buffer backed by a
+  pool allocation.
+
+  Provides an unmanaged host view with the shape and layout of the given
+  device view over a buffer checked out from the pool. The buffer is
+  returned to the pool when the mirror is destroyed.
+*/
+template <class ViewType>
+struct PinnedMirror
+{
+    //! Buffer value type.
+    using value_type = typename ViewType::value_type;
+    //! Unmanaged pinned host view type.
+    using mirror_type =
+        Kokkos::View<typename ViewType::non_const_data_type,
+                     typename ViewType::array_layout, PinnedHostSpace,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    /*!
+      \brief Constructor.
+      \param pool The pool to draw the staging allocation from.
+      \param data The device view to mirror. Only the shape is used - no
+      data is copied.
+    */
+    PinnedMirror( PinnedBufferPool& pool, const ViewType& data )
+        : _pool( pool )
+        , _buffer( pool.checkout( data.span() * sizeof( value_type ) ) )
+    {
+        view = mirror_type( reinterpret_cast<value_type*>( _buffer.data() ),
+                            data.layout() );
+    }
+
+    ~PinnedMirror() { _pool.release( _buffer ); }
+
+    PinnedMirror( const PinnedMirror& ) = delete;
+    PinnedMirror& operator=( const PinnedMirror& ) = delete;
+
+    //! Typed host mirror over the pooled pinned allocation.
+    mirror_type view;
+
+  private:
+    PinnedBufferPool& _pool;
+    PinnedBufferPool::buffer_type _buffer;
+};
+
+//---------------------------------------------------------------------------//
+namespace Impl
+{
+//! \cond Impl
+
+// Chunk size in bytes for pipelining device-to-host staging copies with
+// sends. Large enough to saturate PCIe per copy, small enough that the
+// first send starts early.
+constexpr std::size_t pinned_staging_chunk_bytes = 1 << 22;
+
+// Whether the MPI library reports that it can operate on device-resident
+// buffers. Note that not all GPU-aware MPI libraries advertise the
+// capability.
+inline bool gpuAwareMpiSupported()
+{
+#if defined( MPIX_CUDA_AWARE_SUPPORT )
+    return ( 1 == MPIX_Query_cuda_support() );
+#elif defined( MPIX_ROCM_AWARE_SUPPORT )
+    return ( 1 == MPIX_Query_rocm_support() );
+#else
+    return false;
+#endif
+}
+
+//! \endcond
+} // end namespace Impl
+
+} // end namespace Cabana
+
+#endif // end CABANA_PINNEDBUFFERPOOL_HPP
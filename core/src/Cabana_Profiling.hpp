@@ -0,0 +1,145 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Profiling.hpp
+  \brief Named profiling regions and a lightweight runtime counter registry
+*/
+#ifndef CABANA_PROFILING_HPP
+#define CABANA_PROFILING_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Cabana
+{
+namespace Profiling
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Scoped Kokkos profiling region.
+
+  Pushes the named region on construction and pops it on destruction so the
+  communication waits, buffer management, and kernel launches inside a
+  library call are attributed to one named span in profiler traces.
+*/
+class ScopedRegion
+{
+  public:
+    //! Push the named region.
+    ScopedRegion( const std::string& name )
+    {
+        Kokkos::Profiling::pushRegion( name );
+    }
+
+    //! Pop the region.
+    ~ScopedRegion() { Kokkos::Profiling::popRegion(); }
+
+    ScopedRegion( const ScopedRegion& ) = delete;
+    ScopedRegion& operator=( const ScopedRegion& ) = delete;
+};
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+
+// Process-wide counter storage. Counters are only accumulated from host
+// code around kernel launches and communication calls so a plain map behind
+// an enable flag keeps the disabled cost to a single branch.
+struct CounterRegistry
+{
+    bool enabled = false;
+    std::unordered_map<std::string, unsigned long long> counters;
+
+    static CounterRegistry& get()
+    {
+        static CounterRegistry registry;
+        return registry;
+    }
+};
+
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Enable or disable counter accumulation. Counters are disabled by
+  default and cost a single branch per instrumentation site when disabled.
+*/
+inline void enableCounters( const bool enabled )
+{
+    Impl::CounterRegistry::get().enabled = enabled;
+}
+
+//! \brief Whether counter accumulation is enabled.
+inline bool countersEnabled() { return Impl::CounterRegistry::get().enabled; }
+
+/*!
+  \brief Add to a named counter. No-op when counters are disabled. Not
+  thread safe - call from the thread driving the library.
+*/
+inline void addCounter( const std::string& name,
+                        const unsigned long long value )
+{
+    auto& registry = Impl::CounterRegistry::get();
+    if ( registry.enabled )
+        registry.counters[name] += value;
+}
+
+/*!
+  \brief Record the maximum of a named counter and the given value. No-op
+  when counters are disabled. Not thread safe - call from the thread driving
+  the library.
+*/
+inline void maxCounter( const std::string& name,
+                        const unsigned long long value )
+{
+    auto& registry = Impl::CounterRegistry::get();
+    if ( registry.enabled )
+    {
+        auto& counter = registry.counters[name];
+        if ( value > counter )
+            counter = value;
+    }
+}
+
+//! \brief Get the value of a named counter. Unknown names return zero.
+inline unsigned long long counterValue( const std::string& name )
+{
+    const auto& counters = Impl::CounterRegistry::get().counters;
+    auto iter = counters.find( name );
+    return ( iter != counters.end() ) ? iter->second : 0;
+}
+
+//! \brief Get the names of all counters that have accumulated a value.
+inline std::vector<std::string> counterNames()
+{
+    const auto& counters = Impl::CounterRegistry::get().counters;
+    std::vector<std::string> names;
+    names.reserve( counters.size() );
+    for ( const auto& c : counters )
+        names.push_back( c.first );
+    return names;
+}
+
+//! \brief Reset all counters to zero.
+inline void resetCounters() { Impl::CounterRegistry::get().counters.clear(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Profiling
+} // end namespace Cabana
+
+#endif // end CABANA_PROFILING_HPP
@@ -0,0 +1,230 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Random.hpp
+  \brief Counter-based per-particle random streams stored in particle data
+*/
+#ifndef CABANA_RANDOM_HPP
+#define CABANA_RANDOM_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+#include <cstdint>
+
+namespace Cabana
+{
+namespace Impl
+{
+//! \cond Impl
+
+// One round of the Philox 4x32 bijection.
+KOKKOS_INLINE_FUNCTION
+void philoxRound( uint32_t& c0, uint32_t& c1, uint32_t& c2, uint32_t& c3,
+                  const uint32_t k0, const uint32_t k1 )
+{
+    const uint64_t p0 = static_cast<uint64_t>( 0xD2511F53 ) * c0;
+    const uint64_t p1 = static_cast<uint64_t>( 0xCD9E8D57 ) * c2;
+    const uint32_t hi0 = static_cast<uint32_t>( p0 >> 32 );
+    const uint32_t lo0 = static_cast<uint32_t>( p0 );
+    const uint32_t hi1 = static_cast<uint32_t>( p1 >> 32 );
+    const uint32_t lo1 = static_cast<uint32_t>( p1 );
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+}
+
+// Philox 4x32-10: 128 random bits from a 64-bit stream key and a 64-bit
+// draw counter. A pure function of its inputs - no generator state beyond
+// the two integers.
+KOKKOS_INLINE_FUNCTION
+void philox( const uint64_t key, const uint64_t counter, uint32_t block[4] )
+{
+    uint32_t k0 = static_cast<uint32_t>( key );
+    uint32_t k1 = static_cast<uint32_t>( key >> 32 );
+    block[0] = static_cast<uint32_t>( counter );
+    block[1] = static_cast<uint32_t>( counter >> 32 );
+    block[2] = 0;
+    block[3] = 0;
+    for ( int r = 0; r < 10; ++r )
+    {
+        philoxRound( block[0], block[1], block[2], block[3], k0, k1 );
+        k0 += 0x9E3779B9;
+        k1 += 0xBB67AE85;
+    }
+}
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Counter-based random stream with state held in two integers.
+
+  Stateful generators (e.g. a Kokkos random pool) keep their state out-of-band
+  from the particles that use it, so streams must be re-wired by hand after
+  every migration and state loads stride away from the particle data. This
+  generator is counter-based instead: every draw is a Philox hash of a
+  per-particle stream key and a per-particle draw counter, so the complete
+  state is two integers that live in ordinary particle members - streams
+  survive migration and sorting with the particle, and draws are branchless
+  so they vectorize inside SIMD loops.
+
+  Intended use: add two uint64_t fields to the particle MemberTypes, seed
+  them once with createRandomStreams(), construct a CounterRandom from the
+  slices at the top of a kernel with getRandom(), and write the counter back
+  with saveRandom() when done so the next kernel continues the stream.
+*/
+struct CounterRandom
+{
+    //! Stream key. Identifies the stream - constant over the particle life.
+    uint64_t key;
+    //! Draw counter. Incremented by each draw.
+    uint64_t counter;
+
+    //! Construct from a key/counter pair.
+    KOKKOS_INLINE_FUNCTION
+    CounterRandom( const uint64_t key_, const uint64_t counter_ )
+        : key( key_ )
+        , counter( counter_ )
+    {
+    }
+
+    //! Draw 64 uniform random bits.
+    KOKKOS_INLINE_FUNCTION
+    uint64_t urand64()
+    {
+        uint32_t block[4];
+        Impl::philox( key, counter++, block );
+        return ( static_cast<uint64_t>( block[1] ) << 32 ) | block[0];
+    }
+
+    //! Draw a uniform double in [0,1).
+    KOKKOS_INLINE_FUNCTION
+    double drand()
+    {
+        // 53 random bits scaled by 2^-53.
+        return ( urand64() >> 11 ) * ( 1.0 / 9007199254740992.0 );
+    }
+
+    //! Draw a uniform double in [low,high).
+    KOKKOS_INLINE_FUNCTION
+    double drand( const double low, const double high )
+    {
+        return low + drand() * ( high - low );
+    }
+
+    //! Draw a uniform float in [0,1).
+    KOKKOS_INLINE_FUNCTION
+    float frand()
+    {
+        // 24 random bits scaled by 2^-24.
+        return ( urand64() >> 40 ) * ( 1.0f / 16777216.0f );
+    }
+
+    //! Draw a uniform float in [low,high).
+    KOKKOS_INLINE_FUNCTION
+    float frand( const float low, const float high )
+    {
+        return low + frand() * ( high - low );
+    }
+
+    //! Draw a standard normal double via the Box-Muller transform.
+    KOKKOS_INLINE_FUNCTION
+    double normal()
+    {
+        // Shift the first uniform into (0,1] so the log is finite.
+        const double u1 = 1.0 - drand();
+        const double u2 = drand();
+        const double pi = 3.14159265358979323846;
+        return sqrt( -2.0 * log( u1 ) ) * cos( 2.0 * pi * u2 );
+    }
+
+    //! Draw a normal double with the given mean and standard deviation.
+    KOKKOS_INLINE_FUNCTION
+    double normal( const double mean, const double stddev )
+    {
+        return mean + stddev * normal();
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Load the random stream of a particle from its state slices.
+
+  \param keys Slice of uint64_t stream keys.
+  \param counters Slice of uint64_t draw counters.
+  \param p The particle index.
+  \return The particle stream positioned at its next draw.
+*/
+template <class KeySliceType, class CounterSliceType>
+KOKKOS_INLINE_FUNCTION CounterRandom getRandom( const KeySliceType& keys,
+                                                const CounterSliceType& counters,
+                                                const int p )
+{
+    return CounterRandom( keys( p ), counters( p ) );
+}
+
+/*!
+  \brief Write the stream position of a particle back to its state slice.
+
+  Only the counter advances during a kernel so only the counter is written.
+
+  \param rand The particle stream after its draws.
+  \param counters Slice of uint64_t draw counters.
+  \param p The particle index.
+*/
+template <class CounterSliceType>
+KOKKOS_INLINE_FUNCTION void saveRandom( const CounterRandom& rand,
+                                        const CounterSliceType& counters,
+                                        const int p )
+{
+    counters( p ) = rand.counter;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Seed a unique random stream for every particle.
+
+  Every particle gets a key hashed from the seed and its global index so
+  streams are distinct across particles and across ranks, and reproducible
+  for a given seed regardless of the decomposition. Counters start at zero.
+
+  \param exec_space An execution space instance.
+  \param keys Slice of uint64_t stream keys to seed.
+  \param counters Slice of uint64_t draw counters to reset.
+  \param seed The simulation seed.
+  \param global_offset The global index of the first local particle.
+*/
+template <class ExecutionSpace, class KeySliceType, class CounterSliceType>
+void createRandomStreams( const ExecutionSpace& exec_space,
+                          KeySliceType& keys, CounterSliceType& counters,
+                          const uint64_t seed,
+                          const uint64_t global_offset = 0 )
+{
+    Kokkos::parallel_for(
+        "Cabana::createRandomStreams",
+        Kokkos::RangePolicy<ExecutionSpace>( exec_space, 0, keys.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            uint32_t block[4];
+            Impl::philox( seed, global_offset + p, block );
+            keys( p ) = ( static_cast<uint64_t>( block[1] ) << 32 ) | block[0];
+            counters( p ) = 0;
+        } );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_RANDOM_HPP
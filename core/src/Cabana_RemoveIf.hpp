@@ -0,0 +1,157 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_RemoveIf.hpp
+  \brief Stream compaction of AoSoA particle data
+*/
+#ifndef CABANA_REMOVEIF_HPP
+#define CABANA_REMOVEIF_HPP
+
+#include <Cabana_AoSoA.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdlib>
+#include <type_traits>
+
+namespace Cabana
+{
+namespace Impl
+{
+//! \cond Impl
+//---------------------------------------------------------------------------//
+// Compact an AoSoA, keeping the tuples for which the given device-callable
+// operator returns true and preserving their relative order. The surviving
+// tuples are gathered contiguously in the final pass of a single scan and
+// then written back, so the only temporary is a tuple scratch view.
+template <class AoSoA_t, class KeepOp,
+          class DeviceType = typename AoSoA_t::device_type>
+std::size_t compactAoSoA( AoSoA_t& aosoa, const KeepOp& keep_op )
+{
+    using execution_space = typename DeviceType::execution_space;
+
+    std::size_t n = aosoa.size();
+    Kokkos::View<typename AoSoA_t::tuple_type*, DeviceType> scratch_tuples(
+        Kokkos::ViewAllocateWithoutInitializing( "scratch_tuples" ), n );
+
+    // Compact the surviving tuples into the scratch view. The scan value of
+    // a surviving tuple is the count of survivors before it - exactly its
+    // destination in the compacted layout.
+    std::size_t num_keep = 0;
+    auto compact_op = KOKKOS_LAMBDA( const std::size_t i, std::size_t& update,
+                                     const bool final_pass )
+    {
+        if ( keep_op( i ) )
+        {
+            if ( final_pass )
+                scratch_tuples( update ) = aosoa.getTuple( i );
+            ++update;
+        }
+    };
+    Kokkos::parallel_scan( "Cabana::removeIf::compact_op",
+                           Kokkos::RangePolicy<execution_space>( 0, n ),
+                           compact_op, num_keep );
+    Kokkos::fence();
+
+    // Write the survivors back and drop the removed tuples.
+    auto copy_back = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        aosoa.setTuple( i, scratch_tuples( i ) );
+    };
+    Kokkos::parallel_for( "Cabana::removeIf::copy_back",
+                          Kokkos::RangePolicy<execution_space>( 0, num_keep ),
+                          copy_back );
+    Kokkos::fence();
+    aosoa.resize( num_keep );
+
+    return num_keep;
+}
+//! \endcond
+
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Remove the tuples matching a predicate from an AoSoA.
+
+  \tparam AoSoA_t The AoSoA type.
+
+  \tparam Predicate The predicate type.
+
+  \param aosoa The AoSoA to compact. The container is resized to the number
+  of remaining tuples, so slices taken before this call must be re-taken.
+
+  \param predicate Device-callable operator returning true for the index of
+  every tuple to remove:
+
+  \code
+  bool operator() ( const std::size_t i ) const ;
+  \endcode
+
+  \return The number of remaining tuples.
+
+  The relative order of the remaining tuples is preserved. The compaction is
+  a single scan over the container with the tuple gather fused into its
+  final pass, replacing the separate mark, prefix-sum, and copy kernels
+  applications would otherwise run before deleting particles.
+*/
+template <class AoSoA_t, class Predicate>
+std::size_t
+remove_if( AoSoA_t& aosoa, const Predicate& predicate,
+           typename std::enable_if<( is_aosoa<AoSoA_t>::value &&
+                                     !Kokkos::is_view<Predicate>::value ),
+                                   int>::type* = 0 )
+{
+    auto keep_op = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        return !predicate( i );
+    };
+    return Impl::compactAoSoA( aosoa, keep_op );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Remove the tuples not flagged for keeping from an AoSoA.
+
+  \tparam AoSoA_t The AoSoA type.
+
+  \tparam KeepViewType The Kokkos::View type for the keep flags.
+
+  \param aosoa The AoSoA to compact. The container is resized to the number
+  of remaining tuples, so slices taken before this call must be re-taken.
+
+  \param keep_flags View with one flag per tuple. Tuples with a non-zero
+  flag are kept; the rest are removed.
+
+  \return The number of remaining tuples.
+
+  The relative order of the remaining tuples is preserved.
+*/
+template <class AoSoA_t, class KeepViewType>
+std::size_t
+remove_if( AoSoA_t& aosoa, const KeepViewType& keep_flags,
+           typename std::enable_if<( is_aosoa<AoSoA_t>::value &&
+                                     Kokkos::is_view<KeepViewType>::value ),
+                                   int>::type* = 0 )
+{
+    auto keep_op = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        return keep_flags( i ) != 0;
+    };
+    return Impl::compactAoSoA( aosoa, keep_op );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_REMOVEIF_HPP
@@ -0,0 +1,312 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_ScatterSlice.hpp
+  \brief Duplicated scatter-add accumulation into a slice
+*/
+#ifndef CABANA_SCATTERSLICE_HPP
+#define CABANA_SCATTERSLICE_HPP
+
+#include <Cabana_Slice.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ScatterView.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+//---------------------------------------------------------------------------//
+// Device-side accumulation handle of a scatter slice. Maps the member
+// component indices onto the flat scatter storage and returns the scatter
+// view element proxy so += and -= contribute without collisions.
+template <class ScatterAccessType, std::size_t MemberRank>
+struct ScatterSliceAccess
+{
+    // Scatter access handle over the flat component storage.
+    ScatterAccessType _access;
+
+    // Inner component extents.
+    int _d1;
+    int _d2;
+
+    // Access a rank-0 member element.
+    template <std::size_t R = MemberRank,
+              typename std::enable_if<0 == R, int>::type = 0>
+    KOKKOS_FORCEINLINE_FUNCTION auto operator()( const std::size_t i ) const
+    {
+        return _access( i, 0 );
+    }
+
+    // Access a rank-1 member element.
+    template <std::size_t R = MemberRank,
+              typename std::enable_if<1 == R, int>::type = 0>
+    KOKKOS_FORCEINLINE_FUNCTION auto operator()( const std::size_t i,
+                                                 const int d0 ) const
+    {
+        return _access( i, d0 );
+    }
+
+    // Access a rank-2 member element.
+    template <std::size_t R = MemberRank,
+              typename std::enable_if<2 == R, int>::type = 0>
+    KOKKOS_FORCEINLINE_FUNCTION auto
+    operator()( const std::size_t i, const int d0, const int d1 ) const
+    {
+        return _access( i, d1 + _d1 * d0 );
+    }
+
+    // Access a rank-3 member element.
+    template <std::size_t R = MemberRank,
+              typename std::enable_if<3 == R, int>::type = 0>
+    KOKKOS_FORCEINLINE_FUNCTION auto operator()( const std::size_t i,
+                                                 const int d0, const int d1,
+                                                 const int d2 ) const
+    {
+        return _access( i, d2 + _d2 * ( d1 + _d1 * d0 ) );
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Add the contributed flat component storage into a rank-0 member slice.
+template <class SliceType, class ViewType>
+typename std::enable_if<1 == SliceType::Rank>::type
+scatterSliceContribute( const SliceType& slice, const ViewType& flat )
+{
+    Kokkos::parallel_for(
+        "Cabana::ScatterSlice::contribute",
+        Kokkos::RangePolicy<typename SliceType::execution_space>(
+            0, slice.size() ),
+        KOKKOS_LAMBDA( const int i ) { slice( i ) += flat( i, 0 ); } );
+}
+
+// Add the contributed flat component storage into a rank-1 member slice.
+template <class SliceType, class ViewType>
+typename std::enable_if<2 == SliceType::Rank>::type
+scatterSliceContribute( const SliceType& slice, const ViewType& flat )
+{
+    int e0 = slice.extent( 2 );
+    Kokkos::parallel_for(
+        "Cabana::ScatterSlice::contribute",
+        Kokkos::RangePolicy<typename SliceType::execution_space>(
+            0, slice.size() ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d0 = 0; d0 < e0; ++d0 )
+                slice( i, d0 ) += flat( i, d0 );
+        } );
+}
+
+// Add the contributed flat component storage into a rank-2 member slice.
+template <class SliceType, class ViewType>
+typename std::enable_if<3 == SliceType::Rank>::type
+scatterSliceContribute( const SliceType& slice, const ViewType& flat )
+{
+    int e0 = slice.extent( 2 );
+    int e1 = slice.extent( 3 );
+    Kokkos::parallel_for(
+        "Cabana::ScatterSlice::contribute",
+        Kokkos::RangePolicy<typename SliceType::execution_space>(
+            0, slice.size() ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d0 = 0; d0 < e0; ++d0 )
+                for ( int d1 = 0; d1 < e1; ++d1 )
+                    slice( i, d0, d1 ) += flat( i, d1 + e1 * d0 );
+        } );
+}
+
+// Add the contributed flat component storage into a rank-3 member slice.
+template <class SliceType, class ViewType>
+typename std::enable_if<4 == SliceType::Rank>::type
+scatterSliceContribute( const SliceType& slice, const ViewType& flat )
+{
+    int e0 = slice.extent( 2 );
+    int e1 = slice.extent( 3 );
+    int e2 = slice.extent( 4 );
+    Kokkos::parallel_for(
+        "Cabana::ScatterSlice::contribute",
+        Kokkos::RangePolicy<typename SliceType::execution_space>(
+            0, slice.size() ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d0 = 0; d0 < e0; ++d0 )
+                for ( int d1 = 0; d1 < e1; ++d1 )
+                    for ( int d2 = 0; d2 < e2; ++d2 )
+                        slice( i, d0, d1, d2 ) +=
+                            flat( i, d2 + e2 * ( d1 + e1 * d0 ) );
+        } );
+}
+
+//---------------------------------------------------------------------------//
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Duplicated scatter-add accumulation into a slice.
+
+  \tparam SliceType The slice type into which contributions are
+  accumulated.
+
+  Wraps a slice with a Kokkos::Experimental::ScatterView so scattered
+  accumulation kernels (e.g. half neighbor list force sums) get the
+  platform-appropriate contribution strategy for free: per-thread
+  duplicated buffers with a tree reduction on host backends where atomics
+  serialize, and hardware atomics on device backends where duplication
+  would exhaust memory. The atomic memory access trait of the slice gives
+  only the latter.
+
+  Kernels call access() on a by-value copy of the scatter slice and
+  accumulate into the returned handle with the member indexing of the
+  slice itself:
+
+  \code
+     auto scatter_f = makeScatterSlice( f );
+     Kokkos::parallel_for( ..., KOKKOS_LAMBDA( const int i ) {
+         auto f_data = scatter_f.access();
+         for ( int d = 0; d < 3; ++d )
+             f_data( i, d ) += ...;
+     } );
+     scatter_f.contribute();
+  \endcode
+
+  Contributions land in flat scatter storage owned by this class;
+  contribute() folds them into the wrapped slice and resets the storage so
+  the scatter slice may be reused in a later step. The wrapped data is
+  unchanged until contribute() is called. The scatter slice does not
+  extend the lifetime of the slice data - the AoSoA it came from must
+  outlive it - and must be recreated if the AoSoA is resized.
+*/
+template <class SliceType>
+class ScatterSlice
+{
+  public:
+    //! Slice type.
+    using slice_type = SliceType;
+
+    //! Memory space.
+    using memory_space = typename slice_type::memory_space;
+
+    //! Execution space.
+    using execution_space = typename slice_type::execution_space;
+
+    //! Value type.
+    using value_type = typename slice_type::value_type;
+
+    //! Size type.
+    using size_type = typename slice_type::size_type;
+
+    //! Member rank.
+    static constexpr std::size_t member_rank =
+        static_cast<std::size_t>( SliceType::Rank ) - 1;
+
+    //! Flat contribution storage type (tuple index, linearized component).
+    using flat_view = Kokkos::View<value_type**, memory_space>;
+
+    //! Scatter view type over the flat contribution storage.
+    using scatter_view = decltype( Kokkos::Experimental::create_scatter_view(
+        std::declval<flat_view>() ) );
+
+    //! Device-side accumulation handle type.
+    using access_type =
+        Impl::ScatterSliceAccess<decltype( std::declval<scatter_view>()
+                                               .access() ),
+                                 member_rank>;
+
+    /*!
+      \brief Constructor.
+      \param slice The slice into which contributions will be accumulated.
+    */
+    ScatterSlice( const SliceType& slice )
+        : _slice( slice )
+    {
+        int num_comp = 1;
+        for ( std::size_t d = 0; d < member_rank; ++d )
+            num_comp *= slice.extent( d + 2 );
+        _d1 = ( member_rank > 1 ) ? slice.extent( 3 ) : 1;
+        _d2 = ( member_rank > 2 ) ? slice.extent( 4 ) : 1;
+        _flat = flat_view( std::string( slice.label() ) + "_scatter",
+                           slice.size(), num_comp );
+        _scatter = Kokkos::Experimental::create_scatter_view( _flat );
+    }
+
+    //! Get the number of tuples.
+    KOKKOS_FORCEINLINE_FUNCTION
+    size_type size() const { return _slice.size(); }
+
+    /*!
+      \brief Get an accumulation handle for use within a kernel.
+      \return A handle accepting the member indexing of the slice and
+      returning a scatter element proxy to accumulate into.
+    */
+    KOKKOS_FORCEINLINE_FUNCTION
+    access_type access() const { return access_type{ _scatter.access(), _d1, _d2 }; }
+
+    /*!
+      \brief Fold all accumulated contributions into the wrapped slice.
+
+      Reduces the duplicated buffers, adds the result to the current slice
+      values, and resets the scatter storage so the scatter slice can be
+      reused. Must be called from the host after the contributing kernels
+      complete.
+    */
+    void contribute()
+    {
+        Kokkos::Experimental::contribute( _flat, _scatter );
+        Impl::scatterSliceContribute( _slice, _flat );
+        Kokkos::deep_copy( _flat, value_type( 0 ) );
+        _scatter.reset();
+    }
+
+  private:
+    // The slice contributions are accumulated into.
+    SliceType _slice;
+
+    // Flat contribution storage.
+    flat_view _flat;
+
+    // Scatter view managing the duplicated buffers over the flat storage.
+    scatter_view _scatter;
+
+    // Inner component extents.
+    int _d1;
+    int _d2;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a scatter slice over a slice.
+  \param slice The slice into which contributions will be accumulated.
+  \return A ScatterSlice accumulating into the slice.
+*/
+template <typename DataType, typename DeviceType, typename MemoryAccessType,
+          int VectorLength, int Stride>
+auto makeScatterSlice( const Slice<DataType, DeviceType, MemoryAccessType,
+                                   VectorLength, Stride>& slice )
+    -> ScatterSlice<
+        Slice<DataType, DeviceType, MemoryAccessType, VectorLength, Stride>>
+{
+    return ScatterSlice<
+        Slice<DataType, DeviceType, MemoryAccessType, VectorLength, Stride>>(
+        slice );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_SCATTERSLICE_HPP
@@ -16,6 +16,7 @@
 #ifndef CABANA_SLICE_HPP
 #define CABANA_SLICE_HPP
 
+#include <Cabana_MemberTypes.hpp>
 #include <Cabana_Types.hpp>
 #include <impl/Cabana_Index.hpp>
 #include <impl/Cabana_TypeTraits.hpp>
@@ -23,9 +24,15 @@
 #include <Kokkos_Core.hpp>
 
 #include <cstdlib>
+#include <cstring>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 
+#if defined( __SSE2__ ) && !defined( __clang__ )
+#include <emmintrin.h>
+#endif
+
 //---------------------------------------------------------------------------//
 namespace Kokkos
 {
@@ -84,6 +91,54 @@ struct LayoutCabanaSlice
     }
 };
 
+//---------------------------------------------------------------------------//
+//! Cabana slice layout for interleaved members. The components of each
+//! tuple are adjacent in memory and padded to the given width.
+template <int SOASTRIDE, int VLEN, int DIM0, int PAD>
+struct LayoutCabanaSliceInterleaved
+{
+    //! Slice array layout.
+    typedef LayoutCabanaSliceInterleaved array_layout;
+    //! Slice is extent constructible.
+    enum
+    {
+        is_extent_constructible = true
+    };
+
+    //! Slice SoA stride.
+    static constexpr int Stride = SOASTRIDE;
+    //! Slice vectorlength.
+    static constexpr int VectorLength = VLEN;
+    //! Slice zeroth dimension size.
+    static constexpr int D0 = DIM0;
+    //! Padded zeroth dimension size.
+    static constexpr int Pad = PAD;
+
+    //! Slice dimension.
+    size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+    //! Const copy constructor.
+    LayoutCabanaSliceInterleaved( LayoutCabanaSliceInterleaved const& ) =
+        default;
+    //! Copy constructor.
+    LayoutCabanaSliceInterleaved( LayoutCabanaSliceInterleaved&& ) = default;
+    //! Const assignment operator.
+    LayoutCabanaSliceInterleaved&
+    operator=( LayoutCabanaSliceInterleaved const& ) = default;
+    //! Assignment operator.
+    LayoutCabanaSliceInterleaved&
+    operator=( LayoutCabanaSliceInterleaved&& ) = default;
+
+    //! Constructor.
+    KOKKOS_INLINE_FUNCTION
+    explicit constexpr LayoutCabanaSliceInterleaved(
+        size_t num_soa = 0, size_t vector_length = VectorLength,
+        size_t d0 = D0, size_t pad = PAD )
+        : dimension{ num_soa, vector_length, d0, pad, 0, 0, 0, 0 }
+    {
+    }
+};
+
 //---------------------------------------------------------------------------//
 namespace Impl
 {
@@ -364,6 +419,178 @@ struct ViewOffset<Dimension, Kokkos::LayoutCabanaSlice<LayoutDims...>, void>
     }
 };
 
+//---------------------------------------------------------------------------//
+// View offset of LayoutCabanaSliceInterleaved. The tuple components are
+// adjacent and padded to Pad so each tuple's component block is aligned.
+template <class Dimension, int... LayoutDims>
+struct ViewOffset<Dimension,
+                  Kokkos::LayoutCabanaSliceInterleaved<LayoutDims...>, void>
+{
+  public:
+    using is_mapping_plugin = std::true_type;
+    using is_regular = std::true_type;
+
+    typedef size_t size_type;
+    typedef Dimension dimension_type;
+    typedef Kokkos::LayoutCabanaSliceInterleaved<LayoutDims...> array_layout;
+
+    static constexpr int Stride = array_layout::Stride;
+    static constexpr int VectorLength = array_layout::VectorLength;
+    static constexpr int D0 = array_layout::D0;
+    static constexpr int Pad = array_layout::Pad;
+
+    dimension_type m_dim;
+
+    //----------------------------------------
+
+    // rank 1
+    template <typename S>
+    KOKKOS_INLINE_FUNCTION constexpr size_type operator()( S const& s ) const
+    {
+        return Stride * s;
+    }
+
+    // rank 2
+    template <typename S, typename A>
+    KOKKOS_INLINE_FUNCTION constexpr size_type operator()( S const& s,
+                                                           A const& a ) const
+    {
+        return Stride * s + Pad * a;
+    }
+
+    // rank 3
+    template <typename S, typename A, typename I0>
+    KOKKOS_INLINE_FUNCTION constexpr size_type
+    operator()( S const& s, A const& a, I0 const& i0 ) const
+    {
+        return Stride * s + Pad * a + i0;
+    }
+
+    //----------------------------------------
+
+    KOKKOS_INLINE_FUNCTION
+    constexpr array_layout layout() const { return array_layout( m_dim.N0 ); }
+
+    KOKKOS_INLINE_FUNCTION constexpr size_type dimension_0() const
+    {
+        return m_dim.N0;
+    }
+    KOKKOS_INLINE_FUNCTION constexpr size_type dimension_1() const
+    {
+        return m_dim.N1;
+    }
+    KOKKOS_INLINE_FUNCTION constexpr size_type dimension_2() const
+    {
+        return m_dim.N2;
+    }
+    KOKKOS_INLINE_FUNCTION constexpr size_type dimension_3() const
+    {
+        return m_dim.N3;
+    }
+    KOKKOS_INLINE_FUNCTION constexpr size_type dimension_4() const
+    {
+        return m_dim.N4;
+    }
+    KOKKOS_INLINE_FUNCTION constexpr size_type dimension_5() const
+    {
+        return m_dim.N5;
+    }
+    KOKKOS_INLINE_FUNCTION constexpr size_type dimension_6() const
+    {
+        return m_dim.N6;
+    }
+    KOKKOS_INLINE_FUNCTION constexpr size_type dimension_7() const
+    {
+        return m_dim.N7;
+    }
+
+    /* Cardinality of the domain index space */
+    KOKKOS_INLINE_FUNCTION
+    constexpr size_type size() const
+    {
+        return m_dim.N0 * m_dim.N1 * m_dim.N2 * m_dim.N3 * m_dim.N4 * m_dim.N5 *
+               m_dim.N6 * m_dim.N7;
+    }
+
+    /* Span of the range space, largest stride * dimension */
+    KOKKOS_INLINE_FUNCTION
+    constexpr size_type span() const { return m_dim.N0 * Stride; }
+
+    KOKKOS_INLINE_FUNCTION constexpr bool span_is_contiguous() const
+    {
+        return span() == size();
+    }
+
+    /* Strides of dimensions */
+    KOKKOS_INLINE_FUNCTION constexpr size_type stride_0() const
+    {
+        return Stride;
+    }
+
+    KOKKOS_INLINE_FUNCTION constexpr size_type stride_1() const { return Pad; }
+
+    KOKKOS_INLINE_FUNCTION constexpr size_type stride_2() const { return 1; }
+
+    // Stride with [ rank ] value is the total length
+    template <typename iType>
+    KOKKOS_INLINE_FUNCTION void stride( iType* const s ) const
+    {
+        if ( 0 < dimension_type::rank )
+        {
+            s[0] = stride_0();
+        }
+        if ( 1 < dimension_type::rank )
+        {
+            s[1] = stride_1();
+        }
+        if ( 2 < dimension_type::rank )
+        {
+            s[2] = stride_2();
+        }
+        s[dimension_type::rank] = span();
+    }
+
+    //----------------------------------------
+
+    ViewOffset() = default;
+    ViewOffset( const ViewOffset& ) = default;
+    ViewOffset& operator=( const ViewOffset& ) = default;
+
+    KOKKOS_INLINE_FUNCTION
+    constexpr ViewOffset(
+        std::integral_constant<unsigned, 0> const&,
+        Kokkos::LayoutCabanaSliceInterleaved<LayoutDims...> const& rhs )
+        : m_dim( rhs.dimension[0], rhs.dimension[1], rhs.dimension[2],
+                 rhs.dimension[3], rhs.dimension[4], rhs.dimension[5],
+                 rhs.dimension[6], rhs.dimension[7] )
+    {
+    }
+
+    template <class DimRHS, class LayoutRHS>
+    KOKKOS_INLINE_FUNCTION constexpr ViewOffset(
+        const ViewOffset<DimRHS, LayoutRHS, void>& rhs )
+        : m_dim( rhs.m_dim.N0, rhs.m_dim.N1, rhs.m_dim.N2, rhs.m_dim.N3,
+                 rhs.m_dim.N4, rhs.m_dim.N5, rhs.m_dim.N6, rhs.m_dim.N7 )
+    {
+        static_assert( int( DimRHS::rank ) == int( dimension_type::rank ),
+                       "ViewOffset assignment requires equal rank" );
+    }
+
+    //----------------------------------------
+    // Subview construction
+
+    template <class DimRHS, class LayoutRHS>
+    KOKKOS_INLINE_FUNCTION constexpr ViewOffset(
+        const ViewOffset<DimRHS, LayoutRHS, void>&,
+        const SubviewExtents<DimRHS::rank, dimension_type::rank>& sub )
+        : m_dim( sub.range_extent( 0 ), sub.range_extent( 1 ),
+                 sub.range_extent( 2 ), sub.range_extent( 3 ),
+                 sub.range_extent( 4 ), sub.range_extent( 5 ),
+                 sub.range_extent( 6 ), sub.range_extent( 7 ) )
+    {
+    }
+};
+
 //---------------------------------------------------------------------------//
 
 //! \endcond
@@ -465,6 +692,33 @@ struct KokkosDataType
     }
 };
 
+// Data type specialization for interleaved rank-1 members. The tuple
+// components are adjacent in memory and padded to a power-of-two width.
+template <typename T, int VectorLength, int Stride>
+struct KokkosDataType<Interleaved<T>, VectorLength, Stride>
+{
+    using value_type = typename std::remove_all_extents<T>::type;
+    static constexpr std::size_t D0 = std::extent<T, 0>::value;
+    static constexpr std::size_t DPad = nextPowerOfTwo( D0 );
+    using data_type = value_type* [VectorLength][D0];
+    using cabana_layout =
+        Kokkos::LayoutCabanaSliceInterleaved<Stride, VectorLength, D0, DPad>;
+
+    inline static cabana_layout createLayout( const std::size_t num_soa )
+    {
+        return cabana_layout( num_soa );
+    }
+};
+
+// Data type specialization for packed bitfield members. The slice exposes
+// the scalar storage word of each tuple.
+template <std::size_t NumBits, int VectorLength, int Stride>
+struct KokkosDataType<PackedBits<NumBits>, VectorLength, Stride>
+    : public KokkosDataType<typename PackedBits<NumBits>::member_type,
+                            VectorLength, Stride>
+{
+};
+
 //---------------------------------------------------------------------------//
 // Kokkos view wrapper for tuple members
 template <typename T, int VectorLength, int Stride,
@@ -484,6 +738,158 @@ struct KokkosViewWrapper
     }
 };
 
+//---------------------------------------------------------------------------//
+// Streaming store and prefetch hints. Non-temporal stores bypass the cache
+// hierarchy where the architecture and compiler support it and degrade to
+// regular stores everywhere else.
+
+// Fallback for value sizes without a dedicated streaming instruction.
+template <class T, std::size_t N>
+KOKKOS_FORCEINLINE_FUNCTION void
+nonTemporalStoreBySize( T* const ptr, const T value,
+                        std::integral_constant<std::size_t, N> )
+{
+    *ptr = value;
+}
+
+#if defined( __SSE2__ ) && !defined( __clang__ )
+// 4-byte values stream through the integer path with a bitwise copy.
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION void
+nonTemporalStoreBySize( T* const ptr, const T value,
+                        std::integral_constant<std::size_t, 4> )
+{
+    int bits;
+    std::memcpy( &bits, &value, 4 );
+    _mm_stream_si32( reinterpret_cast<int*>( ptr ), bits );
+}
+
+#if defined( __x86_64__ )
+// 8-byte values stream through the integer path with a bitwise copy.
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION void
+nonTemporalStoreBySize( T* const ptr, const T value,
+                        std::integral_constant<std::size_t, 8> )
+{
+    long long bits;
+    std::memcpy( &bits, &value, 8 );
+    _mm_stream_si64( reinterpret_cast<long long*>( ptr ), bits );
+}
+#endif
+#endif // end __SSE2__ && !__clang__
+
+// Store a value without polluting the cache hierarchy where supported.
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION void nonTemporalStore( T* const ptr,
+                                                   const T value )
+{
+#if defined( __CUDA_ARCH__ ) || defined( __HIP_DEVICE_COMPILE__ ) ||          \
+    defined( __SYCL_DEVICE_ONLY__ )
+    *ptr = value;
+#elif defined( __clang__ )
+    __builtin_nontemporal_store( value, ptr );
+#else
+    nonTemporalStoreBySize(
+        ptr, value, std::integral_constant<std::size_t, sizeof( T )>{} );
+#endif
+}
+
+// Streaming store dispatch on the slice access tag: non-temporal for
+// streaming slices, a regular store for everything else.
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION void
+accessTagStore( T* const ptr, const T value, std::true_type /*streaming*/ )
+{
+    nonTemporalStore( ptr, value );
+}
+
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION void
+accessTagStore( T* const ptr, const T value, std::false_type /*streaming*/ )
+{
+    *ptr = value;
+}
+
+// Prefetch an element toward the core ahead of its use. A no-op in device
+// code and on compilers without the builtin.
+KOKKOS_FORCEINLINE_FUNCTION void prefetchForRead( const void* const ptr )
+{
+#if !defined( __CUDA_ARCH__ ) && !defined( __HIP_DEVICE_COMPILE__ ) &&        \
+    !defined( __SYCL_DEVICE_ONLY__ ) &&                                       \
+    ( defined( __GNUC__ ) || defined( __clang__ ) )
+    __builtin_prefetch( ptr, 0, 3 );
+#else
+    (void)ptr;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// Load a value through the read-only data cache where the hardware has one.
+// The caller guarantees the data is not written for the lifetime of the
+// kernel.
+template <class T,
+          typename std::enable_if<( std::is_arithmetic<T>::value &&
+                                    !std::is_same<T, bool>::value ),
+                                  int>::type = 0>
+KOKKOS_FORCEINLINE_FUNCTION T loadReadOnly( const T* const ptr )
+{
+#if defined( __CUDA_ARCH__ ) && ( __CUDA_ARCH__ >= 350 )
+    return __ldg( ptr );
+#else
+    return *ptr;
+#endif
+}
+
+template <class T,
+          typename std::enable_if<!( std::is_arithmetic<T>::value &&
+                                     !std::is_same<T, bool>::value ),
+                                  int>::type = 0>
+KOKKOS_FORCEINLINE_FUNCTION T loadReadOnly( const T* const ptr )
+{
+    return *ptr;
+}
+
+//---------------------------------------------------------------------------//
+// Whole-tuple transfer of an interleaved member's padded component block.
+// Blocks that are a multiple of 16 bytes move through aligned 16-byte
+// vector words so devices with vector memory instructions issue one wide
+// transaction per word (float4-class loads on NVIDIA hardware); other block
+// sizes degrade to one scalar transfer per component.
+template <std::size_t NumWord, class T>
+KOKKOS_FORCEINLINE_FUNCTION void
+vectorWordCopy( T* const KOKKOS_RESTRICT dst,
+                const T* const KOKKOS_RESTRICT src )
+{
+#if defined( __CUDA_ARCH__ ) || defined( __HIP_DEVICE_COMPILE__ )
+    for ( std::size_t w = 0; w < NumWord; ++w )
+        reinterpret_cast<float4*>( dst )[w] =
+            reinterpret_cast<const float4*>( src )[w];
+#else
+    std::memcpy( dst, src, NumWord * 16 );
+#endif
+}
+
+template <class T, std::size_t D0, std::size_t DPad,
+          typename std::enable_if<( 0 == ( DPad * sizeof( T ) ) % 16 ),
+                                  int>::type = 0>
+KOKKOS_FORCEINLINE_FUNCTION void
+tupleBlockCopy( T* const KOKKOS_RESTRICT dst,
+                const T* const KOKKOS_RESTRICT src )
+{
+    vectorWordCopy<( DPad * sizeof( T ) ) / 16>( dst, src );
+}
+
+template <class T, std::size_t D0, std::size_t DPad,
+          typename std::enable_if<( 0 != ( DPad * sizeof( T ) ) % 16 ),
+                                  int>::type = 0>
+KOKKOS_FORCEINLINE_FUNCTION void
+tupleBlockCopy( T* const KOKKOS_RESTRICT dst,
+                const T* const KOKKOS_RESTRICT src )
+{
+    for ( std::size_t d = 0; d < D0; ++d )
+        dst[d] = src[d];
+}
+
 //---------------------------------------------------------------------------//
 
 //! \endcond
@@ -568,6 +974,10 @@ class Slice
     //! Random memory access slice type.
     using random_access_slice =
         Slice<DataType, DeviceType, RandomAccessMemory, VectorLength, Stride>;
+    //! Streaming memory access slice type.
+    using streaming_access_slice =
+        Slice<DataType, DeviceType, StreamingAccessMemory, VectorLength,
+              Stride>;
 
     // Declare slices of different memory access types to be friends.
     friend class Slice<DataType, DeviceType, DefaultAccessMemory, VectorLength,
@@ -576,6 +986,12 @@ class Slice
                        Stride>;
     friend class Slice<DataType, DeviceType, RandomAccessMemory, VectorLength,
                        Stride>;
+    friend class Slice<DataType, DeviceType, StreamingAccessMemory,
+                       VectorLength, Stride>;
+
+    //! Whether stores through stream() bypass the cache hierarchy.
+    static constexpr bool is_streaming =
+        std::is_same<MemoryAccessType, StreamingAccessMemory>::value;
 
     // Equivalent Kokkos view rank. This rank assumes that the struct and
     // array dimension are merged. For the true rank of the raw AoSoA data use
@@ -584,7 +1000,7 @@ class Slice
     // compatibility with Kokkos views.
     enum
     {
-        Rank = std::rank<DataType>::value + 1
+        Rank = Impl::MemberRank<DataType>::value + 1
     };
 
   public:
@@ -685,7 +1101,7 @@ class Slice
     //! 2d access for  Rank 0
     template <typename U = DataType>
     KOKKOS_FORCEINLINE_FUNCTION
-        typename std::enable_if<( 0 == std::rank<U>::value &&
+        typename std::enable_if<( 0 == Impl::MemberRank<U>::value &&
                                   std::is_same<U, DataType>::value ),
                                 reference_type>::type
         access( const size_type s, const size_type a ) const
@@ -696,7 +1112,7 @@ class Slice
     //! 2d access for  Rank 1
     template <typename U = DataType>
     KOKKOS_FORCEINLINE_FUNCTION
-        typename std::enable_if<( 1 == std::rank<U>::value &&
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
                                   std::is_same<U, DataType>::value ),
                                 reference_type>::type
         access( const size_type s, const size_type a, const size_type d0 ) const
@@ -707,7 +1123,7 @@ class Slice
     //! 2d access for  Rank 2
     template <typename U = DataType>
     KOKKOS_FORCEINLINE_FUNCTION
-        typename std::enable_if<( 2 == std::rank<U>::value &&
+        typename std::enable_if<( 2 == Impl::MemberRank<U>::value &&
                                   std::is_same<U, DataType>::value ),
                                 reference_type>::type
         access( const size_type s, const size_type a, const size_type d0,
@@ -719,7 +1135,7 @@ class Slice
     //! 2d access for  Rank 3
     template <typename U = DataType>
     KOKKOS_FORCEINLINE_FUNCTION
-        typename std::enable_if<( 3 == std::rank<U>::value &&
+        typename std::enable_if<( 3 == Impl::MemberRank<U>::value &&
                                   std::is_same<U, DataType>::value ),
                                 reference_type>::type
         access( const size_type s, const size_type a, const size_type d0,
@@ -734,7 +1150,7 @@ class Slice
     //! 1d access for  Rank 0
     template <typename U = DataType>
     KOKKOS_FORCEINLINE_FUNCTION
-        typename std::enable_if<( 0 == std::rank<U>::value &&
+        typename std::enable_if<( 0 == Impl::MemberRank<U>::value &&
                                   std::is_same<U, DataType>::value ),
                                 reference_type>::type
         operator()( const size_type i ) const
@@ -745,7 +1161,7 @@ class Slice
     //! 1d access for  Rank 1
     template <typename U = DataType>
     KOKKOS_FORCEINLINE_FUNCTION
-        typename std::enable_if<( 1 == std::rank<U>::value &&
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
                                   std::is_same<U, DataType>::value ),
                                 reference_type>::type
         operator()( const size_type i, const size_type d0 ) const
@@ -756,7 +1172,7 @@ class Slice
     //! 1d access for  Rank 2
     template <typename U = DataType>
     KOKKOS_FORCEINLINE_FUNCTION
-        typename std::enable_if<( 2 == std::rank<U>::value &&
+        typename std::enable_if<( 2 == Impl::MemberRank<U>::value &&
                                   std::is_same<U, DataType>::value ),
                                 reference_type>::type
         operator()( const size_type i, const size_type d0,
@@ -768,7 +1184,7 @@ class Slice
     //! 1d access for  Rank 3
     template <typename U = DataType>
     KOKKOS_FORCEINLINE_FUNCTION
-        typename std::enable_if<( 3 == std::rank<U>::value &&
+        typename std::enable_if<( 3 == Impl::MemberRank<U>::value &&
                                   std::is_same<U, DataType>::value ),
                                 reference_type>::type
         operator()( const size_type i, const size_type d0, const size_type d1,
@@ -777,6 +1193,188 @@ class Slice
         return access( index_type::s( i ), index_type::a( i ), d0, d1, d2 );
     }
 
+    // ----------------------
+    // Whole-tuple accessors
+
+    // For members with interleaved storage the padded component block of a
+    // tuple moves as aligned vector-width transactions (a single 128-bit
+    // transaction for 3- and 4-component single precision members); the
+    // default layout degrades to one scalar access per component.
+
+    //! 2d whole-tuple load for Rank 1
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        vectorLoad( const size_type s, const size_type a,
+                    value_type* const values ) const
+    {
+        vectorLoadImpl( s, a, values,
+                        typename Impl::IsInterleaved<U>::type() );
+    }
+
+    //! 1d whole-tuple load for Rank 1
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        vectorLoad( const size_type i, value_type* const values ) const
+    {
+        vectorLoad( index_type::s( i ), index_type::a( i ), values );
+    }
+
+    //! 2d whole-tuple store for Rank 1
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        vectorStore( const size_type s, const size_type a,
+                     const value_type* const values ) const
+    {
+        vectorStoreImpl( s, a, values,
+                         typename Impl::IsInterleaved<U>::type() );
+    }
+
+    //! 1d whole-tuple store for Rank 1
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        vectorStore( const size_type i,
+                     const value_type* const values ) const
+    {
+        vectorStore( index_type::s( i ), index_type::a( i ), values );
+    }
+
+    // -------------------
+    // Streaming accessors
+
+    // Stores through stream() are non-temporal (bypassing the cache
+    // hierarchy where the architecture supports it) when the slice has
+    // streaming memory access and regular stores otherwise, so kernels
+    // writing once-used data can be written against the hint and tuned by
+    // the slice type alone. prefetch() pulls an element toward the core
+    // ahead of its use on any access type.
+
+    //! 2d streaming store for Rank 0
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 0 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        stream( const size_type s, const size_type a,
+                const value_type value ) const
+    {
+        Impl::accessTagStore( &_view( s, a ), value,
+                              std::integral_constant<bool, is_streaming>{} );
+    }
+
+    //! 2d streaming store for Rank 1
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        stream( const size_type s, const size_type a, const size_type d0,
+                const value_type value ) const
+    {
+        Impl::accessTagStore( &_view( s, a, d0 ), value,
+                              std::integral_constant<bool, is_streaming>{} );
+    }
+
+    //! 2d streaming store for Rank 2
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 2 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        stream( const size_type s, const size_type a, const size_type d0,
+                const size_type d1, const value_type value ) const
+    {
+        Impl::accessTagStore( &_view( s, a, d0, d1 ), value,
+                              std::integral_constant<bool, is_streaming>{} );
+    }
+
+    //! 2d streaming store for Rank 3
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 3 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        stream( const size_type s, const size_type a, const size_type d0,
+                const size_type d1, const size_type d2,
+                const value_type value ) const
+    {
+        Impl::accessTagStore( &_view( s, a, d0, d1, d2 ), value,
+                              std::integral_constant<bool, is_streaming>{} );
+    }
+
+    //! 1d streaming store for Rank 0
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 0 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        stream( const size_type i, const value_type value ) const
+    {
+        stream( index_type::s( i ), index_type::a( i ), value );
+    }
+
+    //! 1d streaming store for Rank 1
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        stream( const size_type i, const size_type d0,
+                const value_type value ) const
+    {
+        stream( index_type::s( i ), index_type::a( i ), d0, value );
+    }
+
+    //! 1d streaming store for Rank 2
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 2 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        stream( const size_type i, const size_type d0, const size_type d1,
+                const value_type value ) const
+    {
+        stream( index_type::s( i ), index_type::a( i ), d0, d1, value );
+    }
+
+    //! 1d streaming store for Rank 3
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 3 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                void>::type
+        stream( const size_type i, const size_type d0, const size_type d1,
+                const size_type d2, const value_type value ) const
+    {
+        stream( index_type::s( i ), index_type::a( i ), d0, d1, d2, value );
+    }
+
+    //! 2d prefetch of the first element of a particle
+    KOKKOS_FORCEINLINE_FUNCTION
+    void prefetch( const size_type s, const size_type a ) const
+    {
+        Impl::prefetchForRead( _view.data() + s * _view.stride( 0 ) +
+                               _view.stride( 1 ) * a );
+    }
+
+    //! 1d prefetch of the element address
+    KOKKOS_FORCEINLINE_FUNCTION
+    void prefetch( const size_type i ) const
+    {
+        prefetch( index_type::s( i ), index_type::a( i ) );
+    }
+
     // -------------------------------
     // Raw data access.
 
@@ -822,6 +1420,61 @@ class Slice
     kokkos_view view() const { return _view; }
 
   private:
+    // Whole-tuple load of an interleaved member. The tuple's padded
+    // component block is aligned so it moves as vector-width words.
+    KOKKOS_FORCEINLINE_FUNCTION
+    void vectorLoadImpl( const size_type s, const size_type a,
+                         value_type* const values,
+                         std::true_type /*interleaved*/ ) const
+    {
+        constexpr std::size_t d0 = Impl::MemberExtent<DataType, 0>::value;
+        constexpr std::size_t dpad = Impl::nextPowerOfTwo( d0 );
+        alignas( 16 ) value_type block[dpad];
+        Impl::tupleBlockCopy<value_type, dpad, dpad>(
+            block, _view.data() + s * soa_stride + dpad * a );
+        for ( std::size_t d = 0; d < d0; ++d )
+            values[d] = block[d];
+    }
+
+    // Whole-tuple load of a default-layout member - one scalar access per
+    // component with the vector length stride.
+    KOKKOS_FORCEINLINE_FUNCTION
+    void vectorLoadImpl( const size_type s, const size_type a,
+                         value_type* const values,
+                         std::false_type /*interleaved*/ ) const
+    {
+        constexpr std::size_t d0 = Impl::MemberExtent<DataType, 0>::value;
+        for ( std::size_t d = 0; d < d0; ++d )
+            values[d] = _view( s, a, d );
+    }
+
+    // Whole-tuple store of an interleaved member. The padding lanes are
+    // zero-filled.
+    KOKKOS_FORCEINLINE_FUNCTION
+    void vectorStoreImpl( const size_type s, const size_type a,
+                          const value_type* const values,
+                          std::true_type /*interleaved*/ ) const
+    {
+        constexpr std::size_t d0 = Impl::MemberExtent<DataType, 0>::value;
+        constexpr std::size_t dpad = Impl::nextPowerOfTwo( d0 );
+        alignas( 16 ) value_type block[dpad] = {};
+        for ( std::size_t d = 0; d < d0; ++d )
+            block[d] = values[d];
+        Impl::tupleBlockCopy<value_type, dpad, dpad>(
+            _view.data() + s * soa_stride + dpad * a, block );
+    }
+
+    // Whole-tuple store of a default-layout member.
+    KOKKOS_FORCEINLINE_FUNCTION
+    void vectorStoreImpl( const size_type s, const size_type a,
+                          const value_type* const values,
+                          std::false_type /*interleaved*/ ) const
+    {
+        constexpr std::size_t d0 = Impl::MemberExtent<DataType, 0>::value;
+        for ( std::size_t d = 0; d < d0; ++d )
+            _view( s, a, d ) = values[d];
+    }
+
     // The data view. This view is unmanaged and has access traits specified
     // by the template parameters of this class.
     kokkos_view _view;
@@ -857,6 +1510,334 @@ struct is_slice : public is_slice_impl<typename std::remove_cv<T>::type>::type
 {
 };
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief A flattened access proxy over a slice for random-access-dominated
+  kernels.
+
+  \tparam DataType The slice member data type.
+
+  \tparam DeviceType The slice device type.
+
+  \tparam VectorLength The slice vector length.
+
+  \tparam Stride The slice SoA stride.
+
+  The proxy holds nothing but the raw data pointer - all the layout strides
+  of a slice are compile-time constants so each access is a single fused
+  offset computation instead of going through the Kokkos view mapping. Use
+  this in kernels that read or write individual members at scattered
+  indices (e.g. pair interaction kernels iterating a neighbor list) where
+  the per-access index decomposition of the slice dominates and
+  vectorization over the inner arrays is not profitable. The get() methods
+  additionally route reads through the read-only data cache on hardware
+  that has one; only use them for data that is not written during the
+  kernel.
+
+  The proxy does not extend the lifetime of the underlying allocation - the
+  AoSoA it came from must outlive it.
+*/
+template <typename DataType, typename DeviceType, int VectorLength,
+          int Stride>
+class FlatSlice
+{
+  public:
+    //! Value type.
+    using value_type = typename std::remove_all_extents<
+        typename Impl::UnwrapMemberType<DataType>::type>::type;
+
+    //! Vector length.
+    static constexpr int vector_length = VectorLength;
+
+    //! SoA stride.
+    static constexpr int soa_stride = Stride;
+
+    //! Member rank.
+    static constexpr std::size_t member_rank =
+        Impl::MemberRank<DataType>::value;
+
+    //! Whether the member has interleaved storage.
+    static constexpr bool is_interleaved =
+        Impl::IsInterleaved<DataType>::value;
+
+    //! Size type.
+    using size_type = std::size_t;
+
+    //! Constructor.
+    template <class MemoryAccessType>
+    FlatSlice( const Slice<DataType, DeviceType, MemoryAccessType,
+                           VectorLength, Stride>& slice )
+        : _data( slice.data() )
+        , _size( slice.size() )
+    {
+    }
+
+    //! Get the number of tuples.
+    KOKKOS_FORCEINLINE_FUNCTION
+    size_type size() const { return _size; }
+
+    //! Get the raw data pointer.
+    KOKKOS_FORCEINLINE_FUNCTION
+    value_type* data() const { return _data; }
+
+    //! Access a rank-0 member element.
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 0 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                value_type&>::type
+        operator()( const size_type i ) const
+    {
+        return _data[offset( i )];
+    }
+
+    //! Access a rank-1 member element.
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                value_type&>::type
+        operator()( const size_type i, const int d0 ) const
+    {
+        return _data[offset( i ) + _comp_stride * d0];
+    }
+
+    //! Access a rank-2 member element.
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 2 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                value_type&>::type
+        operator()( const size_type i, const int d0, const int d1 ) const
+    {
+        return _data[offset( i ) + vector_length * ( d1 + _d1 * d0 )];
+    }
+
+    //! Access a rank-3 member element.
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 3 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                value_type&>::type
+        operator()( const size_type i, const int d0, const int d1,
+                    const int d2 ) const
+    {
+        return _data[offset( i ) +
+                     vector_length * ( d2 + _d2 * ( d1 + _d1 * d0 ) )];
+    }
+
+    //! Read a rank-0 member element through the read-only cache.
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 0 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                value_type>::type
+        get( const size_type i ) const
+    {
+        return Impl::loadReadOnly( _data + offset( i ) );
+    }
+
+    //! Read a rank-1 member element through the read-only cache.
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 1 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                value_type>::type
+        get( const size_type i, const int d0 ) const
+    {
+        return Impl::loadReadOnly( _data + offset( i ) +
+                                   _comp_stride * d0 );
+    }
+
+    //! Read a rank-2 member element through the read-only cache.
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 2 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                value_type>::type
+        get( const size_type i, const int d0, const int d1 ) const
+    {
+        return Impl::loadReadOnly( _data + offset( i ) +
+                                   vector_length * ( d1 + _d1 * d0 ) );
+    }
+
+    //! Read a rank-3 member element through the read-only cache.
+    template <typename U = DataType>
+    KOKKOS_FORCEINLINE_FUNCTION
+        typename std::enable_if<( 3 == Impl::MemberRank<U>::value &&
+                                  std::is_same<U, DataType>::value ),
+                                value_type>::type
+        get( const size_type i, const int d0, const int d1,
+             const int d2 ) const
+    {
+        return Impl::loadReadOnly(
+            _data + offset( i ) +
+            vector_length * ( d2 + _d2 * ( d1 + _d1 * d0 ) ) );
+    }
+
+  private:
+    // Compute the flat offset of the first component of a tuple. All the
+    // strides are compile-time constants so this compiles to shifts and
+    // masks for the power-of-two vector lengths the AoSoA requires.
+    KOKKOS_FORCEINLINE_FUNCTION
+    size_type offset( const size_type i ) const
+    {
+        return ( i / vector_length ) * soa_stride +
+               _lane_stride * ( i % vector_length );
+    }
+
+    // Lane and component strides. The default layout strides components by
+    // the vector length with adjacent lanes; interleaved members have
+    // adjacent components with lanes strided by the padded extent.
+    static constexpr int _lane_stride =
+        is_interleaved
+            ? Impl::nextPowerOfTwo( Impl::MemberExtent<DataType, 0>::value )
+            : 1;
+    static constexpr int _comp_stride = is_interleaved ? 1 : vector_length;
+
+    // Inner array extents.
+    static constexpr int _d1 = std::extent<DataType, 1>::value;
+    static constexpr int _d2 = std::extent<DataType, 2>::value;
+
+    // The member data.
+    value_type* _data;
+
+    // Number of tuples in the slice.
+    size_type _size;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a flattened access proxy from a slice.
+
+  \param slice The slice to flatten.
+
+  \return A FlatSlice accessing the same data as the slice.
+*/
+template <typename DataType, typename DeviceType, typename MemoryAccessType,
+          int VectorLength, int Stride>
+auto makeFlatSlice( const Slice<DataType, DeviceType, MemoryAccessType,
+                                VectorLength, Stride>& slice )
+    -> FlatSlice<DataType, DeviceType, VectorLength, Stride>
+{
+    return FlatSlice<DataType, DeviceType, VectorLength, Stride>( slice );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Gather slice data at the given indices into a contiguous view.
+
+  \tparam Slice_t Slice type.
+
+  \tparam IndexViewType Integer rank-1 view type holding gather indices.
+
+  \tparam ViewType Rank-2 LayoutRight view type for the gathered data.
+
+  \param slice The slice to gather from.
+
+  \param indices The tuple indices to gather.
+
+  \param out The gathered data. Entry (i,n) holds component n of tuple
+  indices(i) with the components of a multidimensional member flattened in
+  layout order. Must have extents (indices.size(), number of components).
+
+  The output buffer is element-contiguous so subsequent kernels can stream
+  it at full memory bandwidth instead of striding through the SoA layout.
+*/
+template <class Slice_t, class IndexViewType, class ViewType>
+void gather( const Slice_t& slice, const IndexViewType& indices,
+             const ViewType& out,
+             typename std::enable_if<( is_slice<Slice_t>::value ),
+                                     int>::type* = 0 )
+{
+    static_assert( std::is_same<typename ViewType::array_layout,
+                                Kokkos::LayoutRight>::value,
+                   "Gather output view must be LayoutRight" );
+
+    // Get the number of components in the slice elements.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.rank(); ++d )
+        num_comp *= slice.extent( d );
+
+    if ( out.extent( 0 ) < indices.extent( 0 ) ||
+         out.extent( 1 ) != num_comp )
+        throw std::runtime_error( "Gather output view is the wrong size!" );
+
+    // Gather each element. The inner loop over components reads with the
+    // innermost layout stride and writes contiguously.
+    auto slice_data = slice.data();
+    std::size_t lane_stride = slice.stride( 1 );
+    std::size_t comp_stride =
+        ( slice.rank() > 2 ) ? slice.stride( slice.rank() - 1 ) : 0;
+    auto gather_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto s = Slice_t::index_type::s( indices( i ) );
+        auto a = Slice_t::index_type::a( indices( i ) );
+        std::size_t offset = s * slice.stride( 0 ) + lane_stride * a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            out( i, n ) = slice_data[offset + comp_stride * n];
+    };
+    Kokkos::RangePolicy<typename Slice_t::execution_space> policy(
+        0, indices.extent( 0 ) );
+    Kokkos::parallel_for( "Cabana::gather", policy, gather_func );
+    Kokkos::fence();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Scatter contiguous data back into a slice at the given indices.
+
+  \tparam Slice_t Slice type.
+
+  \tparam IndexViewType Integer rank-1 view type holding scatter indices.
+
+  \tparam ViewType Rank-2 LayoutRight view type holding the data to scatter.
+
+  \param slice The slice to scatter into.
+
+  \param indices The tuple indices to scatter to. The indices must be unique
+  - duplicate indices produce a write race.
+
+  \param in The data to scatter, in the format produced by gather().
+*/
+template <class Slice_t, class IndexViewType, class ViewType>
+void scatter( const Slice_t& slice, const IndexViewType& indices,
+              const ViewType& in,
+              typename std::enable_if<( is_slice<Slice_t>::value ),
+                                      int>::type* = 0 )
+{
+    static_assert( std::is_same<typename ViewType::array_layout,
+                                Kokkos::LayoutRight>::value,
+                   "Scatter input view must be LayoutRight" );
+
+    // Get the number of components in the slice elements.
+    std::size_t num_comp = 1;
+    for ( std::size_t d = 2; d < slice.rank(); ++d )
+        num_comp *= slice.extent( d );
+
+    if ( in.extent( 0 ) < indices.extent( 0 ) || in.extent( 1 ) != num_comp )
+        throw std::runtime_error( "Scatter input view is the wrong size!" );
+
+    // Scatter each element. The inner loop over components reads
+    // contiguously and writes with the innermost layout stride.
+    auto slice_data = slice.data();
+    std::size_t lane_stride = slice.stride( 1 );
+    std::size_t comp_stride =
+        ( slice.rank() > 2 ) ? slice.stride( slice.rank() - 1 ) : 0;
+    auto scatter_func = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        auto s = Slice_t::index_type::s( indices( i ) );
+        auto a = Slice_t::index_type::a( indices( i ) );
+        std::size_t offset = s * slice.stride( 0 ) + lane_stride * a;
+        for ( std::size_t n = 0; n < num_comp; ++n )
+            slice_data[offset + comp_stride * n] = in( i, n );
+    };
+    Kokkos::RangePolicy<typename Slice_t::execution_space> policy(
+        0, indices.extent( 0 ) );
+    Kokkos::parallel_for( "Cabana::scatter", policy, scatter_func );
+    Kokkos::fence();
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
@@ -0,0 +1,254 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_SliceSnapshot.hpp
+  \brief Double-buffered slice snapshots for asynchronous in-situ analysis
+*/
+#ifndef CABANA_SLICESNAPSHOT_HPP
+#define CABANA_SLICESNAPSHOT_HPP
+
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_Slice.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace Cabana
+{
+namespace Experimental
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Double-buffered snapshots of selected slices for in-situ analysis
+  on a side execution space instance.
+
+  \tparam ExecutionSpace Kokkos execution space of the compute and analysis
+  instances.
+
+  \tparam SliceTypes The types of the slices to snapshot.
+
+  Computing diagnostics against live particle data serializes the analysis
+  kernels with the compute stream. This facility instead captures the
+  selected slices into flat column-major buffers with asynchronous copies
+  enqueued on the compute instance - consistent with the kernels already
+  enqueued there and without blocking it - and hands read-only views of the
+  captured data to an analysis callback running on a separate instance.
+  With two buffers the analysis of one capture overlaps the compute and
+  capture of the next.
+
+  \code
+    auto tap = createSliceSnapshot( analysis_instance, positions, energies );
+    while ( stepping )
+    {
+        runComputeKernels( compute_instance );
+        tap.capture( compute_instance, positions, energies );
+        tap.analyze( [=]( const exec_space& space, auto x, auto e )
+                     { histogram( space, x, e ); } );
+    }
+  \endcode
+
+  The only waits are on copies and analysis kernels that had a full capture
+  cycle to complete, so in steady state both instances stay busy.
+*/
+template <class ExecutionSpace, class... SliceTypes>
+class SliceSnapshot
+{
+  public:
+    //! Kokkos execution space.
+    using execution_space = ExecutionSpace;
+
+    //! Kokkos memory space the snapshot buffers reside in.
+    using memory_space = typename execution_space::memory_space;
+
+    //! Flat column-major buffer type holding one slice's snapshot. Entry
+    //! (i,n) holds component n of tuple i.
+    template <class SliceType>
+    using buffer_type = Kokkos::View<typename SliceType::value_type**,
+                                     Kokkos::LayoutLeft, memory_space>;
+
+    /*!
+      \brief Constructor.
+
+      \param analysis_space The execution space instance (e.g. stream) the
+      analysis callbacks run on. Pass an instance distinct from the compute
+      instance - with the shared default instance the analysis kernels
+      serialize with the compute kernels and no overlap is gained.
+    */
+    SliceSnapshot( const execution_space& analysis_space = execution_space() )
+        : _analysis_space( analysis_space )
+    {
+    }
+
+    /*!
+      \brief Capture a snapshot of the slices into the back buffer.
+
+      \param compute_space The execution space instance the kernels
+      producing the slice data are enqueued on.
+
+      \param slices The slices to snapshot.
+
+      The transpose copies are enqueued on the compute instance so they are
+      ordered after the producing kernels and see a consistent state, and
+      this function returns without fencing it. If an analysis from two
+      captures ago may still be reading the buffer about to be overwritten
+      the analysis instance is fenced first.
+    */
+    void capture( const execution_space& compute_space,
+                  const SliceTypes&... slices )
+    {
+        // Wait for any analysis still reading the buffer we are about to
+        // overwrite. In steady state those kernels had a full capture cycle
+        // to finish.
+        if ( _analysis_pending )
+        {
+            _analysis_space.fence();
+            _analysis_pending = false;
+        }
+
+        int back = 1 - _front;
+        captureImpl( compute_space, back,
+                     std::make_index_sequence<sizeof...( SliceTypes )>(),
+                     slices... );
+        _front = back;
+        _captured = true;
+        _capture_space = compute_space;
+        _capture_pending = true;
+    }
+
+    /*!
+      \brief Run an analysis callback against the latest snapshot.
+
+      \param callback Callable taking the analysis execution space instance
+      followed by one read-only buffer view per captured slice, in capture
+      order. Kernels the callback launches must use the given instance.
+
+      Waits for the capture copies to land and then invokes the callback.
+      The callback may return before its kernels complete - the snapshot
+      tracks the analysis instance and will not overwrite the buffer until
+      it has drained.
+    */
+    template <class Callback>
+    void analyze( Callback&& callback )
+    {
+        if ( !_captured )
+            throw std::logic_error(
+                "Attempted to analyze before the first capture" );
+
+        // Wait for the capture copies. The compute kernels enqueued after
+        // the capture keep running - only this calling thread waits.
+        if ( _capture_pending )
+        {
+            _capture_space.fence();
+            _capture_pending = false;
+        }
+
+        analyzeImpl( std::forward<Callback>( callback ),
+                     std::make_index_sequence<sizeof...( SliceTypes )>() );
+        _analysis_pending = true;
+    }
+
+    //! Wait for all analysis kernels to complete.
+    void fence()
+    {
+        _analysis_space.fence();
+        _analysis_pending = false;
+    }
+
+    //! Get the analysis execution space instance.
+    execution_space analysisSpace() const { return _analysis_space; }
+
+  private:
+    // Capture each slice into its back buffer.
+    template <std::size_t... Is>
+    void captureImpl( const execution_space& compute_space, const int back,
+                      std::index_sequence<Is...>,
+                      const SliceTypes&... slices )
+    {
+        std::initializer_list<int>{
+            ( captureOne( compute_space, std::get<Is>( _buffers[back] ),
+                          slices ),
+              0 )... };
+    }
+
+    // Size one buffer to its slice and enqueue the transpose copy.
+    template <class BufferType, class SliceType>
+    void captureOne( const execution_space& compute_space,
+                     BufferType& buffer, const SliceType& slice )
+    {
+        std::size_t num_comp = 1;
+        for ( std::size_t d = 2; d < slice.rank(); ++d )
+            num_comp *= slice.extent( d );
+        if ( buffer.extent( 0 ) != slice.size() ||
+             buffer.extent( 1 ) != num_comp )
+            buffer = BufferType(
+                Kokkos::ViewAllocateWithoutInitializing( "slice_snapshot" ),
+                slice.size(), num_comp );
+        Cabana::deep_copy( compute_space, buffer, slice );
+    }
+
+    // Hand read-only views of the front buffers to the callback.
+    template <class Callback, std::size_t... Is>
+    void analyzeImpl( Callback&& callback, std::index_sequence<Is...> )
+    {
+        callback( _analysis_space,
+                  typename buffer_type<SliceTypes>::const_type(
+                      std::get<Is>( _buffers[_front] ) )... );
+    }
+
+    // Double-buffered snapshot storage.
+    std::tuple<buffer_type<SliceTypes>...> _buffers[2];
+
+    // Buffer holding the latest capture. The first capture writes buffer 0.
+    int _front = 1;
+
+    // Whether any capture has completed.
+    bool _captured = false;
+
+    // Whether the latest capture's copies may still be in flight.
+    bool _capture_pending = false;
+
+    // Whether analysis kernels may still be reading the front buffer.
+    bool _analysis_pending = false;
+
+    // Analysis instance and the instance of the latest capture.
+    execution_space _analysis_space;
+    execution_space _capture_space;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a double-buffered slice snapshot.
+
+  \param analysis_space The execution space instance the analysis callbacks
+  run on.
+
+  \param slices The slices the snapshot will capture, for type deduction
+  only. No data is captured until the first capture() call.
+*/
+template <class ExecutionSpace, class... SliceTypes>
+SliceSnapshot<ExecutionSpace, SliceTypes...>
+createSliceSnapshot( const ExecutionSpace& analysis_space,
+                     const SliceTypes&... )
+{
+    return SliceSnapshot<ExecutionSpace, SliceTypes...>( analysis_space );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Experimental
+} // end namespace Cabana
+
+#endif // end CABANA_SLICESNAPSHOT_HPP
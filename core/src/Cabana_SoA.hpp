@@ -124,6 +124,29 @@ struct StructMember
     array_type _data;
 };
 
+// Interleaved storage specialization for rank-1 members. The components of
+// each tuple are stored adjacently and padded to the next power-of-two
+// width so they form one aligned vector-width block per tuple.
+template <std::size_t M, int VectorLength, typename T>
+struct StructMember<M, VectorLength, Interleaved<T>>
+{
+    using value_type = typename std::remove_all_extents<T>::type;
+    static constexpr std::size_t D0 = std::extent<T, 0>::value;
+    static constexpr std::size_t DPad = nextPowerOfTwo( D0 );
+    using array_type = value_type[VectorLength][DPad];
+    alignas( 16 ) array_type _data;
+};
+
+// Packed bitfield storage specialization. The member is a scalar of the
+// smallest unsigned storage holding the requested flag bits.
+template <std::size_t M, int VectorLength, std::size_t NumBits>
+struct StructMember<M, VectorLength, PackedBits<NumBits>>
+{
+    using array_type =
+        typename PackedBits<NumBits>::member_type[VectorLength];
+    array_type _data;
+};
+
 //---------------------------------------------------------------------------//
 // SoA implementation detail to hide the index sequence.
 template <int VectorLength, typename Sequence, typename... Types>
@@ -156,7 +179,8 @@ soaMemberCast( SoA_t& soa )
 //---------------------------------------------------------------------------//
 // Get a pointer to the first element of a member in a given SoA.
 template <std::size_t M, class SoA_t>
-typename SoA_t::template member_pointer_type<M> soaMemberPtr( SoA_t* p )
+KOKKOS_FORCEINLINE_FUNCTION typename SoA_t::template member_pointer_type<M>
+soaMemberPtr( SoA_t* p )
 {
     static_assert( is_soa<SoA_t>::value, "soaMemberPtr only for SoAs" );
     void* member = static_cast<typename SoA_t::template base<M>*>( p );
@@ -164,6 +188,44 @@ typename SoA_t::template member_pointer_type<M> soaMemberPtr( SoA_t* p )
         member );
 }
 
+//---------------------------------------------------------------------------//
+// Access a rank-1 member element in the storage layout of the member. The
+// default layout strides the components of a tuple by the vector length
+// while interleaved storage holds them adjacently.
+template <std::size_t M, class SoA_t>
+KOKKOS_FORCEINLINE_FUNCTION typename SoA_t::template member_reference_type<M>
+soaRank1Access( SoA_t& soa, const std::size_t a, const std::size_t d0,
+                std::false_type )
+{
+    return soaMemberCast<M>( soa )._data[d0][a];
+}
+
+template <std::size_t M, class SoA_t>
+KOKKOS_FORCEINLINE_FUNCTION typename SoA_t::template member_reference_type<M>
+soaRank1Access( SoA_t& soa, const std::size_t a, const std::size_t d0,
+                std::true_type )
+{
+    return soaMemberCast<M>( soa )._data[a][d0];
+}
+
+template <std::size_t M, class SoA_t>
+KOKKOS_FORCEINLINE_FUNCTION
+    typename SoA_t::template member_const_reference_type<M>
+    soaRank1Access( const SoA_t& soa, const std::size_t a,
+                    const std::size_t d0, std::false_type )
+{
+    return soaMemberCast<M>( soa )._data[d0][a];
+}
+
+template <std::size_t M, class SoA_t>
+KOKKOS_FORCEINLINE_FUNCTION
+    typename SoA_t::template member_const_reference_type<M>
+    soaRank1Access( const SoA_t& soa, const std::size_t a,
+                    const std::size_t d0, std::true_type )
+{
+    return soaMemberCast<M>( soa )._data[a][d0];
+}
+
 //---------------------------------------------------------------------------//
 
 //! \endcond
@@ -199,7 +261,8 @@ KOKKOS_FORCEINLINE_FUNCTION typename std::enable_if<
     typename SoA_t::template member_reference_type<M>>::type
 get( SoA_t& soa, const std::size_t a, const std::size_t d0 )
 {
-    return Impl::soaMemberCast<M>( soa )._data[d0][a];
+    return Impl::soaRank1Access<M>(
+        soa, a, d0, typename SoA_t::template member_interleaved<M>() );
 }
 
 //! Get Rank-1 const
@@ -209,7 +272,8 @@ KOKKOS_FORCEINLINE_FUNCTION typename std::enable_if<
     typename SoA_t::template member_const_reference_type<M>>::type
 get( const SoA_t& soa, const std::size_t a, const std::size_t d0 )
 {
-    return Impl::soaMemberCast<M>( soa )._data[d0][a];
+    return Impl::soaRank1Access<M>(
+        soa, a, d0, typename SoA_t::template member_interleaved<M>() );
 }
 
 //! Get Rank-2 non-const
@@ -287,6 +351,16 @@ struct SoA<MemberTypes<Types...>, VectorLength>
     template <std::size_t M>
     using member_data_type = typename MemberTypeAtIndex<M, member_types>::type;
 
+    //! Member type as declared, including any storage wrapper.
+    template <std::size_t M>
+    using member_stored_type =
+        typename MemberTypeAtIndex<M, member_types>::stored_type;
+
+    //! Whether the member at index M uses interleaved storage.
+    template <std::size_t M>
+    using member_interleaved =
+        typename Impl::IsInterleaved<member_stored_type<M>>::type;
+
     //! Value type at a given index M.
     template <std::size_t M>
     using member_value_type =
@@ -307,7 +381,7 @@ struct SoA<MemberTypes<Types...>, VectorLength>
 
     //! Base type.
     template <std::size_t M>
-    using base = Impl::StructMember<M, vector_length, member_data_type<M>>;
+    using base = Impl::StructMember<M, vector_length, member_stored_type<M>>;
 
     // -------------------------------
     // Member data type properties.
@@ -341,6 +415,99 @@ struct SoA<MemberTypes<Types...>, VectorLength>
     }
 };
 
+//---------------------------------------------------------------------------//
+// Compile-time member iteration.
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+// Invoke the functor with an integral constant for each member index. The
+// pack expansion is fully unrolled at compile time.
+template <class Functor, std::size_t... M>
+KOKKOS_FORCEINLINE_FUNCTION void forEachMemberIndex( Functor& f,
+                                                     std::index_sequence<M...> )
+{
+    using expander = int[];
+    (void)expander{ 0,
+                    ( f( std::integral_constant<std::size_t, M>() ), 0 )... };
+}
+
+// Invoke the functor with a member index constant and a restrict-qualified
+// pointer to the member data of the given struct.
+template <std::size_t M, class SoA_t, class Functor>
+KOKKOS_FORCEINLINE_FUNCTION void
+forEachMemberApply( SoA_t& soa, Functor& f,
+                    std::integral_constant<std::size_t, M> m )
+{
+    typename SoA_t::template member_pointer_type<M> KOKKOS_RESTRICT ptr =
+        soaMemberPtr<M>( &soa );
+    f( m, ptr );
+}
+
+template <class SoA_t, class Functor, std::size_t... M>
+KOKKOS_FORCEINLINE_FUNCTION void
+forEachMemberPointer( SoA_t& soa, Functor& f, std::index_sequence<M...> )
+{
+    using expander = int[];
+    (void)expander{
+        0, ( forEachMemberApply( soa, f,
+                                 std::integral_constant<std::size_t, M>() ),
+             0 )... };
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Apply a functor to the index of each member of a set of member
+  types.
+
+  \tparam Types The member types to iterate over.
+
+  \tparam Functor The functor type.
+
+  \param f The functor. Called once per member with
+  std::integral_constant<std::size_t,M> for member index M. A generic
+  lambda can recover the index as the constant expression
+  decltype(m)::value and use it as the template argument of get() or
+  slice(). The call sequence is generated at compile time so the member
+  loop is fully unrolled, unlike iteration over a runtime member index.
+*/
+template <class Types, class Functor>
+KOKKOS_FORCEINLINE_FUNCTION
+    typename std::enable_if<is_member_types<Types>::value>::type
+    for_each_member( Functor&& f )
+{
+    Impl::forEachMemberIndex( f, std::make_index_sequence<Types::size>() );
+}
+
+/*!
+  \brief Apply a functor to each member of a struct-of-arrays.
+
+  \tparam SoA_t The SoA type.
+
+  \tparam Functor The functor type.
+
+  \param soa The SoA to access.
+
+  \param f The functor. Called once per member with
+  std::integral_constant<std::size_t,M> for member index M and a
+  restrict-qualified pointer to the first value of member M in the
+  struct. The values of a member are laid out component-major with the
+  array index fastest - the component (d0,d1,d2) of array element a is at
+  ptr[((d0*D1+d1)*D2+d2)*vector_length+a]. Each member gets a distinct
+  restrict-qualified pointer so the compiler can prove members do not
+  alias in generic kernels, matching the codegen of hand-written member
+  access.
+*/
+template <class SoA_t, class Functor>
+KOKKOS_FORCEINLINE_FUNCTION typename std::enable_if<is_soa<SoA_t>::value>::type
+for_each_member( SoA_t& soa, Functor&& f )
+{
+    Impl::forEachMemberPointer(
+        soa, f, std::make_index_sequence<SoA_t::number_of_members>() );
+}
+
 //---------------------------------------------------------------------------//
 
 namespace Impl
@@ -18,12 +18,17 @@
 
 #include <Cabana_AoSoA.hpp>
 #include <Cabana_DeepCopy.hpp>
+#include <Cabana_Profiling.hpp>
 #include <Cabana_Slice.hpp>
+#include <impl/Cabana_CartesianGrid.hpp>
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Sort.hpp>
 
+#include <climits>
+#include <cstdint>
 #include <type_traits>
+#include <vector>
 
 namespace Cabana
 {
@@ -152,6 +157,94 @@ struct is_binning_data<const BinningData<DeviceType>> : public std::true_type
 {
 };
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Host-side summary statistics of bin occupancy.
+
+  Produced by binningStatistics(). The occupancy distribution drives
+  tuning decisions (e.g. rebin frequency, cell size, or team sizes for
+  bin-parallel kernels): a large maximum with a small mean indicates
+  clustering, and a large empty fraction indicates the binned domain is
+  much bigger than the occupied region.
+*/
+struct BinningStatistics
+{
+    //! Number of bins.
+    int num_bin;
+    //! Total number of binned tuples.
+    std::size_t num_tuple;
+    //! Smallest bin count.
+    int min_count;
+    //! Largest bin count.
+    int max_count;
+    //! Mean tuples per bin.
+    double mean_count;
+    //! Number of bins with no tuples.
+    int num_empty;
+    //! Fraction of bins with no tuples.
+    double empty_fraction;
+};
+
+/*!
+  \brief Compute summary statistics of the bin occupancy of a binning.
+
+  One reduction pass over the bin counts - no access to the binned data
+  itself.
+
+  \param bin_data The binning to summarize.
+
+  \return The occupancy statistics on the host.
+*/
+template <class DeviceType>
+BinningStatistics binningStatistics( const BinningData<DeviceType>& bin_data )
+{
+    using execution_space = typename DeviceType::execution_space;
+
+    BinningStatistics stats;
+    stats.num_bin = bin_data.numBin();
+    if ( 0 == stats.num_bin )
+    {
+        stats.num_tuple = 0;
+        stats.min_count = 0;
+        stats.max_count = 0;
+        stats.mean_count = 0.0;
+        stats.num_empty = 0;
+        stats.empty_fraction = 0.0;
+        return stats;
+    }
+
+    long total = 0;
+    int min_count = 0;
+    int max_count = 0;
+    int num_empty = 0;
+    Kokkos::parallel_reduce(
+        "Cabana::binningStatistics",
+        Kokkos::RangePolicy<execution_space>( 0, stats.num_bin ),
+        KOKKOS_LAMBDA( const int i, long& total_result, int& min_result,
+                       int& max_result, int& empty_result ) {
+            int count = bin_data.binSize( i );
+            total_result += count;
+            if ( count < min_result )
+                min_result = count;
+            if ( count > max_result )
+                max_result = count;
+            if ( 0 == count )
+                ++empty_result;
+        },
+        Kokkos::Sum<long>( total ), Kokkos::Min<int>( min_count ),
+        Kokkos::Max<int>( max_count ), Kokkos::Sum<int>( num_empty ) );
+    Kokkos::fence();
+
+    stats.num_tuple = total;
+    stats.min_count = min_count;
+    stats.max_count = max_count;
+    stats.mean_count = static_cast<double>( total ) / stats.num_bin;
+    stats.num_empty = num_empty;
+    stats.empty_fraction =
+        static_cast<double>( num_empty ) / stats.num_bin;
+    return stats;
+}
+
 namespace Impl
 {
 //---------------------------------------------------------------------------//
@@ -198,6 +291,10 @@ BinningData<DeviceType>
 kokkosBinSort1d( KeyViewType keys, const int nbin, const bool sort_within_bins,
                  const std::size_t begin, const std::size_t end )
 {
+    Profiling::ScopedRegion region( sort_within_bins ? "Cabana::sortByKey"
+                                                     : "Cabana::binByKey" );
+    Profiling::addCounter( "Cabana::Sort::keys_binned", end - begin );
+
     // Find the minimum and maximum key values.
     auto key_bounds =
         Impl::keyMinMax<KeyViewType, DeviceType>( keys, begin, end );
@@ -211,6 +308,102 @@ kokkosBinSort1d( KeyViewType keys, const int nbin, const bool sort_within_bins,
         keys, comp, sort_within_bins, begin, end );
 }
 
+//---------------------------------------------------------------------------//
+//! Bin a view of keys over a subset of its range with a linear counting pass
+//! instead of a full Kokkos::BinSort. A range that is already in bin order
+//! keeps an identity permutation so steady-state rebinning after a spatial
+//! sort costs a single sweep over the keys.
+template <class KeyViewType,
+          class DeviceType = typename KeyViewType::device_type>
+BinningData<DeviceType> kokkosCountingBin( KeyViewType keys, const int nbin,
+                                           const std::size_t begin,
+                                           const std::size_t end )
+{
+    using execution_space = typename DeviceType::execution_space;
+    using memory_space = typename DeviceType::memory_space;
+    using size_type = typename memory_space::size_type;
+
+    const std::size_t n = end - begin;
+
+    // Match the Kokkos::BinOp1D binning used by binByKey: nbin equal
+    // divisions of the key range plus one extra bin holding the maximum key.
+    auto key_bounds = keyMinMax<KeyViewType, DeviceType>( keys, begin, end );
+    const auto key_min = key_bounds.min_val;
+    const int num_bin = nbin + 1;
+    const double mul = ( key_bounds.max_val > key_bounds.min_val )
+                           ? static_cast<double>( nbin ) /
+                                 ( key_bounds.max_val - key_bounds.min_val )
+                           : 0.0;
+
+    // Locate each key and count the bin sizes. Also count how many elements
+    // sit in a lower bin than their predecessor - if none do the range is
+    // already in bin order and nothing has to move.
+    Kokkos::View<int*, DeviceType> bin_ids(
+        Kokkos::ViewAllocateWithoutInitializing( "bin_ids" ), n );
+    Kokkos::View<int*, DeviceType> counts( "bin_count", num_bin );
+    Kokkos::RangePolicy<execution_space> exec_policy( 0, n );
+    std::size_t num_unsorted = 0;
+    auto count_op = KOKKOS_LAMBDA( const std::size_t i, std::size_t& unsorted )
+    {
+        int bin = static_cast<int>( mul * ( keys( begin + i ) - key_min ) );
+        bin_ids( i ) = bin;
+        Kokkos::atomic_increment( &counts( bin ) );
+        if ( i > 0 && bin < static_cast<int>(
+                                mul * ( keys( begin + i - 1 ) - key_min ) ) )
+            ++unsorted;
+    };
+    Kokkos::parallel_reduce( "Cabana::kokkosCountingBin::count_op",
+                             exec_policy, count_op, num_unsorted );
+
+    // Exclusive scan of the counts gives the bin offsets.
+    Kokkos::View<size_type*, DeviceType> offsets(
+        Kokkos::ViewAllocateWithoutInitializing( "bin_offset" ), num_bin );
+    auto offset_op = KOKKOS_LAMBDA( const int b, size_type& update,
+                                    const bool final_pass )
+    {
+        if ( final_pass )
+            offsets( b ) = update;
+        update += counts( b );
+    };
+    Kokkos::parallel_scan( "Cabana::kokkosCountingBin::offset_op",
+                           Kokkos::RangePolicy<execution_space>( 0, num_bin ),
+                           offset_op );
+
+    // Build the permutation vector.
+    Kokkos::View<size_type*, DeviceType> permute(
+        Kokkos::ViewAllocateWithoutInitializing( "permute" ), n );
+    if ( 0 == num_unsorted )
+    {
+        // Already in bin order - the permutation is the identity.
+        auto identity_op = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            permute( i ) = begin + i;
+        };
+        Kokkos::parallel_for( "Cabana::kokkosCountingBin::identity_op",
+                              exec_policy, identity_op );
+    }
+    else
+    {
+        // Scatter through per-bin fill counters. Elements already in their
+        // bin's range stay inside it - only bin-crossing elements move
+        // across bin boundaries.
+        Kokkos::View<size_type*, DeviceType> bin_fill( "bin_fill", num_bin );
+        auto scatter_op = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            int bin = bin_ids( i );
+            size_type j = offsets( bin ) + Kokkos::atomic_fetch_add(
+                                               &bin_fill( bin ),
+                                               static_cast<size_type>( 1 ) );
+            permute( j ) = begin + i;
+        };
+        Kokkos::parallel_for( "Cabana::kokkosCountingBin::scatter_op",
+                              exec_policy, scatter_op );
+    }
+    Kokkos::fence();
+
+    return BinningData<DeviceType>( begin, end, counts, offsets, permute );
+}
+
 //---------------------------------------------------------------------------//
 //! Copy the a 1D slice into a Kokkos view.
 template <class SliceType, class DeviceType = typename SliceType::device_type>
@@ -233,6 +426,130 @@ copySliceToKeys( SliceType slice )
     return keys;
 }
 
+//---------------------------------------------------------------------------//
+//! Spread the lower 21 bits of an integer so two zero bits separate each
+//! original bit, the building block of a 3d Morton code.
+KOKKOS_INLINE_FUNCTION
+uint64_t spreadBits3( uint64_t x )
+{
+    x &= 0x1fffff;
+    x = ( x | x << 32 ) & 0x1f00000000ffff;
+    x = ( x | x << 16 ) & 0x1f0000ff0000ff;
+    x = ( x | x << 8 ) & 0x100f00f00f00f00f;
+    x = ( x | x << 4 ) & 0x10c30c30c30c30c3;
+    x = ( x | x << 2 ) & 0x1249249249249249;
+    return x;
+}
+
+//---------------------------------------------------------------------------//
+//! Interleave the bits of a 3d cell index into a Morton code. Cells that
+//! are close on the Z-order space-filling curve are close in space in all
+//! three dimensions.
+KOKKOS_INLINE_FUNCTION
+uint64_t mortonKey( const int i, const int j, const int k )
+{
+    return spreadBits3( i ) | ( spreadBits3( j ) << 1 ) |
+           ( spreadBits3( k ) << 2 );
+}
+
+//---------------------------------------------------------------------------//
+//! Sort a view of integer keys over a subset of its range with a stable
+//! least-significant-bit radix sort and return the result as single-bin
+//! binning data. The keys are first shifted so the minimum maps to zero and
+//! only the bits in which the shifted keys actually differ are processed.
+template <class KeyViewType,
+          class DeviceType = typename KeyViewType::device_type>
+BinningData<DeviceType> kokkosRadixSort( KeyViewType keys,
+                                         const std::size_t begin,
+                                         const std::size_t end )
+{
+    using execution_space = typename DeviceType::execution_space;
+    using memory_space = typename DeviceType::memory_space;
+    using size_type = typename memory_space::size_type;
+    using key_type = typename KeyViewType::non_const_value_type;
+    using unsigned_key_type = typename std::make_unsigned<key_type>::type;
+
+    static_assert( std::is_integral<key_type>::value,
+                   "Radix sort requires integer keys" );
+
+    Profiling::ScopedRegion region( "Cabana::sortByKeyRadix" );
+    Profiling::addCounter( "Cabana::Sort::keys_binned", end - begin );
+
+    const std::size_t n = end - begin;
+
+    // Find the key bounds and the number of significant bits in the shifted
+    // key range. The count is bounded at the key width so a range spanning
+    // every bit does not shift past it.
+    auto key_bounds = keyMinMax<KeyViewType, DeviceType>( keys, begin, end );
+    const key_type key_min = key_bounds.min_val;
+    const unsigned_key_type key_range =
+        static_cast<unsigned_key_type>( key_bounds.max_val ) -
+        static_cast<unsigned_key_type>( key_bounds.min_val );
+    constexpr int max_bits = CHAR_BIT * sizeof( unsigned_key_type );
+    int num_bits = 0;
+    while ( num_bits < max_bits && ( key_range >> num_bits ) )
+        ++num_bits;
+
+    // Ping-pong buffers for the shifted keys and the permutation vector.
+    Kokkos::View<unsigned_key_type*, DeviceType> key_src(
+        Kokkos::ViewAllocateWithoutInitializing( "radix_key_src" ), n );
+    Kokkos::View<unsigned_key_type*, DeviceType> key_dst(
+        Kokkos::ViewAllocateWithoutInitializing( "radix_key_dst" ), n );
+    Kokkos::View<size_type*, DeviceType> perm_src(
+        Kokkos::ViewAllocateWithoutInitializing( "radix_perm_src" ), n );
+    Kokkos::View<size_type*, DeviceType> perm_dst(
+        Kokkos::ViewAllocateWithoutInitializing( "radix_perm_dst" ), n );
+    Kokkos::View<size_type*, DeviceType> zero_rank(
+        Kokkos::ViewAllocateWithoutInitializing( "radix_zero_rank" ), n );
+
+    Kokkos::RangePolicy<execution_space> exec_policy( 0, n );
+    auto init_op = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        key_src( i ) = static_cast<unsigned_key_type>( keys( begin + i ) ) -
+                       static_cast<unsigned_key_type>( key_min );
+        perm_src( i ) = begin + i;
+    };
+    Kokkos::parallel_for( "Cabana::kokkosRadixSort::init_op", exec_policy,
+                          init_op );
+
+    // Split on each significant bit, lowest first. Elements with a zero bit
+    // keep their relative order ahead of those with a one bit so each pass
+    // is stable and the full pass sequence sorts the keys.
+    for ( int bit = 0; bit < num_bits; ++bit )
+    {
+        size_type num_zero = 0;
+        auto rank_op = KOKKOS_LAMBDA( const std::size_t i, size_type& update,
+                                      const bool final_pass )
+        {
+            if ( final_pass )
+                zero_rank( i ) = update;
+            if ( !( ( key_src( i ) >> bit ) & 1 ) )
+                ++update;
+        };
+        Kokkos::parallel_scan( "Cabana::kokkosRadixSort::rank_op", exec_policy,
+                               rank_op, num_zero );
+        auto scatter_op = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            std::size_t j = ( ( key_src( i ) >> bit ) & 1 )
+                                ? num_zero + ( i - zero_rank( i ) )
+                                : zero_rank( i );
+            key_dst( j ) = key_src( i );
+            perm_dst( j ) = perm_src( i );
+        };
+        Kokkos::parallel_for( "Cabana::kokkosRadixSort::scatter_op",
+                              exec_policy, scatter_op );
+        std::swap( key_src, key_dst );
+        std::swap( perm_src, perm_dst );
+    }
+    Kokkos::fence();
+
+    // A fully sorted range is a single bin.
+    Kokkos::View<int*, DeviceType> counts( "radix_bin_count", 1 );
+    Kokkos::View<size_type*, DeviceType> offsets( "radix_bin_offset", 1 );
+    Kokkos::deep_copy( counts, static_cast<int>( n ) );
+    return BinningData<DeviceType>( begin, end, counts, offsets, perm_src );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Impl
@@ -410,6 +727,185 @@ sortByKey( KeyViewType keys,
     return sortByKey<KeyViewType, DeviceType>( keys, 0, keys.extent( 0 ) );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an AoSoA over a subset of its range based on the associated key
+  values using a radix sort.
+
+  \tparam KeyViewType The Kokkos::View type for keys.
+
+  \param keys The key values to use for sorting. A key value is needed for
+  every element of the AoSoA.
+
+  \param begin The beginning index of the AoSoA range to sort.
+
+  \param end The end index of the AoSoA range to sort.
+
+  \return The permutation vector associated with the sorting.
+
+  Produces the same fully-sorted ordering as \c sortByKey but avoids the
+  bin-and-compare machinery of Kokkos::BinSort, which is considerably faster
+  for large integer key sets. Radix sorting requires integer keys - for other
+  key types this overload falls back to \c sortByKey.
+*/
+template <class KeyViewType,
+          class DeviceType = typename KeyViewType::device_type>
+BinningData<DeviceType> sortByKeyRadix(
+    KeyViewType keys, const std::size_t begin, const std::size_t end,
+    typename std::enable_if<
+        ( Kokkos::is_view<KeyViewType>::value &&
+          std::is_integral<
+              typename KeyViewType::non_const_value_type>::value ),
+        int>::type* = 0 )
+{
+    return Impl::kokkosRadixSort<KeyViewType, DeviceType>( keys, begin, end );
+}
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+// Radix sorting is only available for integer keys. Fall back to the
+// Kokkos::BinSort implementation for other key types.
+template <class KeyViewType,
+          class DeviceType = typename KeyViewType::device_type>
+BinningData<DeviceType> sortByKeyRadix(
+    KeyViewType keys, const std::size_t begin, const std::size_t end,
+    typename std::enable_if<
+        ( Kokkos::is_view<KeyViewType>::value &&
+          !std::is_integral<
+              typename KeyViewType::non_const_value_type>::value ),
+        int>::type* = 0 )
+{
+    return sortByKey<KeyViewType, DeviceType>( keys, begin, end );
+}
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an entire AoSoA based on the associated key values using a
+  radix sort.
+
+  \tparam KeyViewType The Kokkos::View type for keys.
+
+  \param keys The key values to use for sorting. A key value is needed for
+  every element of the AoSoA.
+
+  \return The permutation vector associated with the sorting.
+*/
+template <class KeyViewType,
+          class DeviceType = typename KeyViewType::device_type>
+BinningData<DeviceType> sortByKeyRadix(
+    KeyViewType keys,
+    typename std::enable_if<( Kokkos::is_view<KeyViewType>::value ),
+                            int>::type* = 0 )
+{
+    return sortByKeyRadix<KeyViewType, DeviceType>( keys, 0,
+                                                    keys.extent( 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an AoSoA over a subset of its range lexicographically by a
+  primary and a secondary key.
+
+  \tparam KeyViewType The Kokkos::View type for the primary keys.
+
+  \tparam SecondKeyViewType The Kokkos::View type for the secondary keys.
+
+  \param first_keys The primary key values. Elements are ordered by this key
+  first. A key value is needed for every element of the AoSoA.
+
+  \param second_keys The secondary key values. Elements with equal primary
+  keys are ordered by this key. A key value is needed for every element of
+  the AoSoA.
+
+  \param begin The beginning index of the AoSoA range to sort.
+
+  \param end The end index of the AoSoA range to sort.
+
+  \return The permutation vector associated with the sorting.
+
+  Both keys must be integers. The keys are fused into a single composite
+  key, so one sort and one permutation produce the two-level ordering (e.g.
+  cell-then-species) that would otherwise take two full sort and permute
+  passes. The product of the two key ranges must fit in 64 bits.
+*/
+template <class KeyViewType, class SecondKeyViewType,
+          class DeviceType = typename KeyViewType::device_type>
+BinningData<DeviceType> sortByKeys(
+    KeyViewType first_keys, SecondKeyViewType second_keys,
+    const std::size_t begin, const std::size_t end,
+    typename std::enable_if<( Kokkos::is_view<KeyViewType>::value &&
+                              Kokkos::is_view<SecondKeyViewType>::value ),
+                            int>::type* = 0 )
+{
+    static_assert(
+        std::is_integral<typename KeyViewType::non_const_value_type>::value &&
+            std::is_integral<
+                typename SecondKeyViewType::non_const_value_type>::value,
+        "Lexicographic sorting requires integer keys" );
+
+    // Shift both keys to a zero base and fuse them into a composite key
+    // that orders by the primary key first.
+    auto first_bounds =
+        Impl::keyMinMax<KeyViewType, DeviceType>( first_keys, begin, end );
+    auto second_bounds = Impl::keyMinMax<SecondKeyViewType, DeviceType>(
+        second_keys, begin, end );
+    const auto first_min = first_bounds.min_val;
+    const auto second_min = second_bounds.min_val;
+    const uint64_t second_range =
+        static_cast<uint64_t>( second_bounds.max_val -
+                               second_bounds.min_val ) +
+        1;
+
+    Kokkos::View<uint64_t*, DeviceType> composite_keys(
+        Kokkos::ViewAllocateWithoutInitializing( "composite_keys" ),
+        first_keys.extent( 0 ) );
+    Kokkos::RangePolicy<typename DeviceType::execution_space> exec_policy(
+        begin, end );
+    auto fuse_op = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        composite_keys( i ) =
+            static_cast<uint64_t>( first_keys( i ) - first_min ) *
+                second_range +
+            static_cast<uint64_t>( second_keys( i ) - second_min );
+    };
+    Kokkos::parallel_for( "Cabana::sortByKeys::fuse_op", exec_policy,
+                          fuse_op );
+    Kokkos::fence();
+
+    return sortByKeyRadix<decltype( composite_keys ), DeviceType>(
+        composite_keys, begin, end );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an entire AoSoA lexicographically by a primary and a secondary
+  key.
+
+  \tparam KeyViewType The Kokkos::View type for the primary keys.
+
+  \tparam SecondKeyViewType The Kokkos::View type for the secondary keys.
+
+  \param first_keys The primary key values. A key value is needed for every
+  element of the AoSoA.
+
+  \param second_keys The secondary key values. A key value is needed for
+  every element of the AoSoA.
+
+  \return The permutation vector associated with the sorting.
+*/
+template <class KeyViewType, class SecondKeyViewType,
+          class DeviceType = typename KeyViewType::device_type>
+BinningData<DeviceType> sortByKeys(
+    KeyViewType first_keys, SecondKeyViewType second_keys,
+    typename std::enable_if<( Kokkos::is_view<KeyViewType>::value &&
+                              Kokkos::is_view<SecondKeyViewType>::value ),
+                            int>::type* = 0 )
+{
+    return sortByKeys<KeyViewType, SecondKeyViewType, DeviceType>(
+        first_keys, second_keys, 0, first_keys.extent( 0 ) );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Bin an AoSoA over a subset of its range based on the associated key
@@ -510,6 +1006,69 @@ BinningData<DeviceType> sortByKey(
     return sortByKey<SliceType, DeviceType>( slice, 0, slice.size() );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an AoSoA over a subset of its range lexicographically by a
+  primary and a secondary slice of keys.
+
+  \tparam SliceType Slice type for the primary keys.
+
+  \tparam SecondSliceType Slice type for the secondary keys.
+
+  \param first_slice Slice of primary keys.
+
+  \param second_slice Slice of secondary keys.
+
+  \param begin The beginning index of the AoSoA range to sort.
+
+  \param end The end index of the AoSoA range to sort.
+
+  \return The permutation vector associated with the sorting.
+*/
+template <class SliceType, class SecondSliceType,
+          class DeviceType = typename SliceType::device_type>
+BinningData<DeviceType> sortByKeys(
+    SliceType first_slice, SecondSliceType second_slice,
+    const std::size_t begin, const std::size_t end,
+    typename std::enable_if<( is_slice<SliceType>::value &&
+                              is_slice<SecondSliceType>::value ),
+                            int>::type* = 0 )
+{
+    auto first_keys = Impl::copySliceToKeys<SliceType, DeviceType>(
+        first_slice );
+    auto second_keys = Impl::copySliceToKeys<SecondSliceType, DeviceType>(
+        second_slice );
+    return sortByKeys<decltype( first_keys ), decltype( second_keys ),
+                      DeviceType>( first_keys, second_keys, begin, end );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an entire AoSoA lexicographically by a primary and a secondary
+  slice of keys.
+
+  \tparam SliceType Slice type for the primary keys.
+
+  \tparam SecondSliceType Slice type for the secondary keys.
+
+  \param first_slice Slice of primary keys.
+
+  \param second_slice Slice of secondary keys.
+
+  \return The permutation vector associated with the sorting.
+*/
+template <class SliceType, class SecondSliceType,
+          class DeviceType = typename SliceType::device_type>
+BinningData<DeviceType> sortByKeys(
+    SliceType first_slice, SecondSliceType second_slice,
+    typename std::enable_if<( is_slice<SliceType>::value &&
+                              is_slice<SecondSliceType>::value ),
+                            int>::type* = 0 )
+{
+    return sortByKeys<SliceType, SecondSliceType, DeviceType>(
+        first_slice, second_slice, 0, first_slice.size() );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Bin an AoSoA over a subset of its range based on the associated
@@ -559,6 +1118,218 @@ BinningData<DeviceType> binByKey(
     return binByKey<SliceType, DeviceType>( slice, nbin, 0, slice.size() );
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin an AoSoA over a subset of its range based on the associated key
+  values and number of bins with a linear counting pass.
+
+  \tparam KeyViewType The Kokkos::View type for keys.
+
+  \param keys The key values to use for binning. A key value is needed for
+  every element of the AoSoA.
+
+  \param nbin The number of bins to use for binning. The range of key values
+  will subdivided equally by the number of bins.
+
+  \param begin The beginning index of the AoSoA range to bin.
+
+  \param end The end index of the AoSoA range to bin.
+
+  \return The binning data (e.g. bin sizes and offsets).
+
+  Produces the same bins as \c binByKey but replaces the Kokkos::BinSort
+  machinery with a counting pass, which makes rebinning linear in the number
+  of elements. A range that is already in bin order - the steady state when
+  particles were previously sorted and few have crossed bins since - is
+  detected and keeps an identity permutation, so only bin-crossing particles
+  change position in the permuted layout. The order of elements within a bin
+  is otherwise unspecified, as with \c binByKey.
+*/
+template <class KeyViewType,
+          class DeviceType = typename KeyViewType::device_type>
+BinningData<DeviceType> binByKeyIncremental(
+    KeyViewType keys, const int nbin, const std::size_t begin,
+    const std::size_t end,
+    typename std::enable_if<( Kokkos::is_view<KeyViewType>::value ),
+                            int>::type* = 0 )
+{
+    return Impl::kokkosCountingBin<KeyViewType, DeviceType>( keys, nbin,
+                                                             begin, end );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin an entire AoSoA based on the associated key values and number of
+  bins with a linear counting pass.
+
+  \tparam KeyViewType The Kokkos::View type for keys.
+
+  \param keys The key values to use for binning. A key value is needed for
+  every element of the AoSoA.
+
+  \param nbin The number of bins to use for binning. The range of key values
+  will subdivided equally by the number of bins.
+
+  \return The binning data (e.g. bin sizes and offsets).
+*/
+template <class KeyViewType,
+          class DeviceType = typename KeyViewType::device_type>
+BinningData<DeviceType> binByKeyIncremental(
+    KeyViewType keys, const int nbin,
+    typename std::enable_if<( Kokkos::is_view<KeyViewType>::value ),
+                            int>::type* = 0 )
+{
+    return binByKeyIncremental<KeyViewType, DeviceType>( keys, nbin, 0,
+                                                         keys.extent( 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin an AoSoA over a subset of its range based on the associated
+  slice of keys with a linear counting pass.
+
+  \tparam SliceType Slice type for keys.
+
+  \param slice Slice of keys.
+
+  \param nbin The number of bins to use for binning. The range of key values
+  will subdivided equally by the number of bins.
+
+  \param begin The beginning index of the AoSoA range to bin.
+
+  \param end The end index of the AoSoA range to bin.
+
+  \return The binning data (e.g. bin sizes and offsets).
+*/
+template <class SliceType, class DeviceType = typename SliceType::device_type>
+BinningData<DeviceType> binByKeyIncremental(
+    SliceType slice, const int nbin, const std::size_t begin,
+    const std::size_t end,
+    typename std::enable_if<( is_slice<SliceType>::value ), int>::type* = 0 )
+{
+    auto keys = Impl::copySliceToKeys<SliceType, DeviceType>( slice );
+    return binByKeyIncremental<decltype( keys ), DeviceType>( keys, nbin,
+                                                              begin, end );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Bin an entire AoSoA based on the associated slice of keys with a
+  linear counting pass.
+
+  \tparam SliceType Slice type for keys.
+
+  \param slice Slice of keys.
+
+  \param nbin The number of bins to use for binning. The range of key values
+  will subdivided equally by the number of bins.
+
+  \return The binning data (e.g. bin sizes and offsets).
+*/
+template <class SliceType, class DeviceType = typename SliceType::device_type>
+BinningData<DeviceType> binByKeyIncremental(
+    SliceType slice, const int nbin,
+    typename std::enable_if<( is_slice<SliceType>::value ), int>::type* = 0 )
+{
+    return binByKeyIncremental<SliceType, DeviceType>( slice, nbin, 0,
+                                                       slice.size() );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an AoSoA over a subset of its range along a Morton
+  space-filling curve over a 3d Cartesian grid.
+
+  \tparam PositionSliceType Slice type for positions.
+
+  \param positions Slice of particle positions.
+
+  \param grid_delta Grid sizes in each cardinal direction.
+
+  \param grid_min Grid minimum value in each direction.
+
+  \param grid_max Grid maximum value in each direction.
+
+  \param begin The beginning index of the AoSoA range to sort.
+
+  \param end The end index of the AoSoA range to sort.
+
+  \return The binning data (e.g. bin sizes and offsets).
+
+  Ordering by linearized cell index keeps particles of one row of cells
+  adjacent but jumps across the domain at every row boundary. The Morton
+  order interleaves the cell index bits so particles that are close in all
+  three dimensions stay close in the container, which improves the cache
+  behavior of neighbor traversals over the permuted data.
+*/
+template <class PositionSliceType,
+          class DeviceType = typename PositionSliceType::device_type>
+BinningData<DeviceType> sortByMortonKey(
+    PositionSliceType positions,
+    const typename PositionSliceType::value_type grid_delta[3],
+    const typename PositionSliceType::value_type grid_min[3],
+    const typename PositionSliceType::value_type grid_max[3],
+    const std::size_t begin, const std::size_t end,
+    typename std::enable_if<( is_slice<PositionSliceType>::value ),
+                            int>::type* = 0 )
+{
+    // Construct the grid.
+    Impl::CartesianGrid<double> grid( grid_min[0], grid_min[1], grid_min[2],
+                                      grid_max[0], grid_max[1], grid_max[2],
+                                      grid_delta[0], grid_delta[1],
+                                      grid_delta[2] );
+
+    // Compute the Morton code of each particle's cell.
+    Kokkos::View<uint64_t*, DeviceType> keys(
+        Kokkos::ViewAllocateWithoutInitializing( "morton_keys" ),
+        positions.size() );
+    Kokkos::RangePolicy<typename DeviceType::execution_space> exec_policy(
+        0, positions.size() );
+    auto key_op = KOKKOS_LAMBDA( const std::size_t p )
+    {
+        int i, j, k;
+        grid.locatePoint( positions( p, 0 ), positions( p, 1 ),
+                          positions( p, 2 ), i, j, k );
+        keys( p ) = Impl::mortonKey( i, j, k );
+    };
+    Kokkos::parallel_for( "Cabana::sortByMortonKey::key_op", exec_policy,
+                          key_op );
+    Kokkos::fence();
+
+    return sortByKey<decltype( keys ), DeviceType>( keys, begin, end );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Sort an entire AoSoA along a Morton space-filling curve over a 3d
+  Cartesian grid.
+
+  \tparam PositionSliceType Slice type for positions.
+
+  \param positions Slice of particle positions.
+
+  \param grid_delta Grid sizes in each cardinal direction.
+
+  \param grid_min Grid minimum value in each direction.
+
+  \param grid_max Grid maximum value in each direction.
+
+  \return The binning data (e.g. bin sizes and offsets).
+*/
+template <class PositionSliceType,
+          class DeviceType = typename PositionSliceType::device_type>
+BinningData<DeviceType> sortByMortonKey(
+    PositionSliceType positions,
+    const typename PositionSliceType::value_type grid_delta[3],
+    const typename PositionSliceType::value_type grid_min[3],
+    const typename PositionSliceType::value_type grid_max[3],
+    typename std::enable_if<( is_slice<PositionSliceType>::value ),
+                            int>::type* = 0 )
+{
+    return sortByMortonKey<PositionSliceType, DeviceType>(
+        positions, grid_delta, grid_min, grid_max, 0, positions.size() );
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Given binning data permute an AoSoA.
@@ -579,9 +1350,59 @@ void permute(
                               is_aosoa<AoSoA_t>::value ),
                             int>::type* = 0 )
 {
+    Profiling::ScopedRegion region( "Cabana::permute" );
+
     auto begin = binning_data.rangeBegin();
     auto end = binning_data.rangeEnd();
 
+    // If the range is struct-aligned we can stage the permutation directly
+    // in SoA layout and copy whole structs back instead of converting every
+    // element through an AoS tuple. The struct assignment is a fixed-size
+    // copy the compiler turns into full cache line moves. A partial struct
+    // at the end of the container is safe to copy whole because the lanes
+    // past the size are never read.
+    constexpr int vector_length = AoSoA_t::vector_length;
+    if ( 0 == begin % vector_length &&
+         ( 0 == end % vector_length || end == aosoa.size() ) )
+    {
+        using soa_type = typename AoSoA_t::soa_type;
+        std::size_t s_begin = begin / vector_length;
+        std::size_t num_soa =
+            ( end - begin + vector_length - 1 ) / vector_length;
+
+        Kokkos::View<soa_type*, DeviceType> scratch_soa(
+            Kokkos::ViewAllocateWithoutInitializing( "scratch_soa" ),
+            num_soa );
+
+        auto permute_to_scratch = KOKKOS_LAMBDA( const std::size_t i )
+        {
+            auto permute_i = binning_data.permutation( i - begin );
+            Impl::tupleCopy(
+                scratch_soa( ( i - begin ) / vector_length ),
+                ( i - begin ) % vector_length,
+                aosoa.access( AoSoA_t::index_type::s( permute_i ) ),
+                AoSoA_t::index_type::a( permute_i ) );
+        };
+        Kokkos::parallel_for(
+            "Cabana::kokkosBinSort::permute_to_scratch",
+            Kokkos::RangePolicy<typename DeviceType::execution_space>( begin,
+                                                                       end ),
+            permute_to_scratch );
+        Kokkos::fence();
+
+        auto copy_back = KOKKOS_LAMBDA( const std::size_t s )
+        {
+            aosoa.access( s_begin + s ) = scratch_soa( s );
+        };
+        Kokkos::parallel_for(
+            "Cabana::kokkosBinSort::copy_back",
+            Kokkos::RangePolicy<typename DeviceType::execution_space>(
+                0, num_soa ),
+            copy_back );
+        Kokkos::fence();
+        return;
+    }
+
     Kokkos::View<typename AoSoA_t::tuple_type*, DeviceType> scratch_tuples(
         Kokkos::ViewAllocateWithoutInitializing( "scratch_tuples" ),
         end - begin );
@@ -608,6 +1429,106 @@ void permute(
     Kokkos::fence();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Given binning data permute an AoSoA in place.
+
+  \tparam BinningDataType The binning data type.
+
+  \tparam AoSoA_t The AoSoA type.
+
+  \param binning_data The binning data.
+
+  \param aosoa The AoSoA to permute.
+
+  Instead of staging the permuted data in a scratch AoSoA this follows the
+  cycles of the permutation and moves one tuple at a time, so the only
+  auxiliary storage is proportional to the number of indices rather than
+  the tuple size. Use this variant when the container is too large to
+  afford a full scratch copy; the cycle schedule is built on the host and
+  parallelism is over cycles, so permute() is generally faster when the
+  memory for a scratch copy is available.
+ */
+template <class BinningDataType, class AoSoA_t,
+          class DeviceType = typename BinningDataType::device_type>
+void permuteInPlace(
+    const BinningDataType& binning_data, AoSoA_t& aosoa,
+    typename std::enable_if<( is_binning_data<BinningDataType>::value &&
+                              is_aosoa<AoSoA_t>::value ),
+                            int>::type* = 0 )
+{
+    Profiling::ScopedRegion region( "Cabana::permuteInPlace" );
+
+    using size_type = typename BinningDataType::size_type;
+
+    auto begin = binning_data.rangeBegin();
+    auto end = binning_data.rangeEnd();
+    std::size_t num_tuples = end - begin;
+
+    // Copy the permutation vector to the host to decompose it into cycles.
+    // The binning permutation takes a range-relative index but returns an
+    // absolute tuple index - normalize to range-relative so the cycle
+    // arithmetic below works for subset ranges.
+    Kokkos::View<size_type*, DeviceType> permutation(
+        Kokkos::ViewAllocateWithoutInitializing( "permutation" ), num_tuples );
+    auto extract_permutation = KOKKOS_LAMBDA( const std::size_t i )
+    {
+        permutation( i ) = binning_data.permutation( i ) - begin;
+    };
+    Kokkos::parallel_for(
+        "Cabana::permuteInPlace::extract_permutation",
+        Kokkos::RangePolicy<typename DeviceType::execution_space>(
+            0, num_tuples ),
+        extract_permutation );
+    Kokkos::fence();
+    auto host_permutation = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), permutation );
+
+    // Find the first index of every non-trivial cycle.
+    std::vector<size_type> host_leaders;
+    std::vector<bool> visited( num_tuples, false );
+    for ( std::size_t i = 0; i < num_tuples; ++i )
+    {
+        if ( visited[i] || host_permutation( i ) == i )
+            continue;
+        host_leaders.push_back( i );
+        for ( size_type j = i; !visited[j]; j = host_permutation( j ) )
+            visited[j] = true;
+    }
+    Kokkos::View<size_type*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+        leaders_unmanaged( host_leaders.data(), host_leaders.size() );
+    Kokkos::View<size_type*, DeviceType> leaders(
+        Kokkos::ViewAllocateWithoutInitializing( "cycle_leaders" ),
+        host_leaders.size() );
+    Kokkos::deep_copy( leaders, leaders_unmanaged );
+
+    // Walk each cycle with a single tuple of scratch, moving every tuple
+    // directly to its final position.
+    auto walk_cycle = KOKKOS_LAMBDA( const std::size_t c )
+    {
+        auto leader = leaders( c );
+        auto tmp = aosoa.getTuple( begin + leader );
+        auto i = leader;
+        while ( true )
+        {
+            auto j = permutation( i );
+            if ( j == leader )
+            {
+                aosoa.setTuple( begin + i, tmp );
+                break;
+            }
+            aosoa.setTuple( begin + i, aosoa.getTuple( begin + j ) );
+            i = j;
+        }
+    };
+    Kokkos::parallel_for(
+        "Cabana::permuteInPlace::walk_cycle",
+        Kokkos::RangePolicy<typename DeviceType::execution_space>(
+            0, host_leaders.size() ),
+        walk_cycle );
+    Kokkos::fence();
+}
+
 //---------------------------------------------------------------------------//
 /*!
   \brief Given binning data permute a slice.
@@ -628,6 +1549,7 @@ void permute(
                               is_slice<SliceType>::value ),
                             int>::type* = 0 )
 {
+    Profiling::ScopedRegion region( "Cabana::permute" );
 
     auto begin = binning_data.rangeBegin();
     auto end = binning_data.rangeEnd();
@@ -0,0 +1,316 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_SplitAoSoA.hpp
+  \brief Particle storage split into hot and cold member groups
+*/
+#ifndef CABANA_SPLITAOSOA_HPP
+#define CABANA_SPLITAOSOA_HPP
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_MemberTypes.hpp>
+#include <Cabana_Slice.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <string>
+#include <type_traits>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Particle storage partitioned into hot and cold member groups with
+  independent memory spaces.
+
+  A single AoSoA interleaves all members in one block, so members touched
+  only rarely (e.g. diagnostic fields written at output) still occupy space
+  in every struct a hot kernel sweeps through and consume memory in the hot
+  memory space. This container partitions the member types into two groups
+  stored as separate AoSoAs: a hot group in the primary device memory and a
+  cold group that may live in a different space (e.g. host-pinned memory on
+  a GPU system). Hot kernels then stream pure hot data and the cold bytes
+  never consume device memory.
+
+  Members are indexed through the concatenation of the two groups: indices
+  [0, hot_members) address the hot group and [hot_members,
+  number_of_members) address the cold group. slice() on this container
+  resolves the group transparently, so member access reads the same as on a
+  plain AoSoA. Both groups share the vector length, so a particle has the
+  same tuple index in both and the container resizes them together.
+  Kernels touching cold members must execute in a space that can access the
+  cold memory.
+
+  \tparam HotTypes MemberTypes of the hot group.
+
+  \tparam ColdTypes MemberTypes of the cold group.
+
+  \tparam DeviceType Device type of the hot group.
+
+  \tparam ColdDeviceType (optional) Device type of the cold group. Defaults
+  to the hot device type.
+
+  \tparam VectorLength (optional) The vector length within the structs of
+  both groups. If not specified, this defaults to the preferred layout for
+  the hot <tt>DeviceType</tt>.
+*/
+template <class HotTypes, class ColdTypes, class DeviceType,
+          class ColdDeviceType = DeviceType,
+          int VectorLength = Impl::PerformanceTraits<
+              typename DeviceType::execution_space>::vector_length>
+class SplitAoSoA
+{
+  public:
+    //! SplitAoSoA type.
+    using split_aosoa_type =
+        SplitAoSoA<HotTypes, ColdTypes, DeviceType, ColdDeviceType,
+                   VectorLength>;
+
+    static_assert( is_member_types<HotTypes>::value,
+                   "Hot data types must be member types" );
+    static_assert( is_member_types<ColdTypes>::value,
+                   "Cold data types must be member types" );
+
+    //! Member data types of the hot group.
+    using hot_member_types = HotTypes;
+
+    //! Member data types of the cold group.
+    using cold_member_types = ColdTypes;
+
+    //! AoSoA type holding the hot group.
+    using hot_aosoa_type = AoSoA<HotTypes, DeviceType, VectorLength>;
+
+    //! AoSoA type holding the cold group.
+    using cold_aosoa_type = AoSoA<ColdTypes, ColdDeviceType, VectorLength>;
+
+    //! Size type.
+    using size_type = typename hot_aosoa_type::size_type;
+
+    //! Vector length (size of the arrays held by the structs of both
+    //! groups).
+    static constexpr int vector_length = VectorLength;
+
+    //! Number of members in the hot group.
+    static constexpr std::size_t hot_members = HotTypes::size;
+
+    //! Number of members in the cold group.
+    static constexpr std::size_t cold_members = ColdTypes::size;
+
+    //! Total number of members over both groups.
+    static constexpr std::size_t number_of_members =
+        hot_members + cold_members;
+
+    /*!
+      \brief Default constructor.
+
+      \param label An optional label for the data structure.
+
+      The container size is zero and no memory is allocated.
+    */
+    SplitAoSoA( const std::string& label = "" )
+        : _label( label )
+        , _hot( label + "_hot" )
+        , _cold( label + "_cold" )
+    {
+    }
+
+    /*!
+      \brief Allocate a container with n tuples in both groups.
+
+      \param label A label for the data structure.
+
+      \param n The number of tuples in the container.
+    */
+    SplitAoSoA( const std::string label, const size_type n )
+        : _label( label )
+        , _hot( label + "_hot", n )
+        , _cold( label + "_cold", n )
+    {
+    }
+
+    //! Returns the data structure label.
+    std::string label() const { return _label; }
+
+    //! Returns the number of tuples in the container.
+    KOKKOS_FUNCTION
+    size_type size() const { return _hot.size(); }
+
+    //! Returns if the container is empty or not.
+    KOKKOS_FUNCTION
+    bool empty() const { return _hot.empty(); }
+
+    //! Returns the storage capacity of the container expressed in terms of
+    //! tuples. Both groups always resize together so they share a capacity.
+    KOKKOS_FUNCTION
+    size_type capacity() const { return _hot.capacity(); }
+
+    //! Get the number of structs-of-arrays in each group of the container.
+    KOKKOS_INLINE_FUNCTION
+    size_type numSoA() const { return _hot.numSoA(); }
+
+    //! Get the number of bytes of memory allocated by the container over
+    //! both groups and both memory spaces.
+    std::size_t memoryUsage() const
+    {
+        return _hot.memoryUsage() + _cold.memoryUsage();
+    }
+
+    /*!
+      \brief Resizes the container so that both groups contain n tuples.
+
+      Follows the reallocation and invalidation semantics of
+      AoSoA::resize() in each group.
+    */
+    void resize( const size_type n )
+    {
+        _hot.resize( n );
+        _cold.resize( n );
+    }
+
+    /*!
+      \brief Requests that the capacity of both groups be at least enough to
+      contain n tuples.
+
+      Follows the reallocation and invalidation semantics of
+      AoSoA::reserve() in each group.
+    */
+    void reserve( const size_type n )
+    {
+        _hot.reserve( n );
+        _cold.reserve( n );
+    }
+
+    //! Remove unused capacity from both groups.
+    void shrinkToFit()
+    {
+        _hot.shrinkToFit();
+        _cold.shrinkToFit();
+    }
+
+    //! Get the AoSoA holding the hot group.
+    hot_aosoa_type& hot() { return _hot; }
+
+    //! Get the AoSoA holding the hot group.
+    const hot_aosoa_type& hot() const { return _hot; }
+
+    //! Get the AoSoA holding the cold group.
+    cold_aosoa_type& cold() { return _cold; }
+
+    //! Get the AoSoA holding the cold group.
+    const cold_aosoa_type& cold() const { return _cold; }
+
+  private:
+    // Data structure label.
+    std::string _label;
+
+    // Hot member group.
+    hot_aosoa_type _hot;
+
+    // Cold member group.
+    cold_aosoa_type _cold;
+};
+
+//---------------------------------------------------------------------------//
+//! \cond Impl
+template <class>
+struct is_split_aosoa_impl : public std::false_type
+{
+};
+
+template <class HotTypes, class ColdTypes, class DeviceType,
+          class ColdDeviceType, int VectorLength>
+struct is_split_aosoa_impl<
+    SplitAoSoA<HotTypes, ColdTypes, DeviceType, ColdDeviceType, VectorLength>>
+    : public std::true_type
+{
+};
+//! \endcond
+
+//! SplitAoSoA static type checker.
+template <class T>
+struct is_split_aosoa
+    : public is_split_aosoa_impl<typename std::remove_cv<T>::type>::type
+{
+};
+
+namespace Impl
+{
+//! \cond Impl
+// Slice type of a split member index. Only the specialization for the group
+// that holds the member is instantiated so the index arithmetic of the
+// other group is never formed.
+template <class SplitAoSoA_t, std::size_t M,
+          bool IsHot = ( M < SplitAoSoA_t::hot_members )>
+struct SplitSliceType
+{
+    using type =
+        typename SplitAoSoA_t::hot_aosoa_type::template member_slice_type<M>;
+};
+
+template <class SplitAoSoA_t, std::size_t M>
+struct SplitSliceType<SplitAoSoA_t, M, false>
+{
+    using type = typename SplitAoSoA_t::cold_aosoa_type::
+        template member_slice_type<M - SplitAoSoA_t::hot_members>;
+};
+
+// Slice the group that holds a split member index.
+template <std::size_t M, class SplitAoSoA_t>
+typename SplitSliceType<SplitAoSoA_t, M>::type
+splitSlice( const SplitAoSoA_t& aosoa, const std::string& slice_label,
+            std::true_type )
+{
+    return slice<M>( aosoa.hot(), slice_label );
+}
+
+template <std::size_t M, class SplitAoSoA_t>
+typename SplitSliceType<SplitAoSoA_t, M>::type
+splitSlice( const SplitAoSoA_t& aosoa, const std::string& slice_label,
+            std::false_type )
+{
+    return slice<M - SplitAoSoA_t::hot_members>( aosoa.cold(), slice_label );
+}
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a slice from a SplitAoSoA.
+
+  Member indices run over the concatenation of the hot and cold groups and
+  the slice is created from the group that holds the member, so call sites
+  are unchanged when members move between groups.
+
+  \tparam M Split member index.
+  \tparam SplitAoSoA_t SplitAoSoA type.
+
+  \param aosoa SplitAoSoA to slice from.
+  \param slice_label Optional slice label.
+*/
+template <std::size_t M, class SplitAoSoA_t>
+typename std::enable_if<
+    is_split_aosoa<SplitAoSoA_t>::value,
+    typename Impl::SplitSliceType<SplitAoSoA_t, M>::type>::type
+slice( const SplitAoSoA_t& aosoa, const std::string& slice_label = "" )
+{
+    static_assert( M < SplitAoSoA_t::number_of_members,
+                   "Split member index is out of range" );
+    return Impl::splitSlice<M>(
+        aosoa, slice_label,
+        std::integral_constant<bool, ( M < SplitAoSoA_t::hot_members )>() );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_SPLITAOSOA_HPP
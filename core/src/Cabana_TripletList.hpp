@@ -0,0 +1,498 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_TripletList.hpp
+  \brief Unique particle triplet list built from a neighbor list
+*/
+#ifndef CABANA_TRIPLETLIST_HPP
+#define CABANA_TRIPLETLIST_HPP
+
+#include <Cabana_NeighborList.hpp>
+#include <Cabana_Parallel.hpp>
+#include <Cabana_Slice.hpp>
+#include <Cabana_Types.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cassert>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief Unique triplet list for angular (three-body) interactions.
+
+  Stores for each particle "i" the unique pairs of neighbors "(j,k)" whose
+  distances to "i" are both within the triplet cutoff. Angular potentials
+  typically use a three-body cutoff that is smaller than the pair cutoff the
+  neighbor list was built with, so enumerating second neighbors directly from
+  the neighbor list visits many pairs the angular kernel immediately
+  discards. Building the triplets once applies the distance filter at build
+  time and the angular kernels then iterate only live triplets.
+
+  Triplets are unique: each pair of neighbors appears once per central
+  particle, in the neighbor list traversal order of the source list. The
+  triplet data is stored in CSR (compressed sparse row) format.
+*/
+template <class MemorySpace>
+class TripletList
+{
+  public:
+    static_assert( Kokkos::is_memory_space<MemorySpace>::value, "" );
+
+    //! Kokkos memory space in which the triplet data resides.
+    using memory_space = MemorySpace;
+
+    //! Kokkos default execution space for this memory space.
+    using execution_space = typename memory_space::execution_space;
+
+    //! Number of triplets per particle.
+    Kokkos::View<int*, memory_space> counts;
+
+    //! Offsets into the triplet storage.
+    Kokkos::View<int*, memory_space> offsets;
+
+    //! Neighbor pairs (j,k) of each triplet.
+    Kokkos::View<int* [2], memory_space> pairs;
+
+    /*!
+      \brief Default constructor.
+    */
+    TripletList() = default;
+
+    /*!
+      \brief Constructor. Builds the triplet list from a neighbor list.
+
+      \param list The neighbor list providing the candidate neighbors of
+      each particle.
+
+      \param x The slice containing the particle positions. Must be the
+      positions the neighbor list was built with.
+
+      \param begin The beginning particle index to compute triplets for.
+
+      \param end The end particle index to compute triplets for.
+
+      \param triplet_radius The triplet cutoff. A pair of neighbors forms a
+      triplet with its central particle when both are within this distance
+      of the central particle. Must not be larger than the radius the
+      neighbor list was built with.
+    */
+    template <class NeighborListType, class PositionSlice>
+    TripletList( const NeighborListType& list, PositionSlice x,
+                 const std::size_t begin, const std::size_t end,
+                 const typename PositionSlice::value_type triplet_radius,
+                 typename std::enable_if<( is_slice<PositionSlice>::value ),
+                                         int>::type* = 0 )
+    {
+        build( list, x, begin, end, triplet_radius );
+    }
+
+    /*!
+      \brief Rebuild the triplet list. Completely overwrites the existing
+      data.
+
+      \param list The neighbor list providing the candidate neighbors of
+      each particle.
+
+      \param x The slice containing the particle positions. Must be the
+      positions the neighbor list was built with.
+
+      \param begin The beginning particle index to compute triplets for.
+
+      \param end The end particle index to compute triplets for.
+
+      \param triplet_radius The triplet cutoff.
+    */
+    template <class NeighborListType, class PositionSlice>
+    void build( const NeighborListType& list, PositionSlice x,
+                const std::size_t begin, const std::size_t end,
+                const typename PositionSlice::value_type triplet_radius )
+    {
+        assert( end >= begin );
+        assert( end <= x.size() );
+
+        using neighbor_list_traits = NeighborList<NeighborListType>;
+        static_assert(
+            std::is_same<typename neighbor_list_traits::memory_space,
+                         memory_space>::value,
+            "Neighbor list memory space must match the triplet list" );
+
+        using PositionValueType = typename PositionSlice::value_type;
+        PositionValueType rsqr = triplet_radius * triplet_radius;
+
+        // Count the neighbors of each particle within the triplet cutoff.
+        // Each unique pair of them forms a triplet.
+        counts = Kokkos::View<int*, memory_space>(
+            "Cabana::TripletList::counts", x.size() );
+        auto counts_sv = counts;
+        Kokkos::RangePolicy<execution_space> particle_policy( begin, end );
+        Kokkos::parallel_for(
+            "Cabana::TripletList::count_triplets", particle_policy,
+            KOKKOS_LAMBDA( const int i ) {
+                const int nn = neighbor_list_traits::numNeighbor( list, i );
+                int m = 0;
+                for ( int n = 0; n < nn; ++n )
+                {
+                    const int j = neighbor_list_traits::getNeighbor( list, i,
+                                                                     n );
+                    const PositionValueType dx = x( i, 0 ) - x( j, 0 );
+                    const PositionValueType dy = x( i, 1 ) - x( j, 1 );
+                    const PositionValueType dz = x( i, 2 ) - x( j, 2 );
+                    if ( dx * dx + dy * dy + dz * dz <= rsqr )
+                        ++m;
+                }
+                counts_sv( i ) = m * ( m - 1 ) / 2;
+            } );
+        Kokkos::fence();
+
+        // Compute the offsets via exclusive scan and get the total number
+        // of triplets.
+        offsets = Kokkos::View<int*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing(
+                "Cabana::TripletList::offsets" ),
+            x.size() );
+        auto offsets_sv = offsets;
+        int total_num_triplet;
+        Kokkos::RangePolicy<execution_space> scan_policy( 0, x.size() );
+        Kokkos::parallel_scan(
+            "Cabana::TripletList::offset_scan", scan_policy,
+            KOKKOS_LAMBDA( const int i, int& update, const bool final_pass ) {
+                if ( final_pass )
+                    offsets_sv( i ) = update;
+                update += counts_sv( i );
+            },
+            total_num_triplet );
+        Kokkos::fence();
+
+        // Fill the triplets. The storage is exactly sized so each particle
+        // writes its triplets contiguously without synchronization.
+        pairs = Kokkos::View<int* [2], memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing(
+                "Cabana::TripletList::pairs" ),
+            total_num_triplet );
+        auto pairs_sv = pairs;
+        Kokkos::parallel_for(
+            "Cabana::TripletList::fill_triplets", particle_policy,
+            KOKKOS_LAMBDA( const int i ) {
+                const int nn = neighbor_list_traits::numNeighbor( list, i );
+                int t = offsets_sv( i );
+                for ( int n = 0; n < nn; ++n )
+                {
+                    const int j = neighbor_list_traits::getNeighbor( list, i,
+                                                                     n );
+                    const PositionValueType jx = x( i, 0 ) - x( j, 0 );
+                    const PositionValueType jy = x( i, 1 ) - x( j, 1 );
+                    const PositionValueType jz = x( i, 2 ) - x( j, 2 );
+                    if ( jx * jx + jy * jy + jz * jz > rsqr )
+                        continue;
+
+                    for ( int a = n + 1; a < nn; ++a )
+                    {
+                        const int k = neighbor_list_traits::getNeighbor(
+                            list, i, a );
+                        const PositionValueType kx = x( i, 0 ) - x( k, 0 );
+                        const PositionValueType ky = x( i, 1 ) - x( k, 1 );
+                        const PositionValueType kz = x( i, 2 ) - x( k, 2 );
+                        if ( kx * kx + ky * ky + kz * kz <= rsqr )
+                        {
+                            pairs_sv( t, 0 ) = j;
+                            pairs_sv( t, 1 ) = k;
+                            ++t;
+                        }
+                    }
+                }
+            } );
+        Kokkos::fence();
+    }
+
+    //! Get the number of triplets for a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    int numTriplet( const int particle_index ) const
+    {
+        return counts( particle_index );
+    }
+
+    //! Get the neighbor pair of a given triplet of a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    void getTriplet( const int particle_index, const int triplet_index,
+                     int& first_neighbor, int& second_neighbor ) const
+    {
+        auto t = offsets( particle_index ) + triplet_index;
+        first_neighbor = pairs( t, 0 );
+        second_neighbor = pairs( t, 1 );
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Triplet Parallel For
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor in parallel according to the execution policy over
+  particles with a thread-local serial loop over particle triplets.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam MemorySpace The triplet list memory space.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor.
+  \param functor The functor to execute in parallel
+  \param list The triplet list over which to execute the triplet operations.
+  \param SerialOpTag Tag indicating a serial loop strategy over triplets.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+
+  The functor has the same signature as a second neighbor operation:
+
+  \code
+  void operator() ( const int i, const int j, const int k ) const ;
+  \endcode
+
+  where "i" is the central particle of the triplet and "j" and "k" are the
+  two filtered neighbors.
+*/
+template <class FunctorType, class MemorySpace, class... ExecParameters>
+inline void triplet_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const TripletList<MemorySpace>& list,
+    const SerialOpTag, const std::string& str = "" )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using index_type =
+        typename Kokkos::RangePolicy<ExecParameters...>::index_type;
+
+    auto begin = exec_policy.begin();
+    auto end = exec_policy.end();
+    using linear_policy_type = Kokkos::RangePolicy<execution_space, void, void>;
+    linear_policy_type linear_exec_policy( begin, end );
+
+    static_assert( is_accessible_from<MemorySpace, execution_space>{}, "" );
+
+    auto trip_func = KOKKOS_LAMBDA( const index_type i )
+    {
+        for ( index_type t = 0; t < list.numTriplet( i ); ++t )
+        {
+            int j, k;
+            list.getTriplet( i, t, j, k );
+            Impl::functorTagDispatch<work_tag>( functor, i, j, k );
+        }
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( linear_exec_policy, trip_func );
+    else
+        Kokkos::parallel_for( str, linear_exec_policy, trip_func );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor in parallel according to the execution policy over
+  particles with team parallelism over particle triplets.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam MemorySpace The triplet list memory space.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor.
+  \param functor The functor to execute in parallel
+  \param list The triplet list over which to execute the triplet operations.
+  \param TeamOpTag Tag indicating a team parallel strategy over triplets.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_for called by this code and can be used for
+  identification and profiling purposes.
+*/
+template <class FunctorType, class MemorySpace, class... ExecParameters>
+inline void triplet_parallel_for(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const TripletList<MemorySpace>& list,
+    const TeamOpTag, const std::string& str = "" )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using kokkos_policy =
+        Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+    kokkos_policy team_policy( exec_policy.end() - exec_policy.begin(),
+                               Kokkos::AUTO );
+
+    using index_type = typename kokkos_policy::index_type;
+
+    static_assert( is_accessible_from<MemorySpace, execution_space>{}, "" );
+
+    const auto range_begin = exec_policy.begin();
+
+    auto trip_func =
+        KOKKOS_LAMBDA( const typename kokkos_policy::member_type& team )
+    {
+        index_type i = team.league_rank() + range_begin;
+        Kokkos::parallel_for( Kokkos::TeamThreadRange( team,
+                                                       list.numTriplet( i ) ),
+                              [&]( const index_type t ) {
+                                  int j, k;
+                                  list.getTriplet( i, t, j, k );
+                                  Impl::functorTagDispatch<work_tag>( functor,
+                                                                      i, j,
+                                                                      k );
+                              } );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_for( team_policy, trip_func );
+    else
+        Kokkos::parallel_for( str, team_policy, trip_func );
+}
+
+//---------------------------------------------------------------------------//
+// Triplet Parallel Reduce
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor reduction in parallel according to the execution
+  policy over particles with a thread-local serial loop over particle
+  triplets.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam MemorySpace The triplet list memory space.
+  \tparam ReduceType The reduction type.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor.
+  \param functor The functor to execute in parallel
+  \param list The triplet list over which to execute the triplet operations.
+  \param SerialOpTag Tag indicating a serial loop strategy over triplets.
+  \param reduce_val Scalar to be reduced across particles and triplets.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_reduce called by this code and can be used for
+  identification and profiling purposes.
+
+  Fuses the accumulation of a scalar - a three-body energy contribution for
+  instance - into the triplet traversal so no separate sweep or scratch view
+  is needed. The functor signature matches the second neighbor reduction
+  convention:
+
+  \code
+  void operator() ( const int i, const int j, const int k,
+                    ReduceType& ival ) const ;
+  \endcode
+*/
+template <class FunctorType, class MemorySpace, class ReduceType,
+          class... ExecParameters>
+inline void triplet_parallel_reduce(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const TripletList<MemorySpace>& list,
+    const SerialOpTag, ReduceType& reduce_val, const std::string& str = "" )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using index_type =
+        typename Kokkos::RangePolicy<ExecParameters...>::index_type;
+
+    auto begin = exec_policy.begin();
+    auto end = exec_policy.end();
+    using linear_policy_type = Kokkos::RangePolicy<execution_space, void, void>;
+    linear_policy_type linear_exec_policy( begin, end );
+
+    static_assert( is_accessible_from<MemorySpace, execution_space>{}, "" );
+
+    auto trip_reduce = KOKKOS_LAMBDA( const index_type i, ReduceType& ival )
+    {
+        for ( index_type t = 0; t < list.numTriplet( i ); ++t )
+        {
+            int j, k;
+            list.getTriplet( i, t, j, k );
+            Impl::functorTagDispatch<work_tag>( functor, i, j, k, ival );
+        }
+    };
+    if ( str.empty() )
+        Kokkos::parallel_reduce( linear_exec_policy, trip_reduce, reduce_val );
+    else
+        Kokkos::parallel_reduce( str, linear_exec_policy, trip_reduce,
+                                 reduce_val );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Execute functor reduction in parallel according to the execution
+  policy over particles with team parallelism over particle triplets.
+
+  \tparam FunctorType The functor type to execute.
+  \tparam MemorySpace The triplet list memory space.
+  \tparam ReduceType The reduction type.
+  \tparam ExecParams The Kokkos range policy parameters.
+
+  \param exec_policy The policy over which to execute the functor.
+  \param functor The functor to execute in parallel
+  \param list The triplet list over which to execute the triplet operations.
+  \param TeamOpTag Tag indicating a team parallel strategy over triplets.
+  \param reduce_val Scalar to be reduced across particles and triplets.
+  \param str Optional name for the functor. Will be forwarded if non-empty to
+  the Kokkos::parallel_reduce called by this code and can be used for
+  identification and profiling purposes.
+*/
+template <class FunctorType, class MemorySpace, class ReduceType,
+          class... ExecParameters>
+inline void triplet_parallel_reduce(
+    const Kokkos::RangePolicy<ExecParameters...>& exec_policy,
+    const FunctorType& functor, const TripletList<MemorySpace>& list,
+    const TeamOpTag, ReduceType& reduce_val, const std::string& str = "" )
+{
+    using work_tag = typename Kokkos::RangePolicy<ExecParameters...>::work_tag;
+
+    using execution_space =
+        typename Kokkos::RangePolicy<ExecParameters...>::execution_space;
+
+    using kokkos_policy =
+        Kokkos::TeamPolicy<execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+    kokkos_policy team_policy( exec_policy.end() - exec_policy.begin(),
+                               Kokkos::AUTO );
+
+    using index_type = typename kokkos_policy::index_type;
+
+    static_assert( is_accessible_from<MemorySpace, execution_space>{}, "" );
+
+    const auto range_begin = exec_policy.begin();
+
+    auto trip_reduce = KOKKOS_LAMBDA(
+        const typename kokkos_policy::member_type& team, ReduceType& ival )
+    {
+        index_type i = team.league_rank() + range_begin;
+        ReduceType reduce_t = 0;
+
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange( team, list.numTriplet( i ) ),
+            [&]( const index_type t, ReduceType& tval ) {
+                int j, k;
+                list.getTriplet( i, t, j, k );
+                Impl::functorTagDispatch<work_tag>( functor, i, j, k, tval );
+            },
+            reduce_t );
+        Kokkos::single( Kokkos::PerTeam( team ),
+                        [&]() { ival += reduce_t; } );
+    };
+    if ( str.empty() )
+        Kokkos::parallel_reduce( team_policy, trip_reduce, reduce_val );
+    else
+        Kokkos::parallel_reduce( str, team_policy, trip_reduce, reduce_val );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_TRIPLETLIST_HPP
@@ -0,0 +1,317 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_Tuner.hpp
+  \brief Runtime auto-tuning of SIMD kernel launch configurations
+*/
+#ifndef CABANA_TUNER_HPP
+#define CABANA_TUNER_HPP
+
+#include <Cabana_ExecutionPolicy.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Cabana
+{
+namespace Experimental
+{
+//---------------------------------------------------------------------------//
+/*!
+  \brief A kernel launch configuration candidate for a \c SimdPolicy.
+
+  The vector length of an AoSoA is a compile-time template parameter, so it
+  cannot be changed on an existing container at runtime. Applications that
+  template their particle containers over the vector length can still use the
+  tuned \c vector_length to select an instantiation at startup. The team size
+  and chunk size are runtime parameters of \c SimdPolicy and feed directly
+  into policy construction.
+*/
+struct SimdConfig
+{
+    //! AoSoA vector length the kernel was measured with.
+    int vector_length;
+    //! Threads per team.
+    int team_size;
+    //! Structs per work item.
+    int chunk_size;
+};
+
+namespace Impl
+{
+//! \cond Impl
+
+// Registry of tuned configurations keyed by kernel name.
+class TunerRegistry
+{
+  public:
+    static TunerRegistry& get()
+    {
+        static TunerRegistry registry;
+        return registry;
+    }
+
+    bool has( const std::string& name ) const
+    {
+        return _configs.count( name ) > 0;
+    }
+
+    SimdConfig config( const std::string& name ) const
+    {
+        return _configs.at( name );
+    }
+
+    void set( const std::string& name, const SimdConfig& config )
+    {
+        _configs[name] = config;
+    }
+
+    const std::map<std::string, SimdConfig>& configs() const
+    {
+        return _configs;
+    }
+
+    void clear() { _configs.clear(); }
+
+  private:
+    TunerRegistry() = default;
+
+    std::map<std::string, SimdConfig> _configs;
+};
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Get the default launch configuration candidates for an execution
+  space.
+
+  \tparam ExecutionSpace Kokkos execution space the kernel will run in.
+
+  \param vector_length The compile-time vector length of the container the
+  kernel operates on.
+
+  \return Candidate configurations. Team sizes beyond the concurrency of the
+  execution space are excluded so every candidate is launchable.
+*/
+template <class ExecutionSpace>
+std::vector<SimdConfig> defaultConfigCandidates( const int vector_length )
+{
+    std::vector<int> team_sizes = { 1, 2, 4, 8 };
+    std::vector<int> chunk_sizes = { 1, 4, 16 };
+    int concurrency = ExecutionSpace().concurrency();
+
+    std::vector<SimdConfig> candidates;
+    for ( auto t : team_sizes )
+        for ( auto c : chunk_sizes )
+            if ( t <= concurrency )
+                candidates.push_back( { vector_length, t, c } );
+    return candidates;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Benchmark a kernel over a set of launch configuration candidates and
+  register the fastest.
+
+  \tparam Kernel Callable taking a <tt>const SimdConfig&</tt> and executing
+  the kernel to tune with that configuration (e.g. by constructing a
+  \c SimdPolicy with the candidate team and chunk size). The callable must
+  synchronize any asynchronous execution itself or rely on the fence issued
+  after each trial.
+
+  \param name Name identifying the kernel in the registry and tuning cache.
+
+  \param kernel The kernel to benchmark.
+
+  \param candidates The configurations to measure.
+
+  \param num_trial Timed executions per candidate. One additional warm-up
+  execution runs first.
+
+  \return The fastest configuration.
+
+  If the registry already holds a configuration for the name (e.g. loaded
+  from a persisted tuning cache with \c loadConfigCache) no benchmarking is
+  performed and the stored configuration is returned, so tuning hooks can be
+  left in production startup paths.
+*/
+template <class Kernel>
+SimdConfig tune( const std::string& name, Kernel&& kernel,
+                 const std::vector<SimdConfig>& candidates,
+                 const int num_trial = 3 )
+{
+    auto& registry = Impl::TunerRegistry::get();
+
+    // Reuse a persisted or previously measured result.
+    if ( registry.has( name ) )
+        return registry.config( name );
+
+    if ( candidates.empty() )
+        throw std::runtime_error( "No tuning candidates given for " + name );
+
+    // Measure each candidate and keep the fastest.
+    SimdConfig best = candidates.front();
+    double best_time = std::numeric_limits<double>::max();
+    for ( const auto& candidate : candidates )
+    {
+        // Warm up once to exclude one-time costs from the measurement.
+        kernel( candidate );
+        Kokkos::fence();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for ( int t = 0; t < num_trial; ++t )
+        {
+            kernel( candidate );
+            Kokkos::fence();
+        }
+        auto stop = std::chrono::high_resolution_clock::now();
+        double time =
+            std::chrono::duration<double>( stop - start ).count() / num_trial;
+
+        if ( time < best_time )
+        {
+            best_time = time;
+            best = candidate;
+        }
+    }
+
+    registry.set( name, best );
+    return best;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Get the tuned configuration for a kernel, or a default if none has
+  been measured or loaded.
+
+  \param name Name identifying the kernel.
+
+  \param default_config Configuration returned when the kernel has not been
+  tuned.
+*/
+inline SimdConfig tunedConfig( const std::string& name,
+                               const SimdConfig& default_config )
+{
+    auto& registry = Impl::TunerRegistry::get();
+    return registry.has( name ) ? registry.config( name ) : default_config;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Check whether a tuned configuration exists for a kernel.
+
+  \param name Name identifying the kernel.
+*/
+inline bool isTuned( const std::string& name )
+{
+    return Impl::TunerRegistry::get().has( name );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Remove all tuned configurations from the registry.
+*/
+inline void clearConfigCache() { Impl::TunerRegistry::get().clear(); }
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Create a \c SimdPolicy from the tuned configuration for a kernel.
+
+  \tparam VectorLength The inner array size of the AoSoA.
+
+  \tparam Properties Kokkos execution policy properties.
+
+  \param name Name identifying the kernel.
+
+  \param begin The beginning of the 1D range.
+
+  \param end The ending of the 1D range.
+
+  \return A policy using the tuned team and chunk size, or the defaults of
+  one thread per team and one struct per work item when the kernel has not
+  been tuned.
+*/
+template <int VectorLength, class... Properties>
+SimdPolicy<VectorLength, Properties...> createTunedSimdPolicy(
+    const std::string& name,
+    const typename SimdPolicy<VectorLength, Properties...>::index_type begin,
+    const typename SimdPolicy<VectorLength, Properties...>::index_type end )
+{
+    auto config = tunedConfig( name, { VectorLength, 1, 1 } );
+    return SimdPolicy<VectorLength, Properties...>(
+        begin, end, config.chunk_size, config.team_size );
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Write all tuned configurations to a plain-text tuning cache file.
+
+  \param filename Name of the cache file.
+
+  Each line holds the kernel name followed by the vector length, team size,
+  and chunk size. Kernel names therefore must not contain whitespace.
+*/
+inline void saveConfigCache( const std::string& filename )
+{
+    std::ofstream file( filename );
+    if ( !file.is_open() )
+        throw std::runtime_error( "Could not open tuning cache " + filename );
+    for ( const auto& entry : Impl::TunerRegistry::get().configs() )
+        file << entry.first << " " << entry.second.vector_length << " "
+             << entry.second.team_size << " " << entry.second.chunk_size
+             << "\n";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Load tuned configurations from a tuning cache file into the
+  registry.
+
+  \param filename Name of the cache file.
+
+  \return Whether the file could be opened. A missing cache is not an error -
+  the caller falls through to benchmarking with \c tune and persists the
+  results with \c saveConfigCache for the next run.
+*/
+inline bool loadConfigCache( const std::string& filename )
+{
+    std::ifstream file( filename );
+    if ( !file.is_open() )
+        return false;
+    std::string line;
+    while ( std::getline( file, line ) )
+    {
+        std::istringstream entry( line );
+        std::string name;
+        SimdConfig config;
+        if ( entry >> name >> config.vector_length >> config.team_size >>
+             config.chunk_size )
+            Impl::TunerRegistry::get().set( name, config );
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Experimental
+} // end namespace Cabana
+
+#endif // end CABANA_TUNER_HPP
@@ -23,6 +23,7 @@
 
 #include <cstdlib>
 #include <type_traits>
+#include <utility>
 
 namespace Cabana
 {
@@ -181,6 +182,33 @@ struct Tuple<MemberTypes<Types...>> : SoA<MemberTypes<Types...>, 1>
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+  \brief Apply a functor to each member of a tuple.
+
+  \tparam Tuple_t The tuple type.
+
+  \tparam Functor The functor type.
+
+  \param tp The tuple to access.
+
+  \param f The functor. Called once per member with
+  std::integral_constant<std::size_t,M> for member index M and a
+  restrict-qualified pointer to the first value of member M. The values
+  of a member are laid out component-major - the component (d0,d1,d2) is
+  at ptr[(d0*D1+d1)*D2+d2]. Each member gets a distinct
+  restrict-qualified pointer so the compiler can prove members do not
+  alias in generic kernels.
+*/
+template <class Tuple_t, class Functor>
+KOKKOS_FORCEINLINE_FUNCTION
+    typename std::enable_if<is_tuple<Tuple_t>::value>::type
+    for_each_member( Tuple_t& tp, Functor&& f )
+{
+    for_each_member( static_cast<typename Tuple_t::base&>( tp ),
+                     std::forward<Functor>( f ) );
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
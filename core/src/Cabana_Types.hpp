@@ -65,6 +65,25 @@ struct is_memory_access_tag<RandomAccessMemory> : public std::true_type
 {
 };
 
+//! Streaming memory access. Write-once data with no reuse. Slices with this
+//! access type provide non-temporal stores that bypass the cache hierarchy
+//! where the architecture supports it, so streamed writes do not evict data
+//! with actual reuse (e.g. neighbor lists).
+struct StreamingAccessMemory
+{
+    //! Access type.
+    using memory_access_type = StreamingAccessMemory;
+    //! Kokkos traits.
+    using kokkos_memory_traits =
+        Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::Aligned |
+                             Kokkos::Restrict>;
+};
+
+template <>
+struct is_memory_access_tag<StreamingAccessMemory> : public std::true_type
+{
+};
+
 //! Atomic memory access. All reads and writes are atomic.
 struct AtomicAccessMemory
 {
@@ -0,0 +1,96 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+/*!
+  \file Cabana_VectorLengthDispatch.hpp
+  \brief Runtime dispatch over a compile-time set of SoA vector lengths
+*/
+#ifndef CABANA_VECTORLENGTHDISPATCH_HPP
+#define CABANA_VECTORLENGTHDISPATCH_HPP
+
+#include <impl/Cabana_TypeTraits.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Cabana
+{
+//---------------------------------------------------------------------------//
+//! \cond Impl
+namespace Impl
+{
+template <class Functor>
+void dispatchVectorLengthImpl( const int, Functor&& )
+{
+    throw std::invalid_argument(
+        "Vector length is not in the dispatch candidate set" );
+}
+
+template <class Functor, int VectorLength, int... VectorLengths>
+void dispatchVectorLengthImpl( const int vector_length, Functor&& functor,
+                               std::integral_constant<int, VectorLength>,
+                               std::integral_constant<int, VectorLengths>... )
+{
+    if ( VectorLength == vector_length )
+        functor( std::integral_constant<int, VectorLength>() );
+    else
+        dispatchVectorLengthImpl(
+            vector_length, std::forward<Functor>( functor ),
+            std::integral_constant<int, VectorLengths>()... );
+}
+} // end namespace Impl
+//! \endcond
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Invoke a functor with a compile-time vector length selected at
+  runtime.
+
+  \tparam VectorLengths The candidate vector lengths to instantiate. Each
+  must be a valid AoSoA vector length (a power of two).
+
+  \tparam Functor Functor type callable with a
+  <tt>std::integral_constant<int,N></tt> for every candidate N.
+
+  \param vector_length The runtime-selected vector length. Must be one of
+  the candidates or an exception is thrown.
+
+  \param functor The functor to invoke. Use a generic lambda and recover the
+  compile-time value from the integral constant argument:
+  \code
+  Cabana::dispatchVectorLength<16, 32, 64>( vlen, [&]( auto vl )
+  {
+      using aosoa_type =
+          Cabana::AoSoA<DataTypes, DeviceType, decltype( vl )::value>;
+      ...
+  } );
+  \endcode
+
+  A single binary can then instantiate the handful of vector lengths that
+  matter for its kernels and pick the best one per AoSoA at runtime instead
+  of building once per length.
+*/
+template <int... VectorLengths, class Functor>
+void dispatchVectorLength( const int vector_length, Functor&& functor )
+{
+    static_assert( sizeof...( VectorLengths ) > 0,
+                   "At least one candidate vector length is required" );
+    Impl::dispatchVectorLengthImpl(
+        vector_length, std::forward<Functor>( functor ),
+        std::integral_constant<int, VectorLengths>()... );
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Cabana
+
+#endif // end CABANA_VECTORLENGTHDISPATCH_HPP
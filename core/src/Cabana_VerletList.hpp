@@ -19,10 +19,15 @@
 #include <Cabana_LinkedCellList.hpp>
 #include <Cabana_NeighborList.hpp>
 #include <Cabana_Parallel.hpp>
+#include <Cabana_Profiling.hpp>
 #include <impl/Cabana_CartesianGrid.hpp>
 
 #include <Kokkos_Core.hpp>
 
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
 namespace Cabana
 {
 //---------------------------------------------------------------------------//
@@ -38,62 +43,227 @@ struct VerletLayout2D
 {
 };
 
+//! Compressed 2D neighbor list layout. Particles are grouped into
+//! power-of-two row width classes and each class is stored as its own
+//! coalesced 2D block, so the memory overhead scales with the per-class
+//! maxima instead of the global maximum neighbor count.
+struct VerletLayoutCompressed2D
+{
+};
+
 //---------------------------------------------------------------------------//
 // Verlet List Data.
 //---------------------------------------------------------------------------//
-template <class MemorySpace, class LayoutTag>
+template <class MemorySpace, class LayoutTag, class IndexType = int>
 struct VerletListData;
 
 //! Store the VerletList compressed sparse row (CSR) neighbor data.
-template <class MemorySpace>
-struct VerletListData<MemorySpace, VerletLayoutCSR>
+template <class MemorySpace, class IndexType>
+struct VerletListData<MemorySpace, VerletLayoutCSR, IndexType>
 {
+    static_assert( std::is_integral<IndexType>::value,
+                   "Neighbor index type must be an integral type" );
+
     //! Kokkos memory space.
     using memory_space = MemorySpace;
     //! Default Kokkos device type.
     using device_type [[deprecated]] = typename memory_space::device_type;
+    //! Neighbor index type.
+    using index_type = IndexType;
 
     //! Number of neighbors per particle.
-    Kokkos::View<int*, memory_space> counts;
+    Kokkos::View<IndexType*, memory_space> counts;
 
     //! Offsets into the neighbor list.
-    Kokkos::View<int*, memory_space> offsets;
+    Kokkos::View<IndexType*, memory_space> offsets;
 
     //! Neighbor list.
-    Kokkos::View<int*, memory_space> neighbors;
+    Kokkos::View<IndexType*, memory_space> neighbors;
+
+    //! Per-particle capacity of the neighbor storage when filling into an
+    //! estimated allocation. Zero when the storage is exactly sized.
+    IndexType capacity = 0;
 
     //! Add a neighbor to the list.
     KOKKOS_INLINE_FUNCTION
     void addNeighbor( const int pid, const int nid ) const
     {
-        neighbors( offsets( pid ) +
-                   Kokkos::atomic_fetch_add( &counts( pid ), 1 ) ) = nid;
+        IndexType count =
+            Kokkos::atomic_fetch_add( &counts( pid ), IndexType( 1 ) );
+        if ( 0 == capacity || count < capacity )
+            neighbors( offsets( pid ) + count ) = nid;
+    }
+
+    //! Get the neighbor id in a given slot of a particle's row.
+    KOKKOS_INLINE_FUNCTION
+    IndexType getNeighbor( const int pid, const int n ) const
+    {
+        return neighbors( offsets( pid ) + n );
+    }
+
+    //! Set the neighbor id in a given slot of a particle's row.
+    KOKKOS_INLINE_FUNCTION
+    void setNeighbor( const int pid, const int n, const IndexType nid ) const
+    {
+        neighbors( offsets( pid ) + n ) = nid;
+    }
+
+    //! Extend the per-particle arrays to cover appended particles with zero
+    //! neighbors. Existing entries are preserved.
+    void growParticles( const std::size_t num_particles )
+    {
+        if ( num_particles <= counts.extent( 0 ) )
+            return;
+        Kokkos::resize( counts, num_particles );
+        Kokkos::resize( offsets, num_particles );
+    }
+
+    //! Get the number of bytes allocated by the list data.
+    std::size_t memoryUsage() const
+    {
+        return ( counts.span() + offsets.span() + neighbors.span() ) *
+               sizeof( IndexType );
     }
 };
 
 //! Store the VerletList 2D neighbor data.
-template <class MemorySpace>
-struct VerletListData<MemorySpace, VerletLayout2D>
+template <class MemorySpace, class IndexType>
+struct VerletListData<MemorySpace, VerletLayout2D, IndexType>
 {
+    static_assert( std::is_integral<IndexType>::value,
+                   "Neighbor index type must be an integral type" );
+
     //! Kokkos memory space.
     using memory_space = MemorySpace;
     //! Default Kokkos device type.
     using device_type [[deprecated]] = typename memory_space::device_type;
+    //! Neighbor index type.
+    using index_type = IndexType;
 
     //! Number of neighbors per particle.
-    Kokkos::View<int*, memory_space> counts;
+    Kokkos::View<IndexType*, memory_space> counts;
 
     //! Neighbor list.
-    Kokkos::View<int**, memory_space> neighbors;
+    Kokkos::View<IndexType**, memory_space> neighbors;
+
+    //! Per-particle capacity of the neighbor storage when filling under a
+    //! neighbor cap. Zero when the row width alone bounds the fill.
+    IndexType capacity = 0;
 
     //! Add a neighbor to the list.
     KOKKOS_INLINE_FUNCTION
     void addNeighbor( const int pid, const int nid ) const
     {
-        std::size_t count = Kokkos::atomic_fetch_add( &counts( pid ), 1 );
+        std::size_t count =
+            Kokkos::atomic_fetch_add( &counts( pid ), IndexType( 1 ) );
         if ( count < neighbors.extent( 1 ) )
             neighbors( pid, count ) = nid;
     }
+
+    //! Get the neighbor id in a given slot of a particle's row.
+    KOKKOS_INLINE_FUNCTION
+    IndexType getNeighbor( const int pid, const int n ) const
+    {
+        return neighbors( pid, n );
+    }
+
+    //! Set the neighbor id in a given slot of a particle's row.
+    KOKKOS_INLINE_FUNCTION
+    void setNeighbor( const int pid, const int n, const IndexType nid ) const
+    {
+        neighbors( pid, n ) = nid;
+    }
+
+    //! Extend the per-particle arrays to cover appended particles with zero
+    //! neighbors. Existing entries are preserved.
+    void growParticles( const std::size_t num_particles )
+    {
+        if ( num_particles <= counts.extent( 0 ) )
+            return;
+        Kokkos::resize( counts, num_particles );
+    }
+
+    //! Get the number of bytes allocated by the list data.
+    std::size_t memoryUsage() const
+    {
+        return ( counts.span() + neighbors.span() ) * sizeof( IndexType );
+    }
+};
+
+//! Store the VerletList compressed 2D neighbor data.
+template <class MemorySpace, class IndexType>
+struct VerletListData<MemorySpace, VerletLayoutCompressed2D, IndexType>
+{
+    static_assert( std::is_integral<IndexType>::value,
+                   "Neighbor index type must be an integral type" );
+
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Default Kokkos device type.
+    using device_type [[deprecated]] = typename memory_space::device_type;
+    //! Neighbor index type.
+    using index_type = IndexType;
+
+    //! Number of neighbors per particle.
+    Kokkos::View<IndexType*, memory_space> counts;
+
+    //! Starting index of each particle's row in the packed class blocks.
+    Kokkos::View<IndexType*, memory_space> row_start;
+
+    //! Distance between consecutive neighbor slots of each particle's row.
+    //! Rows of one class are interleaved so consecutive rows access a fixed
+    //! neighbor slot from consecutive memory.
+    Kokkos::View<IndexType*, memory_space> row_stride;
+
+    //! Neighbor list packed by row width class.
+    Kokkos::View<IndexType*, memory_space> neighbors;
+
+    //! Per-particle capacity of the neighbor storage when filling under a
+    //! neighbor cap. Zero when the rows are exactly sized.
+    IndexType capacity = 0;
+
+    //! Add a neighbor to the list.
+    KOKKOS_INLINE_FUNCTION
+    void addNeighbor( const int pid, const int nid ) const
+    {
+        IndexType count =
+            Kokkos::atomic_fetch_add( &counts( pid ), IndexType( 1 ) );
+        if ( 0 == capacity || count < capacity )
+            neighbors( row_start( pid ) + count * row_stride( pid ) ) = nid;
+    }
+
+    //! Get the neighbor id in a given slot of a particle's row.
+    KOKKOS_INLINE_FUNCTION
+    IndexType getNeighbor( const int pid, const int n ) const
+    {
+        return neighbors( row_start( pid ) + n * row_stride( pid ) );
+    }
+
+    //! Set the neighbor id in a given slot of a particle's row.
+    KOKKOS_INLINE_FUNCTION
+    void setNeighbor( const int pid, const int n, const IndexType nid ) const
+    {
+        neighbors( row_start( pid ) + n * row_stride( pid ) ) = nid;
+    }
+
+    //! Extend the per-particle arrays to cover appended particles with zero
+    //! neighbors. Existing entries are preserved.
+    void growParticles( const std::size_t num_particles )
+    {
+        if ( num_particles <= counts.extent( 0 ) )
+            return;
+        Kokkos::resize( counts, num_particles );
+        Kokkos::resize( row_start, num_particles );
+        Kokkos::resize( row_stride, num_particles );
+    }
+
+    //! Get the number of bytes allocated by the list data.
+    std::size_t memoryUsage() const
+    {
+        return ( counts.span() + row_start.span() + row_stride.span() +
+                 neighbors.span() ) *
+               sizeof( IndexType );
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -150,57 +320,30 @@ class NeighborDiscriminator<HalfNeighborTag>
 };
 
 //---------------------------------------------------------------------------//
-// Cell stencil.
-template <class Scalar>
-struct LinkedCellStencil
+// Verlet List Builder
+//---------------------------------------------------------------------------//
+// Position snapshot with the slice interface the builder needs. A
+// time-sliced build reads positions over several steps while the particles
+// keep moving, so it builds from positions frozen at rebuild start.
+template <class ValueType, class MemorySpace>
+struct PositionSnapshot
 {
-    Scalar rsqr;
-    CartesianGrid<double> grid;
-    int max_cells_dir;
-    int max_cells;
-    int cell_range;
+    using value_type = ValueType;
+    using random_access_slice = PositionSnapshot<ValueType, MemorySpace>;
 
-    LinkedCellStencil( const Scalar neighborhood_radius,
-                       const Scalar cell_size_ratio, const Scalar grid_min[3],
-                       const Scalar grid_max[3] )
-        : rsqr( neighborhood_radius * neighborhood_radius )
-    {
-        Scalar dx = neighborhood_radius * cell_size_ratio;
-        grid = CartesianGrid<double>( grid_min[0], grid_min[1], grid_min[2],
-                                      grid_max[0], grid_max[1], grid_max[2], dx,
-                                      dx, dx );
-        cell_range = std::ceil( 1 / cell_size_ratio );
-        max_cells_dir = 2 * cell_range + 1;
-        max_cells = max_cells_dir * max_cells_dir * max_cells_dir;
-    }
-
-    // Given a cell, get the index bounds of the cell stencil.
-    KOKKOS_INLINE_FUNCTION
-    void getCells( const int cell, int& imin, int& imax, int& jmin, int& jmax,
-                   int& kmin, int& kmax ) const
-    {
-        int i, j, k;
-        grid.ijkBinIndex( cell, i, j, k );
-
-        kmin = ( k - cell_range > 0 ) ? k - cell_range : 0;
-        kmax =
-            ( k + cell_range + 1 < grid._nz ) ? k + cell_range + 1 : grid._nz;
+    Kokkos::View<ValueType* [3], MemorySpace> data;
 
-        jmin = ( j - cell_range > 0 ) ? j - cell_range : 0;
-        jmax =
-            ( j + cell_range + 1 < grid._ny ) ? j + cell_range + 1 : grid._ny;
+    std::size_t size() const { return data.extent( 0 ); }
 
-        imin = ( i - cell_range > 0 ) ? i - cell_range : 0;
-        imax =
-            ( i + cell_range + 1 < grid._nx ) ? i + cell_range + 1 : grid._nx;
+    KOKKOS_FORCEINLINE_FUNCTION
+    value_type operator()( const std::size_t p, const int d ) const
+    {
+        return data( p, d );
     }
 };
 
-//---------------------------------------------------------------------------//
-// Verlet List Builder
-//---------------------------------------------------------------------------//
 template <class DeviceType, class PositionSlice, class AlgorithmTag,
-          class LayoutTag, class BuildOpTag>
+          class LayoutTag, class BuildOpTag, class IndexType = int>
 struct VerletListBuilder
 {
     // Types.
@@ -212,11 +355,20 @@ struct VerletListBuilder
     using execution_space = typename device::execution_space;
 
     // List data.
-    VerletListData<memory_space, LayoutTag> _data;
+    VerletListData<memory_space, LayoutTag, IndexType> _data;
 
-    // Neighbor cutoff.
+    // Neighbor cutoff. When building with per-particle radii this holds the
+    // square of the largest radius and is only used for binning and stencil
+    // culling.
     PositionValueType rsqr;
 
+    // Per-particle neighborhood radii (including any skin). Particles are
+    // neighbors when they are within the larger of their two radii.
+    Kokkos::View<const PositionValueType*, memory_space,
+                 Kokkos::MemoryTraits<Kokkos::RandomAccess>>
+        pair_radius;
+    bool per_particle_radius;
+
     // Positions.
     RandomAccessPositionSlice position;
     std::size_t pid_begin, pid_end;
@@ -232,29 +384,84 @@ struct VerletListBuilder
     bool refill;
     bool count;
 
+    // First cell handled by the count and fill kernels. A time-sliced build
+    // launches the kernels over cell subranges with this offset applied.
+    int cell_offset;
+
+    // Periodic dimension flags and box lengths for minimum-image builds.
+    // Periodic dimensions wrap the cell stencil around the grid and measure
+    // pair distances to the nearest image.
+    bool periodic[3];
+    PositionValueType box[3];
+
+    // Flags for the CSR single-pass estimated fill.
+    bool estimated;
+    bool estimate_filled;
+
     // Maximum neighbors per particle
     std::size_t max_n;
 
+    // Hard cap on the neighbors retained per particle. Zero means
+    // unbounded.
+    std::size_t neighbor_cap;
+
+    // Overflow report of a capped build.
+    std::size_t overflow_count;
+    std::size_t dropped_count;
+
+    // Storage from a previous build available for grow-only reuse.
+    VerletListData<memory_space, LayoutTag, IndexType> prev_data;
+    bool reuse;
+
     // Constructor.
-    VerletListBuilder( PositionSlice slice, const std::size_t begin,
-                       const std::size_t end,
-                       const PositionValueType neighborhood_radius,
-                       const PositionValueType cell_size_ratio,
-                       const PositionValueType grid_min[3],
-                       const PositionValueType grid_max[3],
-                       const std::size_t max_neigh )
+    VerletListBuilder(
+        PositionSlice slice, const std::size_t begin, const std::size_t end,
+        const PositionValueType neighborhood_radius,
+        const PositionValueType cell_size_ratio,
+        const PositionValueType grid_min[3],
+        const PositionValueType grid_max[3], const std::size_t max_neigh,
+        const VerletListData<memory_space, LayoutTag, IndexType>& prev =
+            VerletListData<memory_space, LayoutTag, IndexType>(),
+        const bool reuse_storage = false )
         : pid_begin( begin )
         , pid_end( end )
         , cell_stencil( neighborhood_radius, cell_size_ratio, grid_min,
                         grid_max )
         , max_n( max_neigh )
+        , prev_data( prev )
+        , reuse( reuse_storage )
     {
         count = true;
         refill = false;
+        estimated = false;
+        estimate_filled = false;
+        per_particle_radius = false;
+        cell_offset = 0;
+        neighbor_cap = 0;
+        overflow_count = 0;
+        dropped_count = 0;
+        for ( int d = 0; d < 3; ++d )
+        {
+            periodic[d] = false;
+            box[d] = grid_max[d] - grid_min[d];
+        }
+
+        // The stored neighbor ids are particle indices so every particle id
+        // must be representable in the index type.
+        checkIndexRange( slice.size() );
 
-        // Create the count view.
-        _data.counts =
-            Kokkos::View<int*, memory_space>( "num_neighbors", slice.size() );
+        // Create the count view. The counts of a previous build can be
+        // reused directly but must be reset since the fill accumulates.
+        if ( reuse && prev_data.counts.extent( 0 ) >= slice.size() )
+        {
+            _data.counts = Kokkos::subview(
+                prev_data.counts,
+                Kokkos::pair<std::size_t, std::size_t>( 0, slice.size() ) );
+            Kokkos::deep_copy( _data.counts, 0 );
+        }
+        else
+            _data.counts = Kokkos::View<IndexType*, memory_space>(
+                "num_neighbors", slice.size() );
 
         // Make a guess for the number of neighbors per particle for 2D lists.
         initCounts( LayoutTag() );
@@ -276,6 +483,62 @@ struct VerletListBuilder
         rsqr = neighborhood_radius * neighborhood_radius;
     }
 
+    // Stencil index range for one dimension of the home cell, unclamped in
+    // periodic dimensions so the stencil wraps around the grid. When a
+    // periodic dimension has fewer cells than the stencil width the range is
+    // narrowed so no wrapped cell is visited twice.
+    KOKKOS_INLINE_FUNCTION
+    void stencilRange( const int c, const int num_bin, const bool is_periodic,
+                       int& cmin, int& cmax ) const
+    {
+        if ( is_periodic )
+        {
+            int span = 2 * cell_stencil.cell_range + 1;
+            if ( span > num_bin )
+                span = num_bin;
+            cmin = c - cell_stencil.cell_range;
+            cmax = cmin + span;
+        }
+        else
+        {
+            cmin = ( c - cell_stencil.cell_range > 0 )
+                       ? c - cell_stencil.cell_range
+                       : 0;
+            cmax = ( c + cell_stencil.cell_range + 1 < num_bin )
+                       ? c + cell_stencil.cell_range + 1
+                       : num_bin;
+        }
+    }
+
+    // Wrap a stencil cell index into the primary image.
+    KOKKOS_INLINE_FUNCTION
+    int wrapCell( const int c, const int num_bin,
+                  const bool is_periodic ) const
+    {
+        if ( is_periodic )
+        {
+            if ( c < 0 )
+                return c + num_bin;
+            if ( c >= num_bin )
+                return c - num_bin;
+        }
+        return c;
+    }
+
+    // Minimum-image displacement in a given dimension.
+    KOKKOS_INLINE_FUNCTION
+    PositionValueType minimumImage( PositionValueType dc, const int d ) const
+    {
+        if ( periodic[d] )
+        {
+            if ( dc > 0.5 * box[d] )
+                dc -= box[d];
+            else if ( dc < -0.5 * box[d] )
+                dc += box[d];
+        }
+        return dc;
+    }
+
     // Neighbor count team operator (only used for CSR lists).
     struct CountNeighborsTag
     {
@@ -292,11 +555,15 @@ struct VerletListBuilder
     {
         // The league rank of the team is the cardinal cell index we are
         // working on.
-        int cell = team.league_rank();
+        int cell = team.league_rank() + cell_offset;
 
-        // Get the stencil for this cell.
+        // Get the stencil for this cell, wrapping in periodic dimensions.
+        int c_i, c_j, c_k;
+        cell_stencil.grid.ijkBinIndex( cell, c_i, c_j, c_k );
         int imin, imax, jmin, jmax, kmin, kmax;
-        cell_stencil.getCells( cell, imin, imax, jmin, jmax, kmin, kmax );
+        stencilRange( c_i, cell_stencil.grid._nx, periodic[0], imin, imax );
+        stencilRange( c_j, cell_stencil.grid._ny, periodic[1], jmin, jmax );
+        stencilRange( c_k, cell_stencil.grid._nz, periodic[2], kmin, kmax );
 
         // Operate on the particles in the bin.
         std::size_t b_offset = bin_data_1d.binOffset( cell );
@@ -320,15 +587,34 @@ struct VerletListBuilder
                         for ( int j = jmin; j < jmax; ++j )
                             for ( int k = kmin; k < kmax; ++k )
                             {
-                                // See if we should actually check this box for
-                                // neighbors.
-                                if ( cell_stencil.grid.minDistanceToPoint(
-                                         x_p, y_p, z_p, i, j, k ) <= rsqr )
+                                // Wrap periodic stencil cells into the
+                                // primary image.
+                                int iw = wrapCell( i, cell_stencil.grid._nx,
+                                                   periodic[0] );
+                                int jw = wrapCell( j, cell_stencil.grid._ny,
+                                                   periodic[1] );
+                                int kw = wrapCell( k, cell_stencil.grid._nz,
+                                                   periodic[2] );
+                                bool wrapped =
+                                    ( iw != i ) || ( jw != j ) || ( kw != k );
+
+                                // See if we should actually check this box
+                                // for neighbors. The cheap integer cell-pair
+                                // test culls boxes outside the cutoff of the
+                                // whole cell before the per-particle test.
+                                // Wrapped cells sit across the boundary and
+                                // are not culled.
+                                if ( wrapped ||
+                                     ( cell_stencil.cellInRange( c_i, c_j, c_k,
+                                                                 i, j, k ) &&
+                                       cell_stencil.grid.minDistanceToPoint(
+                                           x_p, y_p, z_p, i, j, k ) <= rsqr ) )
                                 {
                                     std::size_t n_offset =
-                                        linked_cell_list.binOffset( i, j, k );
+                                        linked_cell_list.binOffset( iw, jw,
+                                                                    kw );
                                     std::size_t num_n =
-                                        linked_cell_list.binSize( i, j, k );
+                                        linked_cell_list.binSize( iw, jw, kw );
 
                                     // Check the particles in this bin to see if
                                     // they are neighbors. If they are add to
@@ -374,6 +660,84 @@ struct VerletListBuilder
             neighbor_kernel( pid, x_p, y_p, z_p, n_offset, n, cell_count );
     }
 
+    // Flat count policy - one dynamically scheduled work item per cell
+    // (only used with the SerialOpTag build strategy).
+    using CountNeighborsFlatPolicy =
+        Kokkos::RangePolicy<execution_space, CountNeighborsTag,
+                            Kokkos::IndexType<int>,
+                            Kokkos::Schedule<Kokkos::Dynamic>>;
+
+    // Flat neighbor count operator (only used for CSR lists). One work item
+    // owns a whole cell with serial loops over its particles and stencil -
+    // no team abstraction. On host backends this is a task-per-cell
+    // decomposition: the cell and stencil positions a thread reads stay in
+    // its cache across the particles of the cell, and the dynamic schedule
+    // balances uneven cell occupancies.
+    KOKKOS_INLINE_FUNCTION
+    void operator()( const CountNeighborsTag&, const int c ) const
+    {
+        int cell = c + cell_offset;
+
+        // Get the stencil for this cell, wrapping in periodic dimensions.
+        int c_i, c_j, c_k;
+        cell_stencil.grid.ijkBinIndex( cell, c_i, c_j, c_k );
+        int imin, imax, jmin, jmax, kmin, kmax;
+        stencilRange( c_i, cell_stencil.grid._nx, periodic[0], imin, imax );
+        stencilRange( c_j, cell_stencil.grid._ny, periodic[1], jmin, jmax );
+        stencilRange( c_k, cell_stencil.grid._nz, periodic[2], kmin, kmax );
+
+        // Operate on the particles in the bin.
+        std::size_t b_offset = bin_data_1d.binOffset( cell );
+        int b_size = bin_data_1d.binSize( cell );
+        for ( int bi = 0; bi < b_size; ++bi )
+        {
+            // Get the true particle id.
+            std::size_t pid = linked_cell_list.permutation( bi + b_offset );
+
+            if ( ( pid >= pid_begin ) && ( pid < pid_end ) )
+            {
+                // Cache the particle coordinates.
+                double x_p = position( pid, 0 );
+                double y_p = position( pid, 1 );
+                double z_p = position( pid, 2 );
+
+                // Loop over the cell stencil with the same wrapping and
+                // culling as the team operator.
+                int stencil_count = 0;
+                for ( int i = imin; i < imax; ++i )
+                    for ( int j = jmin; j < jmax; ++j )
+                        for ( int k = kmin; k < kmax; ++k )
+                        {
+                            int iw = wrapCell( i, cell_stencil.grid._nx,
+                                               periodic[0] );
+                            int jw = wrapCell( j, cell_stencil.grid._ny,
+                                               periodic[1] );
+                            int kw = wrapCell( k, cell_stencil.grid._nz,
+                                               periodic[2] );
+                            bool wrapped = ( iw != i ) || ( jw != j ) ||
+                                           ( kw != k );
+
+                            if ( wrapped ||
+                                 ( cell_stencil.cellInRange( c_i, c_j, c_k,
+                                                             i, j, k ) &&
+                                   cell_stencil.grid.minDistanceToPoint(
+                                       x_p, y_p, z_p, i, j, k ) <= rsqr ) )
+                            {
+                                std::size_t n_offset =
+                                    linked_cell_list.binOffset( iw, jw, kw );
+                                int num_n =
+                                    linked_cell_list.binSize( iw, jw, kw );
+                                for ( int n = 0; n < num_n; ++n )
+                                    neighbor_kernel( pid, x_p, y_p, z_p,
+                                                     n_offset, n,
+                                                     stencil_count );
+                            }
+                        }
+                _data.counts( pid ) = stencil_count;
+            }
+        }
+    }
+
     // Neighbor count kernel
     KOKKOS_INLINE_FUNCTION
     void neighbor_kernel( const int pid, const double x_p, const double y_p,
@@ -394,27 +758,42 @@ struct VerletListBuilder
         {
             // Calculate the distance between the particle and its candidate
             // neighbor.
-            PositionValueType dx = x_p - x_n;
-            PositionValueType dy = y_p - y_n;
-            PositionValueType dz = z_p - z_n;
+            PositionValueType dx = minimumImage( x_p - x_n, 0 );
+            PositionValueType dy = minimumImage( y_p - y_n, 1 );
+            PositionValueType dz = minimumImage( z_p - z_n, 2 );
             PositionValueType dist_sqr = dx * dx + dy * dy + dz * dz;
 
             // If within the cutoff add to the count.
-            if ( dist_sqr <= rsqr )
+            if ( dist_sqr <= cutoffSqr( pid, nid ) )
                 local_count += 1;
         }
     }
 
+    // Squared cutoff for a candidate pair. With per-particle radii the pair
+    // cutoff is the larger of the two radii, otherwise the global cutoff.
+    KOKKOS_INLINE_FUNCTION
+    PositionValueType cutoffSqr( const std::size_t pid,
+                                 const std::size_t nid ) const
+    {
+        if ( !per_particle_radius )
+            return rsqr;
+        PositionValueType r_p = pair_radius( pid );
+        PositionValueType r_n = pair_radius( nid );
+        PositionValueType r = ( r_p > r_n ) ? r_p : r_n;
+        return r * r;
+    }
+
     // Process the CSR counts by computing offsets and allocating the neighbor
     // list.
     template <class KokkosMemorySpace>
     struct OffsetScanOp
     {
         using kokkos_mem_space = KokkosMemorySpace;
-        Kokkos::View<int*, kokkos_mem_space> counts;
-        Kokkos::View<int*, kokkos_mem_space> offsets;
+        Kokkos::View<IndexType*, kokkos_mem_space> counts;
+        Kokkos::View<IndexType*, kokkos_mem_space> offsets;
         KOKKOS_INLINE_FUNCTION
-        void operator()( const int i, int& update, const bool final_pass ) const
+        void operator()( const int i, std::size_t& update,
+                         const bool final_pass ) const
         {
             if ( final_pass )
                 offsets( i ) = update;
@@ -422,42 +801,197 @@ struct VerletListBuilder
         }
     };
 
-    void initCounts( VerletLayoutCSR ) {}
+    // Take a rank-1 storage view from a previous build when reuse is
+    // enabled and the previous allocation is large enough. Storage only
+    // ever grows in reuse mode.
+    Kokkos::View<IndexType*, memory_space>
+    reuseOrAllocate( const Kokkos::View<IndexType*, memory_space>& prev,
+                     const std::size_t size, const std::string& label )
+    {
+        if ( reuse && prev.extent( 0 ) >= size )
+            return Kokkos::subview(
+                prev, Kokkos::pair<std::size_t, std::size_t>( 0, size ) );
+        return Kokkos::View<IndexType*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( label ), size );
+    }
 
-    void initCounts( VerletLayout2D )
+    // Verify a storage size is representable in the neighbor index type.
+    // The offsets stored in the list data index into the neighbor storage
+    // so the total neighbor count must fit the type.
+    static void checkIndexRange( const std::size_t size )
+    {
+        if ( size > static_cast<std::size_t>(
+                        std::numeric_limits<IndexType>::max() ) )
+            throw std::runtime_error(
+                "Neighbor index type too narrow for the list size!" );
+    }
+
+    void initCounts( VerletLayoutCSR )
     {
         if ( max_n > 0 )
+        {
+            count = false;
+            estimated = true;
+
+            // Allocate max_n slots per particle and fill in a single pass
+            // instead of counting first. The storage is compacted to CSR
+            // afterward, or recounted into exactly sized storage if a
+            // particle overflows its slots.
+            checkIndexRange( _data.counts.size() * max_n );
+            _data.offsets = reuseOrAllocate(
+                prev_data.offsets, _data.counts.size(), "neighbor_offsets" );
+            auto offsets = _data.offsets;
+            auto num_slots = max_n;
+            Kokkos::parallel_for(
+                "Cabana::VerletListBuilder::init_offsets",
+                Kokkos::RangePolicy<execution_space>( 0, offsets.size() ),
+                KOKKOS_LAMBDA( const int p ) {
+                    offsets( p ) = p * num_slots;
+                } );
+            _data.neighbors =
+                reuseOrAllocate( prev_data.neighbors,
+                                 _data.counts.size() * max_n, "neighbors" );
+            _data.capacity = max_n;
+        }
+    }
+
+    void initCounts( VerletLayout2D )
+    {
+        if ( reuse && prev_data.neighbors.extent( 0 ) == _data.counts.size() &&
+             prev_data.neighbors.extent( 1 ) >= max_n &&
+             prev_data.neighbors.extent( 1 ) > 0 )
+        {
+            // Fill directly into the previous allocation. If it turns out
+            // too narrow the fill falls back to count-and-refill as with an
+            // explicit max_n guess.
+            count = false;
+            _data.neighbors = prev_data.neighbors;
+        }
+        else if ( max_n > 0 )
         {
             count = false;
 
-            _data.neighbors = Kokkos::View<int**, memory_space>(
+            _data.neighbors = Kokkos::View<IndexType**, memory_space>(
                 Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
                 _data.counts.size(), max_n );
         }
     }
 
-    void processCounts( VerletLayoutCSR )
+    void initCounts( VerletLayoutCompressed2D )
     {
-        // Allocate offsets.
-        _data.offsets = Kokkos::View<int*, memory_space>(
+        // The class blocks can only be sized from the exact counts so the
+        // compressed layout always counts first.
+    }
+
+    // Get the maximum neighbor count over all particles.
+    int maxNeighborCount()
+    {
+        auto counts = _data.counts;
+        int max_num_neighbor = 0;
+        Kokkos::Max<int> max_reduce( max_num_neighbor );
+        Kokkos::parallel_reduce(
+            "Cabana::VerletListBuilder::reduce_max",
+            Kokkos::RangePolicy<execution_space>( 0, _data.counts.size() ),
+            KOKKOS_LAMBDA( const int i, int& value ) {
+                if ( counts( i ) > value )
+                    value = static_cast<int>( counts( i ) );
+            },
+            max_reduce );
+        Kokkos::fence();
+        return max_num_neighbor;
+    }
+
+    // Compact the estimated uniformly-strided storage into exactly sized
+    // CSR storage.
+    void compactEstimate()
+    {
+        // Calculate exact offsets from the counts and the total number of
+        // neighbors. The scan accumulates in std::size_t so the total is
+        // exact even when the index type would overflow.
+        Kokkos::View<IndexType*, memory_space> offsets(
             Kokkos::ViewAllocateWithoutInitializing( "neighbor_offsets" ),
             _data.counts.size() );
+        OffsetScanOp<memory_space> offset_op;
+        offset_op.counts = _data.counts;
+        offset_op.offsets = offsets;
+        std::size_t total_num_neighbor;
+        Kokkos::RangePolicy<execution_space> range_policy(
+            0, _data.counts.extent( 0 ) );
+        Kokkos::parallel_scan( "Cabana::VerletListBuilder::offset_scan",
+                               range_policy, offset_op, total_num_neighbor );
+        Kokkos::fence();
+        checkIndexRange( total_num_neighbor );
+
+        // Gather the filled slots into an exactly sized neighbor list.
+        Kokkos::View<IndexType*, memory_space> neighbors(
+            Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
+            total_num_neighbor );
+        auto data = _data;
+        Kokkos::parallel_for(
+            "Cabana::VerletListBuilder::compact_neighbors", range_policy,
+            KOKKOS_LAMBDA( const int p ) {
+                for ( IndexType n = 0; n < data.counts( p ); ++n )
+                    neighbors( offsets( p ) + n ) =
+                        data.neighbors( data.offsets( p ) + n );
+            } );
+        Kokkos::fence();
+
+        _data.offsets = offsets;
+        _data.neighbors = neighbors;
+        _data.capacity = 0;
+    }
+
+    void processCounts( VerletLayoutCSR )
+    {
+        // Single-pass estimated fill. The storage was allocated up front
+        // and the process call before the fill has nothing to do.
+        if ( estimated )
+        {
+            if ( !estimate_filled )
+            {
+                estimate_filled = true;
+                return;
+            }
+
+            // The fill is done. The counts are exact either way because
+            // the fill guard only suppresses the out-of-bounds writes. If
+            // no particle overflowed its slots compact the storage to CSR
+            // and we are finished. When reusing storage the uniformly
+            // strided layout is kept instead - it is already valid CSR
+            // data and compacting would need a fresh allocation.
+            if ( maxNeighborCount() <= static_cast<int>( max_n ) )
+            {
+                if ( !reuse )
+                    compactEstimate();
+                return;
+            }
+
+            // Overflow - fall back to exactly sized storage and refill.
+            estimated = false;
+            refill = true;
+            _data.capacity = 0;
+        }
+
+        // Allocate offsets.
+        _data.offsets = reuseOrAllocate( prev_data.offsets,
+                                         _data.counts.size(),
+                                         "neighbor_offsets" );
 
         // Calculate offsets from counts and the total number of counts.
         OffsetScanOp<memory_space> offset_op;
         offset_op.counts = _data.counts;
         offset_op.offsets = _data.offsets;
-        int total_num_neighbor;
+        std::size_t total_num_neighbor;
         Kokkos::RangePolicy<execution_space> range_policy(
             0, _data.counts.extent( 0 ) );
         Kokkos::parallel_scan( "Cabana::VerletListBuilder::offset_scan",
                                range_policy, offset_op, total_num_neighbor );
         Kokkos::fence();
+        checkIndexRange( total_num_neighbor );
 
         // Allocate the neighbor list.
-        _data.neighbors = Kokkos::View<int*, memory_space>(
-            Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
-            total_num_neighbor );
+        _data.neighbors = reuseOrAllocate( prev_data.neighbors,
+                                           total_num_neighbor, "neighbors" );
 
         // Reset the counts. We count again when we fill.
         Kokkos::deep_copy( _data.counts, 0 );
@@ -468,18 +1002,7 @@ struct VerletListBuilder
     void processCounts( VerletLayout2D )
     {
         // Calculate the maximum number of neighbors.
-        auto counts = _data.counts;
-        int max_num_neighbor = 0;
-        Kokkos::Max<int> max_reduce( max_num_neighbor );
-        Kokkos::parallel_reduce(
-            "Cabana::VerletListBuilder::reduce_max",
-            Kokkos::RangePolicy<execution_space>( 0, _data.counts.size() ),
-            KOKKOS_LAMBDA( const int i, int& value ) {
-                if ( counts( i ) > value )
-                    value = counts( i );
-            },
-            max_reduce );
-        Kokkos::fence();
+        int max_num_neighbor = maxNeighborCount();
 
         // Reallocate the neighbor list if previous size is exceeded.
         if ( count or ( std::size_t )
@@ -487,12 +1010,100 @@ struct VerletListBuilder
         {
             refill = true;
             Kokkos::deep_copy( _data.counts, 0 );
-            _data.neighbors = Kokkos::View<int**, memory_space>(
+            _data.neighbors = Kokkos::View<IndexType**, memory_space>(
                 Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
                 _data.counts.size(), max_num_neighbor );
         }
     }
 
+    // Process compressed 2D counts by grouping particles into power-of-two
+    // row width classes and packing one appropriately sized 2D block per
+    // class.
+    void processCounts( VerletLayoutCompressed2D )
+    {
+        // One row width class per power of two covers any neighbor count.
+        constexpr int num_class = 32;
+
+        // Classify each particle by the smallest power-of-two row width
+        // that fits its neighbor count and size the classes. Particles
+        // without neighbors get no row at all.
+        auto counts = _data.counts;
+        std::size_t num_particle = counts.size();
+        Kokkos::View<int*, memory_space> particle_class(
+            Kokkos::ViewAllocateWithoutInitializing( "particle_class" ),
+            num_particle );
+        Kokkos::View<int*, memory_space> class_size( "class_size", num_class );
+        Kokkos::RangePolicy<execution_space> particle_policy( 0,
+                                                              num_particle );
+        Kokkos::parallel_for(
+            "Cabana::VerletListBuilder::classify_particles", particle_policy,
+            KOKKOS_LAMBDA( const int p ) {
+                if ( counts( p ) <= 0 )
+                {
+                    particle_class( p ) = -1;
+                    return;
+                }
+                int c = 0;
+                while ( ( 1 << c ) < counts( p ) )
+                    ++c;
+                particle_class( p ) = c;
+                Kokkos::atomic_fetch_add( &class_size( c ), 1 );
+            } );
+        Kokkos::fence();
+
+        // Stack the class blocks. Each block holds one row per particle of
+        // its class at the class width.
+        auto class_size_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), class_size );
+        Kokkos::View<IndexType*, Kokkos::HostSpace> block_start_host(
+            "block_start_host", num_class );
+        std::size_t total_storage = 0;
+        for ( int c = 0; c < num_class; ++c )
+        {
+            block_start_host( c ) = total_storage;
+            total_storage +=
+                static_cast<std::size_t>( class_size_host( c ) ) * ( 1 << c );
+        }
+        checkIndexRange( total_storage );
+        auto block_start = Kokkos::create_mirror_view_and_copy(
+            memory_space(), block_start_host );
+
+        // Assign each particle a row in its class block.
+        _data.row_start = Kokkos::View<IndexType*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "row_start" ),
+            num_particle );
+        _data.row_stride = Kokkos::View<IndexType*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "row_stride" ),
+            num_particle );
+        auto row_start = _data.row_start;
+        auto row_stride = _data.row_stride;
+        Kokkos::View<int*, memory_space> class_fill( "class_fill", num_class );
+        Kokkos::parallel_for(
+            "Cabana::VerletListBuilder::assign_rows", particle_policy,
+            KOKKOS_LAMBDA( const int p ) {
+                int c = particle_class( p );
+                if ( c < 0 )
+                {
+                    row_start( p ) = 0;
+                    row_stride( p ) = 0;
+                    return;
+                }
+                int row = Kokkos::atomic_fetch_add( &class_fill( c ), 1 );
+                row_start( p ) = block_start( c ) + row;
+                row_stride( p ) = class_size( c );
+            } );
+        Kokkos::fence();
+
+        // Allocate the packed storage. The counts are exact so no fill
+        // guard is needed.
+        _data.neighbors = Kokkos::View<IndexType*, memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing( "neighbors" ),
+            total_storage );
+
+        // Reset the counts. We count again when we fill.
+        Kokkos::deep_copy( _data.counts, 0 );
+    }
+
     // Neighbor count team operator.
     struct FillNeighborsTag
     {
@@ -508,11 +1119,15 @@ struct VerletListBuilder
     {
         // The league rank of the team is the cardinal cell index we are
         // working on.
-        int cell = team.league_rank();
+        int cell = team.league_rank() + cell_offset;
 
-        // Get the stencil for this cell.
+        // Get the stencil for this cell, wrapping in periodic dimensions.
+        int c_i, c_j, c_k;
+        cell_stencil.grid.ijkBinIndex( cell, c_i, c_j, c_k );
         int imin, imax, jmin, jmax, kmin, kmax;
-        cell_stencil.getCells( cell, imin, imax, jmin, jmax, kmin, kmax );
+        stencilRange( c_i, cell_stencil.grid._nx, periodic[0], imin, imax );
+        stencilRange( c_j, cell_stencil.grid._ny, periodic[1], jmin, jmax );
+        stencilRange( c_k, cell_stencil.grid._nz, periodic[2], kmin, kmax );
 
         // Operate on the particles in the bin.
         std::size_t b_offset = bin_data_1d.binOffset( cell );
@@ -535,17 +1150,36 @@ struct VerletListBuilder
                         for ( int j = jmin; j < jmax; ++j )
                             for ( int k = kmin; k < kmax; ++k )
                             {
-                                // See if we should actually check this box for
-                                // neighbors.
-                                if ( cell_stencil.grid.minDistanceToPoint(
-                                         x_p, y_p, z_p, i, j, k ) <= rsqr )
+                                // Wrap periodic stencil cells into the
+                                // primary image.
+                                int iw = wrapCell( i, cell_stencil.grid._nx,
+                                                   periodic[0] );
+                                int jw = wrapCell( j, cell_stencil.grid._ny,
+                                                   periodic[1] );
+                                int kw = wrapCell( k, cell_stencil.grid._nz,
+                                                   periodic[2] );
+                                bool wrapped =
+                                    ( iw != i ) || ( jw != j ) || ( kw != k );
+
+                                // See if we should actually check this box
+                                // for neighbors. The cheap integer cell-pair
+                                // test culls boxes outside the cutoff of the
+                                // whole cell before the per-particle test.
+                                // Wrapped cells sit across the boundary and
+                                // are not culled.
+                                if ( wrapped ||
+                                     ( cell_stencil.cellInRange( c_i, c_j, c_k,
+                                                                 i, j, k ) &&
+                                       cell_stencil.grid.minDistanceToPoint(
+                                           x_p, y_p, z_p, i, j, k ) <= rsqr ) )
                                 {
                                     // Check the particles in this bin to see if
                                     // they are neighbors.
                                     std::size_t n_offset =
-                                        linked_cell_list.binOffset( i, j, k );
+                                        linked_cell_list.binOffset( iw, jw,
+                                                                    kw );
                                     int num_n =
-                                        linked_cell_list.binSize( i, j, k );
+                                        linked_cell_list.binSize( iw, jw, kw );
                                     neighbor_for( team, pid, x_p, y_p, z_p,
                                                   n_offset, num_n,
                                                   BuildOpTag() );
@@ -601,46 +1235,414 @@ struct VerletListBuilder
         {
             // Calculate the distance between the particle and its candidate
             // neighbor.
-            PositionValueType dx = x_p - x_n;
-            PositionValueType dy = y_p - y_n;
-            PositionValueType dz = z_p - z_n;
+            PositionValueType dx = minimumImage( x_p - x_n, 0 );
+            PositionValueType dy = minimumImage( y_p - y_n, 1 );
+            PositionValueType dz = minimumImage( z_p - z_n, 2 );
             PositionValueType dist_sqr = dx * dx + dy * dy + dz * dz;
 
             // If within the cutoff increment the neighbor count and add as a
             // neighbor at that index.
-            if ( dist_sqr <= rsqr )
+            if ( dist_sqr <= cutoffSqr( pid, nid ) )
             {
                 _data.addNeighbor( pid, nid );
             }
         }
     }
-};
-
-//---------------------------------------------------------------------------//
 
-//! \endcond
-} // end namespace Impl
-
-//---------------------------------------------------------------------------//
-/*!
-  \brief Neighbor list implementation based on binning particles on a 3d
-  Cartesian grid with cells of the same size as the interaction distance.
+    // Flat fill policy - one dynamically scheduled work item per cell
+    // (only used with the SerialOpTag build strategy).
+    using FillNeighborsFlatPolicy =
+        Kokkos::RangePolicy<execution_space, FillNeighborsTag,
+                            Kokkos::IndexType<int>,
+                            Kokkos::Schedule<Kokkos::Dynamic>>;
 
-  \tparam MemorySpace The Kokkos memory space for storing the neighbor list.
+    // Flat neighbor fill operator - one work item owns a whole cell with
+    // serial loops, as in the flat count operator.
+    KOKKOS_INLINE_FUNCTION
+    void operator()( const FillNeighborsTag&, const int c ) const
+    {
+        int cell = c + cell_offset;
 
-  \tparam AlgorithmTag Tag indicating whether to build a full or half neighbor
-  list.
+        // Get the stencil for this cell, wrapping in periodic dimensions.
+        int c_i, c_j, c_k;
+        cell_stencil.grid.ijkBinIndex( cell, c_i, c_j, c_k );
+        int imin, imax, jmin, jmax, kmin, kmax;
+        stencilRange( c_i, cell_stencil.grid._nx, periodic[0], imin, imax );
+        stencilRange( c_j, cell_stencil.grid._ny, periodic[1], jmin, jmax );
+        stencilRange( c_k, cell_stencil.grid._nz, periodic[2], kmin, kmax );
 
-  \tparam LayoutTag Tag indicating whether to use a CSR or 2D data layout.
+        // Operate on the particles in the bin.
+        std::size_t b_offset = bin_data_1d.binOffset( cell );
+        int b_size = bin_data_1d.binSize( cell );
+        for ( int bi = 0; bi < b_size; ++bi )
+        {
+            // Get the true particle id.
+            std::size_t pid = linked_cell_list.permutation( bi + b_offset );
 
-  \tparam BuildTag Tag indicating whether to use hierarchical team or team
-  vector parallelism when building neighbor lists.
+            if ( ( pid >= pid_begin ) && ( pid < pid_end ) )
+            {
+                // Cache the particle coordinates.
+                double x_p = position( pid, 0 );
+                double y_p = position( pid, 1 );
+                double z_p = position( pid, 2 );
+
+                // Loop over the cell stencil with the same wrapping and
+                // culling as the team operator.
+                for ( int i = imin; i < imax; ++i )
+                    for ( int j = jmin; j < jmax; ++j )
+                        for ( int k = kmin; k < kmax; ++k )
+                        {
+                            int iw = wrapCell( i, cell_stencil.grid._nx,
+                                               periodic[0] );
+                            int jw = wrapCell( j, cell_stencil.grid._ny,
+                                               periodic[1] );
+                            int kw = wrapCell( k, cell_stencil.grid._nz,
+                                               periodic[2] );
+                            bool wrapped = ( iw != i ) || ( jw != j ) ||
+                                           ( kw != k );
+
+                            if ( wrapped ||
+                                 ( cell_stencil.cellInRange( c_i, c_j, c_k,
+                                                             i, j, k ) &&
+                                   cell_stencil.grid.minDistanceToPoint(
+                                       x_p, y_p, z_p, i, j, k ) <= rsqr ) )
+                            {
+                                std::size_t n_offset =
+                                    linked_cell_list.binOffset( iw, jw, kw );
+                                int num_n =
+                                    linked_cell_list.binSize( iw, jw, kw );
+                                for ( int n = 0; n < num_n; ++n )
+                                    neighbor_kernel( pid, x_p, y_p, z_p,
+                                                     n_offset, n );
+                            }
+                        }
+            }
+        }
+    }
+
+    // -------------------------------
+    // Build strategy launch.
+
+    // Launch the count pass over a range of cells with the strategy
+    // selected by the build tag. The team strategies map each cell to a
+    // team with nested parallelism over its particles and candidates for
+    // the wide hierarchies of devices.
+    template <class Tag>
+    void launchCount( const int num_cell, Tag )
+    {
+        CountNeighborsPolicy count_policy( num_cell, Kokkos::AUTO, 4 );
+        Kokkos::parallel_for( "Cabana::VerletList::count_neighbors",
+                              count_policy, *this );
+    }
+
+    // The flat strategy maps each cell to one dynamically scheduled work
+    // item - the host-oriented path.
+    void launchCount( const int num_cell, SerialOpTag )
+    {
+        CountNeighborsFlatPolicy count_policy( 0, num_cell );
+        Kokkos::parallel_for( "Cabana::VerletList::count_neighbors",
+                              count_policy, *this );
+    }
+
+    void launchCount( const int num_cell )
+    {
+        launchCount( num_cell, BuildOpTag() );
+    }
+
+    // Launch the fill pass over a range of cells with the strategy selected
+    // by the build tag.
+    template <class Tag>
+    void launchFill( const int num_cell, Tag )
+    {
+        FillNeighborsPolicy fill_policy( num_cell, Kokkos::AUTO, 4 );
+        Kokkos::parallel_for( "Cabana::VerletList::fill_neighbors",
+                              fill_policy, *this );
+    }
+
+    void launchFill( const int num_cell, SerialOpTag )
+    {
+        FillNeighborsFlatPolicy fill_policy( 0, num_cell );
+        Kokkos::parallel_for( "Cabana::VerletList::fill_neighbors",
+                              fill_policy, *this );
+    }
+
+    void launchFill( const int num_cell )
+    {
+        launchFill( num_cell, BuildOpTag() );
+    }
+
+    // -------------------------------
+    // Per-particle neighbor cap.
+
+    // Arm a hard cap on the neighbors retained per particle. Forces
+    // count-then-fill so the storage can be sized from the clamped counts,
+    // disabling the CSR single-pass estimated fill.
+    void applyNeighborCap( const std::size_t cap )
+    {
+        checkIndexRange( cap );
+        neighbor_cap = cap;
+        count = true;
+        refill = false;
+        estimated = false;
+        estimate_filled = false;
+        _data.capacity = 0;
+    }
+
+    // Clamp the exact counts to the cap before the storage is sized from
+    // them, bounding the neighbor storage by num_particles * cap, and arm
+    // the fill guard that drops writes beyond a row's clamped size. No-op
+    // without a cap.
+    void clampCounts()
+    {
+        if ( 0 == neighbor_cap )
+            return;
+        auto counts = _data.counts;
+        const IndexType cap = neighbor_cap;
+        Kokkos::parallel_for(
+            "Cabana::VerletListBuilder::clamp_counts",
+            Kokkos::RangePolicy<execution_space>( 0, counts.size() ),
+            KOKKOS_LAMBDA( const int p ) {
+                if ( counts( p ) > cap )
+                    counts( p ) = cap;
+            } );
+        Kokkos::fence();
+        _data.capacity = cap;
+    }
+
+    // After the fill the counts hold the exact candidate numbers again
+    // because the fill guard only suppresses the out-of-row writes. Record
+    // the overflow report and rebuild the overflowing rows with
+    // deterministic nearest-first retention. No-op without a cap.
+    void finalizeCap()
+    {
+        if ( 0 == neighbor_cap )
+            return;
+        _data.capacity = 0;
+
+        auto counts = _data.counts;
+        const IndexType cap = neighbor_cap;
+        std::size_t num_overflow = 0;
+        std::size_t num_dropped = 0;
+        Kokkos::parallel_reduce(
+            "Cabana::VerletListBuilder::cap_overflow",
+            Kokkos::RangePolicy<execution_space>( 0, counts.size() ),
+            KOKKOS_LAMBDA( const int p, std::size_t& over,
+                           std::size_t& drop ) {
+                if ( counts( p ) > cap )
+                {
+                    over += 1;
+                    drop += counts( p ) - cap;
+                }
+            },
+            num_overflow, num_dropped );
+        Kokkos::fence();
+        overflow_count = num_overflow;
+        dropped_count = num_dropped;
+        if ( 0 == num_overflow )
+            return;
+
+        // Rebuild the rows that overflowed. The kernel walks all cells and
+        // skips the particles whose rows are complete.
+        cell_offset = 0;
+        RefineCapPolicy refine_policy( bin_data_1d.numBin(), Kokkos::AUTO,
+                                       4 );
+        Kokkos::parallel_for( "Cabana::VerletListBuilder::refine_cap",
+                              refine_policy, *this );
+        Kokkos::fence();
+    }
+
+    // Cap refinement team operator - one serial nearest-first row rebuild
+    // per overflowing particle.
+    struct RefineCapTag
+    {
+    };
+    using RefineCapPolicy =
+        Kokkos::TeamPolicy<execution_space, RefineCapTag,
+                           Kokkos::IndexType<int>,
+                           Kokkos::Schedule<Kokkos::Dynamic>>;
+    KOKKOS_INLINE_FUNCTION
+    void operator()( const RefineCapTag&,
+                     const typename RefineCapPolicy::member_type& team ) const
+    {
+        // The league rank of the team is the cardinal cell index we are
+        // working on.
+        int cell = team.league_rank() + cell_offset;
+
+        // Get the stencil for this cell, wrapping in periodic dimensions.
+        int c_i, c_j, c_k;
+        cell_stencil.grid.ijkBinIndex( cell, c_i, c_j, c_k );
+        int imin, imax, jmin, jmax, kmin, kmax;
+        stencilRange( c_i, cell_stencil.grid._nx, periodic[0], imin, imax );
+        stencilRange( c_j, cell_stencil.grid._ny, periodic[1], jmin, jmax );
+        stencilRange( c_k, cell_stencil.grid._nz, periodic[2], kmin, kmax );
+
+        // Operate on the overflowing particles in the bin.
+        std::size_t b_offset = bin_data_1d.binOffset( cell );
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange( team, 0, bin_data_1d.binSize( cell ) ),
+            [&]( const int bi ) {
+                std::size_t pid = linked_cell_list.permutation( bi + b_offset );
+                if ( ( pid >= pid_begin ) && ( pid < pid_end ) &&
+                     static_cast<std::size_t>( _data.counts( pid ) ) >
+                         neighbor_cap )
+                    Kokkos::single( Kokkos::PerThread( team ), [&]() {
+                        refineRow( pid, c_i, c_j, c_k, imin, imax, jmin,
+                                   jmax, kmin, kmax );
+                    } );
+            } );
+    }
+
+    // Serially rebuild one overflowing row keeping the cap nearest
+    // candidates. One thread owns the row and visits the candidates in a
+    // fixed traversal order, so the retained set is deterministic; equal
+    // distances keep the earlier-visited candidate. The row comes out
+    // sorted by increasing distance.
+    KOKKOS_INLINE_FUNCTION
+    void refineRow( const std::size_t pid, const int c_i, const int c_j,
+                    const int c_k, const int imin, const int imax,
+                    const int jmin, const int jmax, const int kmin,
+                    const int kmax ) const
+    {
+        double x_p = position( pid, 0 );
+        double y_p = position( pid, 1 );
+        double z_p = position( pid, 2 );
+
+        IndexType kept = 0;
+        for ( int i = imin; i < imax; ++i )
+            for ( int j = jmin; j < jmax; ++j )
+                for ( int k = kmin; k < kmax; ++k )
+                {
+                    // Wrap periodic stencil cells into the primary image
+                    // and cull boxes outside the cutoff as in the fill.
+                    int iw = wrapCell( i, cell_stencil.grid._nx,
+                                       periodic[0] );
+                    int jw = wrapCell( j, cell_stencil.grid._ny,
+                                       periodic[1] );
+                    int kw = wrapCell( k, cell_stencil.grid._nz,
+                                       periodic[2] );
+                    bool wrapped =
+                        ( iw != i ) || ( jw != j ) || ( kw != k );
+
+                    if ( wrapped ||
+                         ( cell_stencil.cellInRange( c_i, c_j, c_k, i, j,
+                                                     k ) &&
+                           cell_stencil.grid.minDistanceToPoint(
+                               x_p, y_p, z_p, i, j, k ) <= rsqr ) )
+                    {
+                        std::size_t n_offset =
+                            linked_cell_list.binOffset( iw, jw, kw );
+                        int num_n = linked_cell_list.binSize( iw, jw, kw );
+                        for ( int n = 0; n < num_n; ++n )
+                        {
+                            std::size_t nid =
+                                linked_cell_list.permutation( n_offset + n );
+                            double x_n = position( nid, 0 );
+                            double y_n = position( nid, 1 );
+                            double z_n = position( nid, 2 );
+                            if ( !NeighborDiscriminator<AlgorithmTag>::
+                                     isValid( pid, x_p, y_p, z_p, nid, x_n,
+                                              y_n, z_n ) )
+                                continue;
+                            PositionValueType dx =
+                                minimumImage( x_p - x_n, 0 );
+                            PositionValueType dy =
+                                minimumImage( y_p - y_n, 1 );
+                            PositionValueType dz =
+                                minimumImage( z_p - z_n, 2 );
+                            PositionValueType dist_sqr =
+                                dx * dx + dy * dy + dz * dz;
+                            if ( dist_sqr <= cutoffSqr( pid, nid ) )
+                                insertNearest( pid, x_p, y_p, z_p, nid,
+                                               dist_sqr, kept );
+                        }
+                    }
+                }
+        _data.counts( pid ) = kept;
+    }
+
+    // Squared minimum-image distance from a particle to a stored neighbor.
+    KOKKOS_INLINE_FUNCTION
+    PositionValueType neighborDistSqr( const double x_p, const double y_p,
+                                       const double z_p,
+                                       const IndexType nid ) const
+    {
+        PositionValueType dx = minimumImage( x_p - position( nid, 0 ), 0 );
+        PositionValueType dy = minimumImage( y_p - position( nid, 1 ), 1 );
+        PositionValueType dz = minimumImage( z_p - position( nid, 2 ), 2 );
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    // Insert a candidate into a distance-sorted bounded row, evicting the
+    // farthest entry when the row is full. Distances of the stored entries
+    // are recomputed on comparison as in the post-build distance sort.
+    KOKKOS_INLINE_FUNCTION
+    void insertNearest( const std::size_t pid, const double x_p,
+                        const double y_p, const double z_p,
+                        const IndexType nid,
+                        const PositionValueType dist_sqr,
+                        IndexType& kept ) const
+    {
+        IndexType m = kept;
+        if ( static_cast<std::size_t>( kept ) == neighbor_cap )
+        {
+            // The row is full - the candidate must beat the farthest
+            // retained entry.
+            if ( !( dist_sqr <
+                    neighborDistSqr( x_p, y_p, z_p,
+                                     _data.getNeighbor( pid, kept - 1 ) ) ) )
+                return;
+            m = kept - 1;
+        }
+        else
+            ++kept;
+        while ( 0 < m &&
+                dist_sqr < neighborDistSqr(
+                               x_p, y_p, z_p,
+                               _data.getNeighbor( pid, m - 1 ) ) )
+        {
+            _data.setNeighbor( pid, m, _data.getNeighbor( pid, m - 1 ) );
+            --m;
+        }
+        _data.setNeighbor( pid, m, nid );
+    }
+};
+
+//---------------------------------------------------------------------------//
+
+//! \endcond
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Neighbor list implementation based on binning particles on a 3d
+  Cartesian grid with cells of the same size as the interaction distance.
+
+  \tparam MemorySpace The Kokkos memory space for storing the neighbor list.
+
+  \tparam AlgorithmTag Tag indicating whether to build a full or half neighbor
+  list.
+
+  \tparam LayoutTag Tag indicating whether to use a CSR, 2D, or compressed
+  2D data layout.
+
+  \tparam BuildTag Tag indicating the parallel strategy used to build the
+  neighbor list. TeamOpTag and TeamVectorOpTag use hierarchical team
+  parallelism tuned for the wide thread hierarchies of devices. SerialOpTag
+  builds with a flat task-per-cell decomposition with serial inner loops -
+  the strategy of choice on host backends, where the team abstraction costs
+  more than it buys and one thread owning a whole cell keeps the stencil
+  data in its cache.
+
+  \tparam IndexType Integer type of the stored neighbor ids, counts and
+  offsets. Defaults to int. A wider type supports lists with more than
+  2^31 total neighbors; builds check at runtime that the list fits the
+  type and throw otherwise.
 
   Neighbor list implementation most appropriate for somewhat regularly
   distributed particles due to the use of a Cartesian grid.
 */
 template <class MemorySpace, class AlgorithmTag, class LayoutTag,
-          class BuildTag = TeamVectorOpTag>
+          class BuildTag = TeamVectorOpTag, class IndexType = int>
 class VerletList
 {
   public:
@@ -655,8 +1657,50 @@ class VerletList
     //! Kokkos device type with the default execution_space.
     using device_type [[deprecated]] = typename memory_space::device_type;
 
+    //! Tag indicating whether the list is full or half.
+    using algorithm_tag = AlgorithmTag;
+
+    //! Tag indicating the neighbor data layout.
+    using layout_tag = LayoutTag;
+
+    //! Tag indicating the build parallelism strategy.
+    using build_tag = BuildTag;
+
+    //! Integer type of the stored neighbor ids, counts and offsets.
+    using index_type = IndexType;
+
     //! Verlet list data.
-    VerletListData<memory_space, LayoutTag> _data;
+    VerletListData<memory_space, LayoutTag, IndexType> _data;
+
+    //! Half of the skin radius used in the last build. Zero if the list was
+    //! built without a skin.
+    double _half_skin = 0.0;
+
+    //! Particle positions at the time of the last build. Only stored when
+    //! building with a skin radius.
+    Kokkos::View<double* [3], memory_space> _build_positions;
+
+    //! Largest per-particle neighbor count of the last build. Seeds the
+    //! single-pass estimated fill of the next CSR build.
+    std::size_t _prev_max_neighbors = 0;
+
+    //! Whether rebuilds reuse the previous storage when it is large enough.
+    bool _reuse_storage = false;
+
+    //! Periodic dimension flags. Builds wrap neighbor searches across the
+    //! grid bounds in periodic dimensions using the minimum image convention.
+    bool _periodic[3] = { false, false, false };
+
+    //! Hard cap on the neighbors stored per particle. Zero means unbounded.
+    std::size_t _max_neighbors_cap = 0;
+
+    //! Number of particles whose neighborhood exceeded the cap in the last
+    //! build. Zero when the build was uncapped.
+    std::size_t _cap_overflow_count = 0;
+
+    //! Total number of in-range neighbors dropped by the cap in the last
+    //! build. Zero when the build was uncapped.
+    std::size_t _cap_dropped_count = 0;
 
     /*!
       \brief Default constructor.
@@ -689,8 +1733,17 @@ class VerletList
       in each dimension.
 
       \param max_neigh Optional maximum number of neighbors per particle to
-      pre-allocate the neighbor list. Potentially avoids recounting with 2D
-      layout only.
+      pre-allocate the neighbor list. Potentially avoids recounting with the
+      2D layout. With the CSR layout this enables a single-pass build that
+      fills estimated per-particle slots directly and compacts afterward,
+      recounting only if a particle exceeds the estimate. CSR rebuilds seed
+      the estimate from the previous build automatically.
+
+      \param skin Optional skin radius added to the neighborhood radius when
+      searching for neighbors. When positive, the build-time positions are
+      stored so needsRebuild() can check whether any particle has moved more
+      than half the skin, in which case the list may be missing neighbors
+      within the neighborhood radius and must be rebuilt.
 
       Particles outside of the neighborhood radius will not be considered
       neighbors. Only compute the neighbors of those that are within the given
@@ -704,11 +1757,58 @@ class VerletList
                 const typename PositionSlice::value_type grid_min[3],
                 const typename PositionSlice::value_type grid_max[3],
                 const std::size_t max_neigh = 0,
+                const typename PositionSlice::value_type skin = 0,
                 typename std::enable_if<( is_slice<PositionSlice>::value ),
                                         int>::type* = 0 )
     {
         build( x, begin, end, neighborhood_radius, cell_size_ratio, grid_min,
-               grid_max, max_neigh );
+               grid_max, max_neigh, skin );
+    };
+
+    /*!
+      \brief VerletList constructor. Given a list of particle positions and
+      per-particle neighborhood radii calculate the neighbor list.
+
+      \param x The slice containing the particle positions.
+
+      \param begin The beginning particle index to compute neighbors for.
+
+      \param end The end particle index to compute neighbors for.
+
+      \param radius Per-particle neighborhood radii, accessed as radius(p).
+      May be a slice or a rank-1 Kokkos view. Two particles are neighbors
+      when they are within the larger of their two radii.
+
+      \param cell_size_ratio The ratio of the cell size in the Cartesian grid
+      to the largest per-particle radius.
+
+      \param grid_min The minimum value of the grid containing the particles
+      in each dimension.
+
+      \param grid_max The maximum value of the grid containing the particles
+      in each dimension.
+
+      \param max_neigh Optional maximum number of neighbors per particle to
+      pre-allocate the neighbor list.
+
+      \param skin Optional skin radius added to each per-particle radius when
+      searching for neighbors.
+    */
+    template <class PositionSlice, class RadiusType>
+    VerletList( PositionSlice x, const std::size_t begin, const std::size_t end,
+                RadiusType radius,
+                const typename PositionSlice::value_type cell_size_ratio,
+                const typename PositionSlice::value_type grid_min[3],
+                const typename PositionSlice::value_type grid_max[3],
+                const std::size_t max_neigh = 0,
+                const typename PositionSlice::value_type skin = 0,
+                typename std::enable_if<
+                    ( is_slice<PositionSlice>::value &&
+                      !std::is_arithmetic<RadiusType>::value ),
+                    int>::type* = 0 )
+    {
+        build( x, begin, end, radius, cell_size_ratio, grid_min, grid_max,
+               max_neigh, skin );
     };
 
     /*!
@@ -721,11 +1821,12 @@ class VerletList
                 const typename PositionSlice::value_type cell_size_ratio,
                 const typename PositionSlice::value_type grid_min[3],
                 const typename PositionSlice::value_type grid_max[3],
-                const std::size_t max_neigh = 0 )
+                const std::size_t max_neigh = 0,
+                const typename PositionSlice::value_type skin = 0 )
     {
         // Use the default execution space.
         build( execution_space{}, x, begin, end, neighborhood_radius,
-               cell_size_ratio, grid_min, grid_max, max_neigh );
+               cell_size_ratio, grid_min, grid_max, max_neigh, skin );
     }
     /*!
       \brief Given a list of particle positions and a neighborhood radius
@@ -738,18 +1839,351 @@ class VerletList
                 const typename PositionSlice::value_type cell_size_ratio,
                 const typename PositionSlice::value_type grid_min[3],
                 const typename PositionSlice::value_type grid_max[3],
-                const std::size_t max_neigh = 0 )
+                const std::size_t max_neigh = 0,
+                const typename PositionSlice::value_type skin = 0 )
+    {
+        static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+
+        using device_type = Kokkos::Device<ExecutionSpace, memory_space>;
+
+        // Create a builder functor. The skin extends the search radius so
+        // the list stays valid until a particle moves more than half the
+        // skin.
+        using builder_type =
+            Impl::VerletListBuilder<device_type, PositionSlice, AlgorithmTag,
+                                    LayoutTag, BuildTag, IndexType>;
+        builder_type builder( x, begin, end, neighborhood_radius + skin,
+                              cell_size_ratio, grid_min, grid_max,
+                              buildEstimate( max_neigh ), _data,
+                              _reuse_storage );
+        for ( int d = 0; d < 3; ++d )
+            builder.periodic[d] = _periodic[d];
+        if ( _max_neighbors_cap > 0 )
+            builder.applyNeighborCap( _max_neighbors_cap );
+
+        buildImpl( ExecutionSpace{}, builder, x, skin );
+    }
+
+    /*!
+      \brief Given per-particle neighborhood radii calculate the neighbor
+      list.
+
+      \param x The slice containing the particle positions.
+
+      \param begin The beginning particle index to compute neighbors for.
+
+      \param end The end particle index to compute neighbors for.
+
+      \param radius Per-particle neighborhood radii, accessed as radius(p).
+      May be a slice or a rank-1 Kokkos view accessible from the execution
+      space. Two particles are neighbors when they are within the larger of
+      their two radii, so the neighborhood relation remains symmetric.
+
+      \param cell_size_ratio The ratio of the cell size in the Cartesian grid
+      to the largest per-particle radius.
+
+      \param grid_min The minimum value of the grid containing the particles
+      in each dimension.
+
+      \param grid_max The maximum value of the grid containing the particles
+      in each dimension.
+
+      \param max_neigh Optional maximum number of neighbors per particle to
+      pre-allocate the neighbor list.
+
+      \param skin Optional skin radius added to each per-particle radius when
+      searching for neighbors.
+
+      Particles are binned by the largest radius so that all candidates are
+      covered by the cell stencil, while each pair is tested against its own
+      cutoff. This keeps list memory proportional to the physically needed
+      neighborhoods when the radii vary strongly.
+    */
+    template <class PositionSlice, class RadiusType>
+    void build( PositionSlice x, const std::size_t begin, const std::size_t end,
+                RadiusType radius,
+                const typename PositionSlice::value_type cell_size_ratio,
+                const typename PositionSlice::value_type grid_min[3],
+                const typename PositionSlice::value_type grid_max[3],
+                const std::size_t max_neigh = 0,
+                const typename PositionSlice::value_type skin = 0,
+                typename std::enable_if<!std::is_arithmetic<RadiusType>::value,
+                                        int>::type* = 0 )
+    {
+        // Use the default execution space.
+        build( execution_space{}, x, begin, end, radius, cell_size_ratio,
+               grid_min, grid_max, max_neigh, skin );
+    }
+
+    /*!
+      \brief Given per-particle neighborhood radii calculate the neighbor
+      list.
+    */
+    template <class PositionSlice, class RadiusType, class ExecutionSpace>
+    void build( ExecutionSpace, PositionSlice x, const std::size_t begin,
+                const std::size_t end, RadiusType radius,
+                const typename PositionSlice::value_type cell_size_ratio,
+                const typename PositionSlice::value_type grid_min[3],
+                const typename PositionSlice::value_type grid_max[3],
+                const std::size_t max_neigh = 0,
+                const typename PositionSlice::value_type skin = 0,
+                typename std::enable_if<!std::is_arithmetic<RadiusType>::value,
+                                        int>::type* = 0 )
     {
         static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
 
         using device_type = Kokkos::Device<ExecutionSpace, memory_space>;
+        using value_type = typename PositionSlice::value_type;
+
+        // Gather the per-particle radii with the skin applied and find the
+        // largest radius for binning and stencil culling.
+        Kokkos::View<value_type*, memory_space> pair_radius(
+            Kokkos::ViewAllocateWithoutInitializing( "neighbor_radius" ),
+            x.size() );
+        value_type max_radius = 0.0;
+        Kokkos::Max<value_type> max_reduce( max_radius );
+        Kokkos::parallel_reduce(
+            "Cabana::VerletList::gather_radius",
+            Kokkos::RangePolicy<ExecutionSpace>( 0, x.size() ),
+            KOKKOS_LAMBDA( const int p, value_type& value ) {
+                pair_radius( p ) = radius( p ) + skin;
+                if ( pair_radius( p ) > value )
+                    value = pair_radius( p );
+            },
+            max_reduce );
+        Kokkos::fence();
 
-        // Create a builder functor.
+        // Create a builder functor binning with the largest radius and
+        // testing each pair against its own cutoff.
         using builder_type =
             Impl::VerletListBuilder<device_type, PositionSlice, AlgorithmTag,
-                                    LayoutTag, BuildTag>;
-        builder_type builder( x, begin, end, neighborhood_radius,
-                              cell_size_ratio, grid_min, grid_max, max_neigh );
+                                    LayoutTag, BuildTag, IndexType>;
+        builder_type builder( x, begin, end, max_radius, cell_size_ratio,
+                              grid_min, grid_max, buildEstimate( max_neigh ),
+                              _data, _reuse_storage );
+        builder.pair_radius = pair_radius;
+        builder.per_particle_radius = true;
+        for ( int d = 0; d < 3; ++d )
+            builder.periodic[d] = _periodic[d];
+        if ( _max_neighbors_cap > 0 )
+            builder.applyNeighborCap( _max_neighbors_cap );
+
+        buildImpl( ExecutionSpace{}, builder, x, skin );
+    }
+
+    /*!
+      \brief Set the periodic dimensions for subsequent builds.
+
+      \param x Whether the x dimension is periodic.
+
+      \param y Whether the y dimension is periodic.
+
+      \param z Whether the z dimension is periodic.
+
+      In a periodic dimension the grid bounds passed to build() define the
+      periodic box. Neighbor searches wrap the cell stencil around the grid
+      and measure pair distances to the nearest image, so periodic neighbors
+      are found without creating ghost copies of boundary particles. All
+      particles must lie inside the grid bounds.
+    */
+    void setPeriodic( const bool x, const bool y, const bool z )
+    {
+        _periodic[0] = x;
+        _periodic[1] = y;
+        _periodic[2] = z;
+    }
+
+    /*!
+      \brief Cap the number of neighbors stored per particle on subsequent
+      builds.
+
+      \param max_neighbors Maximum neighbors retained per particle. Zero
+      removes the cap.
+
+      A capped build bounds the neighbor storage by num_particles *
+      max_neighbors regardless of the particle density, so a transient
+      density spike degrades the list instead of exhausting device memory.
+      When a particle has more in-range neighbors than the cap the nearest
+      ones are kept, deterministically: candidates are visited in a fixed
+      traversal order and equal distances keep the earlier candidate. The
+      overflow is reported by capOverflowCount() and capDroppedCount() after
+      the build. Capped CSR builds always count before filling, so the
+      single-pass estimated fill is disabled.
+    */
+    void setMaxNeighbors( const std::size_t max_neighbors )
+    {
+        _max_neighbors_cap = max_neighbors;
+    }
+
+    /*!
+      \brief Get the per-particle neighbor cap. Zero means unbounded.
+    */
+    std::size_t maxNeighbors() const { return _max_neighbors_cap; }
+
+    /*!
+      \brief Get the number of particles whose neighborhood exceeded the cap
+      in the last build.
+    */
+    std::size_t capOverflowCount() const { return _cap_overflow_count; }
+
+    /*!
+      \brief Get the total number of in-range neighbors dropped by the cap
+      in the last build.
+    */
+    std::size_t capDroppedCount() const { return _cap_dropped_count; }
+
+    /*!
+      \brief Enable grow-only reuse of the list storage on rebuild.
+
+      Subsequent build() calls reuse the previous counts, offsets and
+      neighbor allocations whenever they are large enough, growing them
+      only when needed, so steady-state rebuilds are allocation-free. CSR
+      lists built through the single-pass estimated fill keep their
+      uniformly strided storage instead of compacting, trading memory
+      proportional to the estimate for the avoided allocation and
+      compaction pass.
+    */
+    void enableStorageReuse() { _reuse_storage = true; }
+
+    /*!
+      \brief Return to exactly sized storage allocation on rebuild.
+    */
+    void disableStorageReuse() { _reuse_storage = false; }
+
+    /*!
+      \brief Whether rebuilds reuse the existing storage.
+    */
+    bool storageReuseEnabled() const { return _reuse_storage; }
+
+    /*!
+      \brief Make the list tolerate particles appended since the last build.
+
+      \param num_particles The container size after the insertion.
+
+      Extends the per-particle arrays so the appended particles report zero
+      neighbors instead of reading past the list. Existing particles keep
+      their neighbor lists, so kernels over the grown range remain valid
+      and the full rebuild that merges the inserted particles can be
+      deferred out of an injection burst to the next build(). Note that
+      until that rebuild the inserted particles are invisible as neighbors
+      - acceptable only when the deferred interactions are tolerable for a
+      step - and that needsRebuild() reports a list stale once the size
+      changes.
+    */
+    void tolerateInsertions( const std::size_t num_particles )
+    {
+        _data.growParticles( num_particles );
+    }
+
+    /*!
+      \brief Sort each particle's neighbors by increasing distance.
+
+      \param x The slice containing the particle positions the distances
+      are measured on, typically the positions the list was built from.
+
+      Neighbors come out of the build in cell-traversal order, so a cutoff
+      mask in a force loop has its active lanes scattered over the row.
+      Sorting a row packs the in-range neighbors at the front: loops over a
+      strictly shorter interaction radius can stop at the first failed
+      cutoff test - see TeamVectorEarlyExitOpTag - and SIMD cutoff masks
+      stay dense. The pass costs one insertion sort per row after the
+      build; the neighbor sets are unchanged.
+    */
+    template <class PositionSlice>
+    void sortNeighborsByDistance( PositionSlice x )
+    {
+        // Use the default execution space.
+        sortNeighborsByDistance( execution_space{}, x );
+    }
+
+    /*!
+      \brief Sort each particle's neighbors by increasing distance.
+    */
+    template <class PositionSlice, class ExecutionSpace>
+    void sortNeighborsByDistance( ExecutionSpace, PositionSlice x )
+    {
+        static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+
+        Profiling::ScopedRegion region( "Cabana::VerletList::sort_neighbors" );
+
+        auto data = _data;
+        auto position = x;
+        Kokkos::parallel_for(
+            "Cabana::VerletList::sort_neighbors",
+            Kokkos::RangePolicy<ExecutionSpace>( 0, _data.counts.extent( 0 ) ),
+            KOKKOS_LAMBDA( const int p ) {
+                const IndexType nn = data.counts( p );
+                const double x_p = position( p, 0 );
+                const double y_p = position( p, 1 );
+                const double z_p = position( p, 2 );
+
+                // Insertion sort by squared distance. Rows are short and
+                // the sort runs once per build.
+                for ( IndexType n = 1; n < nn; ++n )
+                {
+                    const IndexType nid = data.getNeighbor( p, n );
+                    double dx = x_p - position( nid, 0 );
+                    double dy = y_p - position( nid, 1 );
+                    double dz = z_p - position( nid, 2 );
+                    const double dist_sqr = dx * dx + dy * dy + dz * dz;
+
+                    IndexType m = n;
+                    while ( m > 0 )
+                    {
+                        const IndexType prev = data.getNeighbor( p, m - 1 );
+                        dx = x_p - position( prev, 0 );
+                        dy = y_p - position( prev, 1 );
+                        dz = z_p - position( prev, 2 );
+                        if ( dx * dx + dy * dy + dz * dz <= dist_sqr )
+                            break;
+                        data.setNeighbor( p, m, prev );
+                        --m;
+                    }
+                    data.setNeighbor( p, m, nid );
+                }
+            } );
+        Kokkos::fence();
+    }
+
+    /*!
+      \brief Get the number of bytes of memory allocated by the list.
+
+      \return The number of allocated bytes, including positions retained
+      for skin-based rebuild checks. The user position data the list was
+      built from is not counted.
+    */
+    std::size_t memoryUsage() const
+    {
+        return _data.memoryUsage() +
+               _build_positions.span() * sizeof( double );
+    }
+
+    //! \cond Impl
+    // For CSR lists seed the single-pass estimated fill from the previous
+    // build's statistics with 20% headroom when the caller gave no explicit
+    // bound. The estimated fill skips the count pass and compacts afterward,
+    // falling back to count-then-fill only when a particle overflows its
+    // estimated slots.
+    std::size_t buildEstimate( const std::size_t max_neigh ) const
+    {
+        // A capped build always counts first so the storage can be sized
+        // from the clamped counts.
+        if ( _max_neighbors_cap > 0 )
+            return 0;
+        if ( std::is_same<LayoutTag, VerletLayoutCSR>::value &&
+             0 == max_neigh && 0 < _prev_max_neighbors )
+            return _prev_max_neighbors + ( _prev_max_neighbors + 4 ) / 5;
+        return max_neigh;
+    }
+
+    // Run the count/fill pipeline of a configured builder and extract the
+    // list data and build statistics.
+    template <class ExecutionSpace, class Builder, class PositionSlice>
+    void buildImpl( ExecutionSpace, Builder& builder, PositionSlice x,
+                    const typename PositionSlice::value_type skin )
+    {
+        Profiling::ScopedRegion region( "Cabana::VerletList::build" );
+        Profiling::addCounter( "Cabana::VerletList::rebuild_count", 1 );
 
         // For each particle in the range check each neighboring bin for
         // neighbor particles. Bins are at least the size of the neighborhood
@@ -758,23 +2192,22 @@ class VerletList
         // For CSR lists, we count, then fill neighbors. For 2D lists, we
         // count and fill at the same time, unless the array size is exceeded,
         // at which point only counting is continued to reallocate and refill.
-        typename builder_type::FillNeighborsPolicy fill_policy(
-            builder.bin_data_1d.numBin(), Kokkos::AUTO, 4 );
+        const int num_cell = builder.bin_data_1d.numBin();
         if ( builder.count )
         {
-            typename builder_type::CountNeighborsPolicy count_policy(
-                builder.bin_data_1d.numBin(), Kokkos::AUTO, 4 );
-            Kokkos::parallel_for( "Cabana::VerletList::count_neighbors",
-                                  count_policy, builder );
+            builder.launchCount( num_cell );
         }
         else
         {
             builder.processCounts( LayoutTag() );
-            Kokkos::parallel_for( "Cabana::VerletList::fill_neighbors",
-                                  fill_policy, builder );
+            builder.launchFill( num_cell );
         }
         Kokkos::fence();
 
+        // Clamp the counts to the neighbor cap, if any, so the storage is
+        // sized from the clamped counts.
+        builder.clampCounts();
+
         // Process the counts by computing offsets and allocating the neighbor
         // list, if needed.
         builder.processCounts( LayoutTag() );
@@ -783,30 +2216,392 @@ class VerletList
         // neighbor list.
         if ( builder.count or builder.refill )
         {
-            Kokkos::parallel_for( "Cabana::VerletList::fill_neighbors",
-                                  fill_policy, builder );
+            builder.launchFill( num_cell );
             Kokkos::fence();
         }
 
+        // Record the cap overflow and rebuild the overflowing rows with
+        // the nearest neighbors, if a cap is armed.
+        builder.finalizeCap();
+        _cap_overflow_count = builder.overflow_count;
+        _cap_dropped_count = builder.dropped_count;
+        if ( builder.neighbor_cap > 0 )
+            Profiling::addCounter(
+                "Cabana::VerletList::cap_dropped_neighbors",
+                _cap_dropped_count );
+
         // Get the data from the builder.
         _data = builder._data;
+
+        // Record the largest neighbor count to seed the next build's
+        // single-pass estimate.
+        _prev_max_neighbors = builder.maxNeighborCount();
+        Profiling::maxCounter( "Cabana::VerletList::max_neighbors",
+                               _prev_max_neighbors );
+
+        // Remember the skin and the build-time positions so staleness can
+        // be checked with needsRebuild().
+        _half_skin = 0.5 * skin;
+        if ( skin > 0 )
+        {
+            if ( _build_positions.extent( 0 ) != x.size() )
+                _build_positions = Kokkos::View<double* [3], memory_space>(
+                    Kokkos::ViewAllocateWithoutInitializing(
+                        "verlet_build_positions" ),
+                    x.size() );
+            auto build_positions = _build_positions;
+            Kokkos::parallel_for(
+                "Cabana::VerletList::store_build_positions",
+                Kokkos::RangePolicy<ExecutionSpace>( 0, x.size() ),
+                KOKKOS_LAMBDA( const int p ) {
+                    for ( int d = 0; d < 3; ++d )
+                        build_positions( p, d ) = x( p, d );
+                } );
+            Kokkos::fence();
+        }
+    }
+    //! \endcond
+
+    /*!
+      \brief Check whether the list is stale and must be rebuilt.
+
+      Computes the maximum displacement of the given positions from the
+      positions stored at build time. The list is stale once any particle
+      has moved more than half the skin radius, since a pair separated by
+      more than the neighborhood radius plus the skin at build time may then
+      have come within the neighborhood radius.
+
+      \param x The slice containing the current particle positions.
+
+      \return True if the list must be rebuilt. Lists built without a skin
+      radius are always considered stale.
+    */
+    template <class PositionSlice>
+    bool needsRebuild( PositionSlice x ) const
+    {
+        // Use the default execution space.
+        return needsRebuild( execution_space{}, x );
+    }
+
+    /*!
+      \brief Check whether the list is stale and must be rebuilt.
+
+      \param x The slice containing the current particle positions.
+
+      \return True if the list must be rebuilt.
+    */
+    template <class ExecutionSpace, class PositionSlice>
+    bool needsRebuild( ExecutionSpace, PositionSlice x ) const
+    {
+        static_assert( is_accessible_from<memory_space, ExecutionSpace>{}, "" );
+
+        // Without a skin there is no displacement budget - every change of
+        // the positions may invalidate the list.
+        if ( !( _half_skin > 0.0 ) ||
+             _build_positions.extent( 0 ) != x.size() )
+            return true;
+
+        // Compute the maximum displacement since the build.
+        auto build_positions = _build_positions;
+        double max_dist_sqr = 0.0;
+        Kokkos::Max<double> max_reduce( max_dist_sqr );
+        Kokkos::parallel_reduce(
+            "Cabana::VerletList::max_displacement",
+            Kokkos::RangePolicy<ExecutionSpace>( 0, x.size() ),
+            KOKKOS_LAMBDA( const int p, double& value ) {
+                double dist_sqr = 0.0;
+                for ( int d = 0; d < 3; ++d )
+                {
+                    double dx = x( p, d ) - build_positions( p, d );
+                    dist_sqr += dx * dx;
+                }
+                if ( dist_sqr > value )
+                    value = dist_sqr;
+            },
+            max_reduce );
+        Kokkos::fence();
+
+        return max_dist_sqr > _half_skin * _half_skin;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+  \brief Time-sliced rebuild of a VerletList spread across several steps.
+
+  \tparam VerletListType The Verlet list type being rebuilt.
+
+  \tparam Scalar The position value type. Defaults to double.
+
+  A full build() stalls the step it lands on, which breaks a fixed step
+  cadence every rebuild interval. This class runs the same count-scan-fill
+  pipeline in cell-range slices: construct it when the rebuild is due, call
+  step() once per timestep, and the new list is assembled over num_slices
+  calls while the old list keeps serving forces. The final step() swaps the
+  finished data into the list, so the list a kernel sees is always either
+  the complete old build or the complete new one.
+
+  The build reads positions frozen at construction time, so the skin must
+  cover the particle motion of the rebuild interval plus the num_slices
+  steps the rebuild is in flight; size the skin accordingly and trigger the
+  rebuild with needsRebuild() just as with a synchronous build.
+*/
+template <class VerletListType, class Scalar = double>
+class SlicedVerletRebuild
+{
+  public:
+    //! Kokkos memory space of the list.
+    using memory_space = typename VerletListType::memory_space;
+
+    //! Kokkos execution space of the list.
+    using execution_space = typename VerletListType::execution_space;
+
+    //! Frozen position type the list is built from.
+    using position_snapshot = Impl::PositionSnapshot<Scalar, memory_space>;
+
+    //! Builder running the sliced pipeline.
+    using builder_type = Impl::VerletListBuilder<
+        Kokkos::Device<execution_space, memory_space>, position_snapshot,
+        typename VerletListType::algorithm_tag,
+        typename VerletListType::layout_tag,
+        typename VerletListType::build_tag,
+        typename VerletListType::index_type>;
+
+    /*!
+      \brief Start a sliced rebuild of a list.
+
+      \param list The list to rebuild. Keeps serving its current build
+      until the final step() swaps in the new one.
+
+      \param x The slice containing the particle positions. Copied at
+      construction; later particle motion does not affect the build.
+
+      \param begin The beginning particle index to compute neighbors for.
+
+      \param end The end particle index to compute neighbors for.
+
+      \param neighborhood_radius The radius of the neighborhood.
+
+      \param cell_size_ratio The ratio of the cell size in the Cartesian
+      grid to the neighborhood radius.
+
+      \param grid_min The minimum value of the grid containing the
+      particles in each dimension.
+
+      \param grid_max The maximum value of the grid containing the
+      particles in each dimension.
+
+      \param num_slices The number of step() calls the rebuild is spread
+      across. Must be positive.
+
+      \param skin Skin radius added to the neighborhood radius. Must cover
+      the motion over the rebuild interval plus the rebuild flight time.
+    */
+    template <class PositionSlice>
+    SlicedVerletRebuild( VerletListType& list, PositionSlice x,
+                         const std::size_t begin, const std::size_t end,
+                         const Scalar neighborhood_radius,
+                         const Scalar cell_size_ratio,
+                         const Scalar grid_min[3], const Scalar grid_max[3],
+                         const int num_slices, const Scalar skin = 0 )
+        : _list( &list )
+        , _skin( skin )
+        , _next_cell( 0 )
+        , _counting( true )
+        , _done( false )
+    {
+        if ( num_slices < 1 )
+            throw std::invalid_argument(
+                "Sliced rebuild requires at least one slice" );
+
+        // Freeze the positions. The build reads them over several steps
+        // while the particles keep moving.
+        _snapshot.data = Kokkos::View<Scalar* [3], memory_space>(
+            Kokkos::ViewAllocateWithoutInitializing(
+                "verlet_rebuild_positions" ),
+            x.size() );
+        auto snapshot = _snapshot.data;
+        Kokkos::parallel_for(
+            "Cabana::VerletList::snapshot_positions",
+            Kokkos::RangePolicy<execution_space>( 0, x.size() ),
+            KOKKOS_LAMBDA( const int p ) {
+                for ( int d = 0; d < 3; ++d )
+                    snapshot( p, d ) = x( p, d );
+            } );
+        Kokkos::fence();
+
+        // Bin the frozen positions. The sliced pipeline always counts
+        // first so the count and fill passes each cover the cells exactly
+        // once.
+        _builder = std::make_shared<builder_type>(
+            _snapshot, begin, end, neighborhood_radius + skin,
+            cell_size_ratio, grid_min, grid_max, 0 );
+        for ( int d = 0; d < 3; ++d )
+            _builder->periodic[d] = list._periodic[d];
+        if ( list._max_neighbors_cap > 0 )
+            _builder->applyNeighborCap( list._max_neighbors_cap );
+
+        // Split the slices between the count and fill passes; both walk
+        // the same cells. The offset scan rides along with the first fill
+        // slice and the swap with the last.
+        int num_cell = _builder->bin_data_1d.numBin();
+        int count_slices = ( num_slices + 1 ) / 2;
+        int fill_slices = num_slices - count_slices;
+        if ( 0 == fill_slices )
+            fill_slices = 1;
+        _count_chunk = ( num_cell + count_slices - 1 ) / count_slices;
+        _fill_chunk = ( num_cell + fill_slices - 1 ) / fill_slices;
+    }
+
+    /*!
+      \brief Advance the rebuild by one slice.
+
+      \return Whether the rebuild is complete and the list was swapped.
+
+      Runs one cell-range slice of the count or fill pass. The call that
+      finishes the fill installs the new list data before returning, after
+      which further calls are no-ops.
+    */
+    bool step()
+    {
+        if ( _done )
+            return true;
+
+        Profiling::ScopedRegion region( "Cabana::VerletList::sliced_rebuild" );
+
+        using layout_tag = typename VerletListType::layout_tag;
+        int num_cell = _builder->bin_data_1d.numBin();
+        if ( _counting )
+        {
+            int chunk = ( _next_cell + _count_chunk < num_cell )
+                            ? _count_chunk
+                            : num_cell - _next_cell;
+            _builder->cell_offset = _next_cell;
+            _builder->launchCount( chunk );
+            Kokkos::fence();
+
+            _next_cell += chunk;
+            if ( _next_cell >= num_cell )
+            {
+                // All counts are in - clamp them to the neighbor cap, if
+                // any, then compute offsets and allocate the neighbor
+                // storage.
+                _builder->clampCounts();
+                _builder->processCounts( layout_tag() );
+                _counting = false;
+                _next_cell = 0;
+            }
+        }
+        else
+        {
+            int chunk = ( _next_cell + _fill_chunk < num_cell )
+                            ? _fill_chunk
+                            : num_cell - _next_cell;
+            _builder->cell_offset = _next_cell;
+            _builder->launchFill( chunk );
+            Kokkos::fence();
+
+            _next_cell += chunk;
+            if ( _next_cell >= num_cell )
+                finish();
+        }
+        return _done;
     }
+
+    //! Whether the rebuild is complete and the list was swapped.
+    bool done() const { return _done; }
+
+    //! \cond Impl
+    // Install the finished build in the list, mirroring what a synchronous
+    // buildImpl() records.
+    void finish()
+    {
+        Profiling::addCounter( "Cabana::VerletList::rebuild_count", 1 );
+
+        // Record the cap overflow and rebuild the overflowing rows with
+        // the nearest neighbors, if a cap is armed.
+        _builder->finalizeCap();
+        _list->_cap_overflow_count = _builder->overflow_count;
+        _list->_cap_dropped_count = _builder->dropped_count;
+        if ( _builder->neighbor_cap > 0 )
+            Profiling::addCounter(
+                "Cabana::VerletList::cap_dropped_neighbors",
+                _list->_cap_dropped_count );
+
+        _list->_data = _builder->_data;
+        _list->_prev_max_neighbors = _builder->maxNeighborCount();
+        Profiling::maxCounter( "Cabana::VerletList::max_neighbors",
+                               _list->_prev_max_neighbors );
+
+        // The frozen positions are the build-time positions needsRebuild()
+        // measures displacement from.
+        _list->_half_skin = 0.5 * _skin;
+        if ( _skin > 0 )
+        {
+            std::size_t num_particle = _snapshot.data.extent( 0 );
+            if ( _list->_build_positions.extent( 0 ) != num_particle )
+                _list->_build_positions =
+                    Kokkos::View<double* [3], memory_space>(
+                        Kokkos::ViewAllocateWithoutInitializing(
+                            "verlet_build_positions" ),
+                        num_particle );
+            auto build_positions = _list->_build_positions;
+            auto snapshot = _snapshot.data;
+            Kokkos::parallel_for(
+                "Cabana::VerletList::store_build_positions",
+                Kokkos::RangePolicy<execution_space>( 0, num_particle ),
+                KOKKOS_LAMBDA( const int p ) {
+                    for ( int d = 0; d < 3; ++d )
+                        build_positions( p, d ) = snapshot( p, d );
+                } );
+            Kokkos::fence();
+        }
+
+        _builder.reset();
+        _done = true;
+    }
+    //! \endcond
+
+  private:
+    // The list being rebuilt.
+    VerletListType* _list;
+
+    // Positions frozen at rebuild start.
+    position_snapshot _snapshot;
+
+    // Builder holding the in-flight build.
+    std::shared_ptr<builder_type> _builder;
+
+    // Skin radius of the build.
+    Scalar _skin;
+
+    // Cells per count and fill slice.
+    int _count_chunk;
+    int _fill_chunk;
+
+    // Next cell of the current pass.
+    int _next_cell;
+
+    // Pipeline state.
+    bool _counting;
+    bool _done;
 };
 
 //---------------------------------------------------------------------------//
 // Neighbor list interface implementation.
 //---------------------------------------------------------------------------//
 //! CSR VerletList NeighborList interface.
-template <class MemorySpace, class AlgorithmTag, class BuildTag>
+template <class MemorySpace, class AlgorithmTag, class BuildTag,
+          class IndexType>
 class NeighborList<
-    VerletList<MemorySpace, AlgorithmTag, VerletLayoutCSR, BuildTag>>
+    VerletList<MemorySpace, AlgorithmTag, VerletLayoutCSR, BuildTag, IndexType>>
 {
   public:
     //! Kokkos memory space.
     using memory_space = MemorySpace;
     //! Neighbor list type.
-    using list_type =
-        VerletList<MemorySpace, AlgorithmTag, VerletLayoutCSR, BuildTag>;
+    using list_type = VerletList<MemorySpace, AlgorithmTag, VerletLayoutCSR,
+                                 BuildTag, IndexType>;
 
     //! Get the total number of neighbors (maximum size of CSR list).
     KOKKOS_INLINE_FUNCTION
@@ -837,16 +2632,17 @@ class NeighborList<
 
 //---------------------------------------------------------------------------//
 //! 2D VerletList NeighborList interface.
-template <class MemorySpace, class AlgorithmTag, class BuildTag>
+template <class MemorySpace, class AlgorithmTag, class BuildTag,
+          class IndexType>
 class NeighborList<
-    VerletList<MemorySpace, AlgorithmTag, VerletLayout2D, BuildTag>>
+    VerletList<MemorySpace, AlgorithmTag, VerletLayout2D, BuildTag, IndexType>>
 {
   public:
     //! Kokkos memory space.
     using memory_space = MemorySpace;
     //! Neighbor list type.
-    using list_type =
-        VerletList<MemorySpace, AlgorithmTag, VerletLayout2D, BuildTag>;
+    using list_type = VerletList<MemorySpace, AlgorithmTag, VerletLayout2D,
+                                 BuildTag, IndexType>;
 
     //! Get the maximum number of neighbors per particle.
     KOKKOS_INLINE_FUNCTION
@@ -874,6 +2670,48 @@ class NeighborList<
     }
 };
 
+//---------------------------------------------------------------------------//
+//! Compressed 2D VerletList NeighborList interface.
+template <class MemorySpace, class AlgorithmTag, class BuildTag,
+          class IndexType>
+class NeighborList<
+    VerletList<MemorySpace, AlgorithmTag, VerletLayoutCompressed2D, BuildTag, IndexType>>
+{
+  public:
+    //! Kokkos memory space.
+    using memory_space = MemorySpace;
+    //! Neighbor list type.
+    using list_type = VerletList<MemorySpace, AlgorithmTag,
+                                 VerletLayoutCompressed2D, BuildTag, IndexType>;
+
+    //! Get the total size of the packed neighbor storage.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t maxNeighbor( const list_type& list )
+    {
+        return list._data.neighbors.extent( 0 );
+    }
+
+    //! Get the number of neighbors for a given particle index.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t numNeighbor( const list_type& list,
+                                    const std::size_t particle_index )
+    {
+        return list._data.counts( particle_index );
+    }
+
+    //! Get the id for a neighbor for a given particle index and the index of
+    //! the neighbor relative to the particle.
+    KOKKOS_INLINE_FUNCTION
+    static std::size_t getNeighbor( const list_type& list,
+                                    const std::size_t particle_index,
+                                    const std::size_t neighbor_index )
+    {
+        return list._data.neighbors(
+            list._data.row_start( particle_index ) +
+            neighbor_index * list._data.row_stride( particle_index ) );
+    }
+};
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Cabana
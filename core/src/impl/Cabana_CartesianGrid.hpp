@@ -135,6 +135,24 @@ class CartesianGrid
         return rx * rx + ry * ry + rz * rz;
     }
 
+    // Given the ijk indices of two cells get the square of the minimum
+    // distance between any point in one cell and any point in the other.
+    // Identical and face/edge/corner adjacent cells have zero distance.
+    KOKKOS_INLINE_FUNCTION
+    Real minDistanceToCell( const int i0, const int j0, const int k0,
+                            const int i1, const int j1, const int k1 ) const
+    {
+        int di = ( i0 > i1 ) ? i0 - i1 : i1 - i0;
+        int dj = ( j0 > j1 ) ? j0 - j1 : j1 - j0;
+        int dk = ( k0 > k1 ) ? k0 - k1 : k1 - k0;
+
+        Real rx = ( di > 1 ) ? ( di - 1 ) * _dx : 0.0;
+        Real ry = ( dj > 1 ) ? ( dj - 1 ) * _dy : 0.0;
+        Real rz = ( dk > 1 ) ? ( dk - 1 ) * _dz : 0.0;
+
+        return rx * rx + ry * ry + rz * rz;
+    }
+
     // Given the ijk index of a cell get its cardinal index.
     KOKKOS_INLINE_FUNCTION
     int cardinalCellIndex( const int i, const int j, const int k ) const
@@ -455,6 +455,65 @@ void checkFirstNeighborParallelForLambda( const ListType& nlist,
                                    1 );
 }
 
+//---------------------------------------------------------------------------//
+template <class ListType, class TestListType>
+void checkFirstNeighborEarlyExitLambda( const ListType& nlist,
+                                        const TestListType& N2_list_copy,
+                                        const int num_particle )
+{
+    // Create Kokkos views for the write operation.
+    using memory_space = typename TEST_MEMSPACE::memory_space;
+    Kokkos::View<int*, memory_space> active_result( "active_result",
+                                                    num_particle );
+    Kokkos::View<int*, memory_space> visit_count( "visit_count",
+                                                  num_particle );
+
+    // An always-active functor visits every neighbor, so the early exit
+    // never cuts a row short and the result matches the N^2 list.
+    auto active_op = KOKKOS_LAMBDA( const int i, const int n )
+    {
+        Kokkos::atomic_add( &active_result( i ), n );
+        return true;
+    };
+
+    // An always-inactive functor deactivates every lane in the first chunk,
+    // so at most a vector length of neighbors is visited per particle.
+    auto inactive_op = KOKKOS_LAMBDA( const int i, const int )
+    {
+        Kokkos::atomic_add( &visit_count( i ), 1 );
+        return false;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, num_particle );
+    Cabana::neighbor_parallel_for(
+        policy, active_op, nlist, Cabana::FirstNeighborsTag(),
+        Cabana::TeamVectorEarlyExitOpTag(), "test_1st_early_exit" );
+    Cabana::neighbor_parallel_for(
+        policy, inactive_op, nlist, Cabana::FirstNeighborsTag(),
+        Cabana::TeamVectorEarlyExitOpTag(), "test_1st_early_exit_inactive" );
+    Kokkos::fence();
+
+    // Check against the N^2 list and the first-chunk visit bound.
+    const int vector_length =
+        Cabana::Impl::PerformanceTraits<TEST_EXECSPACE>::vector_length;
+    Kokkos::View<int*, Kokkos::HostSpace> N2_result( "N2_result",
+                                                     num_particle );
+    for ( int p = 0; p < num_particle; ++p )
+        for ( int n = 0; n < N2_list_copy.counts( p ); ++n )
+            N2_result( p ) += N2_list_copy.neighbors( p, n );
+    auto active_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), active_result );
+    auto visit_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), visit_count );
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        EXPECT_EQ( N2_result( p ), active_mirror( p ) );
+        int num_neigh = N2_list_copy.counts( p );
+        int expected_visits =
+            ( num_neigh < vector_length ) ? num_neigh : vector_length;
+        EXPECT_EQ( visit_mirror( p ), expected_visits );
+    }
+}
+
 //---------------------------------------------------------------------------//
 template <class ListType, class TestListType>
 void checkSecondNeighborParallelForLambda( const ListType& nlist,
@@ -12,6 +12,7 @@
 #include <Cabana_AoSoA.hpp>
 #include <Cabana_DeepCopy.hpp>
 #include <Cabana_Types.hpp>
+#include <Cabana_VectorLengthDispatch.hpp>
 #include <impl/Cabana_Index.hpp>
 
 #include <Kokkos_Core.hpp>
@@ -232,6 +233,20 @@ void testAoSoA()
     EXPECT_EQ( aosoa.arraySize( 0 ), int( 16 ) );
     EXPECT_EQ( aosoa.arraySize( 1 ), int( 16 ) );
     EXPECT_EQ( aosoa.arraySize( 2 ), int( 15 ) );
+
+    // Resizing one past the current capacity should grow the allocation by
+    // the growth factor rather than to the exact requested size.
+    EXPECT_EQ( aosoa.growthFactor(), 1.5 );
+    aosoa.resize( 49 );
+    EXPECT_EQ( aosoa.size(), int( 49 ) );
+    EXPECT_EQ( aosoa.capacity(), int( 80 ) );
+
+    // With a growth factor of 1.0 reallocation should be exact again.
+    aosoa.setGrowthFactor( 1.0 );
+    EXPECT_EQ( aosoa.growthFactor(), 1.0 );
+    aosoa.resize( 81 );
+    EXPECT_EQ( aosoa.size(), int( 81 ) );
+    EXPECT_EQ( aosoa.capacity(), int( 96 ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -592,6 +607,191 @@ void testUnmanaged()
     checkDataMembers( aosoa, fval, dval, ival, dim_1, dim_2, dim_3 );
 }
 
+//---------------------------------------------------------------------------//
+// Test runtime vector length dispatch.
+void testVectorLengthDispatch()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+    int num_data = 67;
+
+    // Create an AoSoA for each candidate vector length selected at runtime.
+    for ( int vlen : { 8, 16, 32 } )
+    {
+        int selected = 0;
+        std::size_t num_soa = 0;
+        Cabana::dispatchVectorLength<8, 16, 32>(
+            vlen, [&]( auto vl ) {
+                using AoSoA_t =
+                    Cabana::AoSoA<DataTypes, TEST_MEMSPACE,
+                                  decltype( vl )::value>;
+                AoSoA_t aosoa( "aosoa", num_data );
+                selected = AoSoA_t::vector_length;
+                num_soa = aosoa.numSoA();
+            } );
+        EXPECT_EQ( selected, vlen );
+        EXPECT_EQ( num_soa, ( num_data + vlen - 1 ) / vlen );
+    }
+
+    // A vector length outside the candidate set is rejected.
+    EXPECT_THROW( ( Cabana::dispatchVectorLength<8, 16, 32>(
+                      7, []( auto ) {} ) ),
+                  std::invalid_argument );
+}
+
+//---------------------------------------------------------------------------//
+// Test the device-resident size counter.
+void testDeviceSize()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+
+    // Create an AoSoA.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    int num_data = 100;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // The counter reflects the current size.
+    auto device_size = aosoa.deviceSize();
+    auto host_size = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                          device_size );
+    EXPECT_EQ( host_size(), aosoa.size() );
+
+    // Update the counter on device (e.g. the surviving count of a
+    // compaction) and commit it as the container size.
+    Kokkos::parallel_for(
+        "shrink", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, 1 ),
+        KOKKOS_LAMBDA( const int ) { device_size() = 57; } );
+    Kokkos::fence();
+    aosoa.syncSizeFromDevice();
+    EXPECT_EQ( aosoa.size(), 57 );
+
+    // Without a device-side update the sync is a no-op on the size.
+    aosoa.deviceSize();
+    aosoa.syncSizeFromDevice();
+    EXPECT_EQ( aosoa.size(), 57 );
+}
+
+//---------------------------------------------------------------------------//
+// Test first-touch initialization of allocations.
+void testFirstTouch()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+
+    // Create an AoSoA with first-touch initialization. Page placement is
+    // not observable here - check the observable effect that allocations
+    // are zero-initialized.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    int num_data = 100;
+    AoSoA_t aosoa( Cabana::FirstTouch(), "aosoa", num_data );
+    EXPECT_TRUE( aosoa.firstTouch() );
+    EXPECT_EQ( aosoa.size(), num_data );
+
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto mirror_slice_0 = Cabana::slice<0>( mirror );
+    auto mirror_slice_1 = Cabana::slice<1>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_EQ( mirror_slice_0( i, d ), 0.0 );
+        EXPECT_EQ( mirror_slice_1( i ), 0 );
+    }
+
+    // A reallocation is touched the same way and keeps the existing data.
+    auto slice_1 = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) { slice_1( i ) = i; } );
+    Kokkos::fence();
+    int resized_data = 300;
+    aosoa.resize( resized_data );
+
+    mirror = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    mirror_slice_1 = Cabana::slice<1>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_EQ( mirror_slice_1( i ), i );
+
+    // The policy is a runtime toggle.
+    aosoa.setFirstTouch( false );
+    EXPECT_FALSE( aosoa.firstTouch() );
+    AoSoA_t plain_aosoa( "plain_aosoa", num_data );
+    EXPECT_FALSE( plain_aosoa.firstTouch() );
+}
+
+//---------------------------------------------------------------------------//
+// Test a subview of an AoSoA.
+void testSubview()
+{
+    // Manually set the inner array size.
+    const int vector_length = 16;
+
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+
+    // Create an AoSoA.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+    int num_data = 100;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Fill the AoSoA with the tuple index.
+    auto slice_0 = Cabana::slice<0>( aosoa );
+    auto slice_1 = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                slice_0( i, d ) = 1.0 * i + d;
+            slice_1( i ) = i;
+        } );
+    Kokkos::fence();
+
+    // Create a subview over the second and third struct. The range does not
+    // have to end on a struct boundary.
+    std::size_t begin = vector_length;
+    std::size_t end = 41;
+    auto sub = Cabana::subview( aosoa, begin, end );
+    EXPECT_EQ( sub.size(), end - begin );
+    EXPECT_EQ( sub.numSoA(), 2 );
+
+    // The subview aliases the original data with indexing local to the
+    // range.
+    auto sub_mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), sub );
+    auto sub_slice_0 = Cabana::slice<0>( sub_mirror );
+    auto sub_slice_1 = Cabana::slice<1>( sub_mirror );
+    for ( std::size_t i = 0; i < sub.size(); ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_EQ( sub_slice_0( i, d ), 1.0 * ( i + begin ) + d );
+        EXPECT_EQ( sub_slice_1( i ), int( i + begin ) );
+    }
+
+    // Writing through the subview writes the original AoSoA.
+    auto write_slice = Cabana::slice<1>( sub );
+    Kokkos::parallel_for(
+        "write_sub", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, sub.size() ),
+        KOKKOS_LAMBDA( const int i ) { write_slice( i ) = -1; } );
+    Kokkos::fence();
+
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto mirror_slice_1 = Cabana::slice<1>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        if ( i >= int( begin ) && i < int( end ) )
+            EXPECT_EQ( mirror_slice_1( i ), -1 );
+        else
+            EXPECT_EQ( mirror_slice_1( i ), i );
+    }
+
+    // Unaligned or out-of-bounds ranges are rejected.
+    EXPECT_THROW( Cabana::subview( aosoa, 1, end ), std::invalid_argument );
+    EXPECT_THROW( Cabana::subview( aosoa, 0, num_data + 1 ),
+                  std::invalid_argument );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -609,6 +809,21 @@ TEST( TEST_CATEGORY, aosoa_access_test ) { testAccess(); }
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, aosoa_unmanaged_test ) { testUnmanaged(); }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, aosoa_subview_test ) { testSubview(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, aosoa_device_size_test ) { testDeviceSize(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, aosoa_first_touch_test ) { testFirstTouch(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, aosoa_vector_length_dispatch_test )
+{
+    testVectorLengthDispatch();
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -0,0 +1,191 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_Checkpoint.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_VerletList.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+namespace Test
+{
+
+//---------------------------------------------------------------------------//
+void checkpointRestoreTest()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+    int my_size = -1;
+    MPI_Comm_size( MPI_COMM_WORLD, &my_size );
+
+    // Make some particles. Give each rank a different count so the file
+    // offsets are not uniform.
+    using DataTypes = Cabana::MemberTypes<int, double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    int num_data = 97 + 13 * my_rank;
+    AoSoA_t data_src( "src", num_data );
+
+    // Fill with rank-dependent values on the host and copy to the test
+    // memory space.
+    auto host_src = Cabana::create_mirror_view( Kokkos::HostSpace(),
+                                                data_src );
+    auto slice_int_src = Cabana::slice<0>( host_src );
+    auto slice_dbl_src = Cabana::slice<1>( host_src );
+    for ( int p = 0; p < num_data; ++p )
+    {
+        slice_int_src( p ) = my_rank + p;
+        slice_dbl_src( p, 0 ) = my_rank + p + 0.5;
+        slice_dbl_src( p, 1 ) = my_rank - p - 0.5;
+    }
+    Cabana::deep_copy( data_src, host_src );
+
+    // Checkpoint.
+    std::string file_name = "checkpoint_test.cbn";
+    Cabana::Experimental::checkpoint( MPI_COMM_WORLD, file_name, data_src );
+
+    // Restore into a new container. Start it at the wrong size to check the
+    // resize.
+    AoSoA_t data_dst( "dst", 3 );
+    Cabana::Experimental::restore( MPI_COMM_WORLD, file_name, data_dst );
+
+    // Check the restored data.
+    EXPECT_EQ( data_dst.size(), data_src.size() );
+    auto host_dst =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), data_dst );
+    auto slice_int_dst = Cabana::slice<0>( host_dst );
+    auto slice_dbl_dst = Cabana::slice<1>( host_dst );
+    for ( int p = 0; p < num_data; ++p )
+    {
+        EXPECT_EQ( slice_int_dst( p ), my_rank + p );
+        EXPECT_DOUBLE_EQ( slice_dbl_dst( p, 0 ), my_rank + p + 0.5 );
+        EXPECT_DOUBLE_EQ( slice_dbl_dst( p, 1 ), my_rank - p - 0.5 );
+    }
+
+    // A mismatched layout must be rejected.
+    using BadTypes = Cabana::MemberTypes<int, double[3]>;
+    Cabana::AoSoA<BadTypes, TEST_MEMSPACE> data_bad( "bad", 3 );
+    EXPECT_THROW( Cabana::Experimental::restore( MPI_COMM_WORLD, file_name,
+                                                 data_bad ),
+                  std::runtime_error );
+
+    // Remove the file.
+    MPI_Barrier( MPI_COMM_WORLD );
+    if ( 0 == my_rank )
+        std::remove( file_name.c_str() );
+}
+
+//---------------------------------------------------------------------------//
+void neighborCheckpointRestoreTest()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Make CSR neighbor data with rank-dependent extents and values on the
+    // host and copy to the test memory space.
+    using data_type =
+        Cabana::VerletListData<TEST_MEMSPACE, Cabana::VerletLayoutCSR, int>;
+    int num_particle = 11 + 3 * my_rank;
+    int num_neighbor = 4 * num_particle;
+    Kokkos::View<int*, Kokkos::HostSpace> host_counts( "num_neighbors",
+                                                       num_particle );
+    Kokkos::View<int*, Kokkos::HostSpace> host_offsets( "neighbor_offsets",
+                                                        num_particle );
+    Kokkos::View<int*, Kokkos::HostSpace> host_neighbors( "neighbors",
+                                                          num_neighbor );
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        host_counts( p ) = 4;
+        host_offsets( p ) = 4 * p;
+    }
+    for ( int n = 0; n < num_neighbor; ++n )
+        host_neighbors( n ) = my_rank + n;
+    data_type data_src;
+    data_src.counts = Kokkos::View<int*, TEST_MEMSPACE>( "num_neighbors",
+                                                         num_particle );
+    data_src.offsets = Kokkos::View<int*, TEST_MEMSPACE>( "neighbor_offsets",
+                                                          num_particle );
+    data_src.neighbors = Kokkos::View<int*, TEST_MEMSPACE>( "neighbors",
+                                                            num_neighbor );
+    Kokkos::deep_copy( data_src.counts, host_counts );
+    Kokkos::deep_copy( data_src.offsets, host_offsets );
+    Kokkos::deep_copy( data_src.neighbors, host_neighbors );
+
+    // Checkpoint with the build radius.
+    double radius = 1.5;
+    std::string file_name = "neighbor_checkpoint_test.cbn";
+    Cabana::Experimental::checkpointNeighbors( MPI_COMM_WORLD, file_name,
+                                               data_src, radius );
+
+    // Restore into fresh data requiring a covered radius.
+    data_type data_dst;
+    Cabana::Experimental::restoreNeighbors( MPI_COMM_WORLD, file_name,
+                                            data_dst, 1.0 );
+
+    // Check the restored data.
+    EXPECT_EQ( data_dst.counts.extent( 0 ), num_particle );
+    EXPECT_EQ( data_dst.offsets.extent( 0 ), num_particle );
+    EXPECT_EQ( data_dst.neighbors.extent( 0 ), num_neighbor );
+    auto dst_counts = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), data_dst.counts );
+    auto dst_offsets = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), data_dst.offsets );
+    auto dst_neighbors = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), data_dst.neighbors );
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        EXPECT_EQ( dst_counts( p ), 4 );
+        EXPECT_EQ( dst_offsets( p ), 4 * p );
+    }
+    for ( int n = 0; n < num_neighbor; ++n )
+        EXPECT_EQ( dst_neighbors( n ), my_rank + n );
+
+    // A radius the stored list does not cover must be rejected.
+    EXPECT_THROW( Cabana::Experimental::restoreNeighbors(
+                      MPI_COMM_WORLD, file_name, data_dst, 2.0 ),
+                  std::runtime_error );
+
+    // A mismatched layout must be rejected.
+    Cabana::VerletListData<TEST_MEMSPACE, Cabana::VerletLayout2D, int>
+        data_bad;
+    EXPECT_THROW( Cabana::Experimental::restoreNeighbors(
+                      MPI_COMM_WORLD, file_name, data_bad, 1.0 ),
+                  std::runtime_error );
+
+    // Remove the file.
+    MPI_Barrier( MPI_COMM_WORLD );
+    if ( 0 == my_rank )
+        std::remove( file_name.c_str() );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, checkpoint_restore_test ) { checkpointRestoreTest(); }
+
+TEST( TEST_CATEGORY, neighbor_checkpoint_restore_test )
+{
+    neighborCheckpointRestoreTest();
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
@@ -599,6 +599,161 @@ void testTopology()
             }
 }
 
+//---------------------------------------------------------------------------//
+void testSteeringHistogram()
+{
+    using device_type = Kokkos::Device<TEST_EXECSPACE, TEST_MEMSPACE>;
+
+    // Build synthetic export ranks spread over many more neighbors than fit
+    // in a single shared-memory histogram window so the steering
+    // construction has to run multiple passes. Lower the crossover to force
+    // the multi-pass path even on machines with a large histogram window.
+    int saved_crossover = Cabana::steeringHistogramCrossover();
+    Cabana::steeringHistogramCrossover() = 16;
+
+    int comm_size = 100;
+    int num_data = 1000;
+    Kokkos::View<int*, device_type> export_ranks( "export_ranks", num_data );
+    auto host_export_ranks = Kokkos::create_mirror_view( export_ranks );
+    for ( int i = 0; i < num_data; ++i )
+        host_export_ranks( i ) = ( i % 7 == 0 ) ? -1 : i % comm_size;
+    Kokkos::deep_copy( export_ranks, host_export_ranks );
+
+    // Run the atomic steering construction directly.
+    auto counts_and_ids = Cabana::Impl::countSendsAndCreateSteering(
+        export_ranks, comm_size,
+        Cabana::Impl::CountSendsAndCreateSteeringAtomic() );
+
+    auto host_counts = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), counts_and_ids.first );
+    auto host_ids = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), counts_and_ids.second );
+
+    // Check the counts against a serial histogram.
+    std::vector<int> expected_counts( comm_size, 0 );
+    for ( int i = 0; i < num_data; ++i )
+        if ( host_export_ranks( i ) >= 0 )
+            ++expected_counts[host_export_ranks( i )];
+    for ( int r = 0; r < comm_size; ++r )
+        EXPECT_EQ( host_counts( r ), expected_counts[r] );
+
+    // Check that the ids assigned to each rank's elements are a unique set
+    // of offsets in [0,count).
+    std::vector<std::vector<int>> rank_ids( comm_size );
+    for ( int i = 0; i < num_data; ++i )
+        if ( host_export_ranks( i ) >= 0 )
+            rank_ids[host_export_ranks( i )].push_back( host_ids( i ) );
+    for ( int r = 0; r < comm_size; ++r )
+    {
+        std::sort( rank_ids[r].begin(), rank_ids[r].end() );
+        for ( int n = 0; n < expected_counts[r]; ++n )
+            EXPECT_EQ( n, rank_ids[r][n] );
+    }
+
+    // Restore the crossover.
+    Cabana::steeringHistogramCrossover() = saved_crossover;
+}
+
+//---------------------------------------------------------------------------//
+void testSteeringAlgorithmSelection()
+{
+    using device_type = Kokkos::Device<TEST_EXECSPACE, TEST_MEMSPACE>;
+
+    // Build synthetic export ranks with some invalid entries.
+    int comm_size = 13;
+    int num_data = 500;
+    Kokkos::View<int*, device_type> export_ranks( "export_ranks", num_data );
+    auto host_export_ranks = Kokkos::create_mirror_view( export_ranks );
+    for ( int i = 0; i < num_data; ++i )
+        host_export_ranks( i ) = ( i % 11 == 0 ) ? -1 : i % comm_size;
+    Kokkos::deep_copy( export_ranks, host_export_ranks );
+
+    // The serial histogram to check against.
+    std::vector<int> expected_counts( comm_size, 0 );
+    for ( int i = 0; i < num_data; ++i )
+        if ( host_export_ranks( i ) >= 0 )
+            ++expected_counts[host_export_ranks( i )];
+
+    // Run the runtime-dispatched steering construction with each forced
+    // selection and the automatic selection. Every choice must produce the
+    // same counts and a unique set of offsets in [0,count) per rank.
+    auto saved_algorithm = Cabana::steeringAlgorithm();
+    for ( auto algorithm : { Cabana::SteeringAlgorithm::automatic,
+                             Cabana::SteeringAlgorithm::atomic,
+                             Cabana::SteeringAlgorithm::duplicated } )
+    {
+        Cabana::steeringAlgorithm() = algorithm;
+        auto counts_and_ids = Cabana::Impl::countSendsAndCreateSteering(
+            export_ranks, comm_size );
+
+        auto host_counts = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), counts_and_ids.first );
+        auto host_ids = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), counts_and_ids.second );
+
+        for ( int r = 0; r < comm_size; ++r )
+            EXPECT_EQ( host_counts( r ), expected_counts[r] );
+
+        std::vector<std::vector<int>> rank_ids( comm_size );
+        for ( int i = 0; i < num_data; ++i )
+            if ( host_export_ranks( i ) >= 0 )
+                rank_ids[host_export_ranks( i )].push_back( host_ids( i ) );
+        for ( int r = 0; r < comm_size; ++r )
+        {
+            std::sort( rank_ids[r].begin(), rank_ids[r].end() );
+            for ( int n = 0; n < expected_counts[r]; ++n )
+                EXPECT_EQ( n, rank_ids[r][n] );
+        }
+    }
+    Cabana::steeringAlgorithm() = saved_algorithm;
+}
+
+//---------------------------------------------------------------------------//
+void testPinnedBufferPool()
+{
+    Cabana::PinnedBufferPool pool;
+
+    // Checkout allocates when the pool is empty.
+    auto buffer_1 = pool.checkout( 1024 );
+    EXPECT_LE( 1024, buffer_1.extent( 0 ) );
+    EXPECT_EQ( 0, pool.numFree() );
+
+    // A released buffer is recycled for requests it can hold.
+    auto data_1 = buffer_1.data();
+    pool.release( buffer_1 );
+    EXPECT_EQ( 1, pool.numFree() );
+    auto buffer_2 = pool.checkout( 512 );
+    EXPECT_EQ( data_1, buffer_2.data() );
+    EXPECT_EQ( 0, pool.numFree() );
+
+    // Requests larger than any free buffer allocate a new one.
+    auto buffer_3 = pool.checkout( 4096 );
+    EXPECT_NE( data_1, buffer_3.data() );
+    pool.release( buffer_2 );
+    pool.release( buffer_3 );
+    EXPECT_EQ( 2, pool.numFree() );
+
+    // The smallest free buffer that fits is preferred.
+    auto buffer_4 = pool.checkout( 256 );
+    EXPECT_EQ( data_1, buffer_4.data() );
+    pool.release( buffer_4 );
+
+    // A pinned mirror matches the shape of the mirrored view and returns
+    // its allocation to the pool when destroyed.
+    Kokkos::View<double**, Kokkos::LayoutRight, TEST_MEMSPACE> data(
+        "data", 10, 3 );
+    {
+        Cabana::PinnedMirror<decltype( data )> mirror( pool, data );
+        EXPECT_EQ( data.extent( 0 ), mirror.view.extent( 0 ) );
+        EXPECT_EQ( data.extent( 1 ), mirror.view.extent( 1 ) );
+        Kokkos::deep_copy( mirror.view, data );
+    }
+    EXPECT_EQ( 2, pool.numFree() );
+
+    pool.clear();
+    EXPECT_EQ( 0, pool.numFree() );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -632,6 +787,21 @@ TEST( TEST_CATEGORY, comm_plan_test_7_no_topo ) { test7( false ); }
 
 TEST( TEST_CATEGORY, comm_plan_test_topology ) { testTopology(); }
 
+TEST( TEST_CATEGORY, comm_plan_test_steering_histogram )
+{
+    testSteeringHistogram();
+}
+
+TEST( TEST_CATEGORY, comm_plan_test_steering_algorithm_selection )
+{
+    testSteeringAlgorithmSelection();
+}
+
+TEST( TEST_CATEGORY, comm_plan_test_pinned_buffer_pool )
+{
+    testPinnedBufferPool();
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
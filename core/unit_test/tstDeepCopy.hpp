@@ -290,6 +290,238 @@ void testAssign()
     }
 }
 
+//---------------------------------------------------------------------------//
+// Perform a mixed-precision deep copy test.
+void testMixedPrecisionDeepCopy()
+{
+    // Declare data types differing only in precision.
+    using DoubleTypes = Cabana::MemberTypes<double[3], double>;
+    using FloatTypes = Cabana::MemberTypes<float[3], float>;
+
+    // Create AoSoAs.
+    int num_data = 357;
+    Cabana::AoSoA<DoubleTypes, TEST_MEMSPACE> src_aosoa( "src", num_data );
+    Cabana::AoSoA<FloatTypes, TEST_MEMSPACE> dst_aosoa( "dst", num_data );
+
+    // Fill the source with values exactly representable in both precisions.
+    auto src_slice_0 = Cabana::slice<0>( src_aosoa );
+    auto src_slice_1 = Cabana::slice<1>( src_aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                src_slice_0( i, d ) = 0.5 * i + d;
+            src_slice_1( i ) = 0.25 * i;
+        } );
+    Kokkos::fence();
+
+    // Convert-on-copy to the single precision AoSoA.
+    Cabana::deep_copy( dst_aosoa, src_aosoa );
+
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), dst_aosoa );
+    auto mirror_slice_0 = Cabana::slice<0>( mirror );
+    auto mirror_slice_1 = Cabana::slice<1>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_EQ( mirror_slice_0( i, d ), float( 0.5 * i + d ) );
+        EXPECT_EQ( mirror_slice_1( i ), float( 0.25 * i ) );
+    }
+
+    // Convert back up to double by slice.
+    Cabana::AoSoA<DoubleTypes, TEST_MEMSPACE> dst_aosoa_2( "dst_2", num_data );
+    auto up_slice_0 = Cabana::slice<0>( dst_aosoa_2 );
+    auto dn_slice_0 = Cabana::slice<0>( dst_aosoa );
+    Cabana::deep_copy( up_slice_0, dn_slice_0 );
+
+    auto mirror_2 =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), dst_aosoa_2 );
+    auto mirror_2_slice_0 = Cabana::slice<0>( mirror_2 );
+    for ( int i = 0; i < num_data; ++i )
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_EQ( mirror_2_slice_0( i, d ), 0.5 * i + d );
+}
+
+//---------------------------------------------------------------------------//
+// Perform an asynchronous deep copy test.
+void testAsyncDeepCopy()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<float[2], int>;
+
+    // Create AoSoAs in the test memory space.
+    int num_data = 423;
+    Cabana::AoSoA<DataTypes, TEST_MEMSPACE> src_aosoa( "src", num_data );
+    Cabana::AoSoA<DataTypes, TEST_MEMSPACE> dst_aosoa( "dst", num_data );
+
+    // Fill the source.
+    float fval = 3.2;
+    int ival = 1;
+    Cabana::Tuple<DataTypes> tp;
+    Cabana::get<0>( tp, 0 ) = fval;
+    Cabana::get<0>( tp, 1 ) = fval;
+    Cabana::get<1>( tp ) = ival;
+    Cabana::deep_copy( src_aosoa, tp );
+
+    // Copy on an execution space instance and fence the instance before
+    // using the result.
+    TEST_EXECSPACE exec_space{};
+    Cabana::deep_copy( exec_space, dst_aosoa, src_aosoa );
+    exec_space.fence();
+
+    auto host_aosoa =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), dst_aosoa );
+    auto host_slice_0 = Cabana::slice<0>( host_aosoa );
+    auto host_slice_1 = Cabana::slice<1>( host_aosoa );
+    for ( int n = 0; n < num_data; ++n )
+    {
+        EXPECT_EQ( host_slice_0( n, 0 ), fval );
+        EXPECT_EQ( host_slice_0( n, 1 ), fval );
+        EXPECT_EQ( host_slice_1( n ), ival );
+    }
+
+    // Do the same copy slice-by-slice.
+    Cabana::AoSoA<DataTypes, TEST_MEMSPACE> dst_aosoa_2( "dst_2", num_data );
+    auto src_slice_0 = Cabana::slice<0>( src_aosoa );
+    auto src_slice_1 = Cabana::slice<1>( src_aosoa );
+    auto dst_slice_0 = Cabana::slice<0>( dst_aosoa_2 );
+    auto dst_slice_1 = Cabana::slice<1>( dst_aosoa_2 );
+    Cabana::deep_copy( exec_space, dst_slice_0, src_slice_0 );
+    Cabana::deep_copy( exec_space, dst_slice_1, src_slice_1 );
+    exec_space.fence();
+
+    host_aosoa =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), dst_aosoa_2 );
+    host_slice_0 = Cabana::slice<0>( host_aosoa );
+    host_slice_1 = Cabana::slice<1>( host_aosoa );
+    for ( int n = 0; n < num_data; ++n )
+    {
+        EXPECT_EQ( host_slice_0( n, 0 ), fval );
+        EXPECT_EQ( host_slice_0( n, 1 ), fval );
+        EXPECT_EQ( host_slice_1( n ), ival );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Perform a member subset deep copy test.
+void testSubsetDeepCopy()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<float[2], int, double>;
+
+    // Create an AoSoA in the test memory space and fill it.
+    int num_data = 423;
+    Cabana::AoSoA<DataTypes, TEST_MEMSPACE> src_aosoa( "src", num_data );
+    float fval = 3.2;
+    int ival = 1;
+    double dval = 1.5;
+    auto slice_0 = Cabana::slice<0>( src_aosoa );
+    auto slice_1 = Cabana::slice<1>( src_aosoa );
+    auto slice_2 = Cabana::slice<2>( src_aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            slice_0( i, 0 ) = fval;
+            slice_0( i, 1 ) = fval + 1.0;
+            slice_1( i ) = ival;
+            slice_2( i ) = dval;
+        } );
+    Kokkos::fence();
+
+    // Create a host destination with a different vector length filled with
+    // sentinels so we can check which members were copied.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace, 32> dst_aosoa( "dst",
+                                                               num_data );
+    auto host_slice_0 = Cabana::slice<0>( dst_aosoa );
+    auto host_slice_1 = Cabana::slice<1>( dst_aosoa );
+    auto host_slice_2 = Cabana::slice<2>( dst_aosoa );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        host_slice_0( i, 0 ) = -1.0;
+        host_slice_0( i, 1 ) = -1.0;
+        host_slice_1( i ) = -1;
+        host_slice_2( i ) = -1.0;
+    }
+
+    // Copy only the first and third members.
+    Cabana::deep_copy( dst_aosoa, src_aosoa,
+                       Cabana::MemberIndexList<0, 2>() );
+
+    // Check that the selected members were copied and the unselected member
+    // kept the sentinel.
+    for ( int i = 0; i < num_data; ++i )
+    {
+        EXPECT_FLOAT_EQ( host_slice_0( i, 0 ), fval );
+        EXPECT_FLOAT_EQ( host_slice_0( i, 1 ), fval + 1.0 );
+        EXPECT_EQ( host_slice_1( i ), -1 );
+        EXPECT_DOUBLE_EQ( host_slice_2( i ), dval );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testFlatTranspose()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+
+    // Create an AoSoA in the test memory space and fill it.
+    int num_data = 423;
+    Cabana::AoSoA<DataTypes, TEST_MEMSPACE> aosoa( "aosoa", num_data );
+    auto slice_0 = Cabana::slice<0>( aosoa );
+    auto slice_1 = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                slice_0( i, d ) = 3.0 * i + d;
+            slice_1( i ) = i;
+        } );
+    Kokkos::fence();
+
+    // Transpose into flat column arrays.
+    Kokkos::View<double**, Kokkos::LayoutLeft, TEST_MEMSPACE> flat_0(
+        Kokkos::ViewAllocateWithoutInitializing( "flat_0" ), num_data, 3 );
+    Kokkos::View<int**, Kokkos::LayoutLeft, TEST_MEMSPACE> flat_1(
+        Kokkos::ViewAllocateWithoutInitializing( "flat_1" ), num_data, 1 );
+    Cabana::deep_copy( flat_0, slice_0 );
+    Cabana::deep_copy( flat_1, slice_1 );
+
+    auto host_flat_0 = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), flat_0 );
+    auto host_flat_1 = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), flat_1 );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_DOUBLE_EQ( host_flat_0( i, d ), 3.0 * i + d );
+        EXPECT_EQ( host_flat_1( i, 0 ), i );
+    }
+
+    // Update the flat data and transpose back into the particles.
+    Kokkos::parallel_for(
+        "update", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                flat_0( i, d ) += 1.0;
+        } );
+    Kokkos::fence();
+    Cabana::deep_copy( slice_0, flat_0 );
+
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto mirror_slice_0 = Cabana::slice<0>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_DOUBLE_EQ( mirror_slice_0( i, d ), 3.0 * i + d + 1.0 );
+
+    // A wrongly sized view is an error.
+    Kokkos::View<double**, Kokkos::LayoutLeft, TEST_MEMSPACE> flat_bad(
+        "flat_bad", num_data, 2 );
+    EXPECT_THROW( Cabana::deep_copy( flat_bad, slice_0 ),
+                  std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
@@ -324,6 +556,20 @@ TEST( TEST_CATEGORY, mirror_test ) { testMirror(); }
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, assign_test ) { testAssign(); }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, async_deep_copy_test ) { testAsyncDeepCopy(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, subset_deep_copy_test ) { testSubsetDeepCopy(); }
+
+TEST( TEST_CATEGORY, flat_transpose_test ) { testFlatTranspose(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, mixed_precision_deep_copy_test )
+{
+    testMixedPrecisionDeepCopy();
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -514,11 +514,14 @@ void test6( const bool use_topology )
     // Do the migration
     Cabana::migrate( *distributor, data );
 
-    // Check the change in size.
+    // Check the change in size. A growing migration may adopt a fresh
+    // allocation - the label and growth policy carry over.
     if ( 0 == my_rank )
         EXPECT_EQ( data.size(), my_size );
     else
         EXPECT_EQ( data.size(), 0 );
+    EXPECT_EQ( data.label(), "data" );
+    EXPECT_DOUBLE_EQ( data.growthFactor(), AoSoA_t::default_growth_factor );
 
     // Check the migration.
     Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
@@ -749,6 +752,850 @@ void test9( const bool use_topology )
     EXPECT_EQ( data.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+void testInPlaceNoRealloc()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank sends all of its data to itself so the import count equals
+    // the export count and the existing capacity is sufficient.
+    int num_data = 10;
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", num_data );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    Cabana::Distributor<TEST_MEMSPACE> distributor( MPI_COMM_WORLD,
+                                                    export_ranks );
+
+    // Make some data to migrate.
+    using DataTypes = Cabana::MemberTypes<int, double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", num_data );
+    auto slice_int = Cabana::slice<0>( data );
+    auto slice_dbl = Cabana::slice<1>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = i;
+        slice_dbl( i, 0 ) = i;
+        slice_dbl( i, 1 ) = i + 0.5;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // A migration within the existing capacity exchanges in place - no
+    // reallocation, so the underlying allocation is unchanged.
+    auto data_ptr_before = Cabana::slice<0>( data ).data();
+    Cabana::migrate( distributor, data );
+    EXPECT_EQ( data.size(), std::size_t( num_data ) );
+    EXPECT_EQ( Cabana::slice<0>( data ).data(), data_ptr_before );
+
+    // Check the migrated data. The arrival order follows the export
+    // steering.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host( "data_host",
+                                                           num_data );
+    Cabana::deep_copy( data_host, data );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    auto slice_dbl_host = Cabana::slice<1>( data_host );
+    auto steering = distributor.getExportSteering();
+    auto host_steering =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), steering );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        int j = host_steering( i );
+        EXPECT_EQ( slice_int_host( i ), j );
+        EXPECT_EQ( slice_dbl_host( i, 0 ), j );
+        EXPECT_EQ( slice_dbl_host( i, 1 ), j + 0.5 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testMigrateSubset()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will communicate with itself and send all of its data.
+    int num_data = 10;
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", num_data );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbor_ranks( 1, my_rank );
+
+    // Create the plan.
+    Cabana::Distributor<TEST_MEMSPACE> distributor( MPI_COMM_WORLD,
+                                                    export_ranks,
+                                                    neighbor_ranks );
+
+    // Make some data to migrate.
+    using DataTypes = Cabana::MemberTypes<int, double[2], float>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto slice_int_src = Cabana::slice<0>( data_src );
+    auto slice_dbl_src = Cabana::slice<1>( data_src );
+    auto slice_flt_src = Cabana::slice<2>( data_src );
+
+    // Fill the data.
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int_src( i ) = my_rank + i;
+        slice_dbl_src( i, 0 ) = my_rank + i;
+        slice_dbl_src( i, 1 ) = my_rank + i + 0.5;
+        slice_flt_src( i ) = my_rank + i + 0.25;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Create a destination filled with a sentinel so we can check which
+    // members moved.
+    AoSoA_t data_dst( "dst", num_data );
+    auto slice_int_dst = Cabana::slice<0>( data_dst );
+    auto slice_dbl_dst = Cabana::slice<1>( data_dst );
+    auto slice_flt_dst = Cabana::slice<2>( data_dst );
+    auto sentinel_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int_dst( i ) = -1;
+        slice_dbl_dst( i, 0 ) = -1.0;
+        slice_dbl_dst( i, 1 ) = -1.0;
+        slice_flt_dst( i ) = -1.0;
+    };
+    Kokkos::parallel_for( range_policy, sentinel_func );
+    Kokkos::fence();
+
+    // Migrate only the first and third members.
+    Cabana::migrate( distributor, data_src, data_dst,
+                     Cabana::MemberIndexList<0, 2>() );
+
+    // Check that the selected members migrated and the unselected member
+    // kept the sentinel.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_dst_host( "data_dst_host",
+                                                               num_data );
+    auto slice_int_dst_host = Cabana::slice<0>( data_dst_host );
+    auto slice_dbl_dst_host = Cabana::slice<1>( data_dst_host );
+    auto slice_flt_dst_host = Cabana::slice<2>( data_dst_host );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    auto steering = distributor.getExportSteering();
+    auto host_steering =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), steering );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        EXPECT_EQ( slice_int_dst_host( i ), my_rank + host_steering( i ) );
+        EXPECT_EQ( slice_dbl_dst_host( i, 0 ), -1.0 );
+        EXPECT_EQ( slice_dbl_dst_host( i, 1 ), -1.0 );
+        EXPECT_FLOAT_EQ( slice_flt_dst_host( i ),
+                         my_rank + host_steering( i ) + 0.25 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testMigrateReduce()
+{
+    // Get my rank and the comm size.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+    int my_size = -1;
+    MPI_Comm_size( MPI_COMM_WORLD, &my_size );
+    int next_rank = ( my_rank + 1 ) % my_size;
+
+    // Each rank owns a small destination array and sends two partial
+    // contributions per destination element to itself and to the next
+    // rank. Each destination element therefore combines four
+    // contributions: two local and two from the previous rank.
+    int num_dst = 4;
+    int num_dup = 2;
+    int num_data = 2 * num_dst * num_dup;
+    Kokkos::View<int*, Kokkos::HostSpace> export_ranks_host( "export_ranks",
+                                                             num_data );
+    Kokkos::View<int*, Kokkos::HostSpace> export_indices_host(
+        "export_indices", num_data );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        export_ranks_host( i ) =
+            ( i < num_dst * num_dup ) ? my_rank : next_rank;
+        export_indices_host( i ) = ( i / num_dup ) % num_dst;
+    }
+    auto export_ranks = Kokkos::create_mirror_view_and_copy(
+        TEST_MEMSPACE(), export_ranks_host );
+    auto export_indices = Kokkos::create_mirror_view_and_copy(
+        TEST_MEMSPACE(), export_indices_host );
+    std::vector<int> neighbor_ranks( 1, my_rank );
+    if ( next_rank != my_rank )
+        neighbor_ranks.push_back( next_rank );
+
+    // Create the plan.
+    Cabana::Distributor<TEST_MEMSPACE> distributor(
+        MPI_COMM_WORLD, export_ranks, neighbor_ranks );
+
+    // Fill the contributions. The duplicates of destination element j
+    // carry ( j + 1 ) and 10 * ( j + 1 ) so the reduced results are
+    // distinguishable.
+    using DataTypes = Cabana::MemberTypes<double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t contributions( "contributions", num_data );
+    auto slice_src = Cabana::slice<0>( contributions );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        int j = ( i / num_dup ) % num_dst;
+        double value = ( 0 == i % num_dup ) ? ( j + 1.0 )
+                                            : ( 10.0 * ( j + 1 ) );
+        slice_src( i, 0 ) = value;
+        slice_src( i, 1 ) = value + 0.5;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Sum the contributions into a zero-initialized owner array.
+    AoSoA_t owned( "owned", num_dst );
+    auto slice_dst = Cabana::slice<0>( owned );
+    auto zero_func = KOKKOS_LAMBDA( const int j )
+    {
+        slice_dst( j, 0 ) = 0.0;
+        slice_dst( j, 1 ) = 0.0;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> dst_policy( 0, num_dst );
+    Kokkos::parallel_for( dst_policy, zero_func );
+    Kokkos::fence();
+    Cabana::migrateReduce( distributor, slice_src, export_indices,
+                           slice_dst );
+
+    // Each element summed four contributions: ( j + 1 ) and 10 * ( j + 1 )
+    // from this rank and from the previous rank.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> owned_host( "owned_host",
+                                                            num_dst );
+    Cabana::deep_copy( owned_host, owned );
+    auto slice_dst_host = Cabana::slice<0>( owned_host );
+    for ( int j = 0; j < num_dst; ++j )
+    {
+        EXPECT_DOUBLE_EQ( slice_dst_host( j, 0 ), 22.0 * ( j + 1 ) );
+        EXPECT_DOUBLE_EQ( slice_dst_host( j, 1 ), 22.0 * ( j + 1 ) + 2.0 );
+    }
+
+    // Combine again with a max reduction. The largest contribution wins.
+    auto lower_func = KOKKOS_LAMBDA( const int j )
+    {
+        slice_dst( j, 0 ) = -1.0;
+        slice_dst( j, 1 ) = -1.0;
+    };
+    Kokkos::parallel_for( dst_policy, lower_func );
+    Kokkos::fence();
+    Cabana::migrateReduce( distributor, slice_src, export_indices, slice_dst,
+                           Cabana::ScatterReduce::Max() );
+    Cabana::deep_copy( owned_host, owned );
+    slice_dst_host = Cabana::slice<0>( owned_host );
+    for ( int j = 0; j < num_dst; ++j )
+    {
+        EXPECT_DOUBLE_EQ( slice_dst_host( j, 0 ), 10.0 * ( j + 1 ) );
+        EXPECT_DOUBLE_EQ( slice_dst_host( j, 1 ), 10.0 * ( j + 1 ) + 0.5 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testPersistentBuffers()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will communicate with itself and send all of its data.
+    int num_data = 10;
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", num_data );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbor_ranks( 1, my_rank );
+
+    // Create the plan with persistent buffers.
+    Cabana::Distributor<TEST_MEMSPACE> distributor(
+        MPI_COMM_WORLD, export_ranks, neighbor_ranks );
+    EXPECT_FALSE( distributor.persistentBuffersEnabled() );
+    distributor.enablePersistentBuffers();
+    EXPECT_TRUE( distributor.persistentBuffersEnabled() );
+
+    // Make some data to migrate.
+    using DataTypes = Cabana::MemberTypes<int, double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto slice_int_src = Cabana::slice<0>( data_src );
+    auto slice_dbl_src = Cabana::slice<1>( data_src );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int_src( i ) = my_rank + i;
+        slice_dbl_src( i, 0 ) = my_rank + i;
+        slice_dbl_src( i, 1 ) = my_rank + i + 0.5;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Migrate once to size the buffers.
+    AoSoA_t data_dst( "dst", num_data );
+    Cabana::migrate( distributor, data_src, data_dst );
+    auto send_capacity = distributor.sendBufferCapacity();
+    auto recv_capacity = distributor.receiveBufferCapacity();
+    EXPECT_EQ( recv_capacity,
+               num_data * sizeof( typename AoSoA_t::tuple_type ) );
+
+    // Migrate again and check that the buffers were reused without
+    // reallocation and that the data is still correct.
+    Cabana::migrate( distributor, data_src, data_dst );
+    EXPECT_EQ( distributor.sendBufferCapacity(), send_capacity );
+    EXPECT_EQ( distributor.receiveBufferCapacity(), recv_capacity );
+
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_dst_host( "data_dst_host",
+                                                               num_data );
+    auto slice_int_dst_host = Cabana::slice<0>( data_dst_host );
+    auto slice_dbl_dst_host = Cabana::slice<1>( data_dst_host );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    auto steering = distributor.getExportSteering();
+    auto host_steering =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), steering );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        EXPECT_EQ( slice_int_dst_host( i ), my_rank + host_steering( i ) );
+        EXPECT_EQ( slice_dbl_dst_host( i, 0 ), my_rank + host_steering( i ) );
+        EXPECT_EQ( slice_dbl_dst_host( i, 1 ),
+                   my_rank + host_steering( i ) + 0.5 );
+    }
+
+    // Disabling releases the buffer memory.
+    distributor.disablePersistentBuffers();
+    EXPECT_FALSE( distributor.persistentBuffersEnabled() );
+    EXPECT_EQ( distributor.sendBufferCapacity(), 0 );
+    EXPECT_EQ( distributor.receiveBufferCapacity(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+void testIncrementalUpdate()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will communicate with itself and send all of its data.
+    int num_data = 10;
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", num_data );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbor_ranks( 1, my_rank );
+
+    // Create the plan.
+    Cabana::Distributor<TEST_MEMSPACE> distributor(
+        MPI_COMM_WORLD, export_ranks, neighbor_ranks );
+    EXPECT_EQ( distributor.totalNumImport(), num_data );
+
+    // Stop exporting two of the elements with an incremental update.
+    Kokkos::View<std::size_t*, Kokkos::HostSpace> changed_ids_host(
+        "changed_ids", 2 );
+    changed_ids_host( 0 ) = 3;
+    changed_ids_host( 1 ) = 7;
+    auto changed_ids = Kokkos::create_mirror_view_and_copy(
+        TEST_MEMSPACE(), changed_ids_host );
+    Kokkos::View<int*, TEST_MEMSPACE> changed_ranks( "changed_ranks", 2 );
+    Kokkos::deep_copy( changed_ranks, -1 );
+    distributor.updateFromChangedExports( changed_ids, changed_ranks );
+
+    // Check the updated plan.
+    EXPECT_EQ( distributor.totalNumExport(), num_data - 2 );
+    EXPECT_EQ( distributor.totalNumImport(), num_data - 2 );
+    EXPECT_EQ( distributor.exportSize(), num_data );
+
+    // Migrate with the updated plan and check the removed elements do not
+    // arrive.
+    using DataTypes = Cabana::MemberTypes<int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto slice_int_src = Cabana::slice<0>( data_src );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int_src( i ) = i;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    AoSoA_t data_dst( "dst", distributor.totalNumImport() );
+    Cabana::migrate( distributor, data_src, data_dst );
+
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_dst_host(
+        "data_dst_host", distributor.totalNumImport() );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    auto slice_int_dst_host = Cabana::slice<0>( data_dst_host );
+    std::vector<bool> got( num_data, false );
+    for ( std::size_t i = 0; i < data_dst_host.size(); ++i )
+        got[slice_int_dst_host( i )] = true;
+    for ( int i = 0; i < num_data; ++i )
+    {
+        if ( 3 == i || 7 == i )
+            EXPECT_FALSE( got[i] );
+        else
+            EXPECT_TRUE( got[i] );
+    }
+
+    // Export element 3 again and check it arrives.
+    Kokkos::View<std::size_t*, Kokkos::HostSpace> one_id_host( "one_id", 1 );
+    one_id_host( 0 ) = 3;
+    auto one_id =
+        Kokkos::create_mirror_view_and_copy( TEST_MEMSPACE(), one_id_host );
+    Kokkos::View<int*, TEST_MEMSPACE> one_rank( "one_rank", 1 );
+    Kokkos::deep_copy( one_rank, my_rank );
+    distributor.updateFromChangedExports( one_id, one_rank );
+    EXPECT_EQ( distributor.totalNumImport(), num_data - 1 );
+
+    AoSoA_t data_dst2( "dst2", distributor.totalNumImport() );
+    Cabana::migrate( distributor, data_src, data_dst2 );
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_dst2_host(
+        "data_dst2_host", distributor.totalNumImport() );
+    Cabana::deep_copy( data_dst2_host, data_dst2 );
+    auto slice_int_dst2_host = Cabana::slice<0>( data_dst2_host );
+    std::fill( got.begin(), got.end(), false );
+    for ( std::size_t i = 0; i < data_dst2_host.size(); ++i )
+        got[slice_int_dst2_host( i )] = true;
+    EXPECT_TRUE( got[3] );
+    EXPECT_FALSE( got[7] );
+}
+
+//---------------------------------------------------------------------------//
+void testHostStaging()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will communicate with itself and send all of its data.
+    int num_data = 10;
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", num_data );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbor_ranks( 1, my_rank );
+
+    // Create the plan and force the buffers to be staged through host
+    // memory as if the MPI library were not GPU-aware.
+    Cabana::Distributor<TEST_MEMSPACE> distributor(
+        MPI_COMM_WORLD, export_ranks, neighbor_ranks );
+    distributor.disableDeviceDirect();
+    EXPECT_FALSE( distributor.deviceDirectEnabled() );
+
+    // Make some data to migrate.
+    using DataTypes = Cabana::MemberTypes<int, double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto slice_int_src = Cabana::slice<0>( data_src );
+    auto slice_dbl_src = Cabana::slice<1>( data_src );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int_src( i ) = my_rank + i;
+        slice_dbl_src( i, 0 ) = my_rank + i;
+        slice_dbl_src( i, 1 ) = my_rank + i + 0.5;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Migrate by AoSoA and by slice with host staging.
+    AoSoA_t data_dst( "dst", num_data );
+    Cabana::migrate( distributor, data_src, data_dst );
+    auto slice_dbl_dst = Cabana::slice<1>( data_dst );
+    Cabana::migrate( distributor, slice_dbl_src, slice_dbl_dst );
+
+    // Check the migration.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_dst_host( "data_dst_host",
+                                                               num_data );
+    auto slice_int_dst_host = Cabana::slice<0>( data_dst_host );
+    auto slice_dbl_dst_host = Cabana::slice<1>( data_dst_host );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    auto steering = distributor.getExportSteering();
+    auto host_steering =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), steering );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        EXPECT_EQ( slice_int_dst_host( i ), my_rank + host_steering( i ) );
+        EXPECT_EQ( slice_dbl_dst_host( i, 0 ), my_rank + host_steering( i ) );
+        EXPECT_EQ( slice_dbl_dst_host( i, 1 ),
+                   my_rank + host_steering( i ) + 0.5 );
+    }
+
+    // Re-enable device-direct communication.
+    distributor.enableDeviceDirect();
+    EXPECT_TRUE( distributor.deviceDirectEnabled() );
+}
+
+//---------------------------------------------------------------------------//
+void testNeighborCollectives()
+{
+    // Get my rank and the comm size.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+    int my_size = -1;
+    MPI_Comm_size( MPI_COMM_WORLD, &my_size );
+
+    // Send one element to every rank including yourself.
+    int num_data = my_size;
+    Kokkos::View<int*, Kokkos::HostSpace> export_ranks_host( "export_ranks",
+                                                             num_data );
+    std::vector<int> neighbor_ranks( num_data );
+    for ( int n = 0; n < num_data; ++n )
+    {
+        export_ranks_host( n ) = n;
+        neighbor_ranks[n] = n;
+    }
+    auto export_ranks = Kokkos::create_mirror_view_and_copy(
+        TEST_MEMSPACE(), export_ranks_host );
+
+    // Create the plan and enable the neighbor collective backend.
+    Cabana::Distributor<TEST_MEMSPACE> distributor(
+        MPI_COMM_WORLD, export_ranks, neighbor_ranks );
+    EXPECT_FALSE( distributor.neighborCollectivesEnabled() );
+    distributor.enableNeighborCollectives();
+    EXPECT_TRUE( distributor.neighborCollectivesEnabled() );
+
+    // Make data to migrate. Encode the sending rank and the destination.
+    using DataTypes = Cabana::MemberTypes<int, int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto slice_src_rank = Cabana::slice<0>( data_src );
+    auto slice_dst_rank = Cabana::slice<1>( data_src );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_src_rank( i ) = my_rank;
+        slice_dst_rank( i ) = i;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Migrate with the collective backend.
+    AoSoA_t data_dst( "dst", distributor.totalNumImport() );
+    Cabana::migrate( distributor, data_src, data_dst );
+
+    // Each rank gets one element from every rank, each addressed to us.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_dst_host(
+        "data_dst_host", distributor.totalNumImport() );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    auto slice_src_rank_host = Cabana::slice<0>( data_dst_host );
+    auto slice_dst_rank_host = Cabana::slice<1>( data_dst_host );
+    EXPECT_EQ( data_dst_host.size(), std::size_t( my_size ) );
+    std::vector<bool> got_from( my_size, false );
+    for ( int i = 0; i < my_size; ++i )
+    {
+        EXPECT_EQ( slice_dst_rank_host( i ), my_rank );
+        got_from[slice_src_rank_host( i )] = true;
+    }
+    for ( int r = 0; r < my_size; ++r )
+        EXPECT_TRUE( got_from[r] );
+
+    // Disable and check we fall back to the point-to-point path.
+    distributor.disableNeighborCollectives();
+    EXPECT_FALSE( distributor.neighborCollectivesEnabled() );
+    Cabana::migrate( distributor, data_src, data_dst );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    slice_dst_rank_host = Cabana::slice<1>( data_dst_host );
+    for ( int i = 0; i < my_size; ++i )
+        EXPECT_EQ( slice_dst_rank_host( i ), my_rank );
+}
+
+//---------------------------------------------------------------------------//
+void testOddSizeTuplePack()
+{
+    // Get my rank and the comm size.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+    int my_size = -1;
+    MPI_Comm_size( MPI_COMM_WORLD, &my_size );
+
+    // Send one element to every rank including yourself.
+    int num_data = my_size;
+    Kokkos::View<int*, Kokkos::HostSpace> export_ranks_host( "export_ranks",
+                                                             num_data );
+    std::vector<int> neighbor_ranks( num_data );
+    for ( int n = 0; n < num_data; ++n )
+    {
+        export_ranks_host( n ) = n;
+        neighbor_ranks[n] = n;
+    }
+    auto export_ranks = Kokkos::create_mirror_view_and_copy(
+        TEST_MEMSPACE(), export_ranks_host );
+    Cabana::Distributor<TEST_MEMSPACE> distributor(
+        MPI_COMM_WORLD, export_ranks, neighbor_ranks );
+
+    // Use a tuple whose size is not a multiple of the word sizes so the
+    // pack falls back to byte-wise tile flushes.
+    using DataTypes = Cabana::MemberTypes<char[3]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto slice_src = Cabana::slice<0>( data_src );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_src( i, 0 ) = my_rank;
+        slice_src( i, 1 ) = i;
+        slice_src( i, 2 ) = my_rank + i;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Migrate and check. Each rank gets one element from every rank, each
+    // addressed to us.
+    AoSoA_t data_dst( "dst", distributor.totalNumImport() );
+    Cabana::migrate( distributor, data_src, data_dst );
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_dst_host(
+        "data_dst_host", distributor.totalNumImport() );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    auto slice_dst_host = Cabana::slice<0>( data_dst_host );
+    std::vector<bool> got_from( my_size, false );
+    for ( int i = 0; i < my_size; ++i )
+    {
+        int src_rank = slice_dst_host( i, 0 );
+        EXPECT_EQ( slice_dst_host( i, 1 ), my_rank );
+        EXPECT_EQ( slice_dst_host( i, 2 ), src_rank + my_rank );
+        got_from[src_rank] = true;
+    }
+    for ( int r = 0; r < my_size; ++r )
+        EXPECT_TRUE( got_from[r] );
+}
+
+//---------------------------------------------------------------------------//
+void testSteeringIndexType()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will communicate with itself and send all of its data.
+    int num_data = 10;
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", num_data );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbor_ranks( 1, my_rank );
+
+    // Create a plan with 32-bit steering indices. This halves the steering
+    // memory relative to the default std::size_t indices.
+    Cabana::Distributor<TEST_MEMSPACE, int> distributor(
+        MPI_COMM_WORLD, export_ranks, neighbor_ranks );
+    static_assert(
+        std::is_same<decltype( distributor.getExportSteering() )::value_type,
+                     int>::value,
+        "Steering vector must use the requested index type" );
+
+    // Make data to migrate and check the migration.
+    using AoSoA_t = Cabana::AoSoA<Cabana::MemberTypes<int>, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto slice_src = Cabana::slice<0>( data_src );
+    auto fill_func = KOKKOS_LAMBDA( const int i ) { slice_src( i ) = i; };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+    AoSoA_t data_dst( "dst", num_data );
+    Cabana::migrate( distributor, data_src, data_dst );
+
+    Cabana::AoSoA<Cabana::MemberTypes<int>, Kokkos::HostSpace> data_dst_host(
+        "data_dst_host", num_data );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    auto slice_dst_host = Cabana::slice<0>( data_dst_host );
+    auto steering = distributor.getExportSteering();
+    auto host_steering =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), steering );
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_EQ( slice_dst_host( i ), host_steering( i ) );
+}
+
+//---------------------------------------------------------------------------//
+void testNodeAware()
+{
+    // Get my rank and the comm size.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+    int my_size = -1;
+    MPI_Comm_size( MPI_COMM_WORLD, &my_size );
+
+    // Send one element to every rank including yourself.
+    int num_data = my_size;
+    Kokkos::View<int*, Kokkos::HostSpace> export_ranks_host( "export_ranks",
+                                                             num_data );
+    std::vector<int> neighbor_ranks( num_data );
+    for ( int n = 0; n < num_data; ++n )
+    {
+        export_ranks_host( n ) = n;
+        neighbor_ranks[n] = n;
+    }
+    auto export_ranks = Kokkos::create_mirror_view_and_copy(
+        TEST_MEMSPACE(), export_ranks_host );
+
+    // Create the plan and enable the node-aware exchange. The test ranks
+    // all run on one node so every neighbor is reachable through the
+    // shared-memory path. Stage through host memory so the shared path is
+    // actually exercised.
+    Cabana::Distributor<TEST_MEMSPACE> distributor(
+        MPI_COMM_WORLD, export_ranks, neighbor_ranks );
+    EXPECT_FALSE( distributor.nodeAwareExchangeEnabled() );
+    distributor.enableNodeAwareExchange();
+    EXPECT_TRUE( distributor.nodeAwareExchangeEnabled() );
+    distributor.disableDeviceDirect();
+    for ( int n = 0; n < my_size; ++n )
+    {
+        EXPECT_TRUE( distributor.neighborIsOnNode( n ) );
+        EXPECT_LE( 0, distributor.neighborNodeRank( n ) );
+    }
+
+    // Make data to migrate. Encode the sending rank and the destination.
+    using DataTypes = Cabana::MemberTypes<int, int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto slice_src_rank = Cabana::slice<0>( data_src );
+    auto slice_dst_rank = Cabana::slice<1>( data_src );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_src_rank( i ) = my_rank;
+        slice_dst_rank( i ) = i;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Migrate by AoSoA through the shared-memory path.
+    AoSoA_t data_dst( "dst", distributor.totalNumImport() );
+    Cabana::migrate( distributor, data_src, data_dst );
+
+    // Each rank gets one element from every rank, each addressed to us.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_dst_host(
+        "data_dst_host", distributor.totalNumImport() );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    auto slice_src_rank_host = Cabana::slice<0>( data_dst_host );
+    auto slice_dst_rank_host = Cabana::slice<1>( data_dst_host );
+    EXPECT_EQ( data_dst_host.size(), std::size_t( my_size ) );
+    std::vector<bool> got_from( my_size, false );
+    for ( int i = 0; i < my_size; ++i )
+    {
+        EXPECT_EQ( slice_dst_rank_host( i ), my_rank );
+        got_from[slice_src_rank_host( i )] = true;
+    }
+    for ( int r = 0; r < my_size; ++r )
+        EXPECT_TRUE( got_from[r] );
+
+    // Migrate by slice through the shared-memory path.
+    auto slice_dst_rank_dst = Cabana::slice<1>( data_dst );
+    Cabana::migrate( distributor, slice_dst_rank, slice_dst_rank_dst );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    slice_dst_rank_host = Cabana::slice<1>( data_dst_host );
+    for ( int i = 0; i < my_size; ++i )
+        EXPECT_EQ( slice_dst_rank_host( i ), my_rank );
+
+    // Disable and check we fall back to the network path.
+    distributor.disableNodeAwareExchange();
+    EXPECT_FALSE( distributor.nodeAwareExchangeEnabled() );
+    Cabana::migrate( distributor, data_src, data_dst );
+    Cabana::deep_copy( data_dst_host, data_dst );
+    slice_dst_rank_host = Cabana::slice<1>( data_dst_host );
+    for ( int i = 0; i < my_size; ++i )
+        EXPECT_EQ( slice_dst_rank_host( i ), my_rank );
+    distributor.enableDeviceDirect();
+}
+
+//---------------------------------------------------------------------------//
+void testMigrateAndBin()
+{
+    // Get my rank and the comm size.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+    int my_size = -1;
+    MPI_Comm_size( MPI_COMM_WORLD, &my_size );
+
+    // Send all data to the next rank in a ring.
+    int num_data = 64;
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", num_data );
+    Kokkos::deep_copy( export_ranks, ( my_rank + 1 ) % my_size );
+    Cabana::Distributor<TEST_MEMSPACE> distributor( MPI_COMM_WORLD,
+                                                    export_ranks );
+
+    // Make data with one particle per cell of a 4x4x4 grid.
+    const int nx = 4;
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data_src( "src", num_data );
+    auto pos_src = Cabana::slice<0>( data_src );
+    auto id_src = Cabana::slice<1>( data_src );
+    auto fill_func = KOKKOS_LAMBDA( const int p )
+    {
+        pos_src( p, 0 ) = ( p % nx ) + 0.5;
+        pos_src( p, 1 ) = ( ( p / nx ) % nx ) + 0.5;
+        pos_src( p, 2 ) = ( p / ( nx * nx ) ) + 0.5;
+        id_src( p ) = my_rank * num_data + p;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_data );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Make a cell list with the grid geometry only.
+    double grid_delta[3] = { 1.0, 1.0, 1.0 };
+    double grid_min[3] = { 0.0, 0.0, 0.0 };
+    double grid_max[3] = { 1.0 * nx, 1.0 * nx, 1.0 * nx };
+    Cabana::LinkedCellList<TEST_MEMSPACE> cell_list( grid_delta, grid_min,
+                                                     grid_max );
+
+    // Migrate and bin in one fused pass.
+    AoSoA_t data_dst( "dst", distributor.totalNumImport() );
+    Cabana::migrate<0>( distributor, data_src, data_dst, cell_list );
+
+    // Build a reference list directly from the migrated positions.
+    auto pos_dst = Cabana::slice<0>( data_dst );
+    Cabana::LinkedCellList<TEST_MEMSPACE> ref_list( pos_dst, grid_delta,
+                                                    grid_min, grid_max );
+
+    // Extract the bin data of both lists and the bin each permuted particle
+    // actually lands in.
+    std::size_t num_import = distributor.totalNumImport();
+    Kokkos::View<int***, TEST_MEMSPACE> fused_size( "fused_size", nx, nx,
+                                                    nx );
+    Kokkos::View<int***, TEST_MEMSPACE> ref_size( "ref_size", nx, nx, nx );
+    Kokkos::View<std::size_t***, TEST_MEMSPACE> fused_offset( "fused_offset",
+                                                              nx, nx, nx );
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> permute_bin( "permute_bin",
+                                                           num_import );
+    Kokkos::parallel_for(
+        "extract_bins", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, nx ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int j = 0; j < nx; ++j )
+                for ( int k = 0; k < nx; ++k )
+                {
+                    fused_size( i, j, k ) = cell_list.binSize( i, j, k );
+                    fused_offset( i, j, k ) = cell_list.binOffset( i, j, k );
+                    ref_size( i, j, k ) = ref_list.binSize( i, j, k );
+                }
+        } );
+    Kokkos::parallel_for(
+        "extract_permute_bins",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_import ),
+        KOKKOS_LAMBDA( const std::size_t p ) {
+            auto orig = cell_list.permutation( p );
+            permute_bin( p ) = cell_list.pointBinIndex(
+                pos_dst( orig, 0 ), pos_dst( orig, 1 ), pos_dst( orig, 2 ) );
+        } );
+    Kokkos::fence();
+    auto fused_size_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                             fused_size );
+    auto fused_offset_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), fused_offset );
+    auto ref_size_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), ref_size );
+    auto permute_bin_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), permute_bin );
+
+    // Every particle arrived in its own cell and the fused list matches the
+    // reference build. The particles binned into each cell must actually be
+    // in that cell.
+    EXPECT_EQ( num_import, std::size_t( num_data ) );
+    for ( int i = 0; i < nx; ++i )
+        for ( int j = 0; j < nx; ++j )
+            for ( int k = 0; k < nx; ++k )
+            {
+                EXPECT_EQ( fused_size_host( i, j, k ), 1 );
+                EXPECT_EQ( fused_size_host( i, j, k ),
+                           ref_size_host( i, j, k ) );
+                auto cardinal = cell_list.cardinalBinIndex( i, j, k );
+                for ( int b = 0; b < fused_size_host( i, j, k ); ++b )
+                    EXPECT_EQ(
+                        permute_bin_host( fused_offset_host( i, j, k ) + b ),
+                        cardinal );
+            }
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -788,6 +1635,57 @@ TEST( TEST_CATEGORY, distributor_test_8_no_topo ) { test8( false ); }
 
 TEST( TEST_CATEGORY, distributor_test_9_no_topo ) { test9( false ); }
 
+TEST( TEST_CATEGORY, distributor_migrate_reduce_test )
+{
+    testMigrateReduce();
+}
+
+TEST( TEST_CATEGORY, distributor_persistent_buffer_test )
+{
+    testPersistentBuffers();
+}
+
+TEST( TEST_CATEGORY, distributor_neighbor_collective_test )
+{
+    testNeighborCollectives();
+}
+
+TEST( TEST_CATEGORY, distributor_host_staging_test ) { testHostStaging(); }
+
+TEST( TEST_CATEGORY, distributor_node_aware_test ) { testNodeAware(); }
+
+TEST( TEST_CATEGORY, distributor_migrate_and_bin_test )
+{
+    testMigrateAndBin();
+}
+
+TEST( TEST_CATEGORY, distributor_odd_size_tuple_pack_test )
+{
+    testOddSizeTuplePack();
+}
+
+TEST( TEST_CATEGORY, distributor_steering_index_type_test )
+{
+    testSteeringIndexType();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, distributor_in_place_no_realloc_test )
+{
+    testInPlaceNoRealloc();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, distributor_migrate_subset_test )
+{
+    testMigrateSubset();
+}
+
+TEST( TEST_CATEGORY, distributor_incremental_update_test )
+{
+    testIncrementalUpdate();
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
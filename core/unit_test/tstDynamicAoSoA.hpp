@@ -0,0 +1,110 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_DynamicAoSoA.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+void testDynamicAoSoA()
+{
+    // Describe the members at runtime, as a plugin would from an input
+    // deck.
+    std::vector<Cabana::MemberDescriptor> members = {
+        Cabana::createMemberDescriptor<double>( "position", 3 ),
+        Cabana::createMemberDescriptor<float>( "mass" ),
+        Cabana::createMemberDescriptor<int>( "type" ) };
+
+    using AoSoA_t = Cabana::DynamicAoSoA<TEST_MEMSPACE>;
+    int num_data = 100;
+    AoSoA_t aosoa( "dynamic", members, num_data );
+    EXPECT_EQ( aosoa.label(), "dynamic" );
+    EXPECT_EQ( aosoa.size(), num_data );
+    EXPECT_FALSE( aosoa.empty() );
+    EXPECT_EQ( aosoa.numMember(), 3 );
+    EXPECT_EQ( aosoa.memberIndex( "mass" ), 1 );
+    EXPECT_EQ( aosoa.member( 0 ).components, 3 );
+    EXPECT_EQ( aosoa.memoryUsage(), aosoa.numSoA() * aosoa.structBytes() );
+
+    // Fill the members through typed slices.
+    auto position = aosoa.slice<double>( "position" );
+    auto mass = aosoa.slice<float>( "mass" );
+    auto type = aosoa.slice<int>( 2 );
+    EXPECT_EQ( position.size(), num_data );
+    EXPECT_EQ( position.components(), 3 );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                position( i, d ) = 1.0 * i + d;
+            mass( i ) = 0.5f * i;
+            type( i ) = i;
+        } );
+    Kokkos::fence();
+
+    // Check the data on the host through a byte copy into a host
+    // container with the same description and vector length.
+    Cabana::DynamicAoSoA<Kokkos::HostSpace, AoSoA_t::vector_length> host(
+        "host", members, num_data );
+    auto host_position = host.slice<double>( "position" );
+    auto host_mass = host.slice<float>( "mass" );
+    auto host_type = host.slice<int>( "type" );
+    Kokkos::deep_copy( host.data(), aosoa.data() );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_DOUBLE_EQ( host_position( i, d ), 1.0 * i + d );
+        EXPECT_FLOAT_EQ( host_mass( i ), 0.5f * i );
+        EXPECT_EQ( host_type( i ), i );
+    }
+
+    // A slice with the wrong value size is rejected.
+    bool caught = false;
+    try
+    {
+        aosoa.slice<double>( "type" );
+    }
+    catch ( const std::runtime_error& )
+    {
+        caught = true;
+    }
+    EXPECT_TRUE( caught );
+
+    // Resizing preserves the existing tuples.
+    int resized_data = 300;
+    aosoa.resize( resized_data );
+    EXPECT_EQ( aosoa.size(), resized_data );
+    auto grown_type = aosoa.slice<int>( "type" );
+    Kokkos::View<int*, TEST_MEMSPACE> check( "check", num_data );
+    Kokkos::parallel_for(
+        "check_resize", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) { check( i ) = grown_type( i ); } );
+    Kokkos::fence();
+    auto check_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), check );
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_EQ( check_host( i ), i );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, dynamic_aosoa_test ) { testDynamicAoSoA(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
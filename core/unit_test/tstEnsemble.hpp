@@ -0,0 +1,226 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_Ensemble.hpp>
+#include <Cabana_Parallel.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+void testSegmentation()
+{
+    // Uniform segmentation.
+    std::size_t num_replica = 7;
+    std::size_t replica_size = 12;
+    Cabana::Ensemble<TEST_MEMSPACE> ensemble( num_replica, replica_size );
+    EXPECT_EQ( num_replica, ensemble.numReplica() );
+    EXPECT_EQ( num_replica * replica_size, ensemble.totalParticles() );
+
+    // Check the replica lookup for every particle on device.
+    std::size_t total = ensemble.totalParticles();
+    Kokkos::View<int*, TEST_MEMSPACE> replica_ids( "replica_ids", total );
+    Kokkos::parallel_for(
+        "check_replica_id", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, total ),
+        KOKKOS_LAMBDA( const int p ) {
+            replica_ids( p ) = ensemble.replicaId( p );
+        } );
+    auto ids_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                         replica_ids );
+    for ( std::size_t p = 0; p < total; ++p )
+        EXPECT_EQ( static_cast<int>( p / replica_size ), ids_host( p ) );
+
+    // Non-uniform segmentation exercises the binary search.
+    std::vector<std::size_t> sizes = { 5, 1, 9, 3 };
+    Cabana::Ensemble<TEST_MEMSPACE> general( sizes );
+    EXPECT_EQ( sizes.size(), general.numReplica() );
+    EXPECT_EQ( 18, general.totalParticles() );
+
+    Kokkos::View<int*, TEST_MEMSPACE> general_ids( "general_ids",
+                                                   general.totalParticles() );
+    Kokkos::parallel_for(
+        "check_general_id",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, general.totalParticles() ),
+        KOKKOS_LAMBDA( const int p ) {
+            general_ids( p ) = general.replicaId( p );
+        } );
+    auto general_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), general_ids );
+    std::size_t p = 0;
+    for ( std::size_t r = 0; r < sizes.size(); ++r )
+        for ( std::size_t i = 0; i < sizes[r]; ++i, ++p )
+            EXPECT_EQ( static_cast<int>( r ), general_host( p ) );
+}
+
+//---------------------------------------------------------------------------//
+void testParallelFor()
+{
+    using DataTypes = Cabana::MemberTypes<double, int>;
+    const int vector_length = 16;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+
+    std::size_t num_replica = 11;
+    std::size_t replica_size = 23;
+    Cabana::Ensemble<TEST_MEMSPACE> ensemble( num_replica, replica_size );
+    AoSoA_t aosoa( "aosoa", ensemble.totalParticles() );
+
+    // One launch writes the replica id into every particle.
+    auto field = Cabana::slice<0>( aosoa );
+    auto tag = Cabana::slice<1>( aosoa );
+    auto init_op = KOKKOS_LAMBDA( const int r, const int p )
+    {
+        field( p ) = 2.0 * r;
+        tag( p ) = r;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0,
+                                                ensemble.totalParticles() );
+    Cabana::ensemble_parallel_for( policy, init_op, ensemble,
+                                   "test_ensemble_init" );
+    Kokkos::fence();
+
+    auto mirror = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                       aosoa );
+    auto field_host = Cabana::slice<0>( mirror );
+    auto tag_host = Cabana::slice<1>( mirror );
+    for ( std::size_t p = 0; p < ensemble.totalParticles(); ++p )
+    {
+        int r = p / replica_size;
+        EXPECT_DOUBLE_EQ( 2.0 * r, field_host( p ) );
+        EXPECT_EQ( r, tag_host( p ) );
+    }
+
+    // One launch reduces over the whole ensemble.
+    double sum = 0.0;
+    auto sum_op = KOKKOS_LAMBDA( const int r, const int p, double& val )
+    {
+        val += field( p ) + r;
+    };
+    Cabana::ensemble_parallel_reduce( policy, sum_op, ensemble, sum,
+                                      "test_ensemble_reduce" );
+    Kokkos::fence();
+    double expected = 0.0;
+    for ( std::size_t r = 0; r < num_replica; ++r )
+        expected += 3.0 * r * replica_size;
+    EXPECT_DOUBLE_EQ( expected, sum );
+}
+
+//---------------------------------------------------------------------------//
+template <class AlgorithmTag>
+void testEnsembleVerletList()
+{
+    using DataTypes = Cabana::MemberTypes<double[3]>;
+    const int vector_length = 16;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+
+    // Put the same small configuration in every replica: a line of
+    // particles along x with unit spacing. With a cutoff of 1.5 each
+    // interior particle has exactly 2 full neighbors and the ends have 1,
+    // and no neighbor may come from another replica even though all
+    // replicas occupy identical coordinates.
+    std::size_t num_replica = 6;
+    std::size_t replica_size = 10;
+    Cabana::Ensemble<TEST_MEMSPACE> ensemble( num_replica, replica_size );
+    AoSoA_t aosoa( "aosoa", ensemble.totalParticles() );
+
+    auto mirror =
+        Cabana::create_mirror_view( Kokkos::HostSpace(), aosoa );
+    auto x_host = Cabana::slice<0>( mirror );
+    for ( std::size_t r = 0; r < num_replica; ++r )
+        for ( std::size_t i = 0; i < replica_size; ++i )
+        {
+            std::size_t p = r * replica_size + i;
+            x_host( p, 0 ) = 0.5 + i;
+            x_host( p, 1 ) = 0.5;
+            x_host( p, 2 ) = 0.5;
+        }
+    Cabana::deep_copy( aosoa, mirror );
+    auto x = Cabana::slice<0>( aosoa );
+
+    double grid_min[3] = { 0.0, 0.0, 0.0 };
+    double grid_max[3] = { static_cast<double>( replica_size ), 1.0, 1.0 };
+    Cabana::EnsembleVerletList<TEST_MEMSPACE, AlgorithmTag> nlist(
+        x, ensemble, 1.5, 1.0, grid_min, grid_max );
+
+    // Count the neighbors of every particle through the common interface
+    // and check they stay within the particle's replica.
+    std::size_t total = ensemble.totalParticles();
+    Kokkos::View<int*, TEST_MEMSPACE> num_neighbors( "num_neighbors", total );
+    Kokkos::View<int*, TEST_MEMSPACE> foreign_neighbors( "foreign_neighbors",
+                                                         total );
+    Kokkos::parallel_for(
+        "check_neighbors", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, total ),
+        KOKKOS_LAMBDA( const int p ) {
+            using list_type = decltype( nlist );
+            int num_n =
+                Cabana::NeighborList<list_type>::numNeighbor( nlist, p );
+            num_neighbors( p ) = num_n;
+            int replica = ensemble.replicaId( p );
+            for ( int n = 0; n < num_n; ++n )
+            {
+                std::size_t nid =
+                    Cabana::NeighborList<list_type>::getNeighbor( nlist, p,
+                                                                  n );
+                if ( static_cast<int>( ensemble.replicaId( nid ) ) !=
+                     replica )
+                    foreign_neighbors( p ) += 1;
+            }
+        } );
+    auto num_host = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                         num_neighbors );
+    auto foreign_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), foreign_neighbors );
+
+    for ( std::size_t r = 0; r < num_replica; ++r )
+    {
+        int total_in_replica = 0;
+        for ( std::size_t i = 0; i < replica_size; ++i )
+        {
+            std::size_t p = r * replica_size + i;
+            EXPECT_EQ( 0, foreign_host( p ) );
+            total_in_replica += num_host( p );
+        }
+
+        // Full lists store both orderings of each pair; half lists store
+        // each pair once. The line has (replica_size - 1) pairs.
+        if ( std::is_same<AlgorithmTag, Cabana::FullNeighborTag>::value )
+            EXPECT_EQ( 2 * ( replica_size - 1 ), total_in_replica );
+        else
+            EXPECT_EQ( replica_size - 1, total_in_replica );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, ensemble_segmentation_test ) { testSegmentation(); }
+
+TEST( TEST_CATEGORY, ensemble_parallel_for_test ) { testParallelFor(); }
+
+TEST( TEST_CATEGORY, ensemble_verlet_list_full_test )
+{
+    testEnsembleVerletList<Cabana::FullNeighborTag>();
+}
+
+TEST( TEST_CATEGORY, ensemble_verlet_list_half_test )
+{
+    testEnsembleVerletList<Cabana::HalfNeighborTag>();
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
@@ -0,0 +1,146 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_HDF5ParticleOutput.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <hdf5.h>
+
+#include <mpi.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace Test
+{
+
+//---------------------------------------------------------------------------//
+void writeReadTest()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Make some particles. Give each rank a different count so the
+    // collective chunk loop is exercised with ranks running out of data at
+    // different times.
+    using DataTypes = Cabana::MemberTypes<double[3], double, int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    int num_data = 155 + 27 * my_rank;
+    AoSoA_t particles( "particles", num_data );
+
+    auto host_particles =
+        Cabana::create_mirror_view( Kokkos::HostSpace(), particles );
+    auto coords = Cabana::slice<0>( host_particles );
+    auto scalar = Cabana::slice<1>( host_particles );
+    auto ids = Cabana::slice<2>( host_particles );
+    for ( int p = 0; p < num_data; ++p )
+    {
+        for ( int d = 0; d < 3; ++d )
+            coords( p, d ) = my_rank + p + 0.25 * d;
+        scalar( p ) = my_rank - 0.5 * p;
+        ids( p ) = my_rank * 10000 + p;
+    }
+    Cabana::deep_copy( particles, host_particles );
+
+    // Write a time step with a small chunk size to force the pipeline
+    // through multiple staging rounds.
+    std::vector<std::string> field_names = { "coords", "scalar", "ids" };
+    Cabana::Experimental::HDF5ParticleOutput::writeTimeStep<0, 1, 2>(
+        MPI_COMM_WORLD, "hdf5_output_test", 17, 1.34, particles, field_names,
+        64 );
+
+    // Compute this rank's row offset for reading back.
+    unsigned long long local_n = num_data;
+    unsigned long long offset = 0;
+    MPI_Exscan( &local_n, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                MPI_COMM_WORLD );
+
+    // Read this rank's rows back and check them.
+    hid_t fapl = H5Pcreate( H5P_FILE_ACCESS );
+    H5Pset_fapl_mpio( fapl, MPI_COMM_WORLD, MPI_INFO_NULL );
+    hid_t file = H5Fopen( "hdf5_output_test_17.h5", H5F_ACC_RDONLY, fapl );
+    H5Pclose( fapl );
+    ASSERT_GE( file, 0 );
+
+    std::vector<double> coords_in( 3 * num_data );
+    {
+        hid_t dataset = H5Dopen( file, "coords", H5P_DEFAULT );
+        hid_t filespace = H5Dget_space( dataset );
+        hsize_t start[2] = { offset, 0 };
+        hsize_t count[2] = { local_n, 3 };
+        H5Sselect_hyperslab( filespace, H5S_SELECT_SET, start, nullptr,
+                             count, nullptr );
+        hid_t memspace = H5Screate_simple( 2, count, nullptr );
+        H5Dread( dataset, H5T_NATIVE_DOUBLE, memspace, filespace,
+                 H5P_DEFAULT, coords_in.data() );
+        H5Sclose( memspace );
+        H5Sclose( filespace );
+        H5Dclose( dataset );
+    }
+
+    std::vector<double> scalar_in( num_data );
+    std::vector<int> ids_in( num_data );
+    for ( int f = 0; f < 2; ++f )
+    {
+        hid_t dataset =
+            H5Dopen( file, ( 0 == f ) ? "scalar" : "ids", H5P_DEFAULT );
+        hid_t filespace = H5Dget_space( dataset );
+        hsize_t start[1] = { offset };
+        hsize_t count[1] = { local_n };
+        H5Sselect_hyperslab( filespace, H5S_SELECT_SET, start, nullptr,
+                             count, nullptr );
+        hid_t memspace = H5Screate_simple( 1, count, nullptr );
+        if ( 0 == f )
+            H5Dread( dataset, H5T_NATIVE_DOUBLE, memspace, filespace,
+                     H5P_DEFAULT, scalar_in.data() );
+        else
+            H5Dread( dataset, H5T_NATIVE_INT, memspace, filespace,
+                     H5P_DEFAULT, ids_in.data() );
+        H5Sclose( memspace );
+        H5Sclose( filespace );
+        H5Dclose( dataset );
+    }
+
+    H5Fclose( file );
+
+    for ( int p = 0; p < num_data; ++p )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_DOUBLE_EQ( coords_in[3 * p + d],
+                              my_rank + p + 0.25 * d );
+        EXPECT_DOUBLE_EQ( scalar_in[p], my_rank - 0.5 * p );
+        EXPECT_EQ( ids_in[p], my_rank * 10000 + p );
+    }
+
+    // Remove the files.
+    MPI_Barrier( MPI_COMM_WORLD );
+    if ( 0 == my_rank )
+    {
+        std::remove( "hdf5_output_test_17.h5" );
+        std::remove( "hdf5_output_test_17.xmf" );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, hdf5_write_read_test ) { writeReadTest(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
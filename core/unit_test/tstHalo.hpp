@@ -405,6 +405,775 @@ void test2( const bool use_topology )
     }
 }
 
+//---------------------------------------------------------------------------//
+void testPersistentBuffers()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first element to itself.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> export_ids( "export_ids", 1 );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 1 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan with persistent buffers.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+    halo.enablePersistentBuffers();
+    EXPECT_TRUE( halo.persistentBuffersEnabled() );
+
+    // Create local and ghosted data.
+    using DataTypes = Cabana::MemberTypes<int, double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+    auto slice_dbl = Cabana::slice<1>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = my_rank + i;
+        slice_dbl( i, 0 ) = my_rank + i;
+        slice_dbl( i, 1 ) = my_rank + i + 0.5;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_local );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Gather once to size the buffers and again to check they are retained
+    // without reallocation.
+    Cabana::gather( halo, data );
+    auto send_capacity = halo.sendBufferCapacity();
+    auto recv_capacity = halo.receiveBufferCapacity();
+    EXPECT_EQ( send_capacity, sizeof( typename AoSoA_t::tuple_type ) );
+    Cabana::gather( halo, data );
+    EXPECT_EQ( halo.sendBufferCapacity(), send_capacity );
+    EXPECT_EQ( halo.receiveBufferCapacity(), recv_capacity );
+
+    // Check the gathered ghost.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    auto slice_dbl_host = Cabana::slice<1>( data_host );
+    Cabana::deep_copy( data_host, data );
+    EXPECT_EQ( slice_int_host( num_local ), my_rank );
+    EXPECT_EQ( slice_dbl_host( num_local, 0 ), my_rank );
+    EXPECT_EQ( slice_dbl_host( num_local, 1 ), my_rank + 0.5 );
+
+    // The scatter slice path reuses the same buffers - capacities may only
+    // grow.
+    Cabana::scatter( halo, slice_dbl );
+    EXPECT_GE( halo.sendBufferCapacity(), send_capacity );
+    EXPECT_GE( halo.receiveBufferCapacity(), recv_capacity );
+}
+
+//---------------------------------------------------------------------------//
+void testNeighborCollectives()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first element to itself.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> export_ids( "export_ids", 1 );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 1 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan and enable the neighbor collective backend.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+    halo.enableNeighborCollectives();
+    EXPECT_TRUE( halo.neighborCollectivesEnabled() );
+
+    // Create local and ghosted data.
+    using DataTypes = Cabana::MemberTypes<int, double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+    auto slice_dbl = Cabana::slice<1>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = my_rank + i;
+        slice_dbl( i, 0 ) = my_rank + i;
+        slice_dbl( i, 1 ) = my_rank + i + 0.5;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_local );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Gather by AoSoA and by slice with the collective backend.
+    Cabana::gather( halo, data );
+    Cabana::gather( halo, slice_int );
+
+    // Check the gathered ghost.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    auto slice_dbl_host = Cabana::slice<1>( data_host );
+    Cabana::deep_copy( data_host, data );
+    EXPECT_EQ( slice_int_host( num_local ), my_rank );
+    EXPECT_EQ( slice_dbl_host( num_local, 0 ), my_rank );
+    EXPECT_EQ( slice_dbl_host( num_local, 1 ), my_rank + 0.5 );
+
+    // Scatter the ghost back with the collective backend. The local value
+    // doubles.
+    Cabana::scatter( halo, slice_dbl );
+    Cabana::deep_copy( data_host, data );
+    slice_dbl_host = Cabana::slice<1>( data_host );
+    EXPECT_EQ( slice_dbl_host( 0, 0 ), 2.0 * my_rank );
+    EXPECT_EQ( slice_dbl_host( 0, 1 ), 2.0 * ( my_rank + 0.5 ) );
+}
+
+//---------------------------------------------------------------------------//
+void testGatherAsync()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first two elements to itself.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, Kokkos::HostSpace> export_ids_host(
+        "export_ids", 2 );
+    export_ids_host( 0 ) = 0;
+    export_ids_host( 1 ) = 1;
+    auto export_ids =
+        Kokkos::create_mirror_view_and_copy( TEST_MEMSPACE(), export_ids_host );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 2 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+
+    // Create local and ghosted data.
+    using DataTypes = Cabana::MemberTypes<int, double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+    auto slice_dbl = Cabana::slice<1>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = my_rank + i;
+        slice_dbl( i, 0 ) = my_rank + i;
+        slice_dbl( i, 1 ) = my_rank + i + 0.5;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_local );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Gather by AoSoA with the asynchronous interface. Work on the local
+    // data while the communication is in flight.
+    auto request = Cabana::gather_async( halo, data );
+    auto local_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) += 100;
+    };
+    Kokkos::parallel_for( range_policy, local_func );
+    Kokkos::fence();
+    request.wait();
+
+    // Waiting again is a no-op.
+    request.wait();
+
+    // Check the gathered ghosts. The ghosts hold the values from before the
+    // local update.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    auto slice_dbl_host = Cabana::slice<1>( data_host );
+    Cabana::deep_copy( data_host, data );
+    for ( int i = 0; i < 2; ++i )
+    {
+        EXPECT_EQ( slice_int_host( num_local + i ), my_rank + i );
+        EXPECT_EQ( slice_dbl_host( num_local + i, 0 ), my_rank + i );
+        EXPECT_EQ( slice_dbl_host( num_local + i, 1 ), my_rank + i + 0.5 );
+        EXPECT_EQ( slice_int_host( i ), my_rank + i + 100 );
+    }
+
+    // Gather by slice with the asynchronous interface.
+    auto slice_request = Cabana::gather_async( halo, slice_int );
+    slice_request.wait();
+    Cabana::deep_copy( data_host, data );
+    slice_int_host = Cabana::slice<0>( data_host );
+    for ( int i = 0; i < 2; ++i )
+        EXPECT_EQ( slice_int_host( num_local + i ), my_rank + i + 100 );
+}
+
+//---------------------------------------------------------------------------//
+void testOwnedGhostPolicy()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first two elements to itself.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, Kokkos::HostSpace> export_ids_host(
+        "export_ids", 2 );
+    export_ids_host( 0 ) = 0;
+    export_ids_host( 1 ) = 1;
+    auto export_ids =
+        Kokkos::create_mirror_view_and_copy( TEST_MEMSPACE(), export_ids_host );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 2 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+
+    // Create owned+ghosted data.
+    using DataTypes = Cabana::MemberTypes<int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+
+    // Update the owned and ghosted elements with separate range-split
+    // kernels instead of one branching kernel over the mixed range.
+    auto owned_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = 1;
+    };
+    Kokkos::parallel_for( Cabana::ownedPolicy<TEST_EXECSPACE>( halo ),
+                          owned_func );
+    auto ghost_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = 2;
+    };
+    Kokkos::parallel_for( Cabana::ghostPolicy<TEST_EXECSPACE>( halo ),
+                          ghost_func );
+    Kokkos::fence();
+
+    // The ranges tile the container without overlap.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    Cabana::deep_copy( data_host, data );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    for ( int i = 0; i < num_local; ++i )
+        EXPECT_EQ( slice_int_host( i ), 1 );
+    for ( std::size_t i = num_local; i < data_host.size(); ++i )
+        EXPECT_EQ( slice_int_host( i ), 2 );
+}
+
+//---------------------------------------------------------------------------//
+void testGatherAsyncProgress()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first two elements to itself.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, Kokkos::HostSpace> export_ids_host(
+        "export_ids", 2 );
+    export_ids_host( 0 ) = 0;
+    export_ids_host( 1 ) = 1;
+    auto export_ids =
+        Kokkos::create_mirror_view_and_copy( TEST_MEMSPACE(), export_ids_host );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 2 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+
+    // The progression thread needs MPI_THREAD_MULTIPLE. Enabling it with a
+    // lower thread support level is an error.
+    int provided;
+    MPI_Query_thread( &provided );
+    if ( provided < MPI_THREAD_MULTIPLE )
+    {
+        EXPECT_THROW( halo.enableProgressThread(), std::runtime_error );
+        return;
+    }
+
+    EXPECT_FALSE( halo.progressThreadEnabled() );
+    halo.enableProgressThread();
+    EXPECT_TRUE( halo.progressThreadEnabled() );
+
+    // Create local and ghosted data.
+    using DataTypes = Cabana::MemberTypes<int, double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+    auto slice_dbl = Cabana::slice<1>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = my_rank + i;
+        slice_dbl( i, 0 ) = my_rank + i;
+        slice_dbl( i, 1 ) = my_rank + i + 0.5;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_local );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Gather with the progression thread armed. The result matches the
+    // unthreaded gather.
+    auto request = Cabana::gather_async( halo, data );
+    request.wait();
+
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    auto slice_dbl_host = Cabana::slice<1>( data_host );
+    Cabana::deep_copy( data_host, data );
+    for ( int i = 0; i < 2; ++i )
+    {
+        EXPECT_EQ( slice_int_host( num_local + i ), my_rank + i );
+        EXPECT_EQ( slice_dbl_host( num_local + i, 0 ), my_rank + i );
+        EXPECT_EQ( slice_dbl_host( num_local + i, 1 ), my_rank + i + 0.5 );
+    }
+
+    // Overlapping requests share one thread through the reference counted
+    // guard. Let them complete in a different order than they started.
+    auto first = Cabana::gather_async( halo, data );
+    auto second = Cabana::gather_async( halo, slice_int );
+    second.wait();
+    first.wait();
+    Cabana::deep_copy( data_host, data );
+    slice_int_host = Cabana::slice<0>( data_host );
+    for ( int i = 0; i < 2; ++i )
+        EXPECT_EQ( slice_int_host( num_local + i ), my_rank + i );
+
+    // Disabling returns to progression inside application MPI calls only.
+    halo.disableProgressThread();
+    EXPECT_FALSE( halo.progressThreadEnabled() );
+    auto plain_request = Cabana::gather_async( halo, data );
+    plain_request.wait();
+}
+
+//---------------------------------------------------------------------------//
+void testGatherFused()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first two elements to itself.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> export_ids( "export_ids", 2 );
+    auto export_ids_host = Kokkos::create_mirror_view( export_ids );
+    export_ids_host( 0 ) = 0;
+    export_ids_host( 1 ) = 1;
+    Kokkos::deep_copy( export_ids, export_ids_host );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 2 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+
+    // Create local and ghosted data with slices of different value types and
+    // sizes so the fused buffer interleaves and aligns them.
+    using DataTypes = Cabana::MemberTypes<int, double[2], float>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+    auto slice_dbl = Cabana::slice<1>( data );
+    auto slice_flt = Cabana::slice<2>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = my_rank + i;
+        slice_dbl( i, 0 ) = my_rank + i;
+        slice_dbl( i, 1 ) = my_rank + i + 0.5;
+        slice_flt( i ) = my_rank + i + 0.25;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_local );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Gather all three slices with a single fused exchange.
+    Cabana::gather( halo, slice_int, slice_dbl, slice_flt );
+
+    // Check the gathered ghosts.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    auto slice_dbl_host = Cabana::slice<1>( data_host );
+    auto slice_flt_host = Cabana::slice<2>( data_host );
+    Cabana::deep_copy( data_host, data );
+    for ( int i = 0; i < 2; ++i )
+    {
+        EXPECT_EQ( slice_int_host( num_local + i ), my_rank + i );
+        EXPECT_EQ( slice_dbl_host( num_local + i, 0 ), my_rank + i );
+        EXPECT_EQ( slice_dbl_host( num_local + i, 1 ), my_rank + i + 0.5 );
+        EXPECT_FLOAT_EQ( slice_flt_host( num_local + i ),
+                         my_rank + i + 0.25 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testGatherIfStale()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first two elements to itself.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> export_ids( "export_ids", 2 );
+    auto export_ids_host = Kokkos::create_mirror_view( export_ids );
+    export_ids_host( 0 ) = 0;
+    export_ids_host( 1 ) = 1;
+    Kokkos::deep_copy( export_ids, export_ids_host );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 2 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+
+    // Create local and ghosted data.
+    using DataTypes = Cabana::MemberTypes<int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = my_rank + i;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_local );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // The first gather always runs because the ghosts have never been
+    // gathered.
+    Cabana::SliceVersion version;
+    EXPECT_TRUE( version.stale() );
+    EXPECT_TRUE( Cabana::gatherIfStale( halo, slice_int, version ) );
+    EXPECT_FALSE( version.stale() );
+
+    // A second gather without a declared write is a no-op.
+    EXPECT_FALSE( Cabana::gatherIfStale( halo, slice_int, version ) );
+
+    // Change the owned data without declaring the write. The gather still
+    // skips and the ghosts keep the old values.
+    auto refill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = my_rank + i + 100;
+    };
+    Kokkos::parallel_for( range_policy, refill_func );
+    Kokkos::fence();
+    EXPECT_FALSE( Cabana::gatherIfStale( halo, slice_int, version ) );
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    Cabana::deep_copy( data_host, data );
+    for ( int i = 0; i < 2; ++i )
+        EXPECT_EQ( slice_int_host( num_local + i ), my_rank + i );
+
+    // Declare the write. The gather now runs and refreshes the ghosts.
+    version.modify();
+    EXPECT_TRUE( version.stale() );
+    EXPECT_TRUE( Cabana::gatherIfStale( halo, slice_int, version ) );
+    Cabana::deep_copy( data_host, data );
+    for ( int i = 0; i < 2; ++i )
+        EXPECT_EQ( slice_int_host( num_local + i ), my_rank + i + 100 );
+}
+
+//---------------------------------------------------------------------------//
+void testGatherSubset()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first two elements to itself.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> export_ids( "export_ids", 2 );
+    auto export_ids_host = Kokkos::create_mirror_view( export_ids );
+    export_ids_host( 0 ) = 0;
+    export_ids_host( 1 ) = 1;
+    Kokkos::deep_copy( export_ids, export_ids_host );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 2 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+
+    // Create local and ghosted data. Fill everything including the ghosts
+    // with a sentinel so we can check which members moved.
+    using DataTypes = Cabana::MemberTypes<int, double[2], float>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+    auto slice_dbl = Cabana::slice<1>( data );
+    auto slice_flt = Cabana::slice<2>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = -1;
+        slice_dbl( i, 0 ) = -1.0;
+        slice_dbl( i, 1 ) = -1.0;
+        slice_flt( i ) = -1.0;
+        if ( i < num_local )
+        {
+            slice_int( i ) = my_rank + i;
+            slice_dbl( i, 0 ) = my_rank + i;
+            slice_dbl( i, 1 ) = my_rank + i + 0.5;
+            slice_flt( i ) = my_rank + i + 0.25;
+        }
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy(
+        0, halo.numLocal() + halo.numGhost() );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Gather only the first and third members.
+    Cabana::gather( halo, data, Cabana::MemberIndexList<0, 2>() );
+
+    // Check that the selected members were gathered and the unselected
+    // member kept the sentinel in the ghosts.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    auto slice_dbl_host = Cabana::slice<1>( data_host );
+    auto slice_flt_host = Cabana::slice<2>( data_host );
+    Cabana::deep_copy( data_host, data );
+    for ( int i = 0; i < 2; ++i )
+    {
+        EXPECT_EQ( slice_int_host( num_local + i ), my_rank + i );
+        EXPECT_EQ( slice_dbl_host( num_local + i, 0 ), -1.0 );
+        EXPECT_EQ( slice_dbl_host( num_local + i, 1 ), -1.0 );
+        EXPECT_FLOAT_EQ( slice_flt_host( num_local + i ),
+                         my_rank + i + 0.25 );
+    }
+
+    // Gather a single member through the same interface.
+    Cabana::gather( halo, data, Cabana::MemberIndexList<1>() );
+    Cabana::deep_copy( data_host, data );
+    for ( int i = 0; i < 2; ++i )
+    {
+        EXPECT_EQ( slice_dbl_host( num_local + i, 0 ), my_rank + i );
+        EXPECT_EQ( slice_dbl_host( num_local + i, 1 ), my_rank + i + 0.5 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testPullHalo( const bool use_topology )
+{
+    // Get my rank and the comm size.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+    int my_size = -1;
+    MPI_Comm_size( MPI_COMM_WORLD, &my_size );
+
+    // Every rank requests the first three elements of the next rank in a
+    // ring as ghosts.
+    int next_rank = ( my_rank + 1 ) % my_size;
+    int prev_rank = ( my_rank + my_size - 1 ) % my_size;
+    int num_local = 10;
+    int num_request = 3;
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> import_ids( "import_ids",
+                                                          num_request );
+    auto import_ids_host = Kokkos::create_mirror_view( import_ids );
+    for ( int i = 0; i < num_request; ++i )
+        import_ids_host( i ) = i;
+    Kokkos::deep_copy( import_ids, import_ids_host );
+    Kokkos::View<int*, TEST_MEMSPACE> import_ranks( "import_ranks",
+                                                    num_request );
+    Kokkos::deep_copy( import_ranks, next_rank );
+
+    // Create the pull-mode halo, either discovering the topology or with
+    // the ring neighbors given.
+    std::vector<int> neighbors = { my_rank, next_rank, prev_rank };
+    std::sort( neighbors.begin(), neighbors.end() );
+    neighbors.erase( std::unique( neighbors.begin(), neighbors.end() ),
+                     neighbors.end() );
+    auto halo =
+        ( use_topology )
+            ? Cabana::createHaloFromImports( MPI_COMM_WORLD, num_local,
+                                             import_ids, import_ranks,
+                                             neighbors )
+            : Cabana::createHaloFromImports( MPI_COMM_WORLD, num_local,
+                                             import_ids, import_ranks );
+
+    // We request from one rank and the previous rank requests from us.
+    EXPECT_EQ( halo.numLocal(), num_local );
+    EXPECT_EQ( halo.numGhost(), num_request );
+    EXPECT_EQ( halo.totalNumExport(), num_request );
+
+    // Create local and ghosted data with values unique to the owning rank.
+    using AoSoA_t = Cabana::AoSoA<Cabana::MemberTypes<int>, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = ( i < num_local ) ? 100 * my_rank + i : -1;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy(
+        0, halo.numLocal() + halo.numGhost() );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Gather the ghosts from the owners.
+    Cabana::gather( halo, data );
+
+    // The ghosts are the requested elements of the next rank. The order
+    // within an owner is not guaranteed so sort before comparing.
+    auto data_host = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                          data );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    std::vector<int> ghost_values( num_request );
+    for ( int i = 0; i < num_request; ++i )
+        ghost_values[i] = slice_int_host( num_local + i );
+    std::sort( ghost_values.begin(), ghost_values.end() );
+    for ( int i = 0; i < num_request; ++i )
+        EXPECT_EQ( ghost_values[i], 100 * next_rank + i );
+}
+
+//---------------------------------------------------------------------------//
+void testScatterReduce()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first element to itself twice and its second
+    // element once so local element 0 receives multiple contributions.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> export_ids( "export_ids", 3 );
+    auto export_ids_host = Kokkos::create_mirror_view( export_ids );
+    export_ids_host( 0 ) = 0;
+    export_ids_host( 1 ) = 0;
+    export_ids_host( 2 ) = 1;
+    Kokkos::deep_copy( export_ids, export_ids_host );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 3 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+
+    // Create local and ghosted data.
+    using DataTypes = Cabana::MemberTypes<double, int, float>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_dbl = Cabana::slice<0>( data );
+    auto slice_int = Cabana::slice<1>( data );
+    auto slice_flt = Cabana::slice<2>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        if ( i < num_local )
+        {
+            slice_dbl( i ) = i + 1.0;
+            slice_int( i ) = 50;
+            slice_flt( i ) = 50.0;
+        }
+        else
+        {
+            slice_dbl( i ) = i - num_local + 1.0;
+            slice_int( i ) = 10 + 50 * ( i - num_local );
+            slice_flt( i ) = 10.0 + 50.0 * ( i - num_local );
+        }
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy(
+        0, halo.numLocal() + halo.numGhost() );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Deterministic sum. Local element 0 gets the first two ghost values and
+    // local element 1 gets the third.
+    Cabana::scatter( halo, slice_dbl, Cabana::ScatterReduce::DeterministicSum() );
+
+    // Minimum. The ghosts contribute 10, 60 and 110.
+    Cabana::scatter( halo, slice_int, Cabana::ScatterReduce::Min() );
+
+    // Maximum with the same ghost contributions.
+    Cabana::scatter( halo, slice_flt, Cabana::ScatterReduce::Max() );
+
+    // Check the reduced local values.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    auto slice_dbl_host = Cabana::slice<0>( data_host );
+    auto slice_int_host = Cabana::slice<1>( data_host );
+    auto slice_flt_host = Cabana::slice<2>( data_host );
+    Cabana::deep_copy( data_host, data );
+    EXPECT_EQ( slice_dbl_host( 0 ), 4.0 );
+    EXPECT_EQ( slice_dbl_host( 1 ), 5.0 );
+    EXPECT_EQ( slice_int_host( 0 ), 10 );
+    EXPECT_EQ( slice_int_host( 1 ), 50 );
+    EXPECT_FLOAT_EQ( slice_flt_host( 0 ), 60.0 );
+    EXPECT_FLOAT_EQ( slice_flt_host( 1 ), 110.0 );
+    for ( int i = 2; i < num_local; ++i )
+    {
+        EXPECT_EQ( slice_dbl_host( i ), i + 1.0 );
+        EXPECT_EQ( slice_int_host( i ), 50 );
+        EXPECT_FLOAT_EQ( slice_flt_host( i ), 50.0 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testRmaExchange()
+{
+    // Get my rank.
+    int my_rank = -1;
+    MPI_Comm_rank( MPI_COMM_WORLD, &my_rank );
+
+    // Every rank will ghost its first element to itself.
+    int num_local = 10;
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> export_ids( "export_ids", 1 );
+    Kokkos::View<int*, TEST_MEMSPACE> export_ranks( "export_ranks", 1 );
+    Kokkos::deep_copy( export_ranks, my_rank );
+    std::vector<int> neighbors( 1, my_rank );
+
+    // Create the plan and enable the one-sided exchange backend.
+    Cabana::Halo<TEST_MEMSPACE> halo( MPI_COMM_WORLD, num_local, export_ids,
+                                      export_ranks, neighbors );
+    halo.enableRmaExchange();
+    EXPECT_TRUE( halo.rmaExchangeEnabled() );
+
+    // Create local and ghosted data.
+    using DataTypes = Cabana::MemberTypes<int, double[2]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    AoSoA_t data( "data", halo.numLocal() + halo.numGhost() );
+    auto slice_int = Cabana::slice<0>( data );
+    auto slice_dbl = Cabana::slice<1>( data );
+    auto fill_func = KOKKOS_LAMBDA( const int i )
+    {
+        slice_int( i ) = my_rank + i;
+        slice_dbl( i, 0 ) = my_rank + i;
+        slice_dbl( i, 1 ) = my_rank + i + 0.5;
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> range_policy( 0, num_local );
+    Kokkos::parallel_for( range_policy, fill_func );
+    Kokkos::fence();
+
+    // Gather by AoSoA twice so the second call reuses the cached window
+    // and by slice with the one-sided backend.
+    Cabana::gather( halo, data );
+    Cabana::gather( halo, data );
+    Cabana::gather( halo, slice_int );
+
+    // Check the gathered ghost.
+    Cabana::AoSoA<DataTypes, Kokkos::HostSpace> data_host(
+        "data_host", halo.numLocal() + halo.numGhost() );
+    auto slice_int_host = Cabana::slice<0>( data_host );
+    auto slice_dbl_host = Cabana::slice<1>( data_host );
+    Cabana::deep_copy( data_host, data );
+    EXPECT_EQ( slice_int_host( num_local ), my_rank );
+    EXPECT_EQ( slice_dbl_host( num_local, 0 ), my_rank );
+    EXPECT_EQ( slice_dbl_host( num_local, 1 ), my_rank + 0.5 );
+
+    // Disable and check the point-to-point fallback still works.
+    halo.disableRmaExchange();
+    EXPECT_FALSE( halo.rmaExchangeEnabled() );
+    Cabana::gather( halo, data );
+    Cabana::deep_copy( data_host, data );
+    slice_int_host = Cabana::slice<0>( data_host );
+    EXPECT_EQ( slice_int_host( num_local ), my_rank );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -416,6 +1185,37 @@ TEST( TEST_CATEGORY, halo_test_2 ) { test2( true ); }
 
 TEST( TEST_CATEGORY, halo_test_2_no_topo ) { test2( false ); }
 
+TEST( TEST_CATEGORY, halo_persistent_buffer_test ) { testPersistentBuffers(); }
+
+TEST( TEST_CATEGORY, halo_gather_async_test ) { testGatherAsync(); }
+
+TEST( TEST_CATEGORY, halo_owned_ghost_policy_test ) { testOwnedGhostPolicy(); }
+
+TEST( TEST_CATEGORY, halo_gather_async_progress_test )
+{
+    testGatherAsyncProgress();
+}
+
+TEST( TEST_CATEGORY, halo_neighbor_collective_test )
+{
+    testNeighborCollectives();
+}
+
+TEST( TEST_CATEGORY, halo_gather_fused_test ) { testGatherFused(); }
+
+TEST( TEST_CATEGORY, halo_gather_if_stale_test ) { testGatherIfStale(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, halo_gather_subset_test ) { testGatherSubset(); }
+
+TEST( TEST_CATEGORY, halo_pull_test ) { testPullHalo( true ); }
+
+TEST( TEST_CATEGORY, halo_pull_test_no_topo ) { testPullHalo( false ); }
+
+TEST( TEST_CATEGORY, halo_scatter_reduce_test ) { testScatterReduce(); }
+
+TEST( TEST_CATEGORY, halo_rma_exchange_test ) { testRmaExchange(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -0,0 +1,152 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_Insert.hpp>
+#include <Cabana_VerletList.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+void testInsert()
+{
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    int num_data = 50;
+    int num_insert = 20;
+    AoSoA_t aosoa( "aosoa", num_data );
+    AoSoA_t particles( "particles", num_insert );
+
+    // Fill the container and the batch to insert with distinct values.
+    auto slice_0 = Cabana::slice<0>( aosoa );
+    auto slice_1 = Cabana::slice<1>( aosoa );
+    auto new_0 = Cabana::slice<0>( particles );
+    auto new_1 = Cabana::slice<1>( particles );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                slice_0( i, d ) = 1.0 * i + d;
+            slice_1( i ) = i;
+        } );
+    Kokkos::parallel_for(
+        "fill_new", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_insert ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                new_0( i, d ) = -1.0 * i - d;
+            new_1( i ) = -i - 1;
+        } );
+    Kokkos::fence();
+
+    // Append the batch and check both the existing and inserted tuples.
+    auto new_size = Cabana::insert( aosoa, particles );
+    EXPECT_EQ( new_size, num_data + num_insert );
+    EXPECT_EQ( aosoa.size(), num_data + num_insert );
+
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto mirror_0 = Cabana::slice<0>( mirror );
+    auto mirror_1 = Cabana::slice<1>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_DOUBLE_EQ( mirror_0( i, d ), 1.0 * i + d );
+        EXPECT_EQ( mirror_1( i ), i );
+    }
+    for ( int i = 0; i < num_insert; ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_DOUBLE_EQ( mirror_0( num_data + i, d ), -1.0 * i - d );
+        EXPECT_EQ( mirror_1( num_data + i ), -i - 1 );
+    }
+
+    // Inserting into an empty container is a plain copy.
+    AoSoA_t empty( "empty" );
+    Cabana::insert( empty, particles );
+    EXPECT_EQ( empty.size(), num_insert );
+
+    // With reserved capacity repeated insertions do not reallocate.
+    AoSoA_t reserved( "reserved", num_data );
+    reserved.reserve( num_data + 4 * num_insert );
+    auto capacity = reserved.capacity();
+    auto* data_ptr = reserved.data();
+    for ( int b = 0; b < 4; ++b )
+        Cabana::insert( reserved, particles );
+    EXPECT_EQ( reserved.size(), num_data + 4 * num_insert );
+    EXPECT_EQ( reserved.capacity(), capacity );
+    EXPECT_EQ( reserved.data(), data_ptr );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testVerletListTolerance()
+{
+    // Put particles on a line with unit spacing so each interior particle
+    // has two neighbors within the cutoff.
+    using DataTypes = Cabana::MemberTypes<double[3]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    int num_data = 10;
+    AoSoA_t aosoa( "aosoa", num_data );
+    auto position = Cabana::slice<0>( aosoa );
+    Kokkos::parallel_for(
+        "fill_positions", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            position( i, 0 ) = 1.0 * i;
+            position( i, 1 ) = 0.0;
+            position( i, 2 ) = 0.0;
+        } );
+    Kokkos::fence();
+
+    double grid_min[3] = { -1.0, -1.0, -1.0 };
+    double grid_max[3] = { 1.0 * num_data, 1.0, 1.0 };
+    Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag>
+        list( position, 0, num_data, 1.5, 1.0, grid_min, grid_max );
+
+    // Append particles and extend the list to tolerate them.
+    int num_insert = 5;
+    list.tolerateInsertions( num_data + num_insert );
+
+    // Existing particles keep their neighbor counts and the appended
+    // particles report zero neighbors.
+    auto counts = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                       list._data.counts );
+    EXPECT_EQ( counts.extent( 0 ),
+               static_cast<std::size_t>( num_data + num_insert ) );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        int expected = ( 0 == i || num_data - 1 == i ) ? 1 : 2;
+        EXPECT_EQ( counts( i ), expected );
+    }
+    for ( int i = num_data; i < num_data + num_insert; ++i )
+        EXPECT_EQ( counts( i ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, insert_test ) { testInsert(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, insert_verlet_tolerance_test )
+{
+    testVerletListTolerance<Cabana::VerletLayoutCSR>();
+    testVerletListTolerance<Cabana::VerletLayout2D>();
+    testVerletListTolerance<Cabana::VerletLayoutCompressed2D>();
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
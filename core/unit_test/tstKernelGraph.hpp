@@ -0,0 +1,86 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_KernelGraph.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace Test
+{
+
+//---------------------------------------------------------------------------//
+void testKernelGraph()
+{
+    using device_type = Kokkos::Device<TEST_EXECSPACE, TEST_MEMSPACE>;
+
+    int num_data = 1000;
+    Kokkos::View<double*, device_type> x( "x", num_data );
+
+    // Nothing has been captured yet.
+    Cabana::KernelGraph<TEST_EXECSPACE> graph;
+    EXPECT_FALSE( graph.captured() );
+    EXPECT_THROW( graph.replay(), std::runtime_error );
+
+    // Capture a fixed two-kernel sequence.
+    graph.capture(
+        [=]( const TEST_EXECSPACE& space )
+        {
+            Kokkos::parallel_for(
+                Kokkos::RangePolicy<TEST_EXECSPACE>( space, 0, num_data ),
+                KOKKOS_LAMBDA( const int i ) { x( i ) += 1.0; } );
+            Kokkos::parallel_for(
+                Kokkos::RangePolicy<TEST_EXECSPACE>( space, 0, num_data ),
+                KOKKOS_LAMBDA( const int i ) { x( i ) *= 2.0; } );
+        } );
+    EXPECT_TRUE( graph.captured() );
+
+    // Capture records the sequence without executing it.
+    graph.space().fence();
+    auto x_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), x );
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_DOUBLE_EQ( 0.0, x_host( i ) );
+
+    // Each replay runs the whole sequence once.
+    graph.replay();
+    graph.replay();
+    graph.space().fence();
+    Kokkos::deep_copy( x_host, x );
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_DOUBLE_EQ( 6.0, x_host( i ) );
+
+    // A new capture replaces the previous sequence.
+    graph.capture(
+        [=]( const TEST_EXECSPACE& space )
+        {
+            Kokkos::parallel_for(
+                Kokkos::RangePolicy<TEST_EXECSPACE>( space, 0, num_data ),
+                KOKKOS_LAMBDA( const int i ) { x( i ) += 10.0; } );
+        } );
+    graph.replay();
+    graph.space().fence();
+    Kokkos::deep_copy( x_host, x );
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_DOUBLE_EQ( 16.0, x_host( i ) );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, kernel_graph_test ) { testKernelGraph(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
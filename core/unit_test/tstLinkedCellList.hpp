@@ -318,6 +318,144 @@ void testLinkedListSlice()
     }
 }
 
+//---------------------------------------------------------------------------//
+void testSortedLinkedCellList()
+{
+    LCLTestData test_data;
+    auto grid_delta = test_data.grid_delta;
+    auto grid_min = test_data.grid_min;
+    auto grid_max = test_data.grid_max;
+
+    // Bin and sort the particles with the fused build path.
+    auto cell_list = Cabana::createSortedLinkedCellList<LCLTestData::Position>(
+        test_data.aosoa, grid_delta, grid_min, grid_max );
+
+    // The sorted container must match a build followed by a separate
+    // permute.
+    copyListToHost( test_data, cell_list );
+    checkBins( test_data, cell_list );
+    checkLinkedCell( test_data, 0, test_data.num_p, true );
+
+    // The permutation of the returned list is the identity - the container
+    // is already in bin order.
+    auto np = test_data.num_p;
+    Kokkos::View<LCLTestData::size_type*, TEST_MEMSPACE> permute( "permute",
+                                                                  np );
+    Kokkos::parallel_for(
+        "copy permutation", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, np ),
+        KOKKOS_LAMBDA( const int p ) {
+            permute( p ) = cell_list.permutation( p );
+        } );
+    Kokkos::fence();
+    auto permute_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), permute );
+    for ( std::size_t p = 0; p < np; ++p )
+        EXPECT_EQ( permute_mirror( p ), p );
+}
+
+//---------------------------------------------------------------------------//
+void testHierarchicalLinkedCellList()
+{
+    LCLTestData test_data;
+    auto grid_delta = test_data.grid_delta;
+    auto grid_min = test_data.grid_min;
+    auto grid_max = test_data.grid_max;
+    auto pos = Cabana::slice<LCLTestData::Position>( test_data.aosoa );
+
+    // Bin once with a two-level hierarchy: fine cells of size 1 and coarse
+    // cells of twice the fine size.
+    int refinement = 2;
+    Cabana::HierarchicalLinkedCellList<TEST_MEMSPACE> cell_list(
+        pos, grid_delta, refinement, grid_min, grid_max );
+    Cabana::permute( cell_list, test_data.aosoa );
+
+    auto nx = test_data.nx;
+    int cx = nx / refinement;
+    auto fine = cell_list.fine();
+    auto coarse = cell_list.coarse();
+
+    // Check the level dimensions.
+    EXPECT_EQ( cell_list.refinement(), refinement );
+    EXPECT_EQ( fine.totalBins(), nx * nx * nx );
+    EXPECT_EQ( coarse.totalBins(), cx * cx * cx );
+    for ( int d = 0; d < 3; ++d )
+    {
+        EXPECT_EQ( fine.numBin( d ), nx );
+        EXPECT_EQ( coarse.numBin( d ), cx );
+    }
+
+    // Copy the bin data of both levels and the binned cell ids to the host.
+    auto id_slice = Cabana::slice<LCLTestData::CellId>( test_data.aosoa );
+    auto np = test_data.num_p;
+    LCLTestData::IDViewType ids( "cell_ids", np );
+    LCLTestData::BinViewType fine_size( "fine_size", nx, nx, nx );
+    LCLTestData::BinViewType fine_offset( "fine_offset", nx, nx, nx );
+    LCLTestData::BinViewType coarse_size( "coarse_size", cx, cx, cx );
+    LCLTestData::BinViewType coarse_offset( "coarse_offset", cx, cx, cx );
+    Kokkos::parallel_for(
+        "copy hierarchy bin data", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, nx ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int j = 0; j < nx; ++j )
+                for ( int k = 0; k < nx; ++k )
+                {
+                    fine_size( i, j, k ) = fine.binSize( i, j, k );
+                    fine_offset( i, j, k ) = fine.binOffset( i, j, k );
+                    std::size_t p = i + j * nx + k * nx * nx;
+                    for ( int d = 0; d < 3; ++d )
+                        ids( p, d ) = id_slice( p, d );
+                }
+            if ( i < cx )
+                for ( int j = 0; j < cx; ++j )
+                    for ( int k = 0; k < cx; ++k )
+                    {
+                        coarse_size( i, j, k ) = coarse.binSize( i, j, k );
+                        coarse_offset( i, j, k ) = coarse.binOffset( i, j, k );
+                    }
+        } );
+    Kokkos::fence();
+    auto ids_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), ids );
+    auto fine_size_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), fine_size );
+    auto fine_offset_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), fine_offset );
+    auto coarse_size_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), coarse_size );
+    auto coarse_offset_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), coarse_offset );
+
+    // Every fine bin holds its one particle and the permuted container
+    // matches the fine bin offsets.
+    for ( int i = 0; i < nx; ++i )
+        for ( int j = 0; j < nx; ++j )
+            for ( int k = 0; k < nx; ++k )
+            {
+                EXPECT_EQ( fine_size_mirror( i, j, k ), 1 );
+                auto p = fine_offset_mirror( i, j, k );
+                EXPECT_EQ( ids_mirror( p, 0 ), i );
+                EXPECT_EQ( ids_mirror( p, 1 ), j );
+                EXPECT_EQ( ids_mirror( p, 2 ), k );
+            }
+
+    // Every coarse bin is a contiguous range of the same permutation
+    // holding exactly the particles of its refinement block.
+    int r3 = refinement * refinement * refinement;
+    for ( int ci = 0; ci < cx; ++ci )
+        for ( int cj = 0; cj < cx; ++cj )
+            for ( int ck = 0; ck < cx; ++ck )
+            {
+                EXPECT_EQ( coarse_size_mirror( ci, cj, ck ),
+                           LCLTestData::size_type( r3 ) );
+                auto begin = coarse_offset_mirror( ci, cj, ck );
+                for ( int n = 0; n < r3; ++n )
+                {
+                    EXPECT_EQ( ids_mirror( begin + n, 0 ) / refinement, ci );
+                    EXPECT_EQ( ids_mirror( begin + n, 1 ) / refinement, cj );
+                    EXPECT_EQ( ids_mirror( begin + n, 2 ) / refinement, ck );
+                }
+            }
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -326,6 +464,15 @@ TEST( TEST_CATEGORY, linked_list_test ) { testLinkedList(); }
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, linked_list_slice_test ) { testLinkedListSlice(); }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, sorted_linked_list_test ) { testSortedLinkedCellList(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, hierarchical_linked_list_test )
+{
+    testHierarchicalLinkedCellList();
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -0,0 +1,95 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_MemoryPool.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Pool bookkeeping test.
+void testPool()
+{
+    using pool_type = Cabana::MemoryPool<TEST_MEMSPACE>;
+    pool_type pool( "test_pool", 4096 );
+    EXPECT_EQ( pool.capacity(), 4096 );
+    EXPECT_EQ( pool.used(), 0 );
+    EXPECT_EQ( pool.highWaterMark(), 0 );
+
+    // Allocations are padded to the pool alignment.
+    auto view_1 = pool.allocateView<double>( 10 );
+    EXPECT_EQ( view_1.extent( 0 ), 10 );
+    EXPECT_EQ( pool.used(), pool_type::alignment );
+
+    auto view_2 = pool.allocateView<int>( 100 );
+    EXPECT_EQ( view_2.extent( 0 ), 100 );
+    EXPECT_EQ( pool.used(), 3 * pool_type::alignment );
+    EXPECT_EQ( pool.highWaterMark(), 3 * pool_type::alignment );
+
+    // Recycling the pool frees everything but keeps the high water mark.
+    pool.reset();
+    EXPECT_EQ( pool.used(), 0 );
+    EXPECT_EQ( pool.highWaterMark(), 3 * pool_type::alignment );
+
+    // Exhausting the pool throws.
+    EXPECT_THROW( pool.allocate( 8192 ), std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Pool-backed AoSoA test.
+void testPoolAoSoA()
+{
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+    const int num_data = 45;
+
+    Cabana::MemoryPool<TEST_MEMSPACE> pool( "test_pool", 1 << 16 );
+    auto aosoa = Cabana::createPoolAoSoA<DataTypes>( pool, num_data );
+    EXPECT_EQ( aosoa.size(), num_data );
+    EXPECT_GT( pool.used(), 0 );
+
+    // Check that the pool memory is usable through the standard interfaces.
+    auto slice_0 = Cabana::slice<0>( aosoa );
+    auto slice_1 = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "pool_aosoa_fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                slice_0( i, d ) = 1.5 * i + d;
+            slice_1( i ) = 2 * i;
+        } );
+
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto mirror_slice_0 = Cabana::slice<0>( mirror );
+    auto mirror_slice_1 = Cabana::slice<1>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_EQ( mirror_slice_0( i, d ), 1.5 * i + d );
+        EXPECT_EQ( mirror_slice_1( i ), 2 * i );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, memory_pool_test ) { testPool(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, memory_pool_aosoa_test ) { testPoolAoSoA(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
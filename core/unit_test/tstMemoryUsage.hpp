@@ -0,0 +1,165 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_LinkedCellList.hpp>
+#include <Cabana_MemoryUsage.hpp>
+#include <Cabana_VerletList.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace Test
+{
+
+//---------------------------------------------------------------------------//
+void aosoaMemoryUsageTest()
+{
+    const int vector_length = 16;
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+    using soa_type = typename AoSoA_t::soa_type;
+
+    // The allocation covers whole structs for the full capacity.
+    int num_data = 100;
+    AoSoA_t aosoa( "aosoa", num_data );
+    std::size_t num_soa_bytes = aosoa.numSoA() * sizeof( soa_type );
+    EXPECT_GE( aosoa.memoryUsage(), num_soa_bytes );
+    EXPECT_EQ( aosoa.memoryUsage(),
+               ( aosoa.capacity() / vector_length ) * sizeof( soa_type ) );
+
+    // Shrinking the size does not release the allocation.
+    auto bytes_before = aosoa.memoryUsage();
+    aosoa.resize( 10 );
+    EXPECT_EQ( aosoa.memoryUsage(), bytes_before );
+
+    // An empty container holds no memory.
+    AoSoA_t empty( "empty" );
+    EXPECT_EQ( empty.memoryUsage(), 0 );
+
+    // The free function forwards to the member.
+    EXPECT_EQ( Cabana::memoryUsage( aosoa ), aosoa.memoryUsage() );
+}
+
+//---------------------------------------------------------------------------//
+void listMemoryUsageTest()
+{
+    // Make a particle container with a regular grid of positions.
+    const int vector_length = 16;
+    using DataTypes = Cabana::MemberTypes<double[3]>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+    int particles_per_dim = 10;
+    int num_data = particles_per_dim * particles_per_dim * particles_per_dim;
+    AoSoA_t aosoa( "aosoa", num_data );
+    auto position = Cabana::slice<0>( aosoa );
+    double dx = 1.0;
+    Kokkos::parallel_for(
+        "fill_positions", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int p ) {
+            position( p, 0 ) = ( p % particles_per_dim ) * dx;
+            position( p, 1 ) =
+                ( ( p / particles_per_dim ) % particles_per_dim ) * dx;
+            position( p, 2 ) =
+                ( p / ( particles_per_dim * particles_per_dim ) ) * dx;
+        } );
+
+    double grid_min[3] = { -0.5, -0.5, -0.5 };
+    double grid_max[3] = { particles_per_dim * dx, particles_per_dim * dx,
+                           particles_per_dim * dx };
+
+    // A linked cell list allocates a count and offset per cell and a
+    // permutation per particle.
+    double grid_delta[3] = { dx, dx, dx };
+    Cabana::LinkedCellList<TEST_MEMSPACE> cell_list( position, grid_delta,
+                                                     grid_min, grid_max );
+    using size_type =
+        typename Cabana::LinkedCellList<TEST_MEMSPACE>::size_type;
+    std::size_t num_cell = cell_list.totalBins();
+    EXPECT_EQ( cell_list.memoryUsage(),
+               num_cell * ( sizeof( int ) + sizeof( size_type ) ) +
+                   num_data * sizeof( size_type ) );
+
+    // A neighbor list holds at least its per-particle counts and offsets
+    // plus one entry per neighbor found.
+    Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag,
+                       Cabana::VerletLayoutCSR, Cabana::TeamOpTag>
+        nlist( position, 0, num_data, 1.1 * dx, 1.0, grid_min, grid_max );
+    std::size_t total_neighbors = 0;
+    auto counts_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), nlist._data.counts );
+    for ( int p = 0; p < num_data; ++p )
+        total_neighbors += counts_host( p );
+    EXPECT_GE( nlist.memoryUsage(),
+               2 * num_data * sizeof( int ) +
+                   total_neighbors * sizeof( int ) );
+}
+
+//---------------------------------------------------------------------------//
+void trackingTest()
+{
+    Cabana::clearTrackedMemory();
+    EXPECT_EQ( Cabana::totalTrackedMemory(), 0 );
+
+    const int vector_length = 16;
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+    AoSoA_t particles( "particles", 100 );
+    AoSoA_t ghosts( "ghosts", 25 );
+
+    // Tracked structures aggregate by name.
+    Cabana::trackMemoryUsage( "particles", particles );
+    Cabana::trackMemoryUsage( "ghosts", ghosts );
+    EXPECT_EQ( Cabana::trackedMemoryUsage( "particles" ),
+               particles.memoryUsage() );
+    EXPECT_EQ( Cabana::totalTrackedMemory(),
+               particles.memoryUsage() + ghosts.memoryUsage() );
+
+    // Re-recording a name replaces its snapshot rather than adding to it.
+    particles.resize( 1000 );
+    Cabana::trackMemoryUsage( "particles", particles );
+    EXPECT_EQ( Cabana::trackedMemoryUsage( "particles" ),
+               particles.memoryUsage() );
+    EXPECT_EQ( Cabana::totalTrackedMemory(),
+               particles.memoryUsage() + ghosts.memoryUsage() );
+
+    // Unknown names read as zero.
+    EXPECT_EQ( Cabana::trackedMemoryUsage( "no_such_structure" ), 0 );
+
+    // The report lists every entry and the total.
+    std::stringstream report;
+    Cabana::memoryReport( report );
+    EXPECT_TRUE( report.str().find( "particles" ) != std::string::npos );
+    EXPECT_TRUE( report.str().find( "ghosts" ) != std::string::npos );
+    EXPECT_TRUE( report.str().find( "total" ) != std::string::npos );
+
+    // Untracked entries leave the total.
+    Cabana::untrackMemoryUsage( "ghosts" );
+    EXPECT_EQ( Cabana::totalTrackedMemory(), particles.memoryUsage() );
+
+    Cabana::clearTrackedMemory();
+    EXPECT_EQ( Cabana::totalTrackedMemory(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, aosoa_memory_usage_test ) { aosoaMemoryUsageTest(); }
+
+TEST( TEST_CATEGORY, list_memory_usage_test ) { listMemoryUsageTest(); }
+
+TEST( TEST_CATEGORY, memory_tracking_test ) { trackingTest(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
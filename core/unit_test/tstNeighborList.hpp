@@ -10,8 +10,11 @@
  ****************************************************************************/
 
 #include <Cabana_AoSoA.hpp>
+#include <Cabana_LinkedCellList.hpp>
 #include <Cabana_NeighborList.hpp>
+#include <Cabana_NeighborListTuner.hpp>
 #include <Cabana_Parallel.hpp>
+#include <Cabana_TripletList.hpp>
 #include <Cabana_VerletList.hpp>
 
 #include <Kokkos_Core.hpp>
@@ -102,6 +105,72 @@ void testLinkedCellStencil()
     }
 }
 
+//---------------------------------------------------------------------------//
+// Linked cell list stencil cell culling test.
+void testStencilCellCulling()
+{
+    // Build a stencil with cells much smaller than the radius so the cubic
+    // stencil has corner cells entirely outside the cutoff sphere.
+    double min[3] = { 0.0, 0.0, 0.0 };
+    double max[3] = { 10.0, 10.0, 10.0 };
+    double radius = 1.0;
+    double ratio = 0.25;
+    Cabana::Impl::LinkedCellStencil<double> stencil( radius, ratio, min, max );
+
+    // Home cell in the middle of the grid.
+    int c_i = 20;
+    int c_j = 20;
+    int c_k = 20;
+
+    // Adjacent cells always touch the home cell.
+    EXPECT_TRUE( stencil.cellInRange( c_i, c_j, c_k, c_i, c_j, c_k ) );
+    EXPECT_TRUE(
+        stencil.cellInRange( c_i, c_j, c_k, c_i + 1, c_j - 1, c_k + 1 ) );
+
+    // A face cell at the edge of the stencil has a gap of
+    // (cell_range - 1) * dx = 0.75 < radius and must be kept.
+    EXPECT_TRUE( stencil.cellInRange( c_i, c_j, c_k, c_i + stencil.cell_range,
+                                      c_j, c_k ) );
+
+    // A corner cell of the stencil has a gap of sqrt(3) * 0.75 > radius in
+    // every direction and cannot contain neighbors.
+    EXPECT_FALSE( stencil.cellInRange(
+        c_i + stencil.cell_range, c_j + stencil.cell_range,
+        c_k + stencil.cell_range, c_i, c_j, c_k ) );
+
+    // The cull must be conservative: every culled cell of the stencil is
+    // farther from each corner of the home cell than the cutoff.
+    int cell = stencil.grid.cardinalCellIndex( c_i, c_j, c_k );
+    int imin, imax, jmin, jmax, kmin, kmax;
+    stencil.getCells( cell, imin, imax, jmin, jmax, kmin, kmax );
+    int num_culled = 0;
+    for ( int i = imin; i < imax; ++i )
+        for ( int j = jmin; j < jmax; ++j )
+            for ( int k = kmin; k < kmax; ++k )
+                if ( !stencil.cellInRange( c_i, c_j, c_k, i, j, k ) )
+                {
+                    ++num_culled;
+                    for ( int ci = 0; ci < 2; ++ci )
+                        for ( int cj = 0; cj < 2; ++cj )
+                            for ( int ck = 0; ck < 2; ++ck )
+                            {
+                                double xp =
+                                    stencil.grid._min_x +
+                                    ( c_i + ci ) * stencil.grid._dx;
+                                double yp =
+                                    stencil.grid._min_y +
+                                    ( c_j + cj ) * stencil.grid._dy;
+                                double zp =
+                                    stencil.grid._min_z +
+                                    ( c_k + ck ) * stencil.grid._dz;
+                                EXPECT_GT( stencil.grid.minDistanceToPoint(
+                                               xp, yp, zp, i, j, k ),
+                                           stencil.rsqr );
+                            }
+                }
+    EXPECT_GT( num_culled, 0 );
+}
+
 //---------------------------------------------------------------------------//
 template <class LayoutTag, class BuildTag>
 void testVerletListFull()
@@ -219,6 +288,810 @@ void testVerletListFullPartialRange()
                                        test_data.num_ignore );
 }
 
+//---------------------------------------------------------------------------//
+template <class LayoutTag, class BuildTag>
+void testVerletListSkin()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+    double skin = 0.1 * test_data.test_radius;
+
+    // A list built without a skin has no displacement budget and is always
+    // considered stale.
+    Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag,
+                       BuildTag>
+        nlist_no_skin( position, 0, position.size(), test_data.test_radius,
+                       test_data.cell_size_ratio, test_data.grid_min,
+                       test_data.grid_max );
+    EXPECT_TRUE( nlist_no_skin.needsRebuild( position ) );
+
+    // Create the neighbor list with a skin.
+    Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag,
+                       BuildTag>
+        nlist( position, 0, position.size(), test_data.test_radius,
+               test_data.cell_size_ratio, test_data.grid_min,
+               test_data.grid_max, 0, skin );
+
+    // The skin extends the search radius so the list is a superset of the
+    // list built with the base radius alone.
+    auto counts_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), nlist._data.counts );
+    for ( int p = 0; p < test_data.num_particle; ++p )
+        EXPECT_GE( counts_host( p ),
+                   test_data.N2_list_copy.counts( p ) );
+
+    // Nothing has moved yet.
+    EXPECT_FALSE( nlist.needsRebuild( position ) );
+
+    // Move every particle less than half the skin. The list is still valid.
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, position.size() );
+    Kokkos::parallel_for(
+        policy, KOKKOS_LAMBDA( const int p ) {
+            position( p, 0 ) += 0.25 * skin;
+        } );
+    Kokkos::fence();
+    EXPECT_FALSE( nlist.needsRebuild( position ) );
+
+    // Move one particle past half the skin. The list is now stale. Also
+    // check with an explicit execution space.
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, 1 ),
+        KOKKOS_LAMBDA( const int p ) { position( p, 1 ) += skin; } );
+    Kokkos::fence();
+    EXPECT_TRUE( nlist.needsRebuild( position ) );
+    EXPECT_TRUE( nlist.needsRebuild( TEST_EXECSPACE{}, position ) );
+
+    // Rebuilding resets the displacement budget.
+    nlist.build( position, 0, position.size(), test_data.test_radius,
+                 test_data.cell_size_ratio, test_data.grid_min,
+                 test_data.grid_max, 0, skin );
+    EXPECT_FALSE( nlist.needsRebuild( position ) );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag, class BuildTag>
+void testVerletListStorageReuse()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Create the neighbor list.
+    using ListType = Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag,
+                                        LayoutTag, BuildTag>;
+    ListType nlist( position, 0, position.size(), test_data.test_radius,
+                    test_data.cell_size_ratio, test_data.grid_min,
+                    test_data.grid_max );
+    EXPECT_FALSE( nlist.storageReuseEnabled() );
+    nlist.enableStorageReuse();
+    EXPECT_TRUE( nlist.storageReuseEnabled() );
+
+    // The first rebuild with reuse enabled may still grow the storage.
+    nlist.build( position, 0, position.size(), test_data.test_radius,
+                 test_data.cell_size_ratio, test_data.grid_min,
+                 test_data.grid_max );
+    checkFullNeighborList( nlist, test_data.N2_list_copy,
+                           test_data.num_particle );
+
+    // Steady-state rebuilds must fill the same allocation.
+    auto neighbors_ptr = nlist._data.neighbors.data();
+    nlist.build( position, 0, position.size(), test_data.test_radius,
+                 test_data.cell_size_ratio, test_data.grid_min,
+                 test_data.grid_max );
+    EXPECT_EQ( neighbors_ptr, nlist._data.neighbors.data() );
+    checkFullNeighborList( nlist, test_data.N2_list_copy,
+                           test_data.num_particle );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag, class BuildTag>
+void testVerletListIndexType()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // A wider index type must produce the same list.
+    {
+        Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag,
+                           BuildTag, long long>
+            nlist( position, 0, position.size(), test_data.test_radius,
+                   test_data.cell_size_ratio, test_data.grid_min,
+                   test_data.grid_max );
+        checkFullNeighborList( nlist, test_data.N2_list_copy,
+                               test_data.num_particle );
+    }
+
+    // An unsigned type of the default width must as well.
+    {
+        Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag,
+                           BuildTag, unsigned int>
+            nlist( position, 0, position.size(), test_data.test_radius,
+                   test_data.cell_size_ratio, test_data.grid_min,
+                   test_data.grid_max );
+        checkFullNeighborList( nlist, test_data.N2_list_copy,
+                               test_data.num_particle );
+    }
+
+    // A type too narrow for the particle ids and offsets must be rejected
+    // at build time.
+    {
+        using NarrowListType =
+            Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag,
+                               LayoutTag, BuildTag, signed char>;
+        EXPECT_THROW(
+            NarrowListType( position, 0, position.size(),
+                            test_data.test_radius, test_data.cell_size_ratio,
+                            test_data.grid_min, test_data.grid_max ),
+            std::runtime_error );
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag, class BuildTag>
+void testVerletListPerParticleRadius()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+    int num_particle = test_data.num_particle;
+
+    // Give every other particle a smaller cutoff.
+    double large_radius = test_data.test_radius;
+    double small_radius = 0.6 * test_data.test_radius;
+    Kokkos::View<double*, TEST_MEMSPACE> radius( "radius", num_particle );
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_particle ),
+        KOKKOS_LAMBDA( const int p ) {
+            radius( p ) = ( 0 == p % 2 ) ? large_radius : small_radius;
+        } );
+    Kokkos::fence();
+
+    // Build the list with the per-particle radii.
+    using ListType = Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag,
+                                        LayoutTag, BuildTag>;
+    ListType nlist( position, 0, position.size(), radius,
+                    test_data.cell_size_ratio, test_data.grid_min,
+                    test_data.grid_max );
+
+    // Compute an N^2 reference on the host with the pairwise max cutoff.
+    auto aosoa_host = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           test_data.aosoa );
+    auto position_host = Cabana::slice<0>( aosoa_host );
+    auto list_copy =
+        copyListToHost( nlist, num_particle,
+                        test_data.N2_list_copy.neighbors.extent( 1 ) );
+    int total_neighbors = 0;
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        double r_p = ( 0 == p % 2 ) ? large_radius : small_radius;
+        std::vector<int> actual_neighbors;
+        for ( int n = 0; n < num_particle; ++n )
+        {
+            if ( n == p )
+                continue;
+            double r_n = ( 0 == n % 2 ) ? large_radius : small_radius;
+            double r = std::max( r_p, r_n );
+            double dist_sqr = 0.0;
+            for ( int d = 0; d < 3; ++d )
+            {
+                double dx = position_host( p, d ) - position_host( n, d );
+                dist_sqr += dx * dx;
+            }
+            if ( dist_sqr <= r * r )
+                actual_neighbors.push_back( n );
+        }
+
+        // Check the number of neighbors and the neighbors themselves.
+        EXPECT_EQ( list_copy.counts( p ),
+                   static_cast<int>( actual_neighbors.size() ) );
+        std::vector<int> computed_neighbors( actual_neighbors.size() );
+        for ( std::size_t n = 0; n < actual_neighbors.size(); ++n )
+            computed_neighbors[n] = list_copy.neighbors( p, n );
+        std::sort( computed_neighbors.begin(), computed_neighbors.end() );
+        for ( std::size_t n = 0; n < actual_neighbors.size(); ++n )
+            EXPECT_EQ( computed_neighbors[n], actual_neighbors[n] );
+
+        total_neighbors += list_copy.counts( p );
+    }
+
+    // The smaller cutoffs must have pruned pairs relative to building
+    // everything with the largest cutoff.
+    int full_radius_neighbors = 0;
+    for ( int p = 0; p < num_particle; ++p )
+        full_radius_neighbors += test_data.N2_list_copy.counts( p );
+    EXPECT_LT( total_neighbors, full_radius_neighbors );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testTripletList()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Create the neighbor list.
+    using ListType = Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag,
+                                        LayoutTag, Cabana::TeamOpTag>;
+    ListType nlist( position, 0, position.size(), test_data.test_radius,
+                    test_data.cell_size_ratio, test_data.grid_min,
+                    test_data.grid_max );
+
+    // Build the triplets with a smaller three-body cutoff.
+    double triplet_radius = 0.7 * test_data.test_radius;
+    Cabana::TripletList<TEST_MEMSPACE> triplets( nlist, position, 0,
+                                                 position.size(),
+                                                 triplet_radius );
+
+    // Compute a reference on the host from the N^2 list with the same
+    // distance filter.
+    auto aosoa_mirror = Cabana::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), test_data.aosoa );
+    auto position_mirror = Cabana::slice<0>( aosoa_mirror );
+    double rsqr = triplet_radius * triplet_radius;
+    Kokkos::View<int*, Kokkos::HostSpace> N2_counts( "N2_triplet_counts",
+                                                     test_data.num_particle );
+    Kokkos::View<int*, Kokkos::HostSpace> N2_result( "N2_triplet_result",
+                                                     test_data.num_particle );
+    for ( int p = 0; p < test_data.num_particle; ++p )
+    {
+        std::vector<int> filtered;
+        for ( int n = 0; n < test_data.N2_list_copy.counts( p ); ++n )
+        {
+            int j = test_data.N2_list_copy.neighbors( p, n );
+            double dist_sqr = 0.0;
+            for ( int d = 0; d < 3; ++d )
+            {
+                double dx = position_mirror( p, d ) - position_mirror( j, d );
+                dist_sqr += dx * dx;
+            }
+            if ( dist_sqr <= rsqr )
+                filtered.push_back( j );
+        }
+        int num_filtered = filtered.size();
+        N2_counts( p ) = num_filtered * ( num_filtered - 1 ) / 2;
+        for ( int n = 0; n < num_filtered; ++n )
+            for ( int a = n + 1; a < num_filtered; ++a )
+                N2_result( p ) += filtered[n] + filtered[a];
+    }
+
+    // Check the stored triplet counts.
+    auto counts_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), triplets.counts );
+    for ( int p = 0; p < test_data.num_particle; ++p )
+        EXPECT_EQ( counts_mirror( p ), N2_counts( p ) );
+
+    // Iterate the triplets with both operation strategies and sum the
+    // neighbor indices of each central particle.
+    Kokkos::View<int*, TEST_MEMSPACE> serial_result( "serial_result",
+                                                     test_data.num_particle );
+    Kokkos::View<int*, TEST_MEMSPACE> team_result( "team_result",
+                                                   test_data.num_particle );
+    auto serial_op = KOKKOS_LAMBDA( const int i, const int j, const int k )
+    {
+        serial_result( i ) += j + k;
+    };
+    auto team_op = KOKKOS_LAMBDA( const int i, const int j, const int k )
+    {
+        Kokkos::atomic_add( &team_result( i ), j + k );
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, test_data.num_particle );
+    Cabana::triplet_parallel_for( policy, serial_op, triplets,
+                                  Cabana::SerialOpTag(),
+                                  "test_triplet_serial" );
+    Kokkos::fence();
+    Cabana::triplet_parallel_for( policy, team_op, triplets,
+                                  Cabana::TeamOpTag(), "test_triplet_team" );
+    Kokkos::fence();
+
+    // Check the result.
+    auto serial_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), serial_result );
+    auto team_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), team_result );
+    for ( int p = 0; p < test_data.num_particle; ++p )
+    {
+        EXPECT_EQ( serial_mirror( p ), N2_result( p ) );
+        EXPECT_EQ( team_mirror( p ), N2_result( p ) );
+    }
+
+    // Reduce the same sum over all triplets with both operation strategies.
+    int N2_total = 0;
+    for ( int p = 0; p < test_data.num_particle; ++p )
+        N2_total += N2_result( p );
+    auto reduce_op = KOKKOS_LAMBDA( const int, const int j, const int k,
+                                    int& ival )
+    {
+        ival += j + k;
+    };
+    int serial_sum = 0;
+    Cabana::triplet_parallel_reduce( policy, reduce_op, triplets,
+                                     Cabana::SerialOpTag(), serial_sum,
+                                     "test_triplet_reduce_serial" );
+    Kokkos::fence();
+    int team_sum = 0;
+    Cabana::triplet_parallel_reduce( policy, reduce_op, triplets,
+                                     Cabana::TeamOpTag(), team_sum,
+                                     "test_triplet_reduce_team" );
+    Kokkos::fence();
+    EXPECT_EQ( serial_sum, N2_total );
+    EXPECT_EQ( team_sum, N2_total );
+}
+
+//---------------------------------------------------------------------------//
+void testLinkedCellParallelFor()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Bin the particles with cells sized by the cutoff.
+    double grid_size = test_data.cell_size_ratio * test_data.test_radius;
+    double grid_delta[3] = { grid_size, grid_size, grid_size };
+    Cabana::LinkedCellList<TEST_MEMSPACE> cell_list(
+        position, grid_delta, test_data.grid_min, test_data.grid_max );
+
+    // Sum the neighbor indices of each particle directly from the cells.
+    Kokkos::View<int*, TEST_MEMSPACE> result( "result",
+                                              test_data.num_particle );
+    auto pair_op = KOKKOS_LAMBDA( const int i, const int j )
+    {
+        Kokkos::atomic_add( &result( i ), j );
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, test_data.num_particle );
+    Cabana::linked_cell_parallel_for(
+        policy, pair_op, cell_list, position, test_data.test_radius,
+        test_data.cell_size_ratio, test_data.grid_min, test_data.grid_max,
+        "test_linked_cell_parallel_for" );
+    Kokkos::fence();
+
+    // Use a full N^2 neighbor list to check against.
+    Kokkos::View<int*, Kokkos::HostSpace> N2_result( "N2_result",
+                                                     test_data.num_particle );
+    for ( int p = 0; p < test_data.num_particle; ++p )
+        for ( int n = 0; n < test_data.N2_list_copy.counts( p ); ++n )
+            N2_result( p ) += test_data.N2_list_copy.neighbors( p, n );
+
+    // Check the result.
+    auto result_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), result );
+    for ( int p = 0; p < test_data.num_particle; ++p )
+        EXPECT_EQ( result_mirror( p ), N2_result( p ) );
+}
+
+//---------------------------------------------------------------------------//
+void testLinkedCellNeighborList()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Bin the particles with cells sized by the cutoff.
+    double grid_size = test_data.cell_size_ratio * test_data.test_radius;
+    double grid_delta[3] = { grid_size, grid_size, grid_size };
+    Cabana::LinkedCellList<TEST_MEMSPACE> cell_list(
+        position, grid_delta, test_data.grid_min, test_data.grid_max );
+
+    // Create the on-the-fly candidate list. No neighbor storage is
+    // materialized - candidates are read through the bin permutation.
+    auto nlist = Cabana::createLinkedCellNeighborList(
+        cell_list, position, test_data.test_radius, test_data.cell_size_ratio,
+        test_data.grid_min, test_data.grid_max );
+    using nlist_type = decltype( nlist );
+
+    // Filter the candidates with the cutoff inline, as a force kernel
+    // would, and store the survivors for comparison.
+    int num_particle = test_data.num_particle;
+    double rsqr = test_data.test_radius * test_data.test_radius;
+    int max_n = test_data.N2_list_copy.neighbors.extent( 1 );
+    TestNeighborList<TEST_MEMSPACE> filtered;
+    filtered.counts =
+        Kokkos::View<int*, TEST_MEMSPACE>( "counts", num_particle );
+    filtered.neighbors =
+        Kokkos::View<int**, TEST_MEMSPACE>( "neighbors", num_particle, max_n );
+    Kokkos::View<int*, TEST_MEMSPACE> candidate_counts( "candidates",
+                                                        num_particle );
+    Kokkos::parallel_for(
+        "filter candidates",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_particle ),
+        KOKKOS_LAMBDA( const int p ) {
+            std::size_t nc =
+                Cabana::NeighborList<nlist_type>::numNeighbor( nlist, p );
+            candidate_counts( p ) = nc;
+            int count = 0;
+            for ( std::size_t n = 0; n < nc; ++n )
+            {
+                std::size_t j =
+                    Cabana::NeighborList<nlist_type>::getNeighbor( nlist, p,
+                                                                   n );
+                double dsqr = 0.0;
+                for ( int d = 0; d < 3; ++d )
+                    dsqr += ( position( p, d ) - position( j, d ) ) *
+                            ( position( p, d ) - position( j, d ) );
+                if ( dsqr <= rsqr )
+                {
+                    filtered.neighbors( p, count ) = j;
+                    ++count;
+                }
+            }
+            filtered.counts( p ) = count;
+        } );
+    Kokkos::fence();
+
+    // The within-cutoff subset of the candidates must match the N^2 list.
+    auto list_copy = createTestListHostCopy( filtered );
+    auto candidate_mirror = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), candidate_counts );
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        // Every true neighbor is among the candidates.
+        EXPECT_GE( candidate_mirror( p ), test_data.N2_list_copy.counts( p ) );
+        EXPECT_EQ( list_copy.counts( p ), test_data.N2_list_copy.counts( p ) );
+
+        std::vector<int> computed_neighbors( list_copy.counts( p ) );
+        std::vector<int> actual_neighbors( list_copy.counts( p ) );
+        for ( int n = 0; n < list_copy.counts( p ); ++n )
+        {
+            computed_neighbors[n] = list_copy.neighbors( p, n );
+            actual_neighbors[n] = test_data.N2_list_copy.neighbors( p, n );
+        }
+        std::sort( computed_neighbors.begin(), computed_neighbors.end() );
+        std::sort( actual_neighbors.begin(), actual_neighbors.end() );
+        for ( int n = 0; n < list_copy.counts( p ); ++n )
+            EXPECT_EQ( computed_neighbors[n], actual_neighbors[n] );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testTunedNeighborList()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Create the auto-tuned neighbor list.
+    using ListType = Cabana::TunedNeighborList<TEST_MEMSPACE,
+                                               Cabana::FullNeighborTag>;
+    ListType nlist( position, 0, position.size(), test_data.test_radius,
+                    test_data.cell_size_ratio, test_data.grid_min,
+                    test_data.grid_max );
+
+    // Every candidate build of the tuning phase must produce a correct
+    // list, as must the locked-in rebuilds afterwards.
+    checkFullNeighborList( nlist, test_data.N2_list_copy,
+                           test_data.num_particle );
+    for ( int b = 1; b < ListType::num_backend + 2; ++b )
+    {
+        nlist.build( position, 0, position.size(), test_data.test_radius,
+                     test_data.cell_size_ratio, test_data.grid_min,
+                     test_data.grid_max );
+        checkFullNeighborList( nlist, test_data.N2_list_copy,
+                               test_data.num_particle );
+    }
+
+    // All candidates have been timed so the winner must be locked in and
+    // must not change across further rebuilds.
+    EXPECT_TRUE( nlist.tuned() );
+    int locked_backend = nlist.activeBackend();
+    nlist.build( position, 0, position.size(), test_data.test_radius,
+                 test_data.cell_size_ratio, test_data.grid_min,
+                 test_data.grid_max );
+    EXPECT_EQ( locked_backend, nlist.activeBackend() );
+}
+
+//---------------------------------------------------------------------------//
+void testVerletSkinTuner()
+{
+    // Synthetic cost model of a Verlet list pipeline. The rebuild interval
+    // grows with the skin while both the rebuild and the traversal cost
+    // grow with the cube of the extended radius, so the per-step cost has
+    // an interior minimum well above the small starting skin.
+    const double pair_cost = 1.0e-4;
+    auto steps_between = []( const double skin ) {
+        return std::max( 1, static_cast<int>( skin * 100.0 ) );
+    };
+    auto rebuild_time = []( const double skin, const double ratio ) {
+        return 50.0e-4 * ( 1.0 + skin ) * ( 1.0 + skin ) * ( 1.0 + skin ) *
+               ( 1.0 + ( ratio - 1.0 ) * ( ratio - 1.0 ) );
+    };
+    auto traversal_time = [=]( const double skin ) {
+        return pair_cost * ( 1.0 + skin ) * ( 1.0 + skin ) * ( 1.0 + skin );
+    };
+    auto cost_per_step = [&]( const double skin, const double ratio ) {
+        return rebuild_time( skin, ratio ) / steps_between( skin ) +
+               traversal_time( skin );
+    };
+
+    // Start with a skin that is clearly too small - the rebuild cost
+    // dominates every step.
+    Cabana::VerletSkinTuner<double> tuner( 0.02, 0.01, 1.0 );
+    double initial_cost = cost_per_step( tuner.skin(), tuner.cellSizeRatio() );
+
+    // Drive the controller with the synthetic timings.
+    const int num_rebuild = 60;
+    for ( int w = 0; w < num_rebuild; ++w )
+    {
+        double skin = tuner.skin();
+        double ratio = tuner.cellSizeRatio();
+        tuner.recordRebuild( rebuild_time( skin, ratio ) );
+        int num_step = steps_between( skin );
+        for ( int s = 0; s < num_step; ++s )
+            tuner.recordTraversal( traversal_time( skin ) );
+    }
+
+    // The first rebuild only opens a window so one fewer window closed.
+    EXPECT_EQ( tuner.numWindow(), num_rebuild - 1 );
+
+    // The tuned parameters stay in bounds and beat the starting point.
+    EXPECT_GE( tuner.skin(), 0.01 );
+    EXPECT_LE( tuner.skin(), 1.0 );
+    double tuned_cost = cost_per_step( tuner.skin(), tuner.cellSizeRatio() );
+    EXPECT_LT( tuned_cost, initial_cost );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testVerletListDistanceSort()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Create the neighbor list and sort each row by distance.
+    using ListType =
+        Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag>;
+    ListType nlist( position, 0, position.size(), test_data.test_radius,
+                    test_data.cell_size_ratio, test_data.grid_min,
+                    test_data.grid_max );
+    nlist.sortNeighborsByDistance( position );
+
+    // The neighbor sets are unchanged.
+    checkFullNeighborList( nlist, test_data.N2_list_copy,
+                           test_data.num_particle );
+
+    // Each row is in nondecreasing distance order.
+    auto list = nlist;
+    int violations = 0;
+    Kokkos::parallel_reduce(
+        "check_sorted",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, test_data.num_particle ),
+        KOKKOS_LAMBDA( const int p, int& errors ) {
+            int nn = Cabana::NeighborList<ListType>::numNeighbor( list, p );
+            double prev_dist_sqr = -1.0;
+            for ( int n = 0; n < nn; ++n )
+            {
+                std::size_t nid =
+                    Cabana::NeighborList<ListType>::getNeighbor( list, p, n );
+                double dist_sqr = 0.0;
+                for ( int d = 0; d < 3; ++d )
+                {
+                    double dx = position( p, d ) - position( nid, d );
+                    dist_sqr += dx * dx;
+                }
+                if ( dist_sqr < prev_dist_sqr )
+                    ++errors;
+                prev_dist_sqr = dist_sqr;
+            }
+        },
+        violations );
+    EXPECT_EQ( violations, 0 );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testVerletListSlicedRebuild()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+
+    // Build a deliberately incomplete list over a single particle so the
+    // sliced rebuild visibly replaces it.
+    using ListType =
+        Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag>;
+    ListType nlist( position, 0, 1, test_data.test_radius,
+                    test_data.cell_size_ratio, test_data.grid_min,
+                    test_data.grid_max );
+
+    // Start a rebuild over the full range spread across several steps.
+    int num_slices = 5;
+    Cabana::SlicedVerletRebuild<ListType> rebuild(
+        nlist, position, 0, position.size(), test_data.test_radius,
+        test_data.cell_size_ratio, test_data.grid_min, test_data.grid_max,
+        num_slices );
+    EXPECT_FALSE( rebuild.done() );
+
+    // The old build keeps serving while the rebuild is in flight: after
+    // one slice only the first particle still has neighbors.
+    rebuild.step();
+    EXPECT_FALSE( rebuild.done() );
+    auto counts = Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                       nlist._data.counts );
+    for ( std::size_t p = 1; p < counts.extent( 0 ); ++p )
+        EXPECT_EQ( counts( p ), 0 );
+
+    // Finish the rebuild. The slice schedule bounds the number of steps.
+    int num_steps = 1;
+    while ( !rebuild.step() )
+        ++num_steps;
+    ++num_steps;
+    EXPECT_TRUE( rebuild.done() );
+    EXPECT_LE( num_steps, num_slices );
+
+    // The swapped-in list is the complete new build.
+    checkFullNeighborList( nlist, test_data.N2_list_copy,
+                           test_data.num_particle );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testVerletListPeriodic()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+    int num_particle = test_data.num_particle;
+
+    // Build with all dimensions periodic across the grid bounds.
+    Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag>
+        nlist;
+    nlist.setPeriodic( true, true, true );
+    nlist.build( position, 0, position.size(), test_data.test_radius,
+                 test_data.cell_size_ratio, test_data.grid_min,
+                 test_data.grid_max );
+
+    // Compute an N^2 reference on the host with the minimum image
+    // convention.
+    auto aosoa_host = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           test_data.aosoa );
+    auto position_host = Cabana::slice<0>( aosoa_host );
+    double box[3] = { test_data.grid_max[0] - test_data.grid_min[0],
+                      test_data.grid_max[1] - test_data.grid_min[1],
+                      test_data.grid_max[2] - test_data.grid_min[2] };
+    double rsqr = test_data.test_radius * test_data.test_radius;
+    std::vector<std::vector<int>> actual_neighbors( num_particle );
+    std::size_t max_n = 0;
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        for ( int n = 0; n < num_particle; ++n )
+        {
+            if ( n == p )
+                continue;
+            double dist_sqr = 0.0;
+            for ( int d = 0; d < 3; ++d )
+            {
+                double dx = position_host( p, d ) - position_host( n, d );
+                if ( dx > 0.5 * box[d] )
+                    dx -= box[d];
+                else if ( dx < -0.5 * box[d] )
+                    dx += box[d];
+                dist_sqr += dx * dx;
+            }
+            if ( dist_sqr <= rsqr )
+                actual_neighbors[p].push_back( n );
+        }
+        max_n = std::max( max_n, actual_neighbors[p].size() );
+    }
+
+    // Check the number of neighbors and the neighbors themselves.
+    auto list_copy = copyListToHost( nlist, num_particle, max_n );
+    int total_neighbors = 0;
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        EXPECT_EQ( list_copy.counts( p ),
+                   static_cast<int>( actual_neighbors[p].size() ) );
+        std::vector<int> computed_neighbors( actual_neighbors[p].size() );
+        for ( std::size_t n = 0; n < actual_neighbors[p].size(); ++n )
+            computed_neighbors[n] = list_copy.neighbors( p, n );
+        std::sort( computed_neighbors.begin(), computed_neighbors.end() );
+        for ( std::size_t n = 0; n < actual_neighbors[p].size(); ++n )
+            EXPECT_EQ( computed_neighbors[n], actual_neighbors[p][n] );
+
+        total_neighbors += list_copy.counts( p );
+    }
+
+    // The wrap must have found pairs across the boundary that the
+    // free-space build misses.
+    int free_space_neighbors = 0;
+    for ( int p = 0; p < num_particle; ++p )
+        free_space_neighbors += test_data.N2_list_copy.counts( p );
+    EXPECT_GT( total_neighbors, free_space_neighbors );
+}
+
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testVerletListMaxNeighbors()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+    int num_particle = test_data.num_particle;
+
+    // Build with a per-particle neighbor cap smaller than the typical
+    // neighborhood.
+    const std::size_t cap = 2;
+    using ListType =
+        Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag>;
+    ListType nlist;
+    nlist.setMaxNeighbors( cap );
+    nlist.build( position, 0, position.size(), test_data.test_radius,
+                 test_data.cell_size_ratio, test_data.grid_min,
+                 test_data.grid_max );
+
+    // Compute the expected overflow report from the N^2 reference.
+    std::size_t expected_overflow = 0;
+    std::size_t expected_dropped = 0;
+    for ( int p = 0; p < num_particle; ++p )
+        if ( test_data.N2_list_copy.counts( p ) >
+             static_cast<int>( cap ) )
+        {
+            expected_overflow += 1;
+            expected_dropped += test_data.N2_list_copy.counts( p ) - cap;
+        }
+    EXPECT_EQ( nlist.maxNeighbors(), cap );
+    EXPECT_EQ( nlist.capOverflowCount(), expected_overflow );
+    EXPECT_EQ( nlist.capDroppedCount(), expected_dropped );
+    EXPECT_GT( expected_overflow, 0u );
+
+    // Check each row against the reference: the count is clamped to the
+    // cap, every retained neighbor is in the reference set, and the
+    // retained neighbors are the nearest ones.
+    auto aosoa_host = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           test_data.aosoa );
+    auto position_host = Cabana::slice<0>( aosoa_host );
+    auto dist_sqr_host = [&]( const int p, const int n ) {
+        double dsqr = 0.0;
+        for ( int d = 0; d < 3; ++d )
+        {
+            double dx = position_host( p, d ) - position_host( n, d );
+            dsqr += dx * dx;
+        }
+        return dsqr;
+    };
+    auto list_copy = copyListToHost( nlist, num_particle, cap );
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        int full_count = test_data.N2_list_copy.counts( p );
+        int expected_count = std::min( full_count, static_cast<int>( cap ) );
+        EXPECT_EQ( list_copy.counts( p ), expected_count );
+
+        // The reference distances in nondecreasing order.
+        std::vector<double> ref_dist( full_count );
+        std::vector<int> ref_ids( full_count );
+        for ( int n = 0; n < full_count; ++n )
+        {
+            ref_ids[n] = test_data.N2_list_copy.neighbors( p, n );
+            ref_dist[n] = dist_sqr_host( p, ref_ids[n] );
+        }
+        std::sort( ref_dist.begin(), ref_dist.end() );
+
+        for ( int n = 0; n < expected_count; ++n )
+        {
+            int nid = list_copy.neighbors( p, n );
+            EXPECT_NE( std::find( ref_ids.begin(), ref_ids.end(), nid ),
+                       ref_ids.end() );
+
+            // No retained neighbor may be farther than the nth nearest
+            // reference neighbor that a nearest-first retention keeps.
+            EXPECT_LE( dist_sqr_host( p, nid ),
+                       ref_dist[expected_count - 1] );
+        }
+    }
+
+    // Removing the cap and rebuilding recovers the full list and clears
+    // the overflow report.
+    nlist.setMaxNeighbors( 0 );
+    nlist.build( position, 0, position.size(), test_data.test_radius,
+                 test_data.cell_size_ratio, test_data.grid_min,
+                 test_data.grid_max );
+    EXPECT_EQ( nlist.capOverflowCount(), 0u );
+    EXPECT_EQ( nlist.capDroppedCount(), 0u );
+    checkFullNeighborList( nlist, test_data.N2_list_copy,
+                           test_data.num_particle );
+}
+
 //---------------------------------------------------------------------------//
 template <class LayoutTag>
 void testNeighborParallelFor()
@@ -237,6 +1110,9 @@ void testNeighborParallelFor()
     checkFirstNeighborParallelForLambda( nlist, test_data.N2_list_copy,
                                          test_data.num_particle );
 
+    checkFirstNeighborEarlyExitLambda( nlist, test_data.N2_list_copy,
+                                       test_data.num_particle );
+
     checkSecondNeighborParallelForLambda( nlist, test_data.N2_list_copy,
                                           test_data.num_particle );
 
@@ -254,6 +1130,87 @@ void testNeighborParallelFor()
                                            test_data.num_particle, false );
 }
 
+//---------------------------------------------------------------------------//
+template <class LayoutTag>
+void testSymmetricNeighborParallelFor()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+    int num_particle = test_data.num_particle;
+
+    // Create a full and a half list over the same particles.
+    using FullListType =
+        Cabana::VerletList<TEST_MEMSPACE, Cabana::FullNeighborTag, LayoutTag,
+                           Cabana::TeamOpTag>;
+    FullListType full_list( position, 0, position.size(),
+                            test_data.test_radius, test_data.cell_size_ratio,
+                            test_data.grid_min, test_data.grid_max );
+    using HalfListType =
+        Cabana::VerletList<TEST_MEMSPACE, Cabana::HalfNeighborTag, LayoutTag,
+                           Cabana::TeamOpTag>;
+    HalfListType half_list( position, 0, position.size(),
+                            test_data.test_radius, test_data.cell_size_ratio,
+                            test_data.grid_min, test_data.grid_max );
+
+    // Compute a reference result with the full list using the separation
+    // vector as a stand-in antisymmetric pair force.
+    using memory_space = typename TEST_MEMSPACE::memory_space;
+    Kokkos::View<double* [3], memory_space> full_result( "full_result",
+                                                         num_particle );
+    auto full_op = KOKKOS_LAMBDA( const int i, const int j )
+    {
+        for ( int d = 0; d < 3; ++d )
+            Kokkos::atomic_add( &full_result( i, d ),
+                                position( i, d ) - position( j, d ) );
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, num_particle );
+    Cabana::neighbor_parallel_for( policy, full_op, full_list,
+                                   Cabana::FirstNeighborsTag(),
+                                   Cabana::TeamOpTag(), "test_sym_full" );
+    Kokkos::fence();
+
+    // Compute the same result with the half list and symmetric accumulation,
+    // with both neighbor operation strategies.
+    Cabana::AoSoA<Cabana::MemberTypes<double[3]>, TEST_MEMSPACE> serial_aosoa(
+        "serial_force", num_particle );
+    Cabana::AoSoA<Cabana::MemberTypes<double[3]>, TEST_MEMSPACE> team_aosoa(
+        "team_force", num_particle );
+    auto serial_force = Cabana::slice<0>( serial_aosoa );
+    auto team_force = Cabana::slice<0>( team_aosoa );
+    Cabana::deep_copy( serial_force, 0.0 );
+    Cabana::deep_copy( team_force, 0.0 );
+
+    auto pair_op = KOKKOS_LAMBDA( const int i, const int j, double f_ij[] )
+    {
+        for ( int d = 0; d < 3; ++d )
+            f_ij[d] = position( i, d ) - position( j, d );
+    };
+    Cabana::symmetric_neighbor_parallel_for(
+        policy, pair_op, half_list, serial_force, Cabana::FirstNeighborsTag(),
+        Cabana::SerialOpTag(), "test_sym_serial" );
+    Cabana::symmetric_neighbor_parallel_for(
+        policy, pair_op, half_list, team_force, Cabana::FirstNeighborsTag(),
+        Cabana::TeamOpTag(), "test_sym_team" );
+    Kokkos::fence();
+
+    // Check the results against the full list reference.
+    auto full_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), full_result );
+    auto serial_host = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                            serial_aosoa );
+    auto team_host =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), team_aosoa );
+    auto serial_host_slice = Cabana::slice<0>( serial_host );
+    auto team_host_slice = Cabana::slice<0>( team_host );
+    for ( int p = 0; p < num_particle; ++p )
+        for ( int d = 0; d < 3; ++d )
+        {
+            EXPECT_NEAR( full_host( p, d ), serial_host_slice( p, d ), 1e-10 );
+            EXPECT_NEAR( full_host( p, d ), team_host_slice( p, d ), 1e-10 );
+        }
+}
+
 //---------------------------------------------------------------------------//
 template <class LayoutTag>
 void testNeighborParallelReduce()
@@ -291,6 +1248,11 @@ void testNeighborParallelReduce()
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, linked_cell_stencil_test ) { testLinkedCellStencil(); }
 
+TEST( TEST_CATEGORY, linked_cell_stencil_cull_test )
+{
+    testStencilCellCulling();
+}
+
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, verlet_list_full_test )
 {
@@ -298,11 +1260,21 @@ TEST( TEST_CATEGORY, verlet_list_full_test )
     testVerletListFull<Cabana::VerletLayoutCSR, Cabana::TeamOpTag>();
 #endif
     testVerletListFull<Cabana::VerletLayout2D, Cabana::TeamOpTag>();
+    testVerletListFull<Cabana::VerletLayoutCompressed2D, Cabana::TeamOpTag>();
 
 #ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
     testVerletListFull<Cabana::VerletLayoutCSR, Cabana::TeamVectorOpTag>();
 #endif
     testVerletListFull<Cabana::VerletLayout2D, Cabana::TeamVectorOpTag>();
+    testVerletListFull<Cabana::VerletLayoutCompressed2D,
+                       Cabana::TeamVectorOpTag>();
+
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListFull<Cabana::VerletLayoutCSR, Cabana::SerialOpTag>();
+#endif
+    testVerletListFull<Cabana::VerletLayout2D, Cabana::SerialOpTag>();
+    testVerletListFull<Cabana::VerletLayoutCompressed2D,
+                       Cabana::SerialOpTag>();
 }
 
 //---------------------------------------------------------------------------//
@@ -312,11 +1284,21 @@ TEST( TEST_CATEGORY, verlet_list_half_test )
     testVerletListHalf<Cabana::VerletLayoutCSR, Cabana::TeamOpTag>();
 #endif
     testVerletListHalf<Cabana::VerletLayout2D, Cabana::TeamOpTag>();
+    testVerletListHalf<Cabana::VerletLayoutCompressed2D, Cabana::TeamOpTag>();
 
 #ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
     testVerletListHalf<Cabana::VerletLayoutCSR, Cabana::TeamVectorOpTag>();
 #endif
     testVerletListHalf<Cabana::VerletLayout2D, Cabana::TeamVectorOpTag>();
+    testVerletListHalf<Cabana::VerletLayoutCompressed2D,
+                       Cabana::TeamVectorOpTag>();
+
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListHalf<Cabana::VerletLayoutCSR, Cabana::SerialOpTag>();
+#endif
+    testVerletListHalf<Cabana::VerletLayout2D, Cabana::SerialOpTag>();
+    testVerletListHalf<Cabana::VerletLayoutCompressed2D,
+                       Cabana::SerialOpTag>();
 }
 
 //---------------------------------------------------------------------------//
@@ -336,6 +1318,114 @@ TEST( TEST_CATEGORY, verlet_list_full_range_test )
                                    Cabana::TeamVectorOpTag>();
 }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, verlet_list_skin_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListSkin<Cabana::VerletLayoutCSR, Cabana::TeamOpTag>();
+#endif
+    testVerletListSkin<Cabana::VerletLayout2D, Cabana::TeamOpTag>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, verlet_list_per_particle_radius_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListPerParticleRadius<Cabana::VerletLayoutCSR,
+                                    Cabana::TeamOpTag>();
+#endif
+    testVerletListPerParticleRadius<Cabana::VerletLayout2D,
+                                    Cabana::TeamOpTag>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, verlet_list_index_type_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListIndexType<Cabana::VerletLayoutCSR, Cabana::TeamOpTag>();
+#endif
+    testVerletListIndexType<Cabana::VerletLayout2D, Cabana::TeamOpTag>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, verlet_list_storage_reuse_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListStorageReuse<Cabana::VerletLayoutCSR, Cabana::TeamOpTag>();
+#endif
+    testVerletListStorageReuse<Cabana::VerletLayout2D, Cabana::TeamOpTag>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, verlet_list_distance_sort_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListDistanceSort<Cabana::VerletLayoutCSR>();
+#endif
+    testVerletListDistanceSort<Cabana::VerletLayout2D>();
+    testVerletListDistanceSort<Cabana::VerletLayoutCompressed2D>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, verlet_list_sliced_rebuild_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListSlicedRebuild<Cabana::VerletLayoutCSR>();
+#endif
+    testVerletListSlicedRebuild<Cabana::VerletLayout2D>();
+    testVerletListSlicedRebuild<Cabana::VerletLayoutCompressed2D>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, verlet_list_periodic_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListPeriodic<Cabana::VerletLayoutCSR>();
+#endif
+    testVerletListPeriodic<Cabana::VerletLayout2D>();
+    testVerletListPeriodic<Cabana::VerletLayoutCompressed2D>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, verlet_list_max_neighbors_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testVerletListMaxNeighbors<Cabana::VerletLayoutCSR>();
+#endif
+    testVerletListMaxNeighbors<Cabana::VerletLayout2D>();
+    testVerletListMaxNeighbors<Cabana::VerletLayoutCompressed2D>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, triplet_list_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testTripletList<Cabana::VerletLayoutCSR>();
+#endif
+    testTripletList<Cabana::VerletLayout2D>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, linked_cell_parallel_for_test )
+{
+    testLinkedCellParallelFor();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, linked_cell_neighbor_list_test )
+{
+    testLinkedCellNeighborList();
+}
+
+TEST( TEST_CATEGORY, tuned_neighbor_list_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testTunedNeighborList();
+#endif
+}
+
+TEST( TEST_CATEGORY, verlet_skin_tuner_test ) { testVerletSkinTuner(); }
+
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, parallel_for_test )
 {
@@ -343,6 +1433,16 @@ TEST( TEST_CATEGORY, parallel_for_test )
     testNeighborParallelFor<Cabana::VerletLayoutCSR>();
 #endif
     testNeighborParallelFor<Cabana::VerletLayout2D>();
+    testNeighborParallelFor<Cabana::VerletLayoutCompressed2D>();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, symmetric_parallel_for_test )
+{
+#ifndef KOKKOS_ENABLE_OPENMPTARGET // FIXME_OPENMPTARGET
+    testSymmetricNeighborParallelFor<Cabana::VerletLayoutCSR>();
+#endif
+    testSymmetricNeighborParallelFor<Cabana::VerletLayout2D>();
 }
 
 //---------------------------------------------------------------------------//
@@ -154,6 +154,144 @@ void testArborXListHalf()
     }
 }
 
+//---------------------------------------------------------------------------//
+void testArborXListFullPerParticleRadius()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+    int num_particle = test_data.num_particle;
+
+    using device_type = TEST_MEMSPACE; // sigh...
+
+    // Uniform per-particle radii must reproduce the fixed-radius list.
+    Kokkos::View<double*, TEST_MEMSPACE> radius( "radius", num_particle );
+    Kokkos::deep_copy( radius, test_data.test_radius );
+
+    // Check CSR neighbor lists.
+    {
+        auto const nlist = Cabana::Experimental::makeNeighborList<device_type>(
+            Cabana::FullNeighborTag{}, position, 0, position.size(), radius );
+        checkFullNeighborList( nlist, test_data.N2_list_copy, num_particle );
+    }
+    // Check 2D neighbor lists.
+    {
+        auto const nlist =
+            Cabana::Experimental::make2DNeighborList<device_type>(
+                Cabana::FullNeighborTag{}, position, 0, position.size(),
+                radius );
+        checkFullNeighborList( nlist, test_data.N2_list_copy, num_particle );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testArborXListTreeReuse()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+    int num_particle = test_data.num_particle;
+
+    using device_type = TEST_MEMSPACE; // sigh...
+
+    // Build the tree from the current positions.
+    Cabana::Experimental::ReusableNeighborTree<device_type,
+                                               decltype( position )>
+        tree( position );
+
+    // An unmoved tree queried with a zero motion bound reproduces the
+    // fixed-radius list.
+    {
+        auto const nlist = Cabana::Experimental::makeNeighborList<device_type>(
+            Cabana::FullNeighborTag{}, tree, position, 0, position.size(),
+            test_data.test_radius, 0.0 );
+        checkFullNeighborList( nlist, test_data.N2_list_copy, num_particle );
+    }
+
+    // Translate all particles by less than a motion bound. Relative
+    // distances are unchanged so the reference list still applies while
+    // the tree is now stale.
+    double motion_bound = 0.4 * test_data.test_radius;
+    double shift = 0.9 * motion_bound;
+    Kokkos::parallel_for(
+        "shift_particles",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_particle ),
+        KOKKOS_LAMBDA( const int p ) { position( p, 0 ) += shift; } );
+    Kokkos::fence();
+    {
+        auto const nlist = Cabana::Experimental::makeNeighborList<device_type>(
+            Cabana::FullNeighborTag{}, tree, position, 0, position.size(),
+            test_data.test_radius, motion_bound );
+        checkFullNeighborList( nlist, test_data.N2_list_copy, num_particle );
+    }
+
+    // Rebuilding restores a tight tree.
+    tree.rebuild( position );
+    {
+        auto const nlist = Cabana::Experimental::makeNeighborList<device_type>(
+            Cabana::FullNeighborTag{}, tree, position, 0, position.size(),
+            test_data.test_radius, 0.0 );
+        checkFullNeighborList( nlist, test_data.N2_list_copy, num_particle );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testArborXListKNearest()
+{
+    // Create the AoSoA and fill with random particle positions.
+    NeighborListTestData test_data;
+    auto position = Cabana::slice<0>( test_data.aosoa );
+    int num_particle = test_data.num_particle;
+
+    using device_type = TEST_MEMSPACE; // sigh...
+
+    // Create the k-nearest neighbor list.
+    int num_neighbor = 8;
+    auto const nlist =
+        Cabana::Experimental::makeNearestNeighborList<device_type>(
+            Cabana::FullNeighborTag{}, position, 0, position.size(),
+            num_neighbor );
+
+    auto list_copy = copyListToHost( nlist, num_particle, num_neighbor );
+
+    // Check against brute-force distances on the host. The tree measures
+    // distances in single precision.
+    auto aosoa_host = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           test_data.aosoa );
+    auto host_position = Cabana::slice<0>( aosoa_host );
+    auto distance_sqr = [&]( const int i, const int j )
+    {
+        float dist_sqr = 0.0;
+        for ( int d = 0; d < 3; ++d )
+        {
+            float dx = static_cast<float>( host_position( i, d ) ) -
+                       static_cast<float>( host_position( j, d ) );
+            dist_sqr += dx * dx;
+        }
+        return dist_sqr;
+    };
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        // Every particle has exactly k neighbors, none of them itself.
+        EXPECT_EQ( list_copy.counts( p ), num_neighbor );
+        std::vector<int> in_list( num_particle, 0 );
+        float max_dist_sqr = 0.0;
+        for ( int n = 0; n < num_neighbor; ++n )
+        {
+            int j = list_copy.neighbors( p, n );
+            EXPECT_NE( j, p );
+            in_list[j] = 1;
+            max_dist_sqr = std::max( max_dist_sqr, distance_sqr( p, j ) );
+        }
+
+        // No particle outside the list may be closer than the farthest
+        // listed neighbor.
+        for ( int j = 0; j < num_particle; ++j )
+            if ( j != p && !in_list[j] )
+                EXPECT_GE( distance_sqr( p, j ), max_dist_sqr );
+    }
+}
+
 //---------------------------------------------------------------------------//
 void testArborXListFullPartialRange()
 {
@@ -313,6 +451,18 @@ TEST( TEST_CATEGORY, verlet_list_full_test ) { testArborXListFull(); }
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, verlet_list_half_test ) { testArborXListHalf(); }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, verlet_list_per_particle_radius_test )
+{
+    testArborXListFullPerParticleRadius();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, tree_reuse_list_test ) { testArborXListTreeReuse(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, k_nearest_list_test ) { testArborXListKNearest(); }
+
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, verlet_list_full_range_test )
 {
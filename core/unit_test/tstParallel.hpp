@@ -244,6 +244,260 @@ void runTest2d()
     // Check data members for proper initialization.
     checkDataMembers( aosoa, 0, aosoa.size(), fval / 2.0, dval / 2.0,
                       ival / 2.0, dim_1, dim_2, dim_3 );
+
+    // Run again with a chunked policy so each dynamically scheduled work
+    // item processes several structs, including a partial final chunk and a
+    // partial first and last struct.
+    fval = 5.1;
+    dval = 7.9;
+    ival = 2;
+    OpType func_5( aosoa, fval, dval, ival );
+
+    range_begin = 12;
+    range_end = 135;
+    Cabana::SimdPolicy<AoSoA_t::vector_length, TEST_EXECSPACE> policy_5(
+        range_begin, range_end, 3 );
+
+    // Loop in parallel using 2D array parallelism.
+    Cabana::simd_parallel_for( policy_5, func_5, "2d_test_5" );
+    Kokkos::fence();
+
+    // Check data members for proper initialization.
+    checkDataMembers( aosoa, range_begin, range_end, fval, dval, ival, dim_1,
+                      dim_2, dim_3 );
+
+    // Run again on an explicit execution space instance.
+    fval = 2.3;
+    dval = 9.3;
+    ival = 6;
+    OpType func_6( aosoa, fval, dval, ival );
+
+    TEST_EXECSPACE space{};
+    Cabana::SimdPolicy<AoSoA_t::vector_length, TEST_EXECSPACE> policy_6(
+        space, range_begin, range_end );
+
+    // Loop in parallel using 2D array parallelism.
+    Cabana::simd_parallel_for( policy_6, func_6, "2d_test_6" );
+    Kokkos::fence();
+
+    // Check data members for proper initialization.
+    checkDataMembers( aosoa, range_begin, range_end, fval, dval, ival, dim_1,
+                      dim_2, dim_3 );
+}
+
+//---------------------------------------------------------------------------//
+// Hybrid split arithmetic.
+void runTestHybridSplit()
+{
+    // An invalid fraction is rejected.
+    EXPECT_THROW( Cabana::HybridSplit( 1.5 ), std::runtime_error );
+
+    // The split index divides the range by the device fraction.
+    Cabana::HybridSplit split( 0.75 );
+    EXPECT_EQ( split.splitIndex( 0, 100 ), 75u );
+
+    // The split rounds down to an alignment boundary.
+    EXPECT_EQ( split.splitIndex( 0, 100, 16 ), 64u );
+
+    // The split never moves before the beginning of the range.
+    EXPECT_EQ( split.splitIndex( 30, 34, 16 ), 30u );
+
+    // The device did 0.75 of the work in 3x the time of the host's 0.25 -
+    // equal per-element rates, so the update balances the split.
+    split.update( 3.0, 1.0 );
+    EXPECT_DOUBLE_EQ( split.deviceFraction(), 0.5 );
+
+    // Equal times leave a balanced split unchanged.
+    split.update( 2.0, 2.0 );
+    EXPECT_DOUBLE_EQ( split.deviceFraction(), 0.5 );
+
+    // Non-positive times are ignored.
+    split.update( 0.0, 1.0 );
+    EXPECT_DOUBLE_EQ( split.deviceFraction(), 0.5 );
+}
+
+//---------------------------------------------------------------------------//
+// Hybrid parallel for covering the full range across two partitions. The
+// test execution space serves as both partitions so the data is accessible
+// from each in every configuration - the dispatch and range splitting are
+// identical to a true host-device pairing.
+void runTestHybrid2d()
+{
+    // Data dimensions.
+    const int dim_1 = 3;
+    const int dim_2 = 2;
+    const int dim_3 = 4;
+
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<float[dim_1][dim_2][dim_3], int,
+                                          double[dim_1], double[dim_1][dim_2]>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA.
+    int num_data = 155;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Create a functor to operate on.
+    using OpType = AssignmentOp<AoSoA_t, typename AoSoA_t::member_slice_type<0>,
+                                typename AoSoA_t::member_slice_type<1>,
+                                typename AoSoA_t::member_slice_type<2>,
+                                typename AoSoA_t::member_slice_type<3>>;
+    float fval = 3.4;
+    double dval = 1.23;
+    int ival = 1;
+    OpType func_1( aosoa, fval, dval, ival );
+
+    // Loop in parallel with the range split between the two partitions.
+    Cabana::HybridSplit split( 0.6 );
+    Cabana::hybrid_simd_parallel_for<AoSoA_t::vector_length, TEST_EXECSPACE,
+                                     TEST_EXECSPACE>(
+        split, 0, aosoa.size(), func_1, "hybrid_test_1" );
+
+    // Check data members for proper initialization.
+    checkDataMembers( aosoa, 0, aosoa.size(), fval, dval, ival, dim_1, dim_2,
+                      dim_3 );
+
+    // Run again with all work on the device partition.
+    fval = 93.4;
+    dval = 12.1;
+    ival = 4;
+    OpType func_2( aosoa, fval, dval, ival );
+    Cabana::HybridSplit all_device( 1.0 );
+    Cabana::hybrid_simd_parallel_for<AoSoA_t::vector_length, TEST_EXECSPACE,
+                                     TEST_EXECSPACE>(
+        all_device, 0, aosoa.size(), func_2, "hybrid_test_2" );
+    checkDataMembers( aosoa, 0, aosoa.size(), fval, dval, ival, dim_1, dim_2,
+                      dim_3 );
+
+    // Run again with all work on the host partition.
+    fval = 7.7;
+    dval = 3.2;
+    ival = 9;
+    OpType func_3( aosoa, fval, dval, ival );
+    Cabana::HybridSplit all_host( 0.0 );
+    Cabana::hybrid_simd_parallel_for<AoSoA_t::vector_length, TEST_EXECSPACE,
+                                     TEST_EXECSPACE>(
+        all_host, 0, aosoa.size(), func_3, "hybrid_test_3" );
+    checkDataMembers( aosoa, 0, aosoa.size(), fval, dval, ival, dim_1, dim_2,
+                      dim_3 );
+}
+
+//---------------------------------------------------------------------------//
+// Parallel reduce test with vectorized indexing.
+void runTestSimdReduce()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<int, double>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA where every tuple holds its own index.
+    int num_data = 155;
+    AoSoA_t aosoa( "aosoa", num_data );
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            v0( p ) = 1;
+            v1( p ) = p;
+        } );
+    Kokkos::fence();
+
+    // Reduce over a subrange not aligned with the vector length.
+    int range_begin = 12;
+    int range_end = 135;
+    Cabana::SimdPolicy<AoSoA_t::vector_length, TEST_EXECSPACE> policy(
+        range_begin, range_end );
+
+    int count_sum = 0;
+    Cabana::simd_parallel_reduce(
+        policy,
+        KOKKOS_LAMBDA( const int s, const int a, int& sum )
+        { sum += v0.access( s, a ); },
+        count_sum, "reduce_test_1" );
+    Kokkos::fence();
+    EXPECT_EQ( count_sum, range_end - range_begin );
+
+    double index_sum = 0.0;
+    Cabana::simd_parallel_reduce(
+        policy,
+        KOKKOS_LAMBDA( const int s, const int a, double& sum )
+        { sum += v1.access( s, a ); },
+        index_sum, "reduce_test_2" );
+    Kokkos::fence();
+    double expected_sum = 0.0;
+    for ( int p = range_begin; p < range_end; ++p )
+        expected_sum += p;
+    EXPECT_DOUBLE_EQ( index_sum, expected_sum );
+
+    // Reduce again with a chunked policy.
+    Cabana::SimdPolicy<AoSoA_t::vector_length, TEST_EXECSPACE> chunked_policy(
+        range_begin, range_end, 3 );
+    count_sum = 0;
+    Cabana::simd_parallel_reduce(
+        chunked_policy,
+        KOKKOS_LAMBDA( const int s, const int a, int& sum )
+        { sum += v0.access( s, a ); },
+        count_sum, "reduce_test_3" );
+    Kokkos::fence();
+    EXPECT_EQ( count_sum, range_end - range_begin );
+}
+
+//---------------------------------------------------------------------------//
+// Parallel for test with fused functors.
+void runTestFused()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<int, double>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA.
+    int num_data = 155;
+    AoSoA_t aosoa( "aosoa", num_data );
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+
+    // Compose three kernels that must execute in order within a single
+    // traversal.
+    auto assign_op = KOKKOS_LAMBDA( const int s, const int a )
+    {
+        v0.access( s, a ) = 3;
+        v1.access( s, a ) = 1.5;
+    };
+    auto add_op = KOKKOS_LAMBDA( const int s, const int a )
+    {
+        v0.access( s, a ) += 1;
+        v1.access( s, a ) += 0.5;
+    };
+    auto scale_op = KOKKOS_LAMBDA( const int s, const int a )
+    {
+        v0.access( s, a ) *= 2;
+        v1.access( s, a ) *= 2.0;
+    };
+
+    Cabana::SimdPolicy<AoSoA_t::vector_length, TEST_EXECSPACE> policy(
+        0, aosoa.size() );
+    Cabana::simd_parallel_for(
+        policy, Cabana::fuseFunctors( assign_op, add_op, scale_op ),
+        "fused_test" );
+    Kokkos::fence();
+
+    // Check that each kernel was applied, in order.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    auto v1_mirror = Cabana::slice<1>( mirror );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        EXPECT_EQ( v0_mirror( p ), 8 );
+        EXPECT_DOUBLE_EQ( v1_mirror( p ), 4.0 );
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -251,6 +505,18 @@ void runTest2d()
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, simd_parallel_for_test ) { runTest2d(); }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, hybrid_split_test ) { runTestHybridSplit(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, hybrid_simd_parallel_for_test ) { runTestHybrid2d(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, simd_parallel_for_fused_test ) { runTestFused(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, simd_parallel_reduce_test ) { runTestSimdReduce(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -52,6 +52,92 @@ void captureTest()
 //---------------------------------------------------------------------------//
 void emptyTest() { std::ignore = Cabana::makeParameterPack(); }
 
+//---------------------------------------------------------------------------//
+void deviceUpdateTest()
+{
+    // Store per-step parameters in a persistent device allocation.
+    auto params = Cabana::makeDeviceParameterPack<TEST_MEMSPACE>( 0.1, 2 );
+
+    // Capture the pack handle once in a kernel.
+    Kokkos::View<double[1], TEST_MEMSPACE> result( "result" );
+    auto read_func = KOKKOS_LAMBDA( const int )
+    {
+        result( 0 ) = Cabana::get<0>( params ) * Cabana::get<1>( params );
+    };
+    Kokkos::RangePolicy<TEST_EXECSPACE> policy( 0, 1 );
+    Kokkos::parallel_for( "read_params", policy, read_func );
+    auto result_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), result );
+    EXPECT_DOUBLE_EQ( result_host( 0 ), 0.2 );
+
+    // Refresh the values in place. The same functor reads the new values
+    // without being rebuilt.
+    params.update( 0.5, 3 );
+    Kokkos::parallel_for( "read_params", policy, read_func );
+    Kokkos::deep_copy( result_host, result );
+    EXPECT_DOUBLE_EQ( result_host( 0 ), 1.5 );
+
+    // Asynchronous update on an execution space instance orders with the
+    // kernels submitted on it.
+    params.update( TEST_EXECSPACE(), 0.25, 4 );
+    Kokkos::parallel_for( "read_params", policy, read_func );
+    Kokkos::fence();
+    Kokkos::deep_copy( result_host, result );
+    EXPECT_DOUBLE_EQ( result_host( 0 ), 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+void readOnlyTest()
+{
+    // Fill some parameter tables on the host.
+    int num_type = 4;
+    Kokkos::View<double*, TEST_MEMSPACE> epsilon( "epsilon", num_type );
+    Kokkos::View<double**, TEST_MEMSPACE> sigma( "sigma", num_type, num_type );
+    auto epsilon_host = Kokkos::create_mirror_view( epsilon );
+    auto sigma_host = Kokkos::create_mirror_view( sigma );
+    for ( int i = 0; i < num_type; ++i )
+    {
+        epsilon_host( i ) = 0.5 * i;
+        for ( int j = 0; j < num_type; ++j )
+            sigma_host( i, j ) = i + j;
+    }
+    Kokkos::deep_copy( epsilon, epsilon_host );
+    Kokkos::deep_copy( sigma, sigma_host );
+
+    // The read-only binding is const and aliases the allocation.
+    auto epsilon_ro = Cabana::makeReadOnlyView( epsilon );
+    static_assert(
+        std::is_const<typename decltype( epsilon_ro )::value_type>::value ||
+            std::is_same<typename decltype( epsilon_ro )::value_type,
+                         const double>::value,
+        "Read-only binding must have const data" );
+    EXPECT_EQ( epsilon.data(), epsilon_ro.data() );
+
+    // Capture both tables with the read-only path and accumulate through
+    // them in a kernel.
+    auto params = Cabana::makeReadOnlyParameterPack( epsilon, sigma );
+    Kokkos::View<double[1], TEST_MEMSPACE> result( "result" );
+    Kokkos::parallel_for(
+        "read_params", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, 1 ),
+        KOKKOS_LAMBDA( const int ) {
+            auto eps = Cabana::get<0>( params );
+            auto sig = Cabana::get<1>( params );
+            double sum = 0.0;
+            for ( int i = 0; i < 4; ++i )
+                for ( int j = 0; j < 4; ++j )
+                    sum += eps( i ) * sig( i, j );
+            result( 0 ) = sum;
+        } );
+
+    double expected = 0.0;
+    for ( int i = 0; i < num_type; ++i )
+        for ( int j = 0; j < num_type; ++j )
+            expected += epsilon_host( i ) * sigma_host( i, j );
+    auto result_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), result );
+    EXPECT_DOUBLE_EQ( expected, result_host( 0 ) );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -59,6 +145,10 @@ TEST( TEST_CATEGORY, parameter_pack_capture ) { captureTest(); }
 
 TEST( TEST_CATEGORY, parameter_pack_empty ) { emptyTest(); }
 
+TEST( TEST_CATEGORY, parameter_pack_device_update ) { deviceUpdateTest(); }
+
+TEST( TEST_CATEGORY, parameter_pack_read_only ) { readOnlyTest(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -0,0 +1,100 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_Profiling.hpp>
+#include <Cabana_Sort.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace Test
+{
+
+//---------------------------------------------------------------------------//
+void counterTest()
+{
+    // Counters are disabled by default and cost nothing to add to.
+    Cabana::Profiling::resetCounters();
+    EXPECT_FALSE( Cabana::Profiling::countersEnabled() );
+    Cabana::Profiling::addCounter( "test_counter", 3 );
+    EXPECT_EQ( Cabana::Profiling::counterValue( "test_counter" ), 0 );
+
+    // Enabled counters accumulate.
+    Cabana::Profiling::enableCounters( true );
+    Cabana::Profiling::addCounter( "test_counter", 3 );
+    Cabana::Profiling::addCounter( "test_counter", 4 );
+    EXPECT_EQ( Cabana::Profiling::counterValue( "test_counter" ), 7 );
+
+    // Max counters keep the largest recorded value.
+    Cabana::Profiling::maxCounter( "test_max", 5 );
+    Cabana::Profiling::maxCounter( "test_max", 2 );
+    EXPECT_EQ( Cabana::Profiling::counterValue( "test_max" ), 5 );
+
+    // Unknown counters read as zero.
+    EXPECT_EQ( Cabana::Profiling::counterValue( "no_such_counter" ), 0 );
+
+    // All accumulated names are visible.
+    auto names = Cabana::Profiling::counterNames();
+    EXPECT_TRUE( std::find( names.begin(), names.end(), "test_counter" ) !=
+                 names.end() );
+    EXPECT_TRUE( std::find( names.begin(), names.end(), "test_max" ) !=
+                 names.end() );
+
+    // Reset clears everything.
+    Cabana::Profiling::resetCounters();
+    EXPECT_EQ( Cabana::Profiling::counterValue( "test_counter" ), 0 );
+    EXPECT_TRUE( Cabana::Profiling::counterNames().empty() );
+
+    Cabana::Profiling::enableCounters( false );
+}
+
+//---------------------------------------------------------------------------//
+void instrumentationTest()
+{
+    // A library call inside a scoped region with counters enabled records
+    // its work.
+    Cabana::Profiling::enableCounters( true );
+    Cabana::Profiling::resetCounters();
+
+    int num_data = 100;
+    Kokkos::View<int*, TEST_MEMSPACE> keys( "keys", num_data );
+    Kokkos::parallel_for(
+        "fill_keys", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) { keys( i ) = num_data - i; } );
+
+    {
+        Cabana::Profiling::ScopedRegion region( "test_region" );
+        Cabana::sortByKey( keys );
+    }
+
+    EXPECT_EQ( Cabana::Profiling::counterValue( "Cabana::Sort::keys_binned" ),
+               num_data );
+
+    Cabana::Profiling::resetCounters();
+    Cabana::Profiling::enableCounters( false );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, profiling_counter_test ) { counterTest(); }
+
+TEST( TEST_CATEGORY, profiling_instrumentation_test )
+{
+    instrumentationTest();
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
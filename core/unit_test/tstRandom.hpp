@@ -0,0 +1,182 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_Random.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <set>
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+void determinismTest()
+{
+    // The generator is a pure function of the key/counter pair so the same
+    // pair must reproduce the same draws and different pairs must not.
+    int num_draw = 16;
+    Kokkos::View<uint64_t*, TEST_MEMSPACE> draws_a( "draws_a", num_draw );
+    Kokkos::View<uint64_t*, TEST_MEMSPACE> draws_b( "draws_b", num_draw );
+    Kokkos::View<uint64_t*, TEST_MEMSPACE> draws_c( "draws_c", num_draw );
+    Kokkos::parallel_for(
+        "fill_draws", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, 1 ),
+        KOKKOS_LAMBDA( const int ) {
+            Cabana::CounterRandom rand_a( 1234, 0 );
+            Cabana::CounterRandom rand_b( 1234, 0 );
+            Cabana::CounterRandom rand_c( 1235, 0 );
+            for ( int d = 0; d < num_draw; ++d )
+            {
+                draws_a( d ) = rand_a.urand64();
+                draws_b( d ) = rand_b.urand64();
+                draws_c( d ) = rand_c.urand64();
+            }
+        } );
+    auto draws_a_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), draws_a );
+    auto draws_b_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), draws_b );
+    auto draws_c_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), draws_c );
+    for ( int d = 0; d < num_draw; ++d )
+    {
+        EXPECT_EQ( draws_a_host( d ), draws_b_host( d ) );
+        EXPECT_NE( draws_a_host( d ), draws_c_host( d ) );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void sliceStateTest()
+{
+    // Store the stream state in AoSoA members so it travels with the
+    // particle data.
+    using DataTypes = Cabana::MemberTypes<double, uint64_t, uint64_t>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    int num_particle = 1000;
+    AoSoA_t aosoa( "aosoa", num_particle );
+    auto field = Cabana::slice<0>( aosoa );
+    auto keys = Cabana::slice<1>( aosoa );
+    auto counters = Cabana::slice<2>( aosoa );
+
+    // Seed a unique stream per particle.
+    Cabana::createRandomStreams( TEST_EXECSPACE(), keys, counters, 9331977 );
+
+    // All keys are distinct.
+    auto key_host = Cabana::slice<1>(
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa ) );
+    std::set<uint64_t> key_set;
+    for ( int p = 0; p < num_particle; ++p )
+        key_set.insert( key_host( p ) );
+    EXPECT_EQ( key_set.size(), static_cast<std::size_t>( num_particle ) );
+
+    // Draw two uniforms per particle in one kernel, persisting the counter.
+    Kokkos::parallel_for(
+        "draw_uniform", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_particle ),
+        KOKKOS_LAMBDA( const int p ) {
+            auto rand = Cabana::getRandom( keys, counters, p );
+            field( p ) = rand.drand() + rand.drand();
+            Cabana::saveRandom( rand, counters, p );
+        } );
+
+    // The counters advanced by the number of draws.
+    auto counter_host = Cabana::slice<2>(
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa ) );
+    for ( int p = 0; p < num_particle; ++p )
+        EXPECT_EQ( counter_host( p ), 2 );
+
+    // The sum of two uniforms has mean 1. Check the sample mean within a
+    // loose statistical bound.
+    auto field_host = Cabana::slice<0>(
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa ) );
+    double mean = 0.0;
+    for ( int p = 0; p < num_particle; ++p )
+    {
+        EXPECT_GE( field_host( p ), 0.0 );
+        EXPECT_LT( field_host( p ), 2.0 );
+        mean += field_host( p );
+    }
+    mean /= num_particle;
+    EXPECT_NEAR( mean, 1.0, 0.05 );
+
+    // A second kernel continues the streams rather than repeating them.
+    Kokkos::parallel_for(
+        "draw_again", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_particle ),
+        KOKKOS_LAMBDA( const int p ) {
+            auto rand = Cabana::getRandom( keys, counters, p );
+            field( p ) = rand.drand();
+            Cabana::saveRandom( rand, counters, p );
+        } );
+    counter_host = Cabana::slice<2>(
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa ) );
+    for ( int p = 0; p < num_particle; ++p )
+        EXPECT_EQ( counter_host( p ), 3 );
+}
+
+//---------------------------------------------------------------------------//
+void distributionTest()
+{
+    // Check the moments of the uniform and normal draws over one stream.
+    int num_draw = 100000;
+    Kokkos::View<double*, TEST_MEMSPACE> uniform( "uniform", num_draw );
+    Kokkos::View<double*, TEST_MEMSPACE> gauss( "gauss", num_draw );
+    Kokkos::parallel_for(
+        "fill_distributions", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, 1 ),
+        KOKKOS_LAMBDA( const int ) {
+            Cabana::CounterRandom rand( 77, 0 );
+            for ( int d = 0; d < num_draw; ++d )
+            {
+                uniform( d ) = rand.drand( -2.0, 3.0 );
+                gauss( d ) = rand.normal( 1.0, 2.0 );
+            }
+        } );
+    auto uniform_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), uniform );
+    auto gauss_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), gauss );
+
+    double u_mean = 0.0;
+    double g_mean = 0.0;
+    for ( int d = 0; d < num_draw; ++d )
+    {
+        EXPECT_GE( uniform_host( d ), -2.0 );
+        EXPECT_LT( uniform_host( d ), 3.0 );
+        u_mean += uniform_host( d );
+        g_mean += gauss_host( d );
+    }
+    u_mean /= num_draw;
+    g_mean /= num_draw;
+    EXPECT_NEAR( u_mean, 0.5, 0.05 );
+    EXPECT_NEAR( g_mean, 1.0, 0.05 );
+
+    double g_var = 0.0;
+    for ( int d = 0; d < num_draw; ++d )
+        g_var += ( gauss_host( d ) - g_mean ) * ( gauss_host( d ) - g_mean );
+    g_var /= num_draw;
+    EXPECT_NEAR( g_var, 4.0, 0.2 );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, random_determinism_test ) { determinismTest(); }
+
+TEST( TEST_CATEGORY, random_slice_state_test ) { sliceStateTest(); }
+
+TEST( TEST_CATEGORY, random_distribution_test ) { distributionTest(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
@@ -0,0 +1,121 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_RemoveIf.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+void testRemoveIfPredicate()
+{
+    // Data dimensions.
+    const int dim_1 = 3;
+
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[dim_1], int>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA where every tuple holds its own index.
+    int num_data = 3453;
+    AoSoA_t aosoa( "aosoa", num_data );
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            for ( int i = 0; i < dim_1; ++i )
+                v0( p, i ) = p + i;
+            v1( p ) = p;
+        } );
+    Kokkos::fence();
+
+    // Remove every third tuple.
+    auto num_keep = Cabana::remove_if(
+        aosoa,
+        KOKKOS_LAMBDA( const std::size_t i ) { return 0 == v1( i ) % 3; } );
+
+    // Check the compacted container. The remaining tuples keep their
+    // relative order.
+    int expected_keep = num_data - ( num_data + 2 ) / 3;
+    EXPECT_EQ( num_keep, std::size_t( expected_keep ) );
+    EXPECT_EQ( aosoa.size(), std::size_t( expected_keep ) );
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    auto v1_mirror = Cabana::slice<1>( mirror );
+    int expected_id = 0;
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        // Skip the removed ids.
+        if ( 0 == expected_id % 3 )
+            ++expected_id;
+
+        EXPECT_EQ( v1_mirror( p ), expected_id );
+        for ( int i = 0; i < dim_1; ++i )
+            EXPECT_EQ( v0_mirror( p, i ), expected_id + i );
+
+        ++expected_id;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testRemoveIfKeepFlags()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<int>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA where every tuple holds its own index and keep the
+    // second half of the tuples.
+    int num_data = 1000;
+    AoSoA_t aosoa( "aosoa", num_data );
+    auto v0 = Cabana::slice<0>( aosoa );
+    Kokkos::View<int*, TEST_MEMSPACE> keep_flags( "keep_flags", num_data );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            v0( p ) = p;
+            keep_flags( p ) = ( p >= 500 ) ? 1 : 0;
+        } );
+    Kokkos::fence();
+
+    auto num_keep = Cabana::remove_if( aosoa, keep_flags );
+
+    EXPECT_EQ( num_keep, std::size_t( 500 ) );
+    EXPECT_EQ( aosoa.size(), std::size_t( 500 ) );
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+        EXPECT_EQ( v0_mirror( p ), 500 + p );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, remove_if_predicate_test ) { testRemoveIfPredicate(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, remove_if_keep_flags_test ) { testRemoveIfKeepFlags(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
@@ -0,0 +1,120 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_ScatterSlice.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+void testScatterSlice()
+{
+    // Data dimensions.
+    const int dim_1 = 3;
+    const int dim_2 = 2;
+
+    // Create an AoSoA with members of different ranks.
+    using DataTypes = Cabana::MemberTypes<double[dim_1], double[dim_1][dim_2],
+                                          float, int>;
+    int num_data = 155;
+    Cabana::AoSoA<DataTypes, TEST_MEMSPACE> aosoa( "aosoa", num_data );
+
+    auto slice_0 = Cabana::slice<0>( aosoa );
+    auto slice_1 = Cabana::slice<1>( aosoa );
+    auto slice_2 = Cabana::slice<2>( aosoa );
+
+    // Give the members existing values - contributions must add onto them.
+    Cabana::deep_copy( slice_0, 1.0 );
+    Cabana::deep_copy( slice_1, 2.0 );
+    Cabana::deep_copy( slice_2, 3.0f );
+
+    // Wrap the members in scatter slices.
+    auto scatter_0 = Cabana::makeScatterSlice( slice_0 );
+    auto scatter_1 = Cabana::makeScatterSlice( slice_1 );
+    auto scatter_2 = Cabana::makeScatterSlice( slice_2 );
+    EXPECT_EQ( scatter_0.size(), num_data );
+
+    // Scatter many colliding contributions - each tuple receives one from
+    // every pass.
+    int num_pass = 4;
+    Kokkos::parallel_for(
+        "scatter", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data * num_pass ),
+        KOKKOS_LAMBDA( const int c ) {
+            auto data_0 = scatter_0.access();
+            auto data_1 = scatter_1.access();
+            auto data_2 = scatter_2.access();
+            int i = c % num_data;
+            for ( int d0 = 0; d0 < dim_1; ++d0 )
+            {
+                data_0( i, d0 ) += 1.0 * d0;
+                for ( int d1 = 0; d1 < dim_2; ++d1 )
+                    data_1( i, d0, d1 ) += 1.0 * ( d0 + d1 );
+            }
+            data_2( i ) += 0.5f;
+        } );
+    Kokkos::fence();
+
+    // The wrapped data is unchanged until the contributions are folded in.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto host_0 = Cabana::slice<0>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+        for ( int d0 = 0; d0 < dim_1; ++d0 )
+            EXPECT_DOUBLE_EQ( host_0( i, d0 ), 1.0 );
+
+    // Fold in the contributions and check the sums.
+    scatter_0.contribute();
+    scatter_1.contribute();
+    scatter_2.contribute();
+    mirror = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    host_0 = Cabana::slice<0>( mirror );
+    auto host_1 = Cabana::slice<1>( mirror );
+    auto host_2 = Cabana::slice<2>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        for ( int d0 = 0; d0 < dim_1; ++d0 )
+        {
+            EXPECT_DOUBLE_EQ( host_0( i, d0 ), 1.0 + num_pass * 1.0 * d0 );
+            for ( int d1 = 0; d1 < dim_2; ++d1 )
+                EXPECT_DOUBLE_EQ( host_1( i, d0, d1 ),
+                                  2.0 + num_pass * 1.0 * ( d0 + d1 ) );
+        }
+        EXPECT_FLOAT_EQ( host_2( i ), 3.0f + num_pass * 0.5f );
+    }
+
+    // The scatter slice is reusable after contribute().
+    Kokkos::parallel_for(
+        "scatter_again", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            auto data_2 = scatter_2.access();
+            data_2( i ) += 1.0f;
+        } );
+    Kokkos::fence();
+    scatter_2.contribute();
+    mirror = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    host_2 = Cabana::slice<2>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_FLOAT_EQ( host_2( i ), 4.0f + num_pass * 0.5f );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, scatter_slice_test ) { testScatterSlice(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
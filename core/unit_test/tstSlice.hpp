@@ -16,6 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <type_traits>
+
 namespace Test
 {
 //---------------------------------------------------------------------------//
@@ -293,6 +296,91 @@ void randomAccessTest()
     checkDataMembers( aosoa_2, fval, dval, ival, dim_1, dim_2, dim_3 );
 }
 
+//---------------------------------------------------------------------------//
+// Flattened access proxy function
+void flatSliceTest()
+{
+    // Manually set the inner array size with the test layout.
+    const int vector_length = 16;
+
+    // Data dimensions.
+    const int dim_1 = 3;
+    const int dim_2 = 2;
+    const int dim_3 = 4;
+
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<float[dim_1][dim_2][dim_3], int,
+                                          double[dim_1], double[dim_1][dim_2]>;
+
+    // Create an AoSoA.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+    int num_data = 35;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Initialize data.
+    float fval = 3.4;
+    double dval = 1.23;
+    int ival = 1;
+    initializeDataMembers( aosoa, fval, dval, ival, dim_1, dim_2, dim_3 );
+
+    // Create flattened access proxies of the data.
+    auto flat_0 = Cabana::makeFlatSlice( Cabana::slice<0>( aosoa ) );
+    auto flat_1 = Cabana::makeFlatSlice( Cabana::slice<1>( aosoa ) );
+    auto flat_2 = Cabana::makeFlatSlice( Cabana::slice<2>( aosoa ) );
+    auto flat_3 = Cabana::makeFlatSlice( Cabana::slice<3>( aosoa ) );
+    EXPECT_EQ( flat_0.size(), aosoa.size() );
+
+    // Create a second aosoa.
+    AoSoA_t aosoa_2( "aosoa_2", num_data );
+
+    // Get normal slices of the data.
+    auto slice_0 = Cabana::slice<0>( aosoa_2 );
+    auto slice_1 = Cabana::slice<1>( aosoa_2 );
+    auto slice_2 = Cabana::slice<2>( aosoa_2 );
+    auto slice_3 = Cabana::slice<3>( aosoa_2 );
+
+    // Assign the data to the new aosoa reading through the read-only path
+    // of the proxies.
+    Kokkos::parallel_for(
+        "assign flat", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int idx ) {
+            // Member 0.
+            for ( int i = 0; i < dim_1; ++i )
+                for ( int j = 0; j < dim_2; ++j )
+                    for ( int k = 0; k < dim_3; ++k )
+                        slice_0( idx, i, j, k ) = flat_0.get( idx, i, j, k );
+
+            // Member 1.
+            slice_1( idx ) = flat_1.get( idx );
+
+            // Member 2.
+            for ( int i = 0; i < dim_1; ++i )
+                slice_2( idx, i ) = flat_2.get( idx, i );
+
+            // Member 3.
+            for ( int i = 0; i < dim_1; ++i )
+                for ( int j = 0; j < dim_2; ++j )
+                    slice_3( idx, i, j ) = flat_3.get( idx, i, j );
+        } );
+    Kokkos::fence();
+
+    // Check data members for proper assignment.
+    checkDataMembers( aosoa_2, fval, dval, ival, dim_1, dim_2, dim_3 );
+
+    // Write through the proxies of the second aosoa and check again.
+    auto flat_w_1 = Cabana::makeFlatSlice( slice_1 );
+    Kokkos::parallel_for(
+        "write flat", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int idx ) { flat_w_1( idx ) += 1; } );
+    Kokkos::fence();
+
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa_2 );
+    auto mirror_slice_1 = Cabana::slice<1>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_EQ( mirror_slice_1( i ), ival + 1 );
+}
+
 //---------------------------------------------------------------------------//
 // Random access function
 void atomicAccessTest()
@@ -339,6 +427,276 @@ void atomicAccessTest()
         EXPECT_EQ( mirror_slice( i ), num_data );
 }
 
+//---------------------------------------------------------------------------//
+// Test a streaming slice of the particles.
+void streamingAccessTest()
+{
+    // Manually set the inner array size with the test layout.
+    const int vector_length = 16;
+
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+
+    // Create an AoSoA.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+    int num_data = 35;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Get streaming slices of the data.
+    auto slice_0 = Cabana::slice<0>( aosoa );
+    auto slice_1 = Cabana::slice<1>( aosoa );
+    decltype( slice_0 )::streaming_access_slice stream_slice_0 = slice_0;
+    decltype( slice_1 )::streaming_access_slice stream_slice_1 = slice_1;
+
+    // Write every element once through the streaming store with a prefetch
+    // of the next particle, the write-once pattern of an integrator.
+    Kokkos::parallel_for(
+        "stream", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            if ( i + 1 < num_data )
+            {
+                stream_slice_0.prefetch( i + 1 );
+                stream_slice_1.prefetch( i + 1 );
+            }
+            for ( int d = 0; d < 3; ++d )
+                stream_slice_0.stream( i, d, 1.0 * i + d );
+            stream_slice_1.stream( i, 2 * i );
+        } );
+    Kokkos::fence();
+
+    // Check the streamed values through regular access.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto mirror_slice_0 = Cabana::slice<0>( mirror );
+    auto mirror_slice_1 = Cabana::slice<1>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_DOUBLE_EQ( mirror_slice_0( i, d ), 1.0 * i + d );
+        EXPECT_EQ( mirror_slice_1( i ), 2 * i );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Test interleaved member storage and the whole-tuple vector accessors.
+void interleavedAccessTest()
+{
+    // Manually set the inner array size with the test layout.
+    const int vector_length = 16;
+
+    // Declare data types with an interleaved coordinate member.
+    using DataTypes =
+        Cabana::MemberTypes<Cabana::Interleaved<float[3]>, double[3]>;
+
+    // Create an AoSoA.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+    int num_data = 35;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // The interleaved member pads its components to a power-of-two block.
+    using soa_type = AoSoA_t::soa_type;
+    EXPECT_EQ( sizeof( soa_type ),
+               vector_length *
+                   ( 4 * sizeof( float ) + 3 * sizeof( double ) ) );
+
+    // An interleaved slice strides lanes by the padded extent with adjacent
+    // components; the default layout is component-major.
+    auto slice_0 = Cabana::slice<0>( aosoa );
+    auto slice_1 = Cabana::slice<1>( aosoa );
+    EXPECT_EQ( slice_0.rank(), 3 );
+    EXPECT_EQ( slice_0.extent( 2 ), 3 );
+    EXPECT_EQ( slice_0.stride( 1 ), 4 );
+    EXPECT_EQ( slice_0.stride( 2 ), 1 );
+    EXPECT_EQ( slice_1.stride( 1 ), 1 );
+    EXPECT_EQ( slice_1.stride( 2 ), vector_length );
+
+    // Initialize through the () operator of both layouts.
+    Kokkos::parallel_for(
+        "init", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+            {
+                slice_0( i, d ) = 1.0f * i + d;
+                slice_1( i, d ) = 1.0 * i - d;
+            }
+        } );
+    Kokkos::fence();
+
+    // Move whole tuples with the vector accessors - a wide transfer of the
+    // interleaved member and the scalar fallback on the default layout.
+    AoSoA_t aosoa_2( "aosoa_2", num_data );
+    auto copy_0 = Cabana::slice<0>( aosoa_2 );
+    auto copy_1 = Cabana::slice<1>( aosoa_2 );
+    Kokkos::parallel_for(
+        "vector_copy", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            float x[3];
+            slice_0.vectorLoad( i, x );
+            copy_0.vectorStore( i, x );
+            double v[3];
+            slice_1.vectorLoad( i, v );
+            copy_1.vectorStore( i, v );
+        } );
+    Kokkos::fence();
+
+    // Check the copy through regular and flattened access on the host.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa_2 );
+    auto mirror_slice_0 = Cabana::slice<0>( mirror );
+    auto mirror_slice_1 = Cabana::slice<1>( mirror );
+    auto flat_0 = Cabana::makeFlatSlice( mirror_slice_0 );
+    for ( int i = 0; i < num_data; ++i )
+        for ( int d = 0; d < 3; ++d )
+        {
+            EXPECT_FLOAT_EQ( mirror_slice_0( i, d ), 1.0f * i + d );
+            EXPECT_DOUBLE_EQ( mirror_slice_1( i, d ), 1.0 * i - d );
+            EXPECT_FLOAT_EQ( flat_0( i, d ), 1.0f * i + d );
+        }
+
+    // Gather from the interleaved member into a contiguous staging view.
+    int num_gather = num_data / 2;
+    Kokkos::View<int*, TEST_MEMSPACE> indices( "indices", num_gather );
+    Kokkos::parallel_for(
+        "make_indices", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_gather ),
+        KOKKOS_LAMBDA( const int i ) { indices( i ) = 2 * i; } );
+    Kokkos::fence();
+    Kokkos::View<float**, Kokkos::LayoutRight, TEST_MEMSPACE> gathered(
+        "gathered", num_gather, 3 );
+    Cabana::gather( slice_0, indices, gathered );
+    auto gathered_host =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), gathered );
+    for ( int i = 0; i < num_gather; ++i )
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_FLOAT_EQ( gathered_host( i, d ), 1.0f * ( 2 * i ) + d );
+}
+
+//---------------------------------------------------------------------------//
+// Test packed bitfield member storage.
+void packedBitsTest()
+{
+    // Manually set the inner array size with the test layout.
+    const int vector_length = 16;
+
+    // Declare data types with a packed flag member. Two flags pack into a
+    // single byte per tuple.
+    using flags_type = Cabana::PackedBits<2>;
+    using DataTypes = Cabana::MemberTypes<double[3], flags_type>;
+    static_assert(
+        std::is_same<flags_type::member_type, std::uint8_t>::value,
+        "two flags pack into one byte" );
+
+    // Create an AoSoA. The flag member costs one byte per tuple.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+    int num_data = 35;
+    AoSoA_t aosoa( "aosoa", num_data );
+    using soa_type = AoSoA_t::soa_type;
+    EXPECT_EQ( sizeof( soa_type ),
+               vector_length * ( 3 * sizeof( double ) + 1 ) );
+
+    // Set the flags: bit 0 on even tuples, bit 1 on every third tuple.
+    auto slice_flags = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "set_flags", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            flags_type::member_type word = 0;
+            word = flags_type::set( word, 0, 0 == i % 2 );
+            word = flags_type::set( word, 1, 0 == i % 3 );
+            slice_flags( i ) = word;
+        } );
+    Kokkos::fence();
+
+    // Clear bit 0 where bit 1 is set.
+    Kokkos::parallel_for(
+        "clear_flags", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            if ( flags_type::get( slice_flags( i ), 1 ) )
+                slice_flags( i ) =
+                    flags_type::set( slice_flags( i ), 0, false );
+        } );
+    Kokkos::fence();
+
+    // Check the flags on the host.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto mirror_flags = Cabana::slice<1>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        EXPECT_EQ( flags_type::get( mirror_flags( i ), 0 ),
+                   0 == i % 2 && 0 != i % 3 );
+        EXPECT_EQ( flags_type::get( mirror_flags( i ), 1 ), 0 == i % 3 );
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Test gathering slice data into a contiguous view and scattering it back.
+void gatherScatterTest()
+{
+    // Manually set the inner array size with the test layout.
+    const int vector_length = 16;
+
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3]>;
+
+    // Create an AoSoA.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+    int num_data = 100;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Fill the slice with the tuple index.
+    auto slice = Cabana::slice<0>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                slice( i, d ) = 1.0 * i + d;
+        } );
+    Kokkos::fence();
+
+    // Gather every other tuple.
+    int num_gather = num_data / 2;
+    Kokkos::View<int*, TEST_MEMSPACE> indices( "indices", num_gather );
+    Kokkos::parallel_for(
+        "make_indices", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_gather ),
+        KOKKOS_LAMBDA( const int i ) { indices( i ) = 2 * i; } );
+    Kokkos::fence();
+
+    Kokkos::View<double**, Kokkos::LayoutRight, TEST_MEMSPACE> gathered(
+        "gathered", num_gather, 3 );
+    Cabana::gather( slice, indices, gathered );
+
+    auto gathered_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), gathered );
+    for ( int i = 0; i < num_gather; ++i )
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_EQ( gathered_host( i, d ), 1.0 * ( 2 * i ) + d );
+
+    // Negate the gathered data and scatter it back.
+    Kokkos::parallel_for(
+        "negate", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_gather ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+                gathered( i, d ) = -gathered( i, d );
+        } );
+    Kokkos::fence();
+    Cabana::scatter( slice, indices, gathered );
+
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto mirror_slice = Cabana::slice<0>( mirror );
+    for ( int i = 0; i < num_data; ++i )
+        for ( int d = 0; d < 3; ++d )
+        {
+            double expected = ( 0 == i % 2 ) ? -( 1.0 * i + d ) : 1.0 * i + d;
+            EXPECT_EQ( mirror_slice( i, d ), expected );
+        }
+
+    // A mis-sized staging view is rejected.
+    Kokkos::View<double**, Kokkos::LayoutRight, TEST_MEMSPACE> too_small(
+        "too_small", num_gather, 2 );
+    EXPECT_THROW( Cabana::gather( slice, indices, too_small ),
+                  std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
@@ -347,9 +705,22 @@ TEST( TEST_CATEGORY, api_test ) { apiTest(); }
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, random_access_test ) { randomAccessTest(); }
 
+TEST( TEST_CATEGORY, flat_slice_test ) { flatSliceTest(); }
+
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, atomic_access_test ) { atomicAccessTest(); }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, streaming_access_test ) { streamingAccessTest(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, interleaved_access_test ) { interleavedAccessTest(); }
+
+TEST( TEST_CATEGORY, packed_bits_test ) { packedBitsTest(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, gather_scatter_test ) { gatherScatterTest(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
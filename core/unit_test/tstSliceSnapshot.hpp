@@ -0,0 +1,126 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_SliceSnapshot.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace Test
+{
+
+//---------------------------------------------------------------------------//
+// Fill the test particles with a generation-dependent pattern.
+template <class AoSoA_t>
+void fillParticles( AoSoA_t& aosoa, const int gen )
+{
+    auto host_aosoa =
+        Cabana::create_mirror_view( Kokkos::HostSpace(), aosoa );
+    auto host_x = Cabana::slice<0>( host_aosoa );
+    auto host_id = Cabana::slice<1>( host_aosoa );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        for ( int d = 0; d < 3; ++d )
+            host_x( p, d ) = gen + p + d * 0.5;
+        host_id( p ) = gen * 1000 + p;
+    }
+    Cabana::deep_copy( aosoa, host_aosoa );
+}
+
+//---------------------------------------------------------------------------//
+// Check a snapshot against the expected generation pattern.
+template <class XBuffer, class IdBuffer>
+void checkSnapshot( const XBuffer& x_snap, const IdBuffer& id_snap,
+                    const std::size_t num_data, const int gen )
+{
+    EXPECT_EQ( x_snap.extent( 0 ), num_data );
+    EXPECT_EQ( x_snap.extent( 1 ), 3 );
+    EXPECT_EQ( id_snap.extent( 0 ), num_data );
+    EXPECT_EQ( id_snap.extent( 1 ), 1 );
+    auto host_x =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), x_snap );
+    auto host_id =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), id_snap );
+    for ( std::size_t p = 0; p < num_data; ++p )
+    {
+        for ( int d = 0; d < 3; ++d )
+            EXPECT_DOUBLE_EQ( host_x( p, d ), gen + p + d * 0.5 );
+        EXPECT_EQ( host_id( p, 0 ), gen * 1000 + static_cast<int>( p ) );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void snapshotTest()
+{
+    // Make some particles.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+    std::size_t num_data = 103;
+    AoSoA_t aosoa( "particles", num_data );
+    auto x = Cabana::slice<0>( aosoa );
+    auto id = Cabana::slice<1>( aosoa );
+
+    // Make the snapshot tap.
+    TEST_EXECSPACE compute_space{};
+    auto tap =
+        Cabana::Experimental::createSliceSnapshot( TEST_EXECSPACE{}, x, id );
+
+    // Analysis before any capture must be rejected.
+    EXPECT_THROW(
+        tap.analyze( []( const TEST_EXECSPACE&, auto, auto ) {} ),
+        std::logic_error );
+
+    // Capture the first generation and check the snapshot in the callback.
+    fillParticles( aosoa, 1 );
+    tap.capture( compute_space, x, id );
+    int num_callback = 0;
+    tap.analyze( [&]( const TEST_EXECSPACE&, auto x_snap, auto id_snap ) {
+        ++num_callback;
+        checkSnapshot( x_snap, id_snap, num_data, 1 );
+    } );
+    EXPECT_EQ( num_callback, 1 );
+
+    // Overwrite the particles and capture again. The new analysis sees the
+    // new generation from the other buffer.
+    fillParticles( aosoa, 2 );
+    tap.capture( compute_space, x, id );
+    tap.analyze( [&]( const TEST_EXECSPACE&, auto x_snap, auto id_snap ) {
+        ++num_callback;
+        checkSnapshot( x_snap, id_snap, num_data, 2 );
+    } );
+    EXPECT_EQ( num_callback, 2 );
+
+    // A third cycle reuses the first buffer.
+    fillParticles( aosoa, 3 );
+    tap.capture( compute_space, x, id );
+    tap.analyze( [&]( const TEST_EXECSPACE&, auto x_snap, auto id_snap ) {
+        ++num_callback;
+        checkSnapshot( x_snap, id_snap, num_data, 3 );
+    } );
+    EXPECT_EQ( num_callback, 3 );
+
+    // Wait for everything.
+    tap.fence();
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, slice_snapshot_test ) { snapshotTest(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
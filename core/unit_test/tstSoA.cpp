@@ -68,11 +68,62 @@ void testSoA()
     EXPECT_EQ( Cabana::get<5>( soa, 2, 1, 1, 1 ), v2 );
 }
 
+//---------------------------------------------------------------------------//
+// Member iteration test
+void testForEachMember()
+{
+    // Declare an array layout.
+    const int vector_length = 4;
+
+    // Declare an soa type.
+    using member_types = Cabana::MemberTypes<double, int, float[3]>;
+    using soa_type = Cabana::SoA<member_types, vector_length>;
+
+    // Check that the index iteration visits every member in order.
+    std::size_t num_visited = 0;
+    bool in_order = true;
+    Cabana::for_each_member<member_types>(
+        [&]( auto m )
+        {
+            in_order = in_order && ( decltype( m )::value == num_visited );
+            ++num_visited;
+        } );
+    EXPECT_EQ( num_visited, member_types::size );
+    EXPECT_TRUE( in_order );
+
+    // Fill every value of every member generically through the member
+    // pointers.
+    soa_type soa;
+    Cabana::for_each_member(
+        soa,
+        [&]( auto m, auto ptr )
+        {
+            constexpr std::size_t num_values =
+                sizeof( typename soa_type::template member_data_type<
+                        decltype( m )::value> ) /
+                sizeof( typename soa_type::template member_value_type<
+                        decltype( m )::value> );
+            for ( std::size_t v = 0; v < num_values * vector_length; ++v )
+                ptr[v] = decltype( m )::value + 1;
+        } );
+
+    // Check through the member accessors.
+    for ( std::size_t a = 0; a < vector_length; ++a )
+    {
+        EXPECT_EQ( Cabana::get<0>( soa, a ), 1.0 );
+        EXPECT_EQ( Cabana::get<1>( soa, a ), 2 );
+        for ( std::size_t i = 0; i < 3; ++i )
+            EXPECT_EQ( Cabana::get<2>( soa, a, i ), 3.0f );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 TEST( cabana_soa, soa_test ) { testSoA(); }
 
+TEST( cabana_soa, soa_for_each_member_test ) { testForEachMember(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
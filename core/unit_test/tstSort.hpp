@@ -16,6 +16,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 namespace Test
 {
 //---------------------------------------------------------------------------//
@@ -101,6 +105,349 @@ void testSortByKey()
     }
 }
 
+//---------------------------------------------------------------------------//
+void testSortByKeyRadix()
+{
+    // Data dimensions.
+    const int dim_1 = 3;
+    const int dim_2 = 2;
+
+    // Declare data types.
+    using DataTypes =
+        Cabana::MemberTypes<float[dim_1], int, double[dim_1][dim_2]>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA.
+    int num_data = 3453;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Create a Kokkos view for the keys.
+    using KeyViewType = Kokkos::View<int*, typename AoSoA_t::memory_space>;
+    KeyViewType keys( "keys", num_data );
+
+    // Create the AoSoA data and keys. Create the data in reverse order so we
+    // can see that it is sorted. Make the keys negative to exercise the
+    // signed key shift in the radix sort.
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+    auto v2 = Cabana::slice<2>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            int reverse_index = aosoa.size() - p - 1;
+
+            for ( int i = 0; i < dim_1; ++i )
+                v0( p, i ) = reverse_index + i;
+
+            v1( p ) = reverse_index;
+
+            for ( int i = 0; i < dim_1; ++i )
+                for ( int j = 0; j < dim_2; ++j )
+                    v2( p, i, j ) = reverse_index + i + j;
+
+            keys( p ) = reverse_index - aosoa.size();
+        } );
+
+    // Sort the aosoa by keys with the radix backend.
+    auto binning_data = Cabana::sortByKeyRadix( keys );
+    Cabana::permute( binning_data, aosoa );
+
+    // Copy the bin data so we can check it.
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> bin_permute( "bin_permute",
+                                                           aosoa.size() );
+    Kokkos::parallel_for(
+        "copy bin data", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            bin_permute( p ) = binning_data.permutation( p );
+        } );
+    Kokkos::fence();
+    auto bin_permute_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), bin_permute );
+
+    // Check the result of the sort. The radix sort must produce the same
+    // fully-sorted ordering as the BinSort backend.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    auto v1_mirror = Cabana::slice<1>( mirror );
+    auto v2_mirror = Cabana::slice<2>( mirror );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        int reverse_index = aosoa.size() - p - 1;
+
+        for ( int i = 0; i < dim_1; ++i )
+            EXPECT_EQ( v0_mirror( p, i ), p + i );
+
+        EXPECT_EQ( v1_mirror( p ), p );
+
+        for ( int i = 0; i < dim_1; ++i )
+            for ( int j = 0; j < dim_2; ++j )
+                EXPECT_EQ( v2_mirror( p, i, j ), p + i + j );
+
+        EXPECT_EQ( bin_permute_mirror( p ), (unsigned)reverse_index );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testSortByKeyRadixExtremeKeys()
+{
+    // Keys whose range spans every bit of the key type. Before the
+    // significant bit count was bounded at the key width this input shifted
+    // by the full type width and hung the radix sort.
+    std::vector<int> key_values = { std::numeric_limits<int>::max(),
+                                    3,
+                                    std::numeric_limits<int>::min(),
+                                    0,
+                                    std::numeric_limits<int>::min(),
+                                    -7,
+                                    std::numeric_limits<int>::max(),
+                                    12 };
+    int num_data = key_values.size();
+
+    // Create a Kokkos view for the keys.
+    using KeyViewType = Kokkos::View<int*, TEST_MEMSPACE>;
+    KeyViewType keys( "keys", num_data );
+    auto keys_mirror = Kokkos::create_mirror_view( keys );
+    for ( int p = 0; p < num_data; ++p )
+        keys_mirror( p ) = key_values[p];
+    Kokkos::deep_copy( keys, keys_mirror );
+
+    // Sort the keys with the radix backend.
+    auto binning_data = Cabana::sortByKeyRadix( keys );
+
+    // Copy the bin data so we can check it.
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> bin_permute( "bin_permute",
+                                                           num_data );
+    Kokkos::parallel_for(
+        "copy bin data", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int p ) {
+            bin_permute( p ) = binning_data.permutation( p );
+        } );
+    Kokkos::fence();
+    auto bin_permute_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), bin_permute );
+
+    // Check the permutation puts the keys in ascending order.
+    std::sort( key_values.begin(), key_values.end() );
+    for ( int p = 0; p < num_data; ++p )
+        EXPECT_EQ( keys_mirror( bin_permute_mirror( p ) ), key_values[p] );
+}
+
+//---------------------------------------------------------------------------//
+void testSortByKeys()
+{
+    // Data dimensions.
+    const int dim_1 = 3;
+    const int dim_2 = 2;
+
+    // Declare data types.
+    using DataTypes =
+        Cabana::MemberTypes<float[dim_1], int, double[dim_1][dim_2]>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA.
+    int num_data = 3453;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Create Kokkos views for the keys.
+    using KeyViewType = Kokkos::View<int*, typename AoSoA_t::memory_space>;
+    KeyViewType first_keys( "first_keys", num_data );
+    KeyViewType second_keys( "second_keys", num_data );
+
+    // Create the AoSoA data and keys. Create the data in reverse order so we
+    // can see that it is sorted. Split the reverse index over the two keys
+    // so the lexicographic (first, second) ordering reverses the data.
+    const int second_size = 50;
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+    auto v2 = Cabana::slice<2>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            int reverse_index = aosoa.size() - p - 1;
+
+            for ( int i = 0; i < dim_1; ++i )
+                v0( p, i ) = reverse_index + i;
+
+            v1( p ) = reverse_index;
+
+            for ( int i = 0; i < dim_1; ++i )
+                for ( int j = 0; j < dim_2; ++j )
+                    v2( p, i, j ) = reverse_index + i + j;
+
+            first_keys( p ) = reverse_index / second_size;
+            second_keys( p ) = reverse_index % second_size;
+        } );
+
+    // Sort the aosoa by both keys with one pass and one permutation.
+    auto binning_data = Cabana::sortByKeys( first_keys, second_keys );
+    Cabana::permute( binning_data, aosoa );
+
+    // Copy the bin data so we can check it.
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> bin_permute( "bin_permute",
+                                                           aosoa.size() );
+    Kokkos::parallel_for(
+        "copy bin data", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            bin_permute( p ) = binning_data.permutation( p );
+        } );
+    Kokkos::fence();
+    auto bin_permute_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), bin_permute );
+
+    // Check the result of the sort.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    auto v1_mirror = Cabana::slice<1>( mirror );
+    auto v2_mirror = Cabana::slice<2>( mirror );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        int reverse_index = aosoa.size() - p - 1;
+
+        for ( int i = 0; i < dim_1; ++i )
+            EXPECT_EQ( v0_mirror( p, i ), p + i );
+
+        EXPECT_EQ( v1_mirror( p ), p );
+
+        for ( int i = 0; i < dim_1; ++i )
+            for ( int j = 0; j < dim_2; ++j )
+                EXPECT_EQ( v2_mirror( p, i, j ), p + i + j );
+
+        EXPECT_EQ( bin_permute_mirror( p ), (unsigned)reverse_index );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testSortByKeyInPlace()
+{
+    // Data dimensions.
+    const int dim_1 = 3;
+    const int dim_2 = 2;
+
+    // Declare data types.
+    using DataTypes =
+        Cabana::MemberTypes<float[dim_1], int, double[dim_1][dim_2]>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA.
+    int num_data = 3453;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Create a Kokkos view for the keys.
+    using KeyViewType = Kokkos::View<int*, typename AoSoA_t::memory_space>;
+    KeyViewType keys( "keys", num_data );
+
+    // Create the AoSoA data and keys. Create the data in reverse order so we
+    // can see that it is sorted.
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+    auto v2 = Cabana::slice<2>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            int reverse_index = aosoa.size() - p - 1;
+
+            for ( int i = 0; i < dim_1; ++i )
+                v0( p, i ) = reverse_index + i;
+
+            v1( p ) = reverse_index;
+
+            for ( int i = 0; i < dim_1; ++i )
+                for ( int j = 0; j < dim_2; ++j )
+                    v2( p, i, j ) = reverse_index + i + j;
+
+            keys( p ) = reverse_index;
+        } );
+
+    // Sort the aosoa by keys without a scratch copy.
+    auto binning_data = Cabana::sortByKey( keys );
+    Cabana::permuteInPlace( binning_data, aosoa );
+
+    // Check the result of the sort.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    auto v1_mirror = Cabana::slice<1>( mirror );
+    auto v2_mirror = Cabana::slice<2>( mirror );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        for ( int i = 0; i < dim_1; ++i )
+            EXPECT_EQ( v0_mirror( p, i ), p + i );
+
+        EXPECT_EQ( v1_mirror( p ), p );
+
+        for ( int i = 0; i < dim_1; ++i )
+            for ( int j = 0; j < dim_2; ++j )
+                EXPECT_EQ( v2_mirror( p, i, j ), p + i + j );
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testSortByKeyInPlaceRange()
+{
+    // Data dimensions.
+    const int dim_1 = 3;
+
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<float[dim_1], int>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA.
+    int num_data = 3453;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Create a Kokkos view for the keys.
+    using KeyViewType = Kokkos::View<int*, typename AoSoA_t::memory_space>;
+    KeyViewType keys( "keys", num_data );
+
+    // Create the AoSoA data in forward order with keys that reverse a
+    // middle subset of the range and leave the rest in place.
+    int begin = 200;
+    int end = 700;
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            for ( int i = 0; i < dim_1; ++i )
+                v0( p, i ) = p + i;
+
+            v1( p ) = p;
+
+            keys( p ) = num_data - p;
+        } );
+
+    // Sort only the subset range by the descending keys without a scratch
+    // copy - the subset comes out reversed.
+    auto binning_data = Cabana::sortByKey( keys, begin, end );
+    Cabana::permuteInPlace( binning_data, aosoa );
+
+    // Check that the subset was reversed and the rest is untouched.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    auto v1_mirror = Cabana::slice<1>( mirror );
+    for ( int p = 0; p < num_data; ++p )
+    {
+        int expected =
+            ( p >= begin && p < end ) ? ( begin + end - 1 - p ) : p;
+
+        for ( int i = 0; i < dim_1; ++i )
+            EXPECT_EQ( v0_mirror( p, i ), expected + i );
+
+        EXPECT_EQ( v1_mirror( p ), expected );
+    }
+}
+
 //---------------------------------------------------------------------------//
 void testBinByKey()
 {
@@ -198,6 +545,176 @@ void testBinByKey()
     }
 }
 
+//---------------------------------------------------------------------------//
+void testBinningStatistics()
+{
+    // Bin a known occupancy pattern: key b in 1..9 repeats b times for 45
+    // keys total. Binning with 9 divisions of the key range gives 10 bins
+    // where bin i holds i+1 keys for i in 0..7, bin 8 is empty (no key maps
+    // to it), and bin 9 holds the 9 maximum keys.
+    int num_bin = 10;
+    int num_data = 45;
+    Kokkos::View<int*, TEST_MEMSPACE> keys( "keys", num_data );
+    Kokkos::parallel_for(
+        "fill_keys", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int p ) {
+            // Key b starts at offset b * ( b - 1 ) / 2 and repeats b times.
+            int b = 1;
+            while ( ( b * ( b + 1 ) ) / 2 <= p )
+                ++b;
+            keys( p ) = b;
+        } );
+    Kokkos::fence();
+
+    auto bin_data = Cabana::binByKey( keys, num_bin - 1 );
+    EXPECT_EQ( bin_data.numBin(), num_bin );
+
+    // Summarize the occupancy.
+    auto stats = Cabana::binningStatistics( bin_data );
+    EXPECT_EQ( stats.num_bin, num_bin );
+    EXPECT_EQ( stats.num_tuple, std::size_t( num_data ) );
+    EXPECT_EQ( stats.min_count, 0 );
+    EXPECT_EQ( stats.max_count, 9 );
+    EXPECT_DOUBLE_EQ( stats.mean_count, 4.5 );
+    EXPECT_EQ( stats.num_empty, 1 );
+    EXPECT_DOUBLE_EQ( stats.empty_fraction, 0.1 );
+
+    // An empty binning summarizes to zeros.
+    Cabana::BinningData<TEST_DEVICE> empty_bin_data;
+    auto empty_stats = Cabana::binningStatistics( empty_bin_data );
+    EXPECT_EQ( empty_stats.num_bin, 0 );
+    EXPECT_EQ( empty_stats.num_tuple, 0u );
+    EXPECT_DOUBLE_EQ( empty_stats.empty_fraction, 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+void testBinByKeyIncremental()
+{
+    // Data dimensions.
+    const int dim_1 = 3;
+    const int dim_2 = 2;
+
+    // Declare data types.
+    using DataTypes =
+        Cabana::MemberTypes<float[dim_1], int, double[dim_1][dim_2]>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA.
+    int num_data = 3453;
+    AoSoA_t aosoa( "aosoa", num_data );
+
+    // Create a Kokkos view for the keys.
+    using KeyViewType = Kokkos::View<int*, typename AoSoA_t::memory_space>;
+    KeyViewType keys( "keys", num_data );
+
+    // Create the AoSoA data and keys. Create the data in reverse order so we
+    // can see that it is sorted.
+    auto v0 = Cabana::slice<0>( aosoa );
+    auto v1 = Cabana::slice<1>( aosoa );
+    auto v2 = Cabana::slice<2>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            int reverse_index = aosoa.size() - p - 1;
+
+            for ( int i = 0; i < dim_1; ++i )
+                v0( p, i ) = reverse_index + i;
+
+            v1( p ) = reverse_index;
+
+            for ( int i = 0; i < dim_1; ++i )
+                for ( int j = 0; j < dim_2; ++j )
+                    v2( p, i, j ) = reverse_index + i + j;
+
+            keys( p ) = reverse_index;
+        } );
+    Kokkos::fence();
+
+    // Bin the aosoa by keys. Use one bin per data point to effectively make
+    // this a sort.
+    auto bin_data = Cabana::binByKeyIncremental( keys, num_data - 1 );
+    Cabana::permute( bin_data, aosoa );
+
+    // Copy the bin data so we can check it.
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> bin_permute( "bin_permute",
+                                                           aosoa.size() );
+    Kokkos::View<std::size_t*, TEST_MEMSPACE> bin_offset( "bin_offset",
+                                                          aosoa.size() );
+    Kokkos::View<int*, TEST_MEMSPACE> bin_size( "bin_size", aosoa.size() );
+    Kokkos::parallel_for(
+        "copy bin data", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            bin_size( p ) = bin_data.binSize( p );
+            bin_offset( p ) = bin_data.binOffset( p );
+            bin_permute( p ) = bin_data.permutation( p );
+        } );
+    Kokkos::fence();
+    auto bin_permute_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), bin_permute );
+    auto bin_offset_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), bin_offset );
+    auto bin_size_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), bin_size );
+
+    // Check the result of the sort. The counting pass must produce the same
+    // bins as the BinSort backend.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto v0_mirror = Cabana::slice<0>( mirror );
+    auto v1_mirror = Cabana::slice<1>( mirror );
+    auto v2_mirror = Cabana::slice<2>( mirror );
+    EXPECT_EQ( bin_data.numBin(), num_data );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        int reverse_index = aosoa.size() - p - 1;
+
+        for ( int i = 0; i < dim_1; ++i )
+            EXPECT_EQ( v0_mirror( p, i ), p + i );
+
+        EXPECT_EQ( v1_mirror( p ), p );
+
+        for ( int i = 0; i < dim_1; ++i )
+            for ( int j = 0; j < dim_2; ++j )
+                EXPECT_EQ( v2_mirror( p, i, j ), p + i + j );
+
+        EXPECT_EQ( bin_size_mirror( p ), 1 );
+        EXPECT_EQ( bin_offset_mirror( p ), std::size_t( p ) );
+        EXPECT_EQ( bin_permute_mirror( p ), reverse_index );
+    }
+
+    // Rebin the already-binned data. The keys are now in bin order so the
+    // incremental path must return an identity permutation.
+    Kokkos::parallel_for(
+        "refill keys", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) { keys( p ) = p; } );
+    Kokkos::fence();
+    auto rebin_data = Cabana::binByKeyIncremental( keys, num_data - 1 );
+    Kokkos::parallel_for(
+        "copy rebin data",
+        Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            bin_size( p ) = rebin_data.binSize( p );
+            bin_offset( p ) = rebin_data.binOffset( p );
+            bin_permute( p ) = rebin_data.permutation( p );
+        } );
+    Kokkos::fence();
+    bin_permute_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), bin_permute );
+    bin_offset_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), bin_offset );
+    bin_size_mirror =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), bin_size );
+    EXPECT_EQ( rebin_data.numBin(), num_data );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        EXPECT_EQ( bin_size_mirror( p ), 1 );
+        EXPECT_EQ( bin_offset_mirror( p ), std::size_t( p ) );
+        EXPECT_EQ( bin_permute_mirror( p ), std::size_t( p ) );
+    }
+}
+
 //---------------------------------------------------------------------------//
 void testSortBySlice()
 {
@@ -537,6 +1054,67 @@ void testBinBySliceDataOnly()
     }
 }
 
+//---------------------------------------------------------------------------//
+void testSortByMortonKey()
+{
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[3], int>;
+
+    // Declare the AoSoA type.
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE>;
+
+    // Create an AoSoA with one particle per cell of a small grid, created
+    // in linearized cell order.
+    const int nx = 8;
+    int num_data = nx * nx * nx;
+    AoSoA_t aosoa( "aosoa", num_data );
+    double grid_min[3] = { 0.0, 0.0, 0.0 };
+    double grid_max[3] = { 1.0 * nx, 1.0 * nx, 1.0 * nx };
+    double grid_delta[3] = { 1.0, 1.0, 1.0 };
+    auto position = Cabana::slice<0>( aosoa );
+    auto id = Cabana::slice<1>( aosoa );
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, aosoa.size() ),
+        KOKKOS_LAMBDA( const int p ) {
+            int i = p % nx;
+            int j = ( p / nx ) % nx;
+            int k = p / ( nx * nx );
+            position( p, 0 ) = i + 0.5;
+            position( p, 1 ) = j + 0.5;
+            position( p, 2 ) = k + 0.5;
+            id( p ) = p;
+        } );
+    Kokkos::fence();
+
+    // Sort the aosoa along the Morton curve.
+    auto binning_data = Cabana::sortByMortonKey( position, grid_delta,
+                                                 grid_min, grid_max );
+    Cabana::permute( binning_data, aosoa );
+
+    // The permuted positions must walk the Z-order curve, i.e. have
+    // non-decreasing Morton keys.
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto pos_mirror = Cabana::slice<0>( mirror );
+    auto id_mirror = Cabana::slice<1>( mirror );
+    uint64_t prev_key = 0;
+    std::vector<int> seen( num_data, 0 );
+    for ( std::size_t p = 0; p < aosoa.size(); ++p )
+    {
+        int i = static_cast<int>( pos_mirror( p, 0 ) );
+        int j = static_cast<int>( pos_mirror( p, 1 ) );
+        int k = static_cast<int>( pos_mirror( p, 2 ) );
+        uint64_t key = Cabana::Impl::mortonKey( i, j, k );
+        EXPECT_LE( prev_key, key );
+        prev_key = key;
+        ++seen[id_mirror( p )];
+    }
+
+    // Every particle is still present exactly once.
+    for ( int p = 0; p < num_data; ++p )
+        EXPECT_EQ( seen[p], 1 );
+}
+
 //---------------------------------------------------------------------------//
 void testSortByKeySlice()
 {
@@ -712,9 +1290,38 @@ void testSortByKeySlice()
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, sort_by_key_test ) { testSortByKey(); }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, sort_by_key_radix_test ) { testSortByKeyRadix(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, sort_by_key_radix_extreme_keys_test )
+{
+    testSortByKeyRadixExtremeKeys();
+}
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, sort_by_keys_test ) { testSortByKeys(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, sort_by_key_in_place_test ) { testSortByKeyInPlace(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, sort_by_key_in_place_range_test )
+{
+    testSortByKeyInPlaceRange();
+}
+
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, bin_by_key_test ) { testBinByKey(); }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, binning_statistics_test ) { testBinningStatistics(); }
+
+TEST( TEST_CATEGORY, bin_by_key_incremental_test )
+{
+    testBinByKeyIncremental();
+}
+
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, sort_by_member_test ) { testSortBySlice(); }
 
@@ -733,6 +1340,9 @@ TEST( TEST_CATEGORY, bin_by_member_data_only_test )
     testBinBySliceDataOnly();
 }
 
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, sort_by_morton_key_test ) { testSortByMortonKey(); }
+
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, sort_by_key_slice_test ) { testSortByKeySlice(); }
 
@@ -0,0 +1,144 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_DeepCopy.hpp>
+#include <Cabana_SplitAoSoA.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+void testSplitAoSoA()
+{
+    // Partition the members into a hot group touched by compute kernels and
+    // a cold group touched at output only.
+    using HotTypes = Cabana::MemberTypes<double[3], double[3]>;
+    using ColdTypes = Cabana::MemberTypes<int, double>;
+    using SplitAoSoA_t =
+        Cabana::SplitAoSoA<HotTypes, ColdTypes, TEST_MEMSPACE>;
+    int num_data = 100;
+    SplitAoSoA_t aosoa( "split", num_data );
+
+    // Check sizes and the member partition.
+    EXPECT_EQ( aosoa.label(), "split" );
+    EXPECT_EQ( aosoa.size(), num_data );
+    EXPECT_FALSE( aosoa.empty() );
+    EXPECT_EQ( int( SplitAoSoA_t::hot_members ), 2 );
+    EXPECT_EQ( int( SplitAoSoA_t::cold_members ), 2 );
+    EXPECT_EQ( int( SplitAoSoA_t::number_of_members ), 4 );
+    EXPECT_EQ( aosoa.hot().size(), num_data );
+    EXPECT_EQ( aosoa.cold().size(), num_data );
+    EXPECT_EQ( aosoa.memoryUsage(),
+               aosoa.hot().memoryUsage() + aosoa.cold().memoryUsage() );
+
+    // Slice indices run over the concatenation of the groups.
+    auto position = Cabana::slice<0>( aosoa );
+    auto velocity = Cabana::slice<1>( aosoa );
+    auto type_id = Cabana::slice<2>( aosoa );
+    auto diagnostic = Cabana::slice<3>( aosoa );
+
+    // Fill the hot group in the hot execution space.
+    Kokkos::parallel_for(
+        "fill_hot", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            for ( int d = 0; d < 3; ++d )
+            {
+                position( i, d ) = 1.0 * i + d;
+                velocity( i, d ) = 0.1 * i + d;
+            }
+        } );
+    Kokkos::fence();
+
+    // Fill the cold group in the cold execution space.
+    using cold_exec_space =
+        typename SplitAoSoA_t::cold_aosoa_type::execution_space;
+    Kokkos::parallel_for(
+        "fill_cold", Kokkos::RangePolicy<cold_exec_space>( 0, num_data ),
+        KOKKOS_LAMBDA( const int i ) {
+            type_id( i ) = i;
+            diagnostic( i ) = 2.0 * i;
+        } );
+    Kokkos::fence();
+
+    // Check the data through mirrors of each group.
+    auto hot_mirror = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                           aosoa.hot() );
+    auto cold_mirror = Cabana::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), aosoa.cold() );
+    auto host_position = Cabana::slice<0>( hot_mirror );
+    auto host_velocity = Cabana::slice<1>( hot_mirror );
+    auto host_type_id = Cabana::slice<0>( cold_mirror );
+    auto host_diagnostic = Cabana::slice<1>( cold_mirror );
+    for ( int i = 0; i < num_data; ++i )
+    {
+        for ( int d = 0; d < 3; ++d )
+        {
+            EXPECT_DOUBLE_EQ( host_position( i, d ), 1.0 * i + d );
+            EXPECT_DOUBLE_EQ( host_velocity( i, d ), 0.1 * i + d );
+        }
+        EXPECT_EQ( host_type_id( i ), i );
+        EXPECT_DOUBLE_EQ( host_diagnostic( i ), 2.0 * i );
+    }
+
+    // Both groups resize together and keep their data.
+    int resized_data = 300;
+    aosoa.resize( resized_data );
+    EXPECT_EQ( aosoa.size(), resized_data );
+    EXPECT_EQ( aosoa.hot().size(), resized_data );
+    EXPECT_EQ( aosoa.cold().size(), resized_data );
+    cold_mirror = Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(),
+                                                       aosoa.cold() );
+    host_type_id = Cabana::slice<0>( cold_mirror );
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_EQ( host_type_id( i ), i );
+
+    // Shrink releases unused capacity in both groups.
+    aosoa.resize( num_data );
+    aosoa.shrinkToFit();
+    EXPECT_EQ( aosoa.capacity(), aosoa.hot().capacity() );
+    EXPECT_EQ( aosoa.hot().capacity(), aosoa.cold().capacity() );
+}
+
+//---------------------------------------------------------------------------//
+void testColdHostGroup()
+{
+    // Store the cold group in host-accessible memory. The hot group stays
+    // in the test memory space.
+    using HotTypes = Cabana::MemberTypes<double[3]>;
+    using ColdTypes = Cabana::MemberTypes<double>;
+    using SplitAoSoA_t = Cabana::SplitAoSoA<HotTypes, ColdTypes,
+                                            TEST_MEMSPACE, Kokkos::HostSpace>;
+    int num_data = 50;
+    SplitAoSoA_t aosoa( "split_host_cold", num_data );
+
+    // The cold slice is host-accessible and may be written directly.
+    auto diagnostic = Cabana::slice<1>( aosoa );
+    for ( int i = 0; i < num_data; ++i )
+        diagnostic( i ) = 3.0 * i;
+
+    for ( int i = 0; i < num_data; ++i )
+        EXPECT_DOUBLE_EQ( diagnostic( i ), 3.0 * i );
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, split_aosoa_test ) { testSplitAoSoA(); }
+
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, split_aosoa_cold_host_test ) { testColdHostGroup(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
@@ -0,0 +1,160 @@
+/****************************************************************************
+ * Copyright (c) 2018-2021 by the Cabana authors                            *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the Cabana library. Cabana is distributed under a   *
+ * BSD 3-clause license. For the licensing terms see the LICENSE file in    *
+ * the top-level directory.                                                 *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <Cabana_AoSoA.hpp>
+#include <Cabana_Parallel.hpp>
+#include <Cabana_Tuner.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace Test
+{
+
+//---------------------------------------------------------------------------//
+void tuneTest()
+{
+    Cabana::Experimental::clearConfigCache();
+
+    const int vector_length = 16;
+    using DataTypes = Cabana::MemberTypes<double>;
+    using AoSoA_t = Cabana::AoSoA<DataTypes, TEST_MEMSPACE, vector_length>;
+
+    int num_data = 1000;
+    AoSoA_t aosoa( "aosoa", num_data );
+    auto values = Cabana::slice<0>( aosoa );
+    Cabana::deep_copy( values, 0.0 );
+
+    // Tune a simple kernel over the default candidates and count how often
+    // it ran.
+    auto candidates =
+        Cabana::Experimental::defaultConfigCandidates<TEST_EXECSPACE>(
+            vector_length );
+    EXPECT_FALSE( candidates.empty() );
+
+    int num_launch = 0;
+    int num_trial = 2;
+    auto config = Cabana::Experimental::tune(
+        "test_kernel",
+        [&]( const Cabana::Experimental::SimdConfig& candidate )
+        {
+            ++num_launch;
+            Cabana::SimdPolicy<vector_length, TEST_EXECSPACE> policy(
+                0, num_data, candidate.chunk_size, candidate.team_size );
+            Cabana::simd_parallel_for(
+                policy,
+                KOKKOS_LAMBDA( const int s, const int a ) {
+                    values.access( s, a ) += 1.0;
+                },
+                "tune_kernel" );
+        },
+        candidates, num_trial );
+
+    // Each candidate ran one warm-up plus the timed trials.
+    EXPECT_EQ( num_launch,
+               static_cast<int>( candidates.size() ) * ( num_trial + 1 ) );
+
+    // The winner came from the candidate set and was registered.
+    bool found = false;
+    for ( const auto& candidate : candidates )
+        if ( candidate.team_size == config.team_size &&
+             candidate.chunk_size == config.chunk_size )
+            found = true;
+    EXPECT_TRUE( found );
+    EXPECT_TRUE( Cabana::Experimental::isTuned( "test_kernel" ) );
+
+    // Tuning again reuses the stored result without benchmarking.
+    num_launch = 0;
+    auto config_2 = Cabana::Experimental::tune(
+        "test_kernel",
+        [&]( const Cabana::Experimental::SimdConfig& ) { ++num_launch; },
+        candidates, num_trial );
+    EXPECT_EQ( num_launch, 0 );
+    EXPECT_EQ( config_2.team_size, config.team_size );
+    EXPECT_EQ( config_2.chunk_size, config.chunk_size );
+
+    // A tuned policy is usable and gives correct results.
+    auto policy =
+        Cabana::Experimental::createTunedSimdPolicy<vector_length,
+                                                    TEST_EXECSPACE>(
+            "test_kernel", 0, num_data );
+    Cabana::deep_copy( values, 0.0 );
+    Cabana::simd_parallel_for(
+        policy,
+        KOKKOS_LAMBDA( const int s, const int a ) {
+            values.access( s, a ) += 1.0;
+        },
+        "tuned_kernel" );
+    auto mirror =
+        Cabana::create_mirror_view_and_copy( Kokkos::HostSpace(), aosoa );
+    auto host_values = Cabana::slice<0>( mirror );
+    for ( int p = 0; p < num_data; ++p )
+        EXPECT_DOUBLE_EQ( host_values( p ), 1.0 );
+
+    Cabana::Experimental::clearConfigCache();
+}
+
+//---------------------------------------------------------------------------//
+void cacheTest()
+{
+    Cabana::Experimental::clearConfigCache();
+
+    // Register some configurations directly and persist them.
+    std::string filename = "tuner_test_cache.txt";
+    Cabana::Experimental::Impl::TunerRegistry::get().set( "kernel_a",
+                                                          { 16, 2, 4 } );
+    Cabana::Experimental::Impl::TunerRegistry::get().set( "kernel_b",
+                                                          { 32, 4, 1 } );
+    Cabana::Experimental::saveConfigCache( filename );
+
+    // The cache round-trips through a cleared registry.
+    Cabana::Experimental::clearConfigCache();
+    EXPECT_FALSE( Cabana::Experimental::isTuned( "kernel_a" ) );
+    EXPECT_TRUE( Cabana::Experimental::loadConfigCache( filename ) );
+    EXPECT_TRUE( Cabana::Experimental::isTuned( "kernel_a" ) );
+    auto config =
+        Cabana::Experimental::tunedConfig( "kernel_a", { 16, 1, 1 } );
+    EXPECT_EQ( config.vector_length, 16 );
+    EXPECT_EQ( config.team_size, 2 );
+    EXPECT_EQ( config.chunk_size, 4 );
+    config = Cabana::Experimental::tunedConfig( "kernel_b", { 16, 1, 1 } );
+    EXPECT_EQ( config.vector_length, 32 );
+    EXPECT_EQ( config.team_size, 4 );
+    EXPECT_EQ( config.chunk_size, 1 );
+
+    // Unknown kernels fall back to the given default.
+    config = Cabana::Experimental::tunedConfig( "kernel_c", { 16, 1, 8 } );
+    EXPECT_EQ( config.team_size, 1 );
+    EXPECT_EQ( config.chunk_size, 8 );
+
+    // A missing cache file is reported, not thrown.
+    EXPECT_FALSE(
+        Cabana::Experimental::loadConfigCache( "no_such_cache.txt" ) );
+
+    std::remove( filename.c_str() );
+    Cabana::Experimental::clearConfigCache();
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST( TEST_CATEGORY, tuner_tune_test ) { tuneTest(); }
+
+TEST( TEST_CATEGORY, tuner_cache_test ) { cacheTest(); }
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
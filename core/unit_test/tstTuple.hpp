@@ -113,11 +113,67 @@ void runTest()
     checkDataMembers( tuples, fval, dval, ival, dim_1, dim_2, dim_3 );
 }
 
+//---------------------------------------------------------------------------//
+// Member iteration test
+void runForEachMemberTest()
+{
+    // Data dimensions.
+    const std::size_t dim_1 = 3;
+    const std::size_t dim_2 = 2;
+
+    // Declare data types.
+    using DataTypes = Cabana::MemberTypes<double[dim_1], int, float[dim_1][dim_2]>;
+
+    // Declare the tuple type.
+    using Tuple_t = Cabana::Tuple<DataTypes>;
+
+    // Create a view of tuples.
+    std::size_t num_data = 87;
+    Kokkos::View<Tuple_t*, TEST_MEMSPACE> tuples( "tuples", num_data );
+
+    // Fill every value of every member of every tuple generically through
+    // the member pointers.
+    Kokkos::parallel_for(
+        "fill_members", Kokkos::RangePolicy<TEST_EXECSPACE>( 0, num_data ),
+        KOKKOS_LAMBDA( const std::size_t idx ) {
+            Cabana::for_each_member(
+                tuples( idx ),
+                [&]( auto m, auto ptr )
+                {
+                    constexpr std::size_t num_values =
+                        sizeof( typename Tuple_t::template member_data_type<
+                                decltype( m )::value> ) /
+                        sizeof( typename Tuple_t::template member_value_type<
+                                decltype( m )::value> );
+                    for ( std::size_t v = 0; v < num_values; ++v )
+                        ptr[v] = decltype( m )::value + 1 + idx;
+                } );
+        } );
+    Kokkos::fence();
+
+    // Check through the member accessors.
+    auto mirror_view =
+        Kokkos::create_mirror_view_and_copy( Kokkos::HostSpace(), tuples );
+    for ( std::size_t idx = 0; idx < num_data; ++idx )
+    {
+        for ( std::size_t i = 0; i < dim_1; ++i )
+            EXPECT_EQ( Cabana::get<0>( mirror_view( idx ), i ), 1.0 + idx );
+        EXPECT_EQ( Cabana::get<1>( mirror_view( idx ) ),
+                   static_cast<int>( 2 + idx ) );
+        for ( std::size_t i = 0; i < dim_1; ++i )
+            for ( std::size_t j = 0; j < dim_2; ++j )
+                EXPECT_EQ( Cabana::get<2>( mirror_view( idx ), i, j ),
+                           3.0f + idx );
+    }
+}
+
 //---------------------------------------------------------------------------//
 // RUN TESTS
 //---------------------------------------------------------------------------//
 TEST( TEST_CATEGORY, tuple_test ) { runTest(); }
 
+TEST( TEST_CATEGORY, tuple_for_each_member_test ) { runForEachMemberTest(); }
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test